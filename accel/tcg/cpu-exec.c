@@ -255,6 +255,7 @@ void cpu_exec_step_atomic(CPUState *cpu)
         }
 
         start_exclusive();
+        atomic_set(&tb_ctx.serial_exec_count, tb_ctx.serial_exec_count + 1);
 
         /* Since we got here, we know that parallel_cpus must be true.  */
         parallel_cpus = false;
@@ -390,6 +391,13 @@ static inline TranslationBlock *tb_find(CPUState *cpu,
 
     tb = tb_lookup__cpu_state(cpu, &pc, &cs_base, &flags, cf_mask);
     if (tb == NULL) {
+        /* Rather than translate it twice, wait for a translator thread
+         * that is already working on this block.
+         */
+        if (tb_prefetch_enabled()) {
+            tb_prefetch_wait(pc, cs_base, flags, cf_mask);
+        }
+
         /* mmap_lock is needed by tb_gen_code, and mmap_lock must be
          * taken outside tb_lock. As system emulation is currently
          * single threaded the locks are NOPs.
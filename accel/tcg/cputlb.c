@@ -73,6 +73,20 @@ QEMU_BUILD_BUG_ON(sizeof(target_ulong) > sizeof(run_on_cpu_data));
 QEMU_BUILD_BUG_ON(NB_MMU_MODES > 16);
 #define ALL_MMUIDX_BITS ((1 << NB_MMU_MODES) - 1)
 
+static void tlb_asid_flush_by_mmuidx(CPUArchState *env, uint16_t idxmap);
+static void tlb_asid_flush_page(CPUArchState *env, target_ulong addr,
+                                uint16_t idxmap);
+static void tlb_add_large_page(CPUArchState *env, target_ulong vaddr,
+                               target_ulong size);
+
+/* Entries are about to be dropped or replaced: requests that the TB
+ * prefetch threads hold for this CPU may refer to stale mappings.
+ */
+static inline void tlb_gen_bump(CPUArchState *env)
+{
+    atomic_set(&env->tlb_gen, env->tlb_gen + 1);
+}
+
 /* flush_all_helper: run fn across all cpus
  *
  * If the wait flag is set then the src cpu's helper will be queued as
@@ -123,12 +137,14 @@ static void tlb_flush_nocheck(CPUState *cpu)
 
     assert_cpu_is_self(cpu);
     atomic_set(&env->tlb_flush_count, env->tlb_flush_count + 1);
+    tlb_gen_bump(env);
     tlb_debug("(count: %zu)\n", tlb_flush_count());
 
     tb_lock();
 
     memset(env->tlb_table, -1, sizeof(env->tlb_table));
     memset(env->tlb_v_table, -1, sizeof(env->tlb_v_table));
+    tlb_asid_flush_by_mmuidx(env, ALL_MMUIDX_BITS);
     cpu_tb_jmp_cache_clear(cpu);
 
     env->vtlb_index = 0;
@@ -172,18 +188,12 @@ void tlb_flush_all_cpus_synced(CPUState *src_cpu)
     async_safe_run_on_cpu(src_cpu, fn, RUN_ON_CPU_NULL);
 }
 
-static void tlb_flush_by_mmuidx_async_work(CPUState *cpu, run_on_cpu_data data)
+static void tlb_flush_live_by_mmuidx(CPUArchState *env,
+                                     unsigned long mmu_idx_bitmask)
 {
-    CPUArchState *env = cpu->env_ptr;
-    unsigned long mmu_idx_bitmask = data.host_int;
     int mmu_idx;
 
-    assert_cpu_is_self(cpu);
-
-    tb_lock();
-
-    tlb_debug("start: mmu_idx:0x%04lx\n", mmu_idx_bitmask);
-
+    tlb_gen_bump(env);
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
 
         if (test_bit(mmu_idx, &mmu_idx_bitmask)) {
@@ -193,6 +203,21 @@ static void tlb_flush_by_mmuidx_async_work(CPUState *cpu, run_on_cpu_data data)
             memset(env->tlb_v_table[mmu_idx], -1, sizeof(env->tlb_v_table[0]));
         }
     }
+}
+
+static void tlb_flush_by_mmuidx_async_work(CPUState *cpu, run_on_cpu_data data)
+{
+    CPUArchState *env = cpu->env_ptr;
+    unsigned long mmu_idx_bitmask = data.host_int;
+
+    assert_cpu_is_self(cpu);
+
+    tb_lock();
+
+    tlb_debug("start: mmu_idx:0x%04lx\n", mmu_idx_bitmask);
+
+    tlb_flush_live_by_mmuidx(env, mmu_idx_bitmask);
+    tlb_asid_flush_by_mmuidx(env, mmu_idx_bitmask);
 
     cpu_tb_jmp_cache_clear(cpu);
 
@@ -280,6 +305,7 @@ static void tlb_flush_page_async_work(CPUState *cpu, run_on_cpu_data data)
 
     addr &= TARGET_PAGE_MASK;
     i = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    tlb_gen_bump(env);
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
         tlb_flush_entry(&env->tlb_table[mmu_idx][i], addr);
     }
@@ -292,6 +318,8 @@ static void tlb_flush_page_async_work(CPUState *cpu, run_on_cpu_data data)
         }
     }
 
+    tlb_asid_flush_page(env, addr, ALL_MMUIDX_BITS);
+
     tb_flush_jmp_cache(cpu, addr);
 }
 
@@ -328,6 +356,7 @@ static void tlb_flush_page_by_mmuidx_async_work(CPUState *cpu,
     tlb_debug("page:%d addr:"TARGET_FMT_lx" mmu_idx:0x%lx\n",
               page, addr, mmu_idx_bitmap);
 
+    tlb_gen_bump(env);
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
         if (test_bit(mmu_idx, &mmu_idx_bitmap)) {
             tlb_flush_entry(&env->tlb_table[mmu_idx][page], addr);
@@ -339,6 +368,8 @@ static void tlb_flush_page_by_mmuidx_async_work(CPUState *cpu,
         }
     }
 
+    tlb_asid_flush_page(env, addr, mmu_idx_bitmap);
+
     tb_flush_jmp_cache(cpu, addr);
 }
 
@@ -434,6 +465,328 @@ void tlb_flush_page_all_cpus_synced(CPUState *src,
     async_safe_run_on_cpu(src, fn, RUN_ON_CPU_TARGET_PTR(addr));
 }
 
+/* ASID-tagged TLB partitions
+ *
+ * Targets whose MMU tags translations with an address space identifier
+ * can tell us which ASID the live tables of a set of MMU indexes belong
+ * to with tlb_set_asid_by_mmuidx().  Instead of flushing those indexes on
+ * every switch, the outgoing entries are parked in a small per-vCPU set
+ * of saved tables and the incoming ASID's entries are brought back if we
+ * still hold them.  The fast path in generated code is unchanged: it only
+ * ever sees the live tables.
+ *
+ * Saved tables are kept as coherent as the live ones: page flushes are
+ * applied to them, MMU index flushes drop them, and tlb_reset_dirty()
+ * walks them so that writes to code are still caught once they come back.
+ * Everything runs on the owning vCPU except tlb_reset_dirty(); the spin
+ * lock serialises that walk against moving entries in and out of slots.
+ */
+
+#define TLB_ASID_SLOTS 8
+
+typedef struct CPUTLBSavedTable {
+    CPUTLBEntry table[CPU_TLB_SIZE];
+    CPUTLBEntry v_table[CPU_VTLB_SIZE];
+    CPUIOTLBEntry iotlb[CPU_TLB_SIZE];
+    CPUIOTLBEntry iotlb_v[CPU_VTLB_SIZE];
+} CPUTLBSavedTable;
+
+typedef struct CPUTLBASIDSlot {
+    uint32_t asid;
+    /* MMU indexes holding saved entries; zero if the slot is free */
+    uint16_t idxmap;
+    uint64_t stamp;
+    /* large page region of the live TLB at the time it was saved */
+    target_ulong flush_addr;
+    target_ulong flush_mask;
+    CPUTLBSavedTable *saved[NB_MMU_MODES];
+} CPUTLBASIDSlot;
+
+struct CPUTLBASIDCache {
+    QemuSpin lock;
+    /* when valid, the live tables for idxmap belong to asid */
+    bool valid;
+    uint32_t asid;
+    uint16_t idxmap;
+    uint64_t clock;
+    CPUTLBASIDSlot slot[TLB_ASID_SLOTS];
+};
+
+/* The ASID and MMU index bitmap share one run_on_cpu_data word */
+QEMU_BUILD_BUG_ON(sizeof(unsigned long) < 4);
+#define TLB_ASID_MASK 0xffff
+
+static CPUTLBASIDCache *tlb_asid_cache_get(CPUArchState *env)
+{
+    CPUTLBASIDCache *cache = env->tlb_asid_cache;
+
+    if (!cache) {
+        cache = g_new0(CPUTLBASIDCache, 1);
+        qemu_spin_init(&cache->lock);
+        atomic_rcu_set(&env->tlb_asid_cache, cache);
+    }
+    return cache;
+}
+
+/* Drop saved entries for the MMU indexes in @idxmap.  A full flush also
+ * forgets which ASID the live tables belong to, since it is used on reset
+ * and migration where the registers holding the ASID change behind our
+ * back.
+ */
+static void tlb_asid_flush_by_mmuidx(CPUArchState *env, uint16_t idxmap)
+{
+    CPUTLBASIDCache *cache = env->tlb_asid_cache;
+    int i;
+
+    if (!cache) {
+        return;
+    }
+
+    qemu_spin_lock(&cache->lock);
+    for (i = 0; i < TLB_ASID_SLOTS; i++) {
+        cache->slot[i].idxmap &= ~idxmap;
+    }
+    qemu_spin_unlock(&cache->lock);
+
+    if (idxmap == ALL_MMUIDX_BITS) {
+        cache->valid = false;
+    }
+}
+
+static inline void tlb_flush_entry(CPUTLBEntry *tlb_entry, target_ulong addr);
+
+static void tlb_asid_flush_page(CPUArchState *env, target_ulong addr,
+                                uint16_t idxmap)
+{
+    CPUTLBASIDCache *cache = env->tlb_asid_cache;
+    int page = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    int i, k, mmu_idx;
+
+    if (!cache) {
+        return;
+    }
+
+    qemu_spin_lock(&cache->lock);
+    for (i = 0; i < TLB_ASID_SLOTS; i++) {
+        CPUTLBASIDSlot *slot = &cache->slot[i];
+
+        if (!(slot->idxmap & idxmap)) {
+            continue;
+        }
+        if ((addr & slot->flush_mask) == slot->flush_addr) {
+            /* covered by a large page, drop the whole slot */
+            slot->idxmap = 0;
+            continue;
+        }
+        for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
+            CPUTLBSavedTable *s = slot->saved[mmu_idx];
+
+            if (!(slot->idxmap & idxmap & (1 << mmu_idx))) {
+                continue;
+            }
+            tlb_flush_entry(&s->table[page], addr);
+            for (k = 0; k < CPU_VTLB_SIZE; k++) {
+                tlb_flush_entry(&s->v_table[k], addr);
+            }
+        }
+    }
+    qemu_spin_unlock(&cache->lock);
+}
+
+/* Park the live tables of the current ASID, evicting the least recently
+ * parked ASID if every slot is in use.  Called with the lock held.
+ */
+static void tlb_asid_save(CPUArchState *env, CPUTLBASIDCache *cache)
+{
+    CPUTLBASIDSlot *slot = &cache->slot[0];
+    int i, mmu_idx;
+
+    for (i = 0; i < TLB_ASID_SLOTS; i++) {
+        if (!cache->slot[i].idxmap) {
+            slot = &cache->slot[i];
+            break;
+        }
+        if (cache->slot[i].stamp < slot->stamp) {
+            slot = &cache->slot[i];
+        }
+    }
+
+    slot->asid = cache->asid;
+    slot->idxmap = 0;
+    slot->stamp = ++cache->clock;
+    slot->flush_addr = env->tlb_flush_addr;
+    slot->flush_mask = env->tlb_flush_mask;
+
+    for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
+        CPUTLBSavedTable *s;
+
+        if (!(cache->idxmap & (1 << mmu_idx))) {
+            continue;
+        }
+        if (!slot->saved[mmu_idx]) {
+            slot->saved[mmu_idx] = g_new(CPUTLBSavedTable, 1);
+        }
+        s = slot->saved[mmu_idx];
+        memcpy(s->table, env->tlb_table[mmu_idx], sizeof(s->table));
+        memcpy(s->v_table, env->tlb_v_table[mmu_idx], sizeof(s->v_table));
+        memcpy(s->iotlb, env->iotlb[mmu_idx], sizeof(s->iotlb));
+        memcpy(s->iotlb_v, env->iotlb_v[mmu_idx], sizeof(s->iotlb_v));
+        slot->idxmap |= 1 << mmu_idx;
+    }
+}
+
+/* Load the live tables for @asid, from its slot if we have one and
+ * empty otherwise.  Returns true on a hit.  Called with the lock held.
+ */
+static bool tlb_asid_restore(CPUArchState *env, CPUTLBASIDCache *cache,
+                             uint32_t asid)
+{
+    CPUTLBASIDSlot *slot = NULL;
+    int i, mmu_idx;
+
+    tlb_gen_bump(env);
+    for (i = 0; i < TLB_ASID_SLOTS; i++) {
+        if (cache->slot[i].idxmap && cache->slot[i].asid == asid) {
+            slot = &cache->slot[i];
+            break;
+        }
+    }
+
+    for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
+        CPUTLBSavedTable *s;
+
+        if (!(cache->idxmap & (1 << mmu_idx))) {
+            continue;
+        }
+        if (!slot || !(slot->idxmap & (1 << mmu_idx))) {
+            memset(env->tlb_table[mmu_idx], -1, sizeof(env->tlb_table[0]));
+            memset(env->tlb_v_table[mmu_idx], -1, sizeof(env->tlb_v_table[0]));
+            continue;
+        }
+        s = slot->saved[mmu_idx];
+        memcpy(env->tlb_table[mmu_idx], s->table, sizeof(s->table));
+        memcpy(env->tlb_v_table[mmu_idx], s->v_table, sizeof(s->v_table));
+        memcpy(env->iotlb[mmu_idx], s->iotlb, sizeof(s->iotlb));
+        memcpy(env->iotlb_v[mmu_idx], s->iotlb_v, sizeof(s->iotlb_v));
+    }
+
+    if (!slot) {
+        return false;
+    }
+
+    /* the restored entries may come from large pages */
+    if (slot->flush_addr != (target_ulong)-1) {
+        tlb_add_large_page(env, slot->flush_addr, ~slot->flush_mask + 1);
+    }
+    /* the entries are live again, so the slot must not be restored twice */
+    slot->idxmap = 0;
+    return true;
+}
+
+void tlb_set_asid_by_mmuidx(CPUState *cpu, uint32_t asid, uint16_t idxmap)
+{
+    CPUArchState *env = cpu->env_ptr;
+    CPUTLBASIDCache *cache;
+    bool hit = false;
+
+    if (!tcg_enabled()) {
+        return;
+    }
+
+    assert_cpu_is_self(cpu);
+    g_assert(asid <= TLB_ASID_MASK);
+
+    cache = tlb_asid_cache_get(env);
+    if (cache->valid && cache->asid == asid && cache->idxmap == idxmap) {
+        return;
+    }
+
+    tb_lock();
+
+    qemu_spin_lock(&cache->lock);
+    if (cache->valid && cache->idxmap == idxmap) {
+        tlb_asid_save(env, cache);
+        hit = tlb_asid_restore(env, cache, asid);
+    } else {
+        /* we don't know who owns the live entries, so start afresh */
+        tlb_flush_live_by_mmuidx(env, idxmap);
+    }
+    cache->valid = true;
+    cache->asid = asid;
+    cache->idxmap = idxmap;
+    qemu_spin_unlock(&cache->lock);
+
+    tlb_debug("asid:0x%" PRIx32 " mmu_idx:0x%" PRIx16 " %s\n",
+              asid, idxmap, hit ? "hit" : "miss");
+
+    /* tb_jmp_cache is indexed by virtual PC only */
+    cpu_tb_jmp_cache_clear(cpu);
+
+    tb_unlock();
+}
+
+static void tlb_flush_asid_async_work(CPUState *cpu, run_on_cpu_data data)
+{
+    CPUArchState *env = cpu->env_ptr;
+    CPUTLBASIDCache *cache = env->tlb_asid_cache;
+    uint32_t asid = data.host_ulong >> 16;
+    uint16_t idxmap = data.host_ulong & ALL_MMUIDX_BITS;
+    int i;
+
+    assert_cpu_is_self(cpu);
+
+    tlb_debug("asid:0x%" PRIx32 " mmu_idx:0x%" PRIx16 "\n", asid, idxmap);
+
+    if (!cache || !cache->valid || cache->idxmap != idxmap) {
+        tlb_flush_by_mmuidx_async_work(cpu, RUN_ON_CPU_HOST_INT(idxmap));
+        return;
+    }
+
+    if (cache->asid == asid) {
+        tb_lock();
+        tlb_flush_live_by_mmuidx(env, idxmap);
+        cpu_tb_jmp_cache_clear(cpu);
+        tb_unlock();
+        return;
+    }
+
+    qemu_spin_lock(&cache->lock);
+    for (i = 0; i < TLB_ASID_SLOTS; i++) {
+        if (cache->slot[i].asid == asid) {
+            cache->slot[i].idxmap = 0;
+        }
+    }
+    qemu_spin_unlock(&cache->lock);
+}
+
+void tlb_flush_asid_by_mmuidx(CPUState *cpu, uint32_t asid, uint16_t idxmap)
+{
+    unsigned long asid_and_idxmap;
+
+    g_assert(asid <= TLB_ASID_MASK);
+    asid_and_idxmap = ((unsigned long)asid << 16) | idxmap;
+
+    if (!qemu_cpu_is_self(cpu)) {
+        async_run_on_cpu(cpu, tlb_flush_asid_async_work,
+                         RUN_ON_CPU_HOST_ULONG(asid_and_idxmap));
+    } else {
+        tlb_flush_asid_async_work(cpu, RUN_ON_CPU_HOST_ULONG(asid_and_idxmap));
+    }
+}
+
+void tlb_flush_asid_by_mmuidx_all_cpus_synced(CPUState *src_cpu,
+                                              uint32_t asid, uint16_t idxmap)
+{
+    const run_on_cpu_func fn = tlb_flush_asid_async_work;
+    unsigned long asid_and_idxmap;
+
+    g_assert(asid <= TLB_ASID_MASK);
+    asid_and_idxmap = ((unsigned long)asid << 16) | idxmap;
+
+    flush_all_helper(src_cpu, fn, RUN_ON_CPU_HOST_ULONG(asid_and_idxmap));
+    async_safe_run_on_cpu(src_cpu, fn, RUN_ON_CPU_HOST_ULONG(asid_and_idxmap));
+}
+
 /* update the TLBs so that writes to code in the virtual page 'addr'
    can be detected */
 void tlb_protect_code(ram_addr_t ram_addr)
@@ -530,10 +883,19 @@ static inline void copy_tlb_helper(CPUTLBEntry *d, CPUTLBEntry *s,
 void tlb_reset_dirty(CPUState *cpu, ram_addr_t start1, ram_addr_t length)
 {
     CPUArchState *env;
+    CPUTLBASIDCache *cache;
 
     int mmu_idx;
 
     env = cpu->env_ptr;
+    cache = atomic_rcu_read(&env->tlb_asid_cache);
+
+    /* Keep entries from moving between the live and saved tables
+     * while we walk them */
+    if (cache) {
+        qemu_spin_lock(&cache->lock);
+    }
+
     for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
         unsigned int i;
 
@@ -547,6 +909,30 @@ void tlb_reset_dirty(CPUState *cpu, ram_addr_t start1, ram_addr_t length)
                                   start1, length);
         }
     }
+
+    if (cache) {
+        int j;
+
+        for (j = 0; j < TLB_ASID_SLOTS; j++) {
+            CPUTLBASIDSlot *slot = &cache->slot[j];
+
+            for (mmu_idx = 0; mmu_idx < NB_MMU_MODES; mmu_idx++) {
+                CPUTLBSavedTable *s = slot->saved[mmu_idx];
+                unsigned int i;
+
+                if (!(slot->idxmap & (1 << mmu_idx))) {
+                    continue;
+                }
+                for (i = 0; i < CPU_TLB_SIZE; i++) {
+                    tlb_reset_dirty_range(&s->table[i], start1, length);
+                }
+                for (i = 0; i < CPU_VTLB_SIZE; i++) {
+                    tlb_reset_dirty_range(&s->v_table[i], start1, length);
+                }
+            }
+        }
+        qemu_spin_unlock(&cache->lock);
+    }
 }
 
 static inline void tlb_set_dirty1(CPUTLBEntry *tlb_entry, target_ulong vaddr)
@@ -715,6 +1101,35 @@ void tlb_set_page(CPUState *cpu, target_ulong vaddr,
                             prot, mmu_idx, size);
 }
 
+/* Make the RAM page at @paddr the only page that @cpu, a TB prefetch
+ * thread's CPU copy, can fetch code from, at @vaddr.  Returns false if
+ * @paddr is not RAM, in which case nothing is mapped.  Called with the
+ * RCU read lock held, from the thread that owns @cpu.
+ */
+bool tlb_set_code_page_private(CPUState *cpu, target_ulong vaddr,
+                               hwaddr paddr, MemTxAttrs attrs)
+{
+    CPUArchState *env = cpu->env_ptr;
+    int mmu_idx = cpu_mmu_index(env, true);
+    int asidx = cpu_asidx_from_attrs(cpu, attrs);
+    MemoryRegionSection *section;
+    hwaddr xlat, sz = TARGET_PAGE_SIZE;
+
+    g_assert(cpu->tb_prefetch_worker);
+
+    memset(env->tlb_table[mmu_idx], -1, sizeof(env->tlb_table[0]));
+    memset(env->tlb_v_table[mmu_idx], -1, sizeof(env->tlb_v_table[0]));
+
+    section = address_space_translate_for_iotlb(cpu, asidx, paddr,
+                                                &xlat, &sz);
+    if (!memory_region_is_ram(section->mr)) {
+        return false;
+    }
+    tlb_set_page_with_attrs(cpu, vaddr & TARGET_PAGE_MASK, paddr, attrs,
+                            PAGE_READ | PAGE_EXEC, mmu_idx, TARGET_PAGE_SIZE);
+    return true;
+}
+
 static void report_bad_exec(CPUState *cpu, target_ulong addr)
 {
     /* Accidentally executing outside RAM or ROM is quite common for
@@ -861,6 +1276,21 @@ static bool victim_tlb_hit(CPUArchState *env, size_t mmu_idx, size_t index,
   victim_tlb_hit(env, mmu_idx, index, offsetof(CPUTLBEntry, TY), \
                  (ADDR) & TARGET_PAGE_MASK)
 
+/* Fill the TLB for an instruction fetch.  A TB prefetch thread only has
+ * the page it was asked to translate from mapped, and must not walk the
+ * page tables of its CPU copy, which are not the guest's current ones:
+ * it gives up on the block instead.
+ */
+static void tlb_fill_code(CPUState *cpu, target_ulong addr, int size,
+                          MMUAccessType access_type, int mmu_idx,
+                          uintptr_t retaddr)
+{
+    if (unlikely(cpu->tb_prefetch_worker)) {
+        cpu_loop_exit(cpu);
+    }
+    tlb_fill(cpu, addr, size, access_type, mmu_idx, retaddr);
+}
+
 /* NOTE: this function can trigger an exception */
 /* NOTE2: the returned address is not exactly the physical address: it
  * is actually a ram_addr_t (in system mode; the user mode emulation
@@ -880,7 +1310,7 @@ tb_page_addr_t get_page_addr_code(CPUArchState *env, target_ulong addr)
     if (unlikely(env->tlb_table[mmu_idx][index].addr_code !=
                  (addr & (TARGET_PAGE_MASK | TLB_INVALID_MASK)))) {
         if (!VICTIM_TLB_HIT(addr_read, addr)) {
-            tlb_fill(ENV_GET_CPU(env), addr, 0, MMU_INST_FETCH, mmu_idx, 0);
+            tlb_fill_code(cpu, addr, 0, MMU_INST_FETCH, mmu_idx, 0);
         }
     }
     iotlbentry = &env->iotlb[mmu_idx][index];
@@ -1072,7 +1502,7 @@ static void *atomic_mmu_lookup(CPUArchState *env, target_ulong addr,
 #include "atomic_template.h"
 #endif
 
-#ifdef CONFIG_ATOMIC128
+#if HAVE_CMPXCHG128
 #define DATA_SIZE 16
 #include "atomic_template.h"
 #endif
@@ -63,9 +63,11 @@
 #ifdef SOFTMMU_CODE_ACCESS
 #define READ_ACCESS_TYPE MMU_INST_FETCH
 #define ADDR_READ addr_code
+#define TLB_FILL_READ tlb_fill_code
 #else
 #define READ_ACCESS_TYPE MMU_DATA_LOAD
 #define ADDR_READ addr_read
+#define TLB_FILL_READ tlb_fill
 #endif
 
 #if DATA_SIZE == 8
@@ -124,8 +126,8 @@ WORD_TYPE helper_le_ld_name(CPUArchState *env, target_ulong addr,
     if ((addr & TARGET_PAGE_MASK)
          != (tlb_addr & (TARGET_PAGE_MASK | TLB_INVALID_MASK))) {
         if (!VICTIM_TLB_HIT(ADDR_READ, addr)) {
-            tlb_fill(ENV_GET_CPU(env), addr, DATA_SIZE, READ_ACCESS_TYPE,
-                     mmu_idx, retaddr);
+            TLB_FILL_READ(ENV_GET_CPU(env), addr, DATA_SIZE, READ_ACCESS_TYPE,
+                          mmu_idx, retaddr);
         }
         tlb_addr = env->tlb_table[mmu_idx][index].ADDR_READ;
     }
@@ -191,8 +193,8 @@ WORD_TYPE helper_be_ld_name(CPUArchState *env, target_ulong addr,
     if ((addr & TARGET_PAGE_MASK)
          != (tlb_addr & (TARGET_PAGE_MASK | TLB_INVALID_MASK))) {
         if (!VICTIM_TLB_HIT(ADDR_READ, addr)) {
-            tlb_fill(ENV_GET_CPU(env), addr, DATA_SIZE, READ_ACCESS_TYPE,
-                     mmu_idx, retaddr);
+            TLB_FILL_READ(ENV_GET_CPU(env), addr, DATA_SIZE, READ_ACCESS_TYPE,
+                          mmu_idx, retaddr);
         }
         tlb_addr = env->tlb_table[mmu_idx][index].ADDR_READ;
     }
@@ -417,6 +419,7 @@ void helper_be_st_name(CPUArchState *env, target_ulong addr, DATA_TYPE val,
 #endif /* !defined(SOFTMMU_CODE_ACCESS) */
 
 #undef READ_ACCESS_TYPE
+#undef TLB_FILL_READ
 #undef DATA_TYPE
 #undef SUFFIX
 #undef LSUFFIX
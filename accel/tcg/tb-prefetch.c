@@ -0,0 +1,446 @@
+/*
+ * Translation of static successors ahead of execution
+ *
+ * Copyright (c) 2018 The Android Open Source Project
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * When a TB is translated, the direct jump targets recorded by the
+ * front end (translator_note_jmp_dest) are queued here, and a pool of
+ * translator threads generates code for them before the vCPU gets
+ * there.  A vCPU that misses in the TB cache on a block that a worker
+ * is translating waits for it (tb_prefetch_wait) and picks the result
+ * up from tb_htable_lookup; if the block is still queued, the vCPU
+ * takes it off the queue and translates it itself.
+ *
+ * Each worker owns a private CPU that is never run and is kept off the
+ * cpu list.  Once the TB flags are known, the front end only needs the
+ * CPU configuration, which the copy shares, and a way to fetch code:
+ *
+ * - In user mode code fetch does not depend on per-vCPU state, so any
+ *   copy can translate a (pc, cs_base, flags) key.
+ *
+ * - In system mode code is fetched through the softmmu TLB.  The vCPU
+ *   that finds a successor resolves the physical address of its page
+ *   with a debug walk, which neither faults nor fills the TLB, and the
+ *   worker maps just that page into the TLB of its copy.  Anything else
+ *   the front end fetches makes the worker drop the block (see
+ *   tlb_fill_code).  A request is dropped as well if the vCPU has lost
+ *   TLB entries since, as the mapping may be stale.
+ *
+ * In both modes workers only translate from pages that already hold
+ * translated code.  Guest writes to those pages are caught and
+ * invalidate translations under the locks the worker holds, so the
+ * guest cannot change the code while it is being read; a write to a
+ * page nobody translated from yet would go unnoticed.
+ */
+
+#include "qemu/osdep.h"
+#include "qemu-common.h"
+#include "qemu/thread.h"
+#include "qemu/rcu.h"
+#include "qemu/bitmap.h"
+#include "cpu.h"
+#include "exec/exec-all.h"
+#include "tcg.h"
+#ifndef CONFIG_USER_ONLY
+#include "exec/ram_addr.h"
+#endif
+
+/* Requests beyond this are dropped; prefetching is only a hint.  */
+#define TB_PREFETCH_QUEUE_SIZE 256
+
+/* How many jumps ahead of the vCPU we are willing to translate.  */
+#define TB_PREFETCH_MAX_DEPTH  4
+
+/* Leave room so that a worker rarely finds the code buffer full.  */
+#define TB_PREFETCH_CODE_MARGIN (1 * 1024 * 1024)
+
+typedef struct TBPrefetchRequest {
+    target_ulong pc;
+    target_ulong cs_base;
+    uint32_t flags;
+    uint32_t cflags;
+    int depth;                  /* 0 once a vCPU has claimed it */
+#ifndef CONFIG_USER_ONLY
+    CPUState *cpu;              /* vCPU the successor was found on */
+    unsigned int tlb_gen;       /* its TLB generation at that point */
+    hwaddr phys;                /* physical address of the page of @pc */
+    MemTxAttrs attrs;
+#endif
+} TBPrefetchRequest;
+
+typedef struct TBPrefetchThread {
+    QemuThread thread;
+    CPUState *cpu;
+    TBPrefetchRequest req;      /* being translated, valid if @busy */
+    bool busy;
+} TBPrefetchThread;
+
+static struct {
+    QemuMutex lock;
+    QemuCond cond;              /* a request was queued */
+    QemuCond done;              /* a worker finished a request */
+    TBPrefetchRequest ring[TB_PREFETCH_QUEUE_SIZE];
+    unsigned int head;
+    unsigned int tail;
+    TBPrefetchThread threads[TB_PREFETCH_MAX_THREADS];
+    unsigned int nb_threads;
+} tb_prefetch_queue;
+
+bool tb_prefetch_active;
+
+/* Request being translated by this thread, NULL for vCPUs.  */
+static __thread TBPrefetchRequest *tb_prefetch_req;
+
+static bool tb_prefetch_match(const TBPrefetchRequest *req, target_ulong pc,
+                              target_ulong cs_base, uint32_t flags,
+                              uint32_t cflags)
+{
+    return req->pc == pc && req->cs_base == cs_base &&
+           req->flags == flags && req->cflags == cflags;
+}
+
+#ifndef CONFIG_USER_ONLY
+/*
+ * Find the page @req->pc lives in for @cpu, on the vCPU thread, where its
+ * MMU state is stable.
+ */
+static bool tb_prefetch_resolve(CPUState *cpu, TBPrefetchRequest *req)
+{
+    CPUArchState *env = cpu->env_ptr;
+
+    /* Debug state is not part of the TB key; leave those to the vCPU.  */
+    if (cpu->singlestep_enabled || !QTAILQ_EMPTY(&cpu->breakpoints)) {
+        return false;
+    }
+    req->cpu = cpu;
+    req->tlb_gen = env->tlb_gen;
+    req->phys = cpu_get_phys_page_attrs_debug(cpu, req->pc & TARGET_PAGE_MASK,
+                                              &req->attrs);
+    return req->phys != -1;
+}
+#endif
+
+void tb_prefetch(CPUState *cpu, target_ulong pc, TranslationBlock *from)
+{
+    TBPrefetchRequest *parent = tb_prefetch_req;
+    TBPrefetchRequest req;
+
+    req.depth = parent ? parent->depth + 1 : 1;
+    if (req.depth > TB_PREFETCH_MAX_DEPTH || (from->cflags & CF_NOCACHE)) {
+        return;
+    }
+    req.pc = pc;
+    req.cs_base = from->cs_base;
+    req.flags = from->flags;
+    req.cflags = from->cflags & (CF_PARALLEL | CF_USE_ICOUNT);
+
+#ifndef CONFIG_USER_ONLY
+    if (parent) {
+        /*
+         * A worker only knows how the guest maps the page of its own
+         * request, so it can only follow jumps within that page.
+         */
+        if ((pc ^ parent->pc) & TARGET_PAGE_MASK) {
+            return;
+        }
+        req.cpu = parent->cpu;
+        req.tlb_gen = parent->tlb_gen;
+        req.phys = parent->phys;
+        req.attrs = parent->attrs;
+    } else if (!tb_prefetch_resolve(cpu, &req)) {
+        return;
+    }
+#endif
+
+    qemu_mutex_lock(&tb_prefetch_queue.lock);
+    if (tb_prefetch_queue.tail - tb_prefetch_queue.head
+        < TB_PREFETCH_QUEUE_SIZE) {
+        tb_prefetch_queue.ring[tb_prefetch_queue.tail++
+                               % TB_PREFETCH_QUEUE_SIZE] = req;
+        qemu_cond_signal(&tb_prefetch_queue.cond);
+    }
+    qemu_mutex_unlock(&tb_prefetch_queue.lock);
+}
+
+/*
+ * Called by a vCPU that missed in the TB cache, before it translates the
+ * block itself.  If a worker is translating the same block, wait for it
+ * to finish; the caller then finds the result with tb_htable_lookup.  If
+ * the block is only queued, take it off the queue so that it is not
+ * translated twice.
+ */
+void tb_prefetch_wait(target_ulong pc, target_ulong cs_base, uint32_t flags,
+                      uint32_t cflags)
+{
+    unsigned int i;
+
+    qemu_mutex_lock(&tb_prefetch_queue.lock);
+    for (i = tb_prefetch_queue.head; i != tb_prefetch_queue.tail; i++) {
+        TBPrefetchRequest *req =
+            &tb_prefetch_queue.ring[i % TB_PREFETCH_QUEUE_SIZE];
+
+        if (tb_prefetch_match(req, pc, cs_base, flags, cflags)) {
+            req->depth = 0;
+        }
+    }
+ retry:
+    for (i = 0; i < tb_prefetch_queue.nb_threads; i++) {
+        TBPrefetchThread *t = &tb_prefetch_queue.threads[i];
+
+        if (t->busy && tb_prefetch_match(&t->req, pc, cs_base, flags,
+                                         cflags)) {
+            qemu_cond_wait(&tb_prefetch_queue.done, &tb_prefetch_queue.lock);
+            goto retry;
+        }
+    }
+    qemu_mutex_unlock(&tb_prefetch_queue.lock);
+}
+
+#ifdef CONFIG_USER_ONLY
+/*
+ * Guest code is read without a host signal handler to fall back on, so
+ * the page must be mapped and readable.  It must also be write-protected,
+ * which is the case once it holds translated code: a guest write then
+ * faults and waits for mmap_lock before invalidating.
+ */
+static bool tb_prefetch_page_ok(target_ulong addr)
+{
+    int flags = page_get_flags(addr);
+
+    return (flags & (PAGE_VALID | PAGE_READ | PAGE_WRITE))
+        == (PAGE_VALID | PAGE_READ);
+}
+
+/* Called with mmap_lock and tb_lock held.  */
+static bool tb_prefetch_prepare(CPUState *cpu, TBPrefetchRequest *req)
+{
+    return tb_prefetch_page_ok(req->pc) &&
+           tb_prefetch_page_ok((req->pc & TARGET_PAGE_MASK) +
+                               TARGET_PAGE_SIZE);
+}
+#else
+/* Called with tb_lock and the RCU read lock held.  */
+static bool tb_prefetch_prepare(CPUState *cpu, TBPrefetchRequest *req)
+{
+    CPUState *src = req->cpu;
+    CPUArchState *src_env = src->env_ptr;
+    tb_page_addr_t phys_pc;
+
+    /*
+     * The vCPU dropped TLB entries since it found the successor.  A block
+     * translated through a stale mapping would still be correct, as TBs
+     * are looked up by physical address, but most likely of no use.
+     */
+    if (atomic_read(&src_env->tlb_gen) != req->tlb_gen) {
+        return false;
+    }
+    /*
+     * Setting a breakpoint or single-stepping invalidates translations
+     * under tb_lock, after updating the vCPU, so checking here is enough.
+     */
+    if (atomic_read(&src->singlestep_enabled) ||
+        !QTAILQ_EMPTY(&src->breakpoints)) {
+        return false;
+    }
+    if (!tlb_set_code_page_private(cpu, req->pc, req->phys & TARGET_PAGE_MASK,
+                                   req->attrs)) {
+        return false;
+    }
+    /*
+     * Writes to a page with translated code take the notdirty slow path,
+     * which invalidates under tb_lock.
+     */
+    phys_pc = get_page_addr_code(cpu->env_ptr, req->pc);
+    if (cpu_physical_memory_get_dirty_flag(phys_pc, DIRTY_MEMORY_CODE)) {
+        return false;
+    }
+    bitmap_copy(cpu->trace_dstate, src->trace_dstate,
+                CPU_TRACE_DSTATE_MAX_EVENTS);
+    return true;
+}
+#endif
+
+/* Called with mmap_lock and tb_lock held.  */
+static void tb_prefetch_one(CPUState *cpu, TBPrefetchRequest *req)
+{
+    /*
+     * Workers cannot flush the code buffer (see tb_gen_code), so leave
+     * the last part of it to the vCPUs.
+     */
+    if (tcg_code_size() + TB_PREFETCH_CODE_MARGIN > tcg_code_capacity()) {
+        return;
+    }
+    if (!tb_prefetch_prepare(cpu, req)) {
+        return;
+    }
+    if (tb_htable_lookup(cpu, req->pc, req->cs_base, req->flags,
+                         req->cflags)) {
+        return;
+    }
+    tb_gen_code(cpu, req->pc, req->cs_base, req->flags, req->cflags);
+}
+
+static void *tb_prefetch_thread(void *arg)
+{
+    TBPrefetchThread *t = arg;
+    CPUState *cpu = t->cpu;
+
+    rcu_register_thread();
+    tcg_register_thread();
+    current_cpu = cpu;
+
+    for (;;) {
+        qemu_mutex_lock(&tb_prefetch_queue.lock);
+        do {
+            while (tb_prefetch_queue.head == tb_prefetch_queue.tail) {
+                qemu_cond_wait(&tb_prefetch_queue.cond,
+                               &tb_prefetch_queue.lock);
+            }
+            t->req = tb_prefetch_queue.ring[tb_prefetch_queue.head++
+                                            % TB_PREFETCH_QUEUE_SIZE];
+        } while (!t->req.depth);
+        t->busy = true;
+        qemu_mutex_unlock(&tb_prefetch_queue.lock);
+
+        rcu_read_lock();
+        if (sigsetjmp(cpu->jmp_env, 0) == 0) {
+            tb_prefetch_req = &t->req;
+            mmap_lock();
+            tb_lock();
+            tb_prefetch_one(cpu, &t->req);
+            tb_unlock();
+            mmap_unlock();
+        } else {
+            /* Translation bailed out with cpu_loop_exit; just drop it. */
+            tb_lock_reset();
+#ifdef CONFIG_USER_ONLY
+            if (have_mmap_lock()) {
+                mmap_unlock();
+            }
+#endif
+        }
+        tb_prefetch_req = NULL;
+        rcu_read_unlock();
+
+        qemu_mutex_lock(&tb_prefetch_queue.lock);
+        t->busy = false;
+        qemu_cond_broadcast(&tb_prefetch_queue.done);
+        qemu_mutex_unlock(&tb_prefetch_queue.lock);
+    }
+    return NULL;
+}
+
+/*
+ * Start a translator thread working with @cpu, which must be a private
+ * copy of a guest CPU: cpu_copy() in user mode, where it is then removed
+ * from the cpu list so that the guest never sees it, and
+ * tb_prefetch_copy_cpu() in system mode.  Must be called before the
+ * vCPUs start running.
+ */
+void tb_prefetch_add_thread(CPUState *cpu)
+{
+    TBPrefetchThread *t;
+    char name[32];
+
+    g_assert(tb_prefetch_queue.nb_threads < TB_PREFETCH_MAX_THREADS);
+    if (!tb_prefetch_queue.nb_threads) {
+        qemu_mutex_init(&tb_prefetch_queue.lock);
+        qemu_cond_init(&tb_prefetch_queue.cond);
+        qemu_cond_init(&tb_prefetch_queue.done);
+    }
+#ifdef CONFIG_USER_ONLY
+    cpu_list_remove(cpu);
+#endif
+    cpu->tb_prefetch_worker = true;
+
+    t = &tb_prefetch_queue.threads[tb_prefetch_queue.nb_threads];
+    t->cpu = cpu;
+    snprintf(name, sizeof(name), "TB prefetch %u",
+             tb_prefetch_queue.nb_threads++);
+    qemu_thread_create(&t->thread, name, tb_prefetch_thread, t,
+                       QEMU_THREAD_DETACHED);
+    atomic_set(&tb_prefetch_active, true);
+}
+
+#ifdef CONFIG_USER_ONLY
+/*
+ * Keep the queue consistent across fork(): the parent must not fork
+ * while a thread holds the queue lock.  Called after tb_lock is taken,
+ * as tb_prefetch() runs under it.
+ */
+void tb_prefetch_fork_start(void)
+{
+    if (tb_prefetch_queue.nb_threads) {
+        qemu_mutex_lock(&tb_prefetch_queue.lock);
+    }
+}
+
+/*
+ * The child has none of the translator threads, so stop queueing
+ * requests there; it translates everything on its own thread.
+ */
+void tb_prefetch_fork_end(int child)
+{
+    if (!tb_prefetch_queue.nb_threads) {
+        return;
+    }
+    if (child) {
+        atomic_set(&tb_prefetch_active, false);
+        qemu_mutex_init(&tb_prefetch_queue.lock);
+        qemu_cond_init(&tb_prefetch_queue.cond);
+        qemu_cond_init(&tb_prefetch_queue.done);
+        tb_prefetch_queue.head = tb_prefetch_queue.tail = 0;
+        tb_prefetch_queue.nb_threads = 0;
+    } else {
+        qemu_mutex_unlock(&tb_prefetch_queue.lock);
+    }
+}
+#else
+/*
+ * Make the private CPU a worker translates with out of @cpu.  This is a
+ * plain copy of the object, so it shares the configuration and address
+ * spaces of @cpu, which is all the front end needs, but it has a TLB,
+ * jmp_env and breakpoint lists of its own.  It is not a QOM object in
+ * its own right, is not on the cpu list and is never realized or run.
+ */
+CPUState *tb_prefetch_copy_cpu(CPUState *cpu)
+{
+    const char *type = object_get_typename(OBJECT(cpu));
+    size_t size = object_type_get_instance_size(type);
+    CPUState *copy = g_malloc(size);
+    CPUArchState *env;
+
+    memcpy(copy, cpu, size);
+    copy->env_ptr = (uint8_t *)copy + ((uint8_t *)cpu->env_ptr -
+                                       (uint8_t *)cpu);
+    copy->thread = NULL;
+    copy->created = false;
+    QTAILQ_INIT(&copy->breakpoints);
+    QTAILQ_INIT(&copy->watchpoints);
+
+    /* The parked ASID tables belong to @cpu.  */
+    env = copy->env_ptr;
+    env->tlb_asid_cache = NULL;
+    memset(env->tlb_table, -1, sizeof(env->tlb_table));
+    memset(env->tlb_v_table, -1, sizeof(env->tlb_v_table));
+    env->tlb_flush_addr = -1;
+    env->tlb_flush_mask = 0;
+    env->vtlb_index = 0;
+    return copy;
+}
+#endif
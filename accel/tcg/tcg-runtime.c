@@ -30,6 +30,7 @@
 #include "exec/tb-lookup.h"
 #include "disas/disas.h"
 #include "exec/log.h"
+#include "translate-all.h"
 
 /* 32-bit helpers */
 
@@ -144,16 +145,45 @@ uint64_t HELPER(ctpop_i64)(uint64_t arg)
     return ctpop64(arg);
 }
 
+/* Resolve the target of an indirect branch.  The return address of the
+ * helper identifies the branch, so the per-vCPU target cache can keep
+ * apart the different targets of a few hot sites (e.g. returns, or the
+ * dispatch of an interpreter) that would otherwise keep evicting each
+ * other from the tb_jmp_cache.
+ */
 void *HELPER(lookup_tb_ptr)(CPUArchState *env)
 {
     CPUState *cpu = ENV_GET_CPU(env);
+    uintptr_t src = GETPC();
+    uint32_t cf_mask = curr_cflags();
+    TBIndirectCacheEntry *e;
     TranslationBlock *tb;
     target_ulong cs_base, pc;
-    uint32_t flags;
-
-    tb = tb_lookup__cpu_state(cpu, &pc, &cs_base, &flags, curr_cflags());
-    if (tb == NULL) {
-        return tcg_ctx->code_gen_epilogue;
+    uint32_t flags, hash;
+
+    cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
+    e = &cpu->tb_ibtc[tb_ibtc_hash_func(src, pc)];
+    tb = e->tb;
+    if (likely(e->src == src && e->gen == cpu->tb_ibtc_gen &&
+               tb_lookup_cmp(tb, cpu, pc, cs_base, flags, cf_mask))) {
+        cpu->tb_lookup_stats.ibtc_hit++;
+    } else {
+        hash = tb_jmp_cache_hash_func(pc);
+        tb = atomic_rcu_read(&cpu->tb_jmp_cache[hash]);
+        if (tb_lookup_cmp(tb, cpu, pc, cs_base, flags, cf_mask)) {
+            cpu->tb_lookup_stats.jmp_cache_hit++;
+        } else {
+            tb = tb_htable_lookup(cpu, pc, cs_base, flags, cf_mask);
+            if (tb == NULL) {
+                cpu->tb_lookup_stats.miss++;
+                return tcg_ctx->code_gen_epilogue;
+            }
+            cpu->tb_lookup_stats.htable_hit++;
+            atomic_set(&cpu->tb_jmp_cache[hash], tb);
+        }
+        e->src = src;
+        e->tb = tb;
+        e->gen = cpu->tb_ibtc_gen;
     }
     qemu_log_mask_and_addr(CPU_LOG_EXEC, pc,
                            "Chain %d: %p ["
@@ -167,3 +197,9 @@ void HELPER(exit_atomic)(CPUArchState *env)
 {
     cpu_loop_exit_atomic(ENV_GET_CPU(env), GETPC());
 }
+
+void HELPER(instrument_mem)(CPUArchState *env, target_ulong addr,
+                            uint32_t info)
+{
+    tcg_instrument_mem_call(ENV_GET_CPU(env), addr, info);
+}
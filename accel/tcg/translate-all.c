@@ -156,6 +156,10 @@ TCGContext tcg_init_ctx;
 __thread TCGContext *tcg_ctx;
 TBContext tb_ctx;
 bool parallel_cpus;
+int tcg_instrument;
+
+static TCGMemAccessFunc *tcg_instrument_mem_func;
+static void *tcg_instrument_mem_opaque;
 
 bool g_tcg_enabled = false;
 
@@ -939,6 +943,42 @@ void tb_flush(CPUState *cpu)
     }
 }
 
+static void tcg_instrument_update(int mask, bool enable)
+{
+    int old = atomic_read(&tcg_instrument);
+    int new = enable ? old | mask : old & ~mask;
+
+    if (new != old) {
+        atomic_set(&tcg_instrument, new);
+        /* Retranslate everything with the new setting */
+        if (first_cpu) {
+            tb_flush(first_cpu);
+        }
+    }
+}
+
+void tcg_instrument_tb_count(bool enable)
+{
+    tcg_instrument_update(TCG_INSTRUMENT_TB_COUNT, enable);
+}
+
+void tcg_instrument_mem(TCGMemAccessFunc *func, void *opaque)
+{
+    atomic_set(&tcg_instrument_mem_opaque, opaque);
+    atomic_mb_set(&tcg_instrument_mem_func, func);
+    tcg_instrument_update(TCG_INSTRUMENT_MEM, func != NULL);
+}
+
+void tcg_instrument_mem_call(CPUState *cpu, target_ulong vaddr, uint8_t info)
+{
+    TCGMemAccessFunc *func = atomic_mb_read(&tcg_instrument_mem_func);
+
+    /* TBs translated before the callback was removed may still call us */
+    if (func) {
+        func(cpu, vaddr, info, atomic_read(&tcg_instrument_mem_opaque));
+    }
+}
+
 /*
  * Formerly ifdef DEBUG_TB_CHECK. These debug functions are user-mode-only,
  * so in order to prevent bit rot we compile them unconditionally in user-mode,
@@ -1264,6 +1304,12 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
  buffer_overflow:
     tb = tb_alloc(pc);
     if (unlikely(!tb)) {
+        /* A TB prefetch thread cannot wait for the vCPUs to stop; leave
+         * the flush to the next vCPU that runs out of room.
+         */
+        if (cpu->tb_prefetch_worker) {
+            cpu_loop_exit(cpu);
+        }
         /* flush must be done */
         tb_flush(cpu);
         mmap_unlock();
@@ -1279,6 +1325,7 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     tb->flags = flags;
     tb->cflags = cflags;
     tb->trace_vcpu_dstate = *cpu->trace_dstate;
+    tb->exec_count = 0;
     tcg_ctx->tb_cflags = cflags;
 
 #ifdef CONFIG_PROFILER
@@ -1803,6 +1850,7 @@ void tb_flush_jmp_cache(CPUState *cpu, target_ulong addr)
        overlap the flushed page.  */
     tb_jmp_cache_clear_page(cpu, addr - TARGET_PAGE_SIZE);
     tb_jmp_cache_clear_page(cpu, addr);
+    cpu_tb_ibtc_clear(cpu);
 }
 
 static void print_qht_statistics(FILE *f, fprintf_function cpu_fprintf,
@@ -1874,6 +1922,30 @@ static gboolean tb_tree_stats_iter(gpointer key, gpointer value, gpointer data)
     return false;
 }
 
+static void dump_tb_lookup_stats(FILE *f, fprintf_function cpu_fprintf)
+{
+    TBLookupStats tot = {};
+    uint64_t n;
+    CPUState *cpu;
+
+    CPU_FOREACH(cpu) {
+        tot.ibtc_hit += cpu->tb_lookup_stats.ibtc_hit;
+        tot.jmp_cache_hit += cpu->tb_lookup_stats.jmp_cache_hit;
+        tot.htable_hit += cpu->tb_lookup_stats.htable_hit;
+        tot.miss += cpu->tb_lookup_stats.miss;
+    }
+    n = tot.ibtc_hit + tot.jmp_cache_hit + tot.htable_hit + tot.miss;
+    cpu_fprintf(f, "indirect lookups    %" PRIu64 "\n", n);
+    if (n) {
+        cpu_fprintf(f, "  target cache hits %0.1f%%, jump cache hits %0.1f%%, "
+                    "hash table hits %0.1f%%, misses %0.1f%%\n",
+                    (double)tot.ibtc_hit * 100 / n,
+                    (double)tot.jmp_cache_hit * 100 / n,
+                    (double)tot.htable_hit * 100 / n,
+                    (double)tot.miss * 100 / n);
+    }
+}
+
 void dump_exec_info(FILE *f, fprintf_function cpu_fprintf)
 {
     struct tb_tree_stats tst = {};
@@ -1916,6 +1988,9 @@ void dump_exec_info(FILE *f, fprintf_function cpu_fprintf)
     cpu_fprintf(f, "TB flush count      %u\n",
                 atomic_read(&tb_ctx.tb_flush_count));
     cpu_fprintf(f, "TB invalidate count %d\n", tb_ctx.tb_phys_invalidate_count);
+    cpu_fprintf(f, "serial exec count   %u\n",
+                atomic_read(&tb_ctx.serial_exec_count));
+    dump_tb_lookup_stats(f, cpu_fprintf);
     cpu_fprintf(f, "TLB flush count     %zu\n", tlb_flush_count());
     tcg_dump_info(f, cpu_fprintf);
 
@@ -1927,6 +2002,71 @@ void dump_opcount_info(FILE *f, fprintf_function cpu_fprintf)
     tcg_dump_op_count(f, cpu_fprintf);
 }
 
+struct tb_hot_entry {
+    const TranslationBlock *tb;
+    uint64_t count;
+};
+
+struct tb_hot_stats {
+    GArray *entries;
+    uint64_t total;
+};
+
+static gboolean tb_hot_iter(gpointer key, gpointer value, gpointer data)
+{
+    const TranslationBlock *tb = value;
+    struct tb_hot_stats *hst = data;
+    /* The counters keep running, take a snapshot for sorting */
+    struct tb_hot_entry e = { .tb = tb, .count = tb->exec_count };
+
+    if (e.count) {
+        g_array_append_val(hst->entries, e);
+        hst->total += e.count;
+    }
+    return false;
+}
+
+static gint tb_hot_cmp(gconstpointer ap, gconstpointer bp)
+{
+    const struct tb_hot_entry *a = ap;
+    const struct tb_hot_entry *b = bp;
+
+    return a->count < b->count ? 1 : a->count > b->count ? -1 : 0;
+}
+
+void dump_tb_hot_info(FILE *f, fprintf_function cpu_fprintf, int count)
+{
+    struct tb_hot_stats hst = {};
+    int i;
+
+    if (!(atomic_read(&tcg_instrument) & TCG_INSTRUMENT_TB_COUNT)) {
+        cpu_fprintf(f, "TB execution counting is disabled "
+                    "(enable it with \"tb-count on\")\n");
+        return;
+    }
+
+    tb_lock();
+
+    hst.entries = g_array_new(false, false, sizeof(struct tb_hot_entry));
+    g_tree_foreach(tb_ctx.tb_tree, tb_hot_iter, &hst);
+    g_array_sort(hst.entries, tb_hot_cmp);
+
+    cpu_fprintf(f, "%20s %6s %-18s %6s %6s  %s\n", "count", "%",
+                "guest pc", "guest", "host", "symbol");
+    for (i = 0; i < count && i < hst.entries->len; i++) {
+        struct tb_hot_entry *e = &g_array_index(hst.entries,
+                                                struct tb_hot_entry, i);
+
+        cpu_fprintf(f, "%20" PRIu64 " %5.1f%% 0x" TARGET_FMT_lx
+                    " %6u %6zu  %s\n", e->count,
+                    (double)e->count * 100 / hst.total, e->tb->pc,
+                    e->tb->size, e->tb->tc.size, lookup_symbol(e->tb->pc));
+    }
+
+    g_array_free(hst.entries, true);
+    tb_unlock();
+}
+
 #else /* CONFIG_USER_ONLY */
 
 void cpu_interrupt(CPUState *cpu, int mask)
@@ -43,6 +43,7 @@ void translator_loop(const TranslatorOps *ops, DisasContextBase *db,
     db->is_jmp = DISAS_NEXT;
     db->num_insns = 0;
     db->singlestep_enabled = cpu->singlestep_enabled;
+    db->jmp_dest_mask = 0;
 
     /* Instruction counting */
     max_insns = tb_cflags(db->tb) & CF_COUNT_MASK;
@@ -125,6 +126,16 @@ void translator_loop(const TranslatorOps *ops, DisasContextBase *db,
     db->tb->size = db->pc_next - db->pc_first;
     db->tb->icount = db->num_insns;
 
+    if (db->jmp_dest_mask && tb_prefetch_enabled()) {
+        int i;
+
+        for (i = 0; i < 2; i++) {
+            if (db->jmp_dest_mask & (1 << i)) {
+                tb_prefetch(cpu, db->jmp_dest[i], db->tb);
+            }
+        }
+    }
+
 #ifdef DEBUG_DISAS
     if (qemu_loglevel_mask(CPU_LOG_TB_IN_ASM)
         && qemu_log_in_addr_range(db->pc_first)) {
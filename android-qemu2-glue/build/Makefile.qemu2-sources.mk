@@ -1975,6 +1975,7 @@ QEMU2_TARGET_SOURCES += \
     accel/tcg/tcg-all.c \
     hw/misc/goldfish_battery.c \
     accel/tcg/translator.c \
+    accel/tcg/tb-prefetch.c \
     hw/input/goldfish_rotary.c \
     tcg/tcg-op-vec.c \
     memory.c \
@@ -860,6 +860,33 @@ $(call local-link-static-c++lib)
 
 $(call end-emulator-program)
 
+###############################################################################
+#
+#  android-emu pipe benchmarks
+#
+#  Measures the guest <-> host pipe layer through TestAndroidPipeDevice.
+#  Use --benchmark_format=json for machine-readable results.
+#
+
+$(call start-emulator-benchmark,android_emu_pipe$(BUILD_TARGET_SUFFIX)_benchmark)
+$(call gen-hw-config-defs)
+
+LOCAL_C_INCLUDES += \
+    $(ANDROID_EMU_INCLUDES) \
+    $(EMULATOR_COMMON_INCLUDES) \
+
+LOCAL_LDLIBS += \
+    $(ANDROID_EMU_LDLIBS) \
+
+LOCAL_SRC_FILES := \
+    android/emulation/AndroidPipe_benchmark.cpp \
+    android/emulation/testing/TestAndroidPipeDevice.cpp \
+
+LOCAL_STATIC_LIBRARIES += \
+    $(ANDROID_EMU_STATIC_LIBRARIES) \
+
+$(call end-emulator-benchmark)
+
 ###############################################################################
 #
 #  android-emu-metrics unit tests
@@ -17,7 +17,9 @@
 #include "android/base/memory/LazyInstance.h"
 #include "android/base/Optional.h"
 #include "android/base/StringFormat.h"
+#include "android/base/synchronization/ConditionVariable.h"
 #include "android/base/synchronization/Lock.h"
+#include "android/base/threads/FunctorThread.h"
 #include "android/base/threads/ThreadStore.h"
 #include "android/crashreport/CrashReporter.h"
 #include "android/emulation/android_pipe_device.h"
@@ -29,6 +31,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <assert.h>
@@ -51,6 +54,7 @@
 #define E(...) fprintf(stderr, "ERROR:" __VA_ARGS__), fprintf(stderr, "\n")
 
 static const AndroidPipeHwFuncs* sPipeHwFuncs = nullptr;
+static android::VmLock* sPipeVmLock = nullptr;
 
 using namespace android::base;
 
@@ -76,6 +80,35 @@ static BaseStream* asBaseStream(CStream* stream) {
 #define CHECK_VM_STATE_LOCK() (void)0
 #endif
 
+// The virtual device calls the guest i/o functions below without holding
+// the VM lock. Take it for the duration of the call, unless the pipe's
+// service says it can do without.
+class ScopedPipeVmLock {
+    DISALLOW_COPY_ASSIGN_AND_MOVE(ScopedPipeVmLock);
+
+public:
+    explicit ScopedPipeVmLock(const android::AndroidPipe* pipe) {
+        const auto service = pipe->service();
+        if (service && service->canRunWithoutVmLock()) {
+            return;
+        }
+        auto vmLock = VmLock::get();
+        if (!vmLock->isLockedBySelf()) {
+            mVmLock = vmLock;
+            mVmLock->lock();
+        }
+    }
+
+    ~ScopedPipeVmLock() {
+        if (mVmLock) {
+            mVmLock->unlock();
+        }
+    }
+
+private:
+    VmLock* mVmLock = nullptr;
+};
+
 namespace android {
 
 namespace {
@@ -323,6 +356,14 @@ struct PipeWakeCommand {
     int wakeFlags;
 };
 
+static void performPipeWake(const PipeWakeCommand& wakeCmd) {
+    if (wakeCmd.wakeFlags & PIPE_WAKE_CLOSED) {
+        sPipeHwFuncs->closeFromHost(wakeCmd.hwPipe);
+    } else {
+        sPipeHwFuncs->signalWake(wakeCmd.hwPipe, wakeCmd.wakeFlags);
+    }
+}
+
 class PipeWaker final : public DeviceContextRunner<PipeWakeCommand> {
 public:
     void signalWake(void* hwPipe, int wakeFlags) {
@@ -354,21 +395,181 @@ public:
 
 private:
     virtual void performDeviceOperation(const PipeWakeCommand& wake_cmd) {
-        void* hwPipe = wake_cmd.hwPipe;
-        int flags = wake_cmd.wakeFlags;
+        performPipeWake(wake_cmd);
+    }
+};
 
-        if (flags & PIPE_WAKE_CLOSED) {
-            sPipeHwFuncs->closeFromHost(hwPipe);
-        } else {
-            sPipeHwFuncs->signalWake(hwPipe, flags);
+// Like PipeWaker, but requests that can't be performed right away are
+// handed to a thread owned by a single service rather than to the main
+// loop, see Service::needsDedicatedWakeThread(). Pending wakes are merged
+// per |hwPipe|, so a producer never does more than take a short queue lock,
+// however far behind the delivery is. Delivery happens with the VM lock
+// held, which also serializes it with abortPending() from the guest close
+// path.
+class PipeWakeThread final {
+    DISALLOW_COPY_ASSIGN_AND_MOVE(PipeWakeThread);
+
+public:
+    PipeWakeThread() : mThread([this]() { worker(); }) { mThread.start(); }
+
+    ~PipeWakeThread() {
+        AutoLock lock(mLock);
+        mStopping = true;
+        mCv.signalAndUnlock(&lock);
+        // The worker may be waiting for the VM lock.
+        ScopedVmUnlock vmUnlock(vmLock());
+        mThread.wait();
+    }
+
+    void signalWake(void* hwPipe, int wakeFlags) {
+        AutoLock lock(mLock);
+        if (!mDeferAlways && vmLock()->isLockedBySelf()) {
+            lock.unlock();
+            performPipeWake({hwPipe, wakeFlags});
+            return;
+        }
+        for (auto& cmd : mPending) {
+            if (cmd.hwPipe == hwPipe) {
+                cmd.wakeFlags |= wakeFlags;
+                return;
+            }
+        }
+        const bool signal = mPending.empty();
+        mPending.push_back({hwPipe, wakeFlags});
+        if (signal) {
+            mCv.signalAndUnlock(&lock);
+        }
+    }
+    void abortPending(void* hwPipe) {
+        AutoLock lock(mLock);
+        mPending.erase(std::remove_if(mPending.begin(), mPending.end(),
+                                      [hwPipe](const PipeWakeCommand& cmd) {
+                                          return cmd.hwPipe == hwPipe;
+                                      }),
+                       mPending.end());
+    }
+    void abortAllPending() {
+        AutoLock lock(mLock);
+        mPending.clear();
+    }
+
+    int getPendingFlags(void* hwPipe) const {
+        AutoLock lock(mLock);
+        for (const auto& cmd : mPending) {
+            if (cmd.hwPipe == hwPipe) {
+                return cmd.wakeFlags;
+            }
+        }
+        return 0;
+    }
+
+    void setContextRunMode(ContextRunMode mode) {
+        AutoLock lock(mLock);
+        mDeferAlways = (mode == ContextRunMode::DeferAlways);
+        if (!mDeferAlways && !mPending.empty()) {
+            mCv.signalAndUnlock(&lock);
+        }
+    }
+
+private:
+    static VmLock* vmLock() {
+        return sPipeVmLock ? sPipeVmLock : VmLock::get();
+    }
+
+    void worker() {
+        std::vector<PipeWakeCommand> todo;
+        for (;;) {
+            {
+                AutoLock lock(mLock);
+                while (!mStopping && (mPending.empty() || mDeferAlways)) {
+                    mCv.wait(&lock);
+                }
+                if (mStopping) {
+                    return;
+                }
+            }
+
+            ScopedVmLock scopedVmLock(vmLock());
+            {
+                // Things may have changed while waiting for the VM lock.
+                AutoLock lock(mLock);
+                if (mStopping) {
+                    return;
+                }
+                if (mDeferAlways) {
+                    continue;
+                }
+                todo.swap(mPending);
+            }
+            for (const auto& cmd : todo) {
+                performPipeWake(cmd);
+            }
+            todo.clear();
         }
     }
+
+    mutable Lock mLock;
+    ConditionVariable mCv;
+    std::vector<PipeWakeCommand> mPending;
+    bool mDeferAlways = false;
+    bool mStopping = false;
+    FunctorThread mThread;
 };
 
 struct Globals {
     ServiceList services;
     ConnectorService connectorService;
     PipeWaker pipeWaker;
+    // Wake threads of the services that asked for one. Only changed when
+    // services are added or reset, before and after the VM runs.
+    std::unordered_map<const Service*, std::unique_ptr<PipeWakeThread>>
+            wakeThreads;
+
+    PipeWakeThread* findWakeThread(const Service* service) const {
+        if (wakeThreads.empty()) {
+            return nullptr;
+        }
+        const auto it = wakeThreads.find(service);
+        return it == wakeThreads.end() ? nullptr : it->second.get();
+    }
+
+    void signalWake(const Service* service, void* hwPipe, int wakeFlags) {
+        if (auto wakeThread = findWakeThread(service)) {
+            wakeThread->signalWake(hwPipe, wakeFlags);
+        } else {
+            pipeWaker.signalWake(hwPipe, wakeFlags);
+        }
+    }
+
+    void abortPending(const Service* service, void* hwPipe) {
+        if (auto wakeThread = findWakeThread(service)) {
+            wakeThread->abortPending(hwPipe);
+        } else {
+            pipeWaker.abortPending(hwPipe);
+        }
+    }
+
+    int getPendingFlags(const Service* service, void* hwPipe) const {
+        if (auto wakeThread = findWakeThread(service)) {
+            return wakeThread->getPendingFlags(hwPipe);
+        }
+        return pipeWaker.getPendingFlags(hwPipe);
+    }
+
+    // Used around snapshot loading, when the device can't take wakes.
+    void abortAllPending() {
+        pipeWaker.abortAllPending();
+        for (const auto& pair : wakeThreads) {
+            pair.second->abortAllPending();
+        }
+    }
+
+    void setContextRunMode(ContextRunMode mode) {
+        pipeWaker.setContextRunMode(mode);
+        for (const auto& pair : wakeThreads) {
+            pair.second->setContextRunMode(mode);
+        }
+    }
 
     // Searches for a service position in the |services| list and returns the
     // index. |startPosHint| is a _hint_ and suggests where to start from.
@@ -440,7 +641,7 @@ AndroidPipe* loadPipeFromStreamCommon(BaseStream* stream,
                             .c_str());
             abort();
         }
-        sGlobals->pipeWaker.signalWake(hwPipe, pendingFlags);
+        sGlobals->signalWake(service, hwPipe, pendingFlags);
         DD("%s: singalled wake flags %d for pipe hwpipe=%p", __func__,
            pendingFlags, hwPipe);
     }
@@ -452,6 +653,7 @@ AndroidPipe* loadPipeFromStreamCommon(BaseStream* stream,
 
 // static
 void AndroidPipe::initThreading(VmLock* vmLock) {
+    sPipeVmLock = vmLock;
     sGlobals->pipeWaker.init(vmLock);
 }
 
@@ -465,12 +667,16 @@ void AndroidPipe::Service::add(Service* service) {
     DD("Adding new pipe service '%s' this=%p", service->name().c_str(),
        service);
     std::unique_ptr<Service> svc(service);
+    if (service->needsDedicatedWakeThread()) {
+        sGlobals->wakeThreads[service].reset(new PipeWakeThread());
+    }
     sGlobals->services.push_back(std::move(svc));
 }
 
 // static
 void AndroidPipe::Service::resetAll() {
     DD("Resetting all pipe services");
+    sGlobals->wakeThreads.clear();
     sGlobals->services.clear();
 }
 
@@ -483,7 +689,7 @@ void AndroidPipe::signalWake(int wakeFlags) {
                         .c_str());
         abort();
     }
-    sGlobals->pipeWaker.signalWake(mHwPipe, wakeFlags);
+    sGlobals->signalWake(mService, mHwPipe, wakeFlags);
 }
 
 void AndroidPipe::closeFromHost() {
@@ -494,7 +700,7 @@ void AndroidPipe::closeFromHost() {
                         .c_str());
         abort();
     }
-    sGlobals->pipeWaker.closeFromHost(mHwPipe);
+    sGlobals->signalWake(mService, mHwPipe, PIPE_WAKE_CLOSED);
 }
 
 void AndroidPipe::abortPendingOperation() {
@@ -505,7 +711,7 @@ void AndroidPipe::abortPendingOperation() {
                         .c_str());
         abort();
     }
-    sGlobals->pipeWaker.abortPending(mHwPipe);
+    sGlobals->abortPending(mService, mHwPipe);
 }
 
 // static
@@ -527,7 +733,7 @@ void AndroidPipe::saveToStream(BaseStream* stream) {
     }
 
     // Save the pending wake or close operations as well.
-    const int pendingFlags = sGlobals->pipeWaker.getPendingFlags(mHwPipe);
+    const int pendingFlags = sGlobals->getPendingFlags(mService, mHwPipe);
     stream->putBe32(pendingFlags);
 }
 
@@ -576,13 +782,13 @@ void android_pipe_reset_services() {
 }
 
 void* android_pipe_guest_open(void* hwpipe) {
-    CHECK_VM_STATE_LOCK();
+    android::RecursiveScopedVmLock vmLock;
     DD("%s: Creating new connector pipe for hwpipe=%p", __FUNCTION__, hwpipe);
     return android::sGlobals->connectorService.create(hwpipe, nullptr);
 }
 
 void android_pipe_guest_close(void* internalPipe, PipeCloseReason reason) {
-    CHECK_VM_STATE_LOCK();
+    android::RecursiveScopedVmLock vmLock;
     auto pipe = static_cast<android::AndroidPipe*>(internalPipe);
     if (pipe) {
         D("%s: host=%p [%s] reason=%d", __FUNCTION__, pipe, pipe->name(),
@@ -633,8 +839,8 @@ static void forEachServiceFromStream(CStream* stream, Func&& func) {
 void android_pipe_guest_pre_load(CStream* stream) {
     CHECK_VM_STATE_LOCK();
     // We may not call qemu_set_irq() until the snapshot is loaded.
-    android::sGlobals->pipeWaker.abortAllPending();
-    android::sGlobals->pipeWaker.setContextRunMode(
+    android::sGlobals->abortAllPending();
+    android::sGlobals->setContextRunMode(
                 android::ContextRunMode::DeferAlways);
     forEachServiceFromStream(stream, [](Service* service, BaseStream* bs) {
         service->preLoad(bs);
@@ -647,7 +853,7 @@ void android_pipe_guest_post_load(CStream* stream) {
         service->postLoad(bs);
     });
     // Restore the regular handling of pipe interrupt requests.
-    android::sGlobals->pipeWaker.setContextRunMode(
+    android::sGlobals->setContextRunMode(
                 android::ContextRunMode::DeferIfNotLocked);
 }
 
@@ -695,8 +901,8 @@ void* android_pipe_guest_load_legacy(CStream* stream,
 }
 
 unsigned android_pipe_guest_poll(void* internalPipe) {
-    CHECK_VM_STATE_LOCK();
     auto pipe = static_cast<AndroidPipe*>(internalPipe);
+    ScopedPipeVmLock vmLock(pipe);
     DD("%s: host=%p [%s]", __FUNCTION__, pipe, pipe->name());
     return pipe->onGuestPoll();
 }
@@ -704,22 +910,22 @@ unsigned android_pipe_guest_poll(void* internalPipe) {
 int android_pipe_guest_recv(void* internalPipe,
                             AndroidPipeBuffer* buffers,
                             int numBuffers) {
-    CHECK_VM_STATE_LOCK();
     auto pipe = static_cast<AndroidPipe*>(internalPipe);
+    ScopedPipeVmLock vmLock(pipe);
     return pipe->onGuestRecv(buffers, numBuffers);
 }
 
 int android_pipe_guest_send(void* internalPipe,
                             const AndroidPipeBuffer* buffers,
                             int numBuffers) {
-    CHECK_VM_STATE_LOCK();
     auto pipe = static_cast<AndroidPipe*>(internalPipe);
+    ScopedPipeVmLock vmLock(pipe);
     return pipe->onGuestSend(buffers, numBuffers);
 }
 
 void android_pipe_guest_wake_on(void* internalPipe, unsigned wakes) {
-    CHECK_VM_STATE_LOCK();
     auto pipe = static_cast<AndroidPipe*>(internalPipe);
+    ScopedPipeVmLock vmLock(pipe);
     pipe->onGuestWantWakeOn(wakes);
 }
 
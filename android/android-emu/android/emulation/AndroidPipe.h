@@ -57,7 +57,10 @@ namespace android {
 //    device thread to operate on the pipe.
 //
 // 5) The signalWake() and closeFromHost() pipe methods can be called from
-//    any thread to signal i/o events, or ask for the pipe closure.
+//    any thread to signal i/o events, or ask for the pipe closure. Unless
+//    the VM lock is held by the caller, the request is queued and delivered
+//    later from the main loop, or from the service's own wake thread if
+//    Service::needsDedicatedWakeThread() returns true.
 //
 class AndroidPipe {
 public:
@@ -111,6 +114,24 @@ public:
             return nullptr;
         }
 
+        // Returns true if the guest i/o callbacks of this service's pipes
+        // (onGuestPoll(), onGuestRecv(), onGuestSend() and
+        // onGuestWantWakeOn()) can be called without the VM lock. Such
+        // pipes must protect their own state, and are never called
+        // concurrently for the same pipe instance. The default
+        // implementation returns false, i.e. the callbacks are called
+        // with the VM lock held.
+        virtual bool canRunWithoutVmLock() const { return false; }
+
+        // Returns true if the signalWake() and closeFromHost() requests of
+        // this service's pipes should be delivered to the virtual device by
+        // a host thread dedicated to the service, instead of the main loop
+        // that is shared by all other pipes. This keeps the wakes of a busy
+        // service from waiting behind timers or slower services, and the
+        // other way around. Must not change after the service is added.
+        // The default implementation returns false.
+        virtual bool needsDedicatedWakeThread() const { return false; }
+
         // Register a new |service| instance. After the call, the object
         // is owned by the global service manager, and will be destroyed
         // when resetAll() is called.
@@ -185,6 +206,9 @@ public:
         return mService ? mService->name().c_str() : "<null>";
     }
 
+    // Return the service that created this pipe, or nullptr.
+    Service* service() const { return mService; }
+
     // The following functions are implementation details. They are in the
     // public scope to make the implementation of android_pipe_guest_save()
     // and android_pipe_guest_load() easier. DO NOT CALL THEM DIRECTLY.
@@ -0,0 +1,190 @@
+// Copyright 2018 The Android Open Source Project
+//
+// This software is licensed under the terms of the GNU General Public
+// License version 2, as published by the Free Software Foundation, and
+// may be copied, distributed, and modified under those terms.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// Benchmarks for the guest <-> host pipe channel, using the
+// TestAndroidPipeDevice with the 'zero' and 'pingpong' services. This
+// measures the cost of the generic pipe layer (connection, dispatch to the
+// service, buffer walking), not that of a real virtual device.
+//
+// Run with --benchmark_format=json to get results that can be compared
+// between builds.
+
+#include "android/base/Log.h"
+#include "android/emulation/android_pipe_device.h"
+#include "android/emulation/testing/TestAndroidPipeDevice.h"
+
+#include "benchmark/benchmark_api.h"
+
+#include <memory>
+#include <vector>
+
+#include <stdint.h>
+
+extern "C" void android_pipe_add_type_pingpong(void);
+extern "C" void android_pipe_add_type_zero(void);
+
+using android::TestAndroidPipeDevice;
+using Guest = TestAndroidPipeDevice::Guest;
+using GuestList = std::vector<std::unique_ptr<Guest>>;
+
+namespace {
+
+// A TestAndroidPipeDevice that provides all the services benchmarked here.
+class BenchmarkPipeDevice : public TestAndroidPipeDevice {
+public:
+    BenchmarkPipeDevice() {
+        android_pipe_add_type_pingpong();
+        android_pipe_add_type_zero();
+    }
+};
+
+// Open |count| guest connections to |service|.
+GuestList openGuests(const char* service, int count) {
+    GuestList guests;
+    for (int n = 0; n < count; ++n) {
+        std::unique_ptr<Guest> guest(Guest::create());
+        CHECK(guest->connect(service) == 0) << "Can't connect to " << service;
+        guests.push_back(std::move(guest));
+    }
+    return guests;
+}
+
+// Split |data| into |numBuffers| descriptors of roughly the same size, the
+// way a guest driver hands over a scattered user buffer.
+std::vector<AndroidPipeBuffer> splitBuffer(std::vector<uint8_t>* data,
+                                           int numBuffers) {
+    std::vector<AndroidPipeBuffer> buffers(numBuffers);
+    const size_t chunk = data->size() / numBuffers;
+    size_t pos = 0;
+    for (int n = 0; n < numBuffers; ++n) {
+        const size_t size = (n + 1 == numBuffers) ? data->size() - pos : chunk;
+        buffers[n].data = data->data() + pos;
+        buffers[n].size = size;
+        pos += size;
+    }
+    return buffers;
+}
+
+void openClose(benchmark::State& state, const char* service) {
+    BenchmarkPipeDevice device;
+    while (state.KeepRunning()) {
+        std::unique_ptr<Guest> guest(Guest::create());
+        CHECK(guest->connect(service) == 0) << "Can't connect to " << service;
+        guest->close();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+// Connection setup and teardown, including the service name handshake.
+void BM_ZeroPipe_OpenClose(benchmark::State& state) {
+    openClose(state, "zero");
+}
+
+void BM_PingPongPipe_OpenClose(benchmark::State& state) {
+    openClose(state, "pingpong");
+}
+
+BENCHMARK(BM_ZeroPipe_OpenClose);
+BENCHMARK(BM_PingPongPipe_OpenClose);
+
+// Small message round trip: write range_x() bytes, read them back, once
+// for each of range_y() pipes open at the same time.
+void BM_PingPongPipe_RoundTrip(benchmark::State& state) {
+    BenchmarkPipeDevice device;
+    const size_t size = state.range_x();
+    const int numPipes = state.range_y();
+    GuestList guests = openGuests("pingpong", numPipes);
+    std::vector<uint8_t> message(size, 0x5a);
+    std::vector<uint8_t> reply(size);
+
+    while (state.KeepRunning()) {
+        for (const auto& guest : guests) {
+            CHECK(guest->write(message.data(), size) == (ssize_t)size);
+            CHECK(guest->read(reply.data(), size) == (ssize_t)size);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numPipes);
+    state.SetBytesProcessed(state.iterations() * numPipes * size * 2);
+}
+
+BENCHMARK(BM_PingPongPipe_RoundTrip)
+        ->ArgPair(4, 1)
+        ->ArgPair(64, 1)
+        ->ArgPair(512, 1)
+        ->ArgPair(4, 8)
+        ->ArgPair(64, 8)
+        ->ArgPair(4, 64)
+        ->ArgPair(64, 64);
+
+// Bulk transfers of range_x() bytes, scattered over range_y() buffers.
+static void bulkArguments(benchmark::internal::Benchmark* b) {
+    for (int size : {4 << 10, 64 << 10, 1 << 20}) {
+        for (int numBuffers : {1, 4, 16, 64}) {
+            b->ArgPair(size, numBuffers);
+        }
+    }
+}
+
+void BM_ZeroPipe_Send(benchmark::State& state) {
+    BenchmarkPipeDevice device;
+    GuestList guests = openGuests("zero", 1);
+    std::vector<uint8_t> data(state.range_x(), 0x5a);
+    const auto buffers = splitBuffer(&data, state.range_y());
+
+    while (state.KeepRunning()) {
+        CHECK(android_pipe_guest_send(guests[0]->getPipe(), buffers.data(),
+                                      (int)buffers.size()) ==
+              (int)data.size());
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void BM_ZeroPipe_Recv(benchmark::State& state) {
+    BenchmarkPipeDevice device;
+    GuestList guests = openGuests("zero", 1);
+    std::vector<uint8_t> data(state.range_x());
+    auto buffers = splitBuffer(&data, state.range_y());
+
+    while (state.KeepRunning()) {
+        CHECK(android_pipe_guest_recv(guests[0]->getPipe(), buffers.data(),
+                                      (int)buffers.size()) ==
+              (int)data.size());
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+// Data goes through the service's own buffer in both directions, which
+// is the closest match to a real host service.
+void BM_PingPongPipe_Bulk(benchmark::State& state) {
+    BenchmarkPipeDevice device;
+    GuestList guests = openGuests("pingpong", 1);
+    std::vector<uint8_t> data(state.range_x(), 0x5a);
+    auto buffers = splitBuffer(&data, state.range_y());
+    void* const pipe = guests[0]->getPipe();
+
+    while (state.KeepRunning()) {
+        CHECK(android_pipe_guest_send(pipe, buffers.data(),
+                                      (int)buffers.size()) ==
+              (int)data.size());
+        CHECK(android_pipe_guest_recv(pipe, buffers.data(),
+                                      (int)buffers.size()) ==
+              (int)data.size());
+    }
+    state.SetBytesProcessed(state.iterations() * data.size() * 2);
+}
+
+BENCHMARK(BM_ZeroPipe_Send)->Apply(bulkArguments);
+BENCHMARK(BM_ZeroPipe_Recv)->Apply(bulkArguments);
+BENCHMARK(BM_PingPongPipe_Bulk)->Apply(bulkArguments);
+
+BENCHMARK_MAIN()
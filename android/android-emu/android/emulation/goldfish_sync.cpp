@@ -116,6 +116,9 @@ void goldfish_sync_receive_hostcmd_result(uint32_t cmd,
                                           uint64_t handle,
                                           uint32_t time_arg,
                                           uint64_t hostcmd_handle) {
+    // The device calls this from a vCPU thread without the VM lock, so
+    // |wait_map| may be changing under us.
+    AutoLock mapLock(sCommandReplyLock);
     if (auto elt = android::base::find(wait_map, hostcmd_handle)) {
         CommandWaitInfo* wait_info = elt->get();
         AutoLock lock(wait_info->lock);
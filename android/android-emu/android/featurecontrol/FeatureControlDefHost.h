@@ -45,3 +45,4 @@ FEATURE_CONTROL_ITEM(WindowsHypervisorPlatform)
 FEATURE_CONTROL_ITEM(LocationUiV2)
 FEATURE_CONTROL_ITEM(SnapshotAdb)
 FEATURE_CONTROL_ITEM(QuickbootFileBacked)
+FEATURE_CONTROL_ITEM(GLShaderCache)
@@ -38,4 +38,6 @@ FEATURE_CONTROL_ITEM(VirtualScene)
 FEATURE_CONTROL_ITEM(GenericSnapshotsUI)
 // File-backed Quickboot
 FEATURE_CONTROL_ITEM(QuickbootFileBacked)
+// Only saves host shader compilation work, the guest sees the same results
+FEATURE_CONTROL_ITEM(GLShaderCache)
 // No guest feature flags seem safe to snapshot.
@@ -13,6 +13,7 @@
 #include "android/base/Optional.h"
 #include "android/base/Stopwatch.h"
 #include "android/base/async/Looper.h"
+#include "android/base/containers/SmallVector.h"
 #include "android/base/files/PathUtils.h"
 #include "android/base/files/StreamSerializing.h"
 #include "android/base/threads/FunctorThread.h"
@@ -46,6 +47,8 @@
 #endif
 
 using ChannelBuffer = emugl::RenderChannel::Buffer;
+using ChannelChunks =
+        android::base::SmallFixedVector<emugl::RenderChannel::Chunk, 16>;
 using emugl::RenderChannel;
 using emugl::RenderChannelPtr;
 using ChannelState = emugl::RenderChannel::State;
@@ -75,6 +78,14 @@ public:
 
         bool canLoad() const override { return true; }
 
+        // All pipe state lives in the RenderChannel, which is thread-safe,
+        // and wakes may already come from the render threads.
+        bool canRunWithoutVmLock() const override { return true; }
+
+        // Render threads signal a wake for every reply; don't make them
+        // wait behind the main loop, or other services' wakes behind them.
+        bool needsDedicatedWakeThread() const override { return true; }
+
         virtual void preLoad(android::base::Stream* stream) override {
 #ifdef SNAPSHOT_PROFILE
             mLoadMeter.restartUs();
@@ -371,30 +382,24 @@ public:
             return PIPE_ERROR_IO;
         }
 
-        // Count the total bytes to send.
-        int count = 0;
-        for (int n = 0; n < numBuffers; ++n) {
-            count += buffers[n].size;
-        }
-
-        // Copy everything into a single ChannelBuffer.
-        ChannelBuffer outBuffer;
-        outBuffer.resize_noinit(count);
-        auto ptr = outBuffer.data();
+        // Send everything through the channel, which copies it directly
+        // into its ring buffer.
+        ChannelChunks chunks;
+        chunks.resize_noinit(numBuffers);
         for (int n = 0; n < numBuffers; ++n) {
-            memcpy(ptr, buffers[n].data, buffers[n].size);
-            ptr += buffers[n].size;
+            chunks[n].data = buffers[n].data;
+            chunks[n].size = buffers[n].size;
         }
 
-        D("%s: sending %d bytes to host", __func__, count);
-        // Send it through the channel.
-        auto result = mChannel->tryWrite(std::move(outBuffer));
+        size_t count = 0;
+        auto result = mChannel->tryWrite(chunks.data(), chunks.size(), &count);
         if (result != IoResult::Ok) {
             D("%s: tryWrite() failed with %d", __func__, (int)result);
             return result == IoResult::Error ? PIPE_ERROR_IO : PIPE_ERROR_AGAIN;
         }
 
-        return count;
+        D("%s: sent %d bytes to host", __func__, (int)count);
+        return (int)count;
     }
 
     virtual void onGuestWantWakeOn(int flags) override {
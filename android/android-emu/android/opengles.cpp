@@ -12,7 +12,10 @@
 
 #include "android/opengles.h"
 
+#include "android/base/files/PathUtils.h"
+#include "android/base/system/System.h"
 #include "android/crashreport/crash-handler.h"
+#include "android/emulation/ConfigDirs.h"
 #include "android/emulation/GoldfishDma.h"
 #include "android/featurecontrol/FeatureControl.h"
 #include "android/globals.h"
@@ -76,6 +79,25 @@ static int initOpenglesEmulationFuncs(ADynamicLibrary* rendererLib) {
     return 0;
 }
 
+// Point the GLES translator at its persistent shader cache, unless the user
+// has already chosen a directory in the environment.
+static void setupShaderCacheDir() {
+    static const char kVar[] = "ANDROID_EMUGL_SHADER_CACHE_DIR";
+    android::base::System* system = android::base::System::get();
+    if (!system->envGet(kVar).empty() ||
+        !android::featurecontrol::isEnabled(
+                android::featurecontrol::GLShaderCache)) {
+        return;
+    }
+    const std::string dir = android::base::PathUtils::join(
+            android::ConfigDirs::getUserDirectory(), "emugl-shader-cache");
+    if (path_mkdir_if_needed(dir.c_str(), 0755) < 0) {
+        D("Can't create shader cache directory %s", dir.c_str());
+        return;
+    }
+    system->envSet(kVar, dir);
+}
+
 static bool sRendererUsesSubWindow;
 static bool sEgl2egl;
 static emugl::RenderLibPtr sRenderLib = nullptr;
@@ -176,6 +198,8 @@ android_startOpenglesRenderer(int width, int height, bool guestPhoneApi, int gue
     dma_ops.unlock = android_goldfish_dma_ops.unlock;
     sRenderLib->setDmaOps(dma_ops);
 
+    setupShaderCacheDir();
+
     sRenderer = sRenderLib->initRenderer(width, height, sRendererUsesSubWindow, sEgl2egl);
     if (!sRenderer) {
         D("Can't start OpenGLES renderer?");
@@ -18,6 +18,7 @@
   X(void, eglBlitFromCurrentReadBufferANDROID, (EGLDisplay display, EGLImageKHR image)) \
   X(void*, eglSetImageFenceANDROID, (EGLDisplay display, EGLImageKHR image)) \
   X(void, eglWaitImageFenceANDROID, (EGLDisplay display, void* fence)) \
+  X(EGLint, eglGetImageTextureUseCountANDROID, (EGLDisplay display, EGLImageKHR image)) \
   X(void, eglAddLibrarySearchPathANDROID, (const char* path)) \
 
 
@@ -40,8 +40,8 @@ using namespace ::android::base::EnumFlags;
 //
 class RenderChannel {
 public:
-    // A type used to pass byte packets between the guest and the
-    // RenderChannel instance. Experience has shown that using a
+    // A type used to pass byte packets from the RenderChannel instance to
+    // the guest. Experience has shown that using a
     // SmallFixedVector<char, N> instance instead of a std::vector<char>
     // avoids a lot of un-necessary heap allocations. The current size
     // of 512 was selected after profiling existing traffic, including
@@ -84,11 +84,20 @@ public:
     // Get the current state flags.
     virtual State state() const = 0;
 
-    // Try to writes the data in |buffer| into the channel. On success,
-    // return IoResult::Ok and moves |buffer|. On failure, return
-    // IoResult::TryAgain if the channel was full, or IoResult::Error
-    // if it is stopped.
-    virtual IoResult tryWrite(Buffer&& buffer) = 0;
+    // A piece of guest data to send, see tryWrite().
+    struct Chunk {
+        const void* data;
+        size_t size;
+    };
+
+    // Try to write the data of the |numChunks| |chunks| into the channel,
+    // in order. Copies as much as there is room for: on success, return
+    // IoResult::Ok and sets |*written| to the number of bytes copied, which
+    // is never 0. On failure, return IoResult::TryAgain if the channel was
+    // full, or IoResult::Error if it is stopped.
+    virtual IoResult tryWrite(const Chunk* chunks,
+                              size_t numChunks,
+                              size_t* written) = 0;
 
     // Try to read data from the channel. On success, return IoResult::Ok and
     // sets |*buffer| to contain the data. On failure, return
@@ -102,6 +102,7 @@ EGLAPI EGLint EGLAPIENTRY eglWaitSyncKHR(EGLDisplay display, EGLSyncKHR sync, EG
 EGLAPI void EGLAPIENTRY eglBlitFromCurrentReadBufferANDROID(EGLDisplay display, EGLImageKHR image);
 EGLAPI void* EGLAPIENTRY eglSetImageFenceANDROID(EGLDisplay display, EGLImageKHR image);
 EGLAPI void EGLAPIENTRY eglWaitImageFenceANDROID(EGLDisplay display, void* fence);
+EGLAPI EGLint EGLAPIENTRY eglGetImageTextureUseCountANDROID(EGLDisplay display, EGLImageKHR image);
 EGLAPI void EGLAPIENTRY eglAddLibrarySearchPathANDROID(const char* path);
 }  // extern "C"
 
@@ -126,6 +127,8 @@ static const ExtensionDescriptor s_eglExtensions[] = {
                 (__eglMustCastToProperFunctionPointerType)eglSetImageFenceANDROID },
         {"eglWaitImageFenceANDROID",
                 (__eglMustCastToProperFunctionPointerType)eglWaitImageFenceANDROID },
+        {"eglGetImageTextureUseCountANDROID",
+                (__eglMustCastToProperFunctionPointerType)eglGetImageTextureUseCountANDROID },
         {"eglAddLibrarySearchPathANDROID",
                 (__eglMustCastToProperFunctionPointerType)eglAddLibrarySearchPathANDROID },
 };
@@ -1543,6 +1546,20 @@ EGLAPI void EGLAPIENTRY eglWaitImageFenceANDROID(EGLDisplay dpy, void* fence) {
     iface->waitSync((GLsync)fence, 0, -1);
 }
 
+// Returns the number of holders of the texture object behind |image|: the
+// image itself, the texture it was created from, and each texture or
+// renderbuffer that glEGLImageTarget*OES() bound to it. Returns 0 if
+// |image| is not valid.
+EGLAPI EGLint EGLAPIENTRY eglGetImageTextureUseCountANDROID(EGLDisplay display, EGLImageKHR image) {
+    VALIDATE_DISPLAY_RETURN(display, 0);
+    const GLESiface* iface = g_eglInfo->getIface(GLES_2_0);
+    ImagePtr img = dpy->getImage(image, iface->restoreTexture);
+    if (!img || !img->globalTexObj) {
+        return 0;
+    }
+    return (EGLint)img->globalTexObj.use_count();
+}
+
 EGLAPI void EGLAPIENTRY eglAddLibrarySearchPathANDROID(const char* path) {
     emugl::SharedLibrary::addLibrarySearchPath(path);
 }
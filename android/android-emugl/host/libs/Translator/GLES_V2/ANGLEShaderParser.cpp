@@ -11,7 +11,11 @@
 
 #include "ANGLEShaderParser.h"
 
+#include "ShaderCache.h"
+
+#include "android/base/StringFormat.h"
 #include "android/base/synchronization/Lock.h"
+#include "android/version.h"
 
 #include <map>
 #include <string>
@@ -209,6 +213,30 @@ static int detectShaderESSLVersion(const char* const* strings) {
     return wantedESSLVersion;
 }
 
+// Everything the translation of |src| depends on, to look it up in
+// ShaderCache. The translator is part of the emulator, so its version
+// stands for the translator's.
+static std::string translationCacheKey(bool hostUsesCoreProfile,
+                                       GLenum shaderType,
+                                       const char* src) {
+    const ShBuiltInResources& r = kResources;
+    std::string key = android::base::StringFormat(
+            "%s core=%d type=0x%x resources=%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,"
+            "%d,%d,%d,%d,%d,%d\n",
+            EMULATOR_FULL_VERSION_STRING, hostUsesCoreProfile, shaderType,
+            r.MaxVertexAttribs, r.MaxVertexUniformVectors,
+            r.MaxVaryingVectors, r.MaxVertexTextureImageUnits,
+            r.MaxCombinedTextureImageUnits, r.MaxTextureImageUnits,
+            r.MaxFragmentUniformVectors, r.MaxDrawBuffers,
+            r.FragmentPrecisionHigh, r.MaxVertexOutputVectors,
+            r.MaxFragmentInputVectors, r.MinProgramTexelOffset,
+            r.MaxProgramTexelOffset, r.MaxDualSourceDrawBuffers,
+            r.OES_standard_derivatives, r.OES_EGL_image_external,
+            r.EXT_gpu_shader5);
+    key += src;
+    return key;
+}
+
 bool translate(bool hostUsesCoreProfile,
                const char* src,
                GLenum shaderType,
@@ -241,6 +269,19 @@ bool translate(bool hostUsesCoreProfile,
         return false;
     }
 
+    ShaderCache* cache = ShaderCache::get();
+    std::string cacheKey;
+    if (cache->enabled() && outShaderLinkInfo) {
+        cacheKey = translationCacheKey(hostUsesCoreProfile, shaderType, src);
+        ShaderCache::Translation translation;
+        if (cache->getTranslation(cacheKey, &translation)) {
+            *outInfolog = std::move(translation.infoLog);
+            *outObjCode = std::move(translation.objCode);
+            *outShaderLinkInfo = std::move(translation.linkInfo);
+            return translation.valid;
+        }
+    }
+
     // ANGLE may crash if multiple RenderThreads attempt to compile shaders
     // at the same time.
     android::base::AutoLock autolock(kCompilerLock);
@@ -271,6 +312,16 @@ bool translate(bool hostUsesCoreProfile,
     if (outShaderLinkInfo) getShaderLinkInfo(esslVersion, compilerHandle, outShaderLinkInfo);
 
     ShClearResults(compilerHandle);
+    autolock.unlock();
+
+    if (!cacheKey.empty()) {
+        ShaderCache::Translation translation;
+        translation.valid = res;
+        translation.infoLog = *outInfolog;
+        translation.objCode = *outObjCode;
+        translation.linkInfo = *outShaderLinkInfo;
+        cache->putTranslation(cacheKey, translation);
+    }
 
     return res;
 }
@@ -10,7 +10,7 @@ host_common_SRC_FILES := \
      ProgramData.cpp
 
 # ANGLE shader translation is not supported on Windows yet.
-host_common_SRC_FILES += ANGLEShaderParser.cpp
+host_common_SRC_FILES += ANGLEShaderParser.cpp ShaderCache.cpp
 
 ### GLES_V2 host implementation (On top of OpenGL) ########################
 $(call emugl-begin-shared-library,lib$(BUILD_TARGET_SUFFIX)GLES_V2_translator)
@@ -327,9 +327,8 @@ GL_APICALL void  GL_APIENTRY glBindAttribLocation(GLuint program, GLuint index,
 
         ProgramData* pData = (ProgramData*)objData;
 
-        ctx->dispatcher().glBindAttribLocation(
-                globalProgramName, index,
-                c_str(pData->getTranslatedName(name)));
+        pData->bindHostAttribLocation(globalProgramName,
+                                      pData->getTranslatedName(name), index);
 
         pData->bindAttribLocation(name, index);
     }
@@ -2811,7 +2810,7 @@ GL_APICALL void  GL_APIENTRY glLinkProgram(GLuint program){
         GLint vertexShader =  programData->getAttachedVertexShader();
 
         if (ctx->getMajorVersion() >= 3 && ctx->getMinorVersion() >= 1) {
-            ctx->dispatcher().glLinkProgram(globalProgramName);
+            programData->linkHostProgram(globalProgramName);
             ctx->dispatcher().glGetProgramiv(globalProgramName,GL_LINK_STATUS,&linkStatus);
         } else {
             if (vertexShader != 0 && fragmentShader!=0) {
@@ -2824,7 +2823,7 @@ GL_APICALL void  GL_APIENTRY glLinkProgram(GLuint program){
 
                 if(fragSp->getCompileStatus() && vertSp->getCompileStatus()) {
                     if (programData->validateLink(fragSp, vertSp)) {
-                        ctx->dispatcher().glLinkProgram(globalProgramName);
+                        programData->linkHostProgram(globalProgramName);
                         ctx->dispatcher().glGetProgramiv(globalProgramName,GL_LINK_STATUS,&linkStatus);
                     } else {
                         programData->setLinkStatus(GL_FALSE);
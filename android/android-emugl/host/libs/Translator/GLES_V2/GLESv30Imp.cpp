@@ -786,7 +786,15 @@ extern "C" GL_APICALL void GL_APIENTRY glTransformFeedbackVaryings(GLuint progra
     gles30usages->set_is_used(true);
     if (ctx->shareGroup().get()) {
         const GLuint globalProgramName = ctx->shareGroup()->getGlobalName(NamedObjectType::SHADER_OR_PROGRAM, program);
-        ctx->dispatcher().glTransformFeedbackVaryings(globalProgramName, count, varyings, bufferMode);
+        auto objData = ctx->shareGroup()->getObjectData(
+                NamedObjectType::SHADER_OR_PROGRAM, program);
+        if (objData && objData->getDataType() == PROGRAM_DATA) {
+            ProgramData* pData = (ProgramData*)objData;
+            pData->setHostTransformFeedbackVaryings(globalProgramName, count,
+                                                    varyings, bufferMode);
+        } else {
+            ctx->dispatcher().glTransformFeedbackVaryings(globalProgramName, count, varyings, bufferMode);
+        }
     }
 }
 
@@ -966,7 +974,14 @@ GL_APICALL void GL_APIENTRY glProgramParameteri(GLuint program, GLenum pname, GL
     gles30usages->set_is_used(true);
     if (ctx->shareGroup().get()) {
         const GLuint globalProgramName = ctx->shareGroup()->getGlobalName(NamedObjectType::SHADER_OR_PROGRAM, program);
-        ctx->dispatcher().glProgramParameteri(globalProgramName, pname, value);
+        auto objData = ctx->shareGroup()->getObjectData(
+                NamedObjectType::SHADER_OR_PROGRAM, program);
+        if (objData && objData->getDataType() == PROGRAM_DATA) {
+            ProgramData* pData = (ProgramData*)objData;
+            pData->setHostProgramParameter(globalProgramName, pname, value);
+        } else {
+            ctx->dispatcher().glProgramParameteri(globalProgramName, pname, value);
+        }
     }
 }
 
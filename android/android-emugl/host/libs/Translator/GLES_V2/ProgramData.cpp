@@ -17,10 +17,12 @@
 #include "ProgramData.h"
 #include "OpenglCodecCommon/glUtils.h"
 
+#include "android/base/StringFormat.h"
 #include "android/base/containers/Lookup.h"
 #include "android/base/files/StreamSerializing.h"
 #include "ANGLEShaderParser.h"
 #include "GLcommon/GLutils.h"
+#include "ShaderCache.h"
 
 #include <GLcommon/ShareGroup.h>
 #include <GLES3/gl31.h>
@@ -70,6 +72,20 @@ static int s_glShaderType2ShaderType(GLenum type) {
     return ProgramData::NUM_SHADER_TYPE;
 }
 
+static GLenum s_shaderType2GlShaderType(int type) {
+    switch (type) {
+    case ProgramData::VERTEX:
+        return GL_VERTEX_SHADER;
+    case ProgramData::FRAGMENT:
+        return GL_FRAGMENT_SHADER;
+    case ProgramData::COMPUTE:
+        return GL_COMPUTE_SHADER;
+    default:
+        assert(0);
+        return 0;
+    }
+}
+
 ProgramData::ProgramData(int glesMaj, int glesMin)
     : ObjectData(PROGRAM_DATA),
       ValidateStatus(false),
@@ -393,44 +409,24 @@ void ProgramData::restore(ObjectLocalName localName,
         // Really, each program name corresponds to 2 programs:
         // the one that is already linked, and the one that is not yet linked.
         // We need to restore both.
-        GLint tmpShaders[NUM_SHADER_TYPE];
+        std::string hostSources[NUM_SHADER_TYPE];
         for (int i = 0; i < NUM_SHADER_TYPE; i++) {
             AttachedShader& s = attachedShaders[i];
             if (s.linkedSource.empty()) {
-                tmpShaders[i] = 0;
                 continue;
             }
-            GLenum type = 0;
-            switch (i) {
-            case VERTEX:
-                type = GL_VERTEX_SHADER;
-                break;
-            case FRAGMENT:
-                type = GL_FRAGMENT_SHADER;
-                break;
-            case COMPUTE:
-                type = GL_COMPUTE_SHADER;
-                break;
-            default:
-                assert(0);
-            }
-            tmpShaders[i] = dispatcher.glCreateShader(type);
-            const GLchar* src = (const GLchar *)s.linkedSource.c_str();
-            std::string parsedSrc;
-            if (!isGles2Gles()) {
+            if (isGles2Gles()) {
+                hostSources[i] = s.linkedSource;
+            } else {
                 std::string infoLog;
                 ANGLEShaderParser::translate(
                             isCoreProfile(),
-                            src,
-                            type,
+                            s.linkedSource.c_str(),
+                            s_shaderType2GlShaderType(i),
                             &infoLog,
-                            &parsedSrc,
+                            &hostSources[i],
                             &s.linkInfo);
-                src = parsedSrc.c_str();
             }
-            dispatcher.glShaderSource(tmpShaders[i], 1, &src, NULL);
-            dispatcher.glCompileShader(tmpShaders[i]);
-            dispatcher.glAttachShader(globalName, tmpShaders[i]);
         }
         for (const auto& attribLocs : linkedAttribLocs) {
             // Prefix "gl_" is reserved, we should skip those.
@@ -438,8 +434,8 @@ void ProgramData::restore(ObjectLocalName localName,
             if  (strncmp(attribLocs.first.c_str(), "gl_", 3) == 0) {
                 continue;
             }
-            dispatcher.glBindAttribLocation(globalName, attribLocs.second,
-                    attribLocs.first.c_str());
+            bindHostAttribLocation(globalName, attribLocs.first,
+                                   attribLocs.second);
         }
         if (mGlesMajorVersion >= 3) {
             std::vector<const char*> varyings;
@@ -447,12 +443,38 @@ void ProgramData::restore(ObjectLocalName localName,
             for (size_t i = 0; i < mTransformFeedbacks.size(); i++) {
                 varyings[i] = mTransformFeedbacks[i].c_str();
             }
-            dispatcher.glTransformFeedbackVaryings(
+            setHostTransformFeedbackVaryings(
                     globalName, mTransformFeedbacks.size(), varyings.data(),
                     mTransformFeedbackBufferMode);
             mTransformFeedbacks.clear();
         }
-        dispatcher.glLinkProgram(globalName);
+
+        // Compiling and linking the shaders again is most of the time it
+        // takes to load a snapshot, try the cached program binary first.
+        GLint tmpShaders[NUM_SHADER_TYPE] = {};
+        ShaderCache* cache = ShaderCache::get();
+        const std::string cacheKey =
+                cache->enabled() ? linkCacheKey(hostSources) : std::string();
+        if (cacheKey.empty() ||
+            !cache->loadProgram(dispatcher, globalName, cacheKey)) {
+            for (int i = 0; i < NUM_SHADER_TYPE; i++) {
+                if (attachedShaders[i].linkedSource.empty()) {
+                    continue;
+                }
+                tmpShaders[i] = dispatcher.glCreateShader(
+                        s_shaderType2GlShaderType(i));
+                const GLchar* src = hostSources[i].c_str();
+                dispatcher.glShaderSource(tmpShaders[i], 1, &src, NULL);
+                dispatcher.glCompileShader(tmpShaders[i]);
+                dispatcher.glAttachShader(globalName, tmpShaders[i]);
+            }
+            dispatcher.glLinkProgram(globalName);
+            GLint linkStatus = GL_FALSE;
+            dispatcher.glGetProgramiv(globalName, GL_LINK_STATUS, &linkStatus);
+            if (!cacheKey.empty() && linkStatus == GL_TRUE) {
+                cache->saveProgram(dispatcher, globalName, cacheKey);
+            }
+        }
         dispatcher.glUseProgram(globalName);
 #ifdef DEBUG
         for (const auto& attribLocs : linkedAttribLocs) {
@@ -620,8 +642,8 @@ void ProgramData::restore(ObjectLocalName localName,
         }
     }
     for (const auto& attribLocs : boundAttribLocs) {
-        dispatcher.glBindAttribLocation(globalName, attribLocs.second,
-                attribLocs.first.c_str());
+        bindHostAttribLocation(globalName, attribLocs.first,
+                               attribLocs.second);
     }
 }
 
@@ -725,6 +747,80 @@ void ProgramData::linkedAttribLocation(const std::string& var, GLuint loc) {
     linkedAttribLocs[var] = loc;
 }
 
+void ProgramData::bindHostAttribLocation(GLuint globalName,
+                                         const std::string& hostName,
+                                         GLuint loc) {
+    GLEScontext::dispatcher().glBindAttribLocation(globalName, loc,
+                                                   hostName.c_str());
+    mHostAttribLocs[hostName] = loc;
+}
+
+void ProgramData::setHostTransformFeedbackVaryings(GLuint globalName,
+                                                   GLsizei count,
+                                                   const char** varyings,
+                                                   GLenum bufferMode) {
+    GLEScontext::dispatcher().glTransformFeedbackVaryings(
+            globalName, count, varyings, bufferMode);
+    mHostTransformFeedbacks.assign(varyings, varyings + count);
+    mHostTransformFeedbackBufferMode = bufferMode;
+}
+
+void ProgramData::setHostProgramParameter(GLuint globalName,
+                                          GLenum pname,
+                                          GLint value) {
+    GLEScontext::dispatcher().glProgramParameteri(globalName, pname, value);
+    if (pname == GL_PROGRAM_SEPARABLE) {
+        mHostSeparable = value != GL_FALSE;
+    }
+}
+
+std::string ProgramData::linkCacheKey(const std::string* hostSources) const {
+    std::string key = android::base::StringFormat(
+            "core=%d separable=%d\n", isCoreProfile(), mHostSeparable);
+    for (int i = 0; i < NUM_SHADER_TYPE; i++) {
+        key += android::base::StringFormat("shader %d %zu\n", i,
+                                           hostSources[i].size());
+        key += hostSources[i];
+    }
+    for (const auto& attribLoc : mHostAttribLocs) {
+        key += android::base::StringFormat("attrib %u %s\n",
+                                           attribLoc.second, attribLoc.first);
+    }
+    key += android::base::StringFormat("feedback 0x%x\n",
+                                       mHostTransformFeedbackBufferMode);
+    for (const auto& varying : mHostTransformFeedbacks) {
+        key += varying + "\n";
+    }
+    return key;
+}
+
+void ProgramData::linkHostProgram(GLuint globalName) {
+    GLDispatch& dispatcher = GLEScontext::dispatcher();
+    ShaderCache* cache = ShaderCache::get();
+    std::string cacheKey;
+    if (cache->enabled()) {
+        std::string hostSources[NUM_SHADER_TYPE];
+        for (int i = 0; i < NUM_SHADER_TYPE; i++) {
+            if (attachedShaders[i].shader) {
+                hostSources[i] = attachedShaders[i].shader->getCompiledSrc();
+            }
+        }
+        cacheKey = linkCacheKey(hostSources);
+        if (cache->loadProgram(dispatcher, globalName, cacheKey)) {
+            return;
+        }
+    }
+
+    dispatcher.glLinkProgram(globalName);
+    if (!cacheKey.empty()) {
+        GLint linkStatus = GL_FALSE;
+        dispatcher.glGetProgramiv(globalName, GL_LINK_STATUS, &linkStatus);
+        if (linkStatus == GL_TRUE) {
+            cache->saveProgram(dispatcher, globalName, cacheKey);
+        }
+    }
+}
+
 // Link-time validation
 void ProgramData::appendValidationErrMsg(std::ostringstream& ss) {
     validationInfoLog += "Error: " + ss.str() + "\n";
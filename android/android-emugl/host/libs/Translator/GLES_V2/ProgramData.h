@@ -20,6 +20,7 @@
 
 #include "android/base/StringView.h"
 
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -82,6 +83,21 @@ public:
     void bindAttribLocation(const std::string& var, GLuint loc);
     void linkedAttribLocation(const std::string& var, GLuint loc);
 
+    // Change the state of the host program |globalName| that linking
+    // depends on, keeping track of it for linkHostProgram().
+    void bindHostAttribLocation(GLuint globalName,
+                                const std::string& hostName,
+                                GLuint loc);
+    void setHostTransformFeedbackVaryings(GLuint globalName,
+                                          GLsizei count,
+                                          const char** varyings,
+                                          GLenum bufferMode);
+    void setHostProgramParameter(GLuint globalName, GLenum pname, GLint value);
+
+    // Link the host program |globalName| with the attached shaders, from
+    // the binary saved in ShaderCache if there is one.
+    void linkHostProgram(GLuint globalName);
+
     void appendValidationErrMsg(std::ostringstream& ss);
     bool validateLink(ShaderParser* frag, ShaderParser* vert);
 
@@ -139,6 +155,15 @@ private:
     std::vector<std::string> mTransformFeedbacks;
     GLenum mTransformFeedbackBufferMode = 0;
 
+    // The state of the host program set by the methods above. With the
+    // host shader sources, it makes the ShaderCache key of linked binaries.
+    std::map<std::string, GLuint> mHostAttribLocs;
+    std::vector<std::string> mHostTransformFeedbacks;
+    GLenum mHostTransformFeedbackBufferMode = 0;
+    bool mHostSeparable = false;
+
+    std::string linkCacheKey(const std::string* hostSources) const;
+
     int mGlesMajorVersion = 2;
     int mGlesMinorVersion = 0;
     std::unordered_map<GLuint, GLUniformDesc> collectUniformInfo() const;
@@ -0,0 +1,426 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ShaderCache.h"
+
+#include "android/base/StringFormat.h"
+#include "android/base/files/StdioStream.h"
+#include "android/base/files/StreamSerializing.h"
+#include "android/base/memory/LazyInstance.h"
+#include "android/base/system/System.h"
+#include "android/utils/path.h"
+
+#include <GLES3/gl31.h>
+
+#include <algorithm>
+#include <atomic>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+using android::base::MemStream;
+using android::base::StdioStream;
+using android::base::Stream;
+using android::base::StringFormat;
+using android::base::System;
+
+static constexpr uint32_t kMagic = 0x53484443;  // 'SHDC'
+static constexpr uint32_t kVersion = 1;
+
+// Larger entries are considered corrupted.
+static constexpr uint32_t kMaxEntrySize = 64 * 1024 * 1024;
+
+static constexpr char kEntrySuffix[] = ".shc";
+
+static android::base::LazyInstance<ShaderCache> sShaderCache =
+        LAZY_INSTANCE_INIT;
+
+// 64-bit FNV-1a, used both to name entries and to check their content.
+static uint64_t hashBytes(const void* data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t n = 0; n < size; ++n) {
+        hash ^= static_cast<const uint8_t*>(data)[n];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// ShaderLinkInfo serialization. This stores the fields the translator
+// fills in and ProgramData uses to validate links.
+
+static void saveVariable(Stream* stream, const sh::ShaderVariable& var) {
+    stream->putBe32(var.type);
+    stream->putBe32(var.precision);
+    stream->putString(var.name);
+    stream->putString(var.mappedName);
+    stream->putBe32(var.arraySize);
+    stream->putByte(var.staticUse);
+    stream->putString(var.structName);
+    android::base::saveBuffer(stream, var.fields, saveVariable);
+}
+
+static void loadVariable(Stream* stream, sh::ShaderVariable* var) {
+    var->type = stream->getBe32();
+    var->precision = stream->getBe32();
+    var->name = stream->getString();
+    var->mappedName = stream->getString();
+    var->arraySize = stream->getBe32();
+    var->staticUse = stream->getByte();
+    var->structName = stream->getString();
+    android::base::loadBuffer(stream, &var->fields, [](Stream* stream) {
+        sh::ShaderVariable field;
+        loadVariable(stream, &field);
+        return field;
+    });
+}
+
+template <class T, class SaveFunc>
+static void saveVariables(Stream* stream,
+                          const std::vector<T>& vars,
+                          SaveFunc&& saveExtra) {
+    android::base::saveBuffer(stream, vars,
+                              [&saveExtra](Stream* stream, const T& var) {
+                                  saveVariable(stream, var);
+                                  saveExtra(stream, var);
+                              });
+}
+
+template <class T, class LoadFunc>
+static void loadVariables(Stream* stream,
+                          std::vector<T>* vars,
+                          LoadFunc&& loadExtra) {
+    android::base::loadBuffer(stream, vars, [&loadExtra](Stream* stream) {
+        T var;
+        loadVariable(stream, &var);
+        loadExtra(stream, &var);
+        return var;
+    });
+}
+
+static void saveStringMap(Stream* stream,
+                          const std::map<std::string, std::string>& map) {
+    android::base::saveCollection(
+            stream, map,
+            [](Stream* stream,
+               const std::pair<const std::string, std::string>& elt) {
+                stream->putString(elt.first);
+                stream->putString(elt.second);
+            });
+}
+
+static void loadStringMap(Stream* stream,
+                          std::map<std::string, std::string>* map) {
+    android::base::loadCollection(stream, map, [](Stream* stream) {
+        std::string first = stream->getString();
+        return std::make_pair(std::move(first), stream->getString());
+    });
+}
+
+static void saveLinkInfo(Stream* stream,
+                         const ANGLEShaderParser::ShaderLinkInfo& info) {
+    stream->putBe32(info.esslVersion);
+    saveVariables(stream, info.uniforms,
+                  [](Stream* stream, const sh::Uniform& var) {});
+    saveVariables(stream, info.varyings,
+                  [](Stream* stream, const sh::Varying& var) {
+                      stream->putBe32(var.interpolation);
+                      stream->putByte(var.isInvariant);
+                  });
+    saveVariables(stream, info.attributes,
+                  [](Stream* stream, const sh::Attribute& var) {
+                      stream->putBe32(var.location);
+                  });
+    saveVariables(stream, info.outputVars,
+                  [](Stream* stream, const sh::OutputVariable& var) {
+                      stream->putBe32(var.location);
+                  });
+    android::base::saveBuffer(
+            stream, info.interfaceBlocks,
+            [](Stream* stream, const sh::InterfaceBlock& block) {
+                stream->putString(block.name);
+                stream->putString(block.mappedName);
+                stream->putString(block.instanceName);
+                stream->putBe32(block.arraySize);
+                stream->putBe32(block.layout);
+                stream->putByte(block.isRowMajorLayout);
+                stream->putByte(block.staticUse);
+                saveVariables(stream, block.fields,
+                              [](Stream* stream,
+                                 const sh::InterfaceBlockField& field) {
+                                  stream->putByte(field.isRowMajorLayout);
+                              });
+            });
+    saveStringMap(stream, info.nameMap);
+    saveStringMap(stream, info.nameMapReverse);
+}
+
+static void loadLinkInfo(Stream* stream,
+                         ANGLEShaderParser::ShaderLinkInfo* info) {
+    info->esslVersion = stream->getBe32();
+    loadVariables(stream, &info->uniforms,
+                  [](Stream* stream, sh::Uniform* var) {});
+    loadVariables(stream, &info->varyings,
+                  [](Stream* stream, sh::Varying* var) {
+                      var->interpolation =
+                              static_cast<sh::InterpolationType>(
+                                      stream->getBe32());
+                      var->isInvariant = stream->getByte();
+                  });
+    loadVariables(stream, &info->attributes,
+                  [](Stream* stream, sh::Attribute* var) {
+                      var->location = stream->getBe32();
+                  });
+    loadVariables(stream, &info->outputVars,
+                  [](Stream* stream, sh::OutputVariable* var) {
+                      var->location = stream->getBe32();
+                  });
+    android::base::loadBuffer(
+            stream, &info->interfaceBlocks, [](Stream* stream) {
+                sh::InterfaceBlock block;
+                block.name = stream->getString();
+                block.mappedName = stream->getString();
+                block.instanceName = stream->getString();
+                block.arraySize = stream->getBe32();
+                block.layout =
+                        static_cast<sh::BlockLayoutType>(stream->getBe32());
+                block.isRowMajorLayout = stream->getByte();
+                block.staticUse = stream->getByte();
+                loadVariables(stream, &block.fields,
+                              [](Stream* stream, sh::InterfaceBlockField* field) {
+                                  field->isRowMajorLayout = stream->getByte();
+                              });
+                return block;
+            });
+    info->nameMap.clear();
+    info->nameMapReverse.clear();
+    loadStringMap(stream, &info->nameMap);
+    loadStringMap(stream, &info->nameMapReverse);
+}
+
+// static
+ShaderCache* ShaderCache::get() {
+    return sShaderCache.ptr();
+}
+
+ShaderCache::ShaderCache()
+    : ShaderCache(System::get()->envGet("ANDROID_EMUGL_SHADER_CACHE_DIR")) {}
+
+ShaderCache::ShaderCache(const std::string& dir, uint64_t maxSize)
+    : mDir(dir) {
+    if (mDir.empty()) {
+        return;
+    }
+
+    struct Entry {
+        std::string path;
+        System::FileSize size;
+        System::Duration modificationTime;
+    };
+    std::vector<Entry> entries;
+    System::FileSize totalSize = 0;
+    for (auto& path : System::get()->scanDirEntries(mDir, true)) {
+        System::FileSize size = 0;
+        if (!System::get()->pathFileSize(path, &size)) {
+            continue;
+        }
+        totalSize += size;
+        const auto time = System::get()->pathModificationTime(path);
+        entries.push_back({std::move(path), size, time ? *time : 0});
+    }
+    if (totalSize <= maxSize) {
+        return;
+    }
+
+    // Other emulator instances may be using the cache too, so only drop the
+    // entries that were written the longest time ago.
+    fprintf(stderr, "%s: shader cache is full, evicting old entries\n",
+            __func__);
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry& a, const Entry& b) {
+                  return a.modificationTime < b.modificationTime;
+              });
+    for (const auto& entry : entries) {
+        if (totalSize <= maxSize / 4 * 3) {
+            break;
+        }
+        if (System::get()->deleteFile(entry.path)) {
+            totalSize -= entry.size;
+        }
+    }
+}
+
+bool ShaderCache::getTranslation(const std::string& key,
+                                 Translation* translation) {
+    MemStream data;
+    if (!readEntry("translation\n" + key, &data)) {
+        return false;
+    }
+    translation->valid = data.getByte();
+    translation->infoLog = data.getString();
+    translation->objCode = data.getString();
+    loadLinkInfo(&data, &translation->linkInfo);
+    return true;
+}
+
+void ShaderCache::putTranslation(const std::string& key,
+                                 const Translation& translation) {
+    const std::string entryKey = "translation\n" + key;
+    MemStream data;
+    data.putString(entryKey);
+    data.putByte(translation.valid);
+    data.putString(translation.infoLog);
+    data.putString(translation.objCode);
+    saveLinkInfo(&data, translation.linkInfo);
+    writeEntry(entryKey, data);
+}
+
+bool ShaderCache::loadProgram(const GLFuncs& gl,
+                              GLuint program,
+                              const std::string& key) {
+    const std::string& driver = driverId(gl);
+    if (driver.empty()) {
+        return false;
+    }
+    MemStream data;
+    if (!readEntry("program\n" + driver + key, &data)) {
+        return false;
+    }
+    const GLenum format = data.getBe32();
+    std::vector<char> binary;
+    if (!android::base::loadBuffer(&data, &binary)) {
+        return false;
+    }
+
+    gl.glProgramBinary(program, format, binary.data(), binary.size());
+    GLint linkStatus = GL_FALSE;
+    gl.glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    return linkStatus == GL_TRUE;
+}
+
+void ShaderCache::saveProgram(const GLFuncs& gl,
+                              GLuint program,
+                              const std::string& key) {
+    const std::string& driver = driverId(gl);
+    if (driver.empty()) {
+        return;
+    }
+
+    GLint size = 0;
+    gl.glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+    if (size <= 0) {
+        return;
+    }
+    std::vector<char> binary(size);
+    GLsizei length = 0;
+    GLenum format = 0;
+    gl.glGetProgramBinary(program, size, &length, &format,
+                                  binary.data());
+    if (length <= 0) {
+        return;
+    }
+    binary.resize(length);
+
+    const std::string entryKey = "program\n" + driver + key;
+    MemStream data;
+    data.putString(entryKey);
+    data.putBe32(format);
+    android::base::saveBuffer(&data, binary);
+    writeEntry(entryKey, data);
+}
+
+const std::string& ShaderCache::driverId(const GLFuncs& gl) {
+    android::base::AutoLock lock(mLock);
+    if (mDriverChecked || !enabled()) {
+        return mDriverId;
+    }
+    mDriverChecked = true;
+
+    if (!gl.glProgramBinary || !gl.glGetProgramBinary) {
+        return mDriverId;
+    }
+    GLint numFormats = 0;
+    gl.glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
+    if (numFormats <= 0) {
+        return mDriverId;
+    }
+    for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+        const GLubyte* str = gl.glGetString(name);
+        mDriverId += str ? reinterpret_cast<const char*>(str) : "";
+        mDriverId += '\n';
+    }
+    return mDriverId;
+}
+
+std::string ShaderCache::entryPath(const std::string& key) const {
+    return StringFormat("%s" PATH_SEP "%016" PRIx64 "%s", mDir,
+                        hashBytes(key.data(), key.size()), kEntrySuffix);
+}
+
+bool ShaderCache::readEntry(const std::string& key, MemStream* data) {
+    if (!enabled()) {
+        return false;
+    }
+    FILE* file = ::fopen(entryPath(key).c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    StdioStream stream(file, StdioStream::kOwner);
+    if (stream.getBe32() != kMagic || stream.getBe32() != kVersion) {
+        return false;
+    }
+    const uint32_t size = stream.getBe32();
+    const uint64_t hash = stream.getBe64();
+    if (size > kMaxEntrySize) {
+        return false;
+    }
+    MemStream::Buffer buffer(size);
+    if (stream.read(buffer.data(), size) != (ssize_t)size ||
+        hashBytes(buffer.data(), size) != hash) {
+        return false;
+    }
+    *data = MemStream(std::move(buffer));
+    return data->getString() == key;
+}
+
+void ShaderCache::writeEntry(const std::string& key, const MemStream& data) {
+    if (!enabled()) {
+        return;
+    }
+    static std::atomic<uint32_t> sNextTempIndex{0};
+
+    // Write a temporary file first so readers never see partial entries,
+    // even from other emulator instances.
+    const std::string path = entryPath(key);
+    const std::string tempPath =
+            StringFormat("%s.%d.%u.tmp", path,
+                         (int)System::get()->getCurrentProcessId(),
+                         sNextTempIndex++);
+    FILE* file = ::fopen(tempPath.c_str(), "wb");
+    if (!file) {
+        return;
+    }
+    const auto& buffer = data.buffer();
+    {
+        StdioStream stream(file, StdioStream::kOwner);
+        stream.putBe32(kMagic);
+        stream.putBe32(kVersion);
+        stream.putBe32(buffer.size());
+        stream.putBe64(hashBytes(buffer.data(), buffer.size()));
+        stream.write(buffer.data(), buffer.size());
+    }
+    if (::rename(tempPath.c_str(), path.c_str()) != 0) {
+        // Another thread or instance just added the same entry.
+        System::get()->deleteFile(tempPath);
+    }
+}
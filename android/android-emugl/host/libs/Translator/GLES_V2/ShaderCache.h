@@ -0,0 +1,120 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "ANGLEShaderParser.h"
+
+#include "android/base/Compiler.h"
+#include "android/base/files/MemStream.h"
+#include "android/base/synchronization/Lock.h"
+
+#include <GLES2/gl2.h>
+#include <GLES3/gl3.h>
+
+#include <string>
+
+// A persistent cache of the work needed to build guest shader programs:
+// the ANGLE translation of each shader, and the host driver binary of each
+// linked program when the driver can export them. Apps compile the same
+// shaders on every launch, and loading a snapshot builds all the programs
+// again, so most of that work is found here.
+//
+// Entries are files in the directory named by the
+// ANDROID_EMUGL_SHADER_CACHE_DIR environment variable. Nothing is cached
+// if it isn't set. Several emulator instances may share the directory.
+//
+// Entries are looked up by a key string holding everything the result
+// depends on. Each entry stores its full key, so two keys with the same
+// hash only cost a miss.
+//
+// All methods are thread-safe.
+class ShaderCache {
+    DISALLOW_COPY_ASSIGN_AND_MOVE(ShaderCache);
+
+public:
+    // The oldest entries are evicted on startup once the cache grows larger
+    // than |maxSize|, until it is back under 3/4 of that. Guest programs
+    // rarely change, so that happens after many host driver updates.
+    static constexpr uint64_t kDefaultMaxSize = 256 * 1024 * 1024;
+
+    // Uses the directory in ANDROID_EMUGL_SHADER_CACHE_DIR.
+    ShaderCache();
+    // Uses |dir|, or caches nothing if it is empty.
+    explicit ShaderCache(const std::string& dir,
+                         uint64_t maxSize = kDefaultMaxSize);
+
+    // Returns the instance used by the translator.
+    static ShaderCache* get();
+
+    bool enabled() const { return !mDir.empty(); }
+
+    // The results of ANGLEShaderParser::translate().
+    struct Translation {
+        bool valid = false;
+        std::string infoLog;
+        std::string objCode;
+        ANGLEShaderParser::ShaderLinkInfo linkInfo = {};
+    };
+
+    bool getTranslation(const std::string& key, Translation* translation);
+    void putTranslation(const std::string& key,
+                        const Translation& translation);
+
+    // The GL functions used for program binaries. They are taken from the
+    // caller's dispatch table, GLDispatch in the translator.
+    struct GLFuncs {
+        template <class Dispatch>
+        GLFuncs(const Dispatch& gl)
+            : glGetIntegerv(gl.glGetIntegerv),
+              glGetString(gl.glGetString),
+              glGetProgramiv(gl.glGetProgramiv),
+              glGetProgramBinary(gl.glGetProgramBinary),
+              glProgramBinary(gl.glProgramBinary) {}
+
+        void (GL_APIENTRY* glGetIntegerv)(GLenum, GLint*);
+        const GLubyte* (GL_APIENTRY* glGetString)(GLenum);
+        void (GL_APIENTRY* glGetProgramiv)(GLuint, GLenum, GLint*);
+        void (GL_APIENTRY* glGetProgramBinary)(GLuint, GLsizei, GLsizei*,
+                                               GLenum*, void*);
+        void (GL_APIENTRY* glProgramBinary)(GLuint, GLenum, const void*,
+                                            GLsizei);
+    };
+
+    // Program binaries. These must be called with a current context, whose
+    // driver identity is added to |key|.
+    //
+    // loadProgram() links |program| from the binary saved for |key|. It
+    // returns false if there is none or the driver rejected it, and the
+    // program must then be linked as usual. Once that succeeds,
+    // saveProgram() saves its binary for |key|.
+    bool loadProgram(const GLFuncs& gl, GLuint program, const std::string& key);
+    void saveProgram(const GLFuncs& gl, GLuint program, const std::string& key);
+
+private:
+    std::string entryPath(const std::string& key) const;
+    bool readEntry(const std::string& key, android::base::MemStream* data);
+    void writeEntry(const std::string& key,
+                    const android::base::MemStream& data);
+
+    // Returns a string identifying the host driver, or an empty one if it
+    // can't export program binaries.
+    const std::string& driverId(const GLFuncs& gl);
+
+    const std::string mDir;
+
+    android::base::Lock mLock;
+    bool mDriverChecked = false;
+    std::string mDriverId;
+};
@@ -52,8 +52,26 @@ $(call emugl-end-module)
 
 $(call emugl-begin-executable,lib$(BUILD_TARGET_SUFFIX)GLcommon_unittests)
 
-LOCAL_SRC_FILES := Etc2_unittest.cpp
+LOCAL_SRC_FILES := \
+    Etc2_unittest.cpp \
+    ObjectNameMap_unittest.cpp \
+
 $(call emugl-import,libGLcommon libemugl_gtest)
 $(call local-link-static-c++lib)
 $(call emugl-end-module)
 
+### GLcommon benchmarks ########################
+# Only built with android/configure.sh --benchmarks.
+
+ifeq (true,$(BUILD_BENCHMARKS))
+$(call emugl-begin-executable,lib$(BUILD_TARGET_SUFFIX)GLcommon_benchmark)
+
+LOCAL_SRC_FILES := ObjectNameMap_benchmark.cpp
+LOCAL_C_INCLUDES += $(GOOGLE_BENCHMARK_INCLUDES)
+LOCAL_STATIC_LIBRARIES += $(GOOGLE_BENCHMARK_STATIC_LIBRARIES)
+LOCAL_LDLIBS += $(GOOGLE_BENCHMARK_LDLIBS)
+$(call emugl-import,libGLcommon)
+$(call local-link-static-c++lib)
+$(call emugl-end-module)
+endif
+
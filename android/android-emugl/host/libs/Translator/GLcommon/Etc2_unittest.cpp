@@ -13,9 +13,14 @@
 // limitations under the License.
 
 #include <GLcommon/etc.h>
+#include <GLcommon/TextureUtils.h>
 
 #include <gtest/gtest.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
 
 namespace {
 class Etc2Test : public ::testing::Test {
@@ -227,3 +232,79 @@ TEST_F(Etc2Test, ETC2RGB8A1_OP0_Planer) {
         118, 224, 245, 255, 113, 221, 244, 255, 107, 219, 243, 255, 102, 216, 242, 255};
     decodeRgb8A1Test((const etc1_byte*)encoded, (const etc1_byte*)expectedDecoded);
 }
+
+// Large images are decoded on several threads, in bands of block rows. The
+// result must be the same as decoding them in one go.
+TEST_F(Etc2Test, DecodeImageInBands) {
+    const etc1_uint32 width = 1001;
+    const etc1_uint32 height = 517;
+    for (ETC2ImageFormat format : {EtcRGB8, EtcRGBA8, EtcRG11, EtcRGB8A1}) {
+        std::vector<etc1_byte> encoded(
+                etc_get_encoded_data_size(format, width, height));
+        srand(format);
+        for (auto& byte : encoded) {
+            byte = rand();
+        }
+        const etc1_uint32 stride =
+                (width * etc_get_decoded_pixel_size(format) + 3) & ~3;
+        std::vector<etc1_byte> expected(stride * height);
+        std::vector<etc1_byte> decoded(stride * height);
+        EXPECT_EQ(0, etc2_decode_image(encoded.data(), format,
+                                       expected.data(), width, height,
+                                       stride));
+        EXPECT_EQ(0, etcDecodeImage(encoded.data(), format, decoded.data(),
+                                    width, height, stride));
+        EXPECT_TRUE(expected == decoded) << "format " << format;
+    }
+}
+
+// The SSE4.1 and AVX2 block decoders must give the same results as the scalar
+// ones, bit for bit, for random blocks of every mode and for every format.
+TEST_F(Etc2Test, SimdDecodersMatchScalar) {
+    const EtcDecoderImpl defaultImpl = etc_get_decoder_impl();
+    const int kBlocks = 100000;
+    std::vector<etc1_byte> encoded(kBlocks * cRgbEncodedSize);
+    srand(0);
+    for (auto& byte : encoded) {
+        byte = rand();
+    }
+    // Decodes each block as RGB8, RGB8A1, alpha, R11 and signed R11.
+    const size_t decodedBlockSize = cRgbPatchSize + cRgb8A1PatchSize +
+                                    cAlphaPatchSize + 2 * cAlphaPatchSize * 4;
+    auto decodeAll = [&](std::vector<etc1_byte>* decoded) {
+        decoded->resize(kBlocks * decodedBlockSize);
+        etc1_byte* out = decoded->data();
+        for (int i = 0; i < kBlocks; i++) {
+            const etc1_byte* block = encoded.data() + i * cRgbEncodedSize;
+            etc2_decode_rgb_block(block, false, out);
+            out += cRgbPatchSize;
+            etc2_decode_rgb_block(block, true, out);
+            out += cRgb8A1PatchSize;
+            eac_decode_single_channel_block(block, 1, false, out);
+            out += cAlphaPatchSize;
+            eac_decode_single_channel_block(block, 4, false, out);
+            out += cAlphaPatchSize * 4;
+            eac_decode_single_channel_block(block, 4, true, out);
+            out += cAlphaPatchSize * 4;
+        }
+    };
+
+    std::vector<etc1_byte> expected;
+    ASSERT_TRUE(etc_set_decoder_impl(EtcDecoderScalar));
+    decodeAll(&expected);
+    for (EtcDecoderImpl impl : {EtcDecoderSse41, EtcDecoderAvx2}) {
+        if (!etc_set_decoder_impl(impl)) {
+            printf("Skipping unsupported ETC decoder %d\n", impl);
+            continue;
+        }
+        std::vector<etc1_byte> decoded;
+        decodeAll(&decoded);
+        for (int i = 0; i < kBlocks; i++) {
+            const size_t offset = i * decodedBlockSize;
+            ASSERT_EQ(0, memcmp(expected.data() + offset,
+                                decoded.data() + offset, decodedBlockSize))
+                    << "decoder " << impl << ", block " << i;
+        }
+    }
+    etc_set_decoder_impl(defaultImpl);
+}
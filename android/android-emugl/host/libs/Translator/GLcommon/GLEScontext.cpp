@@ -711,10 +711,9 @@ void GLEScontext::postSave(android::base::Stream* stream) const {
     (void)stream;
     // We need to mark the textures dirty, for those that has been bound to
     // a potential render target.
-    for (ObjectDataMap::const_iterator it = m_fboNameSpace->objDataMapBegin();
-        it != m_fboNameSpace->objDataMapEnd();
-        it ++) {
-        FramebufferData* fbData = (FramebufferData*)it->second.get();
+    m_fboNameSpace->forEachObjectData([this](ObjectLocalName,
+                                             const ObjectDataPtr& objData) {
+        FramebufferData* fbData = (FramebufferData*)objData.get();
         fbData->makeTextureDirty([this](NamedObjectType p_type,
             ObjectLocalName p_localName) {
                 if (p_type == NamedObjectType::FRAMEBUFFER) {
@@ -723,7 +722,7 @@ void GLEScontext::postSave(android::base::Stream* stream) const {
                     return m_shareGroup->getObjectDataPtr(p_type, p_localName);
                 }
             });
-    }
+    });
 }
 
 void GLEScontext::postLoadRestoreShareGroup() {
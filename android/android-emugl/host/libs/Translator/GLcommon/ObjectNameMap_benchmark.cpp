@@ -0,0 +1,128 @@
+// Copyright 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Measures the guest name lookups the GLES translator does while decoding
+// a typical draw: bind a program, a vertex and an index buffer, two
+// textures, then draw, each time translating the guest name through the
+// share group's NameSpace. ObjectNameMap is compared with the
+// std::unordered_map NameSpace used before.
+
+#include "GLcommon/ObjectNameMap.h"
+
+#include "benchmark/benchmark_api.h"
+
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Stand-ins for NamedObjectPtr and ObjectDataPtr.
+struct Object {
+    unsigned int globalName;
+};
+using ObjectPtr = std::shared_ptr<Object>;
+
+struct HashMap {
+    std::unordered_map<ObjectLocalName, ObjectPtr> map;
+
+    void emplace(ObjectLocalName name, ObjectPtr obj) {
+        map.emplace(name, std::move(obj));
+    }
+    unsigned int getGlobalName(ObjectLocalName name) const {
+        const auto it = map.find(name);
+        return it != map.end() ? it->second->globalName : 0;
+    }
+};
+
+struct FlatMap {
+    ObjectNameMap<ObjectPtr> map;
+
+    void emplace(ObjectLocalName name, ObjectPtr obj) {
+        map.emplace(name, std::move(obj));
+    }
+    unsigned int getGlobalName(ObjectLocalName name) const {
+        const ObjectPtr* obj = map.find(name);
+        return obj ? (*obj)->globalName : 0;
+    }
+};
+
+// The objects of one type in a share group, and the names a sequence of
+// draws uses, picked at random.
+template <class Map>
+struct NameSpaceFixture {
+    static constexpr int kNumDraws = 1024;
+
+    NameSpaceFixture(int numObjects, int namesPerDraw) {
+        for (int i = 1; i <= numObjects; ++i) {
+            map.emplace(i, std::make_shared<Object>(Object{i + 1000u}));
+        }
+        std::mt19937 rand(numObjects);
+        for (int i = 0; i < kNumDraws * namesPerDraw; ++i) {
+            draws.push_back(1 + rand() % numObjects);
+        }
+    }
+
+    Map map;
+    std::vector<ObjectLocalName> draws;
+};
+
+template <class Map>
+void BM_DecodeDraw(benchmark::State& state) {
+    // Per draw: 1 program, 2 buffers, 2 textures, and the program's data
+    // looked up again for the draw itself.
+    NameSpaceFixture<Map> programs(state.range_x(), 2);
+    NameSpaceFixture<Map> buffers(state.range_x(), 2);
+    NameSpaceFixture<Map> textures(state.range_x(), 2);
+
+    size_t draw = 0;
+    unsigned int sum = 0;
+    while (state.KeepRunning()) {
+        const size_t i = draw * 2;
+        sum += programs.map.getGlobalName(programs.draws[i]);
+        sum += buffers.map.getGlobalName(buffers.draws[i]);
+        sum += buffers.map.getGlobalName(buffers.draws[i + 1]);
+        sum += textures.map.getGlobalName(textures.draws[i]);
+        sum += textures.map.getGlobalName(textures.draws[i + 1]);
+        sum += programs.map.getGlobalName(programs.draws[i]);
+        draw = (draw + 1) % NameSpaceFixture<Map>::kNumDraws;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Lookups of names that don't exist, e.g. glIsBuffer() or 0 names.
+template <class Map>
+void BM_LookupMissing(benchmark::State& state) {
+    NameSpaceFixture<Map> objects(state.range_x(), 1);
+    ObjectLocalName name = state.range_x() + 1;
+    unsigned int sum = 0;
+    while (state.KeepRunning()) {
+        sum += objects.map.getGlobalName(name);
+        sum += objects.map.getGlobalName(0);
+    }
+    benchmark::DoNotOptimize(sum);
+}
+
+}  // namespace
+
+#define NAMESPACE_BENCHMARK(x) \
+    BENCHMARK_TEMPLATE(x, HashMap)->Arg(16)->Arg(256)->Arg(4096); \
+    BENCHMARK_TEMPLATE(x, FlatMap)->Arg(16)->Arg(256)->Arg(4096)
+
+NAMESPACE_BENCHMARK(BM_DecodeDraw);
+NAMESPACE_BENCHMARK(BM_LookupMissing);
+
+BENCHMARK_MAIN()
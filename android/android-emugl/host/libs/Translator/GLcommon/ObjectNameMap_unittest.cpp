@@ -0,0 +1,120 @@
+// Copyright 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <GLcommon/ObjectNameMap.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <random>
+
+using IntMap = ObjectNameMap<int>;
+
+TEST(ObjectNameMap, Basic) {
+    IntMap map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(nullptr, map.find(1));
+
+    EXPECT_EQ(10, map.emplace(1, 10));
+    EXPECT_EQ(20, map.emplace(2, 20));
+    EXPECT_EQ(2U, map.size());
+    ASSERT_NE(nullptr, map.find(1));
+    EXPECT_EQ(10, *map.find(1));
+    EXPECT_TRUE(map.contains(2));
+    EXPECT_FALSE(map.contains(3));
+
+    // Like std::unordered_map::emplace(), doesn't replace existing values.
+    EXPECT_EQ(10, map.emplace(1, 11));
+    EXPECT_EQ(2U, map.size());
+
+    EXPECT_TRUE(map.erase(1));
+    EXPECT_FALSE(map.erase(1));
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(1U, map.size());
+}
+
+TEST(ObjectNameMap, LargeNames) {
+    IntMap map;
+    const ObjectLocalName large = 0x123456789ULL;
+    map.emplace(large, 1);
+    map.emplace(IntMap::kMaxDenseSize, 2);
+    map.emplace(5, 3);
+    EXPECT_EQ(3U, map.size());
+    EXPECT_EQ(1, *map.find(large));
+    EXPECT_EQ(2, *map.find(IntMap::kMaxDenseSize));
+    EXPECT_EQ(3, *map.find(5));
+    EXPECT_FALSE(map.contains(large + 1));
+    EXPECT_TRUE(map.erase(large));
+    EXPECT_FALSE(map.contains(large));
+}
+
+TEST(ObjectNameMap, NonTrivialValues) {
+    ObjectNameMap<std::shared_ptr<int>> map;
+    auto value = std::make_shared<int>(42);
+    map.emplace(3, value);
+    EXPECT_EQ(2, value.use_count());
+    // Growing the vector keeps the values.
+    map.emplace(IntMap::kMinDenseSize * 4, nullptr);
+    map.emplace(IntMap::kMinDenseSize - 1, nullptr);
+    EXPECT_EQ(value, *map.find(3));
+    EXPECT_EQ(2, value.use_count());
+    map.erase(3);
+    EXPECT_EQ(1, value.use_count());
+}
+
+// Checks against std::map with a mix of dense and sparse names, including
+// sparse ones that end up in range as the vector grows.
+TEST(ObjectNameMap, MatchesStdMap) {
+    IntMap map;
+    std::map<ObjectLocalName, int> expected;
+    std::mt19937 rand(1234);
+    for (int i = 0; i < 50000; ++i) {
+        ObjectLocalName name;
+        switch (rand() % 4) {
+            case 0:
+            case 1:
+                name = rand() % 2048;
+                break;
+            case 2:
+                name = rand() % 100000;
+                break;
+            default:
+                name = ((ObjectLocalName)rand() << 32) | rand();
+                break;
+        }
+        if (rand() % 3) {
+            map.emplace(name, i);
+            expected.emplace(name, i);
+        } else {
+            EXPECT_EQ(expected.erase(name) != 0, map.erase(name));
+        }
+    }
+
+    EXPECT_EQ(expected.size(), map.size());
+    for (const auto& it : expected) {
+        const int* value = map.find(it.first);
+        ASSERT_NE(nullptr, value) << it.first;
+        EXPECT_EQ(it.second, *value);
+    }
+
+    size_t count = 0;
+    map.forEach([&expected, &count](ObjectLocalName name, int value) {
+        ++count;
+        const auto it = expected.find(name);
+        ASSERT_NE(expected.end(), it) << name;
+        EXPECT_EQ(it->second, value);
+    });
+    EXPECT_EQ(expected.size(), count);
+}
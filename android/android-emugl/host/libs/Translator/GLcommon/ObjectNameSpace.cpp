@@ -73,30 +73,32 @@ NameSpace::~NameSpace() {
 }
 
 void NameSpace::postLoad(const ObjectData::getObjDataPtr_t& getObjDataPtr) {
-    for (const auto& objData : m_objectDataMap) {
-        GL_LOG("NameSpace::%s: %p: try to load object %llu\n", __func__, this, objData.first);
-        if (!objData.second) {
+    m_objectDataMap.forEach([this, &getObjDataPtr](
+            ObjectLocalName localName, const ObjectDataPtr& objData) {
+        GL_LOG("NameSpace::%s: %p: try to load object %llu\n", __func__, this, localName);
+        if (!objData) {
             emugl_crash_reporter(
                     "Fatal: null object data ptr on restore\n");
         }
-        objData.second->postLoad(getObjDataPtr);
-    }
+        objData->postLoad(getObjDataPtr);
+    });
 }
 
 void NameSpace::touchTextures() {
     assert(m_type == NamedObjectType::TEXTURE);
-    for (const auto& obj : m_objectDataMap) {
-        TextureData* texData = (TextureData*)obj.second.get();
+    m_objectDataMap.forEach([this](ObjectLocalName localName,
+                                   const ObjectDataPtr& objData) {
+        TextureData* texData = (TextureData*)objData.get();
         if (!texData->needRestore()) {
             GL_LOG("NameSpace::%s: %p: texture data %p does not need restore\n",
                     __func__, this, texData);
-            continue;
+            return;
         }
         const SaveableTexturePtr& saveableTexture = texData->getSaveableTexture();
         if (!saveableTexture.get()) {
             GL_LOG("NameSpace::%s: %p: warning: no saveableTexture for texture data %p\n",
                     __func__, this, texData);
-            continue;
+            return;
         }
 
         NamedObjectPtr texNamedObj = saveableTexture->getGlobalObject();
@@ -105,10 +107,10 @@ void NameSpace::touchTextures() {
                     __func__, this, texData);
             emugl_crash_reporter("fatal: null global texture object in NameSpace::touchTextures");
         }
-        setGlobalObject(obj.first, texNamedObj);
+        setGlobalObject(localName, texNamedObj);
         texData->setGlobalName(texNamedObj->getGlobalName());
         texData->restore(0, nullptr);
-    }
+    });
 }
 
 void NameSpace::postLoadRestore(const ObjectData::getGlobalName_t& getGlobalName) {
@@ -124,18 +126,19 @@ void NameSpace::postLoadRestore(const ObjectData::getGlobalName_t& getGlobalName
     int numPasses = m_type == NamedObjectType::SHADER_OR_PROGRAM
             ? 2 : 1;
     for (int pass = 0; pass < numPasses; pass ++) {
-        for (const auto& obj : m_objectDataMap) {
+        m_objectDataMap.forEach([this, pass, &getGlobalName](
+                ObjectLocalName localName, const ObjectDataPtr& objData) {
             assert(m_type == ObjectDataType2NamedObjectType(
-                    obj.second->getDataType()));
+                    objData->getDataType()));
             // get global names
-            if ((obj.second->getDataType() == PROGRAM_DATA && pass == 0)
-                    || (obj.second->getDataType() == SHADER_DATA &&
+            if ((objData->getDataType() == PROGRAM_DATA && pass == 0)
+                    || (objData->getDataType() == SHADER_DATA &&
                             pass == 1)) {
-                continue;
+                return;
             }
-            genName(obj.second->getGenNameInfo(), obj.first, false);
-            obj.second->restore(obj.first, getGlobalName);
-        }
+            genName(objData->getGenNameInfo(), localName, false);
+            objData->restore(localName, getGlobalName);
+        });
     }
 }
 
@@ -148,17 +151,19 @@ void NameSpace::preSave(GlobalNameSpace *globalNameSpace) {
     // TODO: skip restoration and write saveableTexture directly to the new
     // snapshot
     touchTextures();
-    for (const auto& obj : m_objectDataMap) {
-        globalNameSpace->preSaveAddTex((TextureData*)obj.second.get());
-    }
+    m_objectDataMap.forEach([globalNameSpace](ObjectLocalName,
+                                              const ObjectDataPtr& objData) {
+        globalNameSpace->preSaveAddTex((TextureData*)objData.get());
+    });
 }
 
 void NameSpace::onSave(android::base::Stream* stream) {
     stream->putBe32(m_objectDataMap.size());
-    for (const auto& obj : m_objectDataMap) {
-        stream->putBe64(obj.first);
-        obj.second->onSave(stream, getGlobalName(obj.first));
-    }
+    m_objectDataMap.forEach([this, stream](ObjectLocalName localName,
+                                           const ObjectDataPtr& objData) {
+        stream->putBe64(localName);
+        objData->onSave(stream, getGlobalName(localName));
+    });
 }
 
 ObjectLocalName
@@ -169,16 +174,13 @@ NameSpace::genName(GenNameInfo genNameInfo, ObjectLocalName p_localName, bool ge
     if (genLocal) {
         do {
             localName = ++m_nextName;
-        } while(localName == 0 ||
-                m_localToGlobalMap.find(localName) !=
-                        m_localToGlobalMap.end() );
+        } while(localName == 0 || m_localToGlobalMap.contains(localName));
     }
 
-    auto it = m_localToGlobalMap.emplace(localName,
-                                         NamedObjectPtr(
-                                            new NamedObject(genNameInfo,
-                                                    m_globalNameSpace))).first;
-    unsigned int globalName = it->second->getGlobalName();
+    const NamedObjectPtr& namedObject = m_localToGlobalMap.emplace(
+            localName,
+            NamedObjectPtr(new NamedObject(genNameInfo, m_globalNameSpace)));
+    unsigned int globalName = namedObject->getGlobalName();
     m_globalToLocalMap[globalName] = localName;
 
     return localName;
@@ -188,10 +190,9 @@ NameSpace::genName(GenNameInfo genNameInfo, ObjectLocalName p_localName, bool ge
 unsigned int
 NameSpace::getGlobalName(ObjectLocalName p_localName)
 {
-    NamesMap::iterator n( m_localToGlobalMap.find(p_localName) );
-    if (n != m_localToGlobalMap.end()) {
+    if (const NamedObjectPtr* n = m_localToGlobalMap.find(p_localName)) {
         // object found - return its global name map
-        return (*n).second->getGlobalName();
+        return (*n)->getGlobalName();
     }
 
     // object does not exist;
@@ -210,9 +211,8 @@ NameSpace::getLocalName(unsigned int p_globalName)
 }
 
 NamedObjectPtr NameSpace::getNamedObject(ObjectLocalName p_localName) {
-    auto it = m_localToGlobalMap.find(p_localName);
-    if (it != m_localToGlobalMap.end()) {
-        return it->second;
+    if (const NamedObjectPtr* n = m_localToGlobalMap.find(p_localName)) {
+        return *n;
     }
 
     return nullptr;
@@ -221,10 +221,9 @@ NamedObjectPtr NameSpace::getNamedObject(ObjectLocalName p_localName) {
 void
 NameSpace::deleteName(ObjectLocalName p_localName)
 {
-    NamesMap::iterator n( m_localToGlobalMap.find(p_localName) );
-    if (n != m_localToGlobalMap.end()) {
-        m_globalToLocalMap.erase(n->second->getGlobalName());
-        m_localToGlobalMap.erase(n);
+    if (const NamedObjectPtr* n = m_localToGlobalMap.find(p_localName)) {
+        m_globalToLocalMap.erase((*n)->getGlobalName());
+        m_localToGlobalMap.erase(p_localName);
     }
     m_objectDataMap.erase(p_localName);
 }
@@ -232,16 +231,15 @@ NameSpace::deleteName(ObjectLocalName p_localName)
 bool
 NameSpace::isObject(ObjectLocalName p_localName)
 {
-    return (m_localToGlobalMap.find(p_localName) != m_localToGlobalMap.end() );
+    return m_localToGlobalMap.contains(p_localName);
 }
 
 void
 NameSpace::setGlobalObject(ObjectLocalName p_localName,
                                NamedObjectPtr p_namedObject) {
-    NamesMap::iterator n(m_localToGlobalMap.find(p_localName));
-    if (n != m_localToGlobalMap.end()) {
-        m_globalToLocalMap.erase(n->second->getGlobalName());
-        (*n).second = p_namedObject;
+    if (NamedObjectPtr* n = m_localToGlobalMap.find(p_localName)) {
+        m_globalToLocalMap.erase((*n)->getGlobalName());
+        *n = p_namedObject;
     } else {
         m_localToGlobalMap.emplace(p_localName, p_namedObject);
     }
@@ -252,29 +250,19 @@ void
 NameSpace::replaceGlobalObject(ObjectLocalName p_localName,
                                NamedObjectPtr p_namedObject)
 {
-    NamesMap::iterator n( m_localToGlobalMap.find(p_localName) );
-    if (n != m_localToGlobalMap.end()) {
-        m_globalToLocalMap.erase(n->second->getGlobalName());
-        (*n).second = p_namedObject;
+    if (NamedObjectPtr* n = m_localToGlobalMap.find(p_localName)) {
+        m_globalToLocalMap.erase((*n)->getGlobalName());
+        *n = p_namedObject;
         m_globalToLocalMap.emplace(p_namedObject->getGlobalName(), p_localName);
     }
 }
 
-ObjectDataMap::const_iterator NameSpace::objDataMapBegin() const {
-    return m_objectDataMap.begin();
-}
-
-ObjectDataMap::const_iterator NameSpace::objDataMapEnd() const {
-    return m_objectDataMap.end();
-}
-
 static android::base::LazyInstance<ObjectDataPtr> nullObjectData = {};
 
 const ObjectDataPtr& NameSpace::getObjectDataPtr(
         ObjectLocalName p_localName) {
-    const auto it = m_objectDataMap.find(p_localName);
-    if (it != m_objectDataMap.end()) {
-        return it->second;
+    if (const ObjectDataPtr* data = m_objectDataMap.find(p_localName)) {
+        return *data;
     }
     return *nullObjectData;
 }
@@ -95,12 +95,11 @@ void ShareGroup::postSave(android::base::Stream* stream) {
     // We need to mark the textures dirty, for those that has been bound to
     // a potential render target.
     NameSpace* renderbufferNs = m_nameSpace[(int)NamedObjectType::RENDERBUFFER];
-    for (ObjectDataMap::const_iterator it = renderbufferNs->objDataMapBegin();
-        it != renderbufferNs->objDataMapEnd();
-        it ++) {
-        RenderbufferData* rbData = (RenderbufferData*)it->second.get();
+    renderbufferNs->forEachObjectData([](ObjectLocalName,
+                                         const ObjectDataPtr& objData) {
+        RenderbufferData* rbData = (RenderbufferData*)objData.get();
         rbData->makeTextureDirty();
-    }
+    });
 }
 
 void ShareGroup::postLoadRestore() {
@@ -22,10 +22,23 @@
 #include <memory>
 
 #include "android/base/AlignedBuf.h"
+#include "android/base/memory/LazyInstance.h"
+#include "android/base/synchronization/ConditionVariable.h"
+#include "android/base/synchronization/Lock.h"
+#include "android/base/system/System.h"
+#include "android/base/threads/ThreadPool.h"
 
 #include <astc-codec/astc-codec.h>
 
+#include <algorithm>
+
 using android::AlignedBuf;
+using android::base::AutoLock;
+using android::base::ConditionVariable;
+using android::base::LazyInstance;
+using android::base::Lock;
+using android::base::System;
+using android::base::ThreadPool;
 
 #define GL_R16 0x822A
 #define GL_RG16 0x822C
@@ -167,6 +180,35 @@ void getAstcFormatInfo(GLenum internalformat,
     }
 }
 
+static void getAstcBlockSize(astc_codec::FootprintType footprint,
+                             int* blockWidth, int* blockHeight) {
+    switch (footprint) {
+#define ASTC_FOOTPRINT(w, h) \
+        case astc_codec::FootprintType::k##w##x##h: \
+            *blockWidth = w; *blockHeight = h; break;
+
+        ASTC_FOOTPRINT(4, 4)
+        ASTC_FOOTPRINT(5, 4)
+        ASTC_FOOTPRINT(5, 5)
+        ASTC_FOOTPRINT(6, 5)
+        ASTC_FOOTPRINT(6, 6)
+        ASTC_FOOTPRINT(8, 5)
+        ASTC_FOOTPRINT(8, 6)
+        ASTC_FOOTPRINT(8, 8)
+        ASTC_FOOTPRINT(10, 5)
+        ASTC_FOOTPRINT(10, 6)
+        ASTC_FOOTPRINT(10, 8)
+        ASTC_FOOTPRINT(10, 10)
+        ASTC_FOOTPRINT(12, 10)
+        ASTC_FOOTPRINT(12, 12)
+#undef ASTC_FOOTPRINT
+        default:
+            assert(false && "Invalid ASTC footprint");
+            *blockWidth = *blockHeight = 0;
+            break;
+    }
+}
+
 void getAstcFormats(const GLint** formats, size_t* formatsCount) {
     static constexpr GLint kATSCFormats[] = {
 #define ASTC_FORMAT(typeName, footprintType, srgbValue) \
@@ -274,6 +316,126 @@ GLenum decompressedInternalFormat(GLEScontext* ctx, GLenum compressedFormat) {
     }
 }
 
+// Compressed texture decoding runs on at most this many extra threads, and
+// doesn't bother them for less than |kMinDecodeBandSize| decoded bytes each.
+static constexpr int kMaxDecodeThreads = 4;
+static constexpr size_t kMinDecodeBandSize = 256 * 1024;
+
+namespace {
+
+// Software decoding of compressed textures is split in bands of block rows
+// that run on a few shared worker threads, with the calling thread taking
+// the first band. Games upload hundreds of megabytes of these at level load,
+// all from a single render thread.
+class TextureDecodePool {
+public:
+    // Decode |count| block rows starting at |first|, return false on error.
+    using DecodeRows = std::function<bool(size_t first, size_t count)>;
+
+    TextureDecodePool()
+        : mPool(std::min(System::get()->getCpuCoreCount(),
+                         kMaxDecodeThreads),
+                [](Task&& task) { task(); }) {
+        mPool.start();
+    }
+
+    // Decode |rows| block rows of |decodedRowSize| bytes each, in parallel
+    // when the image is large enough. Returns false if any band failed.
+    bool decode(size_t rows, size_t decodedRowSize,
+                const DecodeRows& decodeRows) {
+        const size_t bands = std::min(
+                {rows, (size_t)mPool.numWorkers() + 1,
+                 rows * decodedRowSize / kMinDecodeBandSize});
+        if (bands < 2) {
+            return decodeRows(0, rows);
+        }
+
+        const size_t rowsPerBand = (rows + bands - 1) / bands;
+        struct {
+            Lock lock;
+            ConditionVariable cv;
+            size_t pending;
+            bool ok = true;
+        } state;
+        state.pending = (rows - 1) / rowsPerBand;
+        for (size_t first = rowsPerBand; first < rows; first += rowsPerBand) {
+            const size_t count = std::min(rowsPerBand, rows - first);
+            mPool.enqueue([&state, &decodeRows, first, count]() {
+                const bool ok = decodeRows(first, count);
+                // Signal with the lock held: |state| is gone as soon as the
+                // caller sees |pending| reach 0.
+                AutoLock lock(state.lock);
+                state.ok &= ok;
+                if (--state.pending == 0) {
+                    state.cv.signal();
+                }
+            });
+        }
+
+        const bool ok = decodeRows(0, rowsPerBand);
+        AutoLock lock(state.lock);
+        state.cv.wait(&lock, [&state]() { return state.pending == 0; });
+        return ok && state.ok;
+    }
+
+private:
+    using Task = std::function<void()>;
+
+    ThreadPool<Task> mPool;
+};
+
+}  // namespace
+
+static LazyInstance<TextureDecodePool> sDecodePool = LAZY_INSTANCE_INIT;
+
+int etcDecodeImage(const etc1_byte* pIn, ETC2ImageFormat format,
+                   etc1_byte* pOut, etc1_uint32 width, etc1_uint32 height,
+                   etc1_uint32 stride) {
+    const size_t encodedRowSize = etc_get_encoded_data_size(format, width, 4);
+    const size_t rows = (height + 3) / 4;
+    const bool ok = sDecodePool->decode(
+            rows, stride * 4,
+            [=](size_t first, size_t count) {
+                const etc1_uint32 y = first * 4;
+                return etc2_decode_image(pIn + first * encodedRowSize, format,
+                                         pOut + y * stride, width,
+                                         std::min<etc1_uint32>(count * 4,
+                                                               height - y),
+                                         stride) == 0;
+            });
+    return ok ? 0 : -1;
+}
+
+static bool astcDecodeImage(const uint8_t* data, size_t dataSize,
+                            astc_codec::FootprintType footprint, int width,
+                            int height, uint8_t* out, size_t outSize,
+                            size_t stride) {
+    int blockWidth, blockHeight;
+    getAstcBlockSize(footprint, &blockWidth, &blockHeight);
+    static constexpr size_t kAstcBlockSize = 16;
+    const size_t encodedRowSize =
+            (width + blockWidth - 1) / blockWidth * kAstcBlockSize;
+    const size_t rows = (height + blockHeight - 1) / blockHeight;
+    if (!blockHeight || dataSize != rows * encodedRowSize) {
+        // Let the decoder report the error.
+        return astc_codec::ASTCDecompressToRGBA(data, dataSize, width, height,
+                                                footprint, out, outSize,
+                                                stride);
+    }
+
+    return sDecodePool->decode(
+            rows, stride * blockHeight,
+            [=](size_t first, size_t count) {
+                const size_t y = first * blockHeight;
+                const size_t bandHeight =
+                        std::min<size_t>(count * blockHeight, height - y);
+                return astc_codec::ASTCDecompressToRGBA(
+                        data + first * encodedRowSize, count * encodedRowSize,
+                        width, bandHeight, footprint, out + y * stride,
+                        bandHeight * stride, stride);
+            });
+}
+
 void doCompressedTexImage2D(GLEScontext* ctx, GLenum target, GLint level,
                             GLenum internalformat, GLsizei width,
                             GLsizei height, GLint border,
@@ -357,7 +519,7 @@ void doCompressedTexImage2D(GLEScontext* ctx, GLenum target, GLint level,
         std::unique_ptr<etc1_byte[]> pOut(new etc1_byte[size]);
 
         int res =
-            etc2_decode_image(
+            etcDecodeImage(
                     (const etc1_byte*)data, etcFormat, pOut.get(),
                     width, height, bpr);
         SET_ERROR_IF(res!=0, GL_INVALID_VALUE);
@@ -379,10 +541,9 @@ void doCompressedTexImage2D(GLEScontext* ctx, GLenum target, GLint level,
 
         AlignedBuf<uint8_t, 64> alignedUncompressedData(size);
 
-        const bool result = astc_codec::ASTCDecompressToRGBA(
-                reinterpret_cast<const uint8_t*>(data), imageSize, width,
-                height, footprint, alignedUncompressedData.data(), size,
-                stride);
+        const bool result = astcDecodeImage(
+                reinterpret_cast<const uint8_t*>(data), imageSize, footprint,
+                width, height, alignedUncompressedData.data(), size, stride);
         SET_ERROR_IF(!result, GL_INVALID_VALUE);
 
         glTexImage2DPtr(target, level, srgb ? GL_SRGB8_ALPHA8 : GL_RGBA8, width,
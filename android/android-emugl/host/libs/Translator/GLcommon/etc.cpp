@@ -15,11 +15,22 @@
 #include <GLcommon/etc.h>
 
 #include <algorithm>
+#include <atomic>
 #include <assert.h>
 #include <string.h>
 #include <stdint.h>
 #include <stdio.h>
 
+// The block decoders have SSE4.1 and AVX2 versions on x86, which are picked
+// at runtime from what the CPU supports.
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define ETC_X86_SIMD 1
+#define ETC_TARGET(isa) __attribute__((target(isa)))
+#include <immintrin.h>
+#else
+#define ETC_X86_SIMD 0
+#endif
+
 typedef uint16_t etc1_uint16;
 
 /* From http://www.khronos.org/registry/gles/extensions/OES/OES_compressed_ETC1_RGB8_texture.txt
@@ -386,12 +397,23 @@ static void etc2_decode_block_P(etc1_uint32 high, etc1_uint32 low,
 //     from https://www.khronos.org/registry/gles/specs/3.0/es_spec_3.0.4.pdf
 //     page 289
 
-void etc2_decode_rgb_block(const etc1_byte* pIn, bool isPunchthroughAlpha,
-                           etc1_byte* pOut) {
-    etc1_uint32 high = (pIn[0] << 24) | (pIn[1] << 16) | (pIn[2] << 8) | pIn[3];
-    etc1_uint32 low = (pIn[4] << 24) | (pIn[5] << 16) | (pIn[6] << 8) | pIn[7];
+// Base colors and modifier tables of the two subblocks of an individual or
+// differential block.
+typedef struct {
+    int r1, g1, b1;
+    int r2, g2, b2;
+    const int* tableA;
+    const int* tableB;
+    bool flipped;
+    bool opaque;
+} etc2_subblocks;
+
+// Reads the header of an ETC2 RGB block. T, H and planar blocks are decoded
+// into |pOut| right away, and false is returned for them.
+static bool etc2_read_subblocks(etc1_uint32 high, etc1_uint32 low,
+                                bool isPunchthroughAlpha, etc1_byte* pOut,
+                                etc2_subblocks* s) {
     bool opaque = (high >> 1) & 1;
-    int r1, r2, g1, g2, b1, b2;
     if (isPunchthroughAlpha || high & 2) {
         // differential
         int rBase = high >> 27;
@@ -399,47 +421,61 @@ void etc2_decode_rgb_block(const etc1_byte* pIn, bool isPunchthroughAlpha,
         int bBase = high >> 11;
         if (isOverflowed(rBase, high >> 24)) {
             etc2_decode_block_T(high, low, isPunchthroughAlpha, opaque, pOut);
-            return;
+            return false;
         }
         if (isOverflowed(gBase, high >> 16)) {
             etc2_decode_block_H(high, low, isPunchthroughAlpha, opaque, pOut);
-            return;
+            return false;
         }
         if (isOverflowed(bBase, high >> 8)) {
             etc2_decode_block_P(high, low, isPunchthroughAlpha, pOut);
-            return;
+            return false;
         }
-        r1 = convert5To8(rBase);
-        r2 = convertDiff(rBase, high >> 24);
-        g1 = convert5To8(gBase);
-        g2 = convertDiff(gBase, high >> 16);
-        b1 = convert5To8(bBase);
-        b2 = convertDiff(bBase, high >> 8);
+        s->r1 = convert5To8(rBase);
+        s->r2 = convertDiff(rBase, high >> 24);
+        s->g1 = convert5To8(gBase);
+        s->g2 = convertDiff(gBase, high >> 16);
+        s->b1 = convert5To8(bBase);
+        s->b2 = convertDiff(bBase, high >> 8);
     } else {
         // not differential
-        r1 = convert4To8(high >> 28);
-        r2 = convert4To8(high >> 24);
-        g1 = convert4To8(high >> 20);
-        g2 = convert4To8(high >> 16);
-        b1 = convert4To8(high >> 12);
-        b2 = convert4To8(high >> 8);
+        s->r1 = convert4To8(high >> 28);
+        s->r2 = convert4To8(high >> 24);
+        s->g1 = convert4To8(high >> 20);
+        s->g2 = convert4To8(high >> 16);
+        s->b1 = convert4To8(high >> 12);
+        s->b2 = convert4To8(high >> 8);
     }
     int tableIndexA = 7 & (high >> 5);
     int tableIndexB = 7 & (high >> 2);
     const int* rgbModifierTable = opaque || !isPunchthroughAlpha ?
                                   kRGBModifierTable : kRGBOpaqueModifierTable;
-    const int* tableA = rgbModifierTable + tableIndexA * 4;
-    const int* tableB = rgbModifierTable + tableIndexB * 4;
-    bool flipped = (high & 1) != 0;
-    decode_subblock(pOut, r1, g1, b1, tableA, low, false, flipped,
-                    isPunchthroughAlpha, opaque);
-    decode_subblock(pOut, r2, g2, b2, tableB, low, true, flipped,
-                    isPunchthroughAlpha, opaque);
+    s->tableA = rgbModifierTable + tableIndexA * 4;
+    s->tableB = rgbModifierTable + tableIndexB * 4;
+    s->flipped = (high & 1) != 0;
+    s->opaque = opaque;
+    return true;
 }
 
-void eac_decode_single_channel_block(const etc1_byte* pIn,
-                                     int decodedElementBytes, bool isSigned,
-                                     etc1_byte* pOut) {
+static void etc2_decode_rgb_block_scalar(const etc1_byte* pIn,
+                                         bool isPunchthroughAlpha,
+                                         etc1_byte* pOut) {
+    etc1_uint32 high = (pIn[0] << 24) | (pIn[1] << 16) | (pIn[2] << 8) | pIn[3];
+    etc1_uint32 low = (pIn[4] << 24) | (pIn[5] << 16) | (pIn[6] << 8) | pIn[7];
+    etc2_subblocks s;
+    if (!etc2_read_subblocks(high, low, isPunchthroughAlpha, pOut, &s)) {
+        return;
+    }
+    decode_subblock(pOut, s.r1, s.g1, s.b1, s.tableA, low, false, s.flipped,
+                    isPunchthroughAlpha, s.opaque);
+    decode_subblock(pOut, s.r2, s.g2, s.b2, s.tableB, low, true, s.flipped,
+                    isPunchthroughAlpha, s.opaque);
+}
+
+static void eac_decode_single_channel_block_scalar(const etc1_byte* pIn,
+                                                   int decodedElementBytes,
+                                                   bool isSigned,
+                                                   etc1_byte* pOut) {
     assert(decodedElementBytes == 1 || decodedElementBytes == 2 || decodedElementBytes == 4);
     int base_codeword = isSigned ? reinterpret_cast<const char*>(pIn)[0]
                                  : pIn[0];
@@ -447,29 +483,19 @@ void eac_decode_single_channel_block(const etc1_byte* pIn,
     int multiplier = pIn[1] >> 4;
     int tblIdx = pIn[1] & 15;
     const int* table = kAlphaModifierTable + tblIdx * 8;
-    const etc1_byte* p = pIn + 2;
-    // position in a byte of the next 3-bit index:
+    // The remaining 48 bits are the 3-bit indices, most significant first:
     // | a a a | b b b | c c c | d d d ...
     // | byte               | byte...
-    int bitOffset = 5;
+    uint64_t indices = 0;
+    for (int i = 2; i < 8; i++) {
+        indices = (indices << 8) | pIn[i];
+    }
     for (int i = 0; i < 16; i ++) {
         // flip x, y in output
         int outIdx = (i % 4) * 4 + i / 4;
         etc1_byte* q = pOut + outIdx * decodedElementBytes;
 
-        int modifier = 0;
-        if (bitOffset < 0) { // (Part of) the index is in the next byte.
-            modifier += ((int*)p)[0] << (-bitOffset);
-            p ++;
-            bitOffset += 8;
-        }
-        modifier += p[0] >> bitOffset;
-        modifier &= 7;
-        bitOffset -= 3; // move to the next index
-        if (bitOffset == -3) {
-            bitOffset = 5;
-            p++;
-        }
+        int modifier = (indices >> (45 - 3 * i)) & 7;
         int modifierValue = table[modifier];
         int decoded = base_codeword + modifierValue * multiplier;
         if (decodedElementBytes == 1) {
@@ -491,6 +517,434 @@ void eac_decode_single_channel_block(const etc1_byte* pIn,
     }
 }
 
+#if ETC_X86_SIMD
+
+// Returns the modifier index of each pixel of an individual or differential
+// block, in output order (x + 4 * y), with 4 added in the second subblock.
+// |transparent| is set to 0xff for the pixels that punchthrough alpha makes
+// transparent, when the block isn't opaque.
+ETC_TARGET("sse4.1")
+static inline __m128i etc2_subblock_indices(etc1_uint32 low, bool flipped,
+                                            __m128i* transparent) {
+    // The lsb of pixel (x, y) is bit y + 4 * x of |low|, and its msb the
+    // same bit of the upper 16 bits.
+    const __m128i bits = _mm_cvtsi32_si128(low);
+    const __m128i bit = _mm_setr_epi8(1, 16, 1, 16, 2, 32, 2, 32,
+                                      4, 64, 4, 64, 8, -128, 8, -128);
+    __m128i lsb = _mm_shuffle_epi8(bits, _mm_setr_epi8(0, 0, 1, 1, 0, 0, 1, 1,
+                                                       0, 0, 1, 1, 0, 0, 1, 1));
+    __m128i msb = _mm_shuffle_epi8(bits, _mm_setr_epi8(2, 2, 3, 3, 2, 2, 3, 3,
+                                                       2, 2, 3, 3, 2, 2, 3, 3));
+    lsb = _mm_cmpeq_epi8(_mm_and_si128(lsb, bit), bit);
+    msb = _mm_cmpeq_epi8(_mm_and_si128(msb, bit), bit);
+    *transparent = _mm_andnot_si128(lsb, msb);
+    __m128i index = _mm_or_si128(_mm_and_si128(lsb, _mm_set1_epi8(1)),
+                                 _mm_and_si128(msb, _mm_set1_epi8(2)));
+    const __m128i second = flipped
+            ? _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4)
+            : _mm_setr_epi8(0, 0, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4);
+    return _mm_or_si128(index, second);
+}
+
+// Returns the modifiers of both subblocks as bytes: the positive parts of
+// the 8 modifiers first, then their negated negative parts. Modifiers are at
+// most 183 in magnitude, so adding one part to a color and subtracting the
+// other with unsigned saturation clamps the result like clamp() does.
+ETC_TARGET("sse4.1")
+static inline __m128i etc2_modifier_parts(const etc2_subblocks& s) {
+    const __m128i modifiers = _mm_packs_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.tableA)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.tableB)));
+    return _mm_packus_epi16(modifiers,
+                            _mm_sub_epi16(_mm_setzero_si128(), modifiers));
+}
+
+static inline int etc2_subblock_color(int r, int g, int b) {
+    return static_cast<int>(r | g << 8 | b << 16 | 0xffu << 24);
+}
+
+// Stores 4 rows of RGBX pixels as 48 bytes of RGB.
+ETC_TARGET("sse4.1")
+static inline void etc2_store_rgb_rows(__m128i row0, __m128i row1,
+                                       __m128i row2, __m128i row3,
+                                       etc1_byte* pOut) {
+    const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14,
+                                       -1, -1, -1, -1);
+    row0 = _mm_shuffle_epi8(row0, pack);
+    row1 = _mm_shuffle_epi8(row1, pack);
+    row2 = _mm_shuffle_epi8(row2, pack);
+    row3 = _mm_shuffle_epi8(row3, pack);
+    __m128i* out = reinterpret_cast<__m128i*>(pOut);
+    _mm_storeu_si128(out, _mm_or_si128(row0, _mm_slli_si128(row1, 12)));
+    _mm_storeu_si128(out + 1, _mm_or_si128(_mm_srli_si128(row1, 4),
+                                           _mm_slli_si128(row2, 8)));
+    _mm_storeu_si128(out + 2, _mm_or_si128(_mm_srli_si128(row2, 8),
+                                           _mm_slli_si128(row3, 4)));
+}
+
+// The SIMD RGB decoders only handle individual and differential blocks, which
+// make up most of a typical texture; the rest go to the scalar code.
+ETC_TARGET("sse4.1")
+static void etc2_decode_rgb_block_sse41(const etc1_byte* pIn,
+                                        bool isPunchthroughAlpha,
+                                        etc1_byte* pOut) {
+    etc1_uint32 high = (pIn[0] << 24) | (pIn[1] << 16) | (pIn[2] << 8) | pIn[3];
+    etc1_uint32 low = (pIn[4] << 24) | (pIn[5] << 16) | (pIn[6] << 8) | pIn[7];
+    etc2_subblocks s;
+    if (!etc2_read_subblocks(high, low, isPunchthroughAlpha, pOut, &s)) {
+        return;
+    }
+    __m128i transparent;
+    const __m128i index = etc2_subblock_indices(low, s.flipped, &transparent);
+    const __m128i parts = etc2_modifier_parts(s);
+    const __m128i add = _mm_shuffle_epi8(parts, index);
+    const __m128i sub = _mm_shuffle_epi8(parts,
+                                         _mm_add_epi8(index, _mm_set1_epi8(8)));
+    const bool hasTransparent = isPunchthroughAlpha && !s.opaque;
+    const int colorA = etc2_subblock_color(s.r1, s.g1, s.b1);
+    const int colorB = etc2_subblock_color(s.r2, s.g2, s.b2);
+
+    __m128i rows[4];
+    for (int y = 0; y < 4; y++) {
+        const __m128i base = s.flipped
+                ? _mm_set1_epi32(y < 2 ? colorA : colorB)
+                : _mm_setr_epi32(colorA, colorA, colorB, colorB);
+        // Copies the byte of each pixel of row y to its r, g and b.
+        const __m128i spread = _mm_add_epi8(
+                _mm_setr_epi8(0, 0, 0, -128, 1, 1, 1, -128,
+                              2, 2, 2, -128, 3, 3, 3, -128),
+                _mm_set1_epi8(4 * y));
+        __m128i row = _mm_adds_epu8(base, _mm_shuffle_epi8(add, spread));
+        row = _mm_subs_epu8(row, _mm_shuffle_epi8(sub, spread));
+        if (hasTransparent) {
+            const __m128i pixels = _mm_add_epi8(
+                    _mm_setr_epi8(0, 0, 0, 0, 1, 1, 1, 1,
+                                  2, 2, 2, 2, 3, 3, 3, 3),
+                    _mm_set1_epi8(4 * y));
+            row = _mm_andnot_si128(_mm_shuffle_epi8(transparent, pixels), row);
+        }
+        rows[y] = row;
+    }
+    if (isPunchthroughAlpha) {
+        __m128i* out = reinterpret_cast<__m128i*>(pOut);
+        for (int y = 0; y < 4; y++) {
+            _mm_storeu_si128(out + y, rows[y]);
+        }
+    } else {
+        etc2_store_rgb_rows(rows[0], rows[1], rows[2], rows[3], pOut);
+    }
+}
+
+// Same as above, two rows at a time.
+ETC_TARGET("avx2")
+static void etc2_decode_rgb_block_avx2(const etc1_byte* pIn,
+                                       bool isPunchthroughAlpha,
+                                       etc1_byte* pOut) {
+    etc1_uint32 high = (pIn[0] << 24) | (pIn[1] << 16) | (pIn[2] << 8) | pIn[3];
+    etc1_uint32 low = (pIn[4] << 24) | (pIn[5] << 16) | (pIn[6] << 8) | pIn[7];
+    etc2_subblocks s;
+    if (!etc2_read_subblocks(high, low, isPunchthroughAlpha, pOut, &s)) {
+        return;
+    }
+    __m128i transparent;
+    const __m128i index = etc2_subblock_indices(low, s.flipped, &transparent);
+    const __m128i parts = etc2_modifier_parts(s);
+    const __m256i add = _mm256_broadcastsi128_si256(
+            _mm_shuffle_epi8(parts, index));
+    const __m256i sub = _mm256_broadcastsi128_si256(_mm_shuffle_epi8(
+            parts, _mm_add_epi8(index, _mm_set1_epi8(8))));
+    const int colorA = etc2_subblock_color(s.r1, s.g1, s.b1);
+    const int colorB = etc2_subblock_color(s.r2, s.g2, s.b2);
+
+    // Rows 0 and 1, then rows 2 and 3.
+    __m256i base0, base1;
+    if (s.flipped) {
+        base0 = _mm256_set1_epi32(colorA);
+        base1 = _mm256_set1_epi32(colorB);
+    } else {
+        base0 = _mm256_setr_epi32(colorA, colorA, colorB, colorB,
+                                  colorA, colorA, colorB, colorB);
+        base1 = base0;
+    }
+    const __m256i spread0 = _mm256_setr_epi8(
+            0, 0, 0, -128, 1, 1, 1, -128, 2, 2, 2, -128, 3, 3, 3, -128,
+            4, 4, 4, -128, 5, 5, 5, -128, 6, 6, 6, -128, 7, 7, 7, -128);
+    const __m256i spread1 = _mm256_add_epi8(spread0, _mm256_set1_epi8(8));
+    __m256i rows0 = _mm256_adds_epu8(base0, _mm256_shuffle_epi8(add, spread0));
+    rows0 = _mm256_subs_epu8(rows0, _mm256_shuffle_epi8(sub, spread0));
+    __m256i rows1 = _mm256_adds_epu8(base1, _mm256_shuffle_epi8(add, spread1));
+    rows1 = _mm256_subs_epu8(rows1, _mm256_shuffle_epi8(sub, spread1));
+    if (isPunchthroughAlpha && !s.opaque) {
+        const __m256i mask = _mm256_broadcastsi128_si256(transparent);
+        const __m256i pixels0 = _mm256_setr_epi8(
+                0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7);
+        const __m256i pixels1 = _mm256_add_epi8(pixels0, _mm256_set1_epi8(8));
+        rows0 = _mm256_andnot_si256(_mm256_shuffle_epi8(mask, pixels0), rows0);
+        rows1 = _mm256_andnot_si256(_mm256_shuffle_epi8(mask, pixels1), rows1);
+    }
+    if (isPunchthroughAlpha) {
+        __m256i* out = reinterpret_cast<__m256i*>(pOut);
+        _mm256_storeu_si256(out, rows0);
+        _mm256_storeu_si256(out + 1, rows1);
+    } else {
+        etc2_store_rgb_rows(_mm256_castsi256_si128(rows0),
+                            _mm256_extracti128_si256(rows0, 1),
+                            _mm256_castsi256_si128(rows1),
+                            _mm256_extracti128_si256(rows1, 1), pOut);
+    }
+}
+
+static inline int eac_base_codeword(const etc1_byte* pIn, bool isSigned) {
+    int base_codeword = isSigned ? reinterpret_cast<const char*>(pIn)[0]
+                                 : pIn[0];
+    return base_codeword == -128 ? -127 : base_codeword;
+}
+
+// The two halves of the 48 bits of indices, 8 pixels each.
+static inline int eac_indices_high(const etc1_byte* pIn) {
+    return pIn[2] << 16 | pIn[3] << 8 | pIn[4];
+}
+
+static inline int eac_indices_low(const etc1_byte* pIn) {
+    return pIn[5] << 16 | pIn[6] << 8 | pIn[7];
+}
+
+ETC_TARGET("sse4.1")
+static void eac_decode_single_channel_block_sse41(const etc1_byte* pIn,
+                                                  int decodedElementBytes,
+                                                  bool isSigned,
+                                                  etc1_byte* pOut) {
+    if (decodedElementBytes != 1 && decodedElementBytes != 4) {
+        eac_decode_single_channel_block_scalar(pIn, decodedElementBytes,
+                                               isSigned, pOut);
+        return;
+    }
+    const int base_codeword = eac_base_codeword(pIn, isSigned);
+    const int multiplier = pIn[1] >> 4;
+    const int* table = kAlphaModifierTable + (pIn[1] & 15) * 8;
+
+    // Pixel i of a half has its index in bits 21 - 3 * i to 23 - 3 * i. SSE
+    // has no per-lane shifts, so multiply to move them all to bits 21-23.
+    const __m128i high = _mm_set1_epi32(eac_indices_high(pIn));
+    const __m128i low = _mm_set1_epi32(eac_indices_low(pIn));
+    const __m128i scale0 = _mm_setr_epi32(1, 1 << 3, 1 << 6, 1 << 9);
+    const __m128i scale1 = _mm_setr_epi32(1 << 12, 1 << 15, 1 << 18, 1 << 21);
+    const __m128i seven = _mm_set1_epi16(7);
+    __m128i index = _mm_packus_epi16(
+            _mm_and_si128(_mm_packus_epi32(
+                    _mm_srli_epi32(_mm_mullo_epi32(high, scale0), 21),
+                    _mm_srli_epi32(_mm_mullo_epi32(high, scale1), 21)), seven),
+            _mm_and_si128(_mm_packus_epi32(
+                    _mm_srli_epi32(_mm_mullo_epi32(low, scale0), 21),
+                    _mm_srli_epi32(_mm_mullo_epi32(low, scale1), 21)), seven));
+    // flip x, y in output
+    index = _mm_shuffle_epi8(index, _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13,
+                                                  2, 6, 10, 14, 3, 7, 11, 15));
+
+    __m128i modifiers = _mm_packs_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 4)));
+    modifiers = _mm_shuffle_epi8(_mm_packs_epi16(modifiers, modifiers), index);
+    const __m128i modifiers0 = _mm_cvtepi8_epi16(modifiers);
+    const __m128i modifiers1 = _mm_cvtepi8_epi16(_mm_srli_si128(modifiers, 8));
+    // At most 255 + 15 * 15, times 8: 16 bits are enough.
+    const __m128i base = _mm_set1_epi16(base_codeword);
+    const __m128i mult = _mm_set1_epi16(multiplier);
+    __m128i decoded0 = _mm_add_epi16(base, _mm_mullo_epi16(modifiers0, mult));
+    __m128i decoded1 = _mm_add_epi16(base, _mm_mullo_epi16(modifiers1, mult));
+    if (decodedElementBytes == 1) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pOut),
+                         _mm_packus_epi16(decoded0, decoded1));
+        return;
+    }
+
+    decoded0 = _mm_slli_epi16(decoded0, 3);
+    decoded1 = _mm_slli_epi16(decoded1, 3);
+    if (multiplier == 0) {
+        decoded0 = _mm_add_epi16(decoded0, modifiers0);
+        decoded1 = _mm_add_epi16(decoded1, modifiers1);
+    }
+    __m128 divisor;
+    if (isSigned) {
+        const __m128i lo = _mm_set1_epi16(-1023);
+        const __m128i hi = _mm_set1_epi16(1023);
+        decoded0 = _mm_min_epi16(_mm_max_epi16(decoded0, lo), hi);
+        decoded1 = _mm_min_epi16(_mm_max_epi16(decoded1, lo), hi);
+        divisor = _mm_set1_ps(1023.0f);
+    } else {
+        const __m128i four = _mm_set1_epi16(4);
+        const __m128i lo = _mm_setzero_si128();
+        const __m128i hi = _mm_set1_epi16(2047);
+        decoded0 = _mm_min_epi16(_mm_max_epi16(_mm_add_epi16(decoded0, four),
+                                               lo), hi);
+        decoded1 = _mm_min_epi16(_mm_max_epi16(_mm_add_epi16(decoded1, four),
+                                               lo), hi);
+        divisor = _mm_set1_ps(2047.0f);
+    }
+    // Single precision division rounds like the scalar code, which divides
+    // in double precision and then rounds to float.
+    float* out = reinterpret_cast<float*>(pOut);
+    _mm_storeu_ps(out, _mm_div_ps(_mm_cvtepi32_ps(
+            _mm_cvtepi16_epi32(decoded0)), divisor));
+    _mm_storeu_ps(out + 4, _mm_div_ps(_mm_cvtepi32_ps(
+            _mm_cvtepi16_epi32(_mm_srli_si128(decoded0, 8))), divisor));
+    _mm_storeu_ps(out + 8, _mm_div_ps(_mm_cvtepi32_ps(
+            _mm_cvtepi16_epi32(decoded1)), divisor));
+    _mm_storeu_ps(out + 12, _mm_div_ps(_mm_cvtepi32_ps(
+            _mm_cvtepi16_epi32(_mm_srli_si128(decoded1, 8))), divisor));
+}
+
+ETC_TARGET("avx2")
+static void eac_decode_single_channel_block_avx2(const etc1_byte* pIn,
+                                                 int decodedElementBytes,
+                                                 bool isSigned,
+                                                 etc1_byte* pOut) {
+    if (decodedElementBytes != 1 && decodedElementBytes != 4) {
+        eac_decode_single_channel_block_scalar(pIn, decodedElementBytes,
+                                               isSigned, pOut);
+        return;
+    }
+    const int base_codeword = eac_base_codeword(pIn, isSigned);
+    const int multiplier = pIn[1] >> 4;
+    const int* table = kAlphaModifierTable + (pIn[1] & 15) * 8;
+
+    // Output pixel o, which is flipped, is pixel (o % 4) * 4 + o / 4 of the
+    // block: shift each index down from its half.
+    const int high = eac_indices_high(pIn);
+    const int low = eac_indices_low(pIn);
+    const __m256i halves = _mm256_setr_epi32(high, high, low, low,
+                                             high, high, low, low);
+    const __m256i seven = _mm256_set1_epi32(7);
+    const __m256i index0 = _mm256_and_si256(_mm256_srlv_epi32(halves,
+            _mm256_setr_epi32(21, 9, 21, 9, 18, 6, 18, 6)), seven);
+    const __m256i index1 = _mm256_and_si256(_mm256_srlv_epi32(halves,
+            _mm256_setr_epi32(15, 3, 15, 3, 12, 0, 12, 0)), seven);
+
+    const __m256i row = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(table));
+    const __m256i modifiers0 = _mm256_permutevar8x32_epi32(row, index0);
+    const __m256i modifiers1 = _mm256_permutevar8x32_epi32(row, index1);
+    const __m256i base = _mm256_set1_epi32(base_codeword);
+    const __m256i mult = _mm256_set1_epi32(multiplier);
+    __m256i decoded0 = _mm256_add_epi32(base,
+                                        _mm256_mullo_epi32(modifiers0, mult));
+    __m256i decoded1 = _mm256_add_epi32(base,
+                                        _mm256_mullo_epi32(modifiers1, mult));
+    if (decodedElementBytes == 1) {
+        // packs works within each 128-bit lane; put the pixels back in order.
+        const __m256i packed = _mm256_permute4x64_epi64(
+                _mm256_packs_epi32(decoded0, decoded1), 0xd8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pOut),
+                         _mm_packus_epi16(_mm256_castsi256_si128(packed),
+                                          _mm256_extracti128_si256(packed, 1)));
+        return;
+    }
+
+    decoded0 = _mm256_slli_epi32(decoded0, 3);
+    decoded1 = _mm256_slli_epi32(decoded1, 3);
+    if (multiplier == 0) {
+        decoded0 = _mm256_add_epi32(decoded0, modifiers0);
+        decoded1 = _mm256_add_epi32(decoded1, modifiers1);
+    }
+    __m256 divisor;
+    if (isSigned) {
+        const __m256i lo = _mm256_set1_epi32(-1023);
+        const __m256i hi = _mm256_set1_epi32(1023);
+        decoded0 = _mm256_min_epi32(_mm256_max_epi32(decoded0, lo), hi);
+        decoded1 = _mm256_min_epi32(_mm256_max_epi32(decoded1, lo), hi);
+        divisor = _mm256_set1_ps(1023.0f);
+    } else {
+        const __m256i four = _mm256_set1_epi32(4);
+        const __m256i lo = _mm256_setzero_si256();
+        const __m256i hi = _mm256_set1_epi32(2047);
+        decoded0 = _mm256_min_epi32(_mm256_max_epi32(
+                _mm256_add_epi32(decoded0, four), lo), hi);
+        decoded1 = _mm256_min_epi32(_mm256_max_epi32(
+                _mm256_add_epi32(decoded1, four), lo), hi);
+        divisor = _mm256_set1_ps(2047.0f);
+    }
+    float* out = reinterpret_cast<float*>(pOut);
+    _mm256_storeu_ps(out, _mm256_div_ps(_mm256_cvtepi32_ps(decoded0), divisor));
+    _mm256_storeu_ps(out + 8,
+                     _mm256_div_ps(_mm256_cvtepi32_ps(decoded1), divisor));
+}
+
+#endif  // ETC_X86_SIMD
+
+typedef struct {
+    void (*rgb)(const etc1_byte* pIn, bool isPunchthroughAlpha,
+                etc1_byte* pOut);
+    void (*singleChannel)(const etc1_byte* pIn, int decodedElementBytes,
+                          bool isSigned, etc1_byte* pOut);
+} etc_block_decoders;
+
+// Indexed by EtcDecoderImpl.
+static const etc_block_decoders kBlockDecoders[] = {
+    { etc2_decode_rgb_block_scalar, eac_decode_single_channel_block_scalar },
+#if ETC_X86_SIMD
+    { etc2_decode_rgb_block_sse41, eac_decode_single_channel_block_sse41 },
+    { etc2_decode_rgb_block_avx2, eac_decode_single_channel_block_avx2 },
+#endif
+};
+
+static bool etc_decoder_impl_supported(EtcDecoderImpl impl) {
+    switch (impl) {
+        case EtcDecoderScalar:
+            return true;
+#if ETC_X86_SIMD
+        case EtcDecoderSse41:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse4.1");
+        case EtcDecoderAvx2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+static EtcDecoderImpl etc_best_decoder_impl() {
+    if (etc_decoder_impl_supported(EtcDecoderAvx2)) {
+        return EtcDecoderAvx2;
+    }
+    if (etc_decoder_impl_supported(EtcDecoderSse41)) {
+        return EtcDecoderSse41;
+    }
+    return EtcDecoderScalar;
+}
+
+static std::atomic<EtcDecoderImpl> sDecoderImpl(etc_best_decoder_impl());
+
+static const etc_block_decoders* etc_block_decoders_get() {
+    return &kBlockDecoders[sDecoderImpl.load(std::memory_order_relaxed)];
+}
+
+EtcDecoderImpl etc_get_decoder_impl() {
+    return sDecoderImpl.load(std::memory_order_relaxed);
+}
+
+etc1_bool etc_set_decoder_impl(EtcDecoderImpl impl) {
+    if (!etc_decoder_impl_supported(impl)) {
+        return false;
+    }
+    sDecoderImpl.store(impl, std::memory_order_relaxed);
+    return true;
+}
+
+void etc2_decode_rgb_block(const etc1_byte* pIn, bool isPunchthroughAlpha,
+                           etc1_byte* pOut) {
+    etc_block_decoders_get()->rgb(pIn, isPunchthroughAlpha, pOut);
+}
+
+void eac_decode_single_channel_block(const etc1_byte* pIn,
+                                     int decodedElementBytes, bool isSigned,
+                                     etc1_byte* pOut) {
+    etc_block_decoders_get()->singleChannel(pIn, decodedElementBytes, isSigned,
+                                            pOut);
+}
+
 typedef struct {
     etc1_uint32 high;
     etc1_uint32 low;
@@ -879,6 +1333,7 @@ int etc2_decode_image(const etc1_byte* pIn, ETC2ImageFormat format,
 
     int pixelSize = etc_get_decoded_pixel_size(format);
     bool isSigned = (format == EtcSignedR11 || format == EtcSignedRG11);
+    const etc_block_decoders* decoders = etc_block_decoders_get();
 
     for (etc1_uint32 y = 0; y < encodedHeight; y += 4) {
         etc1_uint32 yEnd = height - y;
@@ -892,30 +1347,30 @@ int etc2_decode_image(const etc1_byte* pIn, ETC2ImageFormat format,
             }
             switch (format) {
                 case EtcRGBA8:
-                    eac_decode_single_channel_block(pIn, 1, false, alphaBlock);
+                    decoders->singleChannel(pIn, 1, false, alphaBlock);
                     pIn += EAC_ENCODE_ALPHA_BLOCK_SIZE;
                     // Do not break
                     // Fall through to EtcRGB8 to decode the RGB part
                 case EtcRGB8:
-                    etc2_decode_rgb_block(pIn, false, block);
+                    decoders->rgb(pIn, false, block);
                     pIn += ETC1_ENCODED_BLOCK_SIZE;
                     break;
                 case EtcRGB8A1:
-                    etc2_decode_rgb_block(pIn, true, block);
+                    decoders->rgb(pIn, true, block);
                     pIn += ETC1_ENCODED_BLOCK_SIZE;
                     break;
                 case EtcR11:
                 case EtcSignedR11:
-                    eac_decode_single_channel_block(pIn, 4, isSigned, block);
+                    decoders->singleChannel(pIn, 4, isSigned, block);
                     pIn += EAC_ENCODE_R11_BLOCK_SIZE;
                     break;
                 case EtcRG11:
                 case EtcSignedRG11:
                     // r channel
-                    eac_decode_single_channel_block(pIn, 4, isSigned, block);
+                    decoders->singleChannel(pIn, 4, isSigned, block);
                     pIn += EAC_ENCODE_R11_BLOCK_SIZE;
                     // g channel
-                    eac_decode_single_channel_block(pIn, 4, isSigned,
+                    decoders->singleChannel(pIn, 4, isSigned,
                             block + EAC_DECODED_R11_BLOCK_SIZE);
                     pIn += EAC_ENCODE_R11_BLOCK_SIZE;
                     break;
@@ -0,0 +1,152 @@
+/*
+* Copyright (C) 2018 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+#pragma once
+
+#include "GLcommon/NamedObject.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <stddef.h>
+
+//
+// ObjectNameMap - maps guest object names to values of type T.
+//
+// Guest names are almost always small integers handed out in sequence, by
+// the guest driver or by NameSpace::genName(), and they are looked up on
+// nearly every decoded GL call. Those names index a vector directly; only
+// names far above the number of objects in the map go to a hash map.
+//
+// Values may move when a name is added, so don't keep pointers or
+// references to them across emplace() calls.
+//
+template <class T>
+class ObjectNameMap {
+public:
+    // Names below this always go to the vector.
+    static constexpr size_t kMinDenseSize = 1024;
+    // Names at or above this always go to the hash map.
+    static constexpr size_t kMaxDenseSize = 1 << 20;
+
+    // Returns the value of |name|, or nullptr if there is none.
+    T* find(ObjectLocalName name) {
+        if (name < mDense.size()) {
+            Slot& slot = mDense[name];
+            return slot.used ? &slot.value : nullptr;
+        }
+        if (mSparse.empty()) {
+            return nullptr;
+        }
+        const auto it = mSparse.find(name);
+        return it != mSparse.end() ? &it->second : nullptr;
+    }
+
+    const T* find(ObjectLocalName name) const {
+        return const_cast<ObjectNameMap*>(this)->find(name);
+    }
+
+    bool contains(ObjectLocalName name) const { return find(name) != nullptr; }
+
+    // Adds |value| for |name| unless it already has one, like
+    // std::unordered_map::emplace(). Returns the value of |name|.
+    T& emplace(ObjectLocalName name, T value) {
+        if (T* existing = find(name)) {
+            return *existing;
+        }
+        ++mSize;
+        if (name >= mDense.size() && name < kMaxDenseSize &&
+            name < std::max(kMinDenseSize, 4 * mSize)) {
+            grow(name);
+        }
+        if (name < mDense.size()) {
+            Slot& slot = mDense[name];
+            slot.value = std::move(value);
+            slot.used = true;
+            return slot.value;
+        }
+        return mSparse.emplace(name, std::move(value)).first->second;
+    }
+
+    // Removes the value of |name|. Returns false if there was none.
+    bool erase(ObjectLocalName name) {
+        if (name < mDense.size()) {
+            Slot& slot = mDense[name];
+            if (!slot.used) {
+                return false;
+            }
+            slot.value = T();
+            slot.used = false;
+        } else if (!mSparse.erase(name)) {
+            return false;
+        }
+        --mSize;
+        return true;
+    }
+
+    size_t size() const { return mSize; }
+    bool empty() const { return mSize == 0; }
+
+    // Calls |func(name, value)| for each value, in no particular order.
+    // |func| must not add or remove names.
+    template <class Func>
+    void forEach(Func&& func) const {
+        for (size_t name = 0; name < mDense.size(); ++name) {
+            if (mDense[name].used) {
+                func((ObjectLocalName)name, mDense[name].value);
+            }
+        }
+        for (const auto& it : mSparse) {
+            func(it.first, it.second);
+        }
+    }
+
+private:
+    struct Slot {
+        T value = T();
+        bool used = false;
+    };
+
+    // Makes the vector big enough for |name|, and moves the hash map
+    // entries it now covers into it: a name below mDense.size() is never
+    // looked up in mSparse.
+    void grow(ObjectLocalName name) {
+        const size_t newSize =
+                std::min(kMaxDenseSize,
+                         std::max((size_t)name + 1, 2 * mDense.size()));
+        mDense.resize(newSize);
+        for (auto it = mSparse.begin(); it != mSparse.end();) {
+            if (it->first < newSize) {
+                Slot& slot = mDense[it->first];
+                slot.value = std::move(it->second);
+                slot.used = true;
+                it = mSparse.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    std::vector<Slot> mDense;
+    std::unordered_map<ObjectLocalName, T> mSparse;
+    size_t mSize = 0;
+};
+
+template <class T>
+constexpr size_t ObjectNameMap<T>::kMinDenseSize;
+template <class T>
+constexpr size_t ObjectNameMap<T>::kMaxDenseSize;
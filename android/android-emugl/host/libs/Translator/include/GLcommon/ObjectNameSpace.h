@@ -20,6 +20,7 @@
 #include "emugl/common/mutex.h"
 #include "GLcommon/GLBackgroundLoader.h"
 #include "GLcommon/NamedObject.h"
+#include "GLcommon/ObjectNameMap.h"
 #include "GLcommon/ObjectData.h"
 #include "GLcommon/SaveableTexture.h"
 #include "GLcommon/TranslatorIfaces.h"
@@ -28,8 +29,8 @@
 #include <unordered_map>
 #include <unordered_set>
 
-typedef std::unordered_map<ObjectLocalName, NamedObjectPtr> NamesMap;
-typedef std::unordered_map<ObjectLocalName, ObjectDataPtr> ObjectDataMap;
+typedef ObjectNameMap<NamedObjectPtr> NamesMap;
+typedef ObjectNameMap<ObjectDataPtr> ObjectDataMap;
 typedef std::unordered_map<unsigned int, ObjectLocalName> GlobalToLocalNamesMap;
 
 class GlobalNameSpace;
@@ -107,8 +108,11 @@ public:
     void postLoadRestore(const ObjectData::getGlobalName_t& getGlobalName);
     void preSave(GlobalNameSpace *globalNameSpace);
     void onSave(android::base::Stream* stream);
-    ObjectDataMap::const_iterator objDataMapBegin() const;
-    ObjectDataMap::const_iterator objDataMapEnd() const;
+    // Calls |func(localName, objectDataPtr)| for each object with data.
+    template <class Func>
+    void forEachObjectData(Func&& func) const {
+        m_objectDataMap.forEach(std::forward<Func>(func));
+    }
 private:
     ObjectLocalName m_nextName = 0;
     NamesMap m_localToGlobalMap;
@@ -39,6 +39,11 @@ void doCompressedTexImage2D(GLEScontext* ctx, GLenum target, GLint level,
                             GLenum internalformat, GLsizei width,
                             GLsizei height, GLint border, GLsizei imageSize,
                             const GLvoid* data, glTexImage2D_t glTexImage2DPtr);
+// Same as etc2_decode_image(), but large images are decoded on several
+// threads.
+int etcDecodeImage(const etc1_byte* pIn, ETC2ImageFormat format,
+                   etc1_byte* pOut, etc1_uint32 width, etc1_uint32 height,
+                   etc1_uint32 stride);
 void deleteRenderbufferGlobal(GLuint rbo);
 GLenum decompressedInternalFormat(GLEScontext* ctx, GLenum compressedFormat);
 
@@ -37,6 +37,11 @@ enum ETC2ImageFormat {
 	EtcRGB8, EtcRGBA8, EtcR11, EtcSignedR11, EtcRG11, EtcSignedRG11, EtcRGB8A1
 };
 
+// Implementations of the block decoders.
+enum EtcDecoderImpl {
+	EtcDecoderScalar, EtcDecoderSse41, EtcDecoderAvx2
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -74,6 +79,16 @@ void eac_decode_single_channel_block(const etc1_byte* pIn,
 									 int decodedElementBytes, bool isSigned,
 									 etc1_byte* pOut);
 
+// Return the implementation the block decoders use. It defaults to the
+// fastest one the CPU supports.
+
+EtcDecoderImpl etc_get_decoder_impl();
+
+// Make the block decoders use |impl|, e.g. to compare them in tests.
+// Returns false if the CPU or the build doesn't support it.
+
+etc1_bool etc_set_decoder_impl(EtcDecoderImpl impl);
+
 // Return the size of the encoded image data (does not include size of PKM header).
 
 etc1_uint32 etc1_get_encoded_data_size(etc1_uint32 width, etc1_uint32 height);
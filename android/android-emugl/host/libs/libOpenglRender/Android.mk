@@ -20,15 +20,19 @@ endif
 
 host_common_SRC_FILES := \
     $(host_OS_SRCS) \
+    ChannelRing.cpp \
     ChannelStream.cpp \
     ColorBuffer.cpp \
+    ColorBufferPool.cpp \
     FbConfig.cpp \
     FenceSync.cpp \
     FrameBuffer.cpp \
     GLESVersionDetector.cpp \
     PostWorker.cpp \
+    ReadAheadStream.cpp \
     ReadbackWorker.cpp \
     ReadBuffer.cpp \
+    RenderCapture.cpp \
     RenderChannelImpl.cpp \
     RenderContext.cpp \
     RenderControl.cpp \
@@ -48,6 +52,7 @@ host_common_SRC_FILES := \
 standalone_common_SRC_FILES := \
     $(host_common_SRC_FILES) \
     ../Translator/GLES_V2/ANGLEShaderParser.cpp \
+    ../Translator/GLES_V2/ShaderCache.cpp \
     standalone_common/angle-util/OSWindow.cpp \
     standalone_common/SampleApplication.cpp \
     standalone_common/SearchPathsSetup.cpp \
@@ -151,12 +156,14 @@ $(call emugl-end-module)
 # Tests#########################################################################
 $(call emugl-begin-executable,lib$(BUILD_TARGET_SUFFIX)OpenglRender_unittests)
 $(call emugl-import,lib$(BUILD_TARGET_SUFFIX)OpenglRender_standalone_common libemugl_gtest)
+$(call emugl-import,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_guest lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_host)
 
 LOCAL_C_INCLUDES += $(standalone_common_C_INCLUDES)
 LOCAL_STATIC_LIBRARIES += $(standalone_common_STATIC_LIBRARIES)
 
 LOCAL_SRC_FILES := \
     samples/HelloTriangleImp.cpp \
+    tests/ChannelRing_unittest.cpp \
     tests/DefaultFramebufferBlit_unittest.cpp \
     tests/FrameBuffer_unittest.cpp \
     tests/GLSnapshot_unittest.cpp \
@@ -180,8 +187,11 @@ LOCAL_SRC_FILES := \
     tests/GLTestUtils.cpp \
     tests/OpenGL_unittest.cpp \
     tests/OpenGLTestContext.cpp \
+    tests/ReadAheadStream_unittest.cpp \
+    tests/ShaderCache_unittest.cpp \
     tests/StalePtrRegistry_unittest.cpp \
     tests/TextureDraw_unittest.cpp \
+    tests/VkDecoder_unittest.cpp \
 
 LOCAL_LDFLAGS += $(standalone_common_LDFLAGS)
 LOCAL_LDLIBS += $(standalone_common_LDLIBS)
@@ -213,5 +223,6 @@ ifeq ($(BUILD_TARGET_SUFFIX),64)
 $(call make_sample,HelloTriangle)
 $(call make_sample,HelloSurfaceFlinger)
 $(call make_sample,CreateDestroyContext)
+$(call make_sample,CaptureReplay)
 
 endif
@@ -0,0 +1,87 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ChannelRing.h"
+
+#include <algorithm>
+
+#include <string.h>
+
+namespace emugl {
+
+ChannelRing::ChannelRing(size_t capacity) {
+    reset(capacity);
+}
+
+void ChannelRing::reset(size_t capacity) {
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    mBuffer.assign(size, 0);
+    mMask = size - 1;
+    mWritePos.store(0);
+    mReadPos.store(0);
+}
+
+size_t ChannelRing::writeAvailable() const {
+    return mBuffer.size() -
+           (mWritePos.load(std::memory_order_relaxed) - mReadPos.load());
+}
+
+size_t ChannelRing::write(const void* data, size_t size) {
+    const size_t writePos = mWritePos.load(std::memory_order_relaxed);
+    size = std::min(size, writeAvailable());
+    if (!size) {
+        return 0;
+    }
+    const size_t offset = writePos & mMask;
+    const size_t first = std::min(size, mBuffer.size() - offset);
+    memcpy(mBuffer.data() + offset, data, first);
+    memcpy(mBuffer.data(), static_cast<const char*>(data) + first,
+           size - first);
+    mWritePos.store(writePos + size);
+    return size;
+}
+
+size_t ChannelRing::readAvailable() const {
+    return mWritePos.load() - mReadPos.load(std::memory_order_relaxed);
+}
+
+size_t ChannelRing::read(void* data, size_t size) {
+    const size_t readPos = mReadPos.load(std::memory_order_relaxed);
+    size = copyOut(readPos, data, size);
+    if (size) {
+        mReadPos.store(readPos + size);
+    }
+    return size;
+}
+
+size_t ChannelRing::peek(void* data, size_t size) const {
+    return copyOut(mReadPos.load(), data, size);
+}
+
+size_t ChannelRing::copyOut(size_t pos, void* data, size_t size) const {
+    size = std::min(size, mWritePos.load() - pos);
+    if (!size) {
+        return 0;
+    }
+    const size_t offset = pos & mMask;
+    const size_t first = std::min(size, mBuffer.size() - offset);
+    memcpy(data, mBuffer.data() + offset, first);
+    memcpy(static_cast<char*>(data) + first, mBuffer.data(), size - first);
+    return size;
+}
+
+}  // namespace emugl
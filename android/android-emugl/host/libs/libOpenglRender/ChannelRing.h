@@ -0,0 +1,76 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "android/base/Compiler.h"
+
+#include <atomic>
+#include <vector>
+
+#include <stddef.h>
+
+namespace emugl {
+
+// A preallocated byte ring buffer shared by a single producer thread and a
+// single consumer thread, without any lock. Used by RenderChannelImpl to
+// pass the guest command stream to the render thread: data is copied from
+// the guest pipe buffers into the ring, then from the ring into the
+// RenderThread's ReadBuffer, without any intermediate allocation.
+//
+// The ring doesn't block: callers decide how to wait when it is empty or
+// full. Both positions are updated with sequentially consistent stores, so
+// a consumer that publishes a 'waiting' flag and then checks
+// readAvailable() can't miss a write from a producer that checks the flag
+// after its write(), and the other way around.
+class ChannelRing {
+    DISALLOW_COPY_ASSIGN_AND_MOVE(ChannelRing);
+
+public:
+    // |capacity| is rounded up to a power of 2.
+    explicit ChannelRing(size_t capacity);
+
+    // Drop the content and change the capacity. Must not be called while
+    // other threads use the ring.
+    void reset(size_t capacity);
+
+    size_t capacity() const { return mBuffer.size(); }
+
+    // Producer side: return the number of bytes that can be written, and
+    // copy up to |size| bytes from |data| into the ring. Returns the number
+    // of bytes copied.
+    size_t writeAvailable() const;
+    size_t write(const void* data, size_t size);
+
+    // Consumer side: return the number of bytes that can be read, and move
+    // up to |size| of them to |data|. Returns the number of bytes moved.
+    size_t readAvailable() const;
+    size_t read(void* data, size_t size);
+
+    // Copy up to |size| bytes to |data| without consuming them. Only used
+    // for snapshots, from the consumer side or when the producer is idle.
+    size_t peek(void* data, size_t size) const;
+
+private:
+    size_t copyOut(size_t pos, void* data, size_t size) const;
+
+    std::vector<char> mBuffer;
+    size_t mMask = 0;
+    // Total bytes written and read so far. The difference is the number of
+    // bytes in the ring.
+    std::atomic<size_t> mWritePos{0};
+    std::atomic<size_t> mReadPos{0};
+};
+
+}  // namespace emugl
@@ -66,10 +66,11 @@ const unsigned char* ChannelStream::readRaw(void* buf, size_t* inout_len) {
             continue;
         }
         bool blocking = (count == 0);
-        auto result = mChannel->readFromGuest(&mReadBuffer, blocking);
-        D("readFromGuest() returned %d, size %d", (int)result, (int)mReadBuffer.size());
+        size_t size = wanted - count;
+        auto result = mChannel->readFromGuest(dst + count, &size, blocking);
+        D("readFromGuest() returned %d, size %d", (int)result, (int)size);
         if (result == IoResult::Ok) {
-            mReadBufferLeft = mReadBuffer.size();
+            count += size;
             continue;
         }
         if (count > 0) {  // There is some data to return.
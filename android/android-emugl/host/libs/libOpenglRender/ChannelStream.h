@@ -42,6 +42,8 @@ protected:
 private:
     RenderChannelImpl* mChannel;
     RenderChannel::Buffer mWriteBuffer;
+    // Data read from the channel before a snapshot was saved, to consume
+    // before reading from the channel again.
     RenderChannel::Buffer mReadBuffer;
     size_t mReadBufferLeft = 0;
 };
@@ -220,6 +220,11 @@ ColorBuffer* ColorBuffer::create(EGLDisplay p_display,
             p_display, s_egl.eglGetCurrentContext(), EGL_GL_TEXTURE_2D_KHR,
             (EGLClientBuffer)SafePointerFromUInt(cb->m_blitTex), NULL);
 
+    if (cb->m_eglImage && s_egl.eglGetImageTextureUseCountANDROID) {
+        cb->m_eglImageUseCount = s_egl.eglGetImageTextureUseCountANDROID(
+                p_display, cb->m_eglImage);
+    }
+
     cb->m_resizer = new TextureResize(p_width, p_height);
 
     cb->m_frameworkFormat = p_frameworkFormat;
@@ -334,6 +339,70 @@ void ColorBuffer::reformat(GLint internalformat,
     m_internalFormat = internalformat;
     m_format = format;
     m_type = type;
+    m_reformatted = true;
+}
+
+bool ColorBuffer::canRecycle() const {
+    if (m_reformatted || !m_eglImage || needRestore()) {
+        return false;
+    }
+    // Guest textures and renderbuffers bound with bindToTexture() or
+    // bindToRenderbuffer() share the texture of |m_eglImage|, and may
+    // outlive the guest color buffer. Reusing it would let them see and
+    // draw into the next guest buffer.
+    if (!m_eglImageUseCount ||
+        s_egl.eglGetImageTextureUseCountANDROID(m_display, m_eglImage) !=
+                m_eglImageUseCount) {
+        return false;
+    }
+    // recycle() clears the texture through an FBO, so only take the
+    // formats that are always color-renderable.
+    switch (m_internalFormat) {
+        case GL_RGB:
+        case GL_RGB565_OES:
+        case GL_RGBA:
+        case GL_RGB5_A1_OES:
+        case GL_RGBA4_OES:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ColorBuffer::recycle(HandleType hndl) {
+    RecursiveScopedHelperContext context(m_helper);
+    if (!context.isOk()) {
+        return false;
+    }
+
+    waitSync();
+    m_sync = nullptr;
+
+    if (!bindFbo(&m_fbo, m_tex)) {
+        return false;
+    }
+
+    // Reset the content to what create() uploads, so the new guest buffer
+    // never shows pixels of the previous one.
+    GLfloat prevClearColor[4];
+    s_gles2.glGetFloatv(GL_COLOR_CLEAR_VALUE, prevClearColor);
+    const GLboolean scissorTest = s_gles2.glIsEnabled(GL_SCISSOR_TEST);
+    if (scissorTest) {
+        s_gles2.glDisable(GL_SCISSOR_TEST);
+    }
+    s_gles2.glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+    s_gles2.glClear(GL_COLOR_BUFFER_BIT);
+    s_gles2.glClearColor(prevClearColor[0], prevClearColor[1],
+                         prevClearColor[2], prevClearColor[3]);
+    if (scissorTest) {
+        s_gles2.glEnable(GL_SCISSOR_TEST);
+    }
+    unbindFbo();
+    s_gles2.glFinish();
+
+    mHndl = hndl;
+    m_needFormatCheck = true;
+    return true;
 }
 
 void ColorBuffer::subUpdate(int x,
@@ -620,7 +689,7 @@ void ColorBuffer::readback(unsigned char* img) {
     }
 }
 
-void ColorBuffer::readbackAsync(GLuint buffer) {
+void ColorBuffer::readbackAsync(GLuint buffer, GLsync* fence) {
     RecursiveScopedHelperContext context(m_helper);
     if (!context.isOk()) {
         return;
@@ -629,10 +698,18 @@ void ColorBuffer::readbackAsync(GLuint buffer) {
 
     waitSync();
 
+    if (*fence) {
+        s_gles2.glDeleteSync(*fence);
+        *fence = nullptr;
+    }
+
     if (bindFbo(&m_fbo, m_tex)) {
         s_gles2.glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
         s_gles2.glReadPixels(0, 0, m_width, m_height, GL_RGBA, m_asyncReadbackType, 0);
         s_gles2.glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        *fence = s_gles2.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        // The fence is waited on from another context.
+        s_gles2.glFlush();
         unbindFbo();
     }
 }
@@ -150,6 +150,18 @@ public:
     // Return ColorBuffer width and height in pixels
     GLuint getWidth() const { return m_width; }
     GLuint getHeight() const { return m_height; }
+    GLenum getInternalFormat() const { return m_internalFormat; }
+    FrameworkFormat getFrameworkFormat() const { return m_frameworkFormat; }
+
+    // Return true if recycle() can be used on this instance once the guest
+    // has closed it.
+    bool canRecycle() const;
+
+    // Reuse this instance for a new guest color buffer with handle |hndl|,
+    // with the same state as one just returned by create() with the same
+    // parameters, but without allocating new host textures and EGLImages.
+    // Returns false on failure, and the instance must be destroyed.
+    bool recycle(HandleType hndl);
 
     // Read the ColorBuffer instance's pixel values into host memory.
     void readPixels(int x,
@@ -208,8 +220,10 @@ public:
     // Read the content of the whole ColorBuffer as 32-bit RGBA pixels.
     // |img| must be a buffer large enough (i.e. width * height * 4).
     void readback(unsigned char* img);
-    // readback() but async (to the specified |buffer|)
-    void readbackAsync(GLuint buffer);
+    // readback() but async (to the specified |buffer|). |*fence| is
+    // replaced by a fence signaled once the pixels are in |buffer|; the
+    // previous one, if any, is deleted.
+    void readbackAsync(GLuint buffer, GLsync* fence);
     // readbackAsync() but in one thread:
     // glReadPixels will be done to buffer1, and then right after,
     // glMapBufferRange -> memcpy(img, <memory of buffer2>)
@@ -237,6 +251,9 @@ private:
     GLuint m_blitTex = 0;
     EGLImageKHR m_eglImage = nullptr;
     EGLImageKHR m_blitEGLImage = nullptr;
+    // The number of holders of |m_tex| once |m_eglImage| is created, see
+    // canRecycle(). 0 if unknown.
+    EGLint m_eglImageUseCount = 0;
     GLuint m_width = 0;
     GLuint m_height = 0;
     GLuint m_fbo = 0;
@@ -245,6 +262,7 @@ private:
     // |m_format| and |m_type| are for reformatting purposes only
     // to work around bugs in the guest. No need to snapshot those.
     bool m_needFormatCheck = true;
+    bool m_reformatted = false;
     GLenum m_format = 0; // TODO: Currently we treat m_internalFormat same as
                          // m_format, but if underlying drivers can take it,
                          // it may be a better idea to distinguish them, with
@@ -0,0 +1,93 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ColorBufferPool.h"
+
+using android::base::System;
+
+// How long an unused ColorBuffer stays in the pool.
+static constexpr System::Duration kMaxIdleSec = 10;
+
+// The host memory of a ColorBuffer: its texture and the one used for blits.
+// Counted as RGBA8, which is the most recycle() takes.
+static size_t colorBufferSize(const ColorBuffer& cb) {
+    return 2 * 4 * (size_t)cb.getWidth() * cb.getHeight();
+}
+
+ColorBufferPool::ColorBufferPool(size_t maxSize) : mMaxSize(maxSize) {}
+
+ColorBufferPool::~ColorBufferPool() {
+    clear();
+}
+
+ColorBufferPtr ColorBufferPool::take(int width,
+                                     int height,
+                                     GLenum internalFormat,
+                                     FrameworkFormat frameworkFormat,
+                                     bool fastBlitSupported,
+                                     HandleType hndl) {
+    // Prefer the most recently used ones.
+    for (auto it = mEntries.rbegin(); it != mEntries.rend(); ++it) {
+        const ColorBuffer& cb = *it->cb;
+        if (cb.getWidth() != (GLuint)width ||
+            cb.getHeight() != (GLuint)height ||
+            cb.getInternalFormat() != internalFormat ||
+            cb.getFrameworkFormat() != frameworkFormat ||
+            cb.isFastBlitSupported() != fastBlitSupported) {
+            continue;
+        }
+        ColorBufferPtr result = std::move(it->cb);
+        erase(std::next(it).base());
+        if (!result->recycle(hndl)) {
+            break;
+        }
+        ++mHits;
+        return result;
+    }
+    ++mMisses;
+    return nullptr;
+}
+
+void ColorBufferPool::put(ColorBufferPtr&& cb) {
+    ColorBufferPtr ptr = std::move(cb);
+    if (!ptr || ptr.use_count() > 1 || !ptr->canRecycle()) {
+        return;
+    }
+    const size_t size = colorBufferSize(*ptr);
+    if (size > mMaxSize) {
+        return;
+    }
+    while (mSize + size > mMaxSize) {
+        erase(mEntries.begin());
+    }
+    mEntries.push_back({std::move(ptr), size, System::get()->getUnixTime()});
+    mSize += size;
+}
+
+void ColorBufferPool::trim() {
+    const auto now = System::get()->getUnixTime();
+    while (!mEntries.empty() && mEntries.front().ts + kMaxIdleSec <= now) {
+        erase(mEntries.begin());
+    }
+}
+
+void ColorBufferPool::clear() {
+    mEntries.clear();
+    mSize = 0;
+}
+
+void ColorBufferPool::erase(std::list<Entry>::iterator it) {
+    mSize -= it->size;
+    mEntries.erase(it);
+}
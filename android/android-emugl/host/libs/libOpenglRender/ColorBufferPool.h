@@ -0,0 +1,84 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "android/base/Compiler.h"
+#include "android/base/system/System.h"
+
+#include "ColorBuffer.h"
+
+#include <list>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A pool of the ColorBuffers closed by the guest, to reuse them for the next
+// guest buffers of the same size and format. Camera preview, video decoding
+// and UI surfaces allocate and free gralloc buffers all the time, and each
+// new ColorBuffer means new host textures, EGLImages and FBOs.
+//
+// Unused ColorBuffers are destroyed once they have been in the pool for a
+// while, or when it grows past its maximum size.
+//
+// Not thread-safe: FrameBuffer uses it under its lock.
+class ColorBufferPool {
+    DISALLOW_COPY_ASSIGN_AND_MOVE(ColorBufferPool);
+
+public:
+    // |maxSize| bounds the host memory of the ColorBuffers in the pool, in
+    // bytes. 0 disables the pool.
+    explicit ColorBufferPool(size_t maxSize);
+    ~ColorBufferPool();
+
+    // Return a ColorBuffer with the given parameters from the pool,
+    // recycled as |hndl|, or nullptr if there is none.
+    ColorBufferPtr take(int width,
+                        int height,
+                        GLenum internalFormat,
+                        FrameworkFormat frameworkFormat,
+                        bool fastBlitSupported,
+                        HandleType hndl);
+
+    // Put a ColorBuffer the guest has closed in the pool. It is destroyed
+    // instead if it can't be reused or if something else still uses it.
+    void put(ColorBufferPtr&& cb);
+
+    // Destroy the ColorBuffers that stayed unused for too long.
+    void trim();
+
+    // Destroy all ColorBuffers in the pool.
+    void clear();
+
+    uint64_t hits() const { return mHits; }
+    uint64_t misses() const { return mMisses; }
+
+private:
+    struct Entry {
+        ColorBufferPtr cb;
+        size_t size;
+        android::base::System::Duration ts;
+    };
+
+    void erase(std::list<Entry>::iterator it);
+
+    const size_t mMaxSize;
+    size_t mSize = 0;
+    // Ordered by |ts|, oldest first. There are only a few entries, so
+    // take() just scans them.
+    std::list<Entry> mEntries;
+
+    uint64_t mHits = 0;
+    uint64_t mMisses = 0;
+};
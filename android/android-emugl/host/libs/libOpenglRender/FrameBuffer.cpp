@@ -226,6 +226,7 @@ void FrameBuffer::finalize() {
 
     m_colorbuffers.clear();
     m_colorBufferDelayedCloseList.clear();
+    m_colorBufferPool.clear();
     if (m_useSubWindow) {
         removeSubWindow_locked();
     }
@@ -580,6 +581,15 @@ GLESDispatchMaxVersion FrameBuffer::getMaxGLESVersion() {
     return sMaxGLESVersion;
 }
 
+// The size of the pool of closed color buffers waiting to be reused can be
+// set with ANDROID_EMUGL_COLORBUFFER_POOL_MB, 0 disabling it.
+static size_t getColorBufferPoolSize() {
+    static constexpr size_t kDefaultPoolSizeMb = 64;
+    const char* sizeMb = getenv("ANDROID_EMUGL_COLORBUFFER_POOL_MB");
+    return (sizeMb ? strtoul(sizeMb, nullptr, 10) : kDefaultPoolSizeMb) *
+           1024 * 1024;
+}
+
 FrameBuffer::FrameBuffer(int p_width, int p_height, bool useSubWindow)
     : m_framebufferWidth(p_width),
       m_framebufferHeight(p_height),
@@ -587,6 +597,7 @@ FrameBuffer::FrameBuffer(int p_width, int p_height, bool useSubWindow)
       m_windowHeight(p_height),
       m_useSubWindow(useSubWindow),
       m_fpsStats(getenv("SHOW_FPS_STATS") != nullptr),
+      m_colorBufferPool(getColorBufferPoolSize()),
       m_colorBufferHelper(new ColorBufferHelper(this)),
       m_readbackThread(
           [this](FrameBuffer::Readback&& readback) {
@@ -917,10 +928,16 @@ HandleType FrameBuffer::createColorBuffer(int p_width,
     HandleType ret = 0;
 
     ret = genHandle_locked();
-    ColorBufferPtr cb(ColorBuffer::create(getDisplay(), p_width, p_height,
-                                          p_internalFormat, p_frameworkFormat,
-                                          ret, m_colorBufferHelper,
-                                          m_fastBlitSupported));
+    ColorBufferPtr cb = m_colorBufferPool.take(p_width, p_height,
+                                               p_internalFormat,
+                                               p_frameworkFormat,
+                                               m_fastBlitSupported, ret);
+    if (!cb) {
+        cb.reset(ColorBuffer::create(getDisplay(), p_width, p_height,
+                                     p_internalFormat, p_frameworkFormat, ret,
+                                     m_colorBufferHelper,
+                                     m_fastBlitSupported));
+    }
     if (cb.get() != NULL) {
         assert(m_colorbuffers.count(ret) == 0);
         // Android master default api level is 1000
@@ -1146,6 +1163,11 @@ void FrameBuffer::closeColorBuffer(HandleType p_colorbuffer) {
     }
 }
 
+uint64_t FrameBuffer::getColorBufferPoolHits() {
+    AutoLock mutex(m_lock);
+    return m_colorBufferPool.hits();
+}
+
 void FrameBuffer::closeColorBufferLocked(HandleType p_colorbuffer,
                                          bool forced) {
     ColorBufferMap::iterator c(m_colorbuffers.find(p_colorbuffer));
@@ -1166,7 +1188,7 @@ void FrameBuffer::closeColorBufferLocked(HandleType p_colorbuffer,
     if (--c->second.refcount == 0) {
         if (forced) {
             eraseDelayedCloseColorBufferLocked(c->first, c->second.closedTs);
-            m_colorbuffers.erase(c);
+            eraseColorBufferLocked(c);
         } else {
             c->second.closedTs = System::get()->getUnixTime();
             m_colorBufferDelayedCloseList.push_back(
@@ -1195,13 +1217,18 @@ void FrameBuffer::performDelayedColorBufferCloseLocked(bool forced) {
                     assert(0);
                 }
             }
-            const auto& cb = m_colorbuffers.find(it->cbHandle);
-            m_colorbuffers.erase(cb);
+            eraseColorBufferLocked(m_colorbuffers.find(it->cbHandle));
         }
         ++it;
     }
     m_colorBufferDelayedCloseList.erase(
                 m_colorBufferDelayedCloseList.begin(), it);
+    m_colorBufferPool.trim();
+}
+
+void FrameBuffer::eraseColorBufferLocked(ColorBufferMap::iterator c) {
+    m_colorBufferPool.put(std::move(c->second.cb));
+    m_colorbuffers.erase(c);
 }
 
 void FrameBuffer::eraseDelayedCloseColorBufferLocked(
@@ -1703,8 +1730,7 @@ bool FrameBuffer::post(HandleType p_colorbuffer, bool needLockAndBind) {
 }
 
 bool FrameBuffer::postImpl(HandleType p_colorbuffer,
-                           bool needLockAndBind,
-                           bool repaint) {
+                           bool needLockAndBind) {
     if (needLockAndBind) {
         m_lock.lock();
     }
@@ -1743,9 +1769,13 @@ bool FrameBuffer::postImpl(HandleType p_colorbuffer,
         if (currTime - m_statsStartTime >= 1000) {
             float dt = (float)(currTime - m_statsStartTime) / 1000.0f;
             auto usage = System::get()->getMemUsage();
-            printf("FPS: %5.3f resident memory: %f mb\n",
+            const uint64_t poolHits = m_colorBufferPool.hits();
+            const uint64_t poolTotal = poolHits + m_colorBufferPool.misses();
+            printf("FPS: %5.3f resident memory: %f mb "
+                   "color buffer pool hit rate: %.1f%%\n",
                    (float)m_statsNumFrames / dt,
-                   (float)usage.resident / 1048576.0f);
+                   (float)usage.resident / 1048576.0f,
+                   poolTotal ? 100.0f * poolHits / poolTotal : 0.0f);
             m_statsStartTime = currTime;
             m_statsNumFrames = 0;
         }
@@ -1766,7 +1796,7 @@ bool FrameBuffer::postImpl(HandleType p_colorbuffer,
                 }
             }
 
-            m_readbackWorker->doNextReadback(cb.get(), m_fbImage, repaint);
+            m_readbackWorker->doNextReadback(cb.get(), m_fbImage);
         } else {
             (*c).second.cb->readback(m_fbImage);
             doPostCallback(m_fbImage);
@@ -1809,8 +1839,7 @@ bool FrameBuffer::repost(bool needLockAndBind) {
     if (m_lastPostedColorBuffer &&
         sInitialized.load(std::memory_order_relaxed)) {
         GL_LOG("Has last posted colorbuffer and is initialized; post.");
-        return postImpl(m_lastPostedColorBuffer, needLockAndBind,
-                        true /* need repaint */);
+        return postImpl(m_lastPostedColorBuffer, needLockAndBind);
     } else {
         GL_LOG("No repost: no last posted color buffer");
         if (!sInitialized.load(std::memory_order_relaxed)) {
@@ -1873,6 +1902,15 @@ void FrameBuffer::getScreenshot(unsigned int nChannels, unsigned int* width,
     *width = m_framebufferWidth;
     *height = m_framebufferHeight;
     pixels.resize(4 * m_framebufferWidth * m_framebufferHeight);
+    // While something records the screen, the frame has already been read
+    // back; don't stall on another glReadPixels.
+    if (nChannels == 4 && m_readbackWorker &&
+        m_readbackWorker->latestHandle() == m_lastPostedColorBuffer &&
+        m_readbackWorker->width() == *width &&
+        m_readbackWorker->height() == *height) {
+        getPixels(pixels.data(), pixels.size());
+        return;
+    }
     c->second.cb->readPixels(0, 0, *width, *height,
             nChannels == 3 ? GL_RGB : GL_RGBA, GL_UNSIGNED_BYTE,
             pixels.data());
@@ -1891,6 +1929,8 @@ void FrameBuffer::onSave(Stream* stream,
     AutoLock mutex(m_lock);
     // set up a context because some snapshot commands try using GL
     ScopedBind scopedBind(m_colorBufferHelper);
+    // Don't save the EGLImages of unused color buffers.
+    m_colorBufferPool.clear();
     // eglPreSaveContext labels all guest context textures to be saved
     // (textures created by the host are not saved!)
     // eglSaveAllImages labels all EGLImages (both host and guest) to be saved
@@ -2000,6 +2040,8 @@ bool FrameBuffer::onLoad(Stream* stream,
             performDelayedColorBufferCloseLocked(true);
         }
         m_colorBufferDelayedCloseList.clear();
+        // The EGLImages are about to be replaced by the snapshot ones.
+        m_colorBufferPool.clear();
         assert(m_contexts.empty());
         assert(m_windows.empty());
         assert(m_colorbuffers.empty());
@@ -21,6 +21,7 @@
 #include "android/snapshot/common.h"
 
 #include "ColorBuffer.h"
+#include "ColorBufferPool.h"
 #include "emugl/common/mutex.h"
 #include "FbConfig.h"
 #include "GLESVersionDetector.h"
@@ -228,6 +229,10 @@ public:
     // the instance is destroyed automatically.
     void closeColorBuffer(HandleType p_colorbuffer);
 
+    // Return the number of ColorBuffers that createColorBuffer() took from
+    // the pool of closed ones.
+    uint64_t getColorBufferPoolHits();
+
     void cleanupProcGLObjects(uint64_t puid);
 
     // Equivalent for eglMakeCurrent() for the current display.
@@ -425,6 +430,7 @@ public:
     void fillGLESUsages(android_studio::EmulatorGLESUsages*);
     // Save a screenshot of the previous frame.
     // nChannels should be 3 (RGB) or 4 (RGBA).
+    // RGBA screenshots reuse the async readback of the frame if there is one.
     // Note: swiftshader_indirect does not work with 3 channels
     void getScreenshot(unsigned int nChannels, unsigned int* width,
             unsigned int* height, std::vector<unsigned char>& pixels);
@@ -443,8 +449,10 @@ private:
     void performDelayedColorBufferCloseLocked(bool forced = false);
     void eraseDelayedCloseColorBufferLocked(
             HandleType cb, android::base::System::Duration ts);
+    // Remove a color buffer from |m_colorbuffers| for good.
+    void eraseColorBufferLocked(ColorBufferMap::iterator c);
 
-    bool postImpl(HandleType p_colorbuffer, bool needLockAndBind = true, bool repaint = false);
+    bool postImpl(HandleType p_colorbuffer, bool needLockAndBind = true);
     void setGuestPostedAFrame() { m_guestPostedAFrame = true; }
 
 private:
@@ -492,6 +500,9 @@ private:
     using ColorBufferDelayedClose = std::vector<ColorBufferCloseInfo>;
     ColorBufferDelayedClose m_colorBufferDelayedCloseList;
 
+    // The closed color buffers, kept to reuse them in createColorBuffer().
+    ColorBufferPool m_colorBufferPool;
+
     ColorBuffer::Helper* m_colorBufferHelper = nullptr;
 
     EGLSurface m_eglSurface = EGL_NO_SURFACE;
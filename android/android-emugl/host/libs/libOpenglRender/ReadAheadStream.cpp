@@ -0,0 +1,248 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ReadAheadStream.h"
+
+#include "ErrorLog.h"
+
+#include <algorithm>
+
+#include <assert.h>
+#include <string.h>
+
+using android::base::AutoLock;
+
+namespace emugl {
+
+// Every packet starts with a 32-bit opcode followed by the 32-bit size of
+// the whole packet.
+static constexpr size_t kPacketHeaderSize = 8;
+
+// Sets |*complete| to the size of the whole packets at the start of |data|.
+// If that is 0, sets |*needed| to the size |data| must reach to hold one.
+// Returns false if |data| doesn't look like a packet stream.
+static bool findPackets(const uint8_t* data,
+                        size_t size,
+                        size_t* complete,
+                        size_t* needed) {
+    size_t pos = 0;
+    while (size - pos >= kPacketHeaderSize) {
+        uint32_t packetSize;
+        memcpy(&packetSize, data + pos + 4, sizeof(packetSize));
+        if (packetSize < kPacketHeaderSize) {
+            return false;
+        }
+        if (packetSize > size - pos) {
+            *needed = pos + packetSize;
+            break;
+        }
+        pos += packetSize;
+    }
+    if (pos == 0 && size < kPacketHeaderSize) {
+        *needed = kPacketHeaderSize;
+    }
+    *complete = pos;
+    return true;
+}
+
+ReadAheadStream::ReadAheadStream(IOStream* source, Recorder recorder)
+    : IOStream(0),
+      mSource(source),
+      mRecorder(std::move(recorder)),
+      mThread([this] { readerThread(); }) {
+    for (size_t n = 0; n < kNumBlocks; ++n) {
+        mFreeBlocks.send(std::vector<uint8_t>(kBlockSize));
+    }
+    mThread.start();
+}
+
+ReadAheadStream::~ReadAheadStream() {
+    {
+        AutoLock lock(mLock);
+        mStopping = true;
+        mCv.broadcast();
+    }
+    mFreeBlocks.stop();
+    mFullBlocks.stop();
+    mThread.wait();
+}
+
+// Waits until the consumer moved past |blocks| blocks. Returns false if
+// the stream is being destroyed.
+bool ReadAheadStream::waitForConsumer(size_t blocks) {
+    AutoLock lock(mLock);
+    while (mBlocksDone < blocks && !mStopping) {
+        mCv.wait(&lock);
+    }
+    return !mStopping;
+}
+
+void ReadAheadStream::readerThread() {
+    // Start of a packet that didn't fit in the previous block.
+    std::vector<uint8_t> partial;
+    // Cleared if the stream is corrupted. The decoders will deal with it,
+    // just pass it through.
+    bool framing = true;
+    size_t blocksSent = 0;
+    // The consumer must be done with the blocks up to this one, which it
+    // decodes itself, before the next one is recorded: commands may depend
+    // on the state they leave, such as the checksum calculator's.
+    size_t lastUnrecorded = 0;
+
+    for (;;) {
+        Block block;
+        if (!mFreeBlocks.receive(&block.data)) {
+            return;
+        }
+        if (block.data.size() < partial.size() + kPacketHeaderSize) {
+            block.data.resize(partial.size() + kBlockSize);
+        }
+        std::copy(partial.begin(), partial.end(), block.data.begin());
+        size_t valid = partial.size();
+
+        size_t complete = 0;
+        for (;;) {
+            size_t needed = 0;
+            if (valid > partial.size()) {
+                if (framing && !findPackets(block.data.data(), valid,
+                                            &complete, &needed)) {
+                    framing = false;
+                }
+                if (!framing) {
+                    complete = valid;
+                }
+                if (complete > 0) {
+                    break;
+                }
+            } else {
+                needed = valid + 1;
+            }
+            if (block.data.size() < needed) {
+                // Assemble large packets in a single block.
+                block.data.resize(std::max(needed, 2 * block.data.size()));
+            }
+            const size_t len = mSource->read(block.data.data() + valid,
+                                             block.data.size() - valid);
+            if (!len) {
+                // Hand over whatever was received, then stop.
+                block.size = valid;
+                block.last = true;
+                mFullBlocks.send(std::move(block));
+                return;
+            }
+            valid += len;
+        }
+
+        if (mRecorder && framing) {
+            if (!waitForConsumer(lastUnrecorded)) {
+                return;
+            }
+            block.recorded =
+                    mRecorder(block.data.data(), complete, &block.commands);
+            if (block.recorded < complete) {
+                lastUnrecorded = blocksSent + 1;
+            }
+        }
+
+        partial.assign(block.data.begin() + complete,
+                       block.data.begin() + valid);
+        block.size = complete;
+        if (!mFullBlocks.send(std::move(block))) {
+            return;
+        }
+        ++blocksSent;
+    }
+}
+
+// Hands the current block back to the reading thread and makes the next
+// one current. Returns false if there is none.
+bool ReadAheadStream::nextBlock() {
+    if (mBlock.last) {
+        return false;
+    }
+    if (!mBlock.data.empty()) {
+        if (mBlock.data.size() > kBlockSize) {
+            // Don't keep the memory of a large packet around.
+            mBlock.data.resize(kBlockSize);
+            mBlock.data.shrink_to_fit();
+        }
+        mFreeBlocks.send(std::move(mBlock.data));
+        AutoLock lock(mLock);
+        ++mBlocksDone;
+        mCv.signal();
+    }
+    if (!mFullBlocks.receive(&mBlock)) {
+        return false;
+    }
+    mBlockPos = 0;
+    return true;
+}
+
+const DecoderCommandList* ReadAheadStream::nextCommands(const uint8_t** data,
+                                                        size_t* size) {
+    if (mBlockPos == mBlock.size && !nextBlock()) {
+        return nullptr;
+    }
+    if (mBlockPos > 0 || !mBlock.recorded) {
+        return nullptr;
+    }
+    *data = mBlock.data.data();
+    *size = mBlock.recorded;
+    mBlockPos = mBlock.recorded;
+    return &mBlock.commands;
+}
+
+const unsigned char* ReadAheadStream::readRaw(void* buf, size_t* inout_len) {
+    while (mBlockPos == mBlock.size) {
+        if (!nextBlock()) {
+            return nullptr;
+        }
+        // Recorded blocks must be started with nextCommands().
+        assert(!mBlock.recorded);
+    }
+    const size_t len = std::min(*inout_len, mBlock.size - mBlockPos);
+    memcpy(buf, mBlock.data.data() + mBlockPos, len);
+    mBlockPos += len;
+    *inout_len = len;
+    return (const unsigned char*)buf;
+}
+
+void* ReadAheadStream::getDmaForReading(uint64_t guest_paddr) {
+    return mSource->getDmaForReading(guest_paddr);
+}
+
+void ReadAheadStream::unlockDma(uint64_t guest_paddr) {
+    mSource->unlockDma(guest_paddr);
+}
+
+void* ReadAheadStream::allocBuffer(size_t minSize) {
+    ERR("%s: replies must be written to the source stream\n", __func__);
+    return nullptr;
+}
+
+int ReadAheadStream::commitBuffer(size_t size) {
+    ERR("%s: replies must be written to the source stream\n", __func__);
+    return -1;
+}
+
+void ReadAheadStream::onSave(android::base::Stream* stream) {
+    ERR("%s: not supported\n", __func__);
+}
+
+unsigned char* ReadAheadStream::onLoad(android::base::Stream* stream) {
+    ERR("%s: not supported\n", __func__);
+    return nullptr;
+}
+
+}  // namespace emugl
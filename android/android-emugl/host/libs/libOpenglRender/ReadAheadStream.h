@@ -0,0 +1,123 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "DecoderCommandList.h"
+#include "OpenglRender/IOStream.h"
+
+#include "android/base/Compiler.h"
+#include "android/base/synchronization/ConditionVariable.h"
+#include "android/base/synchronization/Lock.h"
+#include "android/base/synchronization/MessageChannel.h"
+#include "android/base/threads/FunctorThread.h"
+
+#include <functional>
+#include <vector>
+
+#include <inttypes.h>
+
+namespace emugl {
+
+// An IOStream that pulls the guest command stream of a |source| stream
+// from a dedicated thread, so that a busy RenderThread can run the
+// decoders and the GL driver while the next commands are received.
+//
+// The reading thread also frames the stream into whole packets: each block
+// it hands over ends on a packet boundary, and large packets are assembled
+// there instead of on the render thread. A stream that starts in the
+// middle of a packet can't be framed, so only create an instance when the
+// consumer has no partial packet pending.
+//
+// Only the read side goes through this stream. Replies and DMA accesses
+// must still use |source| directly, from the consumer thread.
+//
+// When |source| fails (i.e. its channel was stopped or paused for a
+// snapshot), the reading thread exits and reads from this stream fail
+// once all the data received before is consumed. A new instance must then
+// be created to resume reading.
+//
+// With a Recorder, the reading thread also decodes the packets at the start
+// of each block into a command list, and the consumer only has to execute
+// it, see nextCommands(). The packets the Recorder stops at are read and
+// decoded by the consumer as usual, and the reading thread doesn't record
+// anything else until the consumer is done with them, so that the stream
+// is still decoded in order.
+class ReadAheadStream final : public IOStream {
+    DISALLOW_COPY_ASSIGN_AND_MOVE(ReadAheadStream);
+
+public:
+    // Called on the reading thread with |size| bytes of whole packets.
+    // Records the commands at the start of |data| into |cmds|, and returns
+    // the size of the packets recorded.
+    using Recorder = std::function<
+            size_t(const uint8_t* data, size_t size, DecoderCommandList* cmds)>;
+
+    explicit ReadAheadStream(IOStream* source, Recorder recorder = nullptr);
+
+    // Waits for the reading thread to exit, so a read from |source| must not
+    // be blocked forever: call it once a read failed, or |source| stopped.
+    ~ReadAheadStream();
+
+    // If the next bytes of the stream were recorded, skips them and returns
+    // their commands, which the caller must execute before reading on. Sets
+    // |*data| and |*size| to the bytes skipped. Returns nullptr if the next
+    // bytes must be read and decoded as usual, or reading failed.
+    //
+    // With a Recorder, call this whenever everything read so far has been
+    // decoded. The result is valid until the next read or call.
+    const DecoderCommandList* nextCommands(const uint8_t** data,
+                                           size_t* size);
+
+    void* getDmaForReading(uint64_t guest_paddr) override;
+    void unlockDma(uint64_t guest_paddr) override;
+
+protected:
+    void* allocBuffer(size_t minSize) override;
+    int commitBuffer(size_t size) override;
+    const unsigned char* readRaw(void* buf, size_t* inout_len) override;
+    void onSave(android::base::Stream* stream) override;
+    unsigned char* onLoad(android::base::Stream* stream) override;
+
+private:
+    // Number of blocks in flight, and their initial size.
+    static constexpr size_t kNumBlocks = 4;
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    struct Block {
+        std::vector<uint8_t> data;
+        size_t size = 0;      // Valid bytes at the start of |data|.
+        bool last = false;    // |source| failed after this block.
+        size_t recorded = 0;  // Bytes at the start of |data| in |commands|.
+        DecoderCommandList commands;
+    };
+
+    void readerThread();
+    bool waitForConsumer(size_t blocks);
+    bool nextBlock();
+
+    IOStream* const mSource;
+    const Recorder mRecorder;
+    android::base::Lock mLock;
+    android::base::ConditionVariable mCv;
+    size_t mBlocksDone = 0;  // Blocks the consumer moved past.
+    bool mStopping = false;
+    android::base::MessageChannel<std::vector<uint8_t>, kNumBlocks> mFreeBlocks;
+    android::base::MessageChannel<Block, kNumBlocks> mFullBlocks;
+    Block mBlock;          // Being consumed by the render thread.
+    size_t mBlockPos = 0;  // Read position in |mBlock|.
+    android::base::FunctorThread mThread;
+};
+
+}  // namespace emugl
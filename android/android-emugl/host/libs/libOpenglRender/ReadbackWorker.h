@@ -3,6 +3,8 @@
 #include "android/base/Compiler.h"
 #include "android/base/synchronization/Lock.h"
 
+#include "RenderThreadInfo.h"
+
 #include <EGL/egl.h>
 #include <GLES3/gl3.h>
 
@@ -10,7 +12,6 @@
 
 class ColorBuffer;
 class FrameBuffer;
-struct RenderThreadInfo;
 
 // This class implements async readback of emugl ColorBuffers.
 // It is meant to run on both the emugl framebuffer posting thread
@@ -26,35 +27,55 @@ public:
 
     // doNextReadback(): Call this from the emugl FrameBuffer::post thread
     // or similar rendering thread.
-    // This will trigger an async glReadPixels of the current framebuffer.
-    // The post callback of Framebuffer will also be triggered, but
-    // in async mode it should do minimal work that involves |fbImage|.
-    // |repaint|: flag to prime async readback with multiple iterations
-    // so that the consumer of readback doesn't lag behind.
-    void doNextReadback(ColorBuffer* cb, void* fbImage, bool repaint);
+    // This will trigger an async glReadPixels of |cb| into the next pixel
+    // buffer of the ring. The post callback of Framebuffer will also be
+    // triggered, but in async mode it should do minimal work that involves
+    // |fbImage|.
+    void doNextReadback(ColorBuffer* cb, void* fbImage);
 
     // getPixels(): Run this on a separate GL thread. This retrieves the
-    // latest framebuffer that has been posted and read with doNextReadback.
+    // latest framebuffer that has been posted and read with doNextReadback,
+    // waiting for the GPU to finish writing it if needed.
     // This is meant for apps like video encoding to use as input; they will
     // need to do synchronized communication with the thread ReadbackWorker
     // is running on.
     void getPixels(void* out, uint32_t bytes);
+
+    // Returns the handle of the ColorBuffer read by the latest
+    // doNextReadback(), or 0 if there was none yet. Lets screenshots reuse
+    // the readback of the frame on screen instead of reading it again.
+    HandleType latestHandle() const;
+
+    uint32_t width() const { return mWidth; }
+    uint32_t height() const { return mHeight; }
+
 private:
+    // A pixel buffer of the ring, and the fence signaled once the
+    // readback into it is done.
+    struct Slot {
+        GLuint buffer = 0;
+        GLsync fence = nullptr;
+        HandleType hndl = 0;
+    };
+
     EGLContext mContext;
     EGLSurface mSurf;
     RenderThreadInfo* mTLS;
     FrameBuffer* mFb;
 
-    android::base::Lock mLock;
-    uint32_t mReadPixelsIndexEven = 0;
-    uint32_t mReadPixelsIndexOdd = 1;
-    uint32_t mPrevReadPixelsIndex = 1;
-    uint32_t mMapCopyIndex = 0;
-    bool mIsCopying = false;
+    const uint32_t mWidth;
+    const uint32_t mHeight;
+    const uint32_t mBufferSize;
 
-    uint32_t mBufferSize = 0;
-    std::vector<GLuint> mBuffers = {};
-    uint32_t m_readbackCount = 0;
+    // Protects the indices below. doNextReadback() never writes to the
+    // slot being copied out nor to the latest one, which getPixels() may
+    // pick next; with 3 slots there is always another one to write to,
+    // so neither side waits for the other.
+    mutable android::base::Lock mLock;
+    std::vector<Slot> mSlots;
+    int mLatest = -1;
+    int mCopying = -1;
+    uint32_t mNext = 0;
 
     DISALLOW_COPY_AND_ASSIGN(ReadbackWorker);
 };
@@ -0,0 +1,130 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RenderCapture.h"
+
+#include "ErrorLog.h"
+
+#include "android/base/StringFormat.h"
+#include "android/base/system/System.h"
+#include "android/utils/path.h"
+
+#include <atomic>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using android::base::StdioStream;
+using android::base::StringFormat;
+using android::base::System;
+
+namespace emugl {
+
+// Shared by all the render threads: next data record number and next
+// capture file index.
+static std::atomic<uint64_t> sNextSequence{0};
+static std::atomic<uint32_t> sNextFileIndex{0};
+
+// Record timestamps are relative to the first call.
+static uint64_t captureTimeUs() {
+    static const System::WallDuration startUs =
+            System::get()->getHighResTimeUs();
+    return System::get()->getHighResTimeUs() - startUs;
+}
+
+bool RenderCapture::load(const char* path) {
+    FILE* file = ::fopen(path, "rb");
+    if (!file) {
+        ERR("%s: can't open %s\n", __func__, path);
+        return false;
+    }
+    StdioStream stream(file, StdioStream::kOwner);
+    if (stream.getBe32() != kMagic || stream.getBe32() != kVersion) {
+        ERR("%s: %s is not a version %u capture file\n", __func__, path,
+            kVersion);
+        return false;
+    }
+    width = stream.getBe32();
+    height = stream.getBe32();
+
+    for (;;) {
+        Record record;
+        record.type = static_cast<RecordType>(stream.getBe32());
+        const uint32_t size = stream.getBe32();
+        record.sequence = stream.getBe64();
+        record.timeUs = stream.getBe64();
+        if (feof(file)) {
+            break;
+        }
+        record.bytes.resize(size);
+        if (stream.read(record.bytes.data(), size) != (ssize_t)size) {
+            ERR("%s: %s is truncated\n", __func__, path);
+            break;
+        }
+        records.push_back(std::move(record));
+    }
+    return true;
+}
+
+// static
+std::unique_ptr<RenderCaptureWriter> RenderCaptureWriter::create(
+        uint32_t width,
+        uint32_t height) {
+    const char* dir = getenv("RENDERER_CAPTURE_DIR");
+    if (!dir) {
+        return nullptr;
+    }
+    std::string path = StringFormat("%s" PATH_SEP "capture_%u.bin", dir,
+                                    sNextFileIndex++);
+    FILE* file = ::fopen(path.c_str(), "wb");
+    if (!file) {
+        fprintf(stderr, "Warning: can't open render capture file %s\n",
+                path.c_str());
+        return nullptr;
+    }
+
+    captureTimeUs();
+    StdioStream stream(file, StdioStream::kOwner);
+    stream.putBe32(RenderCapture::kMagic);
+    stream.putBe32(RenderCapture::kVersion);
+    stream.putBe32(width);
+    stream.putBe32(height);
+    return std::unique_ptr<RenderCaptureWriter>(
+            new RenderCaptureWriter(std::move(stream), std::move(path)));
+}
+
+RenderCaptureWriter::RenderCaptureWriter(StdioStream&& stream,
+                                         std::string path)
+    : mStream(std::move(stream)), mPath(std::move(path)) {}
+
+void RenderCaptureWriter::writeData(const void* data, size_t size) {
+    writeRecord(RenderCapture::RecordType::kData, sNextSequence++, data, size);
+}
+
+void RenderCaptureWriter::writeDma(const void* data, size_t size) {
+    writeRecord(RenderCapture::RecordType::kDma, 0, data, size);
+}
+
+void RenderCaptureWriter::writeRecord(RenderCapture::RecordType type,
+                                      uint64_t sequence,
+                                      const void* data,
+                                      size_t size) {
+    mStream.putBe32(static_cast<uint32_t>(type));
+    mStream.putBe32(static_cast<uint32_t>(size));
+    mStream.putBe64(sequence);
+    mStream.putBe64(captureTimeUs());
+    mStream.write(data, size);
+}
+
+}  // namespace emugl
@@ -0,0 +1,96 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "android/base/Compiler.h"
+#include "android/base/files/StdioStream.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <inttypes.h>
+
+namespace emugl {
+
+// Capture of the guest encoder stream of one RenderThread, for offline
+// replay (see samples/CaptureReplay.cpp).
+//
+// Capture is enabled by pointing the RENDERER_CAPTURE_DIR environment
+// variable to an existing directory. Each render thread then writes a
+// capture_<n>.bin file there, holding a header followed by records:
+//
+//   - kData: bytes received from the guest, exactly as handed over to the
+//     decoders. Data records of all threads share a single sequence
+//     number, so the replay can feed them in the original order.
+//   - kDma: contents of a guest DMA buffer referenced by a command (e.g.
+//     rcUpdateColorBufferDMA), in the order the decoders read them.
+//
+// All the values are stored big-endian, the android::base::Stream way.
+struct RenderCapture {
+    static constexpr uint32_t kMagic = 0x45474c43;  // 'EGLC'
+    static constexpr uint32_t kVersion = 1;
+
+    enum class RecordType : uint32_t {
+        kData = 1,
+        kDma = 2,
+    };
+
+    struct Record {
+        RecordType type;
+        uint64_t sequence;  // Only meaningful for kData.
+        uint64_t timeUs;    // Since the first capture of the process.
+        std::vector<uint8_t> bytes;
+    };
+
+    // Display size when the capture started.
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<Record> records;
+
+    // Load a capture file from |path|. A truncated file (e.g. the emulator
+    // was killed) keeps all its complete records. Returns false if |path|
+    // is not a capture file.
+    bool load(const char* path);
+};
+
+// Writes the capture file of a single render thread.
+class RenderCaptureWriter {
+    DISALLOW_COPY_ASSIGN_AND_MOVE(RenderCaptureWriter);
+
+public:
+    // Returns a new writer if capture is enabled and the file could be
+    // created, nullptr otherwise.
+    static std::unique_ptr<RenderCaptureWriter> create(uint32_t width,
+                                                       uint32_t height);
+
+    void writeData(const void* data, size_t size);
+    void writeDma(const void* data, size_t size);
+
+    const std::string& path() const { return mPath; }
+
+private:
+    RenderCaptureWriter(android::base::StdioStream&& stream, std::string path);
+
+    void writeRecord(RenderCapture::RecordType type,
+                     uint64_t sequence,
+                     const void* data,
+                     size_t size);
+
+    android::base::StdioStream mStream;
+    std::string mPath;
+};
+
+}  // namespace emugl
@@ -32,32 +32,33 @@ using IoResult = android::base::BufferQueueResult;
 using State = RenderChannel::State;
 using AutoLock = android::base::AutoLock;
 
-// These constants correspond to the capacities of buffer queues
-// used by each RenderChannelImpl instance. Benchmarking shows that
-// it's important to have a large queue for guest -> host transfers,
-// but a much smaller one works for host -> guest ones.
+// These constants correspond to the capacities of the buffers used by
+// each RenderChannelImpl instance. Benchmarking shows that it's important
+// to have a large buffer for guest -> host transfers, but a much smaller
+// one works for host -> guest ones.
 // Note: 32-bit Windows just doesn't have enough RAM to allocate optimal
 // capacity.
 #if defined(_WIN32) && !defined(_WIN64)
-static constexpr size_t kGuestToHostQueueCapacity = 32U;
+static constexpr size_t kGuestToHostRingCapacity = 64U * 1024U;
 #else
-static constexpr size_t kGuestToHostQueueCapacity = 1024U;
+static constexpr size_t kGuestToHostRingCapacity = 256U * 1024U;
 #endif
 static constexpr size_t kHostToGuestQueueCapacity = 16U;
 
 RenderChannelImpl::RenderChannelImpl(android::base::Stream* loadStream)
-    : mFromGuest(kGuestToHostQueueCapacity, mLock),
-      mToGuest(kHostToGuestQueueCapacity, mLock) {
+    : mToGuest(kHostToGuestQueueCapacity, mLock),
+      mFromGuest(kGuestToHostRingCapacity) {
     if (loadStream) {
-        mFromGuest.onLoadLocked(loadStream);
+        loadFromGuestLocked(loadStream);
         mToGuest.onLoadLocked(loadStream);
         mState = (State)loadStream->getBe32();
         mWantedEvents = (State)loadStream->getBe32();
 #ifndef NDEBUG
-        // Make sure we're in a consistent state after loading.
+        // Make sure we're in a consistent state after loading. CanWrite
+        // depends on the guest to host buffer capacity, which changed.
         const auto state = mState;
         updateStateLocked();
-        assert(state == mState);
+        assert((state & ~State::CanWrite) == (mState & ~State::CanWrite));
 #endif
     } else {
         updateStateLocked();
@@ -75,22 +76,70 @@ void RenderChannelImpl::setWantedEvents(State state) {
     D("state=%d", (int)state);
     AutoLock lock(mLock);
     mWantedEvents |= state;
+    // The ring may have been drained since the last update.
+    updateStateLocked();
     notifyStateChangeLocked();
 }
 
 RenderChannel::State RenderChannelImpl::state() const {
     AutoLock lock(mLock);
-    return mState;
+    // |mState| is not updated each time the render thread drains the ring,
+    // so CanWrite may be outdated.
+    State state = mState & ~State::CanWrite;
+    if (!mFromGuestClosed && mFromGuest.writeAvailable() > 0) {
+        state |= State::CanWrite;
+    }
+    return state;
 }
 
-IoResult RenderChannelImpl::tryWrite(Buffer&& buffer) {
-    D("buffer size=%d", (int)buffer.size());
-    AutoLock lock(mLock);
-    auto result = mFromGuest.tryPushLocked(std::move(buffer));
-    updateStateLocked();
-    DD("mFromGuest.tryPushLocked() returned %d, state %d", (int)result,
-       (int)mState);
-    return result;
+IoResult RenderChannelImpl::tryWrite(const Chunk* chunks,
+                                     size_t numChunks,
+                                     size_t* written) {
+    if (mFromGuestClosed) {
+        return IoResult::Error;
+    }
+    size_t requested = 0;
+    for (size_t n = 0; n < numChunks; ++n) {
+        requested += chunks[n].size;
+    }
+    if (!requested) {
+        *written = 0;
+        return IoResult::Ok;
+    }
+
+    // The render thread may drain the ring between a failed write and
+    // setting |mWriterBlocked|, then the write is retried. Only this thread
+    // writes, so once there is room the retry can't fail; the bound is
+    // there so a broken ring can't spin here.
+    static constexpr int kMaxRetries = 1;
+    size_t total = 0;
+    for (int attempt = 0;; ++attempt) {
+        for (size_t n = 0; n < numChunks; ++n) {
+            const size_t count =
+                    mFromGuest.write(chunks[n].data, chunks[n].size);
+            total += count;
+            if (count < chunks[n].size) {
+                break;
+            }
+        }
+        if (total) {
+            break;
+        }
+        // Let the render thread know it has to wake us up once it makes
+        // room, see readFromGuest(). It may just have done so.
+        mWriterBlocked = true;
+        if (mFromGuest.writeAvailable() == 0 || attempt == kMaxRetries) {
+            return IoResult::TryAgain;
+        }
+        mWriterBlocked = false;
+    }
+    D("wrote %d bytes", (int)total);
+    *written = total;
+    if (mReaderWaiting) {
+        AutoLock lock(mLock);
+        mFromGuestCanRead.signal();
+    }
+    return IoResult::Ok;
 }
 
 IoResult RenderChannelImpl::tryRead(Buffer* buffer) {
@@ -106,7 +155,8 @@ IoResult RenderChannelImpl::tryRead(Buffer* buffer) {
 void RenderChannelImpl::stop() {
     D("enter");
     AutoLock lock(mLock);
-    mFromGuest.closeLocked();
+    mFromGuestClosed = true;
+    mFromGuestCanRead.signal();
     mToGuest.closeLocked();
     mEventCallback = [](State state) {};
 }
@@ -121,28 +171,53 @@ bool RenderChannelImpl::writeToGuest(Buffer&& buffer) {
     return result == IoResult::Ok;
 }
 
-IoResult RenderChannelImpl::readFromGuest(Buffer* buffer, bool blocking) {
+IoResult RenderChannelImpl::readFromGuest(void* data,
+                                          size_t* size,
+                                          bool blocking) {
     D("enter");
-    AutoLock lock(mLock);
-    IoResult result;
-    if (blocking) {
-        result = mFromGuest.popLocked(buffer);
-    } else {
-        result = mFromGuest.tryPopLocked(buffer);
+    for (;;) {
+        const size_t count = mFromGuest.read(data, *size);
+        if (count > 0) {
+            DD("read %d bytes", (int)count);
+            *size = count;
+            if (mWriterBlocked.exchange(false)) {
+                // The guest waits for room in the ring.
+                AutoLock lock(mLock);
+                updateStateLocked();
+                notifyStateChangeLocked();
+            }
+            return IoResult::Ok;
+        }
+
+        AutoLock lock(mLock);
+        if (mFromGuestClosed || mFromGuestSnapshotMode) {
+            // Same as BufferQueue::popLocked(): all the data is consumed
+            // before reporting an error.
+            if (mFromGuest.readAvailable() > 0) {
+                continue;
+            }
+            return IoResult::Error;
+        }
+        if (!blocking) {
+            return IoResult::TryAgain;
+        }
+        // Publish |mReaderWaiting| before checking the ring, tryWrite()
+        // does the opposite.
+        mReaderWaiting = true;
+        while (mFromGuest.readAvailable() == 0 && !mFromGuestClosed &&
+               !mFromGuestSnapshotMode) {
+            mFromGuestCanRead.wait(&lock);
+        }
+        mReaderWaiting = false;
     }
-    updateStateLocked();
-    DD("mFromGuest.%s() return %d, buffer size %d, state %d",
-       blocking ? "popLocked" : "tryPopLocked", (int)result,
-       (int)buffer->size(), (int)mState);
-    notifyStateChangeLocked();
-    return result;
 }
 
 void RenderChannelImpl::stopFromHost() {
     D("enter");
 
     AutoLock lock(mLock);
-    mFromGuest.closeLocked();
+    mFromGuestClosed = true;
+    mFromGuestCanRead.signal();
     mToGuest.closeLocked();
     mState |= State::Stopped;
     notifyStateChangeLocked();
@@ -160,13 +235,14 @@ RenderThread* RenderChannelImpl::renderThread() const {
 
 void RenderChannelImpl::pausePreSnapshot() {
     AutoLock lock(mLock);
-    mFromGuest.setSnapshotModeLocked(true);
+    mFromGuestSnapshotMode = true;
+    mFromGuestCanRead.signal();
     mToGuest.setSnapshotModeLocked(true);
 }
 
 void RenderChannelImpl::resume() {
     AutoLock lock(mLock);
-    mFromGuest.setSnapshotModeLocked(false);
+    mFromGuestSnapshotMode = false;
     mToGuest.setSnapshotModeLocked(false);
 }
 
@@ -181,7 +257,7 @@ void RenderChannelImpl::updateStateLocked() {
     if (mToGuest.canPopLocked()) {
         state |= State::CanRead;
     }
-    if (mFromGuest.canPushLocked()) {
+    if (!mFromGuestClosed && mFromGuest.writeAvailable() > 0) {
         state |= State::CanWrite;
     }
     if (mToGuest.isClosedLocked()) {
@@ -203,7 +279,7 @@ void RenderChannelImpl::notifyStateChangeLocked() {
 void RenderChannelImpl::onSave(android::base::Stream* stream) {
     D("enter");
     AutoLock lock(mLock);
-    mFromGuest.onSaveLocked(stream);
+    saveFromGuestLocked(stream);
     mToGuest.onSaveLocked(stream);
     stream->putBe32(static_cast<uint32_t>(mState));
     stream->putBe32(static_cast<uint32_t>(mWantedEvents));
@@ -211,4 +287,36 @@ void RenderChannelImpl::onSave(android::base::Stream* stream) {
     mRenderThread->save(stream);
 }
 
+// The guest to host data is saved in the format of a
+// BufferQueue<RenderChannel::Buffer>, as it used to be.
+void RenderChannelImpl::saveFromGuestLocked(android::base::Stream* stream) {
+    stream->putByte(mFromGuestClosed);
+    if (!mFromGuestClosed) {
+        std::vector<char> data(mFromGuest.readAvailable());
+        mFromGuest.peek(data.data(), data.size());
+        stream->putBe32(data.empty() ? 0 : 1);
+        if (!data.empty()) {
+            android::base::saveBuffer(stream, data);
+        }
+    }
+}
+
+void RenderChannelImpl::loadFromGuestLocked(android::base::Stream* stream) {
+    mFromGuestClosed = stream->getByte();
+    if (mFromGuestClosed) {
+        return;
+    }
+    std::vector<char> data;
+    const uint32_t count = stream->getBe32();
+    for (uint32_t n = 0; n < count; ++n) {
+        std::vector<char> buffer;
+        android::base::loadBuffer(stream, &buffer);
+        data.insert(data.end(), buffer.begin(), buffer.end());
+    }
+    if (data.size() > mFromGuest.capacity()) {
+        mFromGuest.reset(data.size());
+    }
+    mFromGuest.write(data.data(), data.size());
+}
+
 }  // namespace emugl
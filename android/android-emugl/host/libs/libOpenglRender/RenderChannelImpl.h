@@ -14,9 +14,13 @@
 #pragma once
 
 #include "android/base/containers/BufferQueue.h"
+#include "android/base/synchronization/ConditionVariable.h"
+#include "ChannelRing.h"
 #include "OpenglRender/RenderChannel.h"
 #include "RendererImpl.h"
 
+#include <atomic>
+
 namespace emugl {
 
 class RenderThread;
@@ -48,8 +52,10 @@ public:
     // Return the current channel state relative to the guest.
     virtual State state() const override final;
 
-    // Try to send a buffer from the guest to the host render thread.
-    virtual IoResult tryWrite(Buffer&& buffer) override final;
+    // Try to send guest data to the host render thread.
+    virtual IoResult tryWrite(const Chunk* chunks,
+                              size_t numChunks,
+                              size_t* written) override final;
 
     // Try to read a buffer from the host render thread into the guest.
     virtual IoResult tryRead(Buffer* buffer) override final;
@@ -68,12 +74,13 @@ public:
     // false (meaning that the channel was closed).
     bool writeToGuest(Buffer&& buffer);
 
-    // Read data from the guest. If |blocking| is true, the call will be
-    // blocking. On success, move item into |*buffer| and return true. On
-    // failure, return IoResult::Error to indicate the channel was closed,
-    // or IoResult::TryAgain to indicate it was empty (this can happen only
+    // Read up to |*size| bytes of data from the guest into |data|. If
+    // |blocking| is true, the call will be blocking. On success, set |*size|
+    // to the number of bytes read and return IoResult::Ok. On failure,
+    // return IoResult::Error to indicate the channel was closed, or
+    // IoResult::TryAgain to indicate it was empty (this can happen only
     // if |blocking| is false).
-    IoResult readFromGuest(Buffer* buffer, bool blocking);
+    IoResult readFromGuest(void* data, size_t* size, bool blocking);
 
     // Close the channel from the host.
     void stopFromHost();
@@ -97,17 +104,30 @@ public:
 private:
     void updateStateLocked();
     void notifyStateChangeLocked();
+    void loadFromGuestLocked(android::base::Stream* stream);
+    void saveFromGuestLocked(android::base::Stream* stream);
 
     EventCallback mEventCallback;
     std::unique_ptr<RenderThread> mRenderThread;
 
-    // A single lock to protect the state and the two buffer queues at the
-    // same time. NOTE: This needs to appear before the BufferQueue instances.
+    // A single lock to protect the state, the host to guest queue and the
+    // guest to host closed and snapshot flags. NOTE: This needs to appear
+    // before the BufferQueue instance.
     mutable android::base::Lock mLock;
     State mState = State::Empty;
     State mWantedEvents = State::Empty;
-    BufferQueue<RenderChannel::Buffer> mFromGuest;
     BufferQueue<RenderChannel::Buffer> mToGuest;
+
+    // Guest to host data. The ring itself is lock-free: |mLock| is only
+    // taken to wake the render thread when it waits for data
+    // (|mReaderWaiting|), or the guest when it waits for room
+    // (|mWriterBlocked|).
+    ChannelRing mFromGuest;
+    android::base::ConditionVariable mFromGuestCanRead;
+    std::atomic<bool> mReaderWaiting{false};
+    std::atomic<bool> mWriterBlocked{false};
+    std::atomic<bool> mFromGuestClosed{false};
+    bool mFromGuestSnapshotMode = false;
 };
 
 }  // namespace emugl
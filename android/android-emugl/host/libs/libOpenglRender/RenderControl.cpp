@@ -21,6 +21,7 @@
 #include "FenceSync.h"
 #include "FrameBuffer.h"
 #include "GLESVersionDetector.h"
+#include "RenderCapture.h"
 #include "RenderContext.h"
 #include "RenderThreadInfo.h"
 #include "SyncThread.h"
@@ -738,6 +739,11 @@ static int rcUpdateColorBufferDMA(uint32_t colorBuffer,
         return -1;
     }
 
+    RenderThreadInfo* tInfo = RenderThreadInfo::get();
+    if (tInfo->m_capture) {
+        tInfo->m_capture->writeDma(pixels, pixels_size);
+    }
+
     fb->updateColorBuffer(colorBuffer, x, y, width, height,
                           format, type, pixels);
 
@@ -18,7 +18,9 @@
 #include "ChannelStream.h"
 #include "ErrorLog.h"
 #include "FrameBuffer.h"
+#include "ReadAheadStream.h"
 #include "ReadBuffer.h"
+#include "RenderCapture.h"
 #include "RenderControl.h"
 #include "RendererImpl.h"
 #include "RenderChannelImpl.h"
@@ -42,6 +44,10 @@ using android::base::AutoLock;
 
 namespace emugl {
 
+// Received bytes per second above which a render thread starts reading
+// and decoding ahead of the GL driver.
+static constexpr int64_t kReadAheadMinBandwidth = 8 * 1024 * 1024;
+
 struct RenderThread::SnapshotObjects {
     RenderThreadInfo* threadInfo;
     ChecksumCalculator* checksumCalc;
@@ -49,9 +55,6 @@ struct RenderThread::SnapshotObjects {
     ReadBuffer* readBuffer;
 };
 
-// Start with a smaller buffer to not waste memory on a low-used render threads.
-static constexpr int kStreamBufferSize = 128 * 1024;
-
 RenderThread::RenderThread(RenderChannelImpl* channel,
                            android::base::Stream* loadStream)
     : emugl::Thread(android::base::ThreadFlags::MaskSignals, 2 * 1024 * 1024),
@@ -188,6 +191,83 @@ void RenderThread::setFinished() {
     }
 }
 
+// static
+int RenderThread::nextPacketSize(ReadBuffer* readBuf) {
+    if (readBuf->validData() >= 8) {
+        // We know that packet size is the second int32_t from the start.
+        return *(const int32_t*)(readBuf->buf() + 4);
+    }
+    // Read enough data to at least be able to get the packet size next
+    // time.
+    return 8;
+}
+
+// static
+void RenderThread::decode(RenderThreadInfo* tInfo,
+                          ReadBuffer* readBuf,
+                          IOStream* stream,
+                          ChecksumCalculator* checksumCalc) {
+    bool progress;
+    do {
+        progress = false;
+
+        // try to process some of the command buffer using the GLESv1
+        // decoder
+        //
+        // DRIVER WORKAROUND:
+        // On Linux with NVIDIA GPU's at least, we need to avoid performing
+        // GLES ops while someone else holds the FrameBuffer write lock.
+        //
+        // To be more specific, on Linux with NVIDIA Quadro K2200 v361.xx,
+        // we get a segfault in the NVIDIA driver when glTexSubImage2D
+        // is called at the same time as glXMake(Context)Current.
+        //
+        // To fix, this driver workaround avoids calling
+        // any sort of GLES call when we are creating/destroying EGL
+        // contexts.
+        FrameBuffer::getFB()->lockContextStructureRead();
+        size_t last = tInfo->m_glDec.decode(
+                readBuf->buf(), readBuf->validData(), stream, checksumCalc);
+        if (last > 0) {
+            progress = true;
+            readBuf->consume(last);
+        }
+
+        //
+        // try to process some of the command buffer using the GLESv2
+        // decoder
+        //
+        last = tInfo->m_gl2Dec.decode(readBuf->buf(), readBuf->validData(),
+                                      stream, checksumCalc);
+        FrameBuffer::getFB()->unlockContextStructureRead();
+
+        if (last > 0) {
+            progress = true;
+            readBuf->consume(last);
+        }
+
+        //
+        // try to process some of the command buffer using the
+        // renderControl decoder
+        //
+        last = tInfo->m_rcDec.decode(readBuf->buf(), readBuf->validData(),
+                                     stream, checksumCalc);
+        if (last > 0) {
+            readBuf->consume(last);
+            progress = true;
+        }
+    } while (progress);
+}
+
+// static
+void RenderThread::execute(RenderThreadInfo* tInfo,
+                           const DecoderCommandList& cmds) {
+    // Same driver workaround as in decode().
+    FrameBuffer::getFB()->lockContextStructureRead();
+    tInfo->m_gl2Dec.execute(cmds);
+    FrameBuffer::getFB()->unlockContextStructureRead();
+}
+
 intptr_t RenderThread::main() {
     if (mFinished) {
         DBG("Error: fail loading a RenderThread @%p\n", this);
@@ -246,7 +326,7 @@ intptr_t RenderThread::main() {
         (void)flags;
     }
 
-    int stats_totalBytes = 0;
+    int64_t stats_totalBytes = 0;
     auto stats_t0 = android::base::System::get()->getHighResTimeUs() / 1000;
 
     //
@@ -266,21 +346,84 @@ intptr_t RenderThread::main() {
         delete[] fname;
     }
 
+    //
+    // capture the stream for offline replay if RENDERER_CAPTURE_DIR is
+    // defined. Threads restored from a snapshot are not captured, as
+    // their past is missing.
+    //
+    std::unique_ptr<RenderCaptureWriter> capture;
+    if (!needRestoreFromSnapshot) {
+        capture = RenderCaptureWriter::create(
+                FrameBuffer::getFB()->getWidth(),
+                FrameBuffer::getFB()->getHeight());
+        if (capture) {
+            // The |flags| read above are part of the stream too.
+            const uint32_t flags = 0;
+            capture->writeData(&flags, sizeof(flags));
+            tInfo.m_capture = capture.get();
+        }
+    }
+
+    //
+    // busy threads receive their stream from a separate read-ahead thread,
+    // unless RENDERER_NO_READ_AHEAD is defined. That thread also decodes
+    // the GLES 2/3 commands that don't need a reply, unless
+    // RENDERER_NO_DECODE_AHEAD is defined, and this thread only executes
+    // them. It stops at any other command, which is decoded here.
+    //
+    const bool canReadAhead = !getenv("RENDERER_NO_READ_AHEAD");
+    ReadAheadStream::Recorder recorder;
+    if (!getenv("RENDERER_NO_DECODE_AHEAD")) {
+        recorder = [&tInfo, &checksumCalc](const uint8_t* data, size_t size,
+                                           DecoderCommandList* cmds) {
+            return tInfo.m_gl2Dec.record((void*)data, size, cmds,
+                                         &checksumCalc);
+        };
+    }
+    bool wantReadAhead = false;
+    std::unique_ptr<ReadAheadStream> readAhead;
+
     while (1) {
-        // Let's make sure we read enough data for at least some processing.
-        int packetSize;
-        if (readBuf.validData() >= 8) {
-            // We know that packet size is the second int32_t from the start.
-            packetSize = *(const int32_t*)(readBuf.buf() + 4);
-        } else {
-            // Read enough data to at least be able to get the packet size next
-            // time.
-            packetSize = 8;
+        // The read-ahead thread frames the stream in packets, so it must
+        // start on a packet boundary.
+        if (wantReadAhead && !readAhead && readBuf.validData() == 0) {
+            readAhead.reset(new ReadAheadStream(&stream, recorder));
+        }
+
+        if (readAhead && readBuf.validData() == 0) {
+            const uint8_t* recorded;
+            size_t recordedSize;
+            if (const DecoderCommandList* cmds =
+                        readAhead->nextCommands(&recorded, &recordedSize)) {
+                stats_totalBytes += recordedSize;
+                if (dumpFP) {
+                    fwrite(recorded, 1, recordedSize, dumpFP);
+                    fflush(dumpFP);
+                }
+                if (capture) {
+                    capture->writeData(recorded, recordedSize);
+                }
+                execute(&tInfo, *cmds);
+                continue;
+            }
         }
 
+        // Let's make sure we read enough data for at least some processing.
+        const int packetSize = nextPacketSize(&readBuf);
+
         int stat = 0;
         if (packetSize > (int)readBuf.validData()) {
-            stat = readBuf.getData(&stream, packetSize);
+            if (readAhead) {
+                stat = readBuf.getData(readAhead.get(), packetSize);
+                if (stat <= 0) {
+                    // The channel was stopped, all the data received is in
+                    // |readBuf| now.
+                    readAhead.reset();
+                    wantReadAhead = false;
+                }
+            } else {
+                stat = readBuf.getData(&stream, packetSize);
+            }
             if (stat <= 0) {
                 if (doSnapshotOperation(snapshotObjects, SnapshotState::StartSaving)) {
                     continue;
@@ -315,6 +458,10 @@ intptr_t RenderThread::main() {
             // float dts = (float)dt / 1000.0f;
             // printf("Used Bandwidth %5.3f MB/s\n", ((float)stats_totalBytes /
             // dts) / (1024.0f*1024.0f));
+            if (canReadAhead &&
+                stats_totalBytes >= kReadAheadMinBandwidth * (int64_t)dt / 1000) {
+                wantReadAhead = true;
+            }
             stats_totalBytes = 0;
             stats_t0 = android::base::System::get()->getHighResTimeUs() / 1000;
         }
@@ -327,62 +474,19 @@ intptr_t RenderThread::main() {
             fwrite(readBuf.buf() + skip, 1, readBuf.validData() - skip, dumpFP);
             fflush(dumpFP);
         }
+        if (capture && stat > 0) {
+            capture->writeData(readBuf.buf() + readBuf.validData() - stat,
+                               stat);
+        }
 
-        bool progress;
-        do {
-            progress = false;
-
-            // try to process some of the command buffer using the GLESv1
-            // decoder
-            //
-            // DRIVER WORKAROUND:
-            // On Linux with NVIDIA GPU's at least, we need to avoid performing
-            // GLES ops while someone else holds the FrameBuffer write lock.
-            //
-            // To be more specific, on Linux with NVIDIA Quadro K2200 v361.xx,
-            // we get a segfault in the NVIDIA driver when glTexSubImage2D
-            // is called at the same time as glXMake(Context)Current.
-            //
-            // To fix, this driver workaround avoids calling
-            // any sort of GLES call when we are creating/destroying EGL
-            // contexts.
-            FrameBuffer::getFB()->lockContextStructureRead();
-            size_t last = tInfo.m_glDec.decode(
-                    readBuf.buf(), readBuf.validData(), &stream, &checksumCalc);
-            if (last > 0) {
-                progress = true;
-                readBuf.consume(last);
-            }
-
-            //
-            // try to process some of the command buffer using the GLESv2
-            // decoder
-            //
-            last = tInfo.m_gl2Dec.decode(readBuf.buf(), readBuf.validData(),
-                                         &stream, &checksumCalc);
-            FrameBuffer::getFB()->unlockContextStructureRead();
-
-            if (last > 0) {
-                progress = true;
-                readBuf.consume(last);
-            }
-
-            //
-            // try to process some of the command buffer using the
-            // renderControl decoder
-            //
-            last = tInfo.m_rcDec.decode(readBuf.buf(), readBuf.validData(),
-                                        &stream, &checksumCalc);
-            if (last > 0) {
-                readBuf.consume(last);
-                progress = true;
-            }
-        } while (progress);
+        decode(&tInfo, &readBuf, &stream, &checksumCalc);
     }
 
     if (dumpFP) {
         fclose(dumpFP);
     }
+    tInfo.m_capture = nullptr;
+    capture.reset();
 
     // Don't check for snapshots here: if we're already exiting then snapshot
     // should not contain this thread information at all.
@@ -24,8 +24,13 @@
 
 #include <memory>
 
+class ChecksumCalculator;
+class IOStream;
+struct RenderThreadInfo;
+
 namespace emugl {
 
+class DecoderCommandList;
 class RenderChannelImpl;
 class RendererImpl;
 class ReadBuffer;
@@ -49,10 +54,29 @@ public:
     void resume();
     void save(android::base::Stream* stream);
 
+    // Initial size of the read buffer. Start with a smaller buffer to not
+    // waste memory on a low-used render threads.
+    static constexpr int kStreamBufferSize = 128 * 1024;
+
+    // Returns how many bytes |readBuf| must hold before the next call to
+    // decode() can make progress.
+    static int nextPacketSize(ReadBuffer* readBuf);
+
+    // Runs the decoders of |tInfo| over the data in |readBuf| until none of
+    // them can make progress, consuming what they decoded. Replies go to
+    // |stream|. Also used by the capture replay tool.
+    static void decode(RenderThreadInfo* tInfo,
+                       ReadBuffer* readBuf,
+                       IOStream* stream,
+                       ChecksumCalculator* checksumCalc);
+
 private:
     virtual intptr_t main();
     void setFinished();
 
+    // Runs GLES 2/3 commands recorded ahead by the read-ahead thread.
+    static void execute(RenderThreadInfo* tInfo, const DecoderCommandList& cmds);
+
     // Snapshot support.
     enum class SnapshotState {
         Empty,
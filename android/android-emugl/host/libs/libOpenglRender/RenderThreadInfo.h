@@ -27,6 +27,10 @@
 
 #include <unordered_set>
 
+namespace emugl {
+class RenderCaptureWriter;
+}  // namespace emugl
+
 typedef uint32_t HandleType;
 typedef std::unordered_set<HandleType> ThreadContextSet;
 typedef std::unordered_set<HandleType> WindowSurfaceSet;
@@ -65,6 +69,10 @@ struct RenderThreadInfo {
     // The unique id of owner guest process of this render thread
     uint64_t                        m_puid = 0;
 
+    // Where to record the guest data this thread reads outside of its
+    // stream (i.e. DMA buffers), when capturing. See RenderCapture.h.
+    emugl::RenderCaptureWriter*     m_capture = nullptr;
+
     // Functions to save / load a snapshot
     // They must be called after Framebuffer snapshot
     void onSave(android::base::Stream* stream);
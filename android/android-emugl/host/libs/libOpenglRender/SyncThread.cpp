@@ -63,6 +63,8 @@ static LazyInstance<GlobalSyncThread> sGlobalSyncThread = LAZY_INSTANCE_INIT;
 
 static const uint32_t kTimelineInterval = 1;
 static const uint64_t kDefaultTimeoutNsecs = 5ULL * 1000ULL * 1000ULL * 1000ULL;
+// Bounds how many fence signals wait for the same timeline increment.
+static const uint32_t kMaxBatchedFences = 64;
 
 SyncThread::SyncThread() :
     emugl::Thread(android::base::ThreadFlags::MaskSignals, 512 * 1024) {
@@ -115,8 +117,16 @@ intptr_t SyncThread::main() {
         SyncThreadCmd cmd = {};
 
         DPRINT("waiting to receive command");
-        mInput.receive(&cmd);
+        // Batched increments are sent as soon as there's nothing
+        // else queued, rather than when the next command comes.
+        if (mPendingTimelineIncs.empty() || !mInput.tryReceive(&cmd)) {
+            flushTimelineIncs();
+            mInput.receive(&cmd);
+        }
         num_iter++;
+        if (cmd.opCode != SYNC_THREAD_WAIT) {
+            flushTimelineIncs();
+        }
 
         DPRINT("sync thread @%p num iter: %u", this, num_iter);
 
@@ -196,14 +206,24 @@ void SyncThread::doSyncWait(SyncThreadCmd* cmd) {
         FenceSync::getFromHandle((uint64_t)(uintptr_t)cmd->fenceSync);
 
     if (!fenceSync) {
-        emugl_sync_timeline_inc(cmd->timeline, kTimelineInterval);
+        addTimelineInc(cmd->timeline, false);
         return;
     }
 
     EGLint wait_result = 0x0;
 
     DPRINT("wait on sync obj: %p", cmd->fenceSync);
-    wait_result = cmd->fenceSync->wait(kDefaultTimeoutNsecs);
+    if (!mPendingTimelineIncs.empty()) {
+        // Only batch this one if it's already signaled; otherwise, signal
+        // the previous fences first instead of holding them back.
+        wait_result = cmd->fenceSync->wait(0);
+        if (wait_result == EGL_TIMEOUT_EXPIRED_KHR) {
+            flushTimelineIncs();
+        }
+    }
+    if (mPendingTimelineIncs.empty()) {
+        wait_result = cmd->fenceSync->wait(kDefaultTimeoutNsecs);
+    }
 
     DPRINT("done waiting, with wait result=0x%x. "
            "increment timeline (and signal fence)",
@@ -240,14 +260,43 @@ void SyncThread::doSyncWait(SyncThreadCmd* cmd) {
     //   incrementing the timeline means that the app's rendering freezes.
     //   So, despite the faulty GPU driver, not incrementing is too heavyweight a response.
 
-    emugl_sync_timeline_inc(cmd->timeline, kTimelineInterval);
-    FenceSync::incrementTimelineAndDeleteOldFences();
+    addTimelineInc(cmd->timeline, true);
 
     DPRINT("done timeline increment");
 
     DPRINT("exit");
 }
 
+void SyncThread::addTimelineInc(uint64_t timeline, bool hasFence) {
+    bool found = false;
+    for (auto& inc : mPendingTimelineIncs) {
+        if (inc.first == timeline) {
+            inc.second += kTimelineInterval;
+            found = true;
+            break;
+        }
+    }
+    if (!found) {
+        mPendingTimelineIncs.emplace_back(timeline, kTimelineInterval);
+    }
+    if (hasFence && ++mPendingFences >= kMaxBatchedFences) {
+        flushTimelineIncs();
+    }
+}
+
+void SyncThread::flushTimelineIncs() {
+    for (const auto& inc : mPendingTimelineIncs) {
+        DPRINT("timeline=0x%llx inc=%u",
+               (unsigned long long)inc.first, inc.second);
+        emugl_sync_timeline_inc(inc.first, inc.second);
+    }
+    mPendingTimelineIncs.clear();
+
+    for (; mPendingFences > 0; --mPendingFences) {
+        FenceSync::incrementTimelineAndDeleteOldFences();
+    }
+}
+
 void SyncThread::doExit() {
 
     if (mContext == EGL_NO_CONTEXT) return;
@@ -27,6 +27,9 @@
 
 #include "emugl/common/thread.h"
 
+#include <utility>
+#include <vector>
+
 // SyncThread///////////////////////////////////////////////////////////////////
 // The purpose of SyncThread is to track sync device timelines and give out +
 // signal FD's that correspond to the completion of host-side GL fence commands.
@@ -66,6 +69,8 @@ public:
     // which should signal the guest-side fence FD.
     // This method is how the goldfish sync virtual device
     // knows when to increment timelines / signal native fence FD's.
+    // Waits queued back to back whose fences are already signaled are
+    // batched into a single increment per timeline.
     void triggerWait(FenceSync* fenceSync,
                      uint64_t timeline);
     // |cleanup|: for use with destructors and other cleanup functions.
@@ -116,6 +121,15 @@ private:
     void doSyncWait(SyncThreadCmd* cmd);
     void doExit();
 
+    // Timeline increments of completed waits that have not been sent to
+    // the guest yet. They are sent all at once, one command per timeline,
+    // when there is no more signaled fence to add to them. Only used on
+    // the sync thread.
+    void addTimelineInc(uint64_t timeline, bool hasFence);
+    void flushTimelineIncs();
+    std::vector<std::pair<uint64_t, uint32_t>> mPendingTimelineIncs;
+    uint32_t mPendingFences = 0;
+
     // EGL objects / object handles specific to
     // a sync thread.
     EGLDisplay mDisplay = EGL_NO_DISPLAY;
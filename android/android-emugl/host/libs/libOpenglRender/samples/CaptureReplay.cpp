@@ -0,0 +1,368 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Offline replay of render thread captures (see RenderCapture.h), to
+// benchmark the host renderer without running an emulator:
+//
+//   RENDERER_CAPTURE_DIR=/tmp/cap emulator @avd ...
+//   CaptureReplay [-loops <n>] [-no-finish] /tmp/cap/capture_*.bin
+//
+// Each capture file is replayed by its own thread, through the same decode
+// loop as RenderThread. The threads take turns in the captured order, so
+// that objects shared between them (color buffers, fences...) are created
+// before being used. Replies to the guest are dropped.
+//
+// As with the other samples, SwiftShader is used unless
+// ANDROID_EMU_TEST_WITH_HOST_GPU=1 is set. Setting LIBGL_ALWAYS_SOFTWARE=1
+// as well replays on Mesa's llvmpipe, which is convenient on CI machines.
+
+#include "android/base/synchronization/ConditionVariable.h"
+#include "android/base/synchronization/Lock.h"
+#include "android/base/system/System.h"
+#include "android/base/threads/FunctorThread.h"
+
+#include "Standalone.h"
+
+#include "ReadBuffer.h"
+#include "RenderCapture.h"
+#include "RenderControl.h"
+#include "RenderThread.h"
+
+#include "OpenGLESDispatch/DispatchTables.h"
+#include "OpenGLESDispatch/GLESv1Dispatch.h"
+#include "OpenGLESDispatch/GLESv2Dispatch.h"
+#include "../../../shared/OpenglCodecCommon/ChecksumCalculatorThreadInfo.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using android::base::AutoLock;
+using android::base::ConditionVariable;
+using android::base::FunctorThread;
+using android::base::Lock;
+using android::base::System;
+
+namespace emugl {
+
+// Makes the replay threads feed their data records in capture order.
+class ReplayOrder {
+public:
+    void reset(const std::vector<RenderCapture>& captures) {
+        mSequences.clear();
+        for (const auto& capture : captures) {
+            for (const auto& record : capture.records) {
+                if (record.type == RenderCapture::RecordType::kData) {
+                    mSequences.push_back(record.sequence);
+                }
+            }
+        }
+        std::sort(mSequences.begin(), mSequences.end());
+        mTurn = 0;
+    }
+
+    // Block until it is the turn of the data record |sequence|.
+    void waitTurn(uint64_t sequence) {
+        AutoLock lock(mLock);
+        mCv.wait(&lock, [this, sequence] {
+            return mSequences[mTurn] == sequence;
+        });
+    }
+
+    // Called by the thread that owns the current turn once it is done.
+    void endTurn() {
+        AutoLock lock(mLock);
+        ++mTurn;
+        mCv.broadcastAndUnlock(&lock);
+    }
+
+private:
+    Lock mLock;
+    ConditionVariable mCv;
+    // Data record numbers of all the captures, sorted. Captures of a
+    // stopped emulator may have gaps, so turns go by rank in this list.
+    std::vector<uint64_t> mSequences;
+    size_t mTurn = 0;
+};
+
+// An IOStream that reads the records of a capture, and drops all writes.
+class ReplayStream final : public IOStream {
+public:
+    ReplayStream(const RenderCapture& capture, ReplayOrder* order)
+        : IOStream(kWriteBufferSize), mCapture(capture), mOrder(order) {}
+
+    ~ReplayStream() { flush(); }
+
+    void* getDmaForReading(uint64_t guest_paddr) override {
+        const auto record = nextRecord(RenderCapture::RecordType::kDma);
+        if (!record) {
+            ERR("%s: capture has no DMA data left\n", __func__);
+            return nullptr;
+        }
+        return const_cast<uint8_t*>(record->bytes.data());
+    }
+
+    void unlockDma(uint64_t guest_paddr) override {}
+
+protected:
+    void* allocBuffer(size_t minSize) override {
+        if (mWriteBuffer.size() < minSize) {
+            mWriteBuffer.resize(minSize);
+        }
+        return mWriteBuffer.data();
+    }
+
+    int commitBuffer(size_t size) override { return (int)size; }
+
+    const unsigned char* readRaw(void* buf, size_t* inout_len) override {
+        if (!mData || mDataPos == mData->bytes.size()) {
+            // Done with the current record: hand over to the next one in
+            // line, and wait for our own next one.
+            if (mData) {
+                mOrder->endTurn();
+            }
+            mData = nextRecord(RenderCapture::RecordType::kData);
+            mDataPos = 0;
+            if (!mData) {
+                return nullptr;
+            }
+            mOrder->waitTurn(mData->sequence);
+        }
+        const size_t size = std::min(*inout_len, mData->bytes.size() - mDataPos);
+        memcpy(buf, mData->bytes.data() + mDataPos, size);
+        mDataPos += size;
+        *inout_len = size;
+        return (const unsigned char*)buf;
+    }
+
+    void onSave(android::base::Stream* stream) override {
+        ERR("%s: not supported\n", __func__);
+    }
+
+    unsigned char* onLoad(android::base::Stream* stream) override {
+        ERR("%s: not supported\n", __func__);
+        return nullptr;
+    }
+
+private:
+    static constexpr size_t kWriteBufferSize = 16 * 1024;
+
+    // Returns the next record of |type|, or nullptr at the end of capture.
+    const RenderCapture::Record* nextRecord(RenderCapture::RecordType type) {
+        size_t& pos = type == RenderCapture::RecordType::kData ? mNextData
+                                                                : mNextDma;
+        for (; pos < mCapture.records.size(); ++pos) {
+            if (mCapture.records[pos].type == type) {
+                return &mCapture.records[pos++];
+            }
+        }
+        return nullptr;
+    }
+
+    const RenderCapture& mCapture;
+    ReplayOrder* const mOrder;
+    std::vector<uint8_t> mWriteBuffer;
+    const RenderCapture::Record* mData = nullptr;
+    size_t mDataPos = 0;
+    size_t mNextData = 0;
+    size_t mNextDma = 0;
+};
+
+// Timings of one replay loop, all in microseconds.
+struct ReplayStats {
+    System::WallDuration decodeUs = 0;  // Decoding and GL submission.
+    System::WallDuration finishUs = 0;  // Waiting for the GPU at each frame.
+    size_t frames = 0;
+    std::vector<System::WallDuration> frameUs;
+};
+
+// Replays |capture| on the calling thread. |stats| is shared with the
+// other replay threads, but turns keep them from running at the same time.
+static void replayCapture(const RenderCapture& capture,
+                          ReplayOrder* order,
+                          bool finishFrames,
+                          System::WallDuration* lastFrameUs,
+                          ReplayStats* stats) {
+    RenderThreadInfo tInfo;
+    ChecksumCalculatorThreadInfo tChecksumInfo;
+    ChecksumCalculator& checksumCalc = tChecksumInfo.get();
+
+    tInfo.m_glDec.initGL(gles1_dispatch_get_proc_func, nullptr);
+    tInfo.m_gl2Dec.initGL(gles2_dispatch_get_proc_func, nullptr);
+    initRenderControlContext(&tInfo.m_rcDec);
+
+    ReplayStream stream(capture, order);
+    ReadBuffer readBuf(RenderThread::kStreamBufferSize);
+    FrameBuffer* fb = FrameBuffer::getFB();
+
+    uint32_t flags = 0;
+    if (stream.read(&flags, sizeof(flags)) == sizeof(flags)) {
+        for (;;) {
+            const int packetSize = RenderThread::nextPacketSize(&readBuf);
+            if (packetSize > (int)readBuf.validData() &&
+                readBuf.getData(&stream, packetSize) <= 0) {
+                break;
+            }
+
+            const auto decodeStartUs = System::get()->getHighResTimeUs();
+            RenderThread::decode(&tInfo, &readBuf, &stream, &checksumCalc);
+            auto nowUs = System::get()->getHighResTimeUs();
+            stats->decodeUs += nowUs - decodeStartUs;
+
+            if (fb->hasGuestPostedAFrame()) {
+                fb->resetGuestPostedAFrame();
+                ++stats->frames;
+                if (finishFrames) {
+                    s_gles2.glFinish();
+                    const auto finishEndUs = System::get()->getHighResTimeUs();
+                    stats->finishUs += finishEndUs - nowUs;
+                    nowUs = finishEndUs;
+                }
+                if (*lastFrameUs) {
+                    stats->frameUs.push_back(nowUs - *lastFrameUs);
+                }
+                *lastFrameUs = nowUs;
+            }
+        }
+    }
+
+    fb->bindContext(0, 0, 0);
+    fb->drainWindowSurface();
+    fb->drainRenderContext();
+}
+
+static void printStats(const char* name,
+                       System::WallDuration wallUs,
+                       const ReplayStats& stats) {
+    printf("%s: wall %.2f ms, decode+submit %.2f ms, finish %.2f ms, "
+           "%zu frames\n",
+           name, wallUs / 1000.0, stats.decodeUs / 1000.0,
+           stats.finishUs / 1000.0, stats.frames);
+
+    if (stats.frameUs.empty()) {
+        return;
+    }
+    auto frames = stats.frameUs;
+    std::sort(frames.begin(), frames.end());
+    System::WallDuration totalUs = 0;
+    for (auto us : frames) {
+        totalUs += us;
+    }
+    auto percentile = [&frames](int p) {
+        return frames[(frames.size() - 1) * p / 100] / 1000.0;
+    };
+    printf("    frame time (ms): min %.2f avg %.2f p50 %.2f p90 %.2f "
+           "p99 %.2f max %.2f\n",
+           frames.front() / 1000.0, totalUs / 1000.0 / frames.size(),
+           percentile(50), percentile(90), percentile(99),
+           frames.back() / 1000.0);
+}
+
+}  // namespace emugl
+
+static void usage(const char* progName) {
+    fprintf(stderr,
+            "Usage: %s [-loops <count>] [-no-finish] <capture file>...\n"
+            "  -loops <count>  replay the captures <count> times (default 1)\n"
+            "  -no-finish      don't wait for the GPU at each posted frame\n",
+            progName);
+}
+
+int main(int argc, char** argv) {
+    using namespace emugl;
+
+    int loops = 1;
+    bool finishFrames = true;
+    std::vector<RenderCapture> captures;
+
+    for (int n = 1; n < argc; ++n) {
+        if (!strcmp(argv[n], "-loops") && n + 1 < argc) {
+            loops = std::max(1, atoi(argv[++n]));
+        } else if (!strcmp(argv[n], "-no-finish")) {
+            finishFrames = false;
+        } else if (argv[n][0] == '-') {
+            usage(argv[0]);
+            return 1;
+        } else {
+            captures.emplace_back();
+            if (!captures.back().load(argv[n])) {
+                return 1;
+            }
+        }
+    }
+    if (captures.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // Use the largest display of all the captures.
+    int width = 0;
+    int height = 0;
+    System::WallDuration capturedUs = 0;
+    for (const auto& capture : captures) {
+        width = std::max<int>(width, capture.width);
+        height = std::max<int>(height, capture.height);
+        if (!capture.records.empty()) {
+            capturedUs = std::max(capturedUs, capture.records.back().timeUs);
+        }
+    }
+
+    setupStandaloneLibrarySearchPaths();
+    LazyLoadedEGLDispatch::get();
+    LazyLoadedGLESv1Dispatch::get();
+    LazyLoadedGLESv2Dispatch::get();
+
+    const bool useHostGpu = shouldUseHostGpu();
+    if (!FrameBuffer::initialize(width, height, false /* useSubWindow */,
+                                 !useHostGpu /* egl2egl */)) {
+        fprintf(stderr, "%s: can't initialize the FrameBuffer\n", argv[0]);
+        return 1;
+    }
+    std::unique_ptr<FrameBuffer> fb(FrameBuffer::getFB());
+
+    printf("%zu capture(s), %dx%d, captured over %.2f ms\n", captures.size(),
+           width, height, capturedUs / 1000.0);
+
+    ReplayOrder order;
+    for (int loop = 0; loop < loops; ++loop) {
+        order.reset(captures);
+        ReplayStats stats;
+        System::WallDuration lastFrameUs = 0;
+
+        const auto startUs = System::get()->getHighResTimeUs();
+        std::vector<std::unique_ptr<FunctorThread>> threads;
+        for (const auto& capture : captures) {
+            threads.emplace_back(new FunctorThread([&, finishFrames] {
+                replayCapture(capture, &order, finishFrames, &lastFrameUs,
+                              &stats);
+            }));
+            threads.back()->start();
+        }
+        for (auto& thread : threads) {
+            thread->wait();
+        }
+        const auto wallUs = System::get()->getHighResTimeUs() - startUs;
+
+        char name[32];
+        snprintf(name, sizeof(name), "loop %d", loop + 1);
+        printStats(name, wallUs, stats);
+    }
+
+    fb->finalize();
+    return 0;
+}
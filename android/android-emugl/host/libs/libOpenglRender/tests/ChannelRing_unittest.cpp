@@ -0,0 +1,120 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ChannelRing.h"
+
+#include "android/base/threads/FunctorThread.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace emugl {
+
+TEST(ChannelRing, Capacity) {
+    ChannelRing ring(1000);
+    EXPECT_EQ(1024U, ring.capacity());
+    EXPECT_EQ(1024U, ring.writeAvailable());
+    EXPECT_EQ(0U, ring.readAvailable());
+
+    ring.reset(4096);
+    EXPECT_EQ(4096U, ring.capacity());
+}
+
+TEST(ChannelRing, ReadWrite) {
+    ChannelRing ring(16);
+    char buf[16];
+    EXPECT_EQ(0U, ring.read(buf, sizeof(buf)));
+
+    EXPECT_EQ(5U, ring.write("hello", 5));
+    EXPECT_EQ(5U, ring.readAvailable());
+    EXPECT_EQ(11U, ring.writeAvailable());
+
+    EXPECT_EQ(3U, ring.read(buf, 3));
+    EXPECT_EQ("hel", std::string(buf, 3));
+    EXPECT_EQ(2U, ring.read(buf, sizeof(buf)));
+    EXPECT_EQ("lo", std::string(buf, 2));
+    EXPECT_EQ(0U, ring.readAvailable());
+}
+
+TEST(ChannelRing, PartialWrite) {
+    ChannelRing ring(8);
+    EXPECT_EQ(8U, ring.write("0123456789", 10));
+    EXPECT_EQ(0U, ring.writeAvailable());
+    EXPECT_EQ(0U, ring.write("x", 1));
+
+    char buf[8];
+    EXPECT_EQ(8U, ring.read(buf, sizeof(buf)));
+    EXPECT_EQ("01234567", std::string(buf, 8));
+}
+
+TEST(ChannelRing, WrapAround) {
+    ChannelRing ring(8);
+    char buf[8];
+    EXPECT_EQ(6U, ring.write("abcdef", 6));
+    EXPECT_EQ(4U, ring.read(buf, 4));
+    // Wraps around the end of the buffer.
+    EXPECT_EQ(6U, ring.write("ghijkl", 6));
+    EXPECT_EQ(8U, ring.readAvailable());
+
+    EXPECT_EQ(3U, ring.peek(buf, 3));
+    EXPECT_EQ("efg", std::string(buf, 3));
+    EXPECT_EQ(8U, ring.readAvailable());
+
+    EXPECT_EQ(8U, ring.read(buf, sizeof(buf)));
+    EXPECT_EQ("efghijkl", std::string(buf, 8));
+}
+
+TEST(ChannelRing, ProducerConsumer) {
+    static constexpr size_t kTotal = 1024 * 1024;
+    ChannelRing ring(4096);
+
+    android::base::FunctorThread producer([&ring]() -> intptr_t {
+        std::vector<uint8_t> chunk(1000);
+        size_t pos = 0;
+        while (pos < kTotal) {
+            const size_t size = std::min(chunk.size(), kTotal - pos);
+            for (size_t n = 0; n < size; ++n) {
+                chunk[n] = (uint8_t)((pos + n) * 7);
+            }
+            size_t written = 0;
+            while (written < size) {
+                written += ring.write(chunk.data() + written, size - written);
+            }
+            pos += size;
+        }
+        return 0;
+    });
+    producer.start();
+
+    std::vector<uint8_t> buf(777);
+    size_t pos = 0;
+    size_t errors = 0;
+    while (pos < kTotal) {
+        const size_t len = ring.read(buf.data(), buf.size());
+        for (size_t n = 0; n < len; ++n) {
+            if (buf[n] != (uint8_t)((pos + n) * 7)) {
+                ++errors;
+            }
+        }
+        pos += len;
+    }
+    producer.wait();
+
+    EXPECT_EQ(0U, errors);
+    EXPECT_EQ(0U, ring.readAvailable());
+}
+
+}  // namespace emugl
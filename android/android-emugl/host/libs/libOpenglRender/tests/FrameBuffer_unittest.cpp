@@ -127,6 +127,18 @@ protected:
         m_texture_loader->join();
     }
 
+    // Close |handle| and let the delayed close go through, so that it goes
+    // to the color buffer pool if it can be reused.
+    void closeColorBufferForGood(HandleType handle) {
+        mFb->closeColorBuffer(handle);
+        mTestSystem.setUnixTime(mTestSystem.getUnixTime() + 3);
+        // Closing any color buffer handles the expired delayed closes.
+        HandleType other = mFb->createColorBuffer(
+                1, 1, GL_RGBA, FRAMEWORK_FORMAT_GL_COMPATIBLE);
+        EXPECT_EQ(0, mFb->openColorBuffer(other));
+        mFb->closeColorBuffer(other);
+    }
+
     bool mUseSubWindow = false;
     OSWindow* mWindow = nullptr;
     FrameBuffer* mFb = nullptr;
@@ -213,6 +225,64 @@ TEST_F(FrameBufferTest, CreateOpenUpdateCloseColorBuffer_FormatChange) {
     mFb->closeColorBuffer(handle);
 }
 
+// Tests that a closed color buffer is reused for the next one with the same
+// parameters, without the content of the previous one.
+TEST_F(FrameBufferTest, ColorBufferPoolReuse) {
+    HandleType handle =
+        mFb->createColorBuffer(mWidth, mHeight, GL_RGBA, FRAMEWORK_FORMAT_GL_COMPATIBLE);
+    EXPECT_NE(0, handle);
+    EXPECT_EQ(0, mFb->openColorBuffer(handle));
+    TestTexture forUpdate = createTestPatternRGBA8888(mWidth, mHeight);
+    mFb->updateColorBuffer(handle, 0, 0, mWidth, mHeight, GL_RGBA, GL_UNSIGNED_BYTE, forUpdate.data());
+    closeColorBufferForGood(handle);
+
+    const uint64_t hits = mFb->getColorBufferPoolHits();
+    HandleType reused =
+        mFb->createColorBuffer(mWidth, mHeight, GL_RGBA, FRAMEWORK_FORMAT_GL_COMPATIBLE);
+    EXPECT_NE(0, reused);
+    EXPECT_EQ(hits + 1, mFb->getColorBufferPoolHits());
+    EXPECT_EQ(0, mFb->openColorBuffer(reused));
+
+    TestTexture expected = createTestTextureRGBA8888SingleColor(mWidth, mHeight, 1.0f, 1.0f, 1.0f, 1.0f);
+    TestTexture forRead = createTestTextureRGBA8888SingleColor(mWidth, mHeight, 0.0f, 0.0f, 0.0f, 0.0f);
+    mFb->readColorBuffer(reused, 0, 0, mWidth, mHeight, GL_RGBA, GL_UNSIGNED_BYTE, forRead.data());
+    EXPECT_TRUE(ImageMatches(mWidth, mHeight, 4, mWidth, expected.data(), forRead.data()));
+
+    mFb->closeColorBuffer(reused);
+}
+
+// Tests that a color buffer still bound to a guest texture isn't reused:
+// the texture would alias the next guest buffer.
+TEST_F(FrameBufferTest, ColorBufferPoolSkipsBoundBuffers) {
+    auto gl = LazyLoadedGLESv2Dispatch::get();
+
+    HandleType context = mFb->createRenderContext(0, 0, GLESApi_3_0);
+    HandleType surface = mFb->createWindowSurface(0, mWidth, mHeight);
+    EXPECT_TRUE(mFb->bindContext(context, surface, surface));
+
+    HandleType handle =
+        mFb->createColorBuffer(mWidth, mHeight, GL_RGBA, FRAMEWORK_FORMAT_GL_COMPATIBLE);
+    EXPECT_NE(0, handle);
+    EXPECT_EQ(0, mFb->openColorBuffer(handle));
+
+    GLuint tex;
+    gl->glGenTextures(1, &tex);
+    gl->glBindTexture(GL_TEXTURE_2D, tex);
+    EXPECT_TRUE(mFb->bindColorBufferToTexture(handle));
+    closeColorBufferForGood(handle);
+
+    const uint64_t hits = mFb->getColorBufferPoolHits();
+    HandleType other =
+        mFb->createColorBuffer(mWidth, mHeight, GL_RGBA, FRAMEWORK_FORMAT_GL_COMPATIBLE);
+    EXPECT_NE(0, other);
+    EXPECT_EQ(hits, mFb->getColorBufferPoolHits());
+
+    gl->glDeleteTextures(1, &tex);
+    EXPECT_TRUE(mFb->bindContext(0, 0, 0));
+    mFb->closeColorBuffer(other);
+    mFb->DestroyWindowSurface(surface);
+}
+
 // Tests obtaining EGL configs from FrameBuffer.
 TEST_F(FrameBufferTest, Configs) {
     const FbConfigList* configs = mFb->getConfigs();
@@ -0,0 +1,226 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ReadAheadStream.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <string.h>
+
+namespace emugl {
+
+namespace {
+
+// A source stream that returns |data| at most |maxRead| bytes at a time,
+// then fails.
+class TestSourceStream final : public IOStream {
+public:
+    TestSourceStream(std::vector<uint8_t> data, size_t maxRead)
+        : IOStream(0), mData(std::move(data)), mMaxRead(maxRead) {}
+
+    void* getDmaForReading(uint64_t guest_paddr) override { return nullptr; }
+    void unlockDma(uint64_t guest_paddr) override {}
+
+protected:
+    void* allocBuffer(size_t minSize) override { return nullptr; }
+    int commitBuffer(size_t size) override { return -1; }
+
+    const unsigned char* readRaw(void* buf, size_t* inout_len) override {
+        if (mPos == mData.size()) {
+            return nullptr;
+        }
+        const size_t len = std::min({*inout_len, mMaxRead, mData.size() - mPos});
+        memcpy(buf, mData.data() + mPos, len);
+        mPos += len;
+        *inout_len = len;
+        return (const unsigned char*)buf;
+    }
+
+    void onSave(android::base::Stream* stream) override {}
+    unsigned char* onLoad(android::base::Stream* stream) override {
+        return nullptr;
+    }
+
+private:
+    std::vector<uint8_t> mData;
+    size_t mPos = 0;
+    const size_t mMaxRead;
+};
+
+// Append a packet of |size| bytes with opcode |opcode| to |stream|. The
+// header is always written whole, even if |size| is invalid.
+void addPacket(std::vector<uint8_t>* stream, uint32_t opcode, uint32_t size) {
+    const size_t start = stream->size();
+    stream->resize(start + std::max<uint32_t>(size, 8), (uint8_t)opcode);
+    memcpy(stream->data() + start, &opcode, sizeof(opcode));
+    memcpy(stream->data() + start + 4, &size, sizeof(size));
+}
+
+// Read all of |stream|, checking that each read ends on a packet boundary
+// of |expected| unless |framed| is false.
+std::vector<uint8_t> readAll(IOStream* stream,
+                             const std::vector<uint8_t>& expected,
+                             bool framed) {
+    std::vector<uint8_t> result;
+    std::vector<uint8_t> buf(1024 * 1024);
+    size_t nextPacket = 0;
+    for (;;) {
+        const size_t len = stream->read(buf.data(), buf.size());
+        if (!len) {
+            break;
+        }
+        result.insert(result.end(), buf.begin(), buf.begin() + len);
+        if (!framed) {
+            continue;
+        }
+        while (nextPacket < result.size()) {
+            uint32_t size;
+            memcpy(&size, expected.data() + nextPacket + 4, sizeof(size));
+            nextPacket += size;
+        }
+        EXPECT_EQ(nextPacket, result.size());
+    }
+    return result;
+}
+
+uint32_t packetWord(const uint8_t* packet, size_t index) {
+    uint32_t word;
+    memcpy(&word, packet + 4 * index, sizeof(word));
+    return word;
+}
+
+}  // namespace
+
+TEST(ReadAheadStream, SmallPackets) {
+    std::vector<uint8_t> data;
+    for (uint32_t n = 0; n < 10000; ++n) {
+        addPacket(&data, n, 8 + n % 64);
+    }
+    TestSourceStream source(data, 1000);
+    ReadAheadStream stream(&source);
+    EXPECT_EQ(data, readAll(&stream, data, true));
+}
+
+TEST(ReadAheadStream, LargePackets) {
+    std::vector<uint8_t> data;
+    addPacket(&data, 1, 16);
+    addPacket(&data, 2, 1024 * 1024);
+    addPacket(&data, 3, 12);
+    addPacket(&data, 4, 300 * 1024);
+    addPacket(&data, 5, 8);
+    TestSourceStream source(data, 4096);
+    ReadAheadStream stream(&source);
+    EXPECT_EQ(data, readAll(&stream, data, true));
+}
+
+TEST(ReadAheadStream, PartialPacketAtEnd) {
+    std::vector<uint8_t> data;
+    addPacket(&data, 1, 16);
+    addPacket(&data, 2, 100);
+    data.resize(data.size() - 10);
+    TestSourceStream source(data, 7);
+    ReadAheadStream stream(&source);
+    EXPECT_EQ(data, readAll(&stream, data, false));
+    // Stays at the end.
+    uint8_t byte;
+    EXPECT_EQ(0U, stream.read(&byte, 1));
+}
+
+TEST(ReadAheadStream, InvalidPacketSize) {
+    std::vector<uint8_t> data;
+    addPacket(&data, 1, 16);
+    addPacket(&data, 2, 4);
+    data.resize(data.size() + 100, 0xff);
+    TestSourceStream source(data, 50);
+    ReadAheadStream stream(&source);
+    EXPECT_EQ(data, readAll(&stream, data, false));
+}
+
+// Records packets with an even opcode, and stops at odd ones, which the
+// consumer then reads and decodes itself.
+TEST(ReadAheadStream, Recorder) {
+    std::vector<uint8_t> data;
+    std::vector<uint32_t> opcodes;
+    for (uint32_t n = 0; n < 20000; ++n) {
+        const uint32_t opcode = n % 97 ? 2 * n : 2 * n + 1;
+        addPacket(&data, opcode, 8 + n % 64);
+        opcodes.push_back(opcode);
+    }
+
+    // Packets left to the consumer, as seen by the recorder and the consumer.
+    size_t left = 0;
+    std::atomic<size_t> decoded(0);
+    auto recorder = [&left, &decoded](const uint8_t* data, size_t size,
+                                      DecoderCommandList* cmds) {
+        // Everything left to the consumer before must have been decoded.
+        EXPECT_EQ(left, decoded.load());
+        size_t pos = 0;
+        while (pos < size && packetWord(data + pos, 0) % 2 == 0) {
+            *cmds->append<uint32_t>(packetWord(data + pos, 0)) =
+                    packetWord(data + pos, 1);
+            pos += packetWord(data + pos, 1);
+        }
+        for (size_t end = pos; end < size; end += packetWord(data + end, 1)) {
+            ++left;
+        }
+        return pos;
+    };
+
+    TestSourceStream source(data, 1000);
+    ReadAheadStream stream(&source, recorder);
+    std::vector<uint32_t> seen;
+    std::vector<uint8_t> buf(1024 * 1024);
+    for (;;) {
+        const uint8_t* recorded;
+        size_t recordedSize;
+        if (const DecoderCommandList* cmds =
+                    stream.nextCommands(&recorded, &recordedSize)) {
+            size_t pos = 0;
+            for (const unsigned char* ptr = cmds->data();
+                 ptr < cmds->data() + cmds->size();) {
+                auto header = (const DecoderCommandList::Header*)ptr;
+                EXPECT_EQ(packetWord(recorded + pos, 0), header->opcode);
+                seen.push_back(header->opcode);
+                pos += *(const uint32_t*)(header + 1);
+                ptr += header->size;
+            }
+            EXPECT_EQ(recordedSize, pos);
+            continue;
+        }
+        const size_t len = stream.read(buf.data(), buf.size());
+        if (!len) {
+            break;
+        }
+        for (size_t pos = 0; pos < len; pos += packetWord(&buf[pos], 1)) {
+            seen.push_back(packetWord(&buf[pos], 0));
+            ++decoded;
+        }
+    }
+    EXPECT_EQ(opcodes, seen);
+}
+
+TEST(ReadAheadStream, DestroyBeforeConsuming) {
+    std::vector<uint8_t> data;
+    for (uint32_t n = 0; n < 100000; ++n) {
+        addPacket(&data, n, 16);
+    }
+    TestSourceStream source(data, 64 * 1024);
+    ReadAheadStream stream(&source);
+}
+
+}  // namespace emugl
@@ -0,0 +1,327 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ShaderCache.h"
+
+#include "android/base/misc/FileUtils.h"
+#include "android/base/system/System.h"
+#include "android/base/testing/TestTempDir.h"
+
+#include "OpenGLTestContext.h"
+#include "ShaderUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+#include <utime.h>
+
+using android::base::System;
+using android::base::TestTempDir;
+
+namespace emugl {
+
+// A driver that can export program binaries, whose binary for a program is
+// just the program name.
+static const char kFakeRenderer[] = "Fake renderer";
+static const GLenum kFakeFormat = 0x1234;
+static const char* sFakeRenderer = kFakeRenderer;
+static std::vector<char> sFakeBinary;
+static GLint sFakeLinkStatus = GL_FALSE;
+
+static void GL_APIENTRY fakeGetIntegerv(GLenum pname, GLint* params) {
+    *params = pname == GL_NUM_PROGRAM_BINARY_FORMATS ? 1 : 0;
+}
+
+static const GLubyte* GL_APIENTRY fakeGetString(GLenum name) {
+    return reinterpret_cast<const GLubyte*>(
+            name == GL_RENDERER ? sFakeRenderer : "Fake");
+}
+
+static void GL_APIENTRY fakeGetProgramiv(GLuint program,
+                                         GLenum pname,
+                                         GLint* params) {
+    *params = pname == GL_PROGRAM_BINARY_LENGTH ? sizeof(program)
+                                                : sFakeLinkStatus;
+}
+
+static void GL_APIENTRY fakeGetProgramBinary(GLuint program,
+                                             GLsizei bufsize,
+                                             GLsizei* length,
+                                             GLenum* binaryFormat,
+                                             void* binary) {
+    *length = sizeof(program);
+    *binaryFormat = kFakeFormat;
+    memcpy(binary, &program, sizeof(program));
+}
+
+static void GL_APIENTRY fakeProgramBinary(GLuint program,
+                                          GLenum binaryFormat,
+                                          const void* binary,
+                                          GLsizei length) {
+    sFakeBinary.assign(static_cast<const char*>(binary),
+                       static_cast<const char*>(binary) + length);
+    sFakeLinkStatus = binaryFormat == kFakeFormat ? GL_TRUE : GL_FALSE;
+}
+
+struct FakeDispatch {
+    decltype(&fakeGetIntegerv) glGetIntegerv = fakeGetIntegerv;
+    decltype(&fakeGetString) glGetString = fakeGetString;
+    decltype(&fakeGetProgramiv) glGetProgramiv = fakeGetProgramiv;
+    decltype(&fakeGetProgramBinary) glGetProgramBinary = fakeGetProgramBinary;
+    decltype(&fakeProgramBinary) glProgramBinary = fakeProgramBinary;
+};
+
+class ShaderCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(mTempDir.path());
+        sFakeRenderer = kFakeRenderer;
+        sFakeBinary.clear();
+        sFakeLinkStatus = GL_TRUE;
+    }
+
+    std::vector<std::string> entries() {
+        auto entries = System::get()->scanDirEntries(mTempDir.path(), true);
+        std::sort(entries.begin(), entries.end());
+        return entries;
+    }
+
+    static void writeFile(const std::string& path, const std::string& data) {
+        FILE* file = fopen(path.c_str(), "wb");
+        ASSERT_TRUE(file);
+        EXPECT_EQ(data.size(), fwrite(data.data(), 1, data.size(), file));
+        fclose(file);
+    }
+
+    static ShaderCache::Translation makeTranslation(const std::string& code) {
+        ShaderCache::Translation translation;
+        translation.valid = true;
+        translation.infoLog = "info log";
+        translation.objCode = code;
+        translation.linkInfo.esslVersion = 300;
+        return translation;
+    }
+
+    TestTempDir mTempDir{"shadercache"};
+};
+
+TEST_F(ShaderCacheTest, Disabled) {
+    ShaderCache cache("");
+    EXPECT_FALSE(cache.enabled());
+
+    cache.putTranslation("key", makeTranslation("code"));
+    ShaderCache::Translation translation;
+    EXPECT_FALSE(cache.getTranslation("key", &translation));
+}
+
+TEST_F(ShaderCacheTest, TranslationRoundTrip) {
+    ShaderCache::Translation saved = makeTranslation("void main() {}");
+    sh::Uniform uniform;
+    uniform.type = GL_FLOAT_VEC4;
+    uniform.precision = GL_HIGH_FLOAT;
+    uniform.name = "color";
+    uniform.mappedName = "_ucolor";
+    uniform.staticUse = true;
+    saved.linkInfo.uniforms.push_back(uniform);
+    sh::Attribute attribute;
+    attribute.type = GL_FLOAT_VEC3;
+    attribute.name = "position";
+    attribute.mappedName = "_uposition";
+    attribute.location = 2;
+    saved.linkInfo.attributes.push_back(attribute);
+    saved.linkInfo.nameMap["color"] = "_ucolor";
+    saved.linkInfo.nameMapReverse["_ucolor"] = "color";
+
+    ShaderCache(mTempDir.pathString()).putTranslation("key", saved);
+
+    // Read it back as the next emulator run would.
+    ShaderCache cache(mTempDir.pathString());
+    ShaderCache::Translation loaded;
+    ASSERT_TRUE(cache.getTranslation("key", &loaded));
+    EXPECT_EQ(saved.valid, loaded.valid);
+    EXPECT_EQ(saved.infoLog, loaded.infoLog);
+    EXPECT_EQ(saved.objCode, loaded.objCode);
+    EXPECT_EQ(300, loaded.linkInfo.esslVersion);
+    ASSERT_EQ(1U, loaded.linkInfo.uniforms.size());
+    EXPECT_EQ(uniform.type, loaded.linkInfo.uniforms[0].type);
+    EXPECT_EQ(uniform.precision, loaded.linkInfo.uniforms[0].precision);
+    EXPECT_EQ(uniform.name, loaded.linkInfo.uniforms[0].name);
+    EXPECT_EQ(uniform.mappedName, loaded.linkInfo.uniforms[0].mappedName);
+    EXPECT_TRUE(loaded.linkInfo.uniforms[0].staticUse);
+    ASSERT_EQ(1U, loaded.linkInfo.attributes.size());
+    EXPECT_EQ(attribute.name, loaded.linkInfo.attributes[0].name);
+    EXPECT_EQ(2, loaded.linkInfo.attributes[0].location);
+    EXPECT_EQ(saved.linkInfo.nameMap, loaded.linkInfo.nameMap);
+    EXPECT_EQ(saved.linkInfo.nameMapReverse, loaded.linkInfo.nameMapReverse);
+
+    EXPECT_FALSE(cache.getTranslation("other key", &loaded));
+}
+
+TEST_F(ShaderCacheTest, RejectsCorruptEntry) {
+    ShaderCache cache(mTempDir.pathString());
+    cache.putTranslation("key", makeTranslation("void main() {}"));
+    const auto paths = entries();
+    ASSERT_EQ(1U, paths.size());
+
+    auto data = android::readFileIntoString(paths[0]);
+    ASSERT_TRUE(data);
+    data->back() ^= 1;
+    writeFile(paths[0], *data);
+
+    ShaderCache::Translation translation;
+    EXPECT_FALSE(cache.getTranslation("key", &translation));
+
+    // A truncated entry is rejected too.
+    writeFile(paths[0], data->substr(0, data->size() / 2));
+    EXPECT_FALSE(cache.getTranslation("key", &translation));
+}
+
+TEST_F(ShaderCacheTest, RejectsOtherKey) {
+    ShaderCache cache(mTempDir.pathString());
+    cache.putTranslation("first", makeTranslation("first code"));
+    const auto firstPaths = entries();
+    ASSERT_EQ(1U, firstPaths.size());
+    cache.putTranslation("second", makeTranslation("second code"));
+    auto paths = entries();
+    ASSERT_EQ(2U, paths.size());
+    paths.erase(std::find(paths.begin(), paths.end(), firstPaths[0]));
+
+    // Make the second entry a valid copy of the first one, as if their key
+    // hashes collided.
+    auto data = android::readFileIntoString(firstPaths[0]);
+    ASSERT_TRUE(data);
+    writeFile(paths[0], *data);
+
+    ShaderCache::Translation translation;
+    EXPECT_FALSE(cache.getTranslation("second", &translation));
+    ASSERT_TRUE(cache.getTranslation("first", &translation));
+    EXPECT_EQ("first code", translation.objCode);
+}
+
+TEST_F(ShaderCacheTest, EvictsOldestEntries) {
+    {
+        ShaderCache cache(mTempDir.pathString());
+        for (char key = '0'; key < '4'; ++key) {
+            cache.putTranslation(std::string(1, key),
+                                 makeTranslation(std::string(1000, key)));
+        }
+    }
+
+    // Give the entries distinct ages, "0" being the oldest.
+    const time_t now = System::get()->getUnixTime();
+    System::FileSize totalSize = 0;
+    for (char key = '0'; key < '4'; ++key) {
+        for (const auto& path : entries()) {
+            auto data = android::readFileIntoString(path);
+            ASSERT_TRUE(data);
+            if (data->find(std::string(1000, key)) != std::string::npos) {
+                utimbuf times = {now, now - 1000 + key * 10};
+                ASSERT_EQ(0, utime(path.c_str(), &times));
+                totalSize += data->size();
+            }
+        }
+    }
+
+    // All entries have the same size, so this leaves the newest two.
+    ShaderCache cache(mTempDir.pathString(), totalSize - 1);
+    EXPECT_EQ(2U, entries().size());
+    ShaderCache::Translation translation;
+    EXPECT_FALSE(cache.getTranslation("0", &translation));
+    EXPECT_FALSE(cache.getTranslation("1", &translation));
+    EXPECT_TRUE(cache.getTranslation("2", &translation));
+    EXPECT_TRUE(cache.getTranslation("3", &translation));
+
+    // Nothing is evicted under the limit.
+    ShaderCache(mTempDir.pathString(), totalSize - 1);
+    EXPECT_EQ(2U, entries().size());
+}
+
+TEST_F(ShaderCacheTest, ProgramRoundTrip) {
+    const FakeDispatch gl;
+    const GLuint program = 42;
+    ShaderCache(mTempDir.pathString()).saveProgram(gl, program, "key");
+
+    ShaderCache cache(mTempDir.pathString());
+    sFakeLinkStatus = GL_FALSE;
+    EXPECT_TRUE(cache.loadProgram(gl, 7, "key"));
+    ASSERT_EQ(sizeof(program), sFakeBinary.size());
+    EXPECT_EQ(0, memcmp(&program, sFakeBinary.data(), sizeof(program)));
+
+    EXPECT_FALSE(cache.loadProgram(gl, 7, "other key"));
+}
+
+TEST_F(ShaderCacheTest, ProgramFromOtherDriver) {
+    const FakeDispatch gl;
+    ShaderCache(mTempDir.pathString()).saveProgram(gl, 42, "key");
+
+    sFakeRenderer = "Updated fake renderer";
+    sFakeBinary.clear();
+    EXPECT_FALSE(ShaderCache(mTempDir.pathString()).loadProgram(gl, 7, "key"));
+    EXPECT_TRUE(sFakeBinary.empty());
+}
+
+class ShaderCacheGLTest : public GLTest {
+protected:
+    TestTempDir mTempDir{"shadercache"};
+};
+
+// When the driver rejects a cached binary, the program must still link from
+// its shaders as usual.
+TEST_F(ShaderCacheGLTest, LinksAfterRejectedBinary) {
+    ASSERT_TRUE(mTempDir.path());
+    sFakeRenderer = kFakeRenderer;
+
+    const char* vshaderSrc =
+            "attribute vec4 position;\n"
+            "void main() { gl_Position = position; }\n";
+    const char* fshaderSrc =
+            "precision mediump float;\n"
+            "void main() { gl_FragColor = vec4(1.0); }\n";
+    GLuint vshader = compileShader(GL_VERTEX_SHADER, vshaderSrc);
+    GLuint fshader = compileShader(GL_FRAGMENT_SHADER, fshaderSrc);
+    GLuint program = gl->glCreateProgram();
+    gl->glAttachShader(program, vshader);
+    gl->glAttachShader(program, fshader);
+
+    // Save a binary the real driver doesn't know, under the fake driver's
+    // identity, then load it into the real program.
+    ShaderCache(mTempDir.pathString()).saveProgram(FakeDispatch(), program,
+                                                   "key");
+    ShaderCache::GLFuncs funcs(*gl);
+    funcs.glGetIntegerv = fakeGetIntegerv;
+    funcs.glGetString = fakeGetString;
+    EXPECT_FALSE(ShaderCache(mTempDir.pathString())
+                         .loadProgram(funcs, program, "key"));
+    while (gl->glGetError() != GL_NO_ERROR) {
+    }
+
+    gl->glLinkProgram(program);
+    GLint linkStatus = GL_FALSE;
+    gl->glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    EXPECT_EQ(GL_TRUE, linkStatus);
+    gl->glUseProgram(program);
+    EXPECT_EQ(GL_NO_ERROR, gl->glGetError());
+
+    gl->glUseProgram(0);
+    gl->glDeleteProgram(program);
+    gl->glDeleteShader(vshader);
+    gl->glDeleteShader(fshader);
+}
+
+}  // namespace emugl
@@ -0,0 +1,379 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/goldfish_vk_marshaling.h"
+#include "common/goldfish_vk_opcodes.h"
+#include "guest/goldfish_vk_encoder.h"
+#include "host/goldfish_vk_decoder.h"
+#include "host/goldfish_vk_dispatch.h"
+#include "VulkanHandleTable.h"
+#include "VulkanStream.h"
+
+#include "OpenglRender/IOStream.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <string.h>
+
+namespace goldfish_vk {
+
+namespace {
+
+// Collects the replies of the decoder.
+class ReplyStream final : public IOStream {
+public:
+    ReplyStream() : IOStream(4096) {}
+
+    std::vector<uint8_t>& replies() { return mReplies; }
+
+    void* getDmaForReading(uint64_t guest_paddr) override { return nullptr; }
+    void unlockDma(uint64_t guest_paddr) override {}
+
+protected:
+    void* allocBuffer(size_t minSize) override {
+        mBuffer.resize(minSize);
+        return mBuffer.data();
+    }
+    int commitBuffer(size_t size) override {
+        mReplies.insert(mReplies.end(), mBuffer.begin(),
+                        mBuffer.begin() + size);
+        return 0;
+    }
+    const unsigned char* readRaw(void* buf, size_t* inout_len) override {
+        return nullptr;
+    }
+    void onSave(android::base::Stream* stream) override {}
+    unsigned char* onLoad(android::base::Stream* stream) override {
+        return nullptr;
+    }
+
+private:
+    std::vector<uint8_t> mBuffer;
+    std::vector<uint8_t> mReplies;
+};
+
+// Hands everything the guest sends to a decoder, as a render thread would.
+class LoopbackTransport final : public VulkanTransport {
+public:
+    explicit LoopbackTransport(const VulkanDispatch* vk) : mDecoder(vk) {}
+
+    void send(const void* data, size_t size) override {
+        ++mSends;
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        mPending.insert(mPending.end(), bytes, bytes + size);
+        const size_t consumed =
+                mDecoder.decode(mPending.data(), mPending.size(), &mReplies);
+        mPending.erase(mPending.begin(), mPending.begin() + consumed);
+    }
+
+    void receive(void* data, size_t size) override {
+        std::vector<uint8_t>& replies = mReplies.replies();
+        ASSERT_LE(size, replies.size());
+        memcpy(data, replies.data(), size);
+        replies.erase(replies.begin(), replies.begin() + size);
+    }
+
+    int sends() const { return mSends; }
+
+private:
+    VkDecoder mDecoder;
+    ReplyStream mReplies;
+    std::vector<uint8_t> mPending;
+    int mSends = 0;
+};
+
+// What the fake host driver was called with.
+struct FakeDriver {
+    std::string applicationName;
+    std::vector<std::string> extensions;
+    VkInstance destroyedInstance = VK_NULL_HANDLE;
+    int enumerateCalls = 0;
+    VkCommandBuffer drawCommandBuffer = VK_NULL_HANDLE;
+    int draws = 0;
+    uint32_t lastVertexCount = 0;
+};
+
+FakeDriver sDriver;
+
+const VkInstance kHostInstance = (VkInstance)(uintptr_t)0x5a5a0000;
+const VkPhysicalDevice kHostPhysicalDevices[] = {
+        (VkPhysicalDevice)(uintptr_t)0x5a5a1000,
+        (VkPhysicalDevice)(uintptr_t)0x5a5a2000,
+};
+
+VKAPI_ATTR VkResult VKAPI_CALL fakeCreateInstance(
+        const VkInstanceCreateInfo* pCreateInfo,
+        const VkAllocationCallbacks* pAllocator,
+        VkInstance* pInstance) {
+    sDriver.applicationName = pCreateInfo->pApplicationInfo->pApplicationName;
+    for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; ++i) {
+        sDriver.extensions.push_back(pCreateInfo->ppEnabledExtensionNames[i]);
+    }
+    *pInstance = kHostInstance;
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL fakeDestroyInstance(
+        VkInstance instance,
+        const VkAllocationCallbacks* pAllocator) {
+    sDriver.destroyedInstance = instance;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL fakeEnumeratePhysicalDevices(
+        VkInstance instance,
+        uint32_t* pPhysicalDeviceCount,
+        VkPhysicalDevice* pPhysicalDevices) {
+    ++sDriver.enumerateCalls;
+    if (instance != kHostInstance) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    if (!pPhysicalDevices) {
+        *pPhysicalDeviceCount = 2;
+        return VK_SUCCESS;
+    }
+    const uint32_t count = std::min(*pPhysicalDeviceCount, 2u);
+    for (uint32_t i = 0; i < count; ++i) {
+        pPhysicalDevices[i] = kHostPhysicalDevices[i];
+    }
+    *pPhysicalDeviceCount = count;
+    return count < 2 ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL fakeAllocateCommandBuffers(
+        VkDevice device,
+        const VkCommandBufferAllocateInfo* pAllocateInfo,
+        VkCommandBuffer* pCommandBuffers) {
+    for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+        pCommandBuffers[i] = (VkCommandBuffer)(uintptr_t)(0x5a5a3000 + i * 16);
+    }
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL fakeCmdDraw(
+        VkCommandBuffer commandBuffer,
+        uint32_t vertexCount,
+        uint32_t instanceCount,
+        uint32_t firstVertex,
+        uint32_t firstInstance) {
+    sDriver.drawCommandBuffer = commandBuffer;
+    sDriver.lastVertexCount = vertexCount;
+    ++sDriver.draws;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL fakeQueueWaitIdle(VkQueue queue) {
+    return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL fakeGetPhysicalDeviceFeatures2(
+        VkPhysicalDevice physicalDevice,
+        VkPhysicalDeviceFeatures2* pFeatures) {
+    pFeatures->features.robustBufferAccess = VK_TRUE;
+    for (VkBaseOutStructure* ext = (VkBaseOutStructure*)pFeatures->pNext;
+         ext; ext = ext->pNext) {
+        if (ext->sType ==
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTER_FEATURES) {
+            ((VkPhysicalDeviceVariablePointerFeatures*)ext)->variablePointers =
+                    VK_TRUE;
+        }
+    }
+}
+
+class VkDecoderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        sDriver = FakeDriver();
+        mVk = {};
+        mVk.vkCreateInstance = fakeCreateInstance;
+        mVk.vkDestroyInstance = fakeDestroyInstance;
+        mVk.vkEnumeratePhysicalDevices = fakeEnumeratePhysicalDevices;
+        mVk.vkAllocateCommandBuffers = fakeAllocateCommandBuffers;
+        mVk.vkCmdDraw = fakeCmdDraw;
+        mVk.vkQueueWaitIdle = fakeQueueWaitIdle;
+        mVk.vkGetPhysicalDeviceFeatures2 = fakeGetPhysicalDeviceFeatures2;
+        mTransport.reset(new LoopbackTransport(&mVk));
+        mStream.reset(new VulkanStream(mTransport.get(), &mHandleMapping));
+    }
+
+    VulkanDispatch mVk;
+    VulkanHandleMapping mHandleMapping;
+    std::unique_ptr<LoopbackTransport> mTransport;
+    std::unique_ptr<VulkanStream> mStream;
+};
+
+}  // namespace
+
+TEST_F(VkDecoderTest, CreateEnumerateDestroy) {
+    const char* extensions[] = {"VK_KHR_surface", "VK_KHR_android_surface"};
+    VkApplicationInfo appInfo = {};
+    appInfo.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    appInfo.pApplicationName = "VkDecoderTest";
+    VkInstanceCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    createInfo.pApplicationInfo = &appInfo;
+    createInfo.enabledExtensionCount = 2;
+    createInfo.ppEnabledExtensionNames = extensions;
+
+    VkInstance instance = VK_NULL_HANDLE;
+    EXPECT_EQ(VK_SUCCESS, encode_vkCreateInstance(mStream.get(), &createInfo,
+                                                  nullptr, &instance));
+    EXPECT_EQ("VkDecoderTest", sDriver.applicationName);
+    EXPECT_EQ(std::vector<std::string>(extensions, extensions + 2),
+              sDriver.extensions);
+    EXPECT_NE(nullptr, instance);
+    EXPECT_NE(kHostInstance, instance);
+
+    uint32_t count = 0;
+    EXPECT_EQ(VK_SUCCESS, encode_vkEnumeratePhysicalDevices(
+                                  mStream.get(), instance, &count, nullptr));
+    EXPECT_EQ(2u, count);
+
+    VkPhysicalDevice physicalDevices[2] = {};
+    count = 1;
+    EXPECT_EQ(VK_INCOMPLETE,
+              encode_vkEnumeratePhysicalDevices(mStream.get(), instance,
+                                                &count, physicalDevices));
+    EXPECT_EQ(1u, count);
+    EXPECT_NE(nullptr, physicalDevices[0]);
+    EXPECT_EQ(nullptr, physicalDevices[1]);
+
+    encode_vkDestroyInstance(mStream.get(), instance, nullptr);
+    mStream->flush();
+    EXPECT_EQ(kHostInstance, sDriver.destroyedInstance);
+
+    // The id of a destroyed handle is rejected without calling the driver.
+    const int enumerateCalls = sDriver.enumerateCalls;
+    EXPECT_EQ(VK_ERROR_DEVICE_LOST,
+              encode_vkEnumeratePhysicalDevices(mStream.get(), instance,
+                                                &count, nullptr));
+    EXPECT_EQ(enumerateCalls, sDriver.enumerateCalls);
+}
+
+TEST_F(VkDecoderTest, CommandsAreBatched) {
+    VkCommandBufferAllocateInfo allocateInfo = {};
+    allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocateInfo.commandBufferCount = 2;
+    VkCommandBuffer commandBuffers[2] = {};
+    EXPECT_EQ(VK_SUCCESS,
+              encode_vkAllocateCommandBuffers(mStream.get(), VK_NULL_HANDLE,
+                                              &allocateInfo, commandBuffers));
+    EXPECT_NE(commandBuffers[0], commandBuffers[1]);
+
+    const int sends = mTransport->sends();
+    for (uint32_t i = 1; i <= 1000; ++i) {
+        encode_vkCmdDraw(mStream.get(), commandBuffers[1], i, 1, 0, 0);
+    }
+    EXPECT_EQ(sends, mTransport->sends());
+    EXPECT_EQ(0, sDriver.draws);
+
+    // The next command that needs a reply sends them all at once.
+    EXPECT_EQ(VK_SUCCESS, encode_vkQueueWaitIdle(mStream.get(), VK_NULL_HANDLE));
+    EXPECT_EQ(sends + 1, mTransport->sends());
+    EXPECT_EQ(1000, sDriver.draws);
+    EXPECT_EQ(1000u, sDriver.lastVertexCount);
+    EXPECT_EQ((VkCommandBuffer)(uintptr_t)0x5a5a3010, sDriver.drawCommandBuffer);
+}
+
+TEST_F(VkDecoderTest, OutputExtensionStructs) {
+    // A structure the wire format doesn't know is skipped, and stays as it
+    // is.
+    struct {
+        VkStructureType sType;
+        void* pNext;
+        uint32_t value;
+    } unknown = {(VkStructureType)0x7fff0000, nullptr, 42};
+    VkPhysicalDeviceVariablePointerFeatures variablePointers = {};
+    variablePointers.sType =
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTER_FEATURES;
+    unknown.pNext = &variablePointers;
+    VkPhysicalDeviceFeatures2 features = {};
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features.pNext = &unknown;
+
+    encode_vkGetPhysicalDeviceFeatures2(mStream.get(), VK_NULL_HANDLE,
+                                        &features);
+    EXPECT_EQ(VK_TRUE, features.features.robustBufferAccess);
+    EXPECT_EQ(&unknown, features.pNext);
+    EXPECT_EQ(42u, unknown.value);
+    EXPECT_EQ(&variablePointers, unknown.pNext);
+    EXPECT_EQ(VK_TRUE, variablePointers.variablePointers);
+}
+
+TEST_F(VkDecoderTest, MalformedPackets) {
+    VkDecoder decoder(&mVk);
+    ReplyStream replies;
+
+    // vkCmdDraw() without its parameters.
+    uint32_t truncated[3] = {OP_vkCmdDraw, sizeof(truncated), 0};
+    EXPECT_EQ(sizeof(truncated),
+              decoder.decode(truncated, sizeof(truncated), &replies));
+    EXPECT_EQ(0, sDriver.draws);
+
+    // Incomplete packets are left for the next call.
+    // vkCmdDraw(VK_NULL_HANDLE, 3, 3, 3, 3).
+    uint32_t packet[8] = {OP_vkCmdDraw, sizeof(packet), 0, 0, 3, 3, 3, 3};
+    std::vector<uint8_t> packets((uint8_t*)packet,
+                                 (uint8_t*)packet + sizeof(packet));
+    EXPECT_EQ(0u, decoder.decode(packets.data(), 4, &replies));
+    EXPECT_EQ(0u, decoder.decode(packets.data(), packets.size() - 1, &replies));
+    EXPECT_EQ(0, sDriver.draws);
+    EXPECT_EQ(packets.size(),
+              decoder.decode(packets.data(), packets.size(), &replies));
+    EXPECT_EQ(1, sDriver.draws);
+    EXPECT_EQ(3u, sDriver.lastVertexCount);
+    EXPECT_TRUE(replies.replies().empty());
+}
+
+TEST(VulkanHandleTable, Basic) {
+    VulkanHandleTable<VkFence> table;
+    const VkFence a = (VkFence)(uintptr_t)0x1000;
+    const VkFence b = (VkFence)(uintptr_t)0x2000;
+    bool valid = true;
+
+    EXPECT_EQ(0u, table.add(VK_NULL_HANDLE));
+    EXPECT_EQ((VkFence)VK_NULL_HANDLE, table.get(0, &valid));
+    EXPECT_TRUE(valid);
+
+    const uint64_t idA = table.add(a);
+    const uint64_t idB = table.add(b);
+    EXPECT_NE(0u, idA);
+    EXPECT_NE(idA, idB);
+    EXPECT_EQ(idA, table.add(a));
+    EXPECT_EQ(idA, table.find(a));
+    EXPECT_EQ(a, table.get(idA, &valid));
+    EXPECT_EQ(b, table.get(idB, &valid));
+    EXPECT_TRUE(valid);
+    EXPECT_EQ(2u, table.size());
+
+    // A removed handle's id stays invalid when its entry is reused.
+    table.remove(a);
+    EXPECT_EQ((VkFence)VK_NULL_HANDLE, table.get(idA, &valid));
+    EXPECT_FALSE(valid);
+    const uint64_t idC = table.add((VkFence)(uintptr_t)0x3000);
+    EXPECT_NE(idA, idC);
+    EXPECT_EQ((uint32_t)idA, (uint32_t)idC);
+    valid = true;
+    EXPECT_EQ((VkFence)VK_NULL_HANDLE, table.get(idA, &valid));
+    EXPECT_FALSE(valid);
+    valid = true;
+    EXPECT_EQ((VkFence)(uintptr_t)0x3000, table.get(idC, &valid));
+    EXPECT_TRUE(valid);
+    EXPECT_EQ(0u, table.find(a));
+}
+
+}  // namespace goldfish_vk
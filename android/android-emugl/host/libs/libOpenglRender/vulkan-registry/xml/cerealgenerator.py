@@ -20,13 +20,90 @@ from generator import *
 
 # CerealGenerator - generates complete set of encoder, and decoder source
 # while being agnostic to the stream implementation
+#
+# The wire format itself is described in VulkanStream.h. The generated
+# modules are:
+#
+# common/goldfish_vk_marshaling: marshal_* and unmarshal_* for every
+#     structure the wire format supports, shared by the guest and the host,
+#     and VulkanHandleMapping, which turns handles into their ids and back.
+# common/goldfish_vk_opcodes: the OP_vk* opcode of every command.
+# guest/goldfish_vk_encoder: encode_* for every command.
+# guest/goldfish_vk_frontend: the Vulkan entry points of the guest.
+# host/goldfish_vk_dispatch: VulkanDispatch, the host driver's entry points.
+# host/goldfish_vk_decoder: VkDecoder, which decodes the packets of the
+#     encoder, makes the calls and sends back their replies.
 
 # ---- methods overriding base class ----
 # beginFile(genOpts)
 # endFile()
 # beginFeature(interface, emit)
 # endFeature()
+# genType(typeinfo)
+# genStruct(typeinfo)
 # genCmd(cmdinfo)
+
+# A parameter or a structure member, as the wire format sees it.
+class CerealValue:
+    def __init__(self, elem):
+        typeElem = elem.find('type')
+        nameElem = elem.find('name')
+        enumElem = elem.find('enum')
+
+        self.name = nameElem.text
+        self.typeName = typeElem.text
+
+        decl = noneStr(elem.text) + noneStr(typeElem.tail)
+        self.pointers = decl.count('*')
+        self.isConst = decl.strip().startswith('const')
+
+        suffix = noneStr(nameElem.tail)
+        if enumElem is not None:
+            suffix += noneStr(enumElem.text) + noneStr(enumElem.tail)
+        arrayMatch = re.match(r'\s*\[\s*(\w+)\s*\]', suffix)
+        self.staticArray = arrayMatch.group(1) if arrayMatch else None
+
+        self.len = elem.get('len')
+        if self.len and self.len.startswith('latexmath'):
+            self.len = elem.get('altlen')
+
+        self.values = elem.get('values')
+
+    def isString(self):
+        return self.typeName == 'char' and self.pointers == 1 and \
+            self.len == 'null-terminated'
+
+    def isStringArray(self):
+        return self.typeName == 'char' and self.pointers == 2 and \
+            self.len is not None and self.len.endswith(',null-terminated')
+
+    # The expression counting the elements a pointer points to, or None.
+    def countLen(self):
+        if self.len is None:
+            return None
+        count = self.len.split(',')[0]
+        if count == 'null-terminated':
+            return None
+        return count
+
+# What the generator knows of a structure or union.
+class CerealStruct:
+    def __init__(self, name, category, members, feature, elem):
+        self.name = name
+        self.category = category
+        self.members = members
+        self.feature = feature
+        self.returnedOnly = elem.get('returnedonly') == 'true'
+        self.extends = elem.get('structextends') is not None
+        self.supported = True
+        self.sType = None
+        self.hasPNext = False
+        for m in members:
+            if m.name == 'sType' and m.values:
+                self.sType = m.values
+            if m.name == 'pNext':
+                self.hasPNext = True
+
 class CerealGenerator(OutputGenerator):
     """Generate serialization code"""
     def __init__(self, errFile = sys.stderr,
@@ -39,10 +116,85 @@ class CerealGenerator(OutputGenerator):
 
         self.moduleHeaderFilePreambles = {}
         self.moduleImplFilePreambles = {}
+        self.moduleHeaderFilePostambles = {}
+        self.moduleImplFilePostambles = {}
 
         self.indentLevel = 0
         self.code = ""
 
+        # Structures and unions seen so far, by name, and the aliases of
+        # structures and handles.
+        self.structs = {}
+        self.structAliases = {}
+        self.handleAliases = {}
+
+        # Code that is collected from every feature and written out as a
+        # whole in endFile(), such as switch cases, as (feature, code) lists.
+        self.aggregates = {}
+
+        # Opcode of the next command.
+        self.nextOpcode = 20000
+
+        self.modules = [
+            ("common", "goldfish_vk_marshaling"),
+            ("common", "goldfish_vk_opcodes"),
+            ("guest", "goldfish_vk_frontend"),
+            ("guest", "goldfish_vk_encoder"),
+            ("host", "goldfish_vk_dispatch"),
+            ("host", "goldfish_vk_decoder"),
+        ]
+
+        # Modules without a .cpp file.
+        self.headerOnlyModules = set([
+            self.moduleKey("common", "goldfish_vk_opcodes"),
+        ])
+
+        # Modules whose code is written as a whole in endFile(), and not in
+        # #ifdef blocks per feature.
+        self.aggregateOnlyModules = set([
+            self.moduleKey("host", "goldfish_vk_decoder"),
+        ])
+
+        # Commands that can't go through the wire format: memory mapping
+        # needs shared memory, and the loader, not the host, resolves entry
+        # points.
+        self.unsupportedCommands = set([
+            "vkGetInstanceProcAddr",
+            "vkGetDeviceProcAddr",
+            "vkMapMemory",
+            "vkUnmapMemory",
+        ])
+
+        # Pointer members that Vulkan ignores, and that applications may
+        # leave dangling, unless the descriptor type says otherwise.
+        imageDescriptors = [
+            "VK_DESCRIPTOR_TYPE_SAMPLER",
+            "VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER",
+            "VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE",
+            "VK_DESCRIPTOR_TYPE_STORAGE_IMAGE",
+            "VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT",
+        ]
+        bufferDescriptors = [
+            "VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER",
+            "VK_DESCRIPTOR_TYPE_STORAGE_BUFFER",
+            "VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC",
+            "VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC",
+        ]
+        texelBufferDescriptors = [
+            "VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER",
+            "VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER",
+        ]
+        samplerDescriptors = [
+            "VK_DESCRIPTOR_TYPE_SAMPLER",
+            "VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER",
+        ]
+        self.memberConditions = {
+            ("VkWriteDescriptorSet", "pImageInfo"): imageDescriptors,
+            ("VkWriteDescriptorSet", "pBufferInfo"): bufferDescriptors,
+            ("VkWriteDescriptorSet", "pTexelBufferView"): texelBufferDescriptors,
+            ("VkDescriptorSetLayoutBinding", "pImmutableSamplers"): samplerDescriptors,
+        }
+
         self.cereal_Android_mk_header = """
 LOCAL_PATH := $(call my-dir)
 
@@ -50,6 +202,8 @@ LOCAL_PATH := $(call my-dir)
 
 cereal_C_INCLUDES := \\
     $(LOCAL_PATH) \\
+    $(LOCAL_PATH)/.. \\
+    $(EMUGL_PATH)/host/include \\
     $(EMUGL_PATH)/host/include/vulkan \\
 
 cereal_STATIC_LIBRARIES := \\
@@ -58,26 +212,539 @@ cereal_STATIC_LIBRARIES := \\
 """
 
         self.cereal_Android_mk_body = """
+$(call emugl-begin-static-library,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_common)
+
+LOCAL_C_INCLUDES += $(cereal_C_INCLUDES)
+
+LOCAL_STATIC_LIBRARIES += $(cereal_STATIC_LIBRARIES)
+
+LOCAL_SRC_FILES := \\
+    ../VulkanStream.cpp \\
+    common/goldfish_vk_marshaling.cpp \\
+
+$(call emugl-export,C_INCLUDES,$(cereal_C_INCLUDES))
+
+$(call emugl-end-module)
+
 $(call emugl-begin-static-library,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_guest)
+$(call emugl-import,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_common)
 
 LOCAL_C_INCLUDES += $(cereal_C_INCLUDES)
 
 LOCAL_STATIC_LIBRARIES += $(cereal_STATIC_LIBRARIES)
 
 LOCAL_SRC_FILES := \\
+    guest/goldfish_vk_encoder.cpp \\
     guest/goldfish_vk_frontend.cpp \\
 
 $(call emugl-end-module)
+
+$(call emugl-begin-static-library,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_host)
+$(call emugl-import,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_common libOpenglCodecCommon)
+
+LOCAL_C_INCLUDES += $(cereal_C_INCLUDES)
+
+LOCAL_STATIC_LIBRARIES += $(cereal_STATIC_LIBRARIES)
+
+LOCAL_SRC_FILES := \\
+    host/goldfish_vk_decoder.cpp \\
+    host/goldfish_vk_dispatch.cpp \\
+
+$(call emugl-end-module)
+"""
+
+        self.moduleHeaderFilePreambles[self.moduleKey("common", "goldfish_vk_marshaling")] = """
+#pragma once
+
+#include "VulkanStream.h"
+
+#include <vulkan.h>
+
+namespace goldfish_vk {
+
+// Pushes a pNext chain through |vkStream|. The structures the wire format
+// doesn't support are skipped.
+void marshal_extension_struct(VulkanStream* vkStream, const void* structExtension);
+
+// Pulls a pNext chain. Structures are filled in place if the chain at
+// |*pNext| has them, as when the guest reads outputs, and added to it
+// otherwise.
+void unmarshal_extension_struct(VulkanStream* vkStream, void** pNext);
+
+// Pushes and pulls the types of the structures of a pNext chain, and not
+// their contents: the host needs them to build the chain that output
+// parameters are returned in.
+void marshal_extension_struct_types(VulkanStream* vkStream, const void* structExtension);
+void unmarshal_extension_struct_types(VulkanStream* vkStream, void** pNext);
+
+// Returns the size of the structures of type |sType| that can be in a pNext
+// chain, or 0 if the wire format doesn't support them.
+size_t goldfish_vk_extension_struct_size(VkStructureType sType);
+"""
+
+        self.moduleHeaderFilePostambles[self.moduleKey("common", "goldfish_vk_marshaling")] = """
+// Turns handles into the ids that go on the wire, and back. The guest's ids
+// are the host's handles by default, which is what a 64-bit guest driver
+// can use as long as its dispatchable handles don't need to point to a
+// loader dispatch table. The host decoder overrides this with its handle
+// tables.
+class VulkanHandleMapping {
+public:
+    virtual ~VulkanHandleMapping() = default;
+
+%s};
+
+}  // namespace goldfish_vk
+"""
+
+        self.moduleImplFilePreambles[self.moduleKey("common", "goldfish_vk_marshaling")] = """
+#include "goldfish_vk_marshaling.h"
+
+namespace goldfish_vk {
+"""
+
+        self.moduleImplFilePostambles[self.moduleKey("common", "goldfish_vk_marshaling")] = """
+void marshal_extension_struct(
+    VulkanStream* vkStream,
+    const void* structExtension)
+{
+    const VkBaseInStructure* ext = (const VkBaseInStructure*)structExtension;
+    while (ext && !goldfish_vk_extension_struct_size(ext->sType))
+    {
+        ext = ext->pNext;
+    }
+    if (!ext)
+    {
+        vkStream->putU32(0);
+        return;
+    }
+    vkStream->putU32(ext->sType);
+    switch (ext->sType)
+    {
+%s        default:
+            break;
+    }
+}
+
+void unmarshal_extension_struct(
+    VulkanStream* vkStream,
+    void** pNext)
+{
+    const VkStructureType sType = (VkStructureType)vkStream->getU32();
+    if (!sType)
+    {
+        return;
+    }
+    const size_t size = goldfish_vk_extension_struct_size(sType);
+    if (!size)
+    {
+        vkStream->setError();
+        return;
+    }
+    VkBaseOutStructure* ext = (VkBaseOutStructure*)*pNext;
+    while (ext && ext->sType != sType)
+    {
+        ext = ext->pNext;
+    }
+    if (!ext)
+    {
+        // Not in the chain: add it, or read it into scratch memory if the
+        // chain is the application's.
+        ext = (VkBaseOutStructure*)vkStream->alloc(size);
+        if (!ext)
+        {
+            return;
+        }
+        if (!*pNext)
+        {
+            *pNext = ext;
+        }
+    }
+    switch (sType)
+    {
+%s        default:
+            break;
+    }
+}
+
+void marshal_extension_struct_types(
+    VulkanStream* vkStream,
+    const void* structExtension)
+{
+    const VkBaseInStructure* ext = (const VkBaseInStructure*)structExtension;
+    for (; ext; ext = ext->pNext)
+    {
+        if (goldfish_vk_extension_struct_size(ext->sType))
+        {
+            vkStream->putU32(ext->sType);
+        }
+    }
+    vkStream->putU32(0);
+}
+
+void unmarshal_extension_struct_types(
+    VulkanStream* vkStream,
+    void** pNext)
+{
+    VkBaseOutStructure** next = (VkBaseOutStructure**)pNext;
+    for (uint32_t sType = vkStream->getU32(); sType; sType = vkStream->getU32())
+    {
+        const size_t size = goldfish_vk_extension_struct_size((VkStructureType)sType);
+        VkBaseOutStructure* ext = size ? (VkBaseOutStructure*)vkStream->alloc(size) : nullptr;
+        if (!ext)
+        {
+            vkStream->setError();
+            return;
+        }
+        ext->sType = (VkStructureType)sType;
+        *next = ext;
+        next = &ext->pNext;
+    }
+}
+
+size_t goldfish_vk_extension_struct_size(
+    VkStructureType sType)
+{
+    switch (sType)
+    {
+%s        default:
+            return 0;
+    }
+}
+
+}  // namespace goldfish_vk
+"""
+
+        self.moduleHeaderFilePreambles[self.moduleKey("common", "goldfish_vk_opcodes")] = """
+#pragma once
+
+// Each encoded call starts with its opcode and the size of its packet:
+//
+//     uint32_t opcode;      // OP_vk*
+//     uint32_t packetSize;  // including these 8 bytes
+//     ...                   // parameters
 """
 
         self.moduleHeaderFilePreambles[self.moduleKey("guest", "goldfish_vk_frontend")] = """
+#pragma once
+
 #include <vulkan.h>
+
+namespace goldfish_vk {
+class VulkanStream;
+}  // namespace goldfish_vk
+
+// Sets the function that returns the stream of the current thread, which the
+// entry points below encode their calls into.
+void goldfish_vk_set_stream_accessor(goldfish_vk::VulkanStream* (*getStream)());
 """
 
         self.moduleImplFilePreambles[self.moduleKey("guest", "goldfish_vk_frontend")] = """
 #include "goldfish_vk_frontend.h"
 
 #include "goldfish_vk_encoder.h"
+
+using goldfish_vk::VulkanStream;
+using namespace goldfish_vk;
+
+static VulkanStream* (*sGetVulkanStream)() = nullptr;
+
+void goldfish_vk_set_stream_accessor(VulkanStream* (*getStream)())
+{
+    sGetVulkanStream = getStream;
+}
+"""
+
+        self.moduleHeaderFilePreambles[self.moduleKey("guest", "goldfish_vk_encoder")] = """
+#pragma once
+
+#include "VulkanStream.h"
+
+#include <vulkan.h>
+
+namespace goldfish_vk {
+
+// Commands that return nothing and have no output parameters, e.g. vkCmd*(),
+// are only queued in |vkStream|, which sends them in bulk with the next
+// command that needs a reply, or when its buffer fills up; see
+// VulkanStream::flush(). The others wait for their reply. Commands that the
+// wire format doesn't support return VK_ERROR_FEATURE_NOT_PRESENT.
+"""
+
+        self.moduleHeaderFilePostambles[self.moduleKey("guest", "goldfish_vk_encoder")] = """
+}  // namespace goldfish_vk
+"""
+
+        self.moduleImplFilePreambles[self.moduleKey("guest", "goldfish_vk_encoder")] = """
+#include "goldfish_vk_encoder.h"
+
+#include "common/goldfish_vk_marshaling.h"
+#include "common/goldfish_vk_opcodes.h"
+
+namespace goldfish_vk {
+"""
+
+        self.moduleImplFilePostambles[self.moduleKey("guest", "goldfish_vk_encoder")] = """
+}  // namespace goldfish_vk
+"""
+
+        self.moduleHeaderFilePreambles[self.moduleKey("host", "goldfish_vk_dispatch")] = """
+#pragma once
+
+#include <vulkan.h>
+
+namespace goldfish_vk {
+
+// The entry points of the host's Vulkan driver. Those it doesn't have are
+// null.
+struct VulkanDispatch {
+"""
+
+        self.moduleHeaderFilePostambles[self.moduleKey("host", "goldfish_vk_dispatch")] = """};
+
+// Fills |out| with the entry points |getProc| returns; it is called with the
+// name of each and |userData|.
+void init_vulkan_dispatch(
+    void* (*getProc)(const char* name, void* userData),
+    void* userData,
+    VulkanDispatch* out);
+
+}  // namespace goldfish_vk
+"""
+
+        self.moduleImplFilePreambles[self.moduleKey("host", "goldfish_vk_dispatch")] = """
+#include "goldfish_vk_dispatch.h"
+
+namespace goldfish_vk {
+
+void init_vulkan_dispatch(
+    void* (*getProc)(const char* name, void* userData),
+    void* userData,
+    VulkanDispatch* out)
+{
+"""
+
+        self.moduleImplFilePostambles[self.moduleKey("host", "goldfish_vk_dispatch")] = """}
+
+}  // namespace goldfish_vk
+"""
+
+        self.moduleHeaderFilePreambles[self.moduleKey("host", "goldfish_vk_decoder")] = """
+#pragma once
+
+#include <memory>
+
+#include <stddef.h>
+
+class IOStream;
+
+namespace goldfish_vk {
+
+struct VulkanDispatch;
+
+// Decodes the Vulkan calls encoded by goldfish_vk_encoder, and makes them
+// through a VulkanDispatch.
+//
+// The guest doesn't wait for calls that return nothing: vkCmd*, vkUpdate*,
+// vkDestroy* and the like are queued in its stream and sent in bulk, so
+// one read from the transport usually holds thousands of them. decode()
+// goes through all the packets of such a chunk in one call, and only
+// calls that return a value or have output parameters get a reply.
+//
+// Handles are the ids of handle tables that all decoders share. Looking up
+// an id is an array access, and a chunk of calls that create or destroy
+// nothing takes the lock of the tables once. The children of a pool that
+// is reset or destroyed stay in the tables until their handles are reused.
+class VkDecoder {
+public:
+    explicit VkDecoder(const VulkanDispatch* vk);
+    ~VkDecoder();
+
+    // Decodes and makes the calls of the complete packets at the start of
+    // |buf|, and writes their replies to |ioStream|. Returns the number of
+    // bytes consumed; what is left is the start of a packet that isn't
+    // complete yet.
+    size_t decode(void* buf, size_t bufsize, IOStream* ioStream);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> mImpl;
+};
+
+}  // namespace goldfish_vk
+"""
+
+        self.moduleImplFilePreambles[self.moduleKey("host", "goldfish_vk_decoder")] = """
+#include "goldfish_vk_decoder.h"
+
+#include "common/goldfish_vk_marshaling.h"
+#include "common/goldfish_vk_opcodes.h"
+#include "goldfish_vk_dispatch.h"
+#include "VulkanHandleTable.h"
+#include "VulkanStream.h"
+
+#include "android/base/memory/LazyInstance.h"
+#include "android/base/synchronization/Lock.h"
+
+#include "ErrorLog.h"
+#include "OpenglRender/IOStream.h"
+
+#include <string.h>
+
+namespace goldfish_vk {
+
+using android::base::LazyInstance;
+using android::base::ReadWriteLock;
+
+static constexpr size_t kPacketHeaderSize = 8;
+"""
+
+        self.moduleImplFilePostambles[self.moduleKey("host", "goldfish_vk_decoder")] = """
+struct HandleTables {
+    ReadWriteLock lock;
+%s};
+
+static LazyInstance<HandleTables> sHandleTables = LAZY_INSTANCE_INIT;
+
+// The lock a decoder holds on the handle tables. Calls that only look up
+// handles keep holding it for reading from one to the next, so that a chunk
+// of them takes it once.
+class HandleTablesLock {
+public:
+    explicit HandleTablesLock(ReadWriteLock& lock) : mLock(lock) {}
+    ~HandleTablesLock() { unlock(); }
+
+    void read() {
+        if (mState != Read) {
+            unlock();
+            mLock.lockRead();
+            mState = Read;
+        }
+    }
+
+    void write() {
+        if (mState != Write) {
+            unlock();
+            mLock.lockWrite();
+            mState = Write;
+        }
+    }
+
+    void unlock() {
+        if (mState == Read) {
+            mLock.unlockRead();
+        } else if (mState == Write) {
+            mLock.unlockWrite();
+        }
+        mState = Unlocked;
+    }
+
+private:
+    enum State { Unlocked, Read, Write };
+
+    ReadWriteLock& mLock;
+    State mState = Unlocked;
+};
+
+// Handles written to the stream are added to the tables, which needs the
+// write lock, and ids read from it must be in the tables.
+class DecoderHandleMapping : public VulkanHandleMapping {
+public:
+    explicit DecoderHandleMapping(HandleTables* tables) : mTables(tables) {}
+
+%s
+private:
+    HandleTables* mTables;
+};
+
+class VkDecoder::Impl {
+public:
+    explicit Impl(const VulkanDispatch* vk)
+        : m_vk(vk),
+          m_tables(sHandleTables.ptr()),
+          m_lock(m_tables->lock),
+          m_handleMapping(m_tables),
+          m_vkStream(nullptr, &m_handleMapping) {}
+
+    size_t decode(void* buf, size_t bufsize, IOStream* ioStream);
+
+private:
+    void onFailedCall(const char* name);
+    void sendReply(IOStream* ioStream);
+
+    const VulkanDispatch* m_vk;
+    HandleTables* m_tables;
+    HandleTablesLock m_lock;
+    DecoderHandleMapping m_handleMapping;
+    VulkanStream m_vkStream;
+};
+
+void VkDecoder::Impl::onFailedCall(const char* name)
+{
+    ERR("VkDecoder: %%s: %%s\\n", name,
+        m_vkStream.error() ? "malformed packet"
+                           : "not supported by the host driver");
+}
+
+void VkDecoder::Impl::sendReply(IOStream* ioStream)
+{
+    const std::vector<uint8_t>& reply = m_vkStream.endReply();
+    unsigned char* dst = ioStream->alloc(reply.size());
+    if (!dst)
+    {
+        ERR("VkDecoder: cannot allocate a reply of %%zu bytes\\n", reply.size());
+        return;
+    }
+    memcpy(dst, reply.data(), reply.size());
+    ioStream->flush();
+}
+
+size_t VkDecoder::Impl::decode(void* buf, size_t bufsize, IOStream* ioStream)
+{
+    VulkanStream* vkStream = &m_vkStream;
+    const unsigned char* ptr = (const unsigned char*)buf;
+    const unsigned char* const end = ptr + bufsize;
+    while (end - ptr >= (ptrdiff_t)kPacketHeaderSize)
+    {
+        uint32_t opcode;
+        uint32_t packetSize;
+        memcpy(&opcode, ptr, sizeof(opcode));
+        memcpy(&packetSize, ptr + 4, sizeof(packetSize));
+        if (packetSize < kPacketHeaderSize)
+        {
+            ERR("VkDecoder: bad packet size %%u, dropping %%zu bytes\\n",
+                packetSize, (size_t)(end - ptr));
+            ptr = end;
+            break;
+        }
+        if ((size_t)(end - ptr) < packetSize)
+        {
+            break;
+        }
+        vkStream->setReadBuffer(ptr + kPacketHeaderSize, packetSize - kPacketHeaderSize);
+        switch (opcode)
+        {
+%s            default:
+                ERR("VkDecoder: unknown opcode %%u\\n", opcode);
+                break;
+        }
+        vkStream->clearPool();
+        ptr += packetSize;
+    }
+    m_lock.unlock();
+    return ptr - (const unsigned char*)buf;
+}
+
+VkDecoder::VkDecoder(const VulkanDispatch* vk) : mImpl(new Impl(vk)) {}
+
+VkDecoder::~VkDecoder() = default;
+
+size_t VkDecoder::decode(void* buf, size_t bufsize, IOStream* ioStream)
+{
+    return mImpl->decode(buf, bufsize, ioStream);
+}
+
+}  // namespace goldfish_vk
 """
 
 ################################################################################
@@ -88,26 +755,44 @@ $(call emugl-end-module)
 
         write(self.cereal_Android_mk_body, file = self.outFile)
 
-        self.beginModule("guest", "goldfish_vk_frontend")
-        self.beginModule("guest", "goldfish_vk_encoder")
+        for directory, basename in self.modules:
+            self.beginModule(directory, basename)
 
     def endFile(self):
+        self.moduleHeaderFilePostambles[self.moduleKey("common", "goldfish_vk_marshaling")] %= \
+            self.makeAggregate("handleMappingMethods")
+
+        self.moduleImplFilePostambles[self.moduleKey("common", "goldfish_vk_marshaling")] %= (
+            self.makeAggregate("marshalExtensionCases"),
+            self.makeAggregate("unmarshalExtensionCases"),
+            self.makeAggregate("extensionSizeCases"))
+
+        self.moduleImplFilePostambles[self.moduleKey("host", "goldfish_vk_decoder")] %= (
+            self.makeAggregate("handleTables"),
+            self.makeAggregate("decoderHandleMappingMethods"),
+            self.makeAggregate("decoderCases"))
+
+        for directory, basename in self.modules:
+            self.endModule(directory, basename)
+
         OutputGenerator.endFile(self)
     def beginFeature(self, interface, emit):
         # Start processing in superclass
         OutputGenerator.beginFeature(self, interface, emit)
-        self.appendHeader("guest", "goldfish_vk_frontend", "#ifdef %s\n" % self.featureName)
-        self.appendImpl("guest", "goldfish_vk_frontend", "#ifdef %s\n" % self.featureName)
-        self.appendHeader("guest", "goldfish_vk_encoder", "#ifdef %s\n" % self.featureName)
-        self.appendImpl("guest", "goldfish_vk_encoder", "#ifdef %s\n" % self.featureName)
+        for directory, basename in self.modules:
+            if self.moduleKey(directory, basename) in self.aggregateOnlyModules:
+                continue
+            self.appendHeader(directory, basename, "#ifdef %s\n" % self.featureName)
+            self.appendImpl(directory, basename, "#ifdef %s\n" % self.featureName)
 
     def endFeature(self):
+        for directory, basename in self.modules:
+            if self.moduleKey(directory, basename) in self.aggregateOnlyModules:
+                continue
+            self.appendHeader(directory, basename, "#endif\n")
+            self.appendImpl(directory, basename, "#endif\n")
         # Finish processing in superclass
         OutputGenerator.endFeature(self)
-        self.appendHeader("guest", "goldfish_vk_frontend", "#endif\n")
-        self.appendImpl("guest", "goldfish_vk_frontend", "#endif\n")
-        self.appendHeader("guest", "goldfish_vk_encoder", "#endif\n")
-        self.appendImpl("guest", "goldfish_vk_encoder", "#endif\n")
 
     def moduleKey(self, directory, basename):
         return os.path.join(directory, basename)
@@ -119,14 +804,16 @@ $(call emugl-end-module)
         self.makeDir(absDir)
 
         filename = os.path.join(absDir, basename)
+        key = self.moduleKey(directory, basename)
 
         fpHeader = open(filename + ".h", 'w', encoding='utf-8')
         write("// Module: %s (header) Autogenerated by CerealGenerator\n" % basename, file = fpHeader)
 
-        fpImpl = open(filename + ".cpp", 'w', encoding='utf-8')
-        write("// Module: %s (impl) Autogenerated by CerealGenerator\n" % basename, file = fpImpl)
-
-        key = self.moduleKey(directory, basename)
+        if key in self.headerOnlyModules:
+            fpImpl = open(os.devnull, 'w')
+        else:
+            fpImpl = open(filename + ".cpp", 'w', encoding='utf-8')
+            write("// Module: %s (impl) Autogenerated by CerealGenerator\n" % basename, file = fpImpl)
 
         self.moduleHeaderFileHandles[key] = fpHeader
         self.moduleImplFileHandles[key] = fpImpl
@@ -138,8 +825,16 @@ $(call emugl-end-module)
             write(self.moduleImplFilePreambles[key], file = fpImpl)
 
     def endModule(self, directory, basename):
-        self.moduleHeaderFileHandles[self.moduleKey(directory, basename)].close()
-        self.moduleImplFileHandles[self.moduleKey(directory, basename)].close()
+        key = self.moduleKey(directory, basename)
+
+        if key in self.moduleHeaderFilePostambles:
+            write(self.moduleHeaderFilePostambles[key], file = self.moduleHeaderFileHandles[key])
+
+        if key in self.moduleImplFilePostambles:
+            write(self.moduleImplFilePostambles[key], file = self.moduleImplFileHandles[key])
+
+        self.moduleHeaderFileHandles[key].close()
+        self.moduleImplFileHandles[key].close()
 
     def appendHeader(self, directory, basename, toAppend):
         write(toAppend, file = self.moduleHeaderFileHandles[self.moduleKey(directory, basename)])
@@ -147,6 +842,24 @@ $(call emugl-end-module)
     def appendImpl(self, directory, basename, toAppend):
         write(toAppend, file = self.moduleImplFileHandles[self.moduleKey(directory, basename)])
 
+    # Adds |code| to an aggregate, under the current feature.
+    def appendAggregate(self, key, code):
+        self.aggregates.setdefault(key, []).append((self.featureName, code))
+
+    def makeAggregate(self, key):
+        res = ""
+        current = None
+        for feature, code in self.aggregates.get(key, []):
+            if feature != current:
+                if current:
+                    res += "#endif\n"
+                res += "#ifdef %s\n" % feature
+                current = feature
+            res += code
+        if current:
+            res += "#endif\n"
+        return res
+
 ################################################################################
 
     def swapCode(self,):
@@ -199,6 +912,370 @@ $(call emugl-end-module)
     def line(self, code):
         self.code += self.indent() + code + "\n"
 
+################################################################################
+# Types, as the wire format sees them
+
+    # One of 'void', 'scalar', 'union', 'struct', 'handle', or 'unsupported'
+    # for the types that are platform-specific or function pointers.
+    def typeKind(self, typeName):
+        if typeName == 'void':
+            return 'void'
+        typeInfo = self.registry.typedict.get(typeName)
+        if typeInfo is None:
+            return 'unsupported'
+        category = typeInfo.elem.get('category')
+        if category == 'handle':
+            return 'handle'
+        if category == 'struct':
+            return 'struct'
+        if category == 'union':
+            return 'union'
+        if category in ('enum', 'bitmask', 'basetype') or \
+           typeInfo.elem.get('requires') == 'vk_platform' or typeName == 'int':
+            return 'scalar'
+        return 'unsupported'
+
+    def handleBase(self, typeName):
+        return self.handleAliases.get(typeName, typeName)
+
+    def structBase(self, typeName):
+        return self.structAliases.get(typeName, typeName)
+
+    def structInfo(self, typeName):
+        return self.structs.get(self.structBase(typeName))
+
+    # The type that arrays of |v| can be copied as in one go, or None if
+    # each element needs to be converted.
+    def rawElementType(self, v):
+        kind = self.typeKind(v.typeName)
+        if kind == 'void':
+            return 'uint8_t'
+        if kind in ('scalar', 'union') and v.typeName != 'size_t':
+            return v.typeName
+        return None
+
+    def isValueSupported(self, v):
+        kind = self.typeKind(v.typeName)
+        if kind == 'unsupported':
+            return False
+        if kind == 'struct':
+            info = self.structInfo(v.typeName)
+            if info is None or not info.supported:
+                return False
+        if v.name == 'pNext' and kind == 'void':
+            return v.pointers == 1
+        if v.staticArray:
+            return v.pointers == 0 and kind != 'void'
+        if v.pointers == 0:
+            return kind != 'void'
+        if v.pointers == 2:
+            return v.isStringArray()
+        if v.pointers > 2:
+            return False
+        if v.typeName == 'char':
+            return v.isString()
+        if kind == 'void':
+            return v.countLen() is not None
+        return True
+
+    # Whether the structure has pointers other than pNext, here or in the
+    # structures it has.
+    def structHasPointers(self, info):
+        for m in info.members:
+            if m.name == 'pNext':
+                continue
+            if m.pointers:
+                return True
+            if self.typeKind(m.typeName) == 'struct' and \
+               self.structHasPointers(self.structInfo(m.typeName)):
+                return True
+        return False
+
+    def valueHasHandles(self, v):
+        kind = self.typeKind(v.typeName)
+        if kind == 'handle':
+            return True
+        if kind == 'struct':
+            info = self.structInfo(v.typeName)
+            return any(self.valueHasHandles(m) for m in info.members)
+        return False
+
+################################################################################
+# Marshaling code
+
+    # Wraps |expr| in parentheses unless it is a simple name.
+    def paren(self, expr):
+        if re.match(r'^[\w>.-]+$', expr) and not re.search(r'[.-]$', expr):
+            return expr
+        if expr.startswith('(') and expr.endswith(')'):
+            depth = 0
+            for i, c in enumerate(expr):
+                depth += {'(': 1, ')': -1}.get(c, 0)
+                if depth == 0 and i < len(expr) - 1:
+                    break
+            else:
+                return expr
+        return "(%s)" % expr
+
+    # Turns a len attribute into an expression. |resolve| gives the
+    # expression for a name in it.
+    def makeLenExpr(self, lenStr, resolve):
+        if '::' in lenStr:
+            obj, member = lenStr.split('::')
+            return "(%s ? %s->%s : 0)" % (obj, obj, member)
+        return re.sub(r'[A-Za-z_]\w*', lambda m: resolve(m.group(0)), lenStr)
+
+    def makeCountExpr(self, v, resolve):
+        count = v.countLen()
+        if count is None:
+            return None
+        return self.paren(self.makeLenExpr(count, resolve))
+
+    def makeMemberCondition(self, structName, member, structVar):
+        types = self.memberConditions.get((structName, member.name))
+        if types is None:
+            return None
+        return " ||\n        ".join(
+            ["%s->descriptorType == %s" % (structVar, t) for t in types])
+
+    def genMarshalElement(self, v, lvalue, addr):
+        kind = self.typeKind(v.typeName)
+        if kind == 'handle':
+            self.stmt("vkStream->putU64(vkStream->handleMapping()->toWire_%s(%s))" %
+                      (self.handleBase(v.typeName), lvalue))
+        elif kind == 'struct':
+            self.stmt("marshal_%s(vkStream, %s)" % (self.structBase(v.typeName), addr))
+        elif v.typeName == 'size_t':
+            self.stmt("vkStream->putU64((uint64_t)%s)" % lvalue)
+        else:
+            self.stmt("vkStream->write(%s, sizeof(%s))" % (addr, v.typeName))
+
+    def genUnmarshalElement(self, v, lvalue, addr):
+        kind = self.typeKind(v.typeName)
+        if kind == 'handle':
+            self.stmt("%s = vkStream->handleMapping()->fromWire_%s(vkStream, vkStream->getU64())" %
+                      (lvalue, self.handleBase(v.typeName)))
+        elif kind == 'struct':
+            self.stmt("unmarshal_%s(vkStream, %s)" % (self.structBase(v.typeName), addr))
+        elif v.typeName == 'size_t':
+            self.stmt("%s = (size_t)vkStream->getU64()" % lvalue)
+        else:
+            self.stmt("vkStream->read(%s, sizeof(%s))" % (addr, v.typeName))
+
+    def genMarshalArray(self, v, ptr, count):
+        raw = self.rawElementType(v)
+        if raw:
+            self.stmt("vkStream->write(%s, %s * sizeof(%s))" % (ptr, count, raw))
+            return
+        self.beginFor("uint32_t i = 0", "i < (uint32_t)%s" % count, "++i")
+        self.genMarshalElement(v, "%s[i]" % ptr, "%s + i" % ptr)
+        self.endBlock()
+
+    def genUnmarshalArray(self, v, ptr, count):
+        raw = self.rawElementType(v)
+        if raw:
+            self.stmt("vkStream->read(%s, %s * sizeof(%s))" % (ptr, count, raw))
+            return
+        self.beginFor("uint32_t i = 0", "i < (uint32_t)%s" % count, "++i")
+        self.genUnmarshalElement(v, "%s[i]" % ptr, "%s + i" % ptr)
+        self.endBlock()
+
+    # Pushes |v|, accessed as |acc|, with a presence flag for pointers.
+    def genMarshalValue(self, v, acc, resolve, condition = None):
+        if condition:
+            self.beginIf(condition)
+        kind = self.typeKind(v.typeName)
+        count = self.makeCountExpr(v, resolve)
+        if v.name == 'pNext' and kind == 'void':
+            self.stmt("marshal_extension_struct(vkStream, %s)" % acc)
+        elif v.staticArray:
+            self.genMarshalArray(v, acc, v.staticArray)
+        elif v.pointers == 0:
+            self.genMarshalElement(v, acc, "&" + acc)
+        elif v.isString():
+            self.stmt("vkStream->putString(%s)" % acc)
+        else:
+            self.stmt("vkStream->putU32(%s ? 1 : 0)" % acc)
+            self.beginIf(acc)
+            if v.isStringArray():
+                self.stmt("vkStream->putStringArray(%s, %s)" % (acc, count))
+            elif count:
+                self.genMarshalArray(v, acc, count)
+            else:
+                self.genMarshalElement(v, "*" + acc, acc)
+            self.endIf()
+        if condition:
+            self.endIf()
+
+    # Pulls |v| into |acc|, allocating what it points to. If |isLocal|, |acc|
+    # is a local variable of the decoder, of type elementType*.
+    def genUnmarshalValue(self, v, acc, resolve, condition = None, isLocal = False):
+        if condition:
+            self.beginIf(condition)
+        kind = self.typeKind(v.typeName)
+        count = self.makeCountExpr(v, resolve)
+        if v.name == 'pNext' and kind == 'void':
+            self.stmt("unmarshal_extension_struct(vkStream, (void**)&%s)" % acc)
+        elif v.staticArray:
+            self.genUnmarshalArray(v, acc, v.staticArray)
+        elif v.pointers == 0:
+            self.genUnmarshalElement(v, acc, "&" + acc)
+        elif v.isString():
+            self.stmt("%s = vkStream->getString()" % acc)
+        else:
+            self.beginIf("vkStream->getU32()")
+            if v.isStringArray():
+                self.stmt("%s = vkStream->getStringArray(%s)" % (acc, count))
+            else:
+                elementType = self.rawElementType(v) if kind == 'void' else v.typeName
+                size = count if count else "1"
+                if isLocal:
+                    ptr = acc
+                    self.stmt("%s = (%s*)vkStream->allocArray(%s, sizeof(%s))" %
+                              (ptr, elementType, size, elementType))
+                else:
+                    ptr = v.name
+                    self.stmt("%s* %s = (%s*)vkStream->allocArray(%s, sizeof(%s))" %
+                              (elementType, ptr, elementType, size, elementType))
+                    self.stmt("%s = %s" % (acc, ptr))
+                self.beginIf(ptr)
+                if count:
+                    self.genUnmarshalArray(v, ptr, count)
+                else:
+                    self.genUnmarshalElement(v, "*" + ptr, ptr)
+                self.endIf()
+            self.endIf()
+        if condition:
+            self.endIf()
+
+    def makeStructMarshalProto(self, name, prefix, const):
+        return "void %s_%s(\n    VulkanStream* vkStream,\n    %s%s* %s)" % \
+            (prefix, name, const, name,
+             "forMarshaling" if prefix == "marshal" else "forUnmarshaling")
+
+    def makeStructMarshalDefs(self, info):
+        name = info.name
+        if info.category == 'union':
+            # Unions only have scalars, of the same size everywhere.
+            self.swapCode()
+            self.beginBlock()
+            self.stmt("vkStream->write(forMarshaling, sizeof(%s))" % name)
+            self.endBlock()
+            marshalDef = self.makeStructMarshalProto(name, "marshal", "const ") + "\n" + self.swapCode()
+            self.beginBlock()
+            self.stmt("vkStream->read(forUnmarshaling, sizeof(%s))" % name)
+            self.endBlock()
+            unmarshalDef = self.makeStructMarshalProto(name, "unmarshal", "") + "\n" + self.swapCode()
+            return marshalDef + "\n" + unmarshalDef + "\n"
+
+        self.swapCode()
+        self.beginBlock()
+        resolve = lambda n: "forMarshaling->" + n
+        for m in info.members:
+            self.genMarshalValue(m, "forMarshaling->" + m.name, resolve,
+                                 self.makeMemberCondition(name, m, "forMarshaling"))
+        self.endBlock()
+        marshalDef = self.makeStructMarshalProto(name, "marshal", "const ") + "\n" + self.swapCode()
+
+        self.beginBlock()
+        resolve = lambda n: "forUnmarshaling->" + n
+        for m in info.members:
+            self.genUnmarshalValue(m, "forUnmarshaling->" + m.name, resolve,
+                                   self.makeMemberCondition(name, m, "forUnmarshaling"))
+        self.endBlock()
+        unmarshalDef = self.makeStructMarshalProto(name, "unmarshal", "") + "\n" + self.swapCode()
+
+        return marshalDef + "\n" + unmarshalDef + "\n"
+
+################################################################################
+# Types and structures
+
+    def genType(self, typeinfo, name, alias):
+        OutputGenerator.genType(self, typeinfo, name, alias)
+        category = typeinfo.elem.get('category')
+
+        if category == 'struct' or category == 'union':
+            self.genStruct(typeinfo, name, alias)
+            return
+
+        if category != 'handle':
+            return
+
+        if alias:
+            self.handleAliases[name] = alias
+            return
+
+        self.appendAggregate("handleMappingMethods",
+            "    virtual uint64_t toWire_%s(%s handle) { return handleToU64(handle); }\n"
+            "    virtual %s fromWire_%s(VulkanStream* vkStream, uint64_t id) {\n"
+            "        return handleFromU64<%s>(id);\n"
+            "    }\n" % (name, name, name, name, name))
+
+        self.appendAggregate("handleTables",
+            "    VulkanHandleTable<%s> table_%s;\n" % (name, name))
+
+        self.appendAggregate("decoderHandleMappingMethods",
+            "    uint64_t toWire_%s(%s handle) override {\n"
+            "        return mTables->table_%s.add(handle);\n"
+            "    }\n"
+            "    %s fromWire_%s(VulkanStream* vkStream, uint64_t id) override {\n"
+            "        bool valid = true;\n"
+            "        %s handle = mTables->table_%s.get(id, &valid);\n"
+            "        if (!valid) {\n"
+            "            vkStream->setError();\n"
+            "        }\n"
+            "        return handle;\n"
+            "    }\n" % (name, name, name, name, name, name, name))
+
+    def genStruct(self, typeinfo, name, alias):
+        OutputGenerator.genStruct(self, typeinfo, name, alias)
+
+        if alias:
+            self.structAliases[name] = alias
+            base = self.structs.get(alias)
+            if base is not None and base.supported:
+                self.appendHeader("common", "goldfish_vk_marshaling",
+                    "#define marshal_%s marshal_%s\n\n#define unmarshal_%s unmarshal_%s\n\n" %
+                    (name, alias, name, alias))
+            return
+
+        members = [CerealValue(m) for m in typeinfo.elem.findall('member')]
+        info = CerealStruct(name, typeinfo.elem.get('category'), members,
+                            self.featureName, typeinfo.elem)
+        self.structs[name] = info
+
+        # Platform-specific structures aren't defined everywhere, and the
+        # base structures are only there to walk pNext chains.
+        if self.featureExtraProtect or \
+           name in ("VkBaseInStructure", "VkBaseOutStructure"):
+            info.supported = False
+        else:
+            info.supported = all(self.isValueSupported(m) for m in members)
+
+        if not info.supported:
+            return
+
+        self.appendHeader("common", "goldfish_vk_marshaling",
+            self.makeStructMarshalProto(name, "marshal", "const ") + ";\n\n" +
+            self.makeStructMarshalProto(name, "unmarshal", "") + ";\n\n")
+        self.appendImpl("common", "goldfish_vk_marshaling", self.makeStructMarshalDefs(info))
+
+        if info.extends and info.sType:
+            self.appendAggregate("marshalExtensionCases",
+                "        case %s:\n"
+                "            marshal_%s(vkStream, (const %s*)ext);\n"
+                "            break;\n" % (info.sType, name, name))
+            self.appendAggregate("unmarshalExtensionCases",
+                "        case %s:\n"
+                "            unmarshal_%s(vkStream, (%s*)ext);\n"
+                "            break;\n" % (info.sType, name, name))
+            self.appendAggregate("extensionSizeCases",
+                "        case %s:\n"
+                "            return sizeof(%s);\n" % (info.sType, name))
+
+################################################################################
+# Commands
+
     def makeFuncProto(self, cmdInfoElem, name, callNamePrefix = "", extraArgs = None, retTypeOverride = None):
         params = cmdInfoElem.findall('param')
 
@@ -231,7 +1308,7 @@ $(call emugl-end-module)
     def makeEncodeProto(self, cmdInfoElem, name):
         return self.makeFuncProto(
             cmdInfoElem, name, "encode_",
-            extraArgs = ["void* vkStream"])
+            extraArgs = ["VulkanStream* vkStream"])
 
     def makeValidateDef(self, cmdInfoElem, name):
         params = cmdInfoElem.findall('param')
@@ -247,8 +1324,74 @@ $(call emugl-end-module)
         self.endBlock();
         return funcPrototype + self.swapCode()
 
+    # How a command goes through the wire format: its parameters, which of
+    # them are outputs, and whether it is supported and needs a reply.
+    class CommandInfo:
+        pass
+
+    def makeCommandInfo(self, cmdInfoElem, name):
+        cmd = self.CommandInfo()
+        cmd.name = name
+        cmd.retType = cmdInfoElem.find('proto').find('type').text
+        cmd.params = [CerealValue(p) for p in cmdInfoElem.findall('param')]
+
+        counts = set(p.countLen() for p in cmd.params)
+
+        # Output parameters are pointers to non-const; counts that other
+        # parameters refer to are also inputs.
+        cmd.outputs = set()
+        cmd.inouts = set()
+        for p in cmd.params:
+            if p.pointers == 1 and not p.isConst:
+                cmd.outputs.add(p.name)
+                if p.name in counts and self.typeKind(p.typeName) == 'scalar':
+                    cmd.inouts.add(p.name)
+
+        cmd.supported = self.isCommandSupported(cmd)
+        cmd.needsReply = cmd.retType != 'void' or len(cmd.outputs) > 0
+
+        # The handle that vkDestroy*() and vkFree*() delete is their last.
+        cmd.destroyed = None
+        if name.startswith("vkDestroy") or name.startswith("vkFree"):
+            for p in cmd.params:
+                if self.typeKind(p.typeName) == 'handle' and p.pointers <= 1:
+                    cmd.destroyed = p
+        return cmd
+
+    def isCommandSupported(self, cmd):
+        if self.featureExtraProtect or cmd.name in self.unsupportedCommands:
+            return False
+        if cmd.retType != 'void' and self.typeKind(cmd.retType) != 'scalar':
+            return False
+        for p in cmd.params:
+            if self.isAllocator(p):
+                continue
+            if not self.isValueSupported(p):
+                return False
+            if p.name in cmd.outputs:
+                if self.typeKind(p.typeName) == 'struct' and \
+                   self.structHasPointers(self.structInfo(p.typeName)):
+                    return False
+        return True
+
+    # The allocation callbacks are the guest's, and never sent.
+    def isAllocator(self, p):
+        return p.typeName == 'VkAllocationCallbacks'
+
+    def makeParamResolver(self, cmd):
+        byName = dict((p.name, p) for p in cmd.params)
+        def resolve(n):
+            p = byName.get(n)
+            if p is not None and p.pointers:
+                return "(%s ? *%s : 0)" % (n, n)
+            return n
+        return resolve
+
+    def makeReturnVar(self, cmd):
+        return "%s_%s_return" % (cmd.name, cmd.retType)
+
     def makeEncoderDef(self, cmdInfoElem, name):
-        params = cmdInfoElem.findall('param')
+        cmd = self.makeCommandInfo(cmdInfoElem, name)
 
         funcPrototype = \
             self.makeEncodeProto(cmdInfoElem, name)
@@ -257,26 +1400,204 @@ $(call emugl-end-module)
 
         self.beginBlock();
 
-        retType = cmdInfoElem.find('proto').find('type').text
-
-        if retType != "void":
-            self.stmt("return (%s)0" % retType)
+        retType = cmd.retType
+
+        if not cmd.supported:
+            self.line("// Not supported by the wire format.")
+            if retType == 'VkResult':
+                self.stmt("return VK_ERROR_FEATURE_NOT_PRESENT")
+            elif retType != "void":
+                self.stmt("return (%s)0" % retType)
+            self.endBlock();
+            return funcPrototype + self.swapCode()
+
+        resolve = self.makeParamResolver(cmd)
+
+        self.stmt("vkStream->beginPacket(OP_%s)" % name)
+        for p in cmd.params:
+            if self.isAllocator(p):
+                continue
+            if p.name in cmd.outputs:
+                self.genMarshalOutputShape(cmd, p, resolve)
+            else:
+                self.genMarshalValue(p, p.name, resolve)
+        self.stmt("vkStream->endPacket()")
+
+        if cmd.needsReply:
+            self.stmt("vkStream->readReply()")
+            returnVar = self.makeReturnVar(cmd)
+            if retType != 'void':
+                self.stmt("%s %s = (%s)0" % (retType, returnVar, retType))
+                self.stmt("vkStream->read(&%s, sizeof(%s))" % (returnVar, retType))
+            outputs = [p for p in cmd.params if p.name in cmd.outputs]
+            if outputs:
+                if retType == 'VkResult':
+                    self.beginIf("%s >= 0" % returnVar)
+                for p in outputs:
+                    self.beginIf(p.name)
+                    count = self.makeCountExpr(p, resolve)
+                    if count:
+                        self.genUnmarshalArray(p, p.name, count)
+                    else:
+                        self.genUnmarshalElement(p, "*" + p.name, p.name)
+                    self.endIf()
+                if retType == 'VkResult':
+                    self.endIf()
+            self.stmt("vkStream->clearPool()")
+            if retType != 'void':
+                self.stmt("return %s" % returnVar)
 
         self.endBlock();
         return funcPrototype + self.swapCode()
 
-    def makeValidateCall(self, cmdInfoElem, name):
-        params = cmdInfoElem.findall('param')
+    # Output parameters are only sent as a presence flag, and what the host
+    # needs to allocate them: the counts they are in and out of, and the
+    # types in their pNext chains.
+    def genMarshalOutputShape(self, cmd, p, resolve):
+        info = self.structInfo(p.typeName) if self.typeKind(p.typeName) == 'struct' else None
+        self.stmt("vkStream->putU32(%s ? 1 : 0)" % p.name)
+        if p.name not in cmd.inouts and not (info and info.hasPNext):
+            return
+        self.beginIf(p.name)
+        if p.name in cmd.inouts:
+            self.genMarshalElement(p, "*" + p.name, p.name)
+        if info and info.hasPNext:
+            count = self.makeCountExpr(p, resolve)
+            if count:
+                self.beginFor("uint32_t i = 0", "i < (uint32_t)%s" % count, "++i")
+                self.stmt("marshal_extension_struct_types(vkStream, %s[i].pNext)" % p.name)
+                self.endBlock()
+            else:
+                self.stmt("marshal_extension_struct_types(vkStream, %s->pNext)" % p.name)
+        self.endIf()
 
-        args = ["&validateResult"]
-        for p in params:
-            ptype = p.find('type')
-            pname = p.find('name')
-            args.append(pname.text)
+    def genUnmarshalOutputShape(self, cmd, p, resolve):
+        kind = self.typeKind(p.typeName)
+        info = self.structInfo(p.typeName) if kind == 'struct' else None
+        elementType = self.rawElementType(p) if kind == 'void' else p.typeName
+        count = self.makeCountExpr(p, resolve)
+        self.beginIf("vkStream->getU32()")
+        self.stmt("%s = (%s*)vkStream->allocArray(%s, sizeof(%s))" %
+                  (p.name, elementType, count if count else "1", elementType))
+        if p.name in cmd.inouts or (info and info.sType):
+            self.beginIf(p.name)
+            if p.name in cmd.inouts:
+                self.genUnmarshalElement(p, "*" + p.name, p.name)
+            if info and info.sType:
+                if count:
+                    self.beginFor("uint32_t i = 0", "i < (uint32_t)%s" % count, "++i")
+                    element = "%s[i]" % p.name
+                else:
+                    element = "(*%s)" % p.name
+                self.stmt("%s.sType = %s" % (element, info.sType))
+                if info.hasPNext:
+                    self.stmt("unmarshal_extension_struct_types(vkStream, (void**)&%s.pNext)" % element)
+                if count:
+                    self.endBlock()
+            self.endIf()
+        self.endIf()
 
-        callName = "validate_" + name
+    def makeDecoderParamDecl(self, p):
+        kind = self.typeKind(p.typeName)
+        if p.staticArray:
+            return "%s %s[%s]" % (p.typeName, p.name, p.staticArray)
+        if p.pointers == 0:
+            if kind in ('struct', 'union'):
+                return "%s %s = {}" % (p.typeName, p.name)
+            return "%s %s" % (p.typeName, p.name)
+        if p.isStringArray():
+            return "char** %s = nullptr" % p.name
+        elementType = self.rawElementType(p) if kind == 'void' else p.typeName
+        return "%s* %s = nullptr" % (elementType, p.name)
+
+    def makeDecoderCase(self, cmd):
+        resolve = self.makeParamResolver(cmd)
+        name = cmd.name
+        retType = cmd.retType
+        returnVar = self.makeReturnVar(cmd)
 
-        return callName + "(" + ", ".join(args) + ")"
+        self.swapCode()
+        self.indentLevel = 3
+        self.line("case OP_%s:" % name)
+        self.beginBlock()
+        self.stmt("m_lock.read()")
+        params = [p for p in cmd.params if not self.isAllocator(p)]
+        for p in params:
+            self.stmt(self.makeDecoderParamDecl(p))
+        for p in params:
+            if p.name in cmd.outputs:
+                self.genUnmarshalOutputShape(cmd, p, resolve)
+            else:
+                self.genUnmarshalValue(p, p.name, resolve, isLocal = True)
+
+        args = ", ".join(
+            ["nullptr" if self.isAllocator(p) else p.name for p in cmd.params])
+        call = "m_vk->%s(%s)" % (name, args)
+
+        outputs = [p for p in params if p.name in cmd.outputs]
+
+        if cmd.needsReply:
+            self.stmt("m_lock.unlock()")
+            if retType == 'VkResult':
+                self.stmt("%s %s = VK_ERROR_DEVICE_LOST" % (retType, returnVar))
+            elif retType != 'void':
+                self.stmt("%s %s = (%s)0" % (retType, returnVar, retType))
+            if outputs:
+                self.stmt("bool called = false")
+
+        self.beginIf("!vkStream->error() && m_vk->%s" % name)
+        if retType != 'void' and cmd.needsReply:
+            self.stmt("%s = %s" % (returnVar, call))
+        else:
+            self.stmt(call)
+        if outputs:
+            self.stmt("called = true")
+        if cmd.destroyed:
+            p = cmd.destroyed
+            self.stmt("m_lock.write()")
+            table = "m_tables->table_%s" % self.handleBase(p.typeName)
+            count = self.makeCountExpr(p, resolve)
+            if count:
+                self.beginFor("uint32_t i = 0", "%s && i < (uint32_t)%s" % (p.name, count), "++i")
+                self.stmt("%s.remove(%s[i])" % (table, p.name))
+                self.endBlock()
+            else:
+                self.stmt("%s.remove(%s)" % (table, p.name))
+        self.endIf()
+        self.line("else")
+        self.beginBlock()
+        self.stmt("onFailedCall(\"%s\")" % name)
+        self.endBlock()
+
+        if cmd.needsReply:
+            lockForHandles = any(self.valueHasHandles(p) for p in outputs)
+            if lockForHandles:
+                self.stmt("m_lock.write()")
+            self.stmt("vkStream->beginReply()")
+            if retType != 'void':
+                self.stmt("vkStream->write(&%s, sizeof(%s))" % (returnVar, retType))
+            if outputs:
+                cond = "called"
+                if retType == 'VkResult':
+                    cond += " && %s >= 0" % returnVar
+                self.beginIf(cond)
+                for p in outputs:
+                    self.beginIf(p.name)
+                    count = self.makeCountExpr(p, resolve)
+                    if count:
+                        self.genMarshalArray(p, p.name, count)
+                    else:
+                        self.genMarshalElement(p, "*" + p.name, p.name)
+                    self.endIf()
+                self.endIf()
+            if lockForHandles:
+                self.stmt("m_lock.unlock()")
+            self.stmt("sendReply(ioStream)")
+
+        self.stmt("break")
+        self.endBlock()
+        self.indentLevel = 0
+        return self.swapCode()
 
     def makeFrontendDef(self, cmdInfoElem, name):
         def makeEncoderCall(cmdInfoElem, name):
@@ -313,8 +1634,7 @@ $(call emugl-end-module)
             self.stmt("return")
         self.endIf()
 
-        self.stmt("// VULKAN_STREAM_GET()")
-        self.stmt("void* vkStream = 0")
+        self.stmt("VulkanStream* vkStream = sGetVulkanStream()")
 
         if retType != 'void':
             self.stmt(retType + " res = " + makeEncoderCall(cmdInfoElem, name))
@@ -329,6 +1649,19 @@ $(call emugl-end-module)
 
         return res
 
+    def makeValidateCall(self, cmdInfoElem, name):
+        params = cmdInfoElem.findall('param')
+
+        args = ["&validateResult"]
+        for p in params:
+            ptype = p.find('type')
+            pname = p.find('name')
+            args.append(pname.text)
+
+        callName = "validate_" + name
+
+        return callName + "(" + ", ".join(args) + ")"
+
     # Command generation
     def genCmd(self, cmdinfo, name, alias):
         OutputGenerator.genCmd(self, cmdinfo, name, alias)
@@ -346,3 +1679,16 @@ $(call emugl-end-module)
 
         self.appendHeader("guest", "goldfish_vk_encoder", encoderDecl)
         self.appendImpl("guest", "goldfish_vk_encoder", encoderDef)
+
+        self.appendHeader("common", "goldfish_vk_opcodes",
+                          "#define OP_%s %d\n" % (name, self.nextOpcode))
+        self.nextOpcode += 1
+
+        self.appendHeader("host", "goldfish_vk_dispatch",
+                          "    PFN_%s %s;\n" % (name, name))
+        self.appendImpl("host", "goldfish_vk_dispatch",
+                        "    out->%s = (PFN_%s)getProc(\"%s\", userData);\n" % (name, name, name))
+
+        cmd = self.makeCommandInfo(cmdinfo.elem, name)
+        if cmd.supported:
+            self.appendAggregate("decoderCases", self.makeDecoderCase(cmd))
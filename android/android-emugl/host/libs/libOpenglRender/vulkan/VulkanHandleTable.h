@@ -0,0 +1,112 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "VulkanStream.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include <inttypes.h>
+
+namespace goldfish_vk {
+
+// Maps the host's handles of one type to the ids the guest knows them by.
+//
+// An id is the index of the handle in a flat array, plus one so that 0 stays
+// VK_NULL_HANDLE, and in its upper 32 bits the generation of that entry,
+// which changes every time it is reused, so that an id the guest keeps after
+// destroying its handle is invalid instead of naming a newer handle. Looking
+// up an id is an array access; adding and removing handles, which only
+// happens in commands that reply anyway, also updates a hash map from
+// handles to ids.
+//
+// Not thread-safe; the decoder locks its tables.
+template <class Handle>
+class VulkanHandleTable {
+public:
+    // Returns the id of |handle|, adding it if it is new.
+    uint64_t add(Handle handle) {
+        const uint64_t bits = handleToU64(handle);
+        if (!bits) {
+            return 0;
+        }
+        auto it = mIds.find(bits);
+        if (it != mIds.end()) {
+            return it->second;
+        }
+        uint32_t index;
+        if (!mFree.empty()) {
+            index = mFree.back();
+            mFree.pop_back();
+        } else {
+            index = static_cast<uint32_t>(mEntries.size());
+            mEntries.push_back({0, 0});
+        }
+        Entry& entry = mEntries[index];
+        entry.handle = bits;
+        const uint64_t id = ((uint64_t)entry.generation << 32) | (index + 1);
+        mIds[bits] = id;
+        return id;
+    }
+
+    // Returns the handle with |id|, or VK_NULL_HANDLE with |*valid| set to
+    // false if there is none. Id 0 is VK_NULL_HANDLE, and valid.
+    Handle get(uint64_t id, bool* valid) const {
+        if (!id) {
+            return handleFromU64<Handle>(0);
+        }
+        const uint32_t index = static_cast<uint32_t>(id) - 1;
+        if (index >= mEntries.size() ||
+            mEntries[index].generation != (uint32_t)(id >> 32) ||
+            !mEntries[index].handle) {
+            *valid = false;
+            return handleFromU64<Handle>(0);
+        }
+        return handleFromU64<Handle>(mEntries[index].handle);
+    }
+
+    // Returns the id of |handle|, or 0 if it is not in the table.
+    uint64_t find(Handle handle) const {
+        auto it = mIds.find(handleToU64(handle));
+        return it != mIds.end() ? it->second : 0;
+    }
+
+    void remove(Handle handle) {
+        auto it = mIds.find(handleToU64(handle));
+        if (it == mIds.end()) {
+            return;
+        }
+        const uint32_t index = static_cast<uint32_t>(it->second) - 1;
+        mIds.erase(it);
+        mEntries[index].handle = 0;
+        ++mEntries[index].generation;
+        mFree.push_back(index);
+    }
+
+    size_t size() const { return mIds.size(); }
+
+private:
+    struct Entry {
+        uint64_t handle;
+        uint32_t generation;
+    };
+
+    std::vector<Entry> mEntries;
+    std::vector<uint32_t> mFree;
+    std::unordered_map<uint64_t, uint64_t> mIds;
+};
+
+}  // namespace goldfish_vk
@@ -0,0 +1,226 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "VulkanStream.h"
+
+#include <stdlib.h>
+
+namespace goldfish_vk {
+
+// The guest sends its packets once it has this many bytes of them.
+static constexpr size_t kFlushThreshold = 64 * 1024;
+
+// No valid packet needs larger allocations than this.
+static constexpr size_t kMaxAllocation = 256 * 1024 * 1024;
+
+static constexpr size_t kPoolAlignment = 16;
+static constexpr size_t kPoolBlockSize = 64 * 1024;
+
+// Unmarshaling a command allocates many small arrays and strings, that all
+// die at once when the command is done; they come from blocks that are
+// reused from one command to the next.
+struct VulkanStream::Pool {
+    struct Block {
+        uint8_t* data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t current = 0;  // Index of the block allocations come from.
+    size_t used = 0;     // Bytes allocated from it.
+    std::vector<void*> large;
+
+    ~Pool() {
+        clear();
+        for (const Block& block : blocks) {
+            free(block.data);
+        }
+    }
+
+    void* alloc(size_t size) {
+        size = (size + kPoolAlignment - 1) & ~(kPoolAlignment - 1);
+        if (size > kPoolBlockSize / 4) {
+            void* ptr = calloc(1, size);
+            if (ptr) {
+                large.push_back(ptr);
+            }
+            return ptr;
+        }
+        if (current < blocks.size() && used + size > blocks[current].size) {
+            ++current;
+            used = 0;
+        }
+        if (current == blocks.size()) {
+            uint8_t* data = static_cast<uint8_t*>(malloc(kPoolBlockSize));
+            if (!data) {
+                return nullptr;
+            }
+            blocks.push_back({data, kPoolBlockSize});
+        }
+        uint8_t* ptr = blocks[current].data + used;
+        used += size;
+        memset(ptr, 0, size);
+        return ptr;
+    }
+
+    void clear() {
+        current = 0;
+        used = 0;
+        for (void* ptr : large) {
+            free(ptr);
+        }
+        large.clear();
+    }
+};
+
+VulkanStream::VulkanStream(VulkanTransport* transport,
+                           VulkanHandleMapping* handleMapping)
+    : mTransport(transport),
+      mHandleMapping(handleMapping),
+      mPool(new Pool()) {}
+
+VulkanStream::~VulkanStream() = default;
+
+void VulkanStream::putString(const char* str) {
+    if (!str) {
+        putU32(0);
+        return;
+    }
+    const size_t len = strlen(str);
+    putU32(static_cast<uint32_t>(len + 1));
+    write(str, len);
+}
+
+void VulkanStream::putStringArray(const char* const* strs, uint32_t count) {
+    for (uint32_t i = 0; i < count; ++i) {
+        putString(strs[i]);
+    }
+}
+
+char* VulkanStream::getString() {
+    const uint32_t size = getU32();
+    if (!size) {
+        return nullptr;
+    }
+    const size_t len = size - 1;
+    if (len > (size_t)(mReadEnd - mReadPos)) {
+        setError();
+        mReadPos = mReadEnd;
+        return nullptr;
+    }
+    char* str = static_cast<char*>(alloc(size));
+    if (!str) {
+        return nullptr;
+    }
+    read(str, len);
+    return str;
+}
+
+char** VulkanStream::getStringArray(uint32_t count) {
+    char** strs = static_cast<char**>(allocArray(count, sizeof(char*)));
+    if (!strs) {
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < count && !mError; ++i) {
+        strs[i] = getString();
+    }
+    return strs;
+}
+
+void VulkanStream::setReadBuffer(const void* data, size_t size) {
+    mReadPos = static_cast<const uint8_t*>(data);
+    mReadEnd = mReadPos + size;
+    mError = false;
+}
+
+void VulkanStream::readPastEnd(void* data, size_t size) {
+    memset(data, 0, size);
+    mReadPos = mReadEnd;
+    mError = true;
+}
+
+void* VulkanStream::alloc(size_t size) {
+    if (size > kMaxAllocation) {
+        setError();
+        return nullptr;
+    }
+    void* ptr = mPool->alloc(size);
+    if (!ptr) {
+        setError();
+    }
+    return ptr;
+}
+
+void* VulkanStream::allocArray(size_t count, size_t elementSize) {
+    if (!count) {
+        return nullptr;
+    }
+    if (count > kMaxAllocation / elementSize) {
+        setError();
+        return nullptr;
+    }
+    return alloc(count * elementSize);
+}
+
+void VulkanStream::clearPool() {
+    mPool->clear();
+}
+
+void VulkanStream::beginPacket(uint32_t opcode) {
+    mPacketStart = mWriteBuffer.size();
+    putU32(opcode);
+    putU32(0);
+}
+
+void VulkanStream::endPacket() {
+    const uint32_t size =
+            static_cast<uint32_t>(mWriteBuffer.size() - mPacketStart);
+    memcpy(mWriteBuffer.data() + mPacketStart + 4, &size, sizeof(size));
+    if (mWriteBuffer.size() >= kFlushThreshold) {
+        flush();
+    }
+}
+
+void VulkanStream::flush() {
+    if (mWriteBuffer.empty()) {
+        return;
+    }
+    mTransport->send(mWriteBuffer.data(), mWriteBuffer.size());
+    mWriteBuffer.clear();
+    mPacketStart = 0;
+}
+
+void VulkanStream::readReply() {
+    flush();
+    uint32_t size = 0;
+    mTransport->receive(&size, sizeof(size));
+    mReplyBuffer.resize(size);
+    if (size) {
+        mTransport->receive(mReplyBuffer.data(), size);
+    }
+    setReadBuffer(mReplyBuffer.data(), size);
+}
+
+void VulkanStream::beginReply() {
+    mWriteBuffer.clear();
+    putU32(0);
+}
+
+const std::vector<uint8_t>& VulkanStream::endReply() {
+    const uint32_t size = static_cast<uint32_t>(mWriteBuffer.size() - 4);
+    memcpy(mWriteBuffer.data(), &size, sizeof(size));
+    return mWriteBuffer;
+}
+
+}  // namespace goldfish_vk
@@ -0,0 +1,173 @@
+// Copyright (C) 2018 The Android Open Source Project
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <string.h>
+
+namespace goldfish_vk {
+
+class VulkanHandleMapping;
+
+// Where a guest VulkanStream sends its packets, and reads replies from.
+class VulkanTransport {
+public:
+    virtual ~VulkanTransport() = default;
+    virtual void send(const void* data, size_t size) = 0;
+    virtual void receive(void* data, size_t size) = 0;
+};
+
+// The wire format of Vulkan commands. The guest encoder writes packets and
+// reads replies with it, the host decoder reads packets and writes replies,
+// and both do it through the generated marshal_* and unmarshal_* functions,
+// so that the two sides agree on the format:
+//
+// - A packet is a uint32_t opcode, the uint32_t size of the whole packet,
+//   and the parameters of the command in order. A reply is a uint32_t size
+//   followed by the return value, if any, and the output parameters.
+// - Scalars are stored as they are in memory, except size_t, which is always
+//   64 bits. Handles are the 64-bit ids of the host's handle tables.
+// - A pointer is a uint32_t that is 0 for NULL, followed by what it points
+//   to. Array counts are not repeated, and strings are a uint32_t length
+//   followed by their characters.
+// - A pNext chain is the uint32_t sType of each structure in it followed by
+//   the structure, and ends with 0. Structures of unknown types are skipped.
+//
+// Packets are buffered until a command needs a reply or the buffer is full,
+// so that commands that don't return anything, such as vkCmd*(), reach the
+// host in bulk.
+class VulkanStream {
+public:
+    // |transport| may be null for a host stream, which never sends packets.
+    VulkanStream(VulkanTransport* transport, VulkanHandleMapping* handleMapping);
+    ~VulkanStream();
+
+    VulkanHandleMapping* handleMapping() const { return mHandleMapping; }
+
+    // Writing.
+    void write(const void* data, size_t size) {
+        const size_t pos = mWriteBuffer.size();
+        mWriteBuffer.resize(pos + size);
+        memcpy(mWriteBuffer.data() + pos, data, size);
+    }
+    void putU32(uint32_t value) { write(&value, sizeof(value)); }
+    void putU64(uint64_t value) { write(&value, sizeof(value)); }
+    void putString(const char* str);
+    void putStringArray(const char* const* strs, uint32_t count);
+
+    // Reading. Reading past the end gives zeros and sets error().
+    void read(void* data, size_t size) {
+        if (size > (size_t)(mReadEnd - mReadPos)) {
+            readPastEnd(data, size);
+            return;
+        }
+        memcpy(data, mReadPos, size);
+        mReadPos += size;
+    }
+    uint32_t getU32() {
+        uint32_t value;
+        read(&value, sizeof(value));
+        return value;
+    }
+    uint64_t getU64() {
+        uint64_t value;
+        read(&value, sizeof(value));
+        return value;
+    }
+    // Strings are allocated with alloc().
+    char* getString();
+    char** getStringArray(uint32_t count);
+
+    // Sets what read() reads, and clears error().
+    void setReadBuffer(const void* data, size_t size);
+
+    // Zeroed memory for what unmarshaled structures point to, freed by
+    // clearPool(). An allocation that is too large to come from a valid
+    // packet returns null and sets error().
+    void* alloc(size_t size);
+    void* allocArray(size_t count, size_t elementSize);
+    void clearPool();
+
+    // Set when a packet or a reply is malformed, e.g. too short or with an
+    // invalid handle.
+    bool error() const { return mError; }
+    void setError() { mError = true; }
+
+    // Guest side: packets.
+    void beginPacket(uint32_t opcode);
+    // Sends the packets written so far if there are enough of them.
+    void endPacket();
+    // Sends the packets written so far.
+    void flush();
+    // Sends the packets written so far, waits for the reply to the last one
+    // and makes it what read() reads.
+    void readReply();
+
+    // Host side: replies. endReply() returns the reply written since
+    // beginReply(), with its size in front, ready to send.
+    void beginReply();
+    const std::vector<uint8_t>& endReply();
+
+private:
+    void readPastEnd(void* data, size_t size);
+
+    VulkanTransport* mTransport;
+    VulkanHandleMapping* mHandleMapping;
+
+    std::vector<uint8_t> mWriteBuffer;
+    size_t mPacketStart = 0;
+
+    const uint8_t* mReadPos = nullptr;
+    const uint8_t* mReadEnd = nullptr;
+    std::vector<uint8_t> mReplyBuffer;
+    bool mError = false;
+
+    struct Pool;
+    std::unique_ptr<Pool> mPool;
+};
+
+// Handles of every type are 64-bit ids on the wire. Dispatchable handles are
+// pointers, and non-dispatchable ones are pointers on 64-bit hosts and
+// uint64_t elsewhere.
+template <class Handle>
+inline typename std::enable_if<std::is_pointer<Handle>::value, uint64_t>::type
+handleToU64(Handle handle) {
+    return (uint64_t)(uintptr_t)handle;
+}
+
+template <class Handle>
+inline typename std::enable_if<!std::is_pointer<Handle>::value, uint64_t>::type
+handleToU64(Handle handle) {
+    return (uint64_t)handle;
+}
+
+template <class Handle>
+inline typename std::enable_if<std::is_pointer<Handle>::value, Handle>::type
+handleFromU64(uint64_t id) {
+    return (Handle)(uintptr_t)id;
+}
+
+template <class Handle>
+inline typename std::enable_if<!std::is_pointer<Handle>::value, Handle>::type
+handleFromU64(uint64_t id) {
+    return (Handle)id;
+}
+
+}  // namespace goldfish_vk
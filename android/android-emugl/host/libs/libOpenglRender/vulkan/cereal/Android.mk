@@ -5,6 +5,8 @@ LOCAL_PATH := $(call my-dir)
 
 cereal_C_INCLUDES := \
     $(LOCAL_PATH) \
+    $(LOCAL_PATH)/.. \
+    $(EMUGL_PATH)/host/include \
     $(EMUGL_PATH)/host/include/vulkan \
 
 cereal_STATIC_LIBRARIES := \
@@ -12,14 +14,43 @@ cereal_STATIC_LIBRARIES := \
     android-emu-base \
 
 
+$(call emugl-begin-static-library,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_common)
+
+LOCAL_C_INCLUDES += $(cereal_C_INCLUDES)
+
+LOCAL_STATIC_LIBRARIES += $(cereal_STATIC_LIBRARIES)
+
+LOCAL_SRC_FILES := \
+    ../VulkanStream.cpp \
+    common/goldfish_vk_marshaling.cpp \
+
+$(call emugl-export,C_INCLUDES,$(cereal_C_INCLUDES))
+
+$(call emugl-end-module)
+
 $(call emugl-begin-static-library,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_guest)
+$(call emugl-import,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_common)
 
 LOCAL_C_INCLUDES += $(cereal_C_INCLUDES)
 
 LOCAL_STATIC_LIBRARIES += $(cereal_STATIC_LIBRARIES)
 
 LOCAL_SRC_FILES := \
+    guest/goldfish_vk_encoder.cpp \
     guest/goldfish_vk_frontend.cpp \
 
 $(call emugl-end-module)
 
+$(call emugl-begin-static-library,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_host)
+$(call emugl-import,lib$(BUILD_TARGET_SUFFIX)OpenglRender_vulkan_cereal_common libOpenglCodecCommon)
+
+LOCAL_C_INCLUDES += $(cereal_C_INCLUDES)
+
+LOCAL_STATIC_LIBRARIES += $(cereal_STATIC_LIBRARIES)
+
+LOCAL_SRC_FILES := \
+    host/goldfish_vk_decoder.cpp \
+    host/goldfish_vk_dispatch.cpp \
+
+$(call emugl-end-module)
+
@@ -0,0 +1,11284 @@
+// Module: goldfish_vk_marshaling (impl) Autogenerated by CerealGenerator
+
+
+#include "goldfish_vk_marshaling.h"
+
+namespace goldfish_vk {
+
+#ifdef VK_VERSION_1_0
+
+void marshal_VkApplicationInfo(
+    VulkanStream* vkStream,
+    const VkApplicationInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putString(forMarshaling->pApplicationName);
+    vkStream->write(&forMarshaling->applicationVersion, sizeof(uint32_t));
+    vkStream->putString(forMarshaling->pEngineName);
+    vkStream->write(&forMarshaling->engineVersion, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->apiVersion, sizeof(uint32_t));
+}
+
+void unmarshal_VkApplicationInfo(
+    VulkanStream* vkStream,
+    VkApplicationInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->pApplicationName = vkStream->getString();
+    vkStream->read(&forUnmarshaling->applicationVersion, sizeof(uint32_t));
+    forUnmarshaling->pEngineName = vkStream->getString();
+    vkStream->read(&forUnmarshaling->engineVersion, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->apiVersion, sizeof(uint32_t));
+}
+
+
+void marshal_VkInstanceCreateInfo(
+    VulkanStream* vkStream,
+    const VkInstanceCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkInstanceCreateFlags));
+    vkStream->putU32(forMarshaling->pApplicationInfo ? 1 : 0);
+    if (forMarshaling->pApplicationInfo)
+    {
+        marshal_VkApplicationInfo(vkStream, forMarshaling->pApplicationInfo);
+    }
+    vkStream->write(&forMarshaling->enabledLayerCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->ppEnabledLayerNames ? 1 : 0);
+    if (forMarshaling->ppEnabledLayerNames)
+    {
+        vkStream->putStringArray(forMarshaling->ppEnabledLayerNames, forMarshaling->enabledLayerCount);
+    }
+    vkStream->write(&forMarshaling->enabledExtensionCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->ppEnabledExtensionNames ? 1 : 0);
+    if (forMarshaling->ppEnabledExtensionNames)
+    {
+        vkStream->putStringArray(forMarshaling->ppEnabledExtensionNames, forMarshaling->enabledExtensionCount);
+    }
+}
+
+void unmarshal_VkInstanceCreateInfo(
+    VulkanStream* vkStream,
+    VkInstanceCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkInstanceCreateFlags));
+    if (vkStream->getU32())
+    {
+        VkApplicationInfo* pApplicationInfo = (VkApplicationInfo*)vkStream->allocArray(1, sizeof(VkApplicationInfo));
+        forUnmarshaling->pApplicationInfo = pApplicationInfo;
+        if (pApplicationInfo)
+        {
+            unmarshal_VkApplicationInfo(vkStream, pApplicationInfo);
+        }
+    }
+    vkStream->read(&forUnmarshaling->enabledLayerCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        forUnmarshaling->ppEnabledLayerNames = vkStream->getStringArray(forUnmarshaling->enabledLayerCount);
+    }
+    vkStream->read(&forUnmarshaling->enabledExtensionCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        forUnmarshaling->ppEnabledExtensionNames = vkStream->getStringArray(forUnmarshaling->enabledExtensionCount);
+    }
+}
+
+
+void marshal_VkPhysicalDeviceFeatures(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceFeatures* forMarshaling)
+{
+    vkStream->write(&forMarshaling->robustBufferAccess, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->fullDrawIndexUint32, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->imageCubeArray, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->independentBlend, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->geometryShader, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->tessellationShader, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sampleRateShading, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->dualSrcBlend, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->logicOp, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->multiDrawIndirect, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->drawIndirectFirstInstance, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->depthClamp, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->depthBiasClamp, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->fillModeNonSolid, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->depthBounds, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->wideLines, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->largePoints, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->alphaToOne, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->multiViewport, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->samplerAnisotropy, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->textureCompressionETC2, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->textureCompressionASTC_LDR, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->textureCompressionBC, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->occlusionQueryPrecise, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->pipelineStatisticsQuery, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->vertexPipelineStoresAndAtomics, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->fragmentStoresAndAtomics, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderTessellationAndGeometryPointSize, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderImageGatherExtended, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageImageExtendedFormats, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageImageMultisample, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageImageReadWithoutFormat, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageImageWriteWithoutFormat, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderUniformBufferArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderSampledImageArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageBufferArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageImageArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderClipDistance, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderCullDistance, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderFloat64, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderInt64, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderInt16, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderResourceResidency, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderResourceMinLod, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sparseBinding, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sparseResidencyBuffer, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sparseResidencyImage2D, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sparseResidencyImage3D, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sparseResidency2Samples, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sparseResidency4Samples, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sparseResidency8Samples, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sparseResidency16Samples, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->sparseResidencyAliased, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->variableMultisampleRate, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->inheritedQueries, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceFeatures(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceFeatures* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->robustBufferAccess, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->fullDrawIndexUint32, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->imageCubeArray, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->independentBlend, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->geometryShader, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->tessellationShader, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sampleRateShading, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->dualSrcBlend, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->logicOp, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->multiDrawIndirect, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->drawIndirectFirstInstance, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->depthClamp, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->depthBiasClamp, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->fillModeNonSolid, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->depthBounds, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->wideLines, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->largePoints, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->alphaToOne, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->multiViewport, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->samplerAnisotropy, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->textureCompressionETC2, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->textureCompressionASTC_LDR, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->textureCompressionBC, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->occlusionQueryPrecise, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->pipelineStatisticsQuery, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->vertexPipelineStoresAndAtomics, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->fragmentStoresAndAtomics, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderTessellationAndGeometryPointSize, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderImageGatherExtended, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageImageExtendedFormats, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageImageMultisample, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageImageReadWithoutFormat, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageImageWriteWithoutFormat, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderUniformBufferArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderSampledImageArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageBufferArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageImageArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderClipDistance, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderCullDistance, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderFloat64, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderInt64, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderInt16, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderResourceResidency, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderResourceMinLod, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sparseBinding, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sparseResidencyBuffer, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sparseResidencyImage2D, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sparseResidencyImage3D, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sparseResidency2Samples, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sparseResidency4Samples, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sparseResidency8Samples, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sparseResidency16Samples, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->sparseResidencyAliased, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->variableMultisampleRate, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->inheritedQueries, sizeof(VkBool32));
+}
+
+
+void marshal_VkFormatProperties(
+    VulkanStream* vkStream,
+    const VkFormatProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->linearTilingFeatures, sizeof(VkFormatFeatureFlags));
+    vkStream->write(&forMarshaling->optimalTilingFeatures, sizeof(VkFormatFeatureFlags));
+    vkStream->write(&forMarshaling->bufferFeatures, sizeof(VkFormatFeatureFlags));
+}
+
+void unmarshal_VkFormatProperties(
+    VulkanStream* vkStream,
+    VkFormatProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->linearTilingFeatures, sizeof(VkFormatFeatureFlags));
+    vkStream->read(&forUnmarshaling->optimalTilingFeatures, sizeof(VkFormatFeatureFlags));
+    vkStream->read(&forUnmarshaling->bufferFeatures, sizeof(VkFormatFeatureFlags));
+}
+
+
+void marshal_VkExtent3D(
+    VulkanStream* vkStream,
+    const VkExtent3D* forMarshaling)
+{
+    vkStream->write(&forMarshaling->width, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->height, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->depth, sizeof(uint32_t));
+}
+
+void unmarshal_VkExtent3D(
+    VulkanStream* vkStream,
+    VkExtent3D* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->width, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->height, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->depth, sizeof(uint32_t));
+}
+
+
+void marshal_VkImageFormatProperties(
+    VulkanStream* vkStream,
+    const VkImageFormatProperties* forMarshaling)
+{
+    marshal_VkExtent3D(vkStream, &forMarshaling->maxExtent);
+    vkStream->write(&forMarshaling->maxMipLevels, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxArrayLayers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->sampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->maxResourceSize, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkImageFormatProperties(
+    VulkanStream* vkStream,
+    VkImageFormatProperties* forUnmarshaling)
+{
+    unmarshal_VkExtent3D(vkStream, &forUnmarshaling->maxExtent);
+    vkStream->read(&forUnmarshaling->maxMipLevels, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxArrayLayers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->sampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->maxResourceSize, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkPhysicalDeviceLimits(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceLimits* forMarshaling)
+{
+    vkStream->write(&forMarshaling->maxImageDimension1D, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxImageDimension2D, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxImageDimension3D, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxImageDimensionCube, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxImageArrayLayers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxTexelBufferElements, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxUniformBufferRange, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxStorageBufferRange, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPushConstantsSize, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxMemoryAllocationCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxSamplerAllocationCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->bufferImageGranularity, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->sparseAddressSpaceSize, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->maxBoundDescriptorSets, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorSamplers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorUniformBuffers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorStorageBuffers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorSampledImages, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorStorageImages, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorInputAttachments, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageResources, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetSamplers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUniformBuffers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUniformBuffersDynamic, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetStorageBuffers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetStorageBuffersDynamic, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetSampledImages, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetStorageImages, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetInputAttachments, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxVertexInputAttributes, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxVertexInputBindings, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxVertexInputAttributeOffset, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxVertexInputBindingStride, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxVertexOutputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxTessellationGenerationLevel, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxTessellationPatchSize, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxTessellationControlPerVertexInputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxTessellationControlPerVertexOutputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxTessellationControlPerPatchOutputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxTessellationControlTotalOutputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxTessellationEvaluationInputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxTessellationEvaluationOutputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxGeometryShaderInvocations, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxGeometryInputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxGeometryOutputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxGeometryOutputVertices, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxGeometryTotalOutputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxFragmentInputComponents, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxFragmentOutputAttachments, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxFragmentDualSrcAttachments, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxFragmentCombinedOutputResources, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxComputeSharedMemorySize, sizeof(uint32_t));
+    vkStream->write(forMarshaling->maxComputeWorkGroupCount, 3 * sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxComputeWorkGroupInvocations, sizeof(uint32_t));
+    vkStream->write(forMarshaling->maxComputeWorkGroupSize, 3 * sizeof(uint32_t));
+    vkStream->write(&forMarshaling->subPixelPrecisionBits, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->subTexelPrecisionBits, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->mipmapPrecisionBits, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDrawIndexedIndexValue, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDrawIndirectCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxSamplerLodBias, sizeof(float));
+    vkStream->write(&forMarshaling->maxSamplerAnisotropy, sizeof(float));
+    vkStream->write(&forMarshaling->maxViewports, sizeof(uint32_t));
+    vkStream->write(forMarshaling->maxViewportDimensions, 2 * sizeof(uint32_t));
+    vkStream->write(forMarshaling->viewportBoundsRange, 2 * sizeof(float));
+    vkStream->write(&forMarshaling->viewportSubPixelBits, sizeof(uint32_t));
+    vkStream->putU64((uint64_t)forMarshaling->minMemoryMapAlignment);
+    vkStream->write(&forMarshaling->minTexelBufferOffsetAlignment, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->minUniformBufferOffsetAlignment, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->minStorageBufferOffsetAlignment, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->minTexelOffset, sizeof(int32_t));
+    vkStream->write(&forMarshaling->maxTexelOffset, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->minTexelGatherOffset, sizeof(int32_t));
+    vkStream->write(&forMarshaling->maxTexelGatherOffset, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->minInterpolationOffset, sizeof(float));
+    vkStream->write(&forMarshaling->maxInterpolationOffset, sizeof(float));
+    vkStream->write(&forMarshaling->subPixelInterpolationOffsetBits, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxFramebufferWidth, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxFramebufferHeight, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxFramebufferLayers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->framebufferColorSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->framebufferDepthSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->framebufferStencilSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->framebufferNoAttachmentsSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->maxColorAttachments, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->sampledImageColorSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->sampledImageIntegerSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->sampledImageDepthSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->sampledImageStencilSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->storageImageSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->write(&forMarshaling->maxSampleMaskWords, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->timestampComputeAndGraphics, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->timestampPeriod, sizeof(float));
+    vkStream->write(&forMarshaling->maxClipDistances, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxCullDistances, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxCombinedClipAndCullDistances, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->discreteQueuePriorities, sizeof(uint32_t));
+    vkStream->write(forMarshaling->pointSizeRange, 2 * sizeof(float));
+    vkStream->write(forMarshaling->lineWidthRange, 2 * sizeof(float));
+    vkStream->write(&forMarshaling->pointSizeGranularity, sizeof(float));
+    vkStream->write(&forMarshaling->lineWidthGranularity, sizeof(float));
+    vkStream->write(&forMarshaling->strictLines, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->standardSampleLocations, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->optimalBufferCopyOffsetAlignment, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->optimalBufferCopyRowPitchAlignment, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->nonCoherentAtomSize, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkPhysicalDeviceLimits(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceLimits* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->maxImageDimension1D, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxImageDimension2D, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxImageDimension3D, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxImageDimensionCube, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxImageArrayLayers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxTexelBufferElements, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxUniformBufferRange, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxStorageBufferRange, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPushConstantsSize, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxMemoryAllocationCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxSamplerAllocationCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->bufferImageGranularity, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->sparseAddressSpaceSize, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->maxBoundDescriptorSets, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorSamplers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorUniformBuffers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorStorageBuffers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorSampledImages, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorStorageImages, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorInputAttachments, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageResources, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetSamplers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUniformBuffers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUniformBuffersDynamic, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetStorageBuffers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetStorageBuffersDynamic, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetSampledImages, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetStorageImages, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetInputAttachments, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxVertexInputAttributes, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxVertexInputBindings, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxVertexInputAttributeOffset, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxVertexInputBindingStride, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxVertexOutputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxTessellationGenerationLevel, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxTessellationPatchSize, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxTessellationControlPerVertexInputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxTessellationControlPerVertexOutputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxTessellationControlPerPatchOutputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxTessellationControlTotalOutputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxTessellationEvaluationInputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxTessellationEvaluationOutputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxGeometryShaderInvocations, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxGeometryInputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxGeometryOutputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxGeometryOutputVertices, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxGeometryTotalOutputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxFragmentInputComponents, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxFragmentOutputAttachments, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxFragmentDualSrcAttachments, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxFragmentCombinedOutputResources, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxComputeSharedMemorySize, sizeof(uint32_t));
+    vkStream->read(forUnmarshaling->maxComputeWorkGroupCount, 3 * sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxComputeWorkGroupInvocations, sizeof(uint32_t));
+    vkStream->read(forUnmarshaling->maxComputeWorkGroupSize, 3 * sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->subPixelPrecisionBits, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->subTexelPrecisionBits, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->mipmapPrecisionBits, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDrawIndexedIndexValue, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDrawIndirectCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxSamplerLodBias, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxSamplerAnisotropy, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxViewports, sizeof(uint32_t));
+    vkStream->read(forUnmarshaling->maxViewportDimensions, 2 * sizeof(uint32_t));
+    vkStream->read(forUnmarshaling->viewportBoundsRange, 2 * sizeof(float));
+    vkStream->read(&forUnmarshaling->viewportSubPixelBits, sizeof(uint32_t));
+    forUnmarshaling->minMemoryMapAlignment = (size_t)vkStream->getU64();
+    vkStream->read(&forUnmarshaling->minTexelBufferOffsetAlignment, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->minUniformBufferOffsetAlignment, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->minStorageBufferOffsetAlignment, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->minTexelOffset, sizeof(int32_t));
+    vkStream->read(&forUnmarshaling->maxTexelOffset, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->minTexelGatherOffset, sizeof(int32_t));
+    vkStream->read(&forUnmarshaling->maxTexelGatherOffset, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->minInterpolationOffset, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxInterpolationOffset, sizeof(float));
+    vkStream->read(&forUnmarshaling->subPixelInterpolationOffsetBits, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxFramebufferWidth, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxFramebufferHeight, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxFramebufferLayers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->framebufferColorSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->framebufferDepthSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->framebufferStencilSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->framebufferNoAttachmentsSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->maxColorAttachments, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->sampledImageColorSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->sampledImageIntegerSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->sampledImageDepthSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->sampledImageStencilSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->storageImageSampleCounts, sizeof(VkSampleCountFlags));
+    vkStream->read(&forUnmarshaling->maxSampleMaskWords, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->timestampComputeAndGraphics, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->timestampPeriod, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxClipDistances, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxCullDistances, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxCombinedClipAndCullDistances, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->discreteQueuePriorities, sizeof(uint32_t));
+    vkStream->read(forUnmarshaling->pointSizeRange, 2 * sizeof(float));
+    vkStream->read(forUnmarshaling->lineWidthRange, 2 * sizeof(float));
+    vkStream->read(&forUnmarshaling->pointSizeGranularity, sizeof(float));
+    vkStream->read(&forUnmarshaling->lineWidthGranularity, sizeof(float));
+    vkStream->read(&forUnmarshaling->strictLines, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->standardSampleLocations, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->optimalBufferCopyOffsetAlignment, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->optimalBufferCopyRowPitchAlignment, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->nonCoherentAtomSize, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkPhysicalDeviceSparseProperties(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceSparseProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->residencyStandard2DBlockShape, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->residencyStandard2DMultisampleBlockShape, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->residencyStandard3DBlockShape, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->residencyAlignedMipSize, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->residencyNonResidentStrict, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceSparseProperties(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceSparseProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->residencyStandard2DBlockShape, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->residencyStandard2DMultisampleBlockShape, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->residencyStandard3DBlockShape, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->residencyAlignedMipSize, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->residencyNonResidentStrict, sizeof(VkBool32));
+}
+
+
+void marshal_VkPhysicalDeviceProperties(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->apiVersion, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->driverVersion, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->vendorID, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->deviceID, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->deviceType, sizeof(VkPhysicalDeviceType));
+    vkStream->write(forMarshaling->deviceName, VK_MAX_PHYSICAL_DEVICE_NAME_SIZE * sizeof(char));
+    vkStream->write(forMarshaling->pipelineCacheUUID, VK_UUID_SIZE * sizeof(uint8_t));
+    marshal_VkPhysicalDeviceLimits(vkStream, &forMarshaling->limits);
+    marshal_VkPhysicalDeviceSparseProperties(vkStream, &forMarshaling->sparseProperties);
+}
+
+void unmarshal_VkPhysicalDeviceProperties(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->apiVersion, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->driverVersion, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->vendorID, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->deviceID, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->deviceType, sizeof(VkPhysicalDeviceType));
+    vkStream->read(forUnmarshaling->deviceName, VK_MAX_PHYSICAL_DEVICE_NAME_SIZE * sizeof(char));
+    vkStream->read(forUnmarshaling->pipelineCacheUUID, VK_UUID_SIZE * sizeof(uint8_t));
+    unmarshal_VkPhysicalDeviceLimits(vkStream, &forUnmarshaling->limits);
+    unmarshal_VkPhysicalDeviceSparseProperties(vkStream, &forUnmarshaling->sparseProperties);
+}
+
+
+void marshal_VkQueueFamilyProperties(
+    VulkanStream* vkStream,
+    const VkQueueFamilyProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->queueFlags, sizeof(VkQueueFlags));
+    vkStream->write(&forMarshaling->queueCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->timestampValidBits, sizeof(uint32_t));
+    marshal_VkExtent3D(vkStream, &forMarshaling->minImageTransferGranularity);
+}
+
+void unmarshal_VkQueueFamilyProperties(
+    VulkanStream* vkStream,
+    VkQueueFamilyProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->queueFlags, sizeof(VkQueueFlags));
+    vkStream->read(&forUnmarshaling->queueCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->timestampValidBits, sizeof(uint32_t));
+    unmarshal_VkExtent3D(vkStream, &forUnmarshaling->minImageTransferGranularity);
+}
+
+
+void marshal_VkMemoryType(
+    VulkanStream* vkStream,
+    const VkMemoryType* forMarshaling)
+{
+    vkStream->write(&forMarshaling->propertyFlags, sizeof(VkMemoryPropertyFlags));
+    vkStream->write(&forMarshaling->heapIndex, sizeof(uint32_t));
+}
+
+void unmarshal_VkMemoryType(
+    VulkanStream* vkStream,
+    VkMemoryType* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->propertyFlags, sizeof(VkMemoryPropertyFlags));
+    vkStream->read(&forUnmarshaling->heapIndex, sizeof(uint32_t));
+}
+
+
+void marshal_VkMemoryHeap(
+    VulkanStream* vkStream,
+    const VkMemoryHeap* forMarshaling)
+{
+    vkStream->write(&forMarshaling->size, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->flags, sizeof(VkMemoryHeapFlags));
+}
+
+void unmarshal_VkMemoryHeap(
+    VulkanStream* vkStream,
+    VkMemoryHeap* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->size, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkMemoryHeapFlags));
+}
+
+
+void marshal_VkPhysicalDeviceMemoryProperties(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceMemoryProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->memoryTypeCount, sizeof(uint32_t));
+    for (uint32_t i = 0; i < (uint32_t)VK_MAX_MEMORY_TYPES; ++i)
+    {
+        marshal_VkMemoryType(vkStream, forMarshaling->memoryTypes + i);
+    }
+    vkStream->write(&forMarshaling->memoryHeapCount, sizeof(uint32_t));
+    for (uint32_t i = 0; i < (uint32_t)VK_MAX_MEMORY_HEAPS; ++i)
+    {
+        marshal_VkMemoryHeap(vkStream, forMarshaling->memoryHeaps + i);
+    }
+}
+
+void unmarshal_VkPhysicalDeviceMemoryProperties(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceMemoryProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->memoryTypeCount, sizeof(uint32_t));
+    for (uint32_t i = 0; i < (uint32_t)VK_MAX_MEMORY_TYPES; ++i)
+    {
+        unmarshal_VkMemoryType(vkStream, forUnmarshaling->memoryTypes + i);
+    }
+    vkStream->read(&forUnmarshaling->memoryHeapCount, sizeof(uint32_t));
+    for (uint32_t i = 0; i < (uint32_t)VK_MAX_MEMORY_HEAPS; ++i)
+    {
+        unmarshal_VkMemoryHeap(vkStream, forUnmarshaling->memoryHeaps + i);
+    }
+}
+
+
+void marshal_VkDeviceQueueCreateInfo(
+    VulkanStream* vkStream,
+    const VkDeviceQueueCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkDeviceQueueCreateFlags));
+    vkStream->write(&forMarshaling->queueFamilyIndex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->queueCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pQueuePriorities ? 1 : 0);
+    if (forMarshaling->pQueuePriorities)
+    {
+        vkStream->write(forMarshaling->pQueuePriorities, forMarshaling->queueCount * sizeof(float));
+    }
+}
+
+void unmarshal_VkDeviceQueueCreateInfo(
+    VulkanStream* vkStream,
+    VkDeviceQueueCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkDeviceQueueCreateFlags));
+    vkStream->read(&forUnmarshaling->queueFamilyIndex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->queueCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        float* pQueuePriorities = (float*)vkStream->allocArray(forUnmarshaling->queueCount, sizeof(float));
+        forUnmarshaling->pQueuePriorities = pQueuePriorities;
+        if (pQueuePriorities)
+        {
+            vkStream->read(pQueuePriorities, forUnmarshaling->queueCount * sizeof(float));
+        }
+    }
+}
+
+
+void marshal_VkDeviceCreateInfo(
+    VulkanStream* vkStream,
+    const VkDeviceCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkDeviceCreateFlags));
+    vkStream->write(&forMarshaling->queueCreateInfoCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pQueueCreateInfos ? 1 : 0);
+    if (forMarshaling->pQueueCreateInfos)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->queueCreateInfoCount; ++i)
+        {
+            marshal_VkDeviceQueueCreateInfo(vkStream, forMarshaling->pQueueCreateInfos + i);
+        }
+    }
+    vkStream->write(&forMarshaling->enabledLayerCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->ppEnabledLayerNames ? 1 : 0);
+    if (forMarshaling->ppEnabledLayerNames)
+    {
+        vkStream->putStringArray(forMarshaling->ppEnabledLayerNames, forMarshaling->enabledLayerCount);
+    }
+    vkStream->write(&forMarshaling->enabledExtensionCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->ppEnabledExtensionNames ? 1 : 0);
+    if (forMarshaling->ppEnabledExtensionNames)
+    {
+        vkStream->putStringArray(forMarshaling->ppEnabledExtensionNames, forMarshaling->enabledExtensionCount);
+    }
+    vkStream->putU32(forMarshaling->pEnabledFeatures ? 1 : 0);
+    if (forMarshaling->pEnabledFeatures)
+    {
+        marshal_VkPhysicalDeviceFeatures(vkStream, forMarshaling->pEnabledFeatures);
+    }
+}
+
+void unmarshal_VkDeviceCreateInfo(
+    VulkanStream* vkStream,
+    VkDeviceCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkDeviceCreateFlags));
+    vkStream->read(&forUnmarshaling->queueCreateInfoCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDeviceQueueCreateInfo* pQueueCreateInfos = (VkDeviceQueueCreateInfo*)vkStream->allocArray(forUnmarshaling->queueCreateInfoCount, sizeof(VkDeviceQueueCreateInfo));
+        forUnmarshaling->pQueueCreateInfos = pQueueCreateInfos;
+        if (pQueueCreateInfos)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->queueCreateInfoCount; ++i)
+            {
+                unmarshal_VkDeviceQueueCreateInfo(vkStream, pQueueCreateInfos + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->enabledLayerCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        forUnmarshaling->ppEnabledLayerNames = vkStream->getStringArray(forUnmarshaling->enabledLayerCount);
+    }
+    vkStream->read(&forUnmarshaling->enabledExtensionCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        forUnmarshaling->ppEnabledExtensionNames = vkStream->getStringArray(forUnmarshaling->enabledExtensionCount);
+    }
+    if (vkStream->getU32())
+    {
+        VkPhysicalDeviceFeatures* pEnabledFeatures = (VkPhysicalDeviceFeatures*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceFeatures));
+        forUnmarshaling->pEnabledFeatures = pEnabledFeatures;
+        if (pEnabledFeatures)
+        {
+            unmarshal_VkPhysicalDeviceFeatures(vkStream, pEnabledFeatures);
+        }
+    }
+}
+
+
+void marshal_VkExtensionProperties(
+    VulkanStream* vkStream,
+    const VkExtensionProperties* forMarshaling)
+{
+    vkStream->write(forMarshaling->extensionName, VK_MAX_EXTENSION_NAME_SIZE * sizeof(char));
+    vkStream->write(&forMarshaling->specVersion, sizeof(uint32_t));
+}
+
+void unmarshal_VkExtensionProperties(
+    VulkanStream* vkStream,
+    VkExtensionProperties* forUnmarshaling)
+{
+    vkStream->read(forUnmarshaling->extensionName, VK_MAX_EXTENSION_NAME_SIZE * sizeof(char));
+    vkStream->read(&forUnmarshaling->specVersion, sizeof(uint32_t));
+}
+
+
+void marshal_VkLayerProperties(
+    VulkanStream* vkStream,
+    const VkLayerProperties* forMarshaling)
+{
+    vkStream->write(forMarshaling->layerName, VK_MAX_EXTENSION_NAME_SIZE * sizeof(char));
+    vkStream->write(&forMarshaling->specVersion, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->implementationVersion, sizeof(uint32_t));
+    vkStream->write(forMarshaling->description, VK_MAX_DESCRIPTION_SIZE * sizeof(char));
+}
+
+void unmarshal_VkLayerProperties(
+    VulkanStream* vkStream,
+    VkLayerProperties* forUnmarshaling)
+{
+    vkStream->read(forUnmarshaling->layerName, VK_MAX_EXTENSION_NAME_SIZE * sizeof(char));
+    vkStream->read(&forUnmarshaling->specVersion, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->implementationVersion, sizeof(uint32_t));
+    vkStream->read(forUnmarshaling->description, VK_MAX_DESCRIPTION_SIZE * sizeof(char));
+}
+
+
+void marshal_VkSubmitInfo(
+    VulkanStream* vkStream,
+    const VkSubmitInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->waitSemaphoreCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pWaitSemaphores ? 1 : 0);
+    if (forMarshaling->pWaitSemaphores)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->waitSemaphoreCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(forMarshaling->pWaitSemaphores[i]));
+        }
+    }
+    vkStream->putU32(forMarshaling->pWaitDstStageMask ? 1 : 0);
+    if (forMarshaling->pWaitDstStageMask)
+    {
+        vkStream->write(forMarshaling->pWaitDstStageMask, forMarshaling->waitSemaphoreCount * sizeof(VkPipelineStageFlags));
+    }
+    vkStream->write(&forMarshaling->commandBufferCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pCommandBuffers ? 1 : 0);
+    if (forMarshaling->pCommandBuffers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->commandBufferCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(forMarshaling->pCommandBuffers[i]));
+        }
+    }
+    vkStream->write(&forMarshaling->signalSemaphoreCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSignalSemaphores ? 1 : 0);
+    if (forMarshaling->pSignalSemaphores)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->signalSemaphoreCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(forMarshaling->pSignalSemaphores[i]));
+        }
+    }
+}
+
+void unmarshal_VkSubmitInfo(
+    VulkanStream* vkStream,
+    VkSubmitInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->waitSemaphoreCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSemaphore* pWaitSemaphores = (VkSemaphore*)vkStream->allocArray(forUnmarshaling->waitSemaphoreCount, sizeof(VkSemaphore));
+        forUnmarshaling->pWaitSemaphores = pWaitSemaphores;
+        if (pWaitSemaphores)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->waitSemaphoreCount; ++i)
+            {
+                pWaitSemaphores[i] = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineStageFlags* pWaitDstStageMask = (VkPipelineStageFlags*)vkStream->allocArray(forUnmarshaling->waitSemaphoreCount, sizeof(VkPipelineStageFlags));
+        forUnmarshaling->pWaitDstStageMask = pWaitDstStageMask;
+        if (pWaitDstStageMask)
+        {
+            vkStream->read(pWaitDstStageMask, forUnmarshaling->waitSemaphoreCount * sizeof(VkPipelineStageFlags));
+        }
+    }
+    vkStream->read(&forUnmarshaling->commandBufferCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkCommandBuffer* pCommandBuffers = (VkCommandBuffer*)vkStream->allocArray(forUnmarshaling->commandBufferCount, sizeof(VkCommandBuffer));
+        forUnmarshaling->pCommandBuffers = pCommandBuffers;
+        if (pCommandBuffers)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->commandBufferCount; ++i)
+            {
+                pCommandBuffers[i] = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->signalSemaphoreCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSemaphore* pSignalSemaphores = (VkSemaphore*)vkStream->allocArray(forUnmarshaling->signalSemaphoreCount, sizeof(VkSemaphore));
+        forUnmarshaling->pSignalSemaphores = pSignalSemaphores;
+        if (pSignalSemaphores)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->signalSemaphoreCount; ++i)
+            {
+                pSignalSemaphores[i] = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+            }
+        }
+    }
+}
+
+
+void marshal_VkMemoryAllocateInfo(
+    VulkanStream* vkStream,
+    const VkMemoryAllocateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->allocationSize, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->memoryTypeIndex, sizeof(uint32_t));
+}
+
+void unmarshal_VkMemoryAllocateInfo(
+    VulkanStream* vkStream,
+    VkMemoryAllocateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->allocationSize, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->memoryTypeIndex, sizeof(uint32_t));
+}
+
+
+void marshal_VkMappedMemoryRange(
+    VulkanStream* vkStream,
+    const VkMappedMemoryRange* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->memory));
+    vkStream->write(&forMarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->size, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkMappedMemoryRange(
+    VulkanStream* vkStream,
+    VkMappedMemoryRange* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->size, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkMemoryRequirements(
+    VulkanStream* vkStream,
+    const VkMemoryRequirements* forMarshaling)
+{
+    vkStream->write(&forMarshaling->size, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->alignment, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+void unmarshal_VkMemoryRequirements(
+    VulkanStream* vkStream,
+    VkMemoryRequirements* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->size, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->alignment, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+
+void marshal_VkSparseImageFormatProperties(
+    VulkanStream* vkStream,
+    const VkSparseImageFormatProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    marshal_VkExtent3D(vkStream, &forMarshaling->imageGranularity);
+    vkStream->write(&forMarshaling->flags, sizeof(VkSparseImageFormatFlags));
+}
+
+void unmarshal_VkSparseImageFormatProperties(
+    VulkanStream* vkStream,
+    VkSparseImageFormatProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    unmarshal_VkExtent3D(vkStream, &forUnmarshaling->imageGranularity);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkSparseImageFormatFlags));
+}
+
+
+void marshal_VkSparseImageMemoryRequirements(
+    VulkanStream* vkStream,
+    const VkSparseImageMemoryRequirements* forMarshaling)
+{
+    marshal_VkSparseImageFormatProperties(vkStream, &forMarshaling->formatProperties);
+    vkStream->write(&forMarshaling->imageMipTailFirstLod, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->imageMipTailSize, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->imageMipTailOffset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->imageMipTailStride, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkSparseImageMemoryRequirements(
+    VulkanStream* vkStream,
+    VkSparseImageMemoryRequirements* forUnmarshaling)
+{
+    unmarshal_VkSparseImageFormatProperties(vkStream, &forUnmarshaling->formatProperties);
+    vkStream->read(&forUnmarshaling->imageMipTailFirstLod, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->imageMipTailSize, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->imageMipTailOffset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->imageMipTailStride, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkSparseMemoryBind(
+    VulkanStream* vkStream,
+    const VkSparseMemoryBind* forMarshaling)
+{
+    vkStream->write(&forMarshaling->resourceOffset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->size, sizeof(VkDeviceSize));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->memory));
+    vkStream->write(&forMarshaling->memoryOffset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->flags, sizeof(VkSparseMemoryBindFlags));
+}
+
+void unmarshal_VkSparseMemoryBind(
+    VulkanStream* vkStream,
+    VkSparseMemoryBind* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->resourceOffset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->size, sizeof(VkDeviceSize));
+    forUnmarshaling->memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->memoryOffset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkSparseMemoryBindFlags));
+}
+
+
+void marshal_VkSparseBufferMemoryBindInfo(
+    VulkanStream* vkStream,
+    const VkSparseBufferMemoryBindInfo* forMarshaling)
+{
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+    vkStream->write(&forMarshaling->bindCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pBinds ? 1 : 0);
+    if (forMarshaling->pBinds)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->bindCount; ++i)
+        {
+            marshal_VkSparseMemoryBind(vkStream, forMarshaling->pBinds + i);
+        }
+    }
+}
+
+void unmarshal_VkSparseBufferMemoryBindInfo(
+    VulkanStream* vkStream,
+    VkSparseBufferMemoryBindInfo* forUnmarshaling)
+{
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->bindCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSparseMemoryBind* pBinds = (VkSparseMemoryBind*)vkStream->allocArray(forUnmarshaling->bindCount, sizeof(VkSparseMemoryBind));
+        forUnmarshaling->pBinds = pBinds;
+        if (pBinds)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->bindCount; ++i)
+            {
+                unmarshal_VkSparseMemoryBind(vkStream, pBinds + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkSparseImageOpaqueMemoryBindInfo(
+    VulkanStream* vkStream,
+    const VkSparseImageOpaqueMemoryBindInfo* forMarshaling)
+{
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(forMarshaling->image));
+    vkStream->write(&forMarshaling->bindCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pBinds ? 1 : 0);
+    if (forMarshaling->pBinds)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->bindCount; ++i)
+        {
+            marshal_VkSparseMemoryBind(vkStream, forMarshaling->pBinds + i);
+        }
+    }
+}
+
+void unmarshal_VkSparseImageOpaqueMemoryBindInfo(
+    VulkanStream* vkStream,
+    VkSparseImageOpaqueMemoryBindInfo* forUnmarshaling)
+{
+    forUnmarshaling->image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->bindCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSparseMemoryBind* pBinds = (VkSparseMemoryBind*)vkStream->allocArray(forUnmarshaling->bindCount, sizeof(VkSparseMemoryBind));
+        forUnmarshaling->pBinds = pBinds;
+        if (pBinds)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->bindCount; ++i)
+            {
+                unmarshal_VkSparseMemoryBind(vkStream, pBinds + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkImageSubresource(
+    VulkanStream* vkStream,
+    const VkImageSubresource* forMarshaling)
+{
+    vkStream->write(&forMarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    vkStream->write(&forMarshaling->mipLevel, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->arrayLayer, sizeof(uint32_t));
+}
+
+void unmarshal_VkImageSubresource(
+    VulkanStream* vkStream,
+    VkImageSubresource* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    vkStream->read(&forUnmarshaling->mipLevel, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->arrayLayer, sizeof(uint32_t));
+}
+
+
+void marshal_VkOffset3D(
+    VulkanStream* vkStream,
+    const VkOffset3D* forMarshaling)
+{
+    vkStream->write(&forMarshaling->x, sizeof(int32_t));
+    vkStream->write(&forMarshaling->y, sizeof(int32_t));
+    vkStream->write(&forMarshaling->z, sizeof(int32_t));
+}
+
+void unmarshal_VkOffset3D(
+    VulkanStream* vkStream,
+    VkOffset3D* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->x, sizeof(int32_t));
+    vkStream->read(&forUnmarshaling->y, sizeof(int32_t));
+    vkStream->read(&forUnmarshaling->z, sizeof(int32_t));
+}
+
+
+void marshal_VkSparseImageMemoryBind(
+    VulkanStream* vkStream,
+    const VkSparseImageMemoryBind* forMarshaling)
+{
+    marshal_VkImageSubresource(vkStream, &forMarshaling->subresource);
+    marshal_VkOffset3D(vkStream, &forMarshaling->offset);
+    marshal_VkExtent3D(vkStream, &forMarshaling->extent);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->memory));
+    vkStream->write(&forMarshaling->memoryOffset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->flags, sizeof(VkSparseMemoryBindFlags));
+}
+
+void unmarshal_VkSparseImageMemoryBind(
+    VulkanStream* vkStream,
+    VkSparseImageMemoryBind* forUnmarshaling)
+{
+    unmarshal_VkImageSubresource(vkStream, &forUnmarshaling->subresource);
+    unmarshal_VkOffset3D(vkStream, &forUnmarshaling->offset);
+    unmarshal_VkExtent3D(vkStream, &forUnmarshaling->extent);
+    forUnmarshaling->memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->memoryOffset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkSparseMemoryBindFlags));
+}
+
+
+void marshal_VkSparseImageMemoryBindInfo(
+    VulkanStream* vkStream,
+    const VkSparseImageMemoryBindInfo* forMarshaling)
+{
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(forMarshaling->image));
+    vkStream->write(&forMarshaling->bindCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pBinds ? 1 : 0);
+    if (forMarshaling->pBinds)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->bindCount; ++i)
+        {
+            marshal_VkSparseImageMemoryBind(vkStream, forMarshaling->pBinds + i);
+        }
+    }
+}
+
+void unmarshal_VkSparseImageMemoryBindInfo(
+    VulkanStream* vkStream,
+    VkSparseImageMemoryBindInfo* forUnmarshaling)
+{
+    forUnmarshaling->image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->bindCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSparseImageMemoryBind* pBinds = (VkSparseImageMemoryBind*)vkStream->allocArray(forUnmarshaling->bindCount, sizeof(VkSparseImageMemoryBind));
+        forUnmarshaling->pBinds = pBinds;
+        if (pBinds)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->bindCount; ++i)
+            {
+                unmarshal_VkSparseImageMemoryBind(vkStream, pBinds + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkBindSparseInfo(
+    VulkanStream* vkStream,
+    const VkBindSparseInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->waitSemaphoreCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pWaitSemaphores ? 1 : 0);
+    if (forMarshaling->pWaitSemaphores)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->waitSemaphoreCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(forMarshaling->pWaitSemaphores[i]));
+        }
+    }
+    vkStream->write(&forMarshaling->bufferBindCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pBufferBinds ? 1 : 0);
+    if (forMarshaling->pBufferBinds)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->bufferBindCount; ++i)
+        {
+            marshal_VkSparseBufferMemoryBindInfo(vkStream, forMarshaling->pBufferBinds + i);
+        }
+    }
+    vkStream->write(&forMarshaling->imageOpaqueBindCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pImageOpaqueBinds ? 1 : 0);
+    if (forMarshaling->pImageOpaqueBinds)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->imageOpaqueBindCount; ++i)
+        {
+            marshal_VkSparseImageOpaqueMemoryBindInfo(vkStream, forMarshaling->pImageOpaqueBinds + i);
+        }
+    }
+    vkStream->write(&forMarshaling->imageBindCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pImageBinds ? 1 : 0);
+    if (forMarshaling->pImageBinds)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->imageBindCount; ++i)
+        {
+            marshal_VkSparseImageMemoryBindInfo(vkStream, forMarshaling->pImageBinds + i);
+        }
+    }
+    vkStream->write(&forMarshaling->signalSemaphoreCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSignalSemaphores ? 1 : 0);
+    if (forMarshaling->pSignalSemaphores)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->signalSemaphoreCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(forMarshaling->pSignalSemaphores[i]));
+        }
+    }
+}
+
+void unmarshal_VkBindSparseInfo(
+    VulkanStream* vkStream,
+    VkBindSparseInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->waitSemaphoreCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSemaphore* pWaitSemaphores = (VkSemaphore*)vkStream->allocArray(forUnmarshaling->waitSemaphoreCount, sizeof(VkSemaphore));
+        forUnmarshaling->pWaitSemaphores = pWaitSemaphores;
+        if (pWaitSemaphores)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->waitSemaphoreCount; ++i)
+            {
+                pWaitSemaphores[i] = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->bufferBindCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSparseBufferMemoryBindInfo* pBufferBinds = (VkSparseBufferMemoryBindInfo*)vkStream->allocArray(forUnmarshaling->bufferBindCount, sizeof(VkSparseBufferMemoryBindInfo));
+        forUnmarshaling->pBufferBinds = pBufferBinds;
+        if (pBufferBinds)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->bufferBindCount; ++i)
+            {
+                unmarshal_VkSparseBufferMemoryBindInfo(vkStream, pBufferBinds + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->imageOpaqueBindCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSparseImageOpaqueMemoryBindInfo* pImageOpaqueBinds = (VkSparseImageOpaqueMemoryBindInfo*)vkStream->allocArray(forUnmarshaling->imageOpaqueBindCount, sizeof(VkSparseImageOpaqueMemoryBindInfo));
+        forUnmarshaling->pImageOpaqueBinds = pImageOpaqueBinds;
+        if (pImageOpaqueBinds)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->imageOpaqueBindCount; ++i)
+            {
+                unmarshal_VkSparseImageOpaqueMemoryBindInfo(vkStream, pImageOpaqueBinds + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->imageBindCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSparseImageMemoryBindInfo* pImageBinds = (VkSparseImageMemoryBindInfo*)vkStream->allocArray(forUnmarshaling->imageBindCount, sizeof(VkSparseImageMemoryBindInfo));
+        forUnmarshaling->pImageBinds = pImageBinds;
+        if (pImageBinds)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->imageBindCount; ++i)
+            {
+                unmarshal_VkSparseImageMemoryBindInfo(vkStream, pImageBinds + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->signalSemaphoreCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSemaphore* pSignalSemaphores = (VkSemaphore*)vkStream->allocArray(forUnmarshaling->signalSemaphoreCount, sizeof(VkSemaphore));
+        forUnmarshaling->pSignalSemaphores = pSignalSemaphores;
+        if (pSignalSemaphores)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->signalSemaphoreCount; ++i)
+            {
+                pSignalSemaphores[i] = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+            }
+        }
+    }
+}
+
+
+void marshal_VkFenceCreateInfo(
+    VulkanStream* vkStream,
+    const VkFenceCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkFenceCreateFlags));
+}
+
+void unmarshal_VkFenceCreateInfo(
+    VulkanStream* vkStream,
+    VkFenceCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkFenceCreateFlags));
+}
+
+
+void marshal_VkSemaphoreCreateInfo(
+    VulkanStream* vkStream,
+    const VkSemaphoreCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkSemaphoreCreateFlags));
+}
+
+void unmarshal_VkSemaphoreCreateInfo(
+    VulkanStream* vkStream,
+    VkSemaphoreCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkSemaphoreCreateFlags));
+}
+
+
+void marshal_VkEventCreateInfo(
+    VulkanStream* vkStream,
+    const VkEventCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkEventCreateFlags));
+}
+
+void unmarshal_VkEventCreateInfo(
+    VulkanStream* vkStream,
+    VkEventCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkEventCreateFlags));
+}
+
+
+void marshal_VkQueryPoolCreateInfo(
+    VulkanStream* vkStream,
+    const VkQueryPoolCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkQueryPoolCreateFlags));
+    vkStream->write(&forMarshaling->queryType, sizeof(VkQueryType));
+    vkStream->write(&forMarshaling->queryCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->pipelineStatistics, sizeof(VkQueryPipelineStatisticFlags));
+}
+
+void unmarshal_VkQueryPoolCreateInfo(
+    VulkanStream* vkStream,
+    VkQueryPoolCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkQueryPoolCreateFlags));
+    vkStream->read(&forUnmarshaling->queryType, sizeof(VkQueryType));
+    vkStream->read(&forUnmarshaling->queryCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->pipelineStatistics, sizeof(VkQueryPipelineStatisticFlags));
+}
+
+
+void marshal_VkBufferCreateInfo(
+    VulkanStream* vkStream,
+    const VkBufferCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkBufferCreateFlags));
+    vkStream->write(&forMarshaling->size, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->usage, sizeof(VkBufferUsageFlags));
+    vkStream->write(&forMarshaling->sharingMode, sizeof(VkSharingMode));
+    vkStream->write(&forMarshaling->queueFamilyIndexCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pQueueFamilyIndices ? 1 : 0);
+    if (forMarshaling->pQueueFamilyIndices)
+    {
+        vkStream->write(forMarshaling->pQueueFamilyIndices, forMarshaling->queueFamilyIndexCount * sizeof(uint32_t));
+    }
+}
+
+void unmarshal_VkBufferCreateInfo(
+    VulkanStream* vkStream,
+    VkBufferCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkBufferCreateFlags));
+    vkStream->read(&forUnmarshaling->size, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->usage, sizeof(VkBufferUsageFlags));
+    vkStream->read(&forUnmarshaling->sharingMode, sizeof(VkSharingMode));
+    vkStream->read(&forUnmarshaling->queueFamilyIndexCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pQueueFamilyIndices = (uint32_t*)vkStream->allocArray(forUnmarshaling->queueFamilyIndexCount, sizeof(uint32_t));
+        forUnmarshaling->pQueueFamilyIndices = pQueueFamilyIndices;
+        if (pQueueFamilyIndices)
+        {
+            vkStream->read(pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(uint32_t));
+        }
+    }
+}
+
+
+void marshal_VkBufferViewCreateInfo(
+    VulkanStream* vkStream,
+    const VkBufferViewCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkBufferViewCreateFlags));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->range, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkBufferViewCreateInfo(
+    VulkanStream* vkStream,
+    VkBufferViewCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkBufferViewCreateFlags));
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->range, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkImageCreateInfo(
+    VulkanStream* vkStream,
+    const VkImageCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkImageCreateFlags));
+    vkStream->write(&forMarshaling->imageType, sizeof(VkImageType));
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    marshal_VkExtent3D(vkStream, &forMarshaling->extent);
+    vkStream->write(&forMarshaling->mipLevels, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->arrayLayers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->samples, sizeof(VkSampleCountFlagBits));
+    vkStream->write(&forMarshaling->tiling, sizeof(VkImageTiling));
+    vkStream->write(&forMarshaling->usage, sizeof(VkImageUsageFlags));
+    vkStream->write(&forMarshaling->sharingMode, sizeof(VkSharingMode));
+    vkStream->write(&forMarshaling->queueFamilyIndexCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pQueueFamilyIndices ? 1 : 0);
+    if (forMarshaling->pQueueFamilyIndices)
+    {
+        vkStream->write(forMarshaling->pQueueFamilyIndices, forMarshaling->queueFamilyIndexCount * sizeof(uint32_t));
+    }
+    vkStream->write(&forMarshaling->initialLayout, sizeof(VkImageLayout));
+}
+
+void unmarshal_VkImageCreateInfo(
+    VulkanStream* vkStream,
+    VkImageCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkImageCreateFlags));
+    vkStream->read(&forUnmarshaling->imageType, sizeof(VkImageType));
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    unmarshal_VkExtent3D(vkStream, &forUnmarshaling->extent);
+    vkStream->read(&forUnmarshaling->mipLevels, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->arrayLayers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->samples, sizeof(VkSampleCountFlagBits));
+    vkStream->read(&forUnmarshaling->tiling, sizeof(VkImageTiling));
+    vkStream->read(&forUnmarshaling->usage, sizeof(VkImageUsageFlags));
+    vkStream->read(&forUnmarshaling->sharingMode, sizeof(VkSharingMode));
+    vkStream->read(&forUnmarshaling->queueFamilyIndexCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pQueueFamilyIndices = (uint32_t*)vkStream->allocArray(forUnmarshaling->queueFamilyIndexCount, sizeof(uint32_t));
+        forUnmarshaling->pQueueFamilyIndices = pQueueFamilyIndices;
+        if (pQueueFamilyIndices)
+        {
+            vkStream->read(pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(uint32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->initialLayout, sizeof(VkImageLayout));
+}
+
+
+void marshal_VkSubresourceLayout(
+    VulkanStream* vkStream,
+    const VkSubresourceLayout* forMarshaling)
+{
+    vkStream->write(&forMarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->size, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->rowPitch, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->arrayPitch, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->depthPitch, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkSubresourceLayout(
+    VulkanStream* vkStream,
+    VkSubresourceLayout* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->size, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->rowPitch, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->arrayPitch, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->depthPitch, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkComponentMapping(
+    VulkanStream* vkStream,
+    const VkComponentMapping* forMarshaling)
+{
+    vkStream->write(&forMarshaling->r, sizeof(VkComponentSwizzle));
+    vkStream->write(&forMarshaling->g, sizeof(VkComponentSwizzle));
+    vkStream->write(&forMarshaling->b, sizeof(VkComponentSwizzle));
+    vkStream->write(&forMarshaling->a, sizeof(VkComponentSwizzle));
+}
+
+void unmarshal_VkComponentMapping(
+    VulkanStream* vkStream,
+    VkComponentMapping* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->r, sizeof(VkComponentSwizzle));
+    vkStream->read(&forUnmarshaling->g, sizeof(VkComponentSwizzle));
+    vkStream->read(&forUnmarshaling->b, sizeof(VkComponentSwizzle));
+    vkStream->read(&forUnmarshaling->a, sizeof(VkComponentSwizzle));
+}
+
+
+void marshal_VkImageSubresourceRange(
+    VulkanStream* vkStream,
+    const VkImageSubresourceRange* forMarshaling)
+{
+    vkStream->write(&forMarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    vkStream->write(&forMarshaling->baseMipLevel, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->levelCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->baseArrayLayer, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->layerCount, sizeof(uint32_t));
+}
+
+void unmarshal_VkImageSubresourceRange(
+    VulkanStream* vkStream,
+    VkImageSubresourceRange* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    vkStream->read(&forUnmarshaling->baseMipLevel, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->levelCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->baseArrayLayer, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->layerCount, sizeof(uint32_t));
+}
+
+
+void marshal_VkImageViewCreateInfo(
+    VulkanStream* vkStream,
+    const VkImageViewCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkImageViewCreateFlags));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(forMarshaling->image));
+    vkStream->write(&forMarshaling->viewType, sizeof(VkImageViewType));
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    marshal_VkComponentMapping(vkStream, &forMarshaling->components);
+    marshal_VkImageSubresourceRange(vkStream, &forMarshaling->subresourceRange);
+}
+
+void unmarshal_VkImageViewCreateInfo(
+    VulkanStream* vkStream,
+    VkImageViewCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkImageViewCreateFlags));
+    forUnmarshaling->image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->viewType, sizeof(VkImageViewType));
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    unmarshal_VkComponentMapping(vkStream, &forUnmarshaling->components);
+    unmarshal_VkImageSubresourceRange(vkStream, &forUnmarshaling->subresourceRange);
+}
+
+
+void marshal_VkShaderModuleCreateInfo(
+    VulkanStream* vkStream,
+    const VkShaderModuleCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkShaderModuleCreateFlags));
+    vkStream->putU64((uint64_t)forMarshaling->codeSize);
+    vkStream->putU32(forMarshaling->pCode ? 1 : 0);
+    if (forMarshaling->pCode)
+    {
+        vkStream->write(forMarshaling->pCode, (forMarshaling->codeSize / 4) * sizeof(uint32_t));
+    }
+}
+
+void unmarshal_VkShaderModuleCreateInfo(
+    VulkanStream* vkStream,
+    VkShaderModuleCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkShaderModuleCreateFlags));
+    forUnmarshaling->codeSize = (size_t)vkStream->getU64();
+    if (vkStream->getU32())
+    {
+        uint32_t* pCode = (uint32_t*)vkStream->allocArray((forUnmarshaling->codeSize / 4), sizeof(uint32_t));
+        forUnmarshaling->pCode = pCode;
+        if (pCode)
+        {
+            vkStream->read(pCode, (forUnmarshaling->codeSize / 4) * sizeof(uint32_t));
+        }
+    }
+}
+
+
+void marshal_VkPipelineCacheCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineCacheCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineCacheCreateFlags));
+    vkStream->putU64((uint64_t)forMarshaling->initialDataSize);
+    vkStream->putU32(forMarshaling->pInitialData ? 1 : 0);
+    if (forMarshaling->pInitialData)
+    {
+        vkStream->write(forMarshaling->pInitialData, forMarshaling->initialDataSize * sizeof(uint8_t));
+    }
+}
+
+void unmarshal_VkPipelineCacheCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineCacheCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineCacheCreateFlags));
+    forUnmarshaling->initialDataSize = (size_t)vkStream->getU64();
+    if (vkStream->getU32())
+    {
+        uint8_t* pInitialData = (uint8_t*)vkStream->allocArray(forUnmarshaling->initialDataSize, sizeof(uint8_t));
+        forUnmarshaling->pInitialData = pInitialData;
+        if (pInitialData)
+        {
+            vkStream->read(pInitialData, forUnmarshaling->initialDataSize * sizeof(uint8_t));
+        }
+    }
+}
+
+
+void marshal_VkSpecializationMapEntry(
+    VulkanStream* vkStream,
+    const VkSpecializationMapEntry* forMarshaling)
+{
+    vkStream->write(&forMarshaling->constantID, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->offset, sizeof(uint32_t));
+    vkStream->putU64((uint64_t)forMarshaling->size);
+}
+
+void unmarshal_VkSpecializationMapEntry(
+    VulkanStream* vkStream,
+    VkSpecializationMapEntry* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->constantID, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->offset, sizeof(uint32_t));
+    forUnmarshaling->size = (size_t)vkStream->getU64();
+}
+
+
+void marshal_VkSpecializationInfo(
+    VulkanStream* vkStream,
+    const VkSpecializationInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->mapEntryCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pMapEntries ? 1 : 0);
+    if (forMarshaling->pMapEntries)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->mapEntryCount; ++i)
+        {
+            marshal_VkSpecializationMapEntry(vkStream, forMarshaling->pMapEntries + i);
+        }
+    }
+    vkStream->putU64((uint64_t)forMarshaling->dataSize);
+    vkStream->putU32(forMarshaling->pData ? 1 : 0);
+    if (forMarshaling->pData)
+    {
+        vkStream->write(forMarshaling->pData, forMarshaling->dataSize * sizeof(uint8_t));
+    }
+}
+
+void unmarshal_VkSpecializationInfo(
+    VulkanStream* vkStream,
+    VkSpecializationInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->mapEntryCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSpecializationMapEntry* pMapEntries = (VkSpecializationMapEntry*)vkStream->allocArray(forUnmarshaling->mapEntryCount, sizeof(VkSpecializationMapEntry));
+        forUnmarshaling->pMapEntries = pMapEntries;
+        if (pMapEntries)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->mapEntryCount; ++i)
+            {
+                unmarshal_VkSpecializationMapEntry(vkStream, pMapEntries + i);
+            }
+        }
+    }
+    forUnmarshaling->dataSize = (size_t)vkStream->getU64();
+    if (vkStream->getU32())
+    {
+        uint8_t* pData = (uint8_t*)vkStream->allocArray(forUnmarshaling->dataSize, sizeof(uint8_t));
+        forUnmarshaling->pData = pData;
+        if (pData)
+        {
+            vkStream->read(pData, forUnmarshaling->dataSize * sizeof(uint8_t));
+        }
+    }
+}
+
+
+void marshal_VkPipelineShaderStageCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineShaderStageCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineShaderStageCreateFlags));
+    vkStream->write(&forMarshaling->stage, sizeof(VkShaderStageFlagBits));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkShaderModule(forMarshaling->module));
+    vkStream->putString(forMarshaling->pName);
+    vkStream->putU32(forMarshaling->pSpecializationInfo ? 1 : 0);
+    if (forMarshaling->pSpecializationInfo)
+    {
+        marshal_VkSpecializationInfo(vkStream, forMarshaling->pSpecializationInfo);
+    }
+}
+
+void unmarshal_VkPipelineShaderStageCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineShaderStageCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineShaderStageCreateFlags));
+    vkStream->read(&forUnmarshaling->stage, sizeof(VkShaderStageFlagBits));
+    forUnmarshaling->module = vkStream->handleMapping()->fromWire_VkShaderModule(vkStream, vkStream->getU64());
+    forUnmarshaling->pName = vkStream->getString();
+    if (vkStream->getU32())
+    {
+        VkSpecializationInfo* pSpecializationInfo = (VkSpecializationInfo*)vkStream->allocArray(1, sizeof(VkSpecializationInfo));
+        forUnmarshaling->pSpecializationInfo = pSpecializationInfo;
+        if (pSpecializationInfo)
+        {
+            unmarshal_VkSpecializationInfo(vkStream, pSpecializationInfo);
+        }
+    }
+}
+
+
+void marshal_VkVertexInputBindingDescription(
+    VulkanStream* vkStream,
+    const VkVertexInputBindingDescription* forMarshaling)
+{
+    vkStream->write(&forMarshaling->binding, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->stride, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->inputRate, sizeof(VkVertexInputRate));
+}
+
+void unmarshal_VkVertexInputBindingDescription(
+    VulkanStream* vkStream,
+    VkVertexInputBindingDescription* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->binding, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->stride, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->inputRate, sizeof(VkVertexInputRate));
+}
+
+
+void marshal_VkVertexInputAttributeDescription(
+    VulkanStream* vkStream,
+    const VkVertexInputAttributeDescription* forMarshaling)
+{
+    vkStream->write(&forMarshaling->location, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->binding, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->offset, sizeof(uint32_t));
+}
+
+void unmarshal_VkVertexInputAttributeDescription(
+    VulkanStream* vkStream,
+    VkVertexInputAttributeDescription* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->location, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->binding, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->offset, sizeof(uint32_t));
+}
+
+
+void marshal_VkPipelineVertexInputStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineVertexInputStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineVertexInputStateCreateFlags));
+    vkStream->write(&forMarshaling->vertexBindingDescriptionCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pVertexBindingDescriptions ? 1 : 0);
+    if (forMarshaling->pVertexBindingDescriptions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->vertexBindingDescriptionCount; ++i)
+        {
+            marshal_VkVertexInputBindingDescription(vkStream, forMarshaling->pVertexBindingDescriptions + i);
+        }
+    }
+    vkStream->write(&forMarshaling->vertexAttributeDescriptionCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pVertexAttributeDescriptions ? 1 : 0);
+    if (forMarshaling->pVertexAttributeDescriptions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->vertexAttributeDescriptionCount; ++i)
+        {
+            marshal_VkVertexInputAttributeDescription(vkStream, forMarshaling->pVertexAttributeDescriptions + i);
+        }
+    }
+}
+
+void unmarshal_VkPipelineVertexInputStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineVertexInputStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineVertexInputStateCreateFlags));
+    vkStream->read(&forUnmarshaling->vertexBindingDescriptionCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkVertexInputBindingDescription* pVertexBindingDescriptions = (VkVertexInputBindingDescription*)vkStream->allocArray(forUnmarshaling->vertexBindingDescriptionCount, sizeof(VkVertexInputBindingDescription));
+        forUnmarshaling->pVertexBindingDescriptions = pVertexBindingDescriptions;
+        if (pVertexBindingDescriptions)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->vertexBindingDescriptionCount; ++i)
+            {
+                unmarshal_VkVertexInputBindingDescription(vkStream, pVertexBindingDescriptions + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->vertexAttributeDescriptionCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkVertexInputAttributeDescription* pVertexAttributeDescriptions = (VkVertexInputAttributeDescription*)vkStream->allocArray(forUnmarshaling->vertexAttributeDescriptionCount, sizeof(VkVertexInputAttributeDescription));
+        forUnmarshaling->pVertexAttributeDescriptions = pVertexAttributeDescriptions;
+        if (pVertexAttributeDescriptions)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->vertexAttributeDescriptionCount; ++i)
+            {
+                unmarshal_VkVertexInputAttributeDescription(vkStream, pVertexAttributeDescriptions + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkPipelineInputAssemblyStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineInputAssemblyStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineInputAssemblyStateCreateFlags));
+    vkStream->write(&forMarshaling->topology, sizeof(VkPrimitiveTopology));
+    vkStream->write(&forMarshaling->primitiveRestartEnable, sizeof(VkBool32));
+}
+
+void unmarshal_VkPipelineInputAssemblyStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineInputAssemblyStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineInputAssemblyStateCreateFlags));
+    vkStream->read(&forUnmarshaling->topology, sizeof(VkPrimitiveTopology));
+    vkStream->read(&forUnmarshaling->primitiveRestartEnable, sizeof(VkBool32));
+}
+
+
+void marshal_VkPipelineTessellationStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineTessellationStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineTessellationStateCreateFlags));
+    vkStream->write(&forMarshaling->patchControlPoints, sizeof(uint32_t));
+}
+
+void unmarshal_VkPipelineTessellationStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineTessellationStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineTessellationStateCreateFlags));
+    vkStream->read(&forUnmarshaling->patchControlPoints, sizeof(uint32_t));
+}
+
+
+void marshal_VkViewport(
+    VulkanStream* vkStream,
+    const VkViewport* forMarshaling)
+{
+    vkStream->write(&forMarshaling->x, sizeof(float));
+    vkStream->write(&forMarshaling->y, sizeof(float));
+    vkStream->write(&forMarshaling->width, sizeof(float));
+    vkStream->write(&forMarshaling->height, sizeof(float));
+    vkStream->write(&forMarshaling->minDepth, sizeof(float));
+    vkStream->write(&forMarshaling->maxDepth, sizeof(float));
+}
+
+void unmarshal_VkViewport(
+    VulkanStream* vkStream,
+    VkViewport* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->x, sizeof(float));
+    vkStream->read(&forUnmarshaling->y, sizeof(float));
+    vkStream->read(&forUnmarshaling->width, sizeof(float));
+    vkStream->read(&forUnmarshaling->height, sizeof(float));
+    vkStream->read(&forUnmarshaling->minDepth, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxDepth, sizeof(float));
+}
+
+
+void marshal_VkOffset2D(
+    VulkanStream* vkStream,
+    const VkOffset2D* forMarshaling)
+{
+    vkStream->write(&forMarshaling->x, sizeof(int32_t));
+    vkStream->write(&forMarshaling->y, sizeof(int32_t));
+}
+
+void unmarshal_VkOffset2D(
+    VulkanStream* vkStream,
+    VkOffset2D* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->x, sizeof(int32_t));
+    vkStream->read(&forUnmarshaling->y, sizeof(int32_t));
+}
+
+
+void marshal_VkExtent2D(
+    VulkanStream* vkStream,
+    const VkExtent2D* forMarshaling)
+{
+    vkStream->write(&forMarshaling->width, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->height, sizeof(uint32_t));
+}
+
+void unmarshal_VkExtent2D(
+    VulkanStream* vkStream,
+    VkExtent2D* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->width, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->height, sizeof(uint32_t));
+}
+
+
+void marshal_VkRect2D(
+    VulkanStream* vkStream,
+    const VkRect2D* forMarshaling)
+{
+    marshal_VkOffset2D(vkStream, &forMarshaling->offset);
+    marshal_VkExtent2D(vkStream, &forMarshaling->extent);
+}
+
+void unmarshal_VkRect2D(
+    VulkanStream* vkStream,
+    VkRect2D* forUnmarshaling)
+{
+    unmarshal_VkOffset2D(vkStream, &forUnmarshaling->offset);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->extent);
+}
+
+
+void marshal_VkPipelineViewportStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineViewportStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineViewportStateCreateFlags));
+    vkStream->write(&forMarshaling->viewportCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pViewports ? 1 : 0);
+    if (forMarshaling->pViewports)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->viewportCount; ++i)
+        {
+            marshal_VkViewport(vkStream, forMarshaling->pViewports + i);
+        }
+    }
+    vkStream->write(&forMarshaling->scissorCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pScissors ? 1 : 0);
+    if (forMarshaling->pScissors)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->scissorCount; ++i)
+        {
+            marshal_VkRect2D(vkStream, forMarshaling->pScissors + i);
+        }
+    }
+}
+
+void unmarshal_VkPipelineViewportStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineViewportStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineViewportStateCreateFlags));
+    vkStream->read(&forUnmarshaling->viewportCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkViewport* pViewports = (VkViewport*)vkStream->allocArray(forUnmarshaling->viewportCount, sizeof(VkViewport));
+        forUnmarshaling->pViewports = pViewports;
+        if (pViewports)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->viewportCount; ++i)
+            {
+                unmarshal_VkViewport(vkStream, pViewports + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->scissorCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkRect2D* pScissors = (VkRect2D*)vkStream->allocArray(forUnmarshaling->scissorCount, sizeof(VkRect2D));
+        forUnmarshaling->pScissors = pScissors;
+        if (pScissors)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->scissorCount; ++i)
+            {
+                unmarshal_VkRect2D(vkStream, pScissors + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkPipelineRasterizationStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineRasterizationStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineRasterizationStateCreateFlags));
+    vkStream->write(&forMarshaling->depthClampEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->rasterizerDiscardEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->polygonMode, sizeof(VkPolygonMode));
+    vkStream->write(&forMarshaling->cullMode, sizeof(VkCullModeFlags));
+    vkStream->write(&forMarshaling->frontFace, sizeof(VkFrontFace));
+    vkStream->write(&forMarshaling->depthBiasEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->depthBiasConstantFactor, sizeof(float));
+    vkStream->write(&forMarshaling->depthBiasClamp, sizeof(float));
+    vkStream->write(&forMarshaling->depthBiasSlopeFactor, sizeof(float));
+    vkStream->write(&forMarshaling->lineWidth, sizeof(float));
+}
+
+void unmarshal_VkPipelineRasterizationStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineRasterizationStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineRasterizationStateCreateFlags));
+    vkStream->read(&forUnmarshaling->depthClampEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->rasterizerDiscardEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->polygonMode, sizeof(VkPolygonMode));
+    vkStream->read(&forUnmarshaling->cullMode, sizeof(VkCullModeFlags));
+    vkStream->read(&forUnmarshaling->frontFace, sizeof(VkFrontFace));
+    vkStream->read(&forUnmarshaling->depthBiasEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->depthBiasConstantFactor, sizeof(float));
+    vkStream->read(&forUnmarshaling->depthBiasClamp, sizeof(float));
+    vkStream->read(&forUnmarshaling->depthBiasSlopeFactor, sizeof(float));
+    vkStream->read(&forUnmarshaling->lineWidth, sizeof(float));
+}
+
+
+void marshal_VkPipelineMultisampleStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineMultisampleStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineMultisampleStateCreateFlags));
+    vkStream->write(&forMarshaling->rasterizationSamples, sizeof(VkSampleCountFlagBits));
+    vkStream->write(&forMarshaling->sampleShadingEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->minSampleShading, sizeof(float));
+    vkStream->putU32(forMarshaling->pSampleMask ? 1 : 0);
+    if (forMarshaling->pSampleMask)
+    {
+        vkStream->write(forMarshaling->pSampleMask, ((forMarshaling->rasterizationSamples + 31) / 32) * sizeof(VkSampleMask));
+    }
+    vkStream->write(&forMarshaling->alphaToCoverageEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->alphaToOneEnable, sizeof(VkBool32));
+}
+
+void unmarshal_VkPipelineMultisampleStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineMultisampleStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineMultisampleStateCreateFlags));
+    vkStream->read(&forUnmarshaling->rasterizationSamples, sizeof(VkSampleCountFlagBits));
+    vkStream->read(&forUnmarshaling->sampleShadingEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->minSampleShading, sizeof(float));
+    if (vkStream->getU32())
+    {
+        VkSampleMask* pSampleMask = (VkSampleMask*)vkStream->allocArray(((forUnmarshaling->rasterizationSamples + 31) / 32), sizeof(VkSampleMask));
+        forUnmarshaling->pSampleMask = pSampleMask;
+        if (pSampleMask)
+        {
+            vkStream->read(pSampleMask, ((forUnmarshaling->rasterizationSamples + 31) / 32) * sizeof(VkSampleMask));
+        }
+    }
+    vkStream->read(&forUnmarshaling->alphaToCoverageEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->alphaToOneEnable, sizeof(VkBool32));
+}
+
+
+void marshal_VkStencilOpState(
+    VulkanStream* vkStream,
+    const VkStencilOpState* forMarshaling)
+{
+    vkStream->write(&forMarshaling->failOp, sizeof(VkStencilOp));
+    vkStream->write(&forMarshaling->passOp, sizeof(VkStencilOp));
+    vkStream->write(&forMarshaling->depthFailOp, sizeof(VkStencilOp));
+    vkStream->write(&forMarshaling->compareOp, sizeof(VkCompareOp));
+    vkStream->write(&forMarshaling->compareMask, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->writeMask, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->reference, sizeof(uint32_t));
+}
+
+void unmarshal_VkStencilOpState(
+    VulkanStream* vkStream,
+    VkStencilOpState* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->failOp, sizeof(VkStencilOp));
+    vkStream->read(&forUnmarshaling->passOp, sizeof(VkStencilOp));
+    vkStream->read(&forUnmarshaling->depthFailOp, sizeof(VkStencilOp));
+    vkStream->read(&forUnmarshaling->compareOp, sizeof(VkCompareOp));
+    vkStream->read(&forUnmarshaling->compareMask, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->writeMask, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->reference, sizeof(uint32_t));
+}
+
+
+void marshal_VkPipelineDepthStencilStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineDepthStencilStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineDepthStencilStateCreateFlags));
+    vkStream->write(&forMarshaling->depthTestEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->depthWriteEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->depthCompareOp, sizeof(VkCompareOp));
+    vkStream->write(&forMarshaling->depthBoundsTestEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->stencilTestEnable, sizeof(VkBool32));
+    marshal_VkStencilOpState(vkStream, &forMarshaling->front);
+    marshal_VkStencilOpState(vkStream, &forMarshaling->back);
+    vkStream->write(&forMarshaling->minDepthBounds, sizeof(float));
+    vkStream->write(&forMarshaling->maxDepthBounds, sizeof(float));
+}
+
+void unmarshal_VkPipelineDepthStencilStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineDepthStencilStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineDepthStencilStateCreateFlags));
+    vkStream->read(&forUnmarshaling->depthTestEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->depthWriteEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->depthCompareOp, sizeof(VkCompareOp));
+    vkStream->read(&forUnmarshaling->depthBoundsTestEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->stencilTestEnable, sizeof(VkBool32));
+    unmarshal_VkStencilOpState(vkStream, &forUnmarshaling->front);
+    unmarshal_VkStencilOpState(vkStream, &forUnmarshaling->back);
+    vkStream->read(&forUnmarshaling->minDepthBounds, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxDepthBounds, sizeof(float));
+}
+
+
+void marshal_VkPipelineColorBlendAttachmentState(
+    VulkanStream* vkStream,
+    const VkPipelineColorBlendAttachmentState* forMarshaling)
+{
+    vkStream->write(&forMarshaling->blendEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->srcColorBlendFactor, sizeof(VkBlendFactor));
+    vkStream->write(&forMarshaling->dstColorBlendFactor, sizeof(VkBlendFactor));
+    vkStream->write(&forMarshaling->colorBlendOp, sizeof(VkBlendOp));
+    vkStream->write(&forMarshaling->srcAlphaBlendFactor, sizeof(VkBlendFactor));
+    vkStream->write(&forMarshaling->dstAlphaBlendFactor, sizeof(VkBlendFactor));
+    vkStream->write(&forMarshaling->alphaBlendOp, sizeof(VkBlendOp));
+    vkStream->write(&forMarshaling->colorWriteMask, sizeof(VkColorComponentFlags));
+}
+
+void unmarshal_VkPipelineColorBlendAttachmentState(
+    VulkanStream* vkStream,
+    VkPipelineColorBlendAttachmentState* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->blendEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->srcColorBlendFactor, sizeof(VkBlendFactor));
+    vkStream->read(&forUnmarshaling->dstColorBlendFactor, sizeof(VkBlendFactor));
+    vkStream->read(&forUnmarshaling->colorBlendOp, sizeof(VkBlendOp));
+    vkStream->read(&forUnmarshaling->srcAlphaBlendFactor, sizeof(VkBlendFactor));
+    vkStream->read(&forUnmarshaling->dstAlphaBlendFactor, sizeof(VkBlendFactor));
+    vkStream->read(&forUnmarshaling->alphaBlendOp, sizeof(VkBlendOp));
+    vkStream->read(&forUnmarshaling->colorWriteMask, sizeof(VkColorComponentFlags));
+}
+
+
+void marshal_VkPipelineColorBlendStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineColorBlendStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineColorBlendStateCreateFlags));
+    vkStream->write(&forMarshaling->logicOpEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->logicOp, sizeof(VkLogicOp));
+    vkStream->write(&forMarshaling->attachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pAttachments ? 1 : 0);
+    if (forMarshaling->pAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->attachmentCount; ++i)
+        {
+            marshal_VkPipelineColorBlendAttachmentState(vkStream, forMarshaling->pAttachments + i);
+        }
+    }
+    vkStream->write(forMarshaling->blendConstants, 4 * sizeof(float));
+}
+
+void unmarshal_VkPipelineColorBlendStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineColorBlendStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineColorBlendStateCreateFlags));
+    vkStream->read(&forUnmarshaling->logicOpEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->logicOp, sizeof(VkLogicOp));
+    vkStream->read(&forUnmarshaling->attachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkPipelineColorBlendAttachmentState* pAttachments = (VkPipelineColorBlendAttachmentState*)vkStream->allocArray(forUnmarshaling->attachmentCount, sizeof(VkPipelineColorBlendAttachmentState));
+        forUnmarshaling->pAttachments = pAttachments;
+        if (pAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->attachmentCount; ++i)
+            {
+                unmarshal_VkPipelineColorBlendAttachmentState(vkStream, pAttachments + i);
+            }
+        }
+    }
+    vkStream->read(forUnmarshaling->blendConstants, 4 * sizeof(float));
+}
+
+
+void marshal_VkPipelineDynamicStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineDynamicStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineDynamicStateCreateFlags));
+    vkStream->write(&forMarshaling->dynamicStateCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDynamicStates ? 1 : 0);
+    if (forMarshaling->pDynamicStates)
+    {
+        vkStream->write(forMarshaling->pDynamicStates, forMarshaling->dynamicStateCount * sizeof(VkDynamicState));
+    }
+}
+
+void unmarshal_VkPipelineDynamicStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineDynamicStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineDynamicStateCreateFlags));
+    vkStream->read(&forUnmarshaling->dynamicStateCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDynamicState* pDynamicStates = (VkDynamicState*)vkStream->allocArray(forUnmarshaling->dynamicStateCount, sizeof(VkDynamicState));
+        forUnmarshaling->pDynamicStates = pDynamicStates;
+        if (pDynamicStates)
+        {
+            vkStream->read(pDynamicStates, forUnmarshaling->dynamicStateCount * sizeof(VkDynamicState));
+        }
+    }
+}
+
+
+void marshal_VkGraphicsPipelineCreateInfo(
+    VulkanStream* vkStream,
+    const VkGraphicsPipelineCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineCreateFlags));
+    vkStream->write(&forMarshaling->stageCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pStages ? 1 : 0);
+    if (forMarshaling->pStages)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->stageCount; ++i)
+        {
+            marshal_VkPipelineShaderStageCreateInfo(vkStream, forMarshaling->pStages + i);
+        }
+    }
+    vkStream->putU32(forMarshaling->pVertexInputState ? 1 : 0);
+    if (forMarshaling->pVertexInputState)
+    {
+        marshal_VkPipelineVertexInputStateCreateInfo(vkStream, forMarshaling->pVertexInputState);
+    }
+    vkStream->putU32(forMarshaling->pInputAssemblyState ? 1 : 0);
+    if (forMarshaling->pInputAssemblyState)
+    {
+        marshal_VkPipelineInputAssemblyStateCreateInfo(vkStream, forMarshaling->pInputAssemblyState);
+    }
+    vkStream->putU32(forMarshaling->pTessellationState ? 1 : 0);
+    if (forMarshaling->pTessellationState)
+    {
+        marshal_VkPipelineTessellationStateCreateInfo(vkStream, forMarshaling->pTessellationState);
+    }
+    vkStream->putU32(forMarshaling->pViewportState ? 1 : 0);
+    if (forMarshaling->pViewportState)
+    {
+        marshal_VkPipelineViewportStateCreateInfo(vkStream, forMarshaling->pViewportState);
+    }
+    vkStream->putU32(forMarshaling->pRasterizationState ? 1 : 0);
+    if (forMarshaling->pRasterizationState)
+    {
+        marshal_VkPipelineRasterizationStateCreateInfo(vkStream, forMarshaling->pRasterizationState);
+    }
+    vkStream->putU32(forMarshaling->pMultisampleState ? 1 : 0);
+    if (forMarshaling->pMultisampleState)
+    {
+        marshal_VkPipelineMultisampleStateCreateInfo(vkStream, forMarshaling->pMultisampleState);
+    }
+    vkStream->putU32(forMarshaling->pDepthStencilState ? 1 : 0);
+    if (forMarshaling->pDepthStencilState)
+    {
+        marshal_VkPipelineDepthStencilStateCreateInfo(vkStream, forMarshaling->pDepthStencilState);
+    }
+    vkStream->putU32(forMarshaling->pColorBlendState ? 1 : 0);
+    if (forMarshaling->pColorBlendState)
+    {
+        marshal_VkPipelineColorBlendStateCreateInfo(vkStream, forMarshaling->pColorBlendState);
+    }
+    vkStream->putU32(forMarshaling->pDynamicState ? 1 : 0);
+    if (forMarshaling->pDynamicState)
+    {
+        marshal_VkPipelineDynamicStateCreateInfo(vkStream, forMarshaling->pDynamicState);
+    }
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(forMarshaling->layout));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkRenderPass(forMarshaling->renderPass));
+    vkStream->write(&forMarshaling->subpass, sizeof(uint32_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipeline(forMarshaling->basePipelineHandle));
+    vkStream->write(&forMarshaling->basePipelineIndex, sizeof(int32_t));
+}
+
+void unmarshal_VkGraphicsPipelineCreateInfo(
+    VulkanStream* vkStream,
+    VkGraphicsPipelineCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineCreateFlags));
+    vkStream->read(&forUnmarshaling->stageCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkPipelineShaderStageCreateInfo* pStages = (VkPipelineShaderStageCreateInfo*)vkStream->allocArray(forUnmarshaling->stageCount, sizeof(VkPipelineShaderStageCreateInfo));
+        forUnmarshaling->pStages = pStages;
+        if (pStages)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->stageCount; ++i)
+            {
+                unmarshal_VkPipelineShaderStageCreateInfo(vkStream, pStages + i);
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineVertexInputStateCreateInfo* pVertexInputState = (VkPipelineVertexInputStateCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineVertexInputStateCreateInfo));
+        forUnmarshaling->pVertexInputState = pVertexInputState;
+        if (pVertexInputState)
+        {
+            unmarshal_VkPipelineVertexInputStateCreateInfo(vkStream, pVertexInputState);
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineInputAssemblyStateCreateInfo* pInputAssemblyState = (VkPipelineInputAssemblyStateCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineInputAssemblyStateCreateInfo));
+        forUnmarshaling->pInputAssemblyState = pInputAssemblyState;
+        if (pInputAssemblyState)
+        {
+            unmarshal_VkPipelineInputAssemblyStateCreateInfo(vkStream, pInputAssemblyState);
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineTessellationStateCreateInfo* pTessellationState = (VkPipelineTessellationStateCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineTessellationStateCreateInfo));
+        forUnmarshaling->pTessellationState = pTessellationState;
+        if (pTessellationState)
+        {
+            unmarshal_VkPipelineTessellationStateCreateInfo(vkStream, pTessellationState);
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineViewportStateCreateInfo* pViewportState = (VkPipelineViewportStateCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineViewportStateCreateInfo));
+        forUnmarshaling->pViewportState = pViewportState;
+        if (pViewportState)
+        {
+            unmarshal_VkPipelineViewportStateCreateInfo(vkStream, pViewportState);
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineRasterizationStateCreateInfo* pRasterizationState = (VkPipelineRasterizationStateCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineRasterizationStateCreateInfo));
+        forUnmarshaling->pRasterizationState = pRasterizationState;
+        if (pRasterizationState)
+        {
+            unmarshal_VkPipelineRasterizationStateCreateInfo(vkStream, pRasterizationState);
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineMultisampleStateCreateInfo* pMultisampleState = (VkPipelineMultisampleStateCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineMultisampleStateCreateInfo));
+        forUnmarshaling->pMultisampleState = pMultisampleState;
+        if (pMultisampleState)
+        {
+            unmarshal_VkPipelineMultisampleStateCreateInfo(vkStream, pMultisampleState);
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineDepthStencilStateCreateInfo* pDepthStencilState = (VkPipelineDepthStencilStateCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineDepthStencilStateCreateInfo));
+        forUnmarshaling->pDepthStencilState = pDepthStencilState;
+        if (pDepthStencilState)
+        {
+            unmarshal_VkPipelineDepthStencilStateCreateInfo(vkStream, pDepthStencilState);
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineColorBlendStateCreateInfo* pColorBlendState = (VkPipelineColorBlendStateCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineColorBlendStateCreateInfo));
+        forUnmarshaling->pColorBlendState = pColorBlendState;
+        if (pColorBlendState)
+        {
+            unmarshal_VkPipelineColorBlendStateCreateInfo(vkStream, pColorBlendState);
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkPipelineDynamicStateCreateInfo* pDynamicState = (VkPipelineDynamicStateCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineDynamicStateCreateInfo));
+        forUnmarshaling->pDynamicState = pDynamicState;
+        if (pDynamicState)
+        {
+            unmarshal_VkPipelineDynamicStateCreateInfo(vkStream, pDynamicState);
+        }
+    }
+    forUnmarshaling->layout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+    forUnmarshaling->renderPass = vkStream->handleMapping()->fromWire_VkRenderPass(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->subpass, sizeof(uint32_t));
+    forUnmarshaling->basePipelineHandle = vkStream->handleMapping()->fromWire_VkPipeline(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->basePipelineIndex, sizeof(int32_t));
+}
+
+
+void marshal_VkComputePipelineCreateInfo(
+    VulkanStream* vkStream,
+    const VkComputePipelineCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineCreateFlags));
+    marshal_VkPipelineShaderStageCreateInfo(vkStream, &forMarshaling->stage);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(forMarshaling->layout));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipeline(forMarshaling->basePipelineHandle));
+    vkStream->write(&forMarshaling->basePipelineIndex, sizeof(int32_t));
+}
+
+void unmarshal_VkComputePipelineCreateInfo(
+    VulkanStream* vkStream,
+    VkComputePipelineCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineCreateFlags));
+    unmarshal_VkPipelineShaderStageCreateInfo(vkStream, &forUnmarshaling->stage);
+    forUnmarshaling->layout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+    forUnmarshaling->basePipelineHandle = vkStream->handleMapping()->fromWire_VkPipeline(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->basePipelineIndex, sizeof(int32_t));
+}
+
+
+void marshal_VkPushConstantRange(
+    VulkanStream* vkStream,
+    const VkPushConstantRange* forMarshaling)
+{
+    vkStream->write(&forMarshaling->stageFlags, sizeof(VkShaderStageFlags));
+    vkStream->write(&forMarshaling->offset, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->size, sizeof(uint32_t));
+}
+
+void unmarshal_VkPushConstantRange(
+    VulkanStream* vkStream,
+    VkPushConstantRange* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->stageFlags, sizeof(VkShaderStageFlags));
+    vkStream->read(&forUnmarshaling->offset, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->size, sizeof(uint32_t));
+}
+
+
+void marshal_VkPipelineLayoutCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineLayoutCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineLayoutCreateFlags));
+    vkStream->write(&forMarshaling->setLayoutCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSetLayouts ? 1 : 0);
+    if (forMarshaling->pSetLayouts)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->setLayoutCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSetLayout(forMarshaling->pSetLayouts[i]));
+        }
+    }
+    vkStream->write(&forMarshaling->pushConstantRangeCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pPushConstantRanges ? 1 : 0);
+    if (forMarshaling->pPushConstantRanges)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->pushConstantRangeCount; ++i)
+        {
+            marshal_VkPushConstantRange(vkStream, forMarshaling->pPushConstantRanges + i);
+        }
+    }
+}
+
+void unmarshal_VkPipelineLayoutCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineLayoutCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineLayoutCreateFlags));
+    vkStream->read(&forUnmarshaling->setLayoutCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDescriptorSetLayout* pSetLayouts = (VkDescriptorSetLayout*)vkStream->allocArray(forUnmarshaling->setLayoutCount, sizeof(VkDescriptorSetLayout));
+        forUnmarshaling->pSetLayouts = pSetLayouts;
+        if (pSetLayouts)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->setLayoutCount; ++i)
+            {
+                pSetLayouts[i] = vkStream->handleMapping()->fromWire_VkDescriptorSetLayout(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->pushConstantRangeCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkPushConstantRange* pPushConstantRanges = (VkPushConstantRange*)vkStream->allocArray(forUnmarshaling->pushConstantRangeCount, sizeof(VkPushConstantRange));
+        forUnmarshaling->pPushConstantRanges = pPushConstantRanges;
+        if (pPushConstantRanges)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->pushConstantRangeCount; ++i)
+            {
+                unmarshal_VkPushConstantRange(vkStream, pPushConstantRanges + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkSamplerCreateInfo(
+    VulkanStream* vkStream,
+    const VkSamplerCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkSamplerCreateFlags));
+    vkStream->write(&forMarshaling->magFilter, sizeof(VkFilter));
+    vkStream->write(&forMarshaling->minFilter, sizeof(VkFilter));
+    vkStream->write(&forMarshaling->mipmapMode, sizeof(VkSamplerMipmapMode));
+    vkStream->write(&forMarshaling->addressModeU, sizeof(VkSamplerAddressMode));
+    vkStream->write(&forMarshaling->addressModeV, sizeof(VkSamplerAddressMode));
+    vkStream->write(&forMarshaling->addressModeW, sizeof(VkSamplerAddressMode));
+    vkStream->write(&forMarshaling->mipLodBias, sizeof(float));
+    vkStream->write(&forMarshaling->anisotropyEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->maxAnisotropy, sizeof(float));
+    vkStream->write(&forMarshaling->compareEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->compareOp, sizeof(VkCompareOp));
+    vkStream->write(&forMarshaling->minLod, sizeof(float));
+    vkStream->write(&forMarshaling->maxLod, sizeof(float));
+    vkStream->write(&forMarshaling->borderColor, sizeof(VkBorderColor));
+    vkStream->write(&forMarshaling->unnormalizedCoordinates, sizeof(VkBool32));
+}
+
+void unmarshal_VkSamplerCreateInfo(
+    VulkanStream* vkStream,
+    VkSamplerCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkSamplerCreateFlags));
+    vkStream->read(&forUnmarshaling->magFilter, sizeof(VkFilter));
+    vkStream->read(&forUnmarshaling->minFilter, sizeof(VkFilter));
+    vkStream->read(&forUnmarshaling->mipmapMode, sizeof(VkSamplerMipmapMode));
+    vkStream->read(&forUnmarshaling->addressModeU, sizeof(VkSamplerAddressMode));
+    vkStream->read(&forUnmarshaling->addressModeV, sizeof(VkSamplerAddressMode));
+    vkStream->read(&forUnmarshaling->addressModeW, sizeof(VkSamplerAddressMode));
+    vkStream->read(&forUnmarshaling->mipLodBias, sizeof(float));
+    vkStream->read(&forUnmarshaling->anisotropyEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->maxAnisotropy, sizeof(float));
+    vkStream->read(&forUnmarshaling->compareEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->compareOp, sizeof(VkCompareOp));
+    vkStream->read(&forUnmarshaling->minLod, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxLod, sizeof(float));
+    vkStream->read(&forUnmarshaling->borderColor, sizeof(VkBorderColor));
+    vkStream->read(&forUnmarshaling->unnormalizedCoordinates, sizeof(VkBool32));
+}
+
+
+void marshal_VkDescriptorSetLayoutBinding(
+    VulkanStream* vkStream,
+    const VkDescriptorSetLayoutBinding* forMarshaling)
+{
+    vkStream->write(&forMarshaling->binding, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->descriptorType, sizeof(VkDescriptorType));
+    vkStream->write(&forMarshaling->descriptorCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->stageFlags, sizeof(VkShaderStageFlags));
+    if (forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER ||
+        forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
+    {
+        vkStream->putU32(forMarshaling->pImmutableSamplers ? 1 : 0);
+        if (forMarshaling->pImmutableSamplers)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forMarshaling->descriptorCount; ++i)
+            {
+                vkStream->putU64(vkStream->handleMapping()->toWire_VkSampler(forMarshaling->pImmutableSamplers[i]));
+            }
+        }
+    }
+}
+
+void unmarshal_VkDescriptorSetLayoutBinding(
+    VulkanStream* vkStream,
+    VkDescriptorSetLayoutBinding* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->binding, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->descriptorType, sizeof(VkDescriptorType));
+    vkStream->read(&forUnmarshaling->descriptorCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->stageFlags, sizeof(VkShaderStageFlags));
+    if (forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER ||
+        forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
+    {
+        if (vkStream->getU32())
+        {
+            VkSampler* pImmutableSamplers = (VkSampler*)vkStream->allocArray(forUnmarshaling->descriptorCount, sizeof(VkSampler));
+            forUnmarshaling->pImmutableSamplers = pImmutableSamplers;
+            if (pImmutableSamplers)
+            {
+                for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->descriptorCount; ++i)
+                {
+                    pImmutableSamplers[i] = vkStream->handleMapping()->fromWire_VkSampler(vkStream, vkStream->getU64());
+                }
+            }
+        }
+    }
+}
+
+
+void marshal_VkDescriptorSetLayoutCreateInfo(
+    VulkanStream* vkStream,
+    const VkDescriptorSetLayoutCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkDescriptorSetLayoutCreateFlags));
+    vkStream->write(&forMarshaling->bindingCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pBindings ? 1 : 0);
+    if (forMarshaling->pBindings)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->bindingCount; ++i)
+        {
+            marshal_VkDescriptorSetLayoutBinding(vkStream, forMarshaling->pBindings + i);
+        }
+    }
+}
+
+void unmarshal_VkDescriptorSetLayoutCreateInfo(
+    VulkanStream* vkStream,
+    VkDescriptorSetLayoutCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkDescriptorSetLayoutCreateFlags));
+    vkStream->read(&forUnmarshaling->bindingCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDescriptorSetLayoutBinding* pBindings = (VkDescriptorSetLayoutBinding*)vkStream->allocArray(forUnmarshaling->bindingCount, sizeof(VkDescriptorSetLayoutBinding));
+        forUnmarshaling->pBindings = pBindings;
+        if (pBindings)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->bindingCount; ++i)
+            {
+                unmarshal_VkDescriptorSetLayoutBinding(vkStream, pBindings + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkDescriptorPoolSize(
+    VulkanStream* vkStream,
+    const VkDescriptorPoolSize* forMarshaling)
+{
+    vkStream->write(&forMarshaling->type, sizeof(VkDescriptorType));
+    vkStream->write(&forMarshaling->descriptorCount, sizeof(uint32_t));
+}
+
+void unmarshal_VkDescriptorPoolSize(
+    VulkanStream* vkStream,
+    VkDescriptorPoolSize* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->type, sizeof(VkDescriptorType));
+    vkStream->read(&forUnmarshaling->descriptorCount, sizeof(uint32_t));
+}
+
+
+void marshal_VkDescriptorPoolCreateInfo(
+    VulkanStream* vkStream,
+    const VkDescriptorPoolCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkDescriptorPoolCreateFlags));
+    vkStream->write(&forMarshaling->maxSets, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->poolSizeCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pPoolSizes ? 1 : 0);
+    if (forMarshaling->pPoolSizes)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->poolSizeCount; ++i)
+        {
+            marshal_VkDescriptorPoolSize(vkStream, forMarshaling->pPoolSizes + i);
+        }
+    }
+}
+
+void unmarshal_VkDescriptorPoolCreateInfo(
+    VulkanStream* vkStream,
+    VkDescriptorPoolCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkDescriptorPoolCreateFlags));
+    vkStream->read(&forUnmarshaling->maxSets, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->poolSizeCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDescriptorPoolSize* pPoolSizes = (VkDescriptorPoolSize*)vkStream->allocArray(forUnmarshaling->poolSizeCount, sizeof(VkDescriptorPoolSize));
+        forUnmarshaling->pPoolSizes = pPoolSizes;
+        if (pPoolSizes)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->poolSizeCount; ++i)
+            {
+                unmarshal_VkDescriptorPoolSize(vkStream, pPoolSizes + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkDescriptorSetAllocateInfo(
+    VulkanStream* vkStream,
+    const VkDescriptorSetAllocateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorPool(forMarshaling->descriptorPool));
+    vkStream->write(&forMarshaling->descriptorSetCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSetLayouts ? 1 : 0);
+    if (forMarshaling->pSetLayouts)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->descriptorSetCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSetLayout(forMarshaling->pSetLayouts[i]));
+        }
+    }
+}
+
+void unmarshal_VkDescriptorSetAllocateInfo(
+    VulkanStream* vkStream,
+    VkDescriptorSetAllocateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->descriptorPool = vkStream->handleMapping()->fromWire_VkDescriptorPool(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->descriptorSetCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDescriptorSetLayout* pSetLayouts = (VkDescriptorSetLayout*)vkStream->allocArray(forUnmarshaling->descriptorSetCount, sizeof(VkDescriptorSetLayout));
+        forUnmarshaling->pSetLayouts = pSetLayouts;
+        if (pSetLayouts)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->descriptorSetCount; ++i)
+            {
+                pSetLayouts[i] = vkStream->handleMapping()->fromWire_VkDescriptorSetLayout(vkStream, vkStream->getU64());
+            }
+        }
+    }
+}
+
+
+void marshal_VkDescriptorImageInfo(
+    VulkanStream* vkStream,
+    const VkDescriptorImageInfo* forMarshaling)
+{
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSampler(forMarshaling->sampler));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImageView(forMarshaling->imageView));
+    vkStream->write(&forMarshaling->imageLayout, sizeof(VkImageLayout));
+}
+
+void unmarshal_VkDescriptorImageInfo(
+    VulkanStream* vkStream,
+    VkDescriptorImageInfo* forUnmarshaling)
+{
+    forUnmarshaling->sampler = vkStream->handleMapping()->fromWire_VkSampler(vkStream, vkStream->getU64());
+    forUnmarshaling->imageView = vkStream->handleMapping()->fromWire_VkImageView(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->imageLayout, sizeof(VkImageLayout));
+}
+
+
+void marshal_VkDescriptorBufferInfo(
+    VulkanStream* vkStream,
+    const VkDescriptorBufferInfo* forMarshaling)
+{
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+    vkStream->write(&forMarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->range, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkDescriptorBufferInfo(
+    VulkanStream* vkStream,
+    VkDescriptorBufferInfo* forUnmarshaling)
+{
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->range, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkWriteDescriptorSet(
+    VulkanStream* vkStream,
+    const VkWriteDescriptorSet* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSet(forMarshaling->dstSet));
+    vkStream->write(&forMarshaling->dstBinding, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->dstArrayElement, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->descriptorCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->descriptorType, sizeof(VkDescriptorType));
+    if (forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER ||
+        forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER ||
+        forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE ||
+        forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE ||
+        forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT)
+    {
+        vkStream->putU32(forMarshaling->pImageInfo ? 1 : 0);
+        if (forMarshaling->pImageInfo)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forMarshaling->descriptorCount; ++i)
+            {
+                marshal_VkDescriptorImageInfo(vkStream, forMarshaling->pImageInfo + i);
+            }
+        }
+    }
+    if (forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
+        forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
+        forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
+        forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)
+    {
+        vkStream->putU32(forMarshaling->pBufferInfo ? 1 : 0);
+        if (forMarshaling->pBufferInfo)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forMarshaling->descriptorCount; ++i)
+            {
+                marshal_VkDescriptorBufferInfo(vkStream, forMarshaling->pBufferInfo + i);
+            }
+        }
+    }
+    if (forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER ||
+        forMarshaling->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER)
+    {
+        vkStream->putU32(forMarshaling->pTexelBufferView ? 1 : 0);
+        if (forMarshaling->pTexelBufferView)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forMarshaling->descriptorCount; ++i)
+            {
+                vkStream->putU64(vkStream->handleMapping()->toWire_VkBufferView(forMarshaling->pTexelBufferView[i]));
+            }
+        }
+    }
+}
+
+void unmarshal_VkWriteDescriptorSet(
+    VulkanStream* vkStream,
+    VkWriteDescriptorSet* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->dstSet = vkStream->handleMapping()->fromWire_VkDescriptorSet(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->dstBinding, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->dstArrayElement, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->descriptorCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->descriptorType, sizeof(VkDescriptorType));
+    if (forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER ||
+        forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER ||
+        forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE ||
+        forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE ||
+        forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT)
+    {
+        if (vkStream->getU32())
+        {
+            VkDescriptorImageInfo* pImageInfo = (VkDescriptorImageInfo*)vkStream->allocArray(forUnmarshaling->descriptorCount, sizeof(VkDescriptorImageInfo));
+            forUnmarshaling->pImageInfo = pImageInfo;
+            if (pImageInfo)
+            {
+                for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->descriptorCount; ++i)
+                {
+                    unmarshal_VkDescriptorImageInfo(vkStream, pImageInfo + i);
+                }
+            }
+        }
+    }
+    if (forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER ||
+        forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
+        forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC ||
+        forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)
+    {
+        if (vkStream->getU32())
+        {
+            VkDescriptorBufferInfo* pBufferInfo = (VkDescriptorBufferInfo*)vkStream->allocArray(forUnmarshaling->descriptorCount, sizeof(VkDescriptorBufferInfo));
+            forUnmarshaling->pBufferInfo = pBufferInfo;
+            if (pBufferInfo)
+            {
+                for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->descriptorCount; ++i)
+                {
+                    unmarshal_VkDescriptorBufferInfo(vkStream, pBufferInfo + i);
+                }
+            }
+        }
+    }
+    if (forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER ||
+        forUnmarshaling->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER)
+    {
+        if (vkStream->getU32())
+        {
+            VkBufferView* pTexelBufferView = (VkBufferView*)vkStream->allocArray(forUnmarshaling->descriptorCount, sizeof(VkBufferView));
+            forUnmarshaling->pTexelBufferView = pTexelBufferView;
+            if (pTexelBufferView)
+            {
+                for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->descriptorCount; ++i)
+                {
+                    pTexelBufferView[i] = vkStream->handleMapping()->fromWire_VkBufferView(vkStream, vkStream->getU64());
+                }
+            }
+        }
+    }
+}
+
+
+void marshal_VkCopyDescriptorSet(
+    VulkanStream* vkStream,
+    const VkCopyDescriptorSet* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSet(forMarshaling->srcSet));
+    vkStream->write(&forMarshaling->srcBinding, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->srcArrayElement, sizeof(uint32_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSet(forMarshaling->dstSet));
+    vkStream->write(&forMarshaling->dstBinding, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->dstArrayElement, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->descriptorCount, sizeof(uint32_t));
+}
+
+void unmarshal_VkCopyDescriptorSet(
+    VulkanStream* vkStream,
+    VkCopyDescriptorSet* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->srcSet = vkStream->handleMapping()->fromWire_VkDescriptorSet(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->srcBinding, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->srcArrayElement, sizeof(uint32_t));
+    forUnmarshaling->dstSet = vkStream->handleMapping()->fromWire_VkDescriptorSet(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->dstBinding, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->dstArrayElement, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->descriptorCount, sizeof(uint32_t));
+}
+
+
+void marshal_VkFramebufferCreateInfo(
+    VulkanStream* vkStream,
+    const VkFramebufferCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkFramebufferCreateFlags));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkRenderPass(forMarshaling->renderPass));
+    vkStream->write(&forMarshaling->attachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pAttachments ? 1 : 0);
+    if (forMarshaling->pAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->attachmentCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkImageView(forMarshaling->pAttachments[i]));
+        }
+    }
+    vkStream->write(&forMarshaling->width, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->height, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->layers, sizeof(uint32_t));
+}
+
+void unmarshal_VkFramebufferCreateInfo(
+    VulkanStream* vkStream,
+    VkFramebufferCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkFramebufferCreateFlags));
+    forUnmarshaling->renderPass = vkStream->handleMapping()->fromWire_VkRenderPass(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->attachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkImageView* pAttachments = (VkImageView*)vkStream->allocArray(forUnmarshaling->attachmentCount, sizeof(VkImageView));
+        forUnmarshaling->pAttachments = pAttachments;
+        if (pAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->attachmentCount; ++i)
+            {
+                pAttachments[i] = vkStream->handleMapping()->fromWire_VkImageView(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->width, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->height, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->layers, sizeof(uint32_t));
+}
+
+
+void marshal_VkAttachmentDescription(
+    VulkanStream* vkStream,
+    const VkAttachmentDescription* forMarshaling)
+{
+    vkStream->write(&forMarshaling->flags, sizeof(VkAttachmentDescriptionFlags));
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->samples, sizeof(VkSampleCountFlagBits));
+    vkStream->write(&forMarshaling->loadOp, sizeof(VkAttachmentLoadOp));
+    vkStream->write(&forMarshaling->storeOp, sizeof(VkAttachmentStoreOp));
+    vkStream->write(&forMarshaling->stencilLoadOp, sizeof(VkAttachmentLoadOp));
+    vkStream->write(&forMarshaling->stencilStoreOp, sizeof(VkAttachmentStoreOp));
+    vkStream->write(&forMarshaling->initialLayout, sizeof(VkImageLayout));
+    vkStream->write(&forMarshaling->finalLayout, sizeof(VkImageLayout));
+}
+
+void unmarshal_VkAttachmentDescription(
+    VulkanStream* vkStream,
+    VkAttachmentDescription* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkAttachmentDescriptionFlags));
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->samples, sizeof(VkSampleCountFlagBits));
+    vkStream->read(&forUnmarshaling->loadOp, sizeof(VkAttachmentLoadOp));
+    vkStream->read(&forUnmarshaling->storeOp, sizeof(VkAttachmentStoreOp));
+    vkStream->read(&forUnmarshaling->stencilLoadOp, sizeof(VkAttachmentLoadOp));
+    vkStream->read(&forUnmarshaling->stencilStoreOp, sizeof(VkAttachmentStoreOp));
+    vkStream->read(&forUnmarshaling->initialLayout, sizeof(VkImageLayout));
+    vkStream->read(&forUnmarshaling->finalLayout, sizeof(VkImageLayout));
+}
+
+
+void marshal_VkAttachmentReference(
+    VulkanStream* vkStream,
+    const VkAttachmentReference* forMarshaling)
+{
+    vkStream->write(&forMarshaling->attachment, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->layout, sizeof(VkImageLayout));
+}
+
+void unmarshal_VkAttachmentReference(
+    VulkanStream* vkStream,
+    VkAttachmentReference* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->attachment, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->layout, sizeof(VkImageLayout));
+}
+
+
+void marshal_VkSubpassDescription(
+    VulkanStream* vkStream,
+    const VkSubpassDescription* forMarshaling)
+{
+    vkStream->write(&forMarshaling->flags, sizeof(VkSubpassDescriptionFlags));
+    vkStream->write(&forMarshaling->pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->write(&forMarshaling->inputAttachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pInputAttachments ? 1 : 0);
+    if (forMarshaling->pInputAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->inputAttachmentCount; ++i)
+        {
+            marshal_VkAttachmentReference(vkStream, forMarshaling->pInputAttachments + i);
+        }
+    }
+    vkStream->write(&forMarshaling->colorAttachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pColorAttachments ? 1 : 0);
+    if (forMarshaling->pColorAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->colorAttachmentCount; ++i)
+        {
+            marshal_VkAttachmentReference(vkStream, forMarshaling->pColorAttachments + i);
+        }
+    }
+    vkStream->putU32(forMarshaling->pResolveAttachments ? 1 : 0);
+    if (forMarshaling->pResolveAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->colorAttachmentCount; ++i)
+        {
+            marshal_VkAttachmentReference(vkStream, forMarshaling->pResolveAttachments + i);
+        }
+    }
+    vkStream->putU32(forMarshaling->pDepthStencilAttachment ? 1 : 0);
+    if (forMarshaling->pDepthStencilAttachment)
+    {
+        marshal_VkAttachmentReference(vkStream, forMarshaling->pDepthStencilAttachment);
+    }
+    vkStream->write(&forMarshaling->preserveAttachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pPreserveAttachments ? 1 : 0);
+    if (forMarshaling->pPreserveAttachments)
+    {
+        vkStream->write(forMarshaling->pPreserveAttachments, forMarshaling->preserveAttachmentCount * sizeof(uint32_t));
+    }
+}
+
+void unmarshal_VkSubpassDescription(
+    VulkanStream* vkStream,
+    VkSubpassDescription* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkSubpassDescriptionFlags));
+    vkStream->read(&forUnmarshaling->pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->read(&forUnmarshaling->inputAttachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkAttachmentReference* pInputAttachments = (VkAttachmentReference*)vkStream->allocArray(forUnmarshaling->inputAttachmentCount, sizeof(VkAttachmentReference));
+        forUnmarshaling->pInputAttachments = pInputAttachments;
+        if (pInputAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->inputAttachmentCount; ++i)
+            {
+                unmarshal_VkAttachmentReference(vkStream, pInputAttachments + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->colorAttachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkAttachmentReference* pColorAttachments = (VkAttachmentReference*)vkStream->allocArray(forUnmarshaling->colorAttachmentCount, sizeof(VkAttachmentReference));
+        forUnmarshaling->pColorAttachments = pColorAttachments;
+        if (pColorAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->colorAttachmentCount; ++i)
+            {
+                unmarshal_VkAttachmentReference(vkStream, pColorAttachments + i);
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkAttachmentReference* pResolveAttachments = (VkAttachmentReference*)vkStream->allocArray(forUnmarshaling->colorAttachmentCount, sizeof(VkAttachmentReference));
+        forUnmarshaling->pResolveAttachments = pResolveAttachments;
+        if (pResolveAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->colorAttachmentCount; ++i)
+            {
+                unmarshal_VkAttachmentReference(vkStream, pResolveAttachments + i);
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkAttachmentReference* pDepthStencilAttachment = (VkAttachmentReference*)vkStream->allocArray(1, sizeof(VkAttachmentReference));
+        forUnmarshaling->pDepthStencilAttachment = pDepthStencilAttachment;
+        if (pDepthStencilAttachment)
+        {
+            unmarshal_VkAttachmentReference(vkStream, pDepthStencilAttachment);
+        }
+    }
+    vkStream->read(&forUnmarshaling->preserveAttachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pPreserveAttachments = (uint32_t*)vkStream->allocArray(forUnmarshaling->preserveAttachmentCount, sizeof(uint32_t));
+        forUnmarshaling->pPreserveAttachments = pPreserveAttachments;
+        if (pPreserveAttachments)
+        {
+            vkStream->read(pPreserveAttachments, forUnmarshaling->preserveAttachmentCount * sizeof(uint32_t));
+        }
+    }
+}
+
+
+void marshal_VkSubpassDependency(
+    VulkanStream* vkStream,
+    const VkSubpassDependency* forMarshaling)
+{
+    vkStream->write(&forMarshaling->srcSubpass, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->dstSubpass, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->srcStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->write(&forMarshaling->dstStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->write(&forMarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->write(&forMarshaling->dstAccessMask, sizeof(VkAccessFlags));
+    vkStream->write(&forMarshaling->dependencyFlags, sizeof(VkDependencyFlags));
+}
+
+void unmarshal_VkSubpassDependency(
+    VulkanStream* vkStream,
+    VkSubpassDependency* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->srcSubpass, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->dstSubpass, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->srcStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->read(&forUnmarshaling->dstStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->read(&forUnmarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->read(&forUnmarshaling->dstAccessMask, sizeof(VkAccessFlags));
+    vkStream->read(&forUnmarshaling->dependencyFlags, sizeof(VkDependencyFlags));
+}
+
+
+void marshal_VkRenderPassCreateInfo(
+    VulkanStream* vkStream,
+    const VkRenderPassCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkRenderPassCreateFlags));
+    vkStream->write(&forMarshaling->attachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pAttachments ? 1 : 0);
+    if (forMarshaling->pAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->attachmentCount; ++i)
+        {
+            marshal_VkAttachmentDescription(vkStream, forMarshaling->pAttachments + i);
+        }
+    }
+    vkStream->write(&forMarshaling->subpassCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSubpasses ? 1 : 0);
+    if (forMarshaling->pSubpasses)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->subpassCount; ++i)
+        {
+            marshal_VkSubpassDescription(vkStream, forMarshaling->pSubpasses + i);
+        }
+    }
+    vkStream->write(&forMarshaling->dependencyCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDependencies ? 1 : 0);
+    if (forMarshaling->pDependencies)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->dependencyCount; ++i)
+        {
+            marshal_VkSubpassDependency(vkStream, forMarshaling->pDependencies + i);
+        }
+    }
+}
+
+void unmarshal_VkRenderPassCreateInfo(
+    VulkanStream* vkStream,
+    VkRenderPassCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkRenderPassCreateFlags));
+    vkStream->read(&forUnmarshaling->attachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkAttachmentDescription* pAttachments = (VkAttachmentDescription*)vkStream->allocArray(forUnmarshaling->attachmentCount, sizeof(VkAttachmentDescription));
+        forUnmarshaling->pAttachments = pAttachments;
+        if (pAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->attachmentCount; ++i)
+            {
+                unmarshal_VkAttachmentDescription(vkStream, pAttachments + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->subpassCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSubpassDescription* pSubpasses = (VkSubpassDescription*)vkStream->allocArray(forUnmarshaling->subpassCount, sizeof(VkSubpassDescription));
+        forUnmarshaling->pSubpasses = pSubpasses;
+        if (pSubpasses)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->subpassCount; ++i)
+            {
+                unmarshal_VkSubpassDescription(vkStream, pSubpasses + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->dependencyCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSubpassDependency* pDependencies = (VkSubpassDependency*)vkStream->allocArray(forUnmarshaling->dependencyCount, sizeof(VkSubpassDependency));
+        forUnmarshaling->pDependencies = pDependencies;
+        if (pDependencies)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->dependencyCount; ++i)
+            {
+                unmarshal_VkSubpassDependency(vkStream, pDependencies + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkCommandPoolCreateInfo(
+    VulkanStream* vkStream,
+    const VkCommandPoolCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkCommandPoolCreateFlags));
+    vkStream->write(&forMarshaling->queueFamilyIndex, sizeof(uint32_t));
+}
+
+void unmarshal_VkCommandPoolCreateInfo(
+    VulkanStream* vkStream,
+    VkCommandPoolCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkCommandPoolCreateFlags));
+    vkStream->read(&forUnmarshaling->queueFamilyIndex, sizeof(uint32_t));
+}
+
+
+void marshal_VkCommandBufferAllocateInfo(
+    VulkanStream* vkStream,
+    const VkCommandBufferAllocateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandPool(forMarshaling->commandPool));
+    vkStream->write(&forMarshaling->level, sizeof(VkCommandBufferLevel));
+    vkStream->write(&forMarshaling->commandBufferCount, sizeof(uint32_t));
+}
+
+void unmarshal_VkCommandBufferAllocateInfo(
+    VulkanStream* vkStream,
+    VkCommandBufferAllocateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->commandPool = vkStream->handleMapping()->fromWire_VkCommandPool(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->level, sizeof(VkCommandBufferLevel));
+    vkStream->read(&forUnmarshaling->commandBufferCount, sizeof(uint32_t));
+}
+
+
+void marshal_VkCommandBufferInheritanceInfo(
+    VulkanStream* vkStream,
+    const VkCommandBufferInheritanceInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkRenderPass(forMarshaling->renderPass));
+    vkStream->write(&forMarshaling->subpass, sizeof(uint32_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFramebuffer(forMarshaling->framebuffer));
+    vkStream->write(&forMarshaling->occlusionQueryEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->queryFlags, sizeof(VkQueryControlFlags));
+    vkStream->write(&forMarshaling->pipelineStatistics, sizeof(VkQueryPipelineStatisticFlags));
+}
+
+void unmarshal_VkCommandBufferInheritanceInfo(
+    VulkanStream* vkStream,
+    VkCommandBufferInheritanceInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->renderPass = vkStream->handleMapping()->fromWire_VkRenderPass(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->subpass, sizeof(uint32_t));
+    forUnmarshaling->framebuffer = vkStream->handleMapping()->fromWire_VkFramebuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->occlusionQueryEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->queryFlags, sizeof(VkQueryControlFlags));
+    vkStream->read(&forUnmarshaling->pipelineStatistics, sizeof(VkQueryPipelineStatisticFlags));
+}
+
+
+void marshal_VkCommandBufferBeginInfo(
+    VulkanStream* vkStream,
+    const VkCommandBufferBeginInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkCommandBufferUsageFlags));
+    vkStream->putU32(forMarshaling->pInheritanceInfo ? 1 : 0);
+    if (forMarshaling->pInheritanceInfo)
+    {
+        marshal_VkCommandBufferInheritanceInfo(vkStream, forMarshaling->pInheritanceInfo);
+    }
+}
+
+void unmarshal_VkCommandBufferBeginInfo(
+    VulkanStream* vkStream,
+    VkCommandBufferBeginInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkCommandBufferUsageFlags));
+    if (vkStream->getU32())
+    {
+        VkCommandBufferInheritanceInfo* pInheritanceInfo = (VkCommandBufferInheritanceInfo*)vkStream->allocArray(1, sizeof(VkCommandBufferInheritanceInfo));
+        forUnmarshaling->pInheritanceInfo = pInheritanceInfo;
+        if (pInheritanceInfo)
+        {
+            unmarshal_VkCommandBufferInheritanceInfo(vkStream, pInheritanceInfo);
+        }
+    }
+}
+
+
+void marshal_VkBufferCopy(
+    VulkanStream* vkStream,
+    const VkBufferCopy* forMarshaling)
+{
+    vkStream->write(&forMarshaling->srcOffset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->dstOffset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->size, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkBufferCopy(
+    VulkanStream* vkStream,
+    VkBufferCopy* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->srcOffset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->dstOffset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->size, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkImageSubresourceLayers(
+    VulkanStream* vkStream,
+    const VkImageSubresourceLayers* forMarshaling)
+{
+    vkStream->write(&forMarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    vkStream->write(&forMarshaling->mipLevel, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->baseArrayLayer, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->layerCount, sizeof(uint32_t));
+}
+
+void unmarshal_VkImageSubresourceLayers(
+    VulkanStream* vkStream,
+    VkImageSubresourceLayers* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    vkStream->read(&forUnmarshaling->mipLevel, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->baseArrayLayer, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->layerCount, sizeof(uint32_t));
+}
+
+
+void marshal_VkImageCopy(
+    VulkanStream* vkStream,
+    const VkImageCopy* forMarshaling)
+{
+    marshal_VkImageSubresourceLayers(vkStream, &forMarshaling->srcSubresource);
+    marshal_VkOffset3D(vkStream, &forMarshaling->srcOffset);
+    marshal_VkImageSubresourceLayers(vkStream, &forMarshaling->dstSubresource);
+    marshal_VkOffset3D(vkStream, &forMarshaling->dstOffset);
+    marshal_VkExtent3D(vkStream, &forMarshaling->extent);
+}
+
+void unmarshal_VkImageCopy(
+    VulkanStream* vkStream,
+    VkImageCopy* forUnmarshaling)
+{
+    unmarshal_VkImageSubresourceLayers(vkStream, &forUnmarshaling->srcSubresource);
+    unmarshal_VkOffset3D(vkStream, &forUnmarshaling->srcOffset);
+    unmarshal_VkImageSubresourceLayers(vkStream, &forUnmarshaling->dstSubresource);
+    unmarshal_VkOffset3D(vkStream, &forUnmarshaling->dstOffset);
+    unmarshal_VkExtent3D(vkStream, &forUnmarshaling->extent);
+}
+
+
+void marshal_VkImageBlit(
+    VulkanStream* vkStream,
+    const VkImageBlit* forMarshaling)
+{
+    marshal_VkImageSubresourceLayers(vkStream, &forMarshaling->srcSubresource);
+    for (uint32_t i = 0; i < (uint32_t)2; ++i)
+    {
+        marshal_VkOffset3D(vkStream, forMarshaling->srcOffsets + i);
+    }
+    marshal_VkImageSubresourceLayers(vkStream, &forMarshaling->dstSubresource);
+    for (uint32_t i = 0; i < (uint32_t)2; ++i)
+    {
+        marshal_VkOffset3D(vkStream, forMarshaling->dstOffsets + i);
+    }
+}
+
+void unmarshal_VkImageBlit(
+    VulkanStream* vkStream,
+    VkImageBlit* forUnmarshaling)
+{
+    unmarshal_VkImageSubresourceLayers(vkStream, &forUnmarshaling->srcSubresource);
+    for (uint32_t i = 0; i < (uint32_t)2; ++i)
+    {
+        unmarshal_VkOffset3D(vkStream, forUnmarshaling->srcOffsets + i);
+    }
+    unmarshal_VkImageSubresourceLayers(vkStream, &forUnmarshaling->dstSubresource);
+    for (uint32_t i = 0; i < (uint32_t)2; ++i)
+    {
+        unmarshal_VkOffset3D(vkStream, forUnmarshaling->dstOffsets + i);
+    }
+}
+
+
+void marshal_VkBufferImageCopy(
+    VulkanStream* vkStream,
+    const VkBufferImageCopy* forMarshaling)
+{
+    vkStream->write(&forMarshaling->bufferOffset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->bufferRowLength, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->bufferImageHeight, sizeof(uint32_t));
+    marshal_VkImageSubresourceLayers(vkStream, &forMarshaling->imageSubresource);
+    marshal_VkOffset3D(vkStream, &forMarshaling->imageOffset);
+    marshal_VkExtent3D(vkStream, &forMarshaling->imageExtent);
+}
+
+void unmarshal_VkBufferImageCopy(
+    VulkanStream* vkStream,
+    VkBufferImageCopy* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->bufferOffset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->bufferRowLength, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->bufferImageHeight, sizeof(uint32_t));
+    unmarshal_VkImageSubresourceLayers(vkStream, &forUnmarshaling->imageSubresource);
+    unmarshal_VkOffset3D(vkStream, &forUnmarshaling->imageOffset);
+    unmarshal_VkExtent3D(vkStream, &forUnmarshaling->imageExtent);
+}
+
+
+void marshal_VkClearColorValue(
+    VulkanStream* vkStream,
+    const VkClearColorValue* forMarshaling)
+{
+    vkStream->write(forMarshaling, sizeof(VkClearColorValue));
+}
+
+void unmarshal_VkClearColorValue(
+    VulkanStream* vkStream,
+    VkClearColorValue* forUnmarshaling)
+{
+    vkStream->read(forUnmarshaling, sizeof(VkClearColorValue));
+}
+
+
+void marshal_VkClearDepthStencilValue(
+    VulkanStream* vkStream,
+    const VkClearDepthStencilValue* forMarshaling)
+{
+    vkStream->write(&forMarshaling->depth, sizeof(float));
+    vkStream->write(&forMarshaling->stencil, sizeof(uint32_t));
+}
+
+void unmarshal_VkClearDepthStencilValue(
+    VulkanStream* vkStream,
+    VkClearDepthStencilValue* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->depth, sizeof(float));
+    vkStream->read(&forUnmarshaling->stencil, sizeof(uint32_t));
+}
+
+
+void marshal_VkClearValue(
+    VulkanStream* vkStream,
+    const VkClearValue* forMarshaling)
+{
+    vkStream->write(forMarshaling, sizeof(VkClearValue));
+}
+
+void unmarshal_VkClearValue(
+    VulkanStream* vkStream,
+    VkClearValue* forUnmarshaling)
+{
+    vkStream->read(forUnmarshaling, sizeof(VkClearValue));
+}
+
+
+void marshal_VkClearAttachment(
+    VulkanStream* vkStream,
+    const VkClearAttachment* forMarshaling)
+{
+    vkStream->write(&forMarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    vkStream->write(&forMarshaling->colorAttachment, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->clearValue, sizeof(VkClearValue));
+}
+
+void unmarshal_VkClearAttachment(
+    VulkanStream* vkStream,
+    VkClearAttachment* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->aspectMask, sizeof(VkImageAspectFlags));
+    vkStream->read(&forUnmarshaling->colorAttachment, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->clearValue, sizeof(VkClearValue));
+}
+
+
+void marshal_VkClearRect(
+    VulkanStream* vkStream,
+    const VkClearRect* forMarshaling)
+{
+    marshal_VkRect2D(vkStream, &forMarshaling->rect);
+    vkStream->write(&forMarshaling->baseArrayLayer, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->layerCount, sizeof(uint32_t));
+}
+
+void unmarshal_VkClearRect(
+    VulkanStream* vkStream,
+    VkClearRect* forUnmarshaling)
+{
+    unmarshal_VkRect2D(vkStream, &forUnmarshaling->rect);
+    vkStream->read(&forUnmarshaling->baseArrayLayer, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->layerCount, sizeof(uint32_t));
+}
+
+
+void marshal_VkImageResolve(
+    VulkanStream* vkStream,
+    const VkImageResolve* forMarshaling)
+{
+    marshal_VkImageSubresourceLayers(vkStream, &forMarshaling->srcSubresource);
+    marshal_VkOffset3D(vkStream, &forMarshaling->srcOffset);
+    marshal_VkImageSubresourceLayers(vkStream, &forMarshaling->dstSubresource);
+    marshal_VkOffset3D(vkStream, &forMarshaling->dstOffset);
+    marshal_VkExtent3D(vkStream, &forMarshaling->extent);
+}
+
+void unmarshal_VkImageResolve(
+    VulkanStream* vkStream,
+    VkImageResolve* forUnmarshaling)
+{
+    unmarshal_VkImageSubresourceLayers(vkStream, &forUnmarshaling->srcSubresource);
+    unmarshal_VkOffset3D(vkStream, &forUnmarshaling->srcOffset);
+    unmarshal_VkImageSubresourceLayers(vkStream, &forUnmarshaling->dstSubresource);
+    unmarshal_VkOffset3D(vkStream, &forUnmarshaling->dstOffset);
+    unmarshal_VkExtent3D(vkStream, &forUnmarshaling->extent);
+}
+
+
+void marshal_VkMemoryBarrier(
+    VulkanStream* vkStream,
+    const VkMemoryBarrier* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->write(&forMarshaling->dstAccessMask, sizeof(VkAccessFlags));
+}
+
+void unmarshal_VkMemoryBarrier(
+    VulkanStream* vkStream,
+    VkMemoryBarrier* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->read(&forUnmarshaling->dstAccessMask, sizeof(VkAccessFlags));
+}
+
+
+void marshal_VkBufferMemoryBarrier(
+    VulkanStream* vkStream,
+    const VkBufferMemoryBarrier* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->write(&forMarshaling->dstAccessMask, sizeof(VkAccessFlags));
+    vkStream->write(&forMarshaling->srcQueueFamilyIndex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->dstQueueFamilyIndex, sizeof(uint32_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+    vkStream->write(&forMarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->size, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkBufferMemoryBarrier(
+    VulkanStream* vkStream,
+    VkBufferMemoryBarrier* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->read(&forUnmarshaling->dstAccessMask, sizeof(VkAccessFlags));
+    vkStream->read(&forUnmarshaling->srcQueueFamilyIndex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->dstQueueFamilyIndex, sizeof(uint32_t));
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->size, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkImageMemoryBarrier(
+    VulkanStream* vkStream,
+    const VkImageMemoryBarrier* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->write(&forMarshaling->dstAccessMask, sizeof(VkAccessFlags));
+    vkStream->write(&forMarshaling->oldLayout, sizeof(VkImageLayout));
+    vkStream->write(&forMarshaling->newLayout, sizeof(VkImageLayout));
+    vkStream->write(&forMarshaling->srcQueueFamilyIndex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->dstQueueFamilyIndex, sizeof(uint32_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(forMarshaling->image));
+    marshal_VkImageSubresourceRange(vkStream, &forMarshaling->subresourceRange);
+}
+
+void unmarshal_VkImageMemoryBarrier(
+    VulkanStream* vkStream,
+    VkImageMemoryBarrier* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->read(&forUnmarshaling->dstAccessMask, sizeof(VkAccessFlags));
+    vkStream->read(&forUnmarshaling->oldLayout, sizeof(VkImageLayout));
+    vkStream->read(&forUnmarshaling->newLayout, sizeof(VkImageLayout));
+    vkStream->read(&forUnmarshaling->srcQueueFamilyIndex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->dstQueueFamilyIndex, sizeof(uint32_t));
+    forUnmarshaling->image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+    unmarshal_VkImageSubresourceRange(vkStream, &forUnmarshaling->subresourceRange);
+}
+
+
+void marshal_VkRenderPassBeginInfo(
+    VulkanStream* vkStream,
+    const VkRenderPassBeginInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkRenderPass(forMarshaling->renderPass));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFramebuffer(forMarshaling->framebuffer));
+    marshal_VkRect2D(vkStream, &forMarshaling->renderArea);
+    vkStream->write(&forMarshaling->clearValueCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pClearValues ? 1 : 0);
+    if (forMarshaling->pClearValues)
+    {
+        vkStream->write(forMarshaling->pClearValues, forMarshaling->clearValueCount * sizeof(VkClearValue));
+    }
+}
+
+void unmarshal_VkRenderPassBeginInfo(
+    VulkanStream* vkStream,
+    VkRenderPassBeginInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->renderPass = vkStream->handleMapping()->fromWire_VkRenderPass(vkStream, vkStream->getU64());
+    forUnmarshaling->framebuffer = vkStream->handleMapping()->fromWire_VkFramebuffer(vkStream, vkStream->getU64());
+    unmarshal_VkRect2D(vkStream, &forUnmarshaling->renderArea);
+    vkStream->read(&forUnmarshaling->clearValueCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkClearValue* pClearValues = (VkClearValue*)vkStream->allocArray(forUnmarshaling->clearValueCount, sizeof(VkClearValue));
+        forUnmarshaling->pClearValues = pClearValues;
+        if (pClearValues)
+        {
+            vkStream->read(pClearValues, forUnmarshaling->clearValueCount * sizeof(VkClearValue));
+        }
+    }
+}
+
+
+void marshal_VkDispatchIndirectCommand(
+    VulkanStream* vkStream,
+    const VkDispatchIndirectCommand* forMarshaling)
+{
+    vkStream->write(&forMarshaling->x, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->y, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->z, sizeof(uint32_t));
+}
+
+void unmarshal_VkDispatchIndirectCommand(
+    VulkanStream* vkStream,
+    VkDispatchIndirectCommand* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->x, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->y, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->z, sizeof(uint32_t));
+}
+
+
+void marshal_VkDrawIndexedIndirectCommand(
+    VulkanStream* vkStream,
+    const VkDrawIndexedIndirectCommand* forMarshaling)
+{
+    vkStream->write(&forMarshaling->indexCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->instanceCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->firstIndex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->vertexOffset, sizeof(int32_t));
+    vkStream->write(&forMarshaling->firstInstance, sizeof(uint32_t));
+}
+
+void unmarshal_VkDrawIndexedIndirectCommand(
+    VulkanStream* vkStream,
+    VkDrawIndexedIndirectCommand* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->indexCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->instanceCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->firstIndex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->vertexOffset, sizeof(int32_t));
+    vkStream->read(&forUnmarshaling->firstInstance, sizeof(uint32_t));
+}
+
+
+void marshal_VkDrawIndirectCommand(
+    VulkanStream* vkStream,
+    const VkDrawIndirectCommand* forMarshaling)
+{
+    vkStream->write(&forMarshaling->vertexCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->instanceCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->firstVertex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->firstInstance, sizeof(uint32_t));
+}
+
+void unmarshal_VkDrawIndirectCommand(
+    VulkanStream* vkStream,
+    VkDrawIndirectCommand* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->vertexCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->instanceCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->firstVertex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->firstInstance, sizeof(uint32_t));
+}
+
+
+#endif
+
+#ifdef VK_VERSION_1_1
+
+void marshal_VkPhysicalDeviceSubgroupProperties(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceSubgroupProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->subgroupSize, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->supportedStages, sizeof(VkShaderStageFlags));
+    vkStream->write(&forMarshaling->supportedOperations, sizeof(VkSubgroupFeatureFlags));
+    vkStream->write(&forMarshaling->quadOperationsInAllStages, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceSubgroupProperties(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceSubgroupProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->subgroupSize, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->supportedStages, sizeof(VkShaderStageFlags));
+    vkStream->read(&forUnmarshaling->supportedOperations, sizeof(VkSubgroupFeatureFlags));
+    vkStream->read(&forUnmarshaling->quadOperationsInAllStages, sizeof(VkBool32));
+}
+
+
+void marshal_VkBindBufferMemoryInfo(
+    VulkanStream* vkStream,
+    const VkBindBufferMemoryInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->memory));
+    vkStream->write(&forMarshaling->memoryOffset, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkBindBufferMemoryInfo(
+    VulkanStream* vkStream,
+    VkBindBufferMemoryInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    forUnmarshaling->memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->memoryOffset, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkBindImageMemoryInfo(
+    VulkanStream* vkStream,
+    const VkBindImageMemoryInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(forMarshaling->image));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->memory));
+    vkStream->write(&forMarshaling->memoryOffset, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkBindImageMemoryInfo(
+    VulkanStream* vkStream,
+    VkBindImageMemoryInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+    forUnmarshaling->memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->memoryOffset, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkPhysicalDevice16BitStorageFeatures(
+    VulkanStream* vkStream,
+    const VkPhysicalDevice16BitStorageFeatures* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->storageBuffer16BitAccess, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->uniformAndStorageBuffer16BitAccess, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->storagePushConstant16, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->storageInputOutput16, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDevice16BitStorageFeatures(
+    VulkanStream* vkStream,
+    VkPhysicalDevice16BitStorageFeatures* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->storageBuffer16BitAccess, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->uniformAndStorageBuffer16BitAccess, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->storagePushConstant16, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->storageInputOutput16, sizeof(VkBool32));
+}
+
+
+void marshal_VkMemoryDedicatedRequirements(
+    VulkanStream* vkStream,
+    const VkMemoryDedicatedRequirements* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->prefersDedicatedAllocation, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->requiresDedicatedAllocation, sizeof(VkBool32));
+}
+
+void unmarshal_VkMemoryDedicatedRequirements(
+    VulkanStream* vkStream,
+    VkMemoryDedicatedRequirements* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->prefersDedicatedAllocation, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->requiresDedicatedAllocation, sizeof(VkBool32));
+}
+
+
+void marshal_VkMemoryDedicatedAllocateInfo(
+    VulkanStream* vkStream,
+    const VkMemoryDedicatedAllocateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(forMarshaling->image));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+}
+
+void unmarshal_VkMemoryDedicatedAllocateInfo(
+    VulkanStream* vkStream,
+    VkMemoryDedicatedAllocateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkMemoryAllocateFlagsInfo(
+    VulkanStream* vkStream,
+    const VkMemoryAllocateFlagsInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkMemoryAllocateFlags));
+    vkStream->write(&forMarshaling->deviceMask, sizeof(uint32_t));
+}
+
+void unmarshal_VkMemoryAllocateFlagsInfo(
+    VulkanStream* vkStream,
+    VkMemoryAllocateFlagsInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkMemoryAllocateFlags));
+    vkStream->read(&forUnmarshaling->deviceMask, sizeof(uint32_t));
+}
+
+
+void marshal_VkDeviceGroupRenderPassBeginInfo(
+    VulkanStream* vkStream,
+    const VkDeviceGroupRenderPassBeginInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->deviceMask, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->deviceRenderAreaCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDeviceRenderAreas ? 1 : 0);
+    if (forMarshaling->pDeviceRenderAreas)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->deviceRenderAreaCount; ++i)
+        {
+            marshal_VkRect2D(vkStream, forMarshaling->pDeviceRenderAreas + i);
+        }
+    }
+}
+
+void unmarshal_VkDeviceGroupRenderPassBeginInfo(
+    VulkanStream* vkStream,
+    VkDeviceGroupRenderPassBeginInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->deviceMask, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->deviceRenderAreaCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkRect2D* pDeviceRenderAreas = (VkRect2D*)vkStream->allocArray(forUnmarshaling->deviceRenderAreaCount, sizeof(VkRect2D));
+        forUnmarshaling->pDeviceRenderAreas = pDeviceRenderAreas;
+        if (pDeviceRenderAreas)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->deviceRenderAreaCount; ++i)
+            {
+                unmarshal_VkRect2D(vkStream, pDeviceRenderAreas + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkDeviceGroupCommandBufferBeginInfo(
+    VulkanStream* vkStream,
+    const VkDeviceGroupCommandBufferBeginInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->deviceMask, sizeof(uint32_t));
+}
+
+void unmarshal_VkDeviceGroupCommandBufferBeginInfo(
+    VulkanStream* vkStream,
+    VkDeviceGroupCommandBufferBeginInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->deviceMask, sizeof(uint32_t));
+}
+
+
+void marshal_VkDeviceGroupSubmitInfo(
+    VulkanStream* vkStream,
+    const VkDeviceGroupSubmitInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->waitSemaphoreCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pWaitSemaphoreDeviceIndices ? 1 : 0);
+    if (forMarshaling->pWaitSemaphoreDeviceIndices)
+    {
+        vkStream->write(forMarshaling->pWaitSemaphoreDeviceIndices, forMarshaling->waitSemaphoreCount * sizeof(uint32_t));
+    }
+    vkStream->write(&forMarshaling->commandBufferCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pCommandBufferDeviceMasks ? 1 : 0);
+    if (forMarshaling->pCommandBufferDeviceMasks)
+    {
+        vkStream->write(forMarshaling->pCommandBufferDeviceMasks, forMarshaling->commandBufferCount * sizeof(uint32_t));
+    }
+    vkStream->write(&forMarshaling->signalSemaphoreCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSignalSemaphoreDeviceIndices ? 1 : 0);
+    if (forMarshaling->pSignalSemaphoreDeviceIndices)
+    {
+        vkStream->write(forMarshaling->pSignalSemaphoreDeviceIndices, forMarshaling->signalSemaphoreCount * sizeof(uint32_t));
+    }
+}
+
+void unmarshal_VkDeviceGroupSubmitInfo(
+    VulkanStream* vkStream,
+    VkDeviceGroupSubmitInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->waitSemaphoreCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pWaitSemaphoreDeviceIndices = (uint32_t*)vkStream->allocArray(forUnmarshaling->waitSemaphoreCount, sizeof(uint32_t));
+        forUnmarshaling->pWaitSemaphoreDeviceIndices = pWaitSemaphoreDeviceIndices;
+        if (pWaitSemaphoreDeviceIndices)
+        {
+            vkStream->read(pWaitSemaphoreDeviceIndices, forUnmarshaling->waitSemaphoreCount * sizeof(uint32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->commandBufferCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pCommandBufferDeviceMasks = (uint32_t*)vkStream->allocArray(forUnmarshaling->commandBufferCount, sizeof(uint32_t));
+        forUnmarshaling->pCommandBufferDeviceMasks = pCommandBufferDeviceMasks;
+        if (pCommandBufferDeviceMasks)
+        {
+            vkStream->read(pCommandBufferDeviceMasks, forUnmarshaling->commandBufferCount * sizeof(uint32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->signalSemaphoreCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pSignalSemaphoreDeviceIndices = (uint32_t*)vkStream->allocArray(forUnmarshaling->signalSemaphoreCount, sizeof(uint32_t));
+        forUnmarshaling->pSignalSemaphoreDeviceIndices = pSignalSemaphoreDeviceIndices;
+        if (pSignalSemaphoreDeviceIndices)
+        {
+            vkStream->read(pSignalSemaphoreDeviceIndices, forUnmarshaling->signalSemaphoreCount * sizeof(uint32_t));
+        }
+    }
+}
+
+
+void marshal_VkDeviceGroupBindSparseInfo(
+    VulkanStream* vkStream,
+    const VkDeviceGroupBindSparseInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->resourceDeviceIndex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->memoryDeviceIndex, sizeof(uint32_t));
+}
+
+void unmarshal_VkDeviceGroupBindSparseInfo(
+    VulkanStream* vkStream,
+    VkDeviceGroupBindSparseInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->resourceDeviceIndex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->memoryDeviceIndex, sizeof(uint32_t));
+}
+
+
+void marshal_VkBindBufferMemoryDeviceGroupInfo(
+    VulkanStream* vkStream,
+    const VkBindBufferMemoryDeviceGroupInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->deviceIndexCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDeviceIndices ? 1 : 0);
+    if (forMarshaling->pDeviceIndices)
+    {
+        vkStream->write(forMarshaling->pDeviceIndices, forMarshaling->deviceIndexCount * sizeof(uint32_t));
+    }
+}
+
+void unmarshal_VkBindBufferMemoryDeviceGroupInfo(
+    VulkanStream* vkStream,
+    VkBindBufferMemoryDeviceGroupInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->deviceIndexCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pDeviceIndices = (uint32_t*)vkStream->allocArray(forUnmarshaling->deviceIndexCount, sizeof(uint32_t));
+        forUnmarshaling->pDeviceIndices = pDeviceIndices;
+        if (pDeviceIndices)
+        {
+            vkStream->read(pDeviceIndices, forUnmarshaling->deviceIndexCount * sizeof(uint32_t));
+        }
+    }
+}
+
+
+void marshal_VkBindImageMemoryDeviceGroupInfo(
+    VulkanStream* vkStream,
+    const VkBindImageMemoryDeviceGroupInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->deviceIndexCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDeviceIndices ? 1 : 0);
+    if (forMarshaling->pDeviceIndices)
+    {
+        vkStream->write(forMarshaling->pDeviceIndices, forMarshaling->deviceIndexCount * sizeof(uint32_t));
+    }
+    vkStream->write(&forMarshaling->splitInstanceBindRegionCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSplitInstanceBindRegions ? 1 : 0);
+    if (forMarshaling->pSplitInstanceBindRegions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->splitInstanceBindRegionCount; ++i)
+        {
+            marshal_VkRect2D(vkStream, forMarshaling->pSplitInstanceBindRegions + i);
+        }
+    }
+}
+
+void unmarshal_VkBindImageMemoryDeviceGroupInfo(
+    VulkanStream* vkStream,
+    VkBindImageMemoryDeviceGroupInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->deviceIndexCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pDeviceIndices = (uint32_t*)vkStream->allocArray(forUnmarshaling->deviceIndexCount, sizeof(uint32_t));
+        forUnmarshaling->pDeviceIndices = pDeviceIndices;
+        if (pDeviceIndices)
+        {
+            vkStream->read(pDeviceIndices, forUnmarshaling->deviceIndexCount * sizeof(uint32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->splitInstanceBindRegionCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkRect2D* pSplitInstanceBindRegions = (VkRect2D*)vkStream->allocArray(forUnmarshaling->splitInstanceBindRegionCount, sizeof(VkRect2D));
+        forUnmarshaling->pSplitInstanceBindRegions = pSplitInstanceBindRegions;
+        if (pSplitInstanceBindRegions)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->splitInstanceBindRegionCount; ++i)
+            {
+                unmarshal_VkRect2D(vkStream, pSplitInstanceBindRegions + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkPhysicalDeviceGroupProperties(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceGroupProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->physicalDeviceCount, sizeof(uint32_t));
+    for (uint32_t i = 0; i < (uint32_t)VK_MAX_DEVICE_GROUP_SIZE; ++i)
+    {
+        vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(forMarshaling->physicalDevices[i]));
+    }
+    vkStream->write(&forMarshaling->subsetAllocation, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceGroupProperties(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceGroupProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->physicalDeviceCount, sizeof(uint32_t));
+    for (uint32_t i = 0; i < (uint32_t)VK_MAX_DEVICE_GROUP_SIZE; ++i)
+    {
+        forUnmarshaling->physicalDevices[i] = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+    }
+    vkStream->read(&forUnmarshaling->subsetAllocation, sizeof(VkBool32));
+}
+
+
+void marshal_VkDeviceGroupDeviceCreateInfo(
+    VulkanStream* vkStream,
+    const VkDeviceGroupDeviceCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->physicalDeviceCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pPhysicalDevices ? 1 : 0);
+    if (forMarshaling->pPhysicalDevices)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->physicalDeviceCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(forMarshaling->pPhysicalDevices[i]));
+        }
+    }
+}
+
+void unmarshal_VkDeviceGroupDeviceCreateInfo(
+    VulkanStream* vkStream,
+    VkDeviceGroupDeviceCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->physicalDeviceCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkPhysicalDevice* pPhysicalDevices = (VkPhysicalDevice*)vkStream->allocArray(forUnmarshaling->physicalDeviceCount, sizeof(VkPhysicalDevice));
+        forUnmarshaling->pPhysicalDevices = pPhysicalDevices;
+        if (pPhysicalDevices)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->physicalDeviceCount; ++i)
+            {
+                pPhysicalDevices[i] = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+            }
+        }
+    }
+}
+
+
+void marshal_VkBufferMemoryRequirementsInfo2(
+    VulkanStream* vkStream,
+    const VkBufferMemoryRequirementsInfo2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+}
+
+void unmarshal_VkBufferMemoryRequirementsInfo2(
+    VulkanStream* vkStream,
+    VkBufferMemoryRequirementsInfo2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkImageMemoryRequirementsInfo2(
+    VulkanStream* vkStream,
+    const VkImageMemoryRequirementsInfo2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(forMarshaling->image));
+}
+
+void unmarshal_VkImageMemoryRequirementsInfo2(
+    VulkanStream* vkStream,
+    VkImageMemoryRequirementsInfo2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkImageSparseMemoryRequirementsInfo2(
+    VulkanStream* vkStream,
+    const VkImageSparseMemoryRequirementsInfo2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(forMarshaling->image));
+}
+
+void unmarshal_VkImageSparseMemoryRequirementsInfo2(
+    VulkanStream* vkStream,
+    VkImageSparseMemoryRequirementsInfo2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkMemoryRequirements2(
+    VulkanStream* vkStream,
+    const VkMemoryRequirements2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkMemoryRequirements(vkStream, &forMarshaling->memoryRequirements);
+}
+
+void unmarshal_VkMemoryRequirements2(
+    VulkanStream* vkStream,
+    VkMemoryRequirements2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkMemoryRequirements(vkStream, &forUnmarshaling->memoryRequirements);
+}
+
+
+void marshal_VkSparseImageMemoryRequirements2(
+    VulkanStream* vkStream,
+    const VkSparseImageMemoryRequirements2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkSparseImageMemoryRequirements(vkStream, &forMarshaling->memoryRequirements);
+}
+
+void unmarshal_VkSparseImageMemoryRequirements2(
+    VulkanStream* vkStream,
+    VkSparseImageMemoryRequirements2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkSparseImageMemoryRequirements(vkStream, &forUnmarshaling->memoryRequirements);
+}
+
+
+void marshal_VkPhysicalDeviceFeatures2(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceFeatures2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkPhysicalDeviceFeatures(vkStream, &forMarshaling->features);
+}
+
+void unmarshal_VkPhysicalDeviceFeatures2(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceFeatures2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkPhysicalDeviceFeatures(vkStream, &forUnmarshaling->features);
+}
+
+
+void marshal_VkPhysicalDeviceProperties2(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceProperties2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkPhysicalDeviceProperties(vkStream, &forMarshaling->properties);
+}
+
+void unmarshal_VkPhysicalDeviceProperties2(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceProperties2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkPhysicalDeviceProperties(vkStream, &forUnmarshaling->properties);
+}
+
+
+void marshal_VkFormatProperties2(
+    VulkanStream* vkStream,
+    const VkFormatProperties2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkFormatProperties(vkStream, &forMarshaling->formatProperties);
+}
+
+void unmarshal_VkFormatProperties2(
+    VulkanStream* vkStream,
+    VkFormatProperties2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkFormatProperties(vkStream, &forUnmarshaling->formatProperties);
+}
+
+
+void marshal_VkImageFormatProperties2(
+    VulkanStream* vkStream,
+    const VkImageFormatProperties2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkImageFormatProperties(vkStream, &forMarshaling->imageFormatProperties);
+}
+
+void unmarshal_VkImageFormatProperties2(
+    VulkanStream* vkStream,
+    VkImageFormatProperties2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkImageFormatProperties(vkStream, &forUnmarshaling->imageFormatProperties);
+}
+
+
+void marshal_VkPhysicalDeviceImageFormatInfo2(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceImageFormatInfo2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->type, sizeof(VkImageType));
+    vkStream->write(&forMarshaling->tiling, sizeof(VkImageTiling));
+    vkStream->write(&forMarshaling->usage, sizeof(VkImageUsageFlags));
+    vkStream->write(&forMarshaling->flags, sizeof(VkImageCreateFlags));
+}
+
+void unmarshal_VkPhysicalDeviceImageFormatInfo2(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceImageFormatInfo2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->type, sizeof(VkImageType));
+    vkStream->read(&forUnmarshaling->tiling, sizeof(VkImageTiling));
+    vkStream->read(&forUnmarshaling->usage, sizeof(VkImageUsageFlags));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkImageCreateFlags));
+}
+
+
+void marshal_VkQueueFamilyProperties2(
+    VulkanStream* vkStream,
+    const VkQueueFamilyProperties2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkQueueFamilyProperties(vkStream, &forMarshaling->queueFamilyProperties);
+}
+
+void unmarshal_VkQueueFamilyProperties2(
+    VulkanStream* vkStream,
+    VkQueueFamilyProperties2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkQueueFamilyProperties(vkStream, &forUnmarshaling->queueFamilyProperties);
+}
+
+
+void marshal_VkPhysicalDeviceMemoryProperties2(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceMemoryProperties2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkPhysicalDeviceMemoryProperties(vkStream, &forMarshaling->memoryProperties);
+}
+
+void unmarshal_VkPhysicalDeviceMemoryProperties2(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceMemoryProperties2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkPhysicalDeviceMemoryProperties(vkStream, &forUnmarshaling->memoryProperties);
+}
+
+
+void marshal_VkSparseImageFormatProperties2(
+    VulkanStream* vkStream,
+    const VkSparseImageFormatProperties2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkSparseImageFormatProperties(vkStream, &forMarshaling->properties);
+}
+
+void unmarshal_VkSparseImageFormatProperties2(
+    VulkanStream* vkStream,
+    VkSparseImageFormatProperties2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkSparseImageFormatProperties(vkStream, &forUnmarshaling->properties);
+}
+
+
+void marshal_VkPhysicalDeviceSparseImageFormatInfo2(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceSparseImageFormatInfo2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->type, sizeof(VkImageType));
+    vkStream->write(&forMarshaling->samples, sizeof(VkSampleCountFlagBits));
+    vkStream->write(&forMarshaling->usage, sizeof(VkImageUsageFlags));
+    vkStream->write(&forMarshaling->tiling, sizeof(VkImageTiling));
+}
+
+void unmarshal_VkPhysicalDeviceSparseImageFormatInfo2(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceSparseImageFormatInfo2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->type, sizeof(VkImageType));
+    vkStream->read(&forUnmarshaling->samples, sizeof(VkSampleCountFlagBits));
+    vkStream->read(&forUnmarshaling->usage, sizeof(VkImageUsageFlags));
+    vkStream->read(&forUnmarshaling->tiling, sizeof(VkImageTiling));
+}
+
+
+void marshal_VkPhysicalDevicePointClippingProperties(
+    VulkanStream* vkStream,
+    const VkPhysicalDevicePointClippingProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->pointClippingBehavior, sizeof(VkPointClippingBehavior));
+}
+
+void unmarshal_VkPhysicalDevicePointClippingProperties(
+    VulkanStream* vkStream,
+    VkPhysicalDevicePointClippingProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->pointClippingBehavior, sizeof(VkPointClippingBehavior));
+}
+
+
+void marshal_VkInputAttachmentAspectReference(
+    VulkanStream* vkStream,
+    const VkInputAttachmentAspectReference* forMarshaling)
+{
+    vkStream->write(&forMarshaling->subpass, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->inputAttachmentIndex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->aspectMask, sizeof(VkImageAspectFlags));
+}
+
+void unmarshal_VkInputAttachmentAspectReference(
+    VulkanStream* vkStream,
+    VkInputAttachmentAspectReference* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->subpass, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->inputAttachmentIndex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->aspectMask, sizeof(VkImageAspectFlags));
+}
+
+
+void marshal_VkRenderPassInputAttachmentAspectCreateInfo(
+    VulkanStream* vkStream,
+    const VkRenderPassInputAttachmentAspectCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->aspectReferenceCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pAspectReferences ? 1 : 0);
+    if (forMarshaling->pAspectReferences)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->aspectReferenceCount; ++i)
+        {
+            marshal_VkInputAttachmentAspectReference(vkStream, forMarshaling->pAspectReferences + i);
+        }
+    }
+}
+
+void unmarshal_VkRenderPassInputAttachmentAspectCreateInfo(
+    VulkanStream* vkStream,
+    VkRenderPassInputAttachmentAspectCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->aspectReferenceCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkInputAttachmentAspectReference* pAspectReferences = (VkInputAttachmentAspectReference*)vkStream->allocArray(forUnmarshaling->aspectReferenceCount, sizeof(VkInputAttachmentAspectReference));
+        forUnmarshaling->pAspectReferences = pAspectReferences;
+        if (pAspectReferences)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->aspectReferenceCount; ++i)
+            {
+                unmarshal_VkInputAttachmentAspectReference(vkStream, pAspectReferences + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkImageViewUsageCreateInfo(
+    VulkanStream* vkStream,
+    const VkImageViewUsageCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->usage, sizeof(VkImageUsageFlags));
+}
+
+void unmarshal_VkImageViewUsageCreateInfo(
+    VulkanStream* vkStream,
+    VkImageViewUsageCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->usage, sizeof(VkImageUsageFlags));
+}
+
+
+void marshal_VkPipelineTessellationDomainOriginStateCreateInfo(
+    VulkanStream* vkStream,
+    const VkPipelineTessellationDomainOriginStateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->domainOrigin, sizeof(VkTessellationDomainOrigin));
+}
+
+void unmarshal_VkPipelineTessellationDomainOriginStateCreateInfo(
+    VulkanStream* vkStream,
+    VkPipelineTessellationDomainOriginStateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->domainOrigin, sizeof(VkTessellationDomainOrigin));
+}
+
+
+void marshal_VkRenderPassMultiviewCreateInfo(
+    VulkanStream* vkStream,
+    const VkRenderPassMultiviewCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->subpassCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pViewMasks ? 1 : 0);
+    if (forMarshaling->pViewMasks)
+    {
+        vkStream->write(forMarshaling->pViewMasks, forMarshaling->subpassCount * sizeof(uint32_t));
+    }
+    vkStream->write(&forMarshaling->dependencyCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pViewOffsets ? 1 : 0);
+    if (forMarshaling->pViewOffsets)
+    {
+        vkStream->write(forMarshaling->pViewOffsets, forMarshaling->dependencyCount * sizeof(int32_t));
+    }
+    vkStream->write(&forMarshaling->correlationMaskCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pCorrelationMasks ? 1 : 0);
+    if (forMarshaling->pCorrelationMasks)
+    {
+        vkStream->write(forMarshaling->pCorrelationMasks, forMarshaling->correlationMaskCount * sizeof(uint32_t));
+    }
+}
+
+void unmarshal_VkRenderPassMultiviewCreateInfo(
+    VulkanStream* vkStream,
+    VkRenderPassMultiviewCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->subpassCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pViewMasks = (uint32_t*)vkStream->allocArray(forUnmarshaling->subpassCount, sizeof(uint32_t));
+        forUnmarshaling->pViewMasks = pViewMasks;
+        if (pViewMasks)
+        {
+            vkStream->read(pViewMasks, forUnmarshaling->subpassCount * sizeof(uint32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->dependencyCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        int32_t* pViewOffsets = (int32_t*)vkStream->allocArray(forUnmarshaling->dependencyCount, sizeof(int32_t));
+        forUnmarshaling->pViewOffsets = pViewOffsets;
+        if (pViewOffsets)
+        {
+            vkStream->read(pViewOffsets, forUnmarshaling->dependencyCount * sizeof(int32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->correlationMaskCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pCorrelationMasks = (uint32_t*)vkStream->allocArray(forUnmarshaling->correlationMaskCount, sizeof(uint32_t));
+        forUnmarshaling->pCorrelationMasks = pCorrelationMasks;
+        if (pCorrelationMasks)
+        {
+            vkStream->read(pCorrelationMasks, forUnmarshaling->correlationMaskCount * sizeof(uint32_t));
+        }
+    }
+}
+
+
+void marshal_VkPhysicalDeviceMultiviewFeatures(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceMultiviewFeatures* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->multiview, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->multiviewGeometryShader, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->multiviewTessellationShader, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceMultiviewFeatures(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceMultiviewFeatures* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->multiview, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->multiviewGeometryShader, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->multiviewTessellationShader, sizeof(VkBool32));
+}
+
+
+void marshal_VkPhysicalDeviceMultiviewProperties(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceMultiviewProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->maxMultiviewViewCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxMultiviewInstanceIndex, sizeof(uint32_t));
+}
+
+void unmarshal_VkPhysicalDeviceMultiviewProperties(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceMultiviewProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->maxMultiviewViewCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxMultiviewInstanceIndex, sizeof(uint32_t));
+}
+
+
+void marshal_VkPhysicalDeviceVariablePointerFeatures(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceVariablePointerFeatures* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->variablePointersStorageBuffer, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->variablePointers, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceVariablePointerFeatures(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceVariablePointerFeatures* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->variablePointersStorageBuffer, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->variablePointers, sizeof(VkBool32));
+}
+
+
+void marshal_VkPhysicalDeviceProtectedMemoryFeatures(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceProtectedMemoryFeatures* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->protectedMemory, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceProtectedMemoryFeatures(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceProtectedMemoryFeatures* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->protectedMemory, sizeof(VkBool32));
+}
+
+
+void marshal_VkPhysicalDeviceProtectedMemoryProperties(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceProtectedMemoryProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->protectedNoFault, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceProtectedMemoryProperties(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceProtectedMemoryProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->protectedNoFault, sizeof(VkBool32));
+}
+
+
+void marshal_VkDeviceQueueInfo2(
+    VulkanStream* vkStream,
+    const VkDeviceQueueInfo2* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkDeviceQueueCreateFlags));
+    vkStream->write(&forMarshaling->queueFamilyIndex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->queueIndex, sizeof(uint32_t));
+}
+
+void unmarshal_VkDeviceQueueInfo2(
+    VulkanStream* vkStream,
+    VkDeviceQueueInfo2* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkDeviceQueueCreateFlags));
+    vkStream->read(&forUnmarshaling->queueFamilyIndex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->queueIndex, sizeof(uint32_t));
+}
+
+
+void marshal_VkProtectedSubmitInfo(
+    VulkanStream* vkStream,
+    const VkProtectedSubmitInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->protectedSubmit, sizeof(VkBool32));
+}
+
+void unmarshal_VkProtectedSubmitInfo(
+    VulkanStream* vkStream,
+    VkProtectedSubmitInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->protectedSubmit, sizeof(VkBool32));
+}
+
+
+void marshal_VkSamplerYcbcrConversionCreateInfo(
+    VulkanStream* vkStream,
+    const VkSamplerYcbcrConversionCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->ycbcrModel, sizeof(VkSamplerYcbcrModelConversion));
+    vkStream->write(&forMarshaling->ycbcrRange, sizeof(VkSamplerYcbcrRange));
+    marshal_VkComponentMapping(vkStream, &forMarshaling->components);
+    vkStream->write(&forMarshaling->xChromaOffset, sizeof(VkChromaLocation));
+    vkStream->write(&forMarshaling->yChromaOffset, sizeof(VkChromaLocation));
+    vkStream->write(&forMarshaling->chromaFilter, sizeof(VkFilter));
+    vkStream->write(&forMarshaling->forceExplicitReconstruction, sizeof(VkBool32));
+}
+
+void unmarshal_VkSamplerYcbcrConversionCreateInfo(
+    VulkanStream* vkStream,
+    VkSamplerYcbcrConversionCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->ycbcrModel, sizeof(VkSamplerYcbcrModelConversion));
+    vkStream->read(&forUnmarshaling->ycbcrRange, sizeof(VkSamplerYcbcrRange));
+    unmarshal_VkComponentMapping(vkStream, &forUnmarshaling->components);
+    vkStream->read(&forUnmarshaling->xChromaOffset, sizeof(VkChromaLocation));
+    vkStream->read(&forUnmarshaling->yChromaOffset, sizeof(VkChromaLocation));
+    vkStream->read(&forUnmarshaling->chromaFilter, sizeof(VkFilter));
+    vkStream->read(&forUnmarshaling->forceExplicitReconstruction, sizeof(VkBool32));
+}
+
+
+void marshal_VkSamplerYcbcrConversionInfo(
+    VulkanStream* vkStream,
+    const VkSamplerYcbcrConversionInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSamplerYcbcrConversion(forMarshaling->conversion));
+}
+
+void unmarshal_VkSamplerYcbcrConversionInfo(
+    VulkanStream* vkStream,
+    VkSamplerYcbcrConversionInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->conversion = vkStream->handleMapping()->fromWire_VkSamplerYcbcrConversion(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkBindImagePlaneMemoryInfo(
+    VulkanStream* vkStream,
+    const VkBindImagePlaneMemoryInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->planeAspect, sizeof(VkImageAspectFlagBits));
+}
+
+void unmarshal_VkBindImagePlaneMemoryInfo(
+    VulkanStream* vkStream,
+    VkBindImagePlaneMemoryInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->planeAspect, sizeof(VkImageAspectFlagBits));
+}
+
+
+void marshal_VkImagePlaneMemoryRequirementsInfo(
+    VulkanStream* vkStream,
+    const VkImagePlaneMemoryRequirementsInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->planeAspect, sizeof(VkImageAspectFlagBits));
+}
+
+void unmarshal_VkImagePlaneMemoryRequirementsInfo(
+    VulkanStream* vkStream,
+    VkImagePlaneMemoryRequirementsInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->planeAspect, sizeof(VkImageAspectFlagBits));
+}
+
+
+void marshal_VkPhysicalDeviceSamplerYcbcrConversionFeatures(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceSamplerYcbcrConversionFeatures* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->samplerYcbcrConversion, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceSamplerYcbcrConversionFeatures(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceSamplerYcbcrConversionFeatures* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->samplerYcbcrConversion, sizeof(VkBool32));
+}
+
+
+void marshal_VkSamplerYcbcrConversionImageFormatProperties(
+    VulkanStream* vkStream,
+    const VkSamplerYcbcrConversionImageFormatProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->combinedImageSamplerDescriptorCount, sizeof(uint32_t));
+}
+
+void unmarshal_VkSamplerYcbcrConversionImageFormatProperties(
+    VulkanStream* vkStream,
+    VkSamplerYcbcrConversionImageFormatProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->combinedImageSamplerDescriptorCount, sizeof(uint32_t));
+}
+
+
+void marshal_VkDescriptorUpdateTemplateEntry(
+    VulkanStream* vkStream,
+    const VkDescriptorUpdateTemplateEntry* forMarshaling)
+{
+    vkStream->write(&forMarshaling->dstBinding, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->dstArrayElement, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->descriptorCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->descriptorType, sizeof(VkDescriptorType));
+    vkStream->putU64((uint64_t)forMarshaling->offset);
+    vkStream->putU64((uint64_t)forMarshaling->stride);
+}
+
+void unmarshal_VkDescriptorUpdateTemplateEntry(
+    VulkanStream* vkStream,
+    VkDescriptorUpdateTemplateEntry* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->dstBinding, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->dstArrayElement, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->descriptorCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->descriptorType, sizeof(VkDescriptorType));
+    forUnmarshaling->offset = (size_t)vkStream->getU64();
+    forUnmarshaling->stride = (size_t)vkStream->getU64();
+}
+
+
+void marshal_VkDescriptorUpdateTemplateCreateInfo(
+    VulkanStream* vkStream,
+    const VkDescriptorUpdateTemplateCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkDescriptorUpdateTemplateCreateFlags));
+    vkStream->write(&forMarshaling->descriptorUpdateEntryCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDescriptorUpdateEntries ? 1 : 0);
+    if (forMarshaling->pDescriptorUpdateEntries)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->descriptorUpdateEntryCount; ++i)
+        {
+            marshal_VkDescriptorUpdateTemplateEntry(vkStream, forMarshaling->pDescriptorUpdateEntries + i);
+        }
+    }
+    vkStream->write(&forMarshaling->templateType, sizeof(VkDescriptorUpdateTemplateType));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSetLayout(forMarshaling->descriptorSetLayout));
+    vkStream->write(&forMarshaling->pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(forMarshaling->pipelineLayout));
+    vkStream->write(&forMarshaling->set, sizeof(uint32_t));
+}
+
+void unmarshal_VkDescriptorUpdateTemplateCreateInfo(
+    VulkanStream* vkStream,
+    VkDescriptorUpdateTemplateCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkDescriptorUpdateTemplateCreateFlags));
+    vkStream->read(&forUnmarshaling->descriptorUpdateEntryCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDescriptorUpdateTemplateEntry* pDescriptorUpdateEntries = (VkDescriptorUpdateTemplateEntry*)vkStream->allocArray(forUnmarshaling->descriptorUpdateEntryCount, sizeof(VkDescriptorUpdateTemplateEntry));
+        forUnmarshaling->pDescriptorUpdateEntries = pDescriptorUpdateEntries;
+        if (pDescriptorUpdateEntries)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->descriptorUpdateEntryCount; ++i)
+            {
+                unmarshal_VkDescriptorUpdateTemplateEntry(vkStream, pDescriptorUpdateEntries + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->templateType, sizeof(VkDescriptorUpdateTemplateType));
+    forUnmarshaling->descriptorSetLayout = vkStream->handleMapping()->fromWire_VkDescriptorSetLayout(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    forUnmarshaling->pipelineLayout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->set, sizeof(uint32_t));
+}
+
+
+void marshal_VkExternalMemoryProperties(
+    VulkanStream* vkStream,
+    const VkExternalMemoryProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->externalMemoryFeatures, sizeof(VkExternalMemoryFeatureFlags));
+    vkStream->write(&forMarshaling->exportFromImportedHandleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+    vkStream->write(&forMarshaling->compatibleHandleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+}
+
+void unmarshal_VkExternalMemoryProperties(
+    VulkanStream* vkStream,
+    VkExternalMemoryProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->externalMemoryFeatures, sizeof(VkExternalMemoryFeatureFlags));
+    vkStream->read(&forUnmarshaling->exportFromImportedHandleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+    vkStream->read(&forUnmarshaling->compatibleHandleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+}
+
+
+void marshal_VkPhysicalDeviceExternalImageFormatInfo(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceExternalImageFormatInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+}
+
+void unmarshal_VkPhysicalDeviceExternalImageFormatInfo(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceExternalImageFormatInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+}
+
+
+void marshal_VkExternalImageFormatProperties(
+    VulkanStream* vkStream,
+    const VkExternalImageFormatProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkExternalMemoryProperties(vkStream, &forMarshaling->externalMemoryProperties);
+}
+
+void unmarshal_VkExternalImageFormatProperties(
+    VulkanStream* vkStream,
+    VkExternalImageFormatProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkExternalMemoryProperties(vkStream, &forUnmarshaling->externalMemoryProperties);
+}
+
+
+void marshal_VkPhysicalDeviceExternalBufferInfo(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceExternalBufferInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkBufferCreateFlags));
+    vkStream->write(&forMarshaling->usage, sizeof(VkBufferUsageFlags));
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+}
+
+void unmarshal_VkPhysicalDeviceExternalBufferInfo(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceExternalBufferInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkBufferCreateFlags));
+    vkStream->read(&forUnmarshaling->usage, sizeof(VkBufferUsageFlags));
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+}
+
+
+void marshal_VkExternalBufferProperties(
+    VulkanStream* vkStream,
+    const VkExternalBufferProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkExternalMemoryProperties(vkStream, &forMarshaling->externalMemoryProperties);
+}
+
+void unmarshal_VkExternalBufferProperties(
+    VulkanStream* vkStream,
+    VkExternalBufferProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkExternalMemoryProperties(vkStream, &forUnmarshaling->externalMemoryProperties);
+}
+
+
+void marshal_VkPhysicalDeviceIDProperties(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceIDProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(forMarshaling->deviceUUID, VK_UUID_SIZE * sizeof(uint8_t));
+    vkStream->write(forMarshaling->driverUUID, VK_UUID_SIZE * sizeof(uint8_t));
+    vkStream->write(forMarshaling->deviceLUID, VK_LUID_SIZE * sizeof(uint8_t));
+    vkStream->write(&forMarshaling->deviceNodeMask, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->deviceLUIDValid, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceIDProperties(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceIDProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(forUnmarshaling->deviceUUID, VK_UUID_SIZE * sizeof(uint8_t));
+    vkStream->read(forUnmarshaling->driverUUID, VK_UUID_SIZE * sizeof(uint8_t));
+    vkStream->read(forUnmarshaling->deviceLUID, VK_LUID_SIZE * sizeof(uint8_t));
+    vkStream->read(&forUnmarshaling->deviceNodeMask, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->deviceLUIDValid, sizeof(VkBool32));
+}
+
+
+void marshal_VkExternalMemoryImageCreateInfo(
+    VulkanStream* vkStream,
+    const VkExternalMemoryImageCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+}
+
+void unmarshal_VkExternalMemoryImageCreateInfo(
+    VulkanStream* vkStream,
+    VkExternalMemoryImageCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+}
+
+
+void marshal_VkExternalMemoryBufferCreateInfo(
+    VulkanStream* vkStream,
+    const VkExternalMemoryBufferCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+}
+
+void unmarshal_VkExternalMemoryBufferCreateInfo(
+    VulkanStream* vkStream,
+    VkExternalMemoryBufferCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+}
+
+
+void marshal_VkExportMemoryAllocateInfo(
+    VulkanStream* vkStream,
+    const VkExportMemoryAllocateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+}
+
+void unmarshal_VkExportMemoryAllocateInfo(
+    VulkanStream* vkStream,
+    VkExportMemoryAllocateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlags));
+}
+
+
+void marshal_VkPhysicalDeviceExternalFenceInfo(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceExternalFenceInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalFenceHandleTypeFlagBits));
+}
+
+void unmarshal_VkPhysicalDeviceExternalFenceInfo(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceExternalFenceInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalFenceHandleTypeFlagBits));
+}
+
+
+void marshal_VkExternalFenceProperties(
+    VulkanStream* vkStream,
+    const VkExternalFenceProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->exportFromImportedHandleTypes, sizeof(VkExternalFenceHandleTypeFlags));
+    vkStream->write(&forMarshaling->compatibleHandleTypes, sizeof(VkExternalFenceHandleTypeFlags));
+    vkStream->write(&forMarshaling->externalFenceFeatures, sizeof(VkExternalFenceFeatureFlags));
+}
+
+void unmarshal_VkExternalFenceProperties(
+    VulkanStream* vkStream,
+    VkExternalFenceProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->exportFromImportedHandleTypes, sizeof(VkExternalFenceHandleTypeFlags));
+    vkStream->read(&forUnmarshaling->compatibleHandleTypes, sizeof(VkExternalFenceHandleTypeFlags));
+    vkStream->read(&forUnmarshaling->externalFenceFeatures, sizeof(VkExternalFenceFeatureFlags));
+}
+
+
+void marshal_VkExportFenceCreateInfo(
+    VulkanStream* vkStream,
+    const VkExportFenceCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleTypes, sizeof(VkExternalFenceHandleTypeFlags));
+}
+
+void unmarshal_VkExportFenceCreateInfo(
+    VulkanStream* vkStream,
+    VkExportFenceCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleTypes, sizeof(VkExternalFenceHandleTypeFlags));
+}
+
+
+void marshal_VkExportSemaphoreCreateInfo(
+    VulkanStream* vkStream,
+    const VkExportSemaphoreCreateInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleTypes, sizeof(VkExternalSemaphoreHandleTypeFlags));
+}
+
+void unmarshal_VkExportSemaphoreCreateInfo(
+    VulkanStream* vkStream,
+    VkExportSemaphoreCreateInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleTypes, sizeof(VkExternalSemaphoreHandleTypeFlags));
+}
+
+
+void marshal_VkPhysicalDeviceExternalSemaphoreInfo(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceExternalSemaphoreInfo* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalSemaphoreHandleTypeFlagBits));
+}
+
+void unmarshal_VkPhysicalDeviceExternalSemaphoreInfo(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceExternalSemaphoreInfo* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalSemaphoreHandleTypeFlagBits));
+}
+
+
+void marshal_VkExternalSemaphoreProperties(
+    VulkanStream* vkStream,
+    const VkExternalSemaphoreProperties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->exportFromImportedHandleTypes, sizeof(VkExternalSemaphoreHandleTypeFlags));
+    vkStream->write(&forMarshaling->compatibleHandleTypes, sizeof(VkExternalSemaphoreHandleTypeFlags));
+    vkStream->write(&forMarshaling->externalSemaphoreFeatures, sizeof(VkExternalSemaphoreFeatureFlags));
+}
+
+void unmarshal_VkExternalSemaphoreProperties(
+    VulkanStream* vkStream,
+    VkExternalSemaphoreProperties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->exportFromImportedHandleTypes, sizeof(VkExternalSemaphoreHandleTypeFlags));
+    vkStream->read(&forUnmarshaling->compatibleHandleTypes, sizeof(VkExternalSemaphoreHandleTypeFlags));
+    vkStream->read(&forUnmarshaling->externalSemaphoreFeatures, sizeof(VkExternalSemaphoreFeatureFlags));
+}
+
+
+void marshal_VkPhysicalDeviceMaintenance3Properties(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceMaintenance3Properties* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->maxPerSetDescriptors, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxMemoryAllocationSize, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkPhysicalDeviceMaintenance3Properties(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceMaintenance3Properties* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->maxPerSetDescriptors, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxMemoryAllocationSize, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkDescriptorSetLayoutSupport(
+    VulkanStream* vkStream,
+    const VkDescriptorSetLayoutSupport* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->supported, sizeof(VkBool32));
+}
+
+void unmarshal_VkDescriptorSetLayoutSupport(
+    VulkanStream* vkStream,
+    VkDescriptorSetLayoutSupport* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->supported, sizeof(VkBool32));
+}
+
+
+void marshal_VkPhysicalDeviceShaderDrawParameterFeatures(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceShaderDrawParameterFeatures* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->shaderDrawParameters, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceShaderDrawParameterFeatures(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceShaderDrawParameterFeatures* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->shaderDrawParameters, sizeof(VkBool32));
+}
+
+
+#endif
+
+#ifdef VK_KHR_surface
+
+void marshal_VkSurfaceCapabilitiesKHR(
+    VulkanStream* vkStream,
+    const VkSurfaceCapabilitiesKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->minImageCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxImageCount, sizeof(uint32_t));
+    marshal_VkExtent2D(vkStream, &forMarshaling->currentExtent);
+    marshal_VkExtent2D(vkStream, &forMarshaling->minImageExtent);
+    marshal_VkExtent2D(vkStream, &forMarshaling->maxImageExtent);
+    vkStream->write(&forMarshaling->maxImageArrayLayers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->supportedTransforms, sizeof(VkSurfaceTransformFlagsKHR));
+    vkStream->write(&forMarshaling->currentTransform, sizeof(VkSurfaceTransformFlagBitsKHR));
+    vkStream->write(&forMarshaling->supportedCompositeAlpha, sizeof(VkCompositeAlphaFlagsKHR));
+    vkStream->write(&forMarshaling->supportedUsageFlags, sizeof(VkImageUsageFlags));
+}
+
+void unmarshal_VkSurfaceCapabilitiesKHR(
+    VulkanStream* vkStream,
+    VkSurfaceCapabilitiesKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->minImageCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxImageCount, sizeof(uint32_t));
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->currentExtent);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->minImageExtent);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->maxImageExtent);
+    vkStream->read(&forUnmarshaling->maxImageArrayLayers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->supportedTransforms, sizeof(VkSurfaceTransformFlagsKHR));
+    vkStream->read(&forUnmarshaling->currentTransform, sizeof(VkSurfaceTransformFlagBitsKHR));
+    vkStream->read(&forUnmarshaling->supportedCompositeAlpha, sizeof(VkCompositeAlphaFlagsKHR));
+    vkStream->read(&forUnmarshaling->supportedUsageFlags, sizeof(VkImageUsageFlags));
+}
+
+
+void marshal_VkSurfaceFormatKHR(
+    VulkanStream* vkStream,
+    const VkSurfaceFormatKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->colorSpace, sizeof(VkColorSpaceKHR));
+}
+
+void unmarshal_VkSurfaceFormatKHR(
+    VulkanStream* vkStream,
+    VkSurfaceFormatKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->colorSpace, sizeof(VkColorSpaceKHR));
+}
+
+
+#endif
+
+#ifdef VK_KHR_swapchain
+
+void marshal_VkSwapchainCreateInfoKHR(
+    VulkanStream* vkStream,
+    const VkSwapchainCreateInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkSwapchainCreateFlagsKHR));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(forMarshaling->surface));
+    vkStream->write(&forMarshaling->minImageCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->imageFormat, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->imageColorSpace, sizeof(VkColorSpaceKHR));
+    marshal_VkExtent2D(vkStream, &forMarshaling->imageExtent);
+    vkStream->write(&forMarshaling->imageArrayLayers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->imageUsage, sizeof(VkImageUsageFlags));
+    vkStream->write(&forMarshaling->imageSharingMode, sizeof(VkSharingMode));
+    vkStream->write(&forMarshaling->queueFamilyIndexCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pQueueFamilyIndices ? 1 : 0);
+    if (forMarshaling->pQueueFamilyIndices)
+    {
+        vkStream->write(forMarshaling->pQueueFamilyIndices, forMarshaling->queueFamilyIndexCount * sizeof(uint32_t));
+    }
+    vkStream->write(&forMarshaling->preTransform, sizeof(VkSurfaceTransformFlagBitsKHR));
+    vkStream->write(&forMarshaling->compositeAlpha, sizeof(VkCompositeAlphaFlagBitsKHR));
+    vkStream->write(&forMarshaling->presentMode, sizeof(VkPresentModeKHR));
+    vkStream->write(&forMarshaling->clipped, sizeof(VkBool32));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(forMarshaling->oldSwapchain));
+}
+
+void unmarshal_VkSwapchainCreateInfoKHR(
+    VulkanStream* vkStream,
+    VkSwapchainCreateInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkSwapchainCreateFlagsKHR));
+    forUnmarshaling->surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->minImageCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->imageFormat, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->imageColorSpace, sizeof(VkColorSpaceKHR));
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->imageExtent);
+    vkStream->read(&forUnmarshaling->imageArrayLayers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->imageUsage, sizeof(VkImageUsageFlags));
+    vkStream->read(&forUnmarshaling->imageSharingMode, sizeof(VkSharingMode));
+    vkStream->read(&forUnmarshaling->queueFamilyIndexCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pQueueFamilyIndices = (uint32_t*)vkStream->allocArray(forUnmarshaling->queueFamilyIndexCount, sizeof(uint32_t));
+        forUnmarshaling->pQueueFamilyIndices = pQueueFamilyIndices;
+        if (pQueueFamilyIndices)
+        {
+            vkStream->read(pQueueFamilyIndices, forUnmarshaling->queueFamilyIndexCount * sizeof(uint32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->preTransform, sizeof(VkSurfaceTransformFlagBitsKHR));
+    vkStream->read(&forUnmarshaling->compositeAlpha, sizeof(VkCompositeAlphaFlagBitsKHR));
+    vkStream->read(&forUnmarshaling->presentMode, sizeof(VkPresentModeKHR));
+    vkStream->read(&forUnmarshaling->clipped, sizeof(VkBool32));
+    forUnmarshaling->oldSwapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkPresentInfoKHR(
+    VulkanStream* vkStream,
+    const VkPresentInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->waitSemaphoreCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pWaitSemaphores ? 1 : 0);
+    if (forMarshaling->pWaitSemaphores)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->waitSemaphoreCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(forMarshaling->pWaitSemaphores[i]));
+        }
+    }
+    vkStream->write(&forMarshaling->swapchainCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSwapchains ? 1 : 0);
+    if (forMarshaling->pSwapchains)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->swapchainCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(forMarshaling->pSwapchains[i]));
+        }
+    }
+    vkStream->putU32(forMarshaling->pImageIndices ? 1 : 0);
+    if (forMarshaling->pImageIndices)
+    {
+        vkStream->write(forMarshaling->pImageIndices, forMarshaling->swapchainCount * sizeof(uint32_t));
+    }
+    vkStream->putU32(forMarshaling->pResults ? 1 : 0);
+    if (forMarshaling->pResults)
+    {
+        vkStream->write(forMarshaling->pResults, forMarshaling->swapchainCount * sizeof(VkResult));
+    }
+}
+
+void unmarshal_VkPresentInfoKHR(
+    VulkanStream* vkStream,
+    VkPresentInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->waitSemaphoreCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSemaphore* pWaitSemaphores = (VkSemaphore*)vkStream->allocArray(forUnmarshaling->waitSemaphoreCount, sizeof(VkSemaphore));
+        forUnmarshaling->pWaitSemaphores = pWaitSemaphores;
+        if (pWaitSemaphores)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->waitSemaphoreCount; ++i)
+            {
+                pWaitSemaphores[i] = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->swapchainCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSwapchainKHR* pSwapchains = (VkSwapchainKHR*)vkStream->allocArray(forUnmarshaling->swapchainCount, sizeof(VkSwapchainKHR));
+        forUnmarshaling->pSwapchains = pSwapchains;
+        if (pSwapchains)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->swapchainCount; ++i)
+            {
+                pSwapchains[i] = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        uint32_t* pImageIndices = (uint32_t*)vkStream->allocArray(forUnmarshaling->swapchainCount, sizeof(uint32_t));
+        forUnmarshaling->pImageIndices = pImageIndices;
+        if (pImageIndices)
+        {
+            vkStream->read(pImageIndices, forUnmarshaling->swapchainCount * sizeof(uint32_t));
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkResult* pResults = (VkResult*)vkStream->allocArray(forUnmarshaling->swapchainCount, sizeof(VkResult));
+        forUnmarshaling->pResults = pResults;
+        if (pResults)
+        {
+            vkStream->read(pResults, forUnmarshaling->swapchainCount * sizeof(VkResult));
+        }
+    }
+}
+
+
+void marshal_VkImageSwapchainCreateInfoKHR(
+    VulkanStream* vkStream,
+    const VkImageSwapchainCreateInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(forMarshaling->swapchain));
+}
+
+void unmarshal_VkImageSwapchainCreateInfoKHR(
+    VulkanStream* vkStream,
+    VkImageSwapchainCreateInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkBindImageMemorySwapchainInfoKHR(
+    VulkanStream* vkStream,
+    const VkBindImageMemorySwapchainInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(forMarshaling->swapchain));
+    vkStream->write(&forMarshaling->imageIndex, sizeof(uint32_t));
+}
+
+void unmarshal_VkBindImageMemorySwapchainInfoKHR(
+    VulkanStream* vkStream,
+    VkBindImageMemorySwapchainInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->imageIndex, sizeof(uint32_t));
+}
+
+
+void marshal_VkAcquireNextImageInfoKHR(
+    VulkanStream* vkStream,
+    const VkAcquireNextImageInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(forMarshaling->swapchain));
+    vkStream->write(&forMarshaling->timeout, sizeof(uint64_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(forMarshaling->semaphore));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(forMarshaling->fence));
+    vkStream->write(&forMarshaling->deviceMask, sizeof(uint32_t));
+}
+
+void unmarshal_VkAcquireNextImageInfoKHR(
+    VulkanStream* vkStream,
+    VkAcquireNextImageInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->timeout, sizeof(uint64_t));
+    forUnmarshaling->semaphore = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+    forUnmarshaling->fence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->deviceMask, sizeof(uint32_t));
+}
+
+
+void marshal_VkDeviceGroupPresentCapabilitiesKHR(
+    VulkanStream* vkStream,
+    const VkDeviceGroupPresentCapabilitiesKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(forMarshaling->presentMask, VK_MAX_DEVICE_GROUP_SIZE * sizeof(uint32_t));
+    vkStream->write(&forMarshaling->modes, sizeof(VkDeviceGroupPresentModeFlagsKHR));
+}
+
+void unmarshal_VkDeviceGroupPresentCapabilitiesKHR(
+    VulkanStream* vkStream,
+    VkDeviceGroupPresentCapabilitiesKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(forUnmarshaling->presentMask, VK_MAX_DEVICE_GROUP_SIZE * sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->modes, sizeof(VkDeviceGroupPresentModeFlagsKHR));
+}
+
+
+void marshal_VkDeviceGroupPresentInfoKHR(
+    VulkanStream* vkStream,
+    const VkDeviceGroupPresentInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->swapchainCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDeviceMasks ? 1 : 0);
+    if (forMarshaling->pDeviceMasks)
+    {
+        vkStream->write(forMarshaling->pDeviceMasks, forMarshaling->swapchainCount * sizeof(uint32_t));
+    }
+    vkStream->write(&forMarshaling->mode, sizeof(VkDeviceGroupPresentModeFlagBitsKHR));
+}
+
+void unmarshal_VkDeviceGroupPresentInfoKHR(
+    VulkanStream* vkStream,
+    VkDeviceGroupPresentInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->swapchainCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pDeviceMasks = (uint32_t*)vkStream->allocArray(forUnmarshaling->swapchainCount, sizeof(uint32_t));
+        forUnmarshaling->pDeviceMasks = pDeviceMasks;
+        if (pDeviceMasks)
+        {
+            vkStream->read(pDeviceMasks, forUnmarshaling->swapchainCount * sizeof(uint32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->mode, sizeof(VkDeviceGroupPresentModeFlagBitsKHR));
+}
+
+
+void marshal_VkDeviceGroupSwapchainCreateInfoKHR(
+    VulkanStream* vkStream,
+    const VkDeviceGroupSwapchainCreateInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->modes, sizeof(VkDeviceGroupPresentModeFlagsKHR));
+}
+
+void unmarshal_VkDeviceGroupSwapchainCreateInfoKHR(
+    VulkanStream* vkStream,
+    VkDeviceGroupSwapchainCreateInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->modes, sizeof(VkDeviceGroupPresentModeFlagsKHR));
+}
+
+
+#endif
+
+#ifdef VK_KHR_display
+
+void marshal_VkDisplayPropertiesKHR(
+    VulkanStream* vkStream,
+    const VkDisplayPropertiesKHR* forMarshaling)
+{
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayKHR(forMarshaling->display));
+    vkStream->putString(forMarshaling->displayName);
+    marshal_VkExtent2D(vkStream, &forMarshaling->physicalDimensions);
+    marshal_VkExtent2D(vkStream, &forMarshaling->physicalResolution);
+    vkStream->write(&forMarshaling->supportedTransforms, sizeof(VkSurfaceTransformFlagsKHR));
+    vkStream->write(&forMarshaling->planeReorderPossible, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->persistentContent, sizeof(VkBool32));
+}
+
+void unmarshal_VkDisplayPropertiesKHR(
+    VulkanStream* vkStream,
+    VkDisplayPropertiesKHR* forUnmarshaling)
+{
+    forUnmarshaling->display = vkStream->handleMapping()->fromWire_VkDisplayKHR(vkStream, vkStream->getU64());
+    forUnmarshaling->displayName = vkStream->getString();
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->physicalDimensions);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->physicalResolution);
+    vkStream->read(&forUnmarshaling->supportedTransforms, sizeof(VkSurfaceTransformFlagsKHR));
+    vkStream->read(&forUnmarshaling->planeReorderPossible, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->persistentContent, sizeof(VkBool32));
+}
+
+
+void marshal_VkDisplayModeParametersKHR(
+    VulkanStream* vkStream,
+    const VkDisplayModeParametersKHR* forMarshaling)
+{
+    marshal_VkExtent2D(vkStream, &forMarshaling->visibleRegion);
+    vkStream->write(&forMarshaling->refreshRate, sizeof(uint32_t));
+}
+
+void unmarshal_VkDisplayModeParametersKHR(
+    VulkanStream* vkStream,
+    VkDisplayModeParametersKHR* forUnmarshaling)
+{
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->visibleRegion);
+    vkStream->read(&forUnmarshaling->refreshRate, sizeof(uint32_t));
+}
+
+
+void marshal_VkDisplayModePropertiesKHR(
+    VulkanStream* vkStream,
+    const VkDisplayModePropertiesKHR* forMarshaling)
+{
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayModeKHR(forMarshaling->displayMode));
+    marshal_VkDisplayModeParametersKHR(vkStream, &forMarshaling->parameters);
+}
+
+void unmarshal_VkDisplayModePropertiesKHR(
+    VulkanStream* vkStream,
+    VkDisplayModePropertiesKHR* forUnmarshaling)
+{
+    forUnmarshaling->displayMode = vkStream->handleMapping()->fromWire_VkDisplayModeKHR(vkStream, vkStream->getU64());
+    unmarshal_VkDisplayModeParametersKHR(vkStream, &forUnmarshaling->parameters);
+}
+
+
+void marshal_VkDisplayModeCreateInfoKHR(
+    VulkanStream* vkStream,
+    const VkDisplayModeCreateInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkDisplayModeCreateFlagsKHR));
+    marshal_VkDisplayModeParametersKHR(vkStream, &forMarshaling->parameters);
+}
+
+void unmarshal_VkDisplayModeCreateInfoKHR(
+    VulkanStream* vkStream,
+    VkDisplayModeCreateInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkDisplayModeCreateFlagsKHR));
+    unmarshal_VkDisplayModeParametersKHR(vkStream, &forUnmarshaling->parameters);
+}
+
+
+void marshal_VkDisplayPlaneCapabilitiesKHR(
+    VulkanStream* vkStream,
+    const VkDisplayPlaneCapabilitiesKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->supportedAlpha, sizeof(VkDisplayPlaneAlphaFlagsKHR));
+    marshal_VkOffset2D(vkStream, &forMarshaling->minSrcPosition);
+    marshal_VkOffset2D(vkStream, &forMarshaling->maxSrcPosition);
+    marshal_VkExtent2D(vkStream, &forMarshaling->minSrcExtent);
+    marshal_VkExtent2D(vkStream, &forMarshaling->maxSrcExtent);
+    marshal_VkOffset2D(vkStream, &forMarshaling->minDstPosition);
+    marshal_VkOffset2D(vkStream, &forMarshaling->maxDstPosition);
+    marshal_VkExtent2D(vkStream, &forMarshaling->minDstExtent);
+    marshal_VkExtent2D(vkStream, &forMarshaling->maxDstExtent);
+}
+
+void unmarshal_VkDisplayPlaneCapabilitiesKHR(
+    VulkanStream* vkStream,
+    VkDisplayPlaneCapabilitiesKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->supportedAlpha, sizeof(VkDisplayPlaneAlphaFlagsKHR));
+    unmarshal_VkOffset2D(vkStream, &forUnmarshaling->minSrcPosition);
+    unmarshal_VkOffset2D(vkStream, &forUnmarshaling->maxSrcPosition);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->minSrcExtent);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->maxSrcExtent);
+    unmarshal_VkOffset2D(vkStream, &forUnmarshaling->minDstPosition);
+    unmarshal_VkOffset2D(vkStream, &forUnmarshaling->maxDstPosition);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->minDstExtent);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->maxDstExtent);
+}
+
+
+void marshal_VkDisplayPlanePropertiesKHR(
+    VulkanStream* vkStream,
+    const VkDisplayPlanePropertiesKHR* forMarshaling)
+{
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayKHR(forMarshaling->currentDisplay));
+    vkStream->write(&forMarshaling->currentStackIndex, sizeof(uint32_t));
+}
+
+void unmarshal_VkDisplayPlanePropertiesKHR(
+    VulkanStream* vkStream,
+    VkDisplayPlanePropertiesKHR* forUnmarshaling)
+{
+    forUnmarshaling->currentDisplay = vkStream->handleMapping()->fromWire_VkDisplayKHR(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->currentStackIndex, sizeof(uint32_t));
+}
+
+
+void marshal_VkDisplaySurfaceCreateInfoKHR(
+    VulkanStream* vkStream,
+    const VkDisplaySurfaceCreateInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkDisplaySurfaceCreateFlagsKHR));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayModeKHR(forMarshaling->displayMode));
+    vkStream->write(&forMarshaling->planeIndex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->planeStackIndex, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->transform, sizeof(VkSurfaceTransformFlagBitsKHR));
+    vkStream->write(&forMarshaling->globalAlpha, sizeof(float));
+    vkStream->write(&forMarshaling->alphaMode, sizeof(VkDisplayPlaneAlphaFlagBitsKHR));
+    marshal_VkExtent2D(vkStream, &forMarshaling->imageExtent);
+}
+
+void unmarshal_VkDisplaySurfaceCreateInfoKHR(
+    VulkanStream* vkStream,
+    VkDisplaySurfaceCreateInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkDisplaySurfaceCreateFlagsKHR));
+    forUnmarshaling->displayMode = vkStream->handleMapping()->fromWire_VkDisplayModeKHR(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->planeIndex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->planeStackIndex, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->transform, sizeof(VkSurfaceTransformFlagBitsKHR));
+    vkStream->read(&forUnmarshaling->globalAlpha, sizeof(float));
+    vkStream->read(&forUnmarshaling->alphaMode, sizeof(VkDisplayPlaneAlphaFlagBitsKHR));
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->imageExtent);
+}
+
+
+#endif
+
+#ifdef VK_KHR_display_swapchain
+
+void marshal_VkDisplayPresentInfoKHR(
+    VulkanStream* vkStream,
+    const VkDisplayPresentInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkRect2D(vkStream, &forMarshaling->srcRect);
+    marshal_VkRect2D(vkStream, &forMarshaling->dstRect);
+    vkStream->write(&forMarshaling->persistent, sizeof(VkBool32));
+}
+
+void unmarshal_VkDisplayPresentInfoKHR(
+    VulkanStream* vkStream,
+    VkDisplayPresentInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkRect2D(vkStream, &forUnmarshaling->srcRect);
+    unmarshal_VkRect2D(vkStream, &forUnmarshaling->dstRect);
+    vkStream->read(&forUnmarshaling->persistent, sizeof(VkBool32));
+}
+
+
+#endif
+
+#ifdef VK_KHR_xlib_surface
+
+#endif
+
+#ifdef VK_KHR_xcb_surface
+
+#endif
+
+#ifdef VK_KHR_wayland_surface
+
+#endif
+
+#ifdef VK_KHR_mir_surface
+
+#endif
+
+#ifdef VK_KHR_android_surface
+
+#endif
+
+#ifdef VK_KHR_win32_surface
+
+#endif
+
+#ifdef VK_KHR_sampler_mirror_clamp_to_edge
+
+#endif
+
+#ifdef VK_KHR_multiview
+
+#endif
+
+#ifdef VK_KHR_get_physical_device_properties2
+
+#endif
+
+#ifdef VK_KHR_device_group
+
+#endif
+
+#ifdef VK_KHR_shader_draw_parameters
+
+#endif
+
+#ifdef VK_KHR_maintenance1
+
+#endif
+
+#ifdef VK_KHR_device_group_creation
+
+#endif
+
+#ifdef VK_KHR_external_memory_capabilities
+
+#endif
+
+#ifdef VK_KHR_external_memory
+
+#endif
+
+#ifdef VK_KHR_external_memory_win32
+
+void marshal_VkMemoryWin32HandlePropertiesKHR(
+    VulkanStream* vkStream,
+    const VkMemoryWin32HandlePropertiesKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+void unmarshal_VkMemoryWin32HandlePropertiesKHR(
+    VulkanStream* vkStream,
+    VkMemoryWin32HandlePropertiesKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+
+void marshal_VkMemoryGetWin32HandleInfoKHR(
+    VulkanStream* vkStream,
+    const VkMemoryGetWin32HandleInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->memory));
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+}
+
+void unmarshal_VkMemoryGetWin32HandleInfoKHR(
+    VulkanStream* vkStream,
+    VkMemoryGetWin32HandleInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+}
+
+
+#endif
+
+#ifdef VK_KHR_external_memory_fd
+
+void marshal_VkImportMemoryFdInfoKHR(
+    VulkanStream* vkStream,
+    const VkImportMemoryFdInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+    vkStream->write(&forMarshaling->fd, sizeof(int));
+}
+
+void unmarshal_VkImportMemoryFdInfoKHR(
+    VulkanStream* vkStream,
+    VkImportMemoryFdInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+    vkStream->read(&forUnmarshaling->fd, sizeof(int));
+}
+
+
+void marshal_VkMemoryFdPropertiesKHR(
+    VulkanStream* vkStream,
+    const VkMemoryFdPropertiesKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+void unmarshal_VkMemoryFdPropertiesKHR(
+    VulkanStream* vkStream,
+    VkMemoryFdPropertiesKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+
+void marshal_VkMemoryGetFdInfoKHR(
+    VulkanStream* vkStream,
+    const VkMemoryGetFdInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->memory));
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+}
+
+void unmarshal_VkMemoryGetFdInfoKHR(
+    VulkanStream* vkStream,
+    VkMemoryGetFdInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+}
+
+
+#endif
+
+#ifdef VK_KHR_win32_keyed_mutex
+
+void marshal_VkWin32KeyedMutexAcquireReleaseInfoKHR(
+    VulkanStream* vkStream,
+    const VkWin32KeyedMutexAcquireReleaseInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->acquireCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pAcquireSyncs ? 1 : 0);
+    if (forMarshaling->pAcquireSyncs)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->acquireCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->pAcquireSyncs[i]));
+        }
+    }
+    vkStream->putU32(forMarshaling->pAcquireKeys ? 1 : 0);
+    if (forMarshaling->pAcquireKeys)
+    {
+        vkStream->write(forMarshaling->pAcquireKeys, forMarshaling->acquireCount * sizeof(uint64_t));
+    }
+    vkStream->putU32(forMarshaling->pAcquireTimeouts ? 1 : 0);
+    if (forMarshaling->pAcquireTimeouts)
+    {
+        vkStream->write(forMarshaling->pAcquireTimeouts, forMarshaling->acquireCount * sizeof(uint32_t));
+    }
+    vkStream->write(&forMarshaling->releaseCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pReleaseSyncs ? 1 : 0);
+    if (forMarshaling->pReleaseSyncs)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->releaseCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->pReleaseSyncs[i]));
+        }
+    }
+    vkStream->putU32(forMarshaling->pReleaseKeys ? 1 : 0);
+    if (forMarshaling->pReleaseKeys)
+    {
+        vkStream->write(forMarshaling->pReleaseKeys, forMarshaling->releaseCount * sizeof(uint64_t));
+    }
+}
+
+void unmarshal_VkWin32KeyedMutexAcquireReleaseInfoKHR(
+    VulkanStream* vkStream,
+    VkWin32KeyedMutexAcquireReleaseInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->acquireCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDeviceMemory* pAcquireSyncs = (VkDeviceMemory*)vkStream->allocArray(forUnmarshaling->acquireCount, sizeof(VkDeviceMemory));
+        forUnmarshaling->pAcquireSyncs = pAcquireSyncs;
+        if (pAcquireSyncs)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->acquireCount; ++i)
+            {
+                pAcquireSyncs[i] = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        uint64_t* pAcquireKeys = (uint64_t*)vkStream->allocArray(forUnmarshaling->acquireCount, sizeof(uint64_t));
+        forUnmarshaling->pAcquireKeys = pAcquireKeys;
+        if (pAcquireKeys)
+        {
+            vkStream->read(pAcquireKeys, forUnmarshaling->acquireCount * sizeof(uint64_t));
+        }
+    }
+    if (vkStream->getU32())
+    {
+        uint32_t* pAcquireTimeouts = (uint32_t*)vkStream->allocArray(forUnmarshaling->acquireCount, sizeof(uint32_t));
+        forUnmarshaling->pAcquireTimeouts = pAcquireTimeouts;
+        if (pAcquireTimeouts)
+        {
+            vkStream->read(pAcquireTimeouts, forUnmarshaling->acquireCount * sizeof(uint32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->releaseCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDeviceMemory* pReleaseSyncs = (VkDeviceMemory*)vkStream->allocArray(forUnmarshaling->releaseCount, sizeof(VkDeviceMemory));
+        forUnmarshaling->pReleaseSyncs = pReleaseSyncs;
+        if (pReleaseSyncs)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->releaseCount; ++i)
+            {
+                pReleaseSyncs[i] = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        uint64_t* pReleaseKeys = (uint64_t*)vkStream->allocArray(forUnmarshaling->releaseCount, sizeof(uint64_t));
+        forUnmarshaling->pReleaseKeys = pReleaseKeys;
+        if (pReleaseKeys)
+        {
+            vkStream->read(pReleaseKeys, forUnmarshaling->releaseCount * sizeof(uint64_t));
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_KHR_external_semaphore_capabilities
+
+#endif
+
+#ifdef VK_KHR_external_semaphore
+
+#endif
+
+#ifdef VK_KHR_external_semaphore_win32
+
+void marshal_VkD3D12FenceSubmitInfoKHR(
+    VulkanStream* vkStream,
+    const VkD3D12FenceSubmitInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->waitSemaphoreValuesCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pWaitSemaphoreValues ? 1 : 0);
+    if (forMarshaling->pWaitSemaphoreValues)
+    {
+        vkStream->write(forMarshaling->pWaitSemaphoreValues, forMarshaling->waitSemaphoreValuesCount * sizeof(uint64_t));
+    }
+    vkStream->write(&forMarshaling->signalSemaphoreValuesCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSignalSemaphoreValues ? 1 : 0);
+    if (forMarshaling->pSignalSemaphoreValues)
+    {
+        vkStream->write(forMarshaling->pSignalSemaphoreValues, forMarshaling->signalSemaphoreValuesCount * sizeof(uint64_t));
+    }
+}
+
+void unmarshal_VkD3D12FenceSubmitInfoKHR(
+    VulkanStream* vkStream,
+    VkD3D12FenceSubmitInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->waitSemaphoreValuesCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint64_t* pWaitSemaphoreValues = (uint64_t*)vkStream->allocArray(forUnmarshaling->waitSemaphoreValuesCount, sizeof(uint64_t));
+        forUnmarshaling->pWaitSemaphoreValues = pWaitSemaphoreValues;
+        if (pWaitSemaphoreValues)
+        {
+            vkStream->read(pWaitSemaphoreValues, forUnmarshaling->waitSemaphoreValuesCount * sizeof(uint64_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->signalSemaphoreValuesCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint64_t* pSignalSemaphoreValues = (uint64_t*)vkStream->allocArray(forUnmarshaling->signalSemaphoreValuesCount, sizeof(uint64_t));
+        forUnmarshaling->pSignalSemaphoreValues = pSignalSemaphoreValues;
+        if (pSignalSemaphoreValues)
+        {
+            vkStream->read(pSignalSemaphoreValues, forUnmarshaling->signalSemaphoreValuesCount * sizeof(uint64_t));
+        }
+    }
+}
+
+
+void marshal_VkSemaphoreGetWin32HandleInfoKHR(
+    VulkanStream* vkStream,
+    const VkSemaphoreGetWin32HandleInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(forMarshaling->semaphore));
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalSemaphoreHandleTypeFlagBits));
+}
+
+void unmarshal_VkSemaphoreGetWin32HandleInfoKHR(
+    VulkanStream* vkStream,
+    VkSemaphoreGetWin32HandleInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->semaphore = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalSemaphoreHandleTypeFlagBits));
+}
+
+
+#endif
+
+#ifdef VK_KHR_external_semaphore_fd
+
+void marshal_VkImportSemaphoreFdInfoKHR(
+    VulkanStream* vkStream,
+    const VkImportSemaphoreFdInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(forMarshaling->semaphore));
+    vkStream->write(&forMarshaling->flags, sizeof(VkSemaphoreImportFlags));
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalSemaphoreHandleTypeFlagBits));
+    vkStream->write(&forMarshaling->fd, sizeof(int));
+}
+
+void unmarshal_VkImportSemaphoreFdInfoKHR(
+    VulkanStream* vkStream,
+    VkImportSemaphoreFdInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->semaphore = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkSemaphoreImportFlags));
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalSemaphoreHandleTypeFlagBits));
+    vkStream->read(&forUnmarshaling->fd, sizeof(int));
+}
+
+
+void marshal_VkSemaphoreGetFdInfoKHR(
+    VulkanStream* vkStream,
+    const VkSemaphoreGetFdInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(forMarshaling->semaphore));
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalSemaphoreHandleTypeFlagBits));
+}
+
+void unmarshal_VkSemaphoreGetFdInfoKHR(
+    VulkanStream* vkStream,
+    VkSemaphoreGetFdInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->semaphore = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalSemaphoreHandleTypeFlagBits));
+}
+
+
+#endif
+
+#ifdef VK_KHR_push_descriptor
+
+void marshal_VkPhysicalDevicePushDescriptorPropertiesKHR(
+    VulkanStream* vkStream,
+    const VkPhysicalDevicePushDescriptorPropertiesKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->maxPushDescriptors, sizeof(uint32_t));
+}
+
+void unmarshal_VkPhysicalDevicePushDescriptorPropertiesKHR(
+    VulkanStream* vkStream,
+    VkPhysicalDevicePushDescriptorPropertiesKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->maxPushDescriptors, sizeof(uint32_t));
+}
+
+
+#endif
+
+#ifdef VK_KHR_16bit_storage
+
+#endif
+
+#ifdef VK_KHR_incremental_present
+
+void marshal_VkRectLayerKHR(
+    VulkanStream* vkStream,
+    const VkRectLayerKHR* forMarshaling)
+{
+    marshal_VkOffset2D(vkStream, &forMarshaling->offset);
+    marshal_VkExtent2D(vkStream, &forMarshaling->extent);
+    vkStream->write(&forMarshaling->layer, sizeof(uint32_t));
+}
+
+void unmarshal_VkRectLayerKHR(
+    VulkanStream* vkStream,
+    VkRectLayerKHR* forUnmarshaling)
+{
+    unmarshal_VkOffset2D(vkStream, &forUnmarshaling->offset);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->extent);
+    vkStream->read(&forUnmarshaling->layer, sizeof(uint32_t));
+}
+
+
+void marshal_VkPresentRegionKHR(
+    VulkanStream* vkStream,
+    const VkPresentRegionKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->rectangleCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pRectangles ? 1 : 0);
+    if (forMarshaling->pRectangles)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->rectangleCount; ++i)
+        {
+            marshal_VkRectLayerKHR(vkStream, forMarshaling->pRectangles + i);
+        }
+    }
+}
+
+void unmarshal_VkPresentRegionKHR(
+    VulkanStream* vkStream,
+    VkPresentRegionKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->rectangleCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkRectLayerKHR* pRectangles = (VkRectLayerKHR*)vkStream->allocArray(forUnmarshaling->rectangleCount, sizeof(VkRectLayerKHR));
+        forUnmarshaling->pRectangles = pRectangles;
+        if (pRectangles)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->rectangleCount; ++i)
+            {
+                unmarshal_VkRectLayerKHR(vkStream, pRectangles + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkPresentRegionsKHR(
+    VulkanStream* vkStream,
+    const VkPresentRegionsKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->swapchainCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pRegions ? 1 : 0);
+    if (forMarshaling->pRegions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->swapchainCount; ++i)
+        {
+            marshal_VkPresentRegionKHR(vkStream, forMarshaling->pRegions + i);
+        }
+    }
+}
+
+void unmarshal_VkPresentRegionsKHR(
+    VulkanStream* vkStream,
+    VkPresentRegionsKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->swapchainCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkPresentRegionKHR* pRegions = (VkPresentRegionKHR*)vkStream->allocArray(forUnmarshaling->swapchainCount, sizeof(VkPresentRegionKHR));
+        forUnmarshaling->pRegions = pRegions;
+        if (pRegions)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->swapchainCount; ++i)
+            {
+                unmarshal_VkPresentRegionKHR(vkStream, pRegions + i);
+            }
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_KHR_descriptor_update_template
+
+#endif
+
+#ifdef VK_KHR_create_renderpass2
+
+void marshal_VkAttachmentDescription2KHR(
+    VulkanStream* vkStream,
+    const VkAttachmentDescription2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkAttachmentDescriptionFlags));
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->samples, sizeof(VkSampleCountFlagBits));
+    vkStream->write(&forMarshaling->loadOp, sizeof(VkAttachmentLoadOp));
+    vkStream->write(&forMarshaling->storeOp, sizeof(VkAttachmentStoreOp));
+    vkStream->write(&forMarshaling->stencilLoadOp, sizeof(VkAttachmentLoadOp));
+    vkStream->write(&forMarshaling->stencilStoreOp, sizeof(VkAttachmentStoreOp));
+    vkStream->write(&forMarshaling->initialLayout, sizeof(VkImageLayout));
+    vkStream->write(&forMarshaling->finalLayout, sizeof(VkImageLayout));
+}
+
+void unmarshal_VkAttachmentDescription2KHR(
+    VulkanStream* vkStream,
+    VkAttachmentDescription2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkAttachmentDescriptionFlags));
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->samples, sizeof(VkSampleCountFlagBits));
+    vkStream->read(&forUnmarshaling->loadOp, sizeof(VkAttachmentLoadOp));
+    vkStream->read(&forUnmarshaling->storeOp, sizeof(VkAttachmentStoreOp));
+    vkStream->read(&forUnmarshaling->stencilLoadOp, sizeof(VkAttachmentLoadOp));
+    vkStream->read(&forUnmarshaling->stencilStoreOp, sizeof(VkAttachmentStoreOp));
+    vkStream->read(&forUnmarshaling->initialLayout, sizeof(VkImageLayout));
+    vkStream->read(&forUnmarshaling->finalLayout, sizeof(VkImageLayout));
+}
+
+
+void marshal_VkAttachmentReference2KHR(
+    VulkanStream* vkStream,
+    const VkAttachmentReference2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->attachment, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->layout, sizeof(VkImageLayout));
+    vkStream->write(&forMarshaling->aspectMask, sizeof(VkImageAspectFlags));
+}
+
+void unmarshal_VkAttachmentReference2KHR(
+    VulkanStream* vkStream,
+    VkAttachmentReference2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->attachment, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->layout, sizeof(VkImageLayout));
+    vkStream->read(&forUnmarshaling->aspectMask, sizeof(VkImageAspectFlags));
+}
+
+
+void marshal_VkSubpassDescription2KHR(
+    VulkanStream* vkStream,
+    const VkSubpassDescription2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkSubpassDescriptionFlags));
+    vkStream->write(&forMarshaling->pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->write(&forMarshaling->viewMask, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->inputAttachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pInputAttachments ? 1 : 0);
+    if (forMarshaling->pInputAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->inputAttachmentCount; ++i)
+        {
+            marshal_VkAttachmentReference2KHR(vkStream, forMarshaling->pInputAttachments + i);
+        }
+    }
+    vkStream->write(&forMarshaling->colorAttachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pColorAttachments ? 1 : 0);
+    if (forMarshaling->pColorAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->colorAttachmentCount; ++i)
+        {
+            marshal_VkAttachmentReference2KHR(vkStream, forMarshaling->pColorAttachments + i);
+        }
+    }
+    vkStream->putU32(forMarshaling->pResolveAttachments ? 1 : 0);
+    if (forMarshaling->pResolveAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->colorAttachmentCount; ++i)
+        {
+            marshal_VkAttachmentReference2KHR(vkStream, forMarshaling->pResolveAttachments + i);
+        }
+    }
+    vkStream->putU32(forMarshaling->pDepthStencilAttachment ? 1 : 0);
+    if (forMarshaling->pDepthStencilAttachment)
+    {
+        marshal_VkAttachmentReference2KHR(vkStream, forMarshaling->pDepthStencilAttachment);
+    }
+    vkStream->write(&forMarshaling->preserveAttachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pPreserveAttachments ? 1 : 0);
+    if (forMarshaling->pPreserveAttachments)
+    {
+        vkStream->write(forMarshaling->pPreserveAttachments, forMarshaling->preserveAttachmentCount * sizeof(uint32_t));
+    }
+}
+
+void unmarshal_VkSubpassDescription2KHR(
+    VulkanStream* vkStream,
+    VkSubpassDescription2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkSubpassDescriptionFlags));
+    vkStream->read(&forUnmarshaling->pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->read(&forUnmarshaling->viewMask, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->inputAttachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkAttachmentReference2KHR* pInputAttachments = (VkAttachmentReference2KHR*)vkStream->allocArray(forUnmarshaling->inputAttachmentCount, sizeof(VkAttachmentReference2KHR));
+        forUnmarshaling->pInputAttachments = pInputAttachments;
+        if (pInputAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->inputAttachmentCount; ++i)
+            {
+                unmarshal_VkAttachmentReference2KHR(vkStream, pInputAttachments + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->colorAttachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkAttachmentReference2KHR* pColorAttachments = (VkAttachmentReference2KHR*)vkStream->allocArray(forUnmarshaling->colorAttachmentCount, sizeof(VkAttachmentReference2KHR));
+        forUnmarshaling->pColorAttachments = pColorAttachments;
+        if (pColorAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->colorAttachmentCount; ++i)
+            {
+                unmarshal_VkAttachmentReference2KHR(vkStream, pColorAttachments + i);
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkAttachmentReference2KHR* pResolveAttachments = (VkAttachmentReference2KHR*)vkStream->allocArray(forUnmarshaling->colorAttachmentCount, sizeof(VkAttachmentReference2KHR));
+        forUnmarshaling->pResolveAttachments = pResolveAttachments;
+        if (pResolveAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->colorAttachmentCount; ++i)
+            {
+                unmarshal_VkAttachmentReference2KHR(vkStream, pResolveAttachments + i);
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkAttachmentReference2KHR* pDepthStencilAttachment = (VkAttachmentReference2KHR*)vkStream->allocArray(1, sizeof(VkAttachmentReference2KHR));
+        forUnmarshaling->pDepthStencilAttachment = pDepthStencilAttachment;
+        if (pDepthStencilAttachment)
+        {
+            unmarshal_VkAttachmentReference2KHR(vkStream, pDepthStencilAttachment);
+        }
+    }
+    vkStream->read(&forUnmarshaling->preserveAttachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pPreserveAttachments = (uint32_t*)vkStream->allocArray(forUnmarshaling->preserveAttachmentCount, sizeof(uint32_t));
+        forUnmarshaling->pPreserveAttachments = pPreserveAttachments;
+        if (pPreserveAttachments)
+        {
+            vkStream->read(pPreserveAttachments, forUnmarshaling->preserveAttachmentCount * sizeof(uint32_t));
+        }
+    }
+}
+
+
+void marshal_VkSubpassDependency2KHR(
+    VulkanStream* vkStream,
+    const VkSubpassDependency2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->srcSubpass, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->dstSubpass, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->srcStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->write(&forMarshaling->dstStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->write(&forMarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->write(&forMarshaling->dstAccessMask, sizeof(VkAccessFlags));
+    vkStream->write(&forMarshaling->dependencyFlags, sizeof(VkDependencyFlags));
+    vkStream->write(&forMarshaling->viewOffset, sizeof(int32_t));
+}
+
+void unmarshal_VkSubpassDependency2KHR(
+    VulkanStream* vkStream,
+    VkSubpassDependency2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->srcSubpass, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->dstSubpass, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->srcStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->read(&forUnmarshaling->dstStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->read(&forUnmarshaling->srcAccessMask, sizeof(VkAccessFlags));
+    vkStream->read(&forUnmarshaling->dstAccessMask, sizeof(VkAccessFlags));
+    vkStream->read(&forUnmarshaling->dependencyFlags, sizeof(VkDependencyFlags));
+    vkStream->read(&forUnmarshaling->viewOffset, sizeof(int32_t));
+}
+
+
+void marshal_VkRenderPassCreateInfo2KHR(
+    VulkanStream* vkStream,
+    const VkRenderPassCreateInfo2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkRenderPassCreateFlags));
+    vkStream->write(&forMarshaling->attachmentCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pAttachments ? 1 : 0);
+    if (forMarshaling->pAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->attachmentCount; ++i)
+        {
+            marshal_VkAttachmentDescription2KHR(vkStream, forMarshaling->pAttachments + i);
+        }
+    }
+    vkStream->write(&forMarshaling->subpassCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSubpasses ? 1 : 0);
+    if (forMarshaling->pSubpasses)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->subpassCount; ++i)
+        {
+            marshal_VkSubpassDescription2KHR(vkStream, forMarshaling->pSubpasses + i);
+        }
+    }
+    vkStream->write(&forMarshaling->dependencyCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDependencies ? 1 : 0);
+    if (forMarshaling->pDependencies)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->dependencyCount; ++i)
+        {
+            marshal_VkSubpassDependency2KHR(vkStream, forMarshaling->pDependencies + i);
+        }
+    }
+    vkStream->write(&forMarshaling->correlatedViewMaskCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pCorrelatedViewMasks ? 1 : 0);
+    if (forMarshaling->pCorrelatedViewMasks)
+    {
+        vkStream->write(forMarshaling->pCorrelatedViewMasks, forMarshaling->correlatedViewMaskCount * sizeof(uint32_t));
+    }
+}
+
+void unmarshal_VkRenderPassCreateInfo2KHR(
+    VulkanStream* vkStream,
+    VkRenderPassCreateInfo2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkRenderPassCreateFlags));
+    vkStream->read(&forUnmarshaling->attachmentCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkAttachmentDescription2KHR* pAttachments = (VkAttachmentDescription2KHR*)vkStream->allocArray(forUnmarshaling->attachmentCount, sizeof(VkAttachmentDescription2KHR));
+        forUnmarshaling->pAttachments = pAttachments;
+        if (pAttachments)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->attachmentCount; ++i)
+            {
+                unmarshal_VkAttachmentDescription2KHR(vkStream, pAttachments + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->subpassCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSubpassDescription2KHR* pSubpasses = (VkSubpassDescription2KHR*)vkStream->allocArray(forUnmarshaling->subpassCount, sizeof(VkSubpassDescription2KHR));
+        forUnmarshaling->pSubpasses = pSubpasses;
+        if (pSubpasses)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->subpassCount; ++i)
+            {
+                unmarshal_VkSubpassDescription2KHR(vkStream, pSubpasses + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->dependencyCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSubpassDependency2KHR* pDependencies = (VkSubpassDependency2KHR*)vkStream->allocArray(forUnmarshaling->dependencyCount, sizeof(VkSubpassDependency2KHR));
+        forUnmarshaling->pDependencies = pDependencies;
+        if (pDependencies)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->dependencyCount; ++i)
+            {
+                unmarshal_VkSubpassDependency2KHR(vkStream, pDependencies + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->correlatedViewMaskCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pCorrelatedViewMasks = (uint32_t*)vkStream->allocArray(forUnmarshaling->correlatedViewMaskCount, sizeof(uint32_t));
+        forUnmarshaling->pCorrelatedViewMasks = pCorrelatedViewMasks;
+        if (pCorrelatedViewMasks)
+        {
+            vkStream->read(pCorrelatedViewMasks, forUnmarshaling->correlatedViewMaskCount * sizeof(uint32_t));
+        }
+    }
+}
+
+
+void marshal_VkSubpassBeginInfoKHR(
+    VulkanStream* vkStream,
+    const VkSubpassBeginInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->contents, sizeof(VkSubpassContents));
+}
+
+void unmarshal_VkSubpassBeginInfoKHR(
+    VulkanStream* vkStream,
+    VkSubpassBeginInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->contents, sizeof(VkSubpassContents));
+}
+
+
+void marshal_VkSubpassEndInfoKHR(
+    VulkanStream* vkStream,
+    const VkSubpassEndInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+}
+
+void unmarshal_VkSubpassEndInfoKHR(
+    VulkanStream* vkStream,
+    VkSubpassEndInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+}
+
+
+#endif
+
+#ifdef VK_KHR_shared_presentable_image
+
+void marshal_VkSharedPresentSurfaceCapabilitiesKHR(
+    VulkanStream* vkStream,
+    const VkSharedPresentSurfaceCapabilitiesKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->sharedPresentSupportedUsageFlags, sizeof(VkImageUsageFlags));
+}
+
+void unmarshal_VkSharedPresentSurfaceCapabilitiesKHR(
+    VulkanStream* vkStream,
+    VkSharedPresentSurfaceCapabilitiesKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->sharedPresentSupportedUsageFlags, sizeof(VkImageUsageFlags));
+}
+
+
+#endif
+
+#ifdef VK_KHR_external_fence_capabilities
+
+#endif
+
+#ifdef VK_KHR_external_fence
+
+#endif
+
+#ifdef VK_KHR_external_fence_win32
+
+void marshal_VkFenceGetWin32HandleInfoKHR(
+    VulkanStream* vkStream,
+    const VkFenceGetWin32HandleInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(forMarshaling->fence));
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalFenceHandleTypeFlagBits));
+}
+
+void unmarshal_VkFenceGetWin32HandleInfoKHR(
+    VulkanStream* vkStream,
+    VkFenceGetWin32HandleInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->fence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalFenceHandleTypeFlagBits));
+}
+
+
+#endif
+
+#ifdef VK_KHR_external_fence_fd
+
+void marshal_VkImportFenceFdInfoKHR(
+    VulkanStream* vkStream,
+    const VkImportFenceFdInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(forMarshaling->fence));
+    vkStream->write(&forMarshaling->flags, sizeof(VkFenceImportFlags));
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalFenceHandleTypeFlagBits));
+    vkStream->write(&forMarshaling->fd, sizeof(int));
+}
+
+void unmarshal_VkImportFenceFdInfoKHR(
+    VulkanStream* vkStream,
+    VkImportFenceFdInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->fence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkFenceImportFlags));
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalFenceHandleTypeFlagBits));
+    vkStream->read(&forUnmarshaling->fd, sizeof(int));
+}
+
+
+void marshal_VkFenceGetFdInfoKHR(
+    VulkanStream* vkStream,
+    const VkFenceGetFdInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(forMarshaling->fence));
+    vkStream->write(&forMarshaling->handleType, sizeof(VkExternalFenceHandleTypeFlagBits));
+}
+
+void unmarshal_VkFenceGetFdInfoKHR(
+    VulkanStream* vkStream,
+    VkFenceGetFdInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->fence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->handleType, sizeof(VkExternalFenceHandleTypeFlagBits));
+}
+
+
+#endif
+
+#ifdef VK_KHR_maintenance2
+
+#endif
+
+#ifdef VK_KHR_get_surface_capabilities2
+
+void marshal_VkPhysicalDeviceSurfaceInfo2KHR(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceSurfaceInfo2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(forMarshaling->surface));
+}
+
+void unmarshal_VkPhysicalDeviceSurfaceInfo2KHR(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceSurfaceInfo2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkSurfaceCapabilities2KHR(
+    VulkanStream* vkStream,
+    const VkSurfaceCapabilities2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkSurfaceCapabilitiesKHR(vkStream, &forMarshaling->surfaceCapabilities);
+}
+
+void unmarshal_VkSurfaceCapabilities2KHR(
+    VulkanStream* vkStream,
+    VkSurfaceCapabilities2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkSurfaceCapabilitiesKHR(vkStream, &forUnmarshaling->surfaceCapabilities);
+}
+
+
+void marshal_VkSurfaceFormat2KHR(
+    VulkanStream* vkStream,
+    const VkSurfaceFormat2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkSurfaceFormatKHR(vkStream, &forMarshaling->surfaceFormat);
+}
+
+void unmarshal_VkSurfaceFormat2KHR(
+    VulkanStream* vkStream,
+    VkSurfaceFormat2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkSurfaceFormatKHR(vkStream, &forUnmarshaling->surfaceFormat);
+}
+
+
+#endif
+
+#ifdef VK_KHR_variable_pointers
+
+#endif
+
+#ifdef VK_KHR_get_display_properties2
+
+void marshal_VkDisplayProperties2KHR(
+    VulkanStream* vkStream,
+    const VkDisplayProperties2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkDisplayPropertiesKHR(vkStream, &forMarshaling->displayProperties);
+}
+
+void unmarshal_VkDisplayProperties2KHR(
+    VulkanStream* vkStream,
+    VkDisplayProperties2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkDisplayPropertiesKHR(vkStream, &forUnmarshaling->displayProperties);
+}
+
+
+void marshal_VkDisplayPlaneProperties2KHR(
+    VulkanStream* vkStream,
+    const VkDisplayPlaneProperties2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkDisplayPlanePropertiesKHR(vkStream, &forMarshaling->displayPlaneProperties);
+}
+
+void unmarshal_VkDisplayPlaneProperties2KHR(
+    VulkanStream* vkStream,
+    VkDisplayPlaneProperties2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkDisplayPlanePropertiesKHR(vkStream, &forUnmarshaling->displayPlaneProperties);
+}
+
+
+void marshal_VkDisplayModeProperties2KHR(
+    VulkanStream* vkStream,
+    const VkDisplayModeProperties2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkDisplayModePropertiesKHR(vkStream, &forMarshaling->displayModeProperties);
+}
+
+void unmarshal_VkDisplayModeProperties2KHR(
+    VulkanStream* vkStream,
+    VkDisplayModeProperties2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkDisplayModePropertiesKHR(vkStream, &forUnmarshaling->displayModeProperties);
+}
+
+
+void marshal_VkDisplayPlaneInfo2KHR(
+    VulkanStream* vkStream,
+    const VkDisplayPlaneInfo2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayModeKHR(forMarshaling->mode));
+    vkStream->write(&forMarshaling->planeIndex, sizeof(uint32_t));
+}
+
+void unmarshal_VkDisplayPlaneInfo2KHR(
+    VulkanStream* vkStream,
+    VkDisplayPlaneInfo2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->mode = vkStream->handleMapping()->fromWire_VkDisplayModeKHR(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->planeIndex, sizeof(uint32_t));
+}
+
+
+void marshal_VkDisplayPlaneCapabilities2KHR(
+    VulkanStream* vkStream,
+    const VkDisplayPlaneCapabilities2KHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkDisplayPlaneCapabilitiesKHR(vkStream, &forMarshaling->capabilities);
+}
+
+void unmarshal_VkDisplayPlaneCapabilities2KHR(
+    VulkanStream* vkStream,
+    VkDisplayPlaneCapabilities2KHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkDisplayPlaneCapabilitiesKHR(vkStream, &forUnmarshaling->capabilities);
+}
+
+
+#endif
+
+#ifdef VK_KHR_dedicated_allocation
+
+#endif
+
+#ifdef VK_KHR_storage_buffer_storage_class
+
+#endif
+
+#ifdef VK_KHR_relaxed_block_layout
+
+#endif
+
+#ifdef VK_KHR_get_memory_requirements2
+
+#endif
+
+#ifdef VK_KHR_image_format_list
+
+void marshal_VkImageFormatListCreateInfoKHR(
+    VulkanStream* vkStream,
+    const VkImageFormatListCreateInfoKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->viewFormatCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pViewFormats ? 1 : 0);
+    if (forMarshaling->pViewFormats)
+    {
+        vkStream->write(forMarshaling->pViewFormats, forMarshaling->viewFormatCount * sizeof(VkFormat));
+    }
+}
+
+void unmarshal_VkImageFormatListCreateInfoKHR(
+    VulkanStream* vkStream,
+    VkImageFormatListCreateInfoKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->viewFormatCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkFormat* pViewFormats = (VkFormat*)vkStream->allocArray(forUnmarshaling->viewFormatCount, sizeof(VkFormat));
+        forUnmarshaling->pViewFormats = pViewFormats;
+        if (pViewFormats)
+        {
+            vkStream->read(pViewFormats, forUnmarshaling->viewFormatCount * sizeof(VkFormat));
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_KHR_sampler_ycbcr_conversion
+
+#endif
+
+#ifdef VK_KHR_bind_memory2
+
+#endif
+
+#ifdef VK_KHR_maintenance3
+
+#endif
+
+#ifdef VK_KHR_draw_indirect_count
+
+#endif
+
+#ifdef VK_KHR_8bit_storage
+
+void marshal_VkPhysicalDevice8BitStorageFeaturesKHR(
+    VulkanStream* vkStream,
+    const VkPhysicalDevice8BitStorageFeaturesKHR* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->storageBuffer8BitAccess, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->uniformAndStorageBuffer8BitAccess, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->storagePushConstant8, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDevice8BitStorageFeaturesKHR(
+    VulkanStream* vkStream,
+    VkPhysicalDevice8BitStorageFeaturesKHR* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->storageBuffer8BitAccess, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->uniformAndStorageBuffer8BitAccess, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->storagePushConstant8, sizeof(VkBool32));
+}
+
+
+#endif
+
+#ifdef VK_EXT_debug_report
+
+#endif
+
+#ifdef VK_NV_glsl_shader
+
+#endif
+
+#ifdef VK_EXT_depth_range_unrestricted
+
+#endif
+
+#ifdef VK_IMG_filter_cubic
+
+#endif
+
+#ifdef VK_AMD_rasterization_order
+
+void marshal_VkPipelineRasterizationStateRasterizationOrderAMD(
+    VulkanStream* vkStream,
+    const VkPipelineRasterizationStateRasterizationOrderAMD* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->rasterizationOrder, sizeof(VkRasterizationOrderAMD));
+}
+
+void unmarshal_VkPipelineRasterizationStateRasterizationOrderAMD(
+    VulkanStream* vkStream,
+    VkPipelineRasterizationStateRasterizationOrderAMD* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->rasterizationOrder, sizeof(VkRasterizationOrderAMD));
+}
+
+
+#endif
+
+#ifdef VK_AMD_shader_trinary_minmax
+
+#endif
+
+#ifdef VK_AMD_shader_explicit_vertex_parameter
+
+#endif
+
+#ifdef VK_EXT_debug_marker
+
+void marshal_VkDebugMarkerObjectNameInfoEXT(
+    VulkanStream* vkStream,
+    const VkDebugMarkerObjectNameInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->objectType, sizeof(VkDebugReportObjectTypeEXT));
+    vkStream->write(&forMarshaling->object, sizeof(uint64_t));
+    vkStream->putString(forMarshaling->pObjectName);
+}
+
+void unmarshal_VkDebugMarkerObjectNameInfoEXT(
+    VulkanStream* vkStream,
+    VkDebugMarkerObjectNameInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->objectType, sizeof(VkDebugReportObjectTypeEXT));
+    vkStream->read(&forUnmarshaling->object, sizeof(uint64_t));
+    forUnmarshaling->pObjectName = vkStream->getString();
+}
+
+
+void marshal_VkDebugMarkerObjectTagInfoEXT(
+    VulkanStream* vkStream,
+    const VkDebugMarkerObjectTagInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->objectType, sizeof(VkDebugReportObjectTypeEXT));
+    vkStream->write(&forMarshaling->object, sizeof(uint64_t));
+    vkStream->write(&forMarshaling->tagName, sizeof(uint64_t));
+    vkStream->putU64((uint64_t)forMarshaling->tagSize);
+    vkStream->putU32(forMarshaling->pTag ? 1 : 0);
+    if (forMarshaling->pTag)
+    {
+        vkStream->write(forMarshaling->pTag, forMarshaling->tagSize * sizeof(uint8_t));
+    }
+}
+
+void unmarshal_VkDebugMarkerObjectTagInfoEXT(
+    VulkanStream* vkStream,
+    VkDebugMarkerObjectTagInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->objectType, sizeof(VkDebugReportObjectTypeEXT));
+    vkStream->read(&forUnmarshaling->object, sizeof(uint64_t));
+    vkStream->read(&forUnmarshaling->tagName, sizeof(uint64_t));
+    forUnmarshaling->tagSize = (size_t)vkStream->getU64();
+    if (vkStream->getU32())
+    {
+        uint8_t* pTag = (uint8_t*)vkStream->allocArray(forUnmarshaling->tagSize, sizeof(uint8_t));
+        forUnmarshaling->pTag = pTag;
+        if (pTag)
+        {
+            vkStream->read(pTag, forUnmarshaling->tagSize * sizeof(uint8_t));
+        }
+    }
+}
+
+
+void marshal_VkDebugMarkerMarkerInfoEXT(
+    VulkanStream* vkStream,
+    const VkDebugMarkerMarkerInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putString(forMarshaling->pMarkerName);
+    vkStream->write(forMarshaling->color, 4 * sizeof(float));
+}
+
+void unmarshal_VkDebugMarkerMarkerInfoEXT(
+    VulkanStream* vkStream,
+    VkDebugMarkerMarkerInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->pMarkerName = vkStream->getString();
+    vkStream->read(forUnmarshaling->color, 4 * sizeof(float));
+}
+
+
+#endif
+
+#ifdef VK_AMD_gcn_shader
+
+#endif
+
+#ifdef VK_NV_dedicated_allocation
+
+void marshal_VkDedicatedAllocationImageCreateInfoNV(
+    VulkanStream* vkStream,
+    const VkDedicatedAllocationImageCreateInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->dedicatedAllocation, sizeof(VkBool32));
+}
+
+void unmarshal_VkDedicatedAllocationImageCreateInfoNV(
+    VulkanStream* vkStream,
+    VkDedicatedAllocationImageCreateInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->dedicatedAllocation, sizeof(VkBool32));
+}
+
+
+void marshal_VkDedicatedAllocationBufferCreateInfoNV(
+    VulkanStream* vkStream,
+    const VkDedicatedAllocationBufferCreateInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->dedicatedAllocation, sizeof(VkBool32));
+}
+
+void unmarshal_VkDedicatedAllocationBufferCreateInfoNV(
+    VulkanStream* vkStream,
+    VkDedicatedAllocationBufferCreateInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->dedicatedAllocation, sizeof(VkBool32));
+}
+
+
+void marshal_VkDedicatedAllocationMemoryAllocateInfoNV(
+    VulkanStream* vkStream,
+    const VkDedicatedAllocationMemoryAllocateInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(forMarshaling->image));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+}
+
+void unmarshal_VkDedicatedAllocationMemoryAllocateInfoNV(
+    VulkanStream* vkStream,
+    VkDedicatedAllocationMemoryAllocateInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+}
+
+
+#endif
+
+#ifdef VK_AMD_draw_indirect_count
+
+#endif
+
+#ifdef VK_AMD_negative_viewport_height
+
+#endif
+
+#ifdef VK_AMD_gpu_shader_half_float
+
+#endif
+
+#ifdef VK_AMD_shader_ballot
+
+#endif
+
+#ifdef VK_AMD_texture_gather_bias_lod
+
+void marshal_VkTextureLODGatherFormatPropertiesAMD(
+    VulkanStream* vkStream,
+    const VkTextureLODGatherFormatPropertiesAMD* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->supportsTextureGatherLODBiasAMD, sizeof(VkBool32));
+}
+
+void unmarshal_VkTextureLODGatherFormatPropertiesAMD(
+    VulkanStream* vkStream,
+    VkTextureLODGatherFormatPropertiesAMD* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->supportsTextureGatherLODBiasAMD, sizeof(VkBool32));
+}
+
+
+#endif
+
+#ifdef VK_AMD_shader_info
+
+void marshal_VkShaderResourceUsageAMD(
+    VulkanStream* vkStream,
+    const VkShaderResourceUsageAMD* forMarshaling)
+{
+    vkStream->write(&forMarshaling->numUsedVgprs, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->numUsedSgprs, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->ldsSizePerLocalWorkGroup, sizeof(uint32_t));
+    vkStream->putU64((uint64_t)forMarshaling->ldsUsageSizeInBytes);
+    vkStream->putU64((uint64_t)forMarshaling->scratchMemUsageInBytes);
+}
+
+void unmarshal_VkShaderResourceUsageAMD(
+    VulkanStream* vkStream,
+    VkShaderResourceUsageAMD* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->numUsedVgprs, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->numUsedSgprs, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->ldsSizePerLocalWorkGroup, sizeof(uint32_t));
+    forUnmarshaling->ldsUsageSizeInBytes = (size_t)vkStream->getU64();
+    forUnmarshaling->scratchMemUsageInBytes = (size_t)vkStream->getU64();
+}
+
+
+void marshal_VkShaderStatisticsInfoAMD(
+    VulkanStream* vkStream,
+    const VkShaderStatisticsInfoAMD* forMarshaling)
+{
+    vkStream->write(&forMarshaling->shaderStageMask, sizeof(VkShaderStageFlags));
+    marshal_VkShaderResourceUsageAMD(vkStream, &forMarshaling->resourceUsage);
+    vkStream->write(&forMarshaling->numPhysicalVgprs, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->numPhysicalSgprs, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->numAvailableVgprs, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->numAvailableSgprs, sizeof(uint32_t));
+    vkStream->write(forMarshaling->computeWorkGroupSize, 3 * sizeof(uint32_t));
+}
+
+void unmarshal_VkShaderStatisticsInfoAMD(
+    VulkanStream* vkStream,
+    VkShaderStatisticsInfoAMD* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->shaderStageMask, sizeof(VkShaderStageFlags));
+    unmarshal_VkShaderResourceUsageAMD(vkStream, &forUnmarshaling->resourceUsage);
+    vkStream->read(&forUnmarshaling->numPhysicalVgprs, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->numPhysicalSgprs, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->numAvailableVgprs, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->numAvailableSgprs, sizeof(uint32_t));
+    vkStream->read(forUnmarshaling->computeWorkGroupSize, 3 * sizeof(uint32_t));
+}
+
+
+#endif
+
+#ifdef VK_AMD_shader_image_load_store_lod
+
+#endif
+
+#ifdef VK_IMG_format_pvrtc
+
+#endif
+
+#ifdef VK_NV_external_memory_capabilities
+
+void marshal_VkExternalImageFormatPropertiesNV(
+    VulkanStream* vkStream,
+    const VkExternalImageFormatPropertiesNV* forMarshaling)
+{
+    marshal_VkImageFormatProperties(vkStream, &forMarshaling->imageFormatProperties);
+    vkStream->write(&forMarshaling->externalMemoryFeatures, sizeof(VkExternalMemoryFeatureFlagsNV));
+    vkStream->write(&forMarshaling->exportFromImportedHandleTypes, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+    vkStream->write(&forMarshaling->compatibleHandleTypes, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+}
+
+void unmarshal_VkExternalImageFormatPropertiesNV(
+    VulkanStream* vkStream,
+    VkExternalImageFormatPropertiesNV* forUnmarshaling)
+{
+    unmarshal_VkImageFormatProperties(vkStream, &forUnmarshaling->imageFormatProperties);
+    vkStream->read(&forUnmarshaling->externalMemoryFeatures, sizeof(VkExternalMemoryFeatureFlagsNV));
+    vkStream->read(&forUnmarshaling->exportFromImportedHandleTypes, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+    vkStream->read(&forUnmarshaling->compatibleHandleTypes, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+}
+
+
+#endif
+
+#ifdef VK_NV_external_memory
+
+void marshal_VkExternalMemoryImageCreateInfoNV(
+    VulkanStream* vkStream,
+    const VkExternalMemoryImageCreateInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+}
+
+void unmarshal_VkExternalMemoryImageCreateInfoNV(
+    VulkanStream* vkStream,
+    VkExternalMemoryImageCreateInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+}
+
+
+void marshal_VkExportMemoryAllocateInfoNV(
+    VulkanStream* vkStream,
+    const VkExportMemoryAllocateInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+}
+
+void unmarshal_VkExportMemoryAllocateInfoNV(
+    VulkanStream* vkStream,
+    VkExportMemoryAllocateInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->handleTypes, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+}
+
+
+#endif
+
+#ifdef VK_NV_external_memory_win32
+
+#endif
+
+#ifdef VK_NV_win32_keyed_mutex
+
+void marshal_VkWin32KeyedMutexAcquireReleaseInfoNV(
+    VulkanStream* vkStream,
+    const VkWin32KeyedMutexAcquireReleaseInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->acquireCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pAcquireSyncs ? 1 : 0);
+    if (forMarshaling->pAcquireSyncs)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->acquireCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->pAcquireSyncs[i]));
+        }
+    }
+    vkStream->putU32(forMarshaling->pAcquireKeys ? 1 : 0);
+    if (forMarshaling->pAcquireKeys)
+    {
+        vkStream->write(forMarshaling->pAcquireKeys, forMarshaling->acquireCount * sizeof(uint64_t));
+    }
+    vkStream->putU32(forMarshaling->pAcquireTimeoutMilliseconds ? 1 : 0);
+    if (forMarshaling->pAcquireTimeoutMilliseconds)
+    {
+        vkStream->write(forMarshaling->pAcquireTimeoutMilliseconds, forMarshaling->acquireCount * sizeof(uint32_t));
+    }
+    vkStream->write(&forMarshaling->releaseCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pReleaseSyncs ? 1 : 0);
+    if (forMarshaling->pReleaseSyncs)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->releaseCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->pReleaseSyncs[i]));
+        }
+    }
+    vkStream->putU32(forMarshaling->pReleaseKeys ? 1 : 0);
+    if (forMarshaling->pReleaseKeys)
+    {
+        vkStream->write(forMarshaling->pReleaseKeys, forMarshaling->releaseCount * sizeof(uint64_t));
+    }
+}
+
+void unmarshal_VkWin32KeyedMutexAcquireReleaseInfoNV(
+    VulkanStream* vkStream,
+    VkWin32KeyedMutexAcquireReleaseInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->acquireCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDeviceMemory* pAcquireSyncs = (VkDeviceMemory*)vkStream->allocArray(forUnmarshaling->acquireCount, sizeof(VkDeviceMemory));
+        forUnmarshaling->pAcquireSyncs = pAcquireSyncs;
+        if (pAcquireSyncs)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->acquireCount; ++i)
+            {
+                pAcquireSyncs[i] = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        uint64_t* pAcquireKeys = (uint64_t*)vkStream->allocArray(forUnmarshaling->acquireCount, sizeof(uint64_t));
+        forUnmarshaling->pAcquireKeys = pAcquireKeys;
+        if (pAcquireKeys)
+        {
+            vkStream->read(pAcquireKeys, forUnmarshaling->acquireCount * sizeof(uint64_t));
+        }
+    }
+    if (vkStream->getU32())
+    {
+        uint32_t* pAcquireTimeoutMilliseconds = (uint32_t*)vkStream->allocArray(forUnmarshaling->acquireCount, sizeof(uint32_t));
+        forUnmarshaling->pAcquireTimeoutMilliseconds = pAcquireTimeoutMilliseconds;
+        if (pAcquireTimeoutMilliseconds)
+        {
+            vkStream->read(pAcquireTimeoutMilliseconds, forUnmarshaling->acquireCount * sizeof(uint32_t));
+        }
+    }
+    vkStream->read(&forUnmarshaling->releaseCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDeviceMemory* pReleaseSyncs = (VkDeviceMemory*)vkStream->allocArray(forUnmarshaling->releaseCount, sizeof(VkDeviceMemory));
+        forUnmarshaling->pReleaseSyncs = pReleaseSyncs;
+        if (pReleaseSyncs)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->releaseCount; ++i)
+            {
+                pReleaseSyncs[i] = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    if (vkStream->getU32())
+    {
+        uint64_t* pReleaseKeys = (uint64_t*)vkStream->allocArray(forUnmarshaling->releaseCount, sizeof(uint64_t));
+        forUnmarshaling->pReleaseKeys = pReleaseKeys;
+        if (pReleaseKeys)
+        {
+            vkStream->read(pReleaseKeys, forUnmarshaling->releaseCount * sizeof(uint64_t));
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_EXT_validation_flags
+
+void marshal_VkValidationFlagsEXT(
+    VulkanStream* vkStream,
+    const VkValidationFlagsEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->disabledValidationCheckCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDisabledValidationChecks ? 1 : 0);
+    if (forMarshaling->pDisabledValidationChecks)
+    {
+        vkStream->write(forMarshaling->pDisabledValidationChecks, forMarshaling->disabledValidationCheckCount * sizeof(VkValidationCheckEXT));
+    }
+}
+
+void unmarshal_VkValidationFlagsEXT(
+    VulkanStream* vkStream,
+    VkValidationFlagsEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->disabledValidationCheckCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkValidationCheckEXT* pDisabledValidationChecks = (VkValidationCheckEXT*)vkStream->allocArray(forUnmarshaling->disabledValidationCheckCount, sizeof(VkValidationCheckEXT));
+        forUnmarshaling->pDisabledValidationChecks = pDisabledValidationChecks;
+        if (pDisabledValidationChecks)
+        {
+            vkStream->read(pDisabledValidationChecks, forUnmarshaling->disabledValidationCheckCount * sizeof(VkValidationCheckEXT));
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_NN_vi_surface
+
+#endif
+
+#ifdef VK_EXT_shader_subgroup_ballot
+
+#endif
+
+#ifdef VK_EXT_shader_subgroup_vote
+
+#endif
+
+#ifdef VK_EXT_conditional_rendering
+
+void marshal_VkConditionalRenderingBeginInfoEXT(
+    VulkanStream* vkStream,
+    const VkConditionalRenderingBeginInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+    vkStream->write(&forMarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->flags, sizeof(VkConditionalRenderingFlagsEXT));
+}
+
+void unmarshal_VkConditionalRenderingBeginInfoEXT(
+    VulkanStream* vkStream,
+    VkConditionalRenderingBeginInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->offset, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkConditionalRenderingFlagsEXT));
+}
+
+
+void marshal_VkPhysicalDeviceConditionalRenderingFeaturesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceConditionalRenderingFeaturesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->conditionalRendering, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->inheritedConditionalRendering, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceConditionalRenderingFeaturesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceConditionalRenderingFeaturesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->conditionalRendering, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->inheritedConditionalRendering, sizeof(VkBool32));
+}
+
+
+void marshal_VkCommandBufferInheritanceConditionalRenderingInfoEXT(
+    VulkanStream* vkStream,
+    const VkCommandBufferInheritanceConditionalRenderingInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->conditionalRenderingEnable, sizeof(VkBool32));
+}
+
+void unmarshal_VkCommandBufferInheritanceConditionalRenderingInfoEXT(
+    VulkanStream* vkStream,
+    VkCommandBufferInheritanceConditionalRenderingInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->conditionalRenderingEnable, sizeof(VkBool32));
+}
+
+
+#endif
+
+#ifdef VK_NVX_device_generated_commands
+
+void marshal_VkDeviceGeneratedCommandsFeaturesNVX(
+    VulkanStream* vkStream,
+    const VkDeviceGeneratedCommandsFeaturesNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->computeBindingPointSupport, sizeof(VkBool32));
+}
+
+void unmarshal_VkDeviceGeneratedCommandsFeaturesNVX(
+    VulkanStream* vkStream,
+    VkDeviceGeneratedCommandsFeaturesNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->computeBindingPointSupport, sizeof(VkBool32));
+}
+
+
+void marshal_VkDeviceGeneratedCommandsLimitsNVX(
+    VulkanStream* vkStream,
+    const VkDeviceGeneratedCommandsLimitsNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->maxIndirectCommandsLayoutTokenCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxObjectEntryCounts, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->minSequenceCountBufferOffsetAlignment, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->minSequenceIndexBufferOffsetAlignment, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->minCommandsTokenBufferOffsetAlignment, sizeof(uint32_t));
+}
+
+void unmarshal_VkDeviceGeneratedCommandsLimitsNVX(
+    VulkanStream* vkStream,
+    VkDeviceGeneratedCommandsLimitsNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->maxIndirectCommandsLayoutTokenCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxObjectEntryCounts, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->minSequenceCountBufferOffsetAlignment, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->minSequenceIndexBufferOffsetAlignment, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->minCommandsTokenBufferOffsetAlignment, sizeof(uint32_t));
+}
+
+
+void marshal_VkIndirectCommandsTokenNVX(
+    VulkanStream* vkStream,
+    const VkIndirectCommandsTokenNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->tokenType, sizeof(VkIndirectCommandsTokenTypeNVX));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+    vkStream->write(&forMarshaling->offset, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkIndirectCommandsTokenNVX(
+    VulkanStream* vkStream,
+    VkIndirectCommandsTokenNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->tokenType, sizeof(VkIndirectCommandsTokenTypeNVX));
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->offset, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkIndirectCommandsLayoutTokenNVX(
+    VulkanStream* vkStream,
+    const VkIndirectCommandsLayoutTokenNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->tokenType, sizeof(VkIndirectCommandsTokenTypeNVX));
+    vkStream->write(&forMarshaling->bindingUnit, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->dynamicCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->divisor, sizeof(uint32_t));
+}
+
+void unmarshal_VkIndirectCommandsLayoutTokenNVX(
+    VulkanStream* vkStream,
+    VkIndirectCommandsLayoutTokenNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->tokenType, sizeof(VkIndirectCommandsTokenTypeNVX));
+    vkStream->read(&forUnmarshaling->bindingUnit, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->dynamicCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->divisor, sizeof(uint32_t));
+}
+
+
+void marshal_VkIndirectCommandsLayoutCreateInfoNVX(
+    VulkanStream* vkStream,
+    const VkIndirectCommandsLayoutCreateInfoNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->write(&forMarshaling->flags, sizeof(VkIndirectCommandsLayoutUsageFlagsNVX));
+    vkStream->write(&forMarshaling->tokenCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pTokens ? 1 : 0);
+    if (forMarshaling->pTokens)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->tokenCount; ++i)
+        {
+            marshal_VkIndirectCommandsLayoutTokenNVX(vkStream, forMarshaling->pTokens + i);
+        }
+    }
+}
+
+void unmarshal_VkIndirectCommandsLayoutCreateInfoNVX(
+    VulkanStream* vkStream,
+    VkIndirectCommandsLayoutCreateInfoNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkIndirectCommandsLayoutUsageFlagsNVX));
+    vkStream->read(&forUnmarshaling->tokenCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkIndirectCommandsLayoutTokenNVX* pTokens = (VkIndirectCommandsLayoutTokenNVX*)vkStream->allocArray(forUnmarshaling->tokenCount, sizeof(VkIndirectCommandsLayoutTokenNVX));
+        forUnmarshaling->pTokens = pTokens;
+        if (pTokens)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->tokenCount; ++i)
+            {
+                unmarshal_VkIndirectCommandsLayoutTokenNVX(vkStream, pTokens + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkCmdProcessCommandsInfoNVX(
+    VulkanStream* vkStream,
+    const VkCmdProcessCommandsInfoNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkObjectTableNVX(forMarshaling->objectTable));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkIndirectCommandsLayoutNVX(forMarshaling->indirectCommandsLayout));
+    vkStream->write(&forMarshaling->indirectCommandsTokenCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pIndirectCommandsTokens ? 1 : 0);
+    if (forMarshaling->pIndirectCommandsTokens)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->indirectCommandsTokenCount; ++i)
+        {
+            marshal_VkIndirectCommandsTokenNVX(vkStream, forMarshaling->pIndirectCommandsTokens + i);
+        }
+    }
+    vkStream->write(&forMarshaling->maxSequencesCount, sizeof(uint32_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(forMarshaling->targetCommandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->sequencesCountBuffer));
+    vkStream->write(&forMarshaling->sequencesCountOffset, sizeof(VkDeviceSize));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->sequencesIndexBuffer));
+    vkStream->write(&forMarshaling->sequencesIndexOffset, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkCmdProcessCommandsInfoNVX(
+    VulkanStream* vkStream,
+    VkCmdProcessCommandsInfoNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->objectTable = vkStream->handleMapping()->fromWire_VkObjectTableNVX(vkStream, vkStream->getU64());
+    forUnmarshaling->indirectCommandsLayout = vkStream->handleMapping()->fromWire_VkIndirectCommandsLayoutNVX(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->indirectCommandsTokenCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkIndirectCommandsTokenNVX* pIndirectCommandsTokens = (VkIndirectCommandsTokenNVX*)vkStream->allocArray(forUnmarshaling->indirectCommandsTokenCount, sizeof(VkIndirectCommandsTokenNVX));
+        forUnmarshaling->pIndirectCommandsTokens = pIndirectCommandsTokens;
+        if (pIndirectCommandsTokens)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->indirectCommandsTokenCount; ++i)
+            {
+                unmarshal_VkIndirectCommandsTokenNVX(vkStream, pIndirectCommandsTokens + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->maxSequencesCount, sizeof(uint32_t));
+    forUnmarshaling->targetCommandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+    forUnmarshaling->sequencesCountBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->sequencesCountOffset, sizeof(VkDeviceSize));
+    forUnmarshaling->sequencesIndexBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->sequencesIndexOffset, sizeof(VkDeviceSize));
+}
+
+
+void marshal_VkCmdReserveSpaceForCommandsInfoNVX(
+    VulkanStream* vkStream,
+    const VkCmdReserveSpaceForCommandsInfoNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkObjectTableNVX(forMarshaling->objectTable));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkIndirectCommandsLayoutNVX(forMarshaling->indirectCommandsLayout));
+    vkStream->write(&forMarshaling->maxSequencesCount, sizeof(uint32_t));
+}
+
+void unmarshal_VkCmdReserveSpaceForCommandsInfoNVX(
+    VulkanStream* vkStream,
+    VkCmdReserveSpaceForCommandsInfoNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->objectTable = vkStream->handleMapping()->fromWire_VkObjectTableNVX(vkStream, vkStream->getU64());
+    forUnmarshaling->indirectCommandsLayout = vkStream->handleMapping()->fromWire_VkIndirectCommandsLayoutNVX(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->maxSequencesCount, sizeof(uint32_t));
+}
+
+
+void marshal_VkObjectTableCreateInfoNVX(
+    VulkanStream* vkStream,
+    const VkObjectTableCreateInfoNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->objectCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pObjectEntryTypes ? 1 : 0);
+    if (forMarshaling->pObjectEntryTypes)
+    {
+        vkStream->write(forMarshaling->pObjectEntryTypes, forMarshaling->objectCount * sizeof(VkObjectEntryTypeNVX));
+    }
+    vkStream->putU32(forMarshaling->pObjectEntryCounts ? 1 : 0);
+    if (forMarshaling->pObjectEntryCounts)
+    {
+        vkStream->write(forMarshaling->pObjectEntryCounts, forMarshaling->objectCount * sizeof(uint32_t));
+    }
+    vkStream->putU32(forMarshaling->pObjectEntryUsageFlags ? 1 : 0);
+    if (forMarshaling->pObjectEntryUsageFlags)
+    {
+        vkStream->write(forMarshaling->pObjectEntryUsageFlags, forMarshaling->objectCount * sizeof(VkObjectEntryUsageFlagsNVX));
+    }
+    vkStream->write(&forMarshaling->maxUniformBuffersPerDescriptor, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxStorageBuffersPerDescriptor, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxStorageImagesPerDescriptor, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxSampledImagesPerDescriptor, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPipelineLayouts, sizeof(uint32_t));
+}
+
+void unmarshal_VkObjectTableCreateInfoNVX(
+    VulkanStream* vkStream,
+    VkObjectTableCreateInfoNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->objectCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkObjectEntryTypeNVX* pObjectEntryTypes = (VkObjectEntryTypeNVX*)vkStream->allocArray(forUnmarshaling->objectCount, sizeof(VkObjectEntryTypeNVX));
+        forUnmarshaling->pObjectEntryTypes = pObjectEntryTypes;
+        if (pObjectEntryTypes)
+        {
+            vkStream->read(pObjectEntryTypes, forUnmarshaling->objectCount * sizeof(VkObjectEntryTypeNVX));
+        }
+    }
+    if (vkStream->getU32())
+    {
+        uint32_t* pObjectEntryCounts = (uint32_t*)vkStream->allocArray(forUnmarshaling->objectCount, sizeof(uint32_t));
+        forUnmarshaling->pObjectEntryCounts = pObjectEntryCounts;
+        if (pObjectEntryCounts)
+        {
+            vkStream->read(pObjectEntryCounts, forUnmarshaling->objectCount * sizeof(uint32_t));
+        }
+    }
+    if (vkStream->getU32())
+    {
+        VkObjectEntryUsageFlagsNVX* pObjectEntryUsageFlags = (VkObjectEntryUsageFlagsNVX*)vkStream->allocArray(forUnmarshaling->objectCount, sizeof(VkObjectEntryUsageFlagsNVX));
+        forUnmarshaling->pObjectEntryUsageFlags = pObjectEntryUsageFlags;
+        if (pObjectEntryUsageFlags)
+        {
+            vkStream->read(pObjectEntryUsageFlags, forUnmarshaling->objectCount * sizeof(VkObjectEntryUsageFlagsNVX));
+        }
+    }
+    vkStream->read(&forUnmarshaling->maxUniformBuffersPerDescriptor, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxStorageBuffersPerDescriptor, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxStorageImagesPerDescriptor, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxSampledImagesPerDescriptor, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPipelineLayouts, sizeof(uint32_t));
+}
+
+
+void marshal_VkObjectTableEntryNVX(
+    VulkanStream* vkStream,
+    const VkObjectTableEntryNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->write(&forMarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+}
+
+void unmarshal_VkObjectTableEntryNVX(
+    VulkanStream* vkStream,
+    VkObjectTableEntryNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+}
+
+
+void marshal_VkObjectTablePipelineEntryNVX(
+    VulkanStream* vkStream,
+    const VkObjectTablePipelineEntryNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->write(&forMarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipeline(forMarshaling->pipeline));
+}
+
+void unmarshal_VkObjectTablePipelineEntryNVX(
+    VulkanStream* vkStream,
+    VkObjectTablePipelineEntryNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    forUnmarshaling->pipeline = vkStream->handleMapping()->fromWire_VkPipeline(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkObjectTableDescriptorSetEntryNVX(
+    VulkanStream* vkStream,
+    const VkObjectTableDescriptorSetEntryNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->write(&forMarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(forMarshaling->pipelineLayout));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSet(forMarshaling->descriptorSet));
+}
+
+void unmarshal_VkObjectTableDescriptorSetEntryNVX(
+    VulkanStream* vkStream,
+    VkObjectTableDescriptorSetEntryNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    forUnmarshaling->pipelineLayout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+    forUnmarshaling->descriptorSet = vkStream->handleMapping()->fromWire_VkDescriptorSet(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkObjectTableVertexBufferEntryNVX(
+    VulkanStream* vkStream,
+    const VkObjectTableVertexBufferEntryNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->write(&forMarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+}
+
+void unmarshal_VkObjectTableVertexBufferEntryNVX(
+    VulkanStream* vkStream,
+    VkObjectTableVertexBufferEntryNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkObjectTableIndexBufferEntryNVX(
+    VulkanStream* vkStream,
+    const VkObjectTableIndexBufferEntryNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->write(&forMarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(forMarshaling->buffer));
+    vkStream->write(&forMarshaling->indexType, sizeof(VkIndexType));
+}
+
+void unmarshal_VkObjectTableIndexBufferEntryNVX(
+    VulkanStream* vkStream,
+    VkObjectTableIndexBufferEntryNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    forUnmarshaling->buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->indexType, sizeof(VkIndexType));
+}
+
+
+void marshal_VkObjectTablePushConstantEntryNVX(
+    VulkanStream* vkStream,
+    const VkObjectTablePushConstantEntryNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->write(&forMarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(forMarshaling->pipelineLayout));
+    vkStream->write(&forMarshaling->stageFlags, sizeof(VkShaderStageFlags));
+}
+
+void unmarshal_VkObjectTablePushConstantEntryNVX(
+    VulkanStream* vkStream,
+    VkObjectTablePushConstantEntryNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->type, sizeof(VkObjectEntryTypeNVX));
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkObjectEntryUsageFlagsNVX));
+    forUnmarshaling->pipelineLayout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+    vkStream->read(&forUnmarshaling->stageFlags, sizeof(VkShaderStageFlags));
+}
+
+
+#endif
+
+#ifdef VK_NV_clip_space_w_scaling
+
+void marshal_VkViewportWScalingNV(
+    VulkanStream* vkStream,
+    const VkViewportWScalingNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->xcoeff, sizeof(float));
+    vkStream->write(&forMarshaling->ycoeff, sizeof(float));
+}
+
+void unmarshal_VkViewportWScalingNV(
+    VulkanStream* vkStream,
+    VkViewportWScalingNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->xcoeff, sizeof(float));
+    vkStream->read(&forUnmarshaling->ycoeff, sizeof(float));
+}
+
+
+void marshal_VkPipelineViewportWScalingStateCreateInfoNV(
+    VulkanStream* vkStream,
+    const VkPipelineViewportWScalingStateCreateInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->viewportWScalingEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->viewportCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pViewportWScalings ? 1 : 0);
+    if (forMarshaling->pViewportWScalings)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->viewportCount; ++i)
+        {
+            marshal_VkViewportWScalingNV(vkStream, forMarshaling->pViewportWScalings + i);
+        }
+    }
+}
+
+void unmarshal_VkPipelineViewportWScalingStateCreateInfoNV(
+    VulkanStream* vkStream,
+    VkPipelineViewportWScalingStateCreateInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->viewportWScalingEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->viewportCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkViewportWScalingNV* pViewportWScalings = (VkViewportWScalingNV*)vkStream->allocArray(forUnmarshaling->viewportCount, sizeof(VkViewportWScalingNV));
+        forUnmarshaling->pViewportWScalings = pViewportWScalings;
+        if (pViewportWScalings)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->viewportCount; ++i)
+            {
+                unmarshal_VkViewportWScalingNV(vkStream, pViewportWScalings + i);
+            }
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_EXT_direct_mode_display
+
+#endif
+
+#ifdef VK_EXT_acquire_xlib_display
+
+#endif
+
+#ifdef VK_EXT_display_surface_counter
+
+void marshal_VkSurfaceCapabilities2EXT(
+    VulkanStream* vkStream,
+    const VkSurfaceCapabilities2EXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->minImageCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxImageCount, sizeof(uint32_t));
+    marshal_VkExtent2D(vkStream, &forMarshaling->currentExtent);
+    marshal_VkExtent2D(vkStream, &forMarshaling->minImageExtent);
+    marshal_VkExtent2D(vkStream, &forMarshaling->maxImageExtent);
+    vkStream->write(&forMarshaling->maxImageArrayLayers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->supportedTransforms, sizeof(VkSurfaceTransformFlagsKHR));
+    vkStream->write(&forMarshaling->currentTransform, sizeof(VkSurfaceTransformFlagBitsKHR));
+    vkStream->write(&forMarshaling->supportedCompositeAlpha, sizeof(VkCompositeAlphaFlagsKHR));
+    vkStream->write(&forMarshaling->supportedUsageFlags, sizeof(VkImageUsageFlags));
+    vkStream->write(&forMarshaling->supportedSurfaceCounters, sizeof(VkSurfaceCounterFlagsEXT));
+}
+
+void unmarshal_VkSurfaceCapabilities2EXT(
+    VulkanStream* vkStream,
+    VkSurfaceCapabilities2EXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->minImageCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxImageCount, sizeof(uint32_t));
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->currentExtent);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->minImageExtent);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->maxImageExtent);
+    vkStream->read(&forUnmarshaling->maxImageArrayLayers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->supportedTransforms, sizeof(VkSurfaceTransformFlagsKHR));
+    vkStream->read(&forUnmarshaling->currentTransform, sizeof(VkSurfaceTransformFlagBitsKHR));
+    vkStream->read(&forUnmarshaling->supportedCompositeAlpha, sizeof(VkCompositeAlphaFlagsKHR));
+    vkStream->read(&forUnmarshaling->supportedUsageFlags, sizeof(VkImageUsageFlags));
+    vkStream->read(&forUnmarshaling->supportedSurfaceCounters, sizeof(VkSurfaceCounterFlagsEXT));
+}
+
+
+#endif
+
+#ifdef VK_EXT_display_control
+
+void marshal_VkDisplayPowerInfoEXT(
+    VulkanStream* vkStream,
+    const VkDisplayPowerInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->powerState, sizeof(VkDisplayPowerStateEXT));
+}
+
+void unmarshal_VkDisplayPowerInfoEXT(
+    VulkanStream* vkStream,
+    VkDisplayPowerInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->powerState, sizeof(VkDisplayPowerStateEXT));
+}
+
+
+void marshal_VkDeviceEventInfoEXT(
+    VulkanStream* vkStream,
+    const VkDeviceEventInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->deviceEvent, sizeof(VkDeviceEventTypeEXT));
+}
+
+void unmarshal_VkDeviceEventInfoEXT(
+    VulkanStream* vkStream,
+    VkDeviceEventInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->deviceEvent, sizeof(VkDeviceEventTypeEXT));
+}
+
+
+void marshal_VkDisplayEventInfoEXT(
+    VulkanStream* vkStream,
+    const VkDisplayEventInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->displayEvent, sizeof(VkDisplayEventTypeEXT));
+}
+
+void unmarshal_VkDisplayEventInfoEXT(
+    VulkanStream* vkStream,
+    VkDisplayEventInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->displayEvent, sizeof(VkDisplayEventTypeEXT));
+}
+
+
+void marshal_VkSwapchainCounterCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkSwapchainCounterCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->surfaceCounters, sizeof(VkSurfaceCounterFlagsEXT));
+}
+
+void unmarshal_VkSwapchainCounterCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkSwapchainCounterCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->surfaceCounters, sizeof(VkSurfaceCounterFlagsEXT));
+}
+
+
+#endif
+
+#ifdef VK_GOOGLE_display_timing
+
+void marshal_VkRefreshCycleDurationGOOGLE(
+    VulkanStream* vkStream,
+    const VkRefreshCycleDurationGOOGLE* forMarshaling)
+{
+    vkStream->write(&forMarshaling->refreshDuration, sizeof(uint64_t));
+}
+
+void unmarshal_VkRefreshCycleDurationGOOGLE(
+    VulkanStream* vkStream,
+    VkRefreshCycleDurationGOOGLE* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->refreshDuration, sizeof(uint64_t));
+}
+
+
+void marshal_VkPastPresentationTimingGOOGLE(
+    VulkanStream* vkStream,
+    const VkPastPresentationTimingGOOGLE* forMarshaling)
+{
+    vkStream->write(&forMarshaling->presentID, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->desiredPresentTime, sizeof(uint64_t));
+    vkStream->write(&forMarshaling->actualPresentTime, sizeof(uint64_t));
+    vkStream->write(&forMarshaling->earliestPresentTime, sizeof(uint64_t));
+    vkStream->write(&forMarshaling->presentMargin, sizeof(uint64_t));
+}
+
+void unmarshal_VkPastPresentationTimingGOOGLE(
+    VulkanStream* vkStream,
+    VkPastPresentationTimingGOOGLE* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->presentID, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->desiredPresentTime, sizeof(uint64_t));
+    vkStream->read(&forUnmarshaling->actualPresentTime, sizeof(uint64_t));
+    vkStream->read(&forUnmarshaling->earliestPresentTime, sizeof(uint64_t));
+    vkStream->read(&forUnmarshaling->presentMargin, sizeof(uint64_t));
+}
+
+
+void marshal_VkPresentTimeGOOGLE(
+    VulkanStream* vkStream,
+    const VkPresentTimeGOOGLE* forMarshaling)
+{
+    vkStream->write(&forMarshaling->presentID, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->desiredPresentTime, sizeof(uint64_t));
+}
+
+void unmarshal_VkPresentTimeGOOGLE(
+    VulkanStream* vkStream,
+    VkPresentTimeGOOGLE* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->presentID, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->desiredPresentTime, sizeof(uint64_t));
+}
+
+
+void marshal_VkPresentTimesInfoGOOGLE(
+    VulkanStream* vkStream,
+    const VkPresentTimesInfoGOOGLE* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->swapchainCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pTimes ? 1 : 0);
+    if (forMarshaling->pTimes)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->swapchainCount; ++i)
+        {
+            marshal_VkPresentTimeGOOGLE(vkStream, forMarshaling->pTimes + i);
+        }
+    }
+}
+
+void unmarshal_VkPresentTimesInfoGOOGLE(
+    VulkanStream* vkStream,
+    VkPresentTimesInfoGOOGLE* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->swapchainCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkPresentTimeGOOGLE* pTimes = (VkPresentTimeGOOGLE*)vkStream->allocArray(forUnmarshaling->swapchainCount, sizeof(VkPresentTimeGOOGLE));
+        forUnmarshaling->pTimes = pTimes;
+        if (pTimes)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->swapchainCount; ++i)
+            {
+                unmarshal_VkPresentTimeGOOGLE(vkStream, pTimes + i);
+            }
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_NV_sample_mask_override_coverage
+
+#endif
+
+#ifdef VK_NV_geometry_shader_passthrough
+
+#endif
+
+#ifdef VK_NV_viewport_array2
+
+#endif
+
+#ifdef VK_NVX_multiview_per_view_attributes
+
+void marshal_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->perViewPositionAllComponents, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->perViewPositionAllComponents, sizeof(VkBool32));
+}
+
+
+#endif
+
+#ifdef VK_NV_viewport_swizzle
+
+void marshal_VkViewportSwizzleNV(
+    VulkanStream* vkStream,
+    const VkViewportSwizzleNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->x, sizeof(VkViewportCoordinateSwizzleNV));
+    vkStream->write(&forMarshaling->y, sizeof(VkViewportCoordinateSwizzleNV));
+    vkStream->write(&forMarshaling->z, sizeof(VkViewportCoordinateSwizzleNV));
+    vkStream->write(&forMarshaling->w, sizeof(VkViewportCoordinateSwizzleNV));
+}
+
+void unmarshal_VkViewportSwizzleNV(
+    VulkanStream* vkStream,
+    VkViewportSwizzleNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->x, sizeof(VkViewportCoordinateSwizzleNV));
+    vkStream->read(&forUnmarshaling->y, sizeof(VkViewportCoordinateSwizzleNV));
+    vkStream->read(&forUnmarshaling->z, sizeof(VkViewportCoordinateSwizzleNV));
+    vkStream->read(&forUnmarshaling->w, sizeof(VkViewportCoordinateSwizzleNV));
+}
+
+
+void marshal_VkPipelineViewportSwizzleStateCreateInfoNV(
+    VulkanStream* vkStream,
+    const VkPipelineViewportSwizzleStateCreateInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineViewportSwizzleStateCreateFlagsNV));
+    vkStream->write(&forMarshaling->viewportCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pViewportSwizzles ? 1 : 0);
+    if (forMarshaling->pViewportSwizzles)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->viewportCount; ++i)
+        {
+            marshal_VkViewportSwizzleNV(vkStream, forMarshaling->pViewportSwizzles + i);
+        }
+    }
+}
+
+void unmarshal_VkPipelineViewportSwizzleStateCreateInfoNV(
+    VulkanStream* vkStream,
+    VkPipelineViewportSwizzleStateCreateInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineViewportSwizzleStateCreateFlagsNV));
+    vkStream->read(&forUnmarshaling->viewportCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkViewportSwizzleNV* pViewportSwizzles = (VkViewportSwizzleNV*)vkStream->allocArray(forUnmarshaling->viewportCount, sizeof(VkViewportSwizzleNV));
+        forUnmarshaling->pViewportSwizzles = pViewportSwizzles;
+        if (pViewportSwizzles)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->viewportCount; ++i)
+            {
+                unmarshal_VkViewportSwizzleNV(vkStream, pViewportSwizzles + i);
+            }
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_EXT_discard_rectangles
+
+void marshal_VkPhysicalDeviceDiscardRectanglePropertiesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceDiscardRectanglePropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->maxDiscardRectangles, sizeof(uint32_t));
+}
+
+void unmarshal_VkPhysicalDeviceDiscardRectanglePropertiesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceDiscardRectanglePropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->maxDiscardRectangles, sizeof(uint32_t));
+}
+
+
+void marshal_VkPipelineDiscardRectangleStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkPipelineDiscardRectangleStateCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineDiscardRectangleStateCreateFlagsEXT));
+    vkStream->write(&forMarshaling->discardRectangleMode, sizeof(VkDiscardRectangleModeEXT));
+    vkStream->write(&forMarshaling->discardRectangleCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDiscardRectangles ? 1 : 0);
+    if (forMarshaling->pDiscardRectangles)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->discardRectangleCount; ++i)
+        {
+            marshal_VkRect2D(vkStream, forMarshaling->pDiscardRectangles + i);
+        }
+    }
+}
+
+void unmarshal_VkPipelineDiscardRectangleStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkPipelineDiscardRectangleStateCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineDiscardRectangleStateCreateFlagsEXT));
+    vkStream->read(&forUnmarshaling->discardRectangleMode, sizeof(VkDiscardRectangleModeEXT));
+    vkStream->read(&forUnmarshaling->discardRectangleCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkRect2D* pDiscardRectangles = (VkRect2D*)vkStream->allocArray(forUnmarshaling->discardRectangleCount, sizeof(VkRect2D));
+        forUnmarshaling->pDiscardRectangles = pDiscardRectangles;
+        if (pDiscardRectangles)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->discardRectangleCount; ++i)
+            {
+                unmarshal_VkRect2D(vkStream, pDiscardRectangles + i);
+            }
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_EXT_conservative_rasterization
+
+void marshal_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceConservativeRasterizationPropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->primitiveOverestimationSize, sizeof(float));
+    vkStream->write(&forMarshaling->maxExtraPrimitiveOverestimationSize, sizeof(float));
+    vkStream->write(&forMarshaling->extraPrimitiveOverestimationSizeGranularity, sizeof(float));
+    vkStream->write(&forMarshaling->primitiveUnderestimation, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->conservativePointAndLineRasterization, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->degenerateTrianglesRasterized, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->degenerateLinesRasterized, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->fullyCoveredFragmentShaderInputVariable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->conservativeRasterizationPostDepthCoverage, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceConservativeRasterizationPropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->primitiveOverestimationSize, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxExtraPrimitiveOverestimationSize, sizeof(float));
+    vkStream->read(&forUnmarshaling->extraPrimitiveOverestimationSizeGranularity, sizeof(float));
+    vkStream->read(&forUnmarshaling->primitiveUnderestimation, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->conservativePointAndLineRasterization, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->degenerateTrianglesRasterized, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->degenerateLinesRasterized, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->fullyCoveredFragmentShaderInputVariable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->conservativeRasterizationPostDepthCoverage, sizeof(VkBool32));
+}
+
+
+void marshal_VkPipelineRasterizationConservativeStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkPipelineRasterizationConservativeStateCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineRasterizationConservativeStateCreateFlagsEXT));
+    vkStream->write(&forMarshaling->conservativeRasterizationMode, sizeof(VkConservativeRasterizationModeEXT));
+    vkStream->write(&forMarshaling->extraPrimitiveOverestimationSize, sizeof(float));
+}
+
+void unmarshal_VkPipelineRasterizationConservativeStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkPipelineRasterizationConservativeStateCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineRasterizationConservativeStateCreateFlagsEXT));
+    vkStream->read(&forUnmarshaling->conservativeRasterizationMode, sizeof(VkConservativeRasterizationModeEXT));
+    vkStream->read(&forUnmarshaling->extraPrimitiveOverestimationSize, sizeof(float));
+}
+
+
+#endif
+
+#ifdef VK_EXT_swapchain_colorspace
+
+#endif
+
+#ifdef VK_EXT_hdr_metadata
+
+void marshal_VkXYColorEXT(
+    VulkanStream* vkStream,
+    const VkXYColorEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->x, sizeof(float));
+    vkStream->write(&forMarshaling->y, sizeof(float));
+}
+
+void unmarshal_VkXYColorEXT(
+    VulkanStream* vkStream,
+    VkXYColorEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->x, sizeof(float));
+    vkStream->read(&forUnmarshaling->y, sizeof(float));
+}
+
+
+void marshal_VkHdrMetadataEXT(
+    VulkanStream* vkStream,
+    const VkHdrMetadataEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkXYColorEXT(vkStream, &forMarshaling->displayPrimaryRed);
+    marshal_VkXYColorEXT(vkStream, &forMarshaling->displayPrimaryGreen);
+    marshal_VkXYColorEXT(vkStream, &forMarshaling->displayPrimaryBlue);
+    marshal_VkXYColorEXT(vkStream, &forMarshaling->whitePoint);
+    vkStream->write(&forMarshaling->maxLuminance, sizeof(float));
+    vkStream->write(&forMarshaling->minLuminance, sizeof(float));
+    vkStream->write(&forMarshaling->maxContentLightLevel, sizeof(float));
+    vkStream->write(&forMarshaling->maxFrameAverageLightLevel, sizeof(float));
+}
+
+void unmarshal_VkHdrMetadataEXT(
+    VulkanStream* vkStream,
+    VkHdrMetadataEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkXYColorEXT(vkStream, &forUnmarshaling->displayPrimaryRed);
+    unmarshal_VkXYColorEXT(vkStream, &forUnmarshaling->displayPrimaryGreen);
+    unmarshal_VkXYColorEXT(vkStream, &forUnmarshaling->displayPrimaryBlue);
+    unmarshal_VkXYColorEXT(vkStream, &forUnmarshaling->whitePoint);
+    vkStream->read(&forUnmarshaling->maxLuminance, sizeof(float));
+    vkStream->read(&forUnmarshaling->minLuminance, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxContentLightLevel, sizeof(float));
+    vkStream->read(&forUnmarshaling->maxFrameAverageLightLevel, sizeof(float));
+}
+
+
+#endif
+
+#ifdef VK_MVK_ios_surface
+
+#endif
+
+#ifdef VK_MVK_macos_surface
+
+#endif
+
+#ifdef VK_EXT_external_memory_dma_buf
+
+#endif
+
+#ifdef VK_EXT_queue_family_foreign
+
+#endif
+
+#ifdef VK_EXT_debug_utils
+
+void marshal_VkDebugUtilsObjectNameInfoEXT(
+    VulkanStream* vkStream,
+    const VkDebugUtilsObjectNameInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->objectType, sizeof(VkObjectType));
+    vkStream->write(&forMarshaling->objectHandle, sizeof(uint64_t));
+    vkStream->putString(forMarshaling->pObjectName);
+}
+
+void unmarshal_VkDebugUtilsObjectNameInfoEXT(
+    VulkanStream* vkStream,
+    VkDebugUtilsObjectNameInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->objectType, sizeof(VkObjectType));
+    vkStream->read(&forUnmarshaling->objectHandle, sizeof(uint64_t));
+    forUnmarshaling->pObjectName = vkStream->getString();
+}
+
+
+void marshal_VkDebugUtilsObjectTagInfoEXT(
+    VulkanStream* vkStream,
+    const VkDebugUtilsObjectTagInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->objectType, sizeof(VkObjectType));
+    vkStream->write(&forMarshaling->objectHandle, sizeof(uint64_t));
+    vkStream->write(&forMarshaling->tagName, sizeof(uint64_t));
+    vkStream->putU64((uint64_t)forMarshaling->tagSize);
+    vkStream->putU32(forMarshaling->pTag ? 1 : 0);
+    if (forMarshaling->pTag)
+    {
+        vkStream->write(forMarshaling->pTag, forMarshaling->tagSize * sizeof(uint8_t));
+    }
+}
+
+void unmarshal_VkDebugUtilsObjectTagInfoEXT(
+    VulkanStream* vkStream,
+    VkDebugUtilsObjectTagInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->objectType, sizeof(VkObjectType));
+    vkStream->read(&forUnmarshaling->objectHandle, sizeof(uint64_t));
+    vkStream->read(&forUnmarshaling->tagName, sizeof(uint64_t));
+    forUnmarshaling->tagSize = (size_t)vkStream->getU64();
+    if (vkStream->getU32())
+    {
+        uint8_t* pTag = (uint8_t*)vkStream->allocArray(forUnmarshaling->tagSize, sizeof(uint8_t));
+        forUnmarshaling->pTag = pTag;
+        if (pTag)
+        {
+            vkStream->read(pTag, forUnmarshaling->tagSize * sizeof(uint8_t));
+        }
+    }
+}
+
+
+void marshal_VkDebugUtilsLabelEXT(
+    VulkanStream* vkStream,
+    const VkDebugUtilsLabelEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putString(forMarshaling->pLabelName);
+    vkStream->write(forMarshaling->color, 4 * sizeof(float));
+}
+
+void unmarshal_VkDebugUtilsLabelEXT(
+    VulkanStream* vkStream,
+    VkDebugUtilsLabelEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->pLabelName = vkStream->getString();
+    vkStream->read(forUnmarshaling->color, 4 * sizeof(float));
+}
+
+
+void marshal_VkDebugUtilsMessengerCallbackDataEXT(
+    VulkanStream* vkStream,
+    const VkDebugUtilsMessengerCallbackDataEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkDebugUtilsMessengerCallbackDataFlagsEXT));
+    vkStream->putString(forMarshaling->pMessageIdName);
+    vkStream->write(&forMarshaling->messageIdNumber, sizeof(int32_t));
+    vkStream->putString(forMarshaling->pMessage);
+    vkStream->write(&forMarshaling->queueLabelCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pQueueLabels ? 1 : 0);
+    if (forMarshaling->pQueueLabels)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->queueLabelCount; ++i)
+        {
+            marshal_VkDebugUtilsLabelEXT(vkStream, forMarshaling->pQueueLabels + i);
+        }
+    }
+    vkStream->write(&forMarshaling->cmdBufLabelCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pCmdBufLabels ? 1 : 0);
+    if (forMarshaling->pCmdBufLabels)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->cmdBufLabelCount; ++i)
+        {
+            marshal_VkDebugUtilsLabelEXT(vkStream, forMarshaling->pCmdBufLabels + i);
+        }
+    }
+    vkStream->write(&forMarshaling->objectCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pObjects ? 1 : 0);
+    if (forMarshaling->pObjects)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->objectCount; ++i)
+        {
+            marshal_VkDebugUtilsObjectNameInfoEXT(vkStream, forMarshaling->pObjects + i);
+        }
+    }
+}
+
+void unmarshal_VkDebugUtilsMessengerCallbackDataEXT(
+    VulkanStream* vkStream,
+    VkDebugUtilsMessengerCallbackDataEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkDebugUtilsMessengerCallbackDataFlagsEXT));
+    forUnmarshaling->pMessageIdName = vkStream->getString();
+    vkStream->read(&forUnmarshaling->messageIdNumber, sizeof(int32_t));
+    forUnmarshaling->pMessage = vkStream->getString();
+    vkStream->read(&forUnmarshaling->queueLabelCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDebugUtilsLabelEXT* pQueueLabels = (VkDebugUtilsLabelEXT*)vkStream->allocArray(forUnmarshaling->queueLabelCount, sizeof(VkDebugUtilsLabelEXT));
+        forUnmarshaling->pQueueLabels = pQueueLabels;
+        if (pQueueLabels)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->queueLabelCount; ++i)
+            {
+                unmarshal_VkDebugUtilsLabelEXT(vkStream, pQueueLabels + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->cmdBufLabelCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDebugUtilsLabelEXT* pCmdBufLabels = (VkDebugUtilsLabelEXT*)vkStream->allocArray(forUnmarshaling->cmdBufLabelCount, sizeof(VkDebugUtilsLabelEXT));
+        forUnmarshaling->pCmdBufLabels = pCmdBufLabels;
+        if (pCmdBufLabels)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->cmdBufLabelCount; ++i)
+            {
+                unmarshal_VkDebugUtilsLabelEXT(vkStream, pCmdBufLabels + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->objectCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDebugUtilsObjectNameInfoEXT* pObjects = (VkDebugUtilsObjectNameInfoEXT*)vkStream->allocArray(forUnmarshaling->objectCount, sizeof(VkDebugUtilsObjectNameInfoEXT));
+        forUnmarshaling->pObjects = pObjects;
+        if (pObjects)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->objectCount; ++i)
+            {
+                unmarshal_VkDebugUtilsObjectNameInfoEXT(vkStream, pObjects + i);
+            }
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_ANDROID_external_memory_android_hardware_buffer
+
+void marshal_VkAndroidHardwareBufferUsageANDROID(
+    VulkanStream* vkStream,
+    const VkAndroidHardwareBufferUsageANDROID* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->androidHardwareBufferUsage, sizeof(uint64_t));
+}
+
+void unmarshal_VkAndroidHardwareBufferUsageANDROID(
+    VulkanStream* vkStream,
+    VkAndroidHardwareBufferUsageANDROID* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->androidHardwareBufferUsage, sizeof(uint64_t));
+}
+
+
+void marshal_VkAndroidHardwareBufferPropertiesANDROID(
+    VulkanStream* vkStream,
+    const VkAndroidHardwareBufferPropertiesANDROID* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->allocationSize, sizeof(VkDeviceSize));
+    vkStream->write(&forMarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+void unmarshal_VkAndroidHardwareBufferPropertiesANDROID(
+    VulkanStream* vkStream,
+    VkAndroidHardwareBufferPropertiesANDROID* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->allocationSize, sizeof(VkDeviceSize));
+    vkStream->read(&forUnmarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+
+void marshal_VkAndroidHardwareBufferFormatPropertiesANDROID(
+    VulkanStream* vkStream,
+    const VkAndroidHardwareBufferFormatPropertiesANDROID* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->format, sizeof(VkFormat));
+    vkStream->write(&forMarshaling->externalFormat, sizeof(uint64_t));
+    vkStream->write(&forMarshaling->formatFeatures, sizeof(VkFormatFeatureFlags));
+    marshal_VkComponentMapping(vkStream, &forMarshaling->samplerYcbcrConversionComponents);
+    vkStream->write(&forMarshaling->suggestedYcbcrModel, sizeof(VkSamplerYcbcrModelConversion));
+    vkStream->write(&forMarshaling->suggestedYcbcrRange, sizeof(VkSamplerYcbcrRange));
+    vkStream->write(&forMarshaling->suggestedXChromaOffset, sizeof(VkChromaLocation));
+    vkStream->write(&forMarshaling->suggestedYChromaOffset, sizeof(VkChromaLocation));
+}
+
+void unmarshal_VkAndroidHardwareBufferFormatPropertiesANDROID(
+    VulkanStream* vkStream,
+    VkAndroidHardwareBufferFormatPropertiesANDROID* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->format, sizeof(VkFormat));
+    vkStream->read(&forUnmarshaling->externalFormat, sizeof(uint64_t));
+    vkStream->read(&forUnmarshaling->formatFeatures, sizeof(VkFormatFeatureFlags));
+    unmarshal_VkComponentMapping(vkStream, &forUnmarshaling->samplerYcbcrConversionComponents);
+    vkStream->read(&forUnmarshaling->suggestedYcbcrModel, sizeof(VkSamplerYcbcrModelConversion));
+    vkStream->read(&forUnmarshaling->suggestedYcbcrRange, sizeof(VkSamplerYcbcrRange));
+    vkStream->read(&forUnmarshaling->suggestedXChromaOffset, sizeof(VkChromaLocation));
+    vkStream->read(&forUnmarshaling->suggestedYChromaOffset, sizeof(VkChromaLocation));
+}
+
+
+void marshal_VkMemoryGetAndroidHardwareBufferInfoANDROID(
+    VulkanStream* vkStream,
+    const VkMemoryGetAndroidHardwareBufferInfoANDROID* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(forMarshaling->memory));
+}
+
+void unmarshal_VkMemoryGetAndroidHardwareBufferInfoANDROID(
+    VulkanStream* vkStream,
+    VkMemoryGetAndroidHardwareBufferInfoANDROID* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+}
+
+
+void marshal_VkExternalFormatANDROID(
+    VulkanStream* vkStream,
+    const VkExternalFormatANDROID* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->externalFormat, sizeof(uint64_t));
+}
+
+void unmarshal_VkExternalFormatANDROID(
+    VulkanStream* vkStream,
+    VkExternalFormatANDROID* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->externalFormat, sizeof(uint64_t));
+}
+
+
+#endif
+
+#ifdef VK_EXT_sampler_filter_minmax
+
+void marshal_VkSamplerReductionModeCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkSamplerReductionModeCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->reductionMode, sizeof(VkSamplerReductionModeEXT));
+}
+
+void unmarshal_VkSamplerReductionModeCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkSamplerReductionModeCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->reductionMode, sizeof(VkSamplerReductionModeEXT));
+}
+
+
+void marshal_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->filterMinmaxSingleComponentFormats, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->filterMinmaxImageComponentMapping, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->filterMinmaxSingleComponentFormats, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->filterMinmaxImageComponentMapping, sizeof(VkBool32));
+}
+
+
+#endif
+
+#ifdef VK_AMD_gpu_shader_int16
+
+#endif
+
+#ifdef VK_AMD_mixed_attachment_samples
+
+#endif
+
+#ifdef VK_AMD_shader_fragment_mask
+
+#endif
+
+#ifdef VK_EXT_shader_stencil_export
+
+#endif
+
+#ifdef VK_EXT_sample_locations
+
+void marshal_VkSampleLocationEXT(
+    VulkanStream* vkStream,
+    const VkSampleLocationEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->x, sizeof(float));
+    vkStream->write(&forMarshaling->y, sizeof(float));
+}
+
+void unmarshal_VkSampleLocationEXT(
+    VulkanStream* vkStream,
+    VkSampleLocationEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->x, sizeof(float));
+    vkStream->read(&forUnmarshaling->y, sizeof(float));
+}
+
+
+void marshal_VkSampleLocationsInfoEXT(
+    VulkanStream* vkStream,
+    const VkSampleLocationsInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->sampleLocationsPerPixel, sizeof(VkSampleCountFlagBits));
+    marshal_VkExtent2D(vkStream, &forMarshaling->sampleLocationGridSize);
+    vkStream->write(&forMarshaling->sampleLocationsCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pSampleLocations ? 1 : 0);
+    if (forMarshaling->pSampleLocations)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->sampleLocationsCount; ++i)
+        {
+            marshal_VkSampleLocationEXT(vkStream, forMarshaling->pSampleLocations + i);
+        }
+    }
+}
+
+void unmarshal_VkSampleLocationsInfoEXT(
+    VulkanStream* vkStream,
+    VkSampleLocationsInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->sampleLocationsPerPixel, sizeof(VkSampleCountFlagBits));
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->sampleLocationGridSize);
+    vkStream->read(&forUnmarshaling->sampleLocationsCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSampleLocationEXT* pSampleLocations = (VkSampleLocationEXT*)vkStream->allocArray(forUnmarshaling->sampleLocationsCount, sizeof(VkSampleLocationEXT));
+        forUnmarshaling->pSampleLocations = pSampleLocations;
+        if (pSampleLocations)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->sampleLocationsCount; ++i)
+            {
+                unmarshal_VkSampleLocationEXT(vkStream, pSampleLocations + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkAttachmentSampleLocationsEXT(
+    VulkanStream* vkStream,
+    const VkAttachmentSampleLocationsEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->attachmentIndex, sizeof(uint32_t));
+    marshal_VkSampleLocationsInfoEXT(vkStream, &forMarshaling->sampleLocationsInfo);
+}
+
+void unmarshal_VkAttachmentSampleLocationsEXT(
+    VulkanStream* vkStream,
+    VkAttachmentSampleLocationsEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->attachmentIndex, sizeof(uint32_t));
+    unmarshal_VkSampleLocationsInfoEXT(vkStream, &forUnmarshaling->sampleLocationsInfo);
+}
+
+
+void marshal_VkSubpassSampleLocationsEXT(
+    VulkanStream* vkStream,
+    const VkSubpassSampleLocationsEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->subpassIndex, sizeof(uint32_t));
+    marshal_VkSampleLocationsInfoEXT(vkStream, &forMarshaling->sampleLocationsInfo);
+}
+
+void unmarshal_VkSubpassSampleLocationsEXT(
+    VulkanStream* vkStream,
+    VkSubpassSampleLocationsEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->subpassIndex, sizeof(uint32_t));
+    unmarshal_VkSampleLocationsInfoEXT(vkStream, &forUnmarshaling->sampleLocationsInfo);
+}
+
+
+void marshal_VkRenderPassSampleLocationsBeginInfoEXT(
+    VulkanStream* vkStream,
+    const VkRenderPassSampleLocationsBeginInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->attachmentInitialSampleLocationsCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pAttachmentInitialSampleLocations ? 1 : 0);
+    if (forMarshaling->pAttachmentInitialSampleLocations)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->attachmentInitialSampleLocationsCount; ++i)
+        {
+            marshal_VkAttachmentSampleLocationsEXT(vkStream, forMarshaling->pAttachmentInitialSampleLocations + i);
+        }
+    }
+    vkStream->write(&forMarshaling->postSubpassSampleLocationsCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pPostSubpassSampleLocations ? 1 : 0);
+    if (forMarshaling->pPostSubpassSampleLocations)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->postSubpassSampleLocationsCount; ++i)
+        {
+            marshal_VkSubpassSampleLocationsEXT(vkStream, forMarshaling->pPostSubpassSampleLocations + i);
+        }
+    }
+}
+
+void unmarshal_VkRenderPassSampleLocationsBeginInfoEXT(
+    VulkanStream* vkStream,
+    VkRenderPassSampleLocationsBeginInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->attachmentInitialSampleLocationsCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkAttachmentSampleLocationsEXT* pAttachmentInitialSampleLocations = (VkAttachmentSampleLocationsEXT*)vkStream->allocArray(forUnmarshaling->attachmentInitialSampleLocationsCount, sizeof(VkAttachmentSampleLocationsEXT));
+        forUnmarshaling->pAttachmentInitialSampleLocations = pAttachmentInitialSampleLocations;
+        if (pAttachmentInitialSampleLocations)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->attachmentInitialSampleLocationsCount; ++i)
+            {
+                unmarshal_VkAttachmentSampleLocationsEXT(vkStream, pAttachmentInitialSampleLocations + i);
+            }
+        }
+    }
+    vkStream->read(&forUnmarshaling->postSubpassSampleLocationsCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkSubpassSampleLocationsEXT* pPostSubpassSampleLocations = (VkSubpassSampleLocationsEXT*)vkStream->allocArray(forUnmarshaling->postSubpassSampleLocationsCount, sizeof(VkSubpassSampleLocationsEXT));
+        forUnmarshaling->pPostSubpassSampleLocations = pPostSubpassSampleLocations;
+        if (pPostSubpassSampleLocations)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->postSubpassSampleLocationsCount; ++i)
+            {
+                unmarshal_VkSubpassSampleLocationsEXT(vkStream, pPostSubpassSampleLocations + i);
+            }
+        }
+    }
+}
+
+
+void marshal_VkPipelineSampleLocationsStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkPipelineSampleLocationsStateCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->sampleLocationsEnable, sizeof(VkBool32));
+    marshal_VkSampleLocationsInfoEXT(vkStream, &forMarshaling->sampleLocationsInfo);
+}
+
+void unmarshal_VkPipelineSampleLocationsStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkPipelineSampleLocationsStateCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->sampleLocationsEnable, sizeof(VkBool32));
+    unmarshal_VkSampleLocationsInfoEXT(vkStream, &forUnmarshaling->sampleLocationsInfo);
+}
+
+
+void marshal_VkPhysicalDeviceSampleLocationsPropertiesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceSampleLocationsPropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->sampleLocationSampleCounts, sizeof(VkSampleCountFlags));
+    marshal_VkExtent2D(vkStream, &forMarshaling->maxSampleLocationGridSize);
+    vkStream->write(forMarshaling->sampleLocationCoordinateRange, 2 * sizeof(float));
+    vkStream->write(&forMarshaling->sampleLocationSubPixelBits, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->variableSampleLocations, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceSampleLocationsPropertiesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceSampleLocationsPropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->sampleLocationSampleCounts, sizeof(VkSampleCountFlags));
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->maxSampleLocationGridSize);
+    vkStream->read(forUnmarshaling->sampleLocationCoordinateRange, 2 * sizeof(float));
+    vkStream->read(&forUnmarshaling->sampleLocationSubPixelBits, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->variableSampleLocations, sizeof(VkBool32));
+}
+
+
+void marshal_VkMultisamplePropertiesEXT(
+    VulkanStream* vkStream,
+    const VkMultisamplePropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    marshal_VkExtent2D(vkStream, &forMarshaling->maxSampleLocationGridSize);
+}
+
+void unmarshal_VkMultisamplePropertiesEXT(
+    VulkanStream* vkStream,
+    VkMultisamplePropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    unmarshal_VkExtent2D(vkStream, &forUnmarshaling->maxSampleLocationGridSize);
+}
+
+
+#endif
+
+#ifdef VK_EXT_blend_operation_advanced
+
+void marshal_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->advancedBlendCoherentOperations, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->advancedBlendCoherentOperations, sizeof(VkBool32));
+}
+
+
+void marshal_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->advancedBlendMaxColorAttachments, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->advancedBlendIndependentBlend, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->advancedBlendNonPremultipliedSrcColor, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->advancedBlendNonPremultipliedDstColor, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->advancedBlendCorrelatedOverlap, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->advancedBlendAllOperations, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->advancedBlendMaxColorAttachments, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->advancedBlendIndependentBlend, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->advancedBlendNonPremultipliedSrcColor, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->advancedBlendNonPremultipliedDstColor, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->advancedBlendCorrelatedOverlap, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->advancedBlendAllOperations, sizeof(VkBool32));
+}
+
+
+void marshal_VkPipelineColorBlendAdvancedStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkPipelineColorBlendAdvancedStateCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->srcPremultiplied, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->dstPremultiplied, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->blendOverlap, sizeof(VkBlendOverlapEXT));
+}
+
+void unmarshal_VkPipelineColorBlendAdvancedStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkPipelineColorBlendAdvancedStateCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->srcPremultiplied, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->dstPremultiplied, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->blendOverlap, sizeof(VkBlendOverlapEXT));
+}
+
+
+#endif
+
+#ifdef VK_NV_fragment_coverage_to_color
+
+void marshal_VkPipelineCoverageToColorStateCreateInfoNV(
+    VulkanStream* vkStream,
+    const VkPipelineCoverageToColorStateCreateInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineCoverageToColorStateCreateFlagsNV));
+    vkStream->write(&forMarshaling->coverageToColorEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->coverageToColorLocation, sizeof(uint32_t));
+}
+
+void unmarshal_VkPipelineCoverageToColorStateCreateInfoNV(
+    VulkanStream* vkStream,
+    VkPipelineCoverageToColorStateCreateInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineCoverageToColorStateCreateFlagsNV));
+    vkStream->read(&forUnmarshaling->coverageToColorEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->coverageToColorLocation, sizeof(uint32_t));
+}
+
+
+#endif
+
+#ifdef VK_NV_framebuffer_mixed_samples
+
+void marshal_VkPipelineCoverageModulationStateCreateInfoNV(
+    VulkanStream* vkStream,
+    const VkPipelineCoverageModulationStateCreateInfoNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkPipelineCoverageModulationStateCreateFlagsNV));
+    vkStream->write(&forMarshaling->coverageModulationMode, sizeof(VkCoverageModulationModeNV));
+    vkStream->write(&forMarshaling->coverageModulationTableEnable, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->coverageModulationTableCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pCoverageModulationTable ? 1 : 0);
+    if (forMarshaling->pCoverageModulationTable)
+    {
+        vkStream->write(forMarshaling->pCoverageModulationTable, forMarshaling->coverageModulationTableCount * sizeof(float));
+    }
+}
+
+void unmarshal_VkPipelineCoverageModulationStateCreateInfoNV(
+    VulkanStream* vkStream,
+    VkPipelineCoverageModulationStateCreateInfoNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkPipelineCoverageModulationStateCreateFlagsNV));
+    vkStream->read(&forUnmarshaling->coverageModulationMode, sizeof(VkCoverageModulationModeNV));
+    vkStream->read(&forUnmarshaling->coverageModulationTableEnable, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->coverageModulationTableCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        float* pCoverageModulationTable = (float*)vkStream->allocArray(forUnmarshaling->coverageModulationTableCount, sizeof(float));
+        forUnmarshaling->pCoverageModulationTable = pCoverageModulationTable;
+        if (pCoverageModulationTable)
+        {
+            vkStream->read(pCoverageModulationTable, forUnmarshaling->coverageModulationTableCount * sizeof(float));
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_NV_fill_rectangle
+
+#endif
+
+#ifdef VK_EXT_post_depth_coverage
+
+#endif
+
+#ifdef VK_EXT_validation_cache
+
+void marshal_VkValidationCacheCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkValidationCacheCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->flags, sizeof(VkValidationCacheCreateFlagsEXT));
+    vkStream->putU64((uint64_t)forMarshaling->initialDataSize);
+    vkStream->putU32(forMarshaling->pInitialData ? 1 : 0);
+    if (forMarshaling->pInitialData)
+    {
+        vkStream->write(forMarshaling->pInitialData, forMarshaling->initialDataSize * sizeof(uint8_t));
+    }
+}
+
+void unmarshal_VkValidationCacheCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkValidationCacheCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->flags, sizeof(VkValidationCacheCreateFlagsEXT));
+    forUnmarshaling->initialDataSize = (size_t)vkStream->getU64();
+    if (vkStream->getU32())
+    {
+        uint8_t* pInitialData = (uint8_t*)vkStream->allocArray(forUnmarshaling->initialDataSize, sizeof(uint8_t));
+        forUnmarshaling->pInitialData = pInitialData;
+        if (pInitialData)
+        {
+            vkStream->read(pInitialData, forUnmarshaling->initialDataSize * sizeof(uint8_t));
+        }
+    }
+}
+
+
+void marshal_VkShaderModuleValidationCacheCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkShaderModuleValidationCacheCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkValidationCacheEXT(forMarshaling->validationCache));
+}
+
+void unmarshal_VkShaderModuleValidationCacheCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkShaderModuleValidationCacheCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    forUnmarshaling->validationCache = vkStream->handleMapping()->fromWire_VkValidationCacheEXT(vkStream, vkStream->getU64());
+}
+
+
+#endif
+
+#ifdef VK_EXT_descriptor_indexing
+
+void marshal_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkDescriptorSetLayoutBindingFlagsCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->bindingCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pBindingFlags ? 1 : 0);
+    if (forMarshaling->pBindingFlags)
+    {
+        vkStream->write(forMarshaling->pBindingFlags, forMarshaling->bindingCount * sizeof(VkDescriptorBindingFlagsEXT));
+    }
+}
+
+void unmarshal_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->bindingCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkDescriptorBindingFlagsEXT* pBindingFlags = (VkDescriptorBindingFlagsEXT*)vkStream->allocArray(forUnmarshaling->bindingCount, sizeof(VkDescriptorBindingFlagsEXT));
+        forUnmarshaling->pBindingFlags = pBindingFlags;
+        if (pBindingFlags)
+        {
+            vkStream->read(pBindingFlags, forUnmarshaling->bindingCount * sizeof(VkDescriptorBindingFlagsEXT));
+        }
+    }
+}
+
+
+void marshal_VkPhysicalDeviceDescriptorIndexingFeaturesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceDescriptorIndexingFeaturesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->shaderInputAttachmentArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderUniformTexelBufferArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageTexelBufferArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderUniformBufferArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderSampledImageArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageBufferArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageImageArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderInputAttachmentArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderUniformTexelBufferArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageTexelBufferArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->descriptorBindingUniformBufferUpdateAfterBind, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->descriptorBindingSampledImageUpdateAfterBind, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->descriptorBindingStorageImageUpdateAfterBind, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->descriptorBindingStorageBufferUpdateAfterBind, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->descriptorBindingUniformTexelBufferUpdateAfterBind, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->descriptorBindingStorageTexelBufferUpdateAfterBind, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->descriptorBindingUpdateUnusedWhilePending, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->descriptorBindingPartiallyBound, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->descriptorBindingVariableDescriptorCount, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->runtimeDescriptorArray, sizeof(VkBool32));
+}
+
+void unmarshal_VkPhysicalDeviceDescriptorIndexingFeaturesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceDescriptorIndexingFeaturesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->shaderInputAttachmentArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderUniformTexelBufferArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageTexelBufferArrayDynamicIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderUniformBufferArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderSampledImageArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageBufferArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageImageArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderInputAttachmentArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderUniformTexelBufferArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageTexelBufferArrayNonUniformIndexing, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->descriptorBindingUniformBufferUpdateAfterBind, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->descriptorBindingSampledImageUpdateAfterBind, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->descriptorBindingStorageImageUpdateAfterBind, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->descriptorBindingStorageBufferUpdateAfterBind, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->descriptorBindingUniformTexelBufferUpdateAfterBind, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->descriptorBindingStorageTexelBufferUpdateAfterBind, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->descriptorBindingUpdateUnusedWhilePending, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->descriptorBindingPartiallyBound, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->descriptorBindingVariableDescriptorCount, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->runtimeDescriptorArray, sizeof(VkBool32));
+}
+
+
+void marshal_VkPhysicalDeviceDescriptorIndexingPropertiesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceDescriptorIndexingPropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->maxUpdateAfterBindDescriptorsInAllPools, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->shaderUniformBufferArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderSampledImageArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageBufferArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderStorageImageArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->shaderInputAttachmentArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->robustBufferAccessUpdateAfterBind, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->quadDivergentImplicitLod, sizeof(VkBool32));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorUpdateAfterBindSamplers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorUpdateAfterBindUniformBuffers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorUpdateAfterBindStorageBuffers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorUpdateAfterBindSampledImages, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorUpdateAfterBindStorageImages, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageDescriptorUpdateAfterBindInputAttachments, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxPerStageUpdateAfterBindResources, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUpdateAfterBindSamplers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUpdateAfterBindUniformBuffers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUpdateAfterBindUniformBuffersDynamic, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUpdateAfterBindStorageBuffers, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUpdateAfterBindStorageBuffersDynamic, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUpdateAfterBindSampledImages, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUpdateAfterBindStorageImages, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxDescriptorSetUpdateAfterBindInputAttachments, sizeof(uint32_t));
+}
+
+void unmarshal_VkPhysicalDeviceDescriptorIndexingPropertiesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceDescriptorIndexingPropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->maxUpdateAfterBindDescriptorsInAllPools, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->shaderUniformBufferArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderSampledImageArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageBufferArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderStorageImageArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->shaderInputAttachmentArrayNonUniformIndexingNative, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->robustBufferAccessUpdateAfterBind, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->quadDivergentImplicitLod, sizeof(VkBool32));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorUpdateAfterBindSamplers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorUpdateAfterBindUniformBuffers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorUpdateAfterBindStorageBuffers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorUpdateAfterBindSampledImages, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorUpdateAfterBindStorageImages, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageDescriptorUpdateAfterBindInputAttachments, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxPerStageUpdateAfterBindResources, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUpdateAfterBindSamplers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUpdateAfterBindUniformBuffers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUpdateAfterBindUniformBuffersDynamic, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUpdateAfterBindStorageBuffers, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUpdateAfterBindStorageBuffersDynamic, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUpdateAfterBindSampledImages, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUpdateAfterBindStorageImages, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxDescriptorSetUpdateAfterBindInputAttachments, sizeof(uint32_t));
+}
+
+
+void marshal_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT(
+    VulkanStream* vkStream,
+    const VkDescriptorSetVariableDescriptorCountAllocateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->descriptorSetCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pDescriptorCounts ? 1 : 0);
+    if (forMarshaling->pDescriptorCounts)
+    {
+        vkStream->write(forMarshaling->pDescriptorCounts, forMarshaling->descriptorSetCount * sizeof(uint32_t));
+    }
+}
+
+void unmarshal_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT(
+    VulkanStream* vkStream,
+    VkDescriptorSetVariableDescriptorCountAllocateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->descriptorSetCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        uint32_t* pDescriptorCounts = (uint32_t*)vkStream->allocArray(forUnmarshaling->descriptorSetCount, sizeof(uint32_t));
+        forUnmarshaling->pDescriptorCounts = pDescriptorCounts;
+        if (pDescriptorCounts)
+        {
+            vkStream->read(pDescriptorCounts, forUnmarshaling->descriptorSetCount * sizeof(uint32_t));
+        }
+    }
+}
+
+
+void marshal_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT(
+    VulkanStream* vkStream,
+    const VkDescriptorSetVariableDescriptorCountLayoutSupportEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->maxVariableDescriptorCount, sizeof(uint32_t));
+}
+
+void unmarshal_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT(
+    VulkanStream* vkStream,
+    VkDescriptorSetVariableDescriptorCountLayoutSupportEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->maxVariableDescriptorCount, sizeof(uint32_t));
+}
+
+
+#endif
+
+#ifdef VK_EXT_shader_viewport_index_layer
+
+#endif
+
+#ifdef VK_EXT_global_priority
+
+void marshal_VkDeviceQueueGlobalPriorityCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkDeviceQueueGlobalPriorityCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->globalPriority, sizeof(VkQueueGlobalPriorityEXT));
+}
+
+void unmarshal_VkDeviceQueueGlobalPriorityCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkDeviceQueueGlobalPriorityCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->globalPriority, sizeof(VkQueueGlobalPriorityEXT));
+}
+
+
+#endif
+
+#ifdef VK_EXT_external_memory_host
+
+void marshal_VkMemoryHostPointerPropertiesEXT(
+    VulkanStream* vkStream,
+    const VkMemoryHostPointerPropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+void unmarshal_VkMemoryHostPointerPropertiesEXT(
+    VulkanStream* vkStream,
+    VkMemoryHostPointerPropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->memoryTypeBits, sizeof(uint32_t));
+}
+
+
+void marshal_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceExternalMemoryHostPropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->minImportedHostPointerAlignment, sizeof(VkDeviceSize));
+}
+
+void unmarshal_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceExternalMemoryHostPropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->minImportedHostPointerAlignment, sizeof(VkDeviceSize));
+}
+
+
+#endif
+
+#ifdef VK_AMD_buffer_marker
+
+#endif
+
+#ifdef VK_AMD_shader_core_properties
+
+void marshal_VkPhysicalDeviceShaderCorePropertiesAMD(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceShaderCorePropertiesAMD* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->shaderEngineCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->shaderArraysPerEngineCount, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->computeUnitsPerShaderArray, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->simdPerComputeUnit, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->wavefrontsPerSimd, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->wavefrontSize, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->sgprsPerSimd, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->minSgprAllocation, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxSgprAllocation, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->sgprAllocationGranularity, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->vgprsPerSimd, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->minVgprAllocation, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->maxVgprAllocation, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->vgprAllocationGranularity, sizeof(uint32_t));
+}
+
+void unmarshal_VkPhysicalDeviceShaderCorePropertiesAMD(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceShaderCorePropertiesAMD* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->shaderEngineCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->shaderArraysPerEngineCount, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->computeUnitsPerShaderArray, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->simdPerComputeUnit, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->wavefrontsPerSimd, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->wavefrontSize, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->sgprsPerSimd, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->minSgprAllocation, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxSgprAllocation, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->sgprAllocationGranularity, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->vgprsPerSimd, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->minVgprAllocation, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->maxVgprAllocation, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->vgprAllocationGranularity, sizeof(uint32_t));
+}
+
+
+#endif
+
+#ifdef VK_EXT_vertex_attribute_divisor
+
+void marshal_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(
+    VulkanStream* vkStream,
+    const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->maxVertexAttribDivisor, sizeof(uint32_t));
+}
+
+void unmarshal_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(
+    VulkanStream* vkStream,
+    VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->maxVertexAttribDivisor, sizeof(uint32_t));
+}
+
+
+void marshal_VkVertexInputBindingDivisorDescriptionEXT(
+    VulkanStream* vkStream,
+    const VkVertexInputBindingDivisorDescriptionEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->binding, sizeof(uint32_t));
+    vkStream->write(&forMarshaling->divisor, sizeof(uint32_t));
+}
+
+void unmarshal_VkVertexInputBindingDivisorDescriptionEXT(
+    VulkanStream* vkStream,
+    VkVertexInputBindingDivisorDescriptionEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->binding, sizeof(uint32_t));
+    vkStream->read(&forUnmarshaling->divisor, sizeof(uint32_t));
+}
+
+
+void marshal_VkPipelineVertexInputDivisorStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    const VkPipelineVertexInputDivisorStateCreateInfoEXT* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->vertexBindingDivisorCount, sizeof(uint32_t));
+    vkStream->putU32(forMarshaling->pVertexBindingDivisors ? 1 : 0);
+    if (forMarshaling->pVertexBindingDivisors)
+    {
+        for (uint32_t i = 0; i < (uint32_t)forMarshaling->vertexBindingDivisorCount; ++i)
+        {
+            marshal_VkVertexInputBindingDivisorDescriptionEXT(vkStream, forMarshaling->pVertexBindingDivisors + i);
+        }
+    }
+}
+
+void unmarshal_VkPipelineVertexInputDivisorStateCreateInfoEXT(
+    VulkanStream* vkStream,
+    VkPipelineVertexInputDivisorStateCreateInfoEXT* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->vertexBindingDivisorCount, sizeof(uint32_t));
+    if (vkStream->getU32())
+    {
+        VkVertexInputBindingDivisorDescriptionEXT* pVertexBindingDivisors = (VkVertexInputBindingDivisorDescriptionEXT*)vkStream->allocArray(forUnmarshaling->vertexBindingDivisorCount, sizeof(VkVertexInputBindingDivisorDescriptionEXT));
+        forUnmarshaling->pVertexBindingDivisors = pVertexBindingDivisors;
+        if (pVertexBindingDivisors)
+        {
+            for (uint32_t i = 0; i < (uint32_t)forUnmarshaling->vertexBindingDivisorCount; ++i)
+            {
+                unmarshal_VkVertexInputBindingDivisorDescriptionEXT(vkStream, pVertexBindingDivisors + i);
+            }
+        }
+    }
+}
+
+
+#endif
+
+#ifdef VK_NV_shader_subgroup_partitioned
+
+#endif
+
+#ifdef VK_NV_device_diagnostic_checkpoints
+
+void marshal_VkQueueFamilyCheckpointPropertiesNV(
+    VulkanStream* vkStream,
+    const VkQueueFamilyCheckpointPropertiesNV* forMarshaling)
+{
+    vkStream->write(&forMarshaling->sType, sizeof(VkStructureType));
+    marshal_extension_struct(vkStream, forMarshaling->pNext);
+    vkStream->write(&forMarshaling->checkpointExecutionStageMask, sizeof(VkPipelineStageFlags));
+}
+
+void unmarshal_VkQueueFamilyCheckpointPropertiesNV(
+    VulkanStream* vkStream,
+    VkQueueFamilyCheckpointPropertiesNV* forUnmarshaling)
+{
+    vkStream->read(&forUnmarshaling->sType, sizeof(VkStructureType));
+    unmarshal_extension_struct(vkStream, (void**)&forUnmarshaling->pNext);
+    vkStream->read(&forUnmarshaling->checkpointExecutionStageMask, sizeof(VkPipelineStageFlags));
+}
+
+
+#endif
+
+
+void marshal_extension_struct(
+    VulkanStream* vkStream,
+    const void* structExtension)
+{
+    const VkBaseInStructure* ext = (const VkBaseInStructure*)structExtension;
+    while (ext && !goldfish_vk_extension_struct_size(ext->sType))
+    {
+        ext = ext->pNext;
+    }
+    if (!ext)
+    {
+        vkStream->putU32(0);
+        return;
+    }
+    vkStream->putU32(ext->sType);
+    switch (ext->sType)
+    {
+#ifdef VK_VERSION_1_1
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES:
+            marshal_VkPhysicalDeviceSubgroupProperties(vkStream, (const VkPhysicalDeviceSubgroupProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES:
+            marshal_VkPhysicalDevice16BitStorageFeatures(vkStream, (const VkPhysicalDevice16BitStorageFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
+            marshal_VkMemoryDedicatedRequirements(vkStream, (const VkMemoryDedicatedRequirements*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+            marshal_VkMemoryDedicatedAllocateInfo(vkStream, (const VkMemoryDedicatedAllocateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO:
+            marshal_VkMemoryAllocateFlagsInfo(vkStream, (const VkMemoryAllocateFlagsInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO:
+            marshal_VkDeviceGroupRenderPassBeginInfo(vkStream, (const VkDeviceGroupRenderPassBeginInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO:
+            marshal_VkDeviceGroupCommandBufferBeginInfo(vkStream, (const VkDeviceGroupCommandBufferBeginInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO:
+            marshal_VkDeviceGroupSubmitInfo(vkStream, (const VkDeviceGroupSubmitInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO:
+            marshal_VkDeviceGroupBindSparseInfo(vkStream, (const VkDeviceGroupBindSparseInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO:
+            marshal_VkBindBufferMemoryDeviceGroupInfo(vkStream, (const VkBindBufferMemoryDeviceGroupInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO:
+            marshal_VkBindImageMemoryDeviceGroupInfo(vkStream, (const VkBindImageMemoryDeviceGroupInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO:
+            marshal_VkDeviceGroupDeviceCreateInfo(vkStream, (const VkDeviceGroupDeviceCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2:
+            marshal_VkPhysicalDeviceFeatures2(vkStream, (const VkPhysicalDeviceFeatures2*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES:
+            marshal_VkPhysicalDevicePointClippingProperties(vkStream, (const VkPhysicalDevicePointClippingProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO:
+            marshal_VkRenderPassInputAttachmentAspectCreateInfo(vkStream, (const VkRenderPassInputAttachmentAspectCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+            marshal_VkImageViewUsageCreateInfo(vkStream, (const VkImageViewUsageCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO:
+            marshal_VkPipelineTessellationDomainOriginStateCreateInfo(vkStream, (const VkPipelineTessellationDomainOriginStateCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO:
+            marshal_VkRenderPassMultiviewCreateInfo(vkStream, (const VkRenderPassMultiviewCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES:
+            marshal_VkPhysicalDeviceMultiviewFeatures(vkStream, (const VkPhysicalDeviceMultiviewFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES:
+            marshal_VkPhysicalDeviceMultiviewProperties(vkStream, (const VkPhysicalDeviceMultiviewProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTER_FEATURES:
+            marshal_VkPhysicalDeviceVariablePointerFeatures(vkStream, (const VkPhysicalDeviceVariablePointerFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES:
+            marshal_VkPhysicalDeviceProtectedMemoryFeatures(vkStream, (const VkPhysicalDeviceProtectedMemoryFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES:
+            marshal_VkPhysicalDeviceProtectedMemoryProperties(vkStream, (const VkPhysicalDeviceProtectedMemoryProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO:
+            marshal_VkProtectedSubmitInfo(vkStream, (const VkProtectedSubmitInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+            marshal_VkSamplerYcbcrConversionInfo(vkStream, (const VkSamplerYcbcrConversionInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO:
+            marshal_VkBindImagePlaneMemoryInfo(vkStream, (const VkBindImagePlaneMemoryInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO:
+            marshal_VkImagePlaneMemoryRequirementsInfo(vkStream, (const VkImagePlaneMemoryRequirementsInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES:
+            marshal_VkPhysicalDeviceSamplerYcbcrConversionFeatures(vkStream, (const VkPhysicalDeviceSamplerYcbcrConversionFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES:
+            marshal_VkSamplerYcbcrConversionImageFormatProperties(vkStream, (const VkSamplerYcbcrConversionImageFormatProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
+            marshal_VkPhysicalDeviceExternalImageFormatInfo(vkStream, (const VkPhysicalDeviceExternalImageFormatInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES:
+            marshal_VkExternalImageFormatProperties(vkStream, (const VkExternalImageFormatProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES:
+            marshal_VkPhysicalDeviceIDProperties(vkStream, (const VkPhysicalDeviceIDProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+            marshal_VkExternalMemoryImageCreateInfo(vkStream, (const VkExternalMemoryImageCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+            marshal_VkExternalMemoryBufferCreateInfo(vkStream, (const VkExternalMemoryBufferCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO:
+            marshal_VkExportMemoryAllocateInfo(vkStream, (const VkExportMemoryAllocateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO:
+            marshal_VkExportFenceCreateInfo(vkStream, (const VkExportFenceCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO:
+            marshal_VkExportSemaphoreCreateInfo(vkStream, (const VkExportSemaphoreCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES:
+            marshal_VkPhysicalDeviceMaintenance3Properties(vkStream, (const VkPhysicalDeviceMaintenance3Properties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETER_FEATURES:
+            marshal_VkPhysicalDeviceShaderDrawParameterFeatures(vkStream, (const VkPhysicalDeviceShaderDrawParameterFeatures*)ext);
+            break;
+#endif
+#ifdef VK_KHR_swapchain
+        case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+            marshal_VkImageSwapchainCreateInfoKHR(vkStream, (const VkImageSwapchainCreateInfoKHR*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
+            marshal_VkBindImageMemorySwapchainInfoKHR(vkStream, (const VkBindImageMemorySwapchainInfoKHR*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR:
+            marshal_VkDeviceGroupPresentInfoKHR(vkStream, (const VkDeviceGroupPresentInfoKHR*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR:
+            marshal_VkDeviceGroupSwapchainCreateInfoKHR(vkStream, (const VkDeviceGroupSwapchainCreateInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_display_swapchain
+        case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR:
+            marshal_VkDisplayPresentInfoKHR(vkStream, (const VkDisplayPresentInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_external_memory_fd
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR:
+            marshal_VkImportMemoryFdInfoKHR(vkStream, (const VkImportMemoryFdInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_win32_keyed_mutex
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR:
+            marshal_VkWin32KeyedMutexAcquireReleaseInfoKHR(vkStream, (const VkWin32KeyedMutexAcquireReleaseInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_external_semaphore_win32
+        case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR:
+            marshal_VkD3D12FenceSubmitInfoKHR(vkStream, (const VkD3D12FenceSubmitInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_push_descriptor
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR:
+            marshal_VkPhysicalDevicePushDescriptorPropertiesKHR(vkStream, (const VkPhysicalDevicePushDescriptorPropertiesKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_incremental_present
+        case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR:
+            marshal_VkPresentRegionsKHR(vkStream, (const VkPresentRegionsKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_shared_presentable_image
+        case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR:
+            marshal_VkSharedPresentSurfaceCapabilitiesKHR(vkStream, (const VkSharedPresentSurfaceCapabilitiesKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_image_format_list
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO_KHR:
+            marshal_VkImageFormatListCreateInfoKHR(vkStream, (const VkImageFormatListCreateInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_8bit_storage
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES_KHR:
+            marshal_VkPhysicalDevice8BitStorageFeaturesKHR(vkStream, (const VkPhysicalDevice8BitStorageFeaturesKHR*)ext);
+            break;
+#endif
+#ifdef VK_AMD_rasterization_order
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD:
+            marshal_VkPipelineRasterizationStateRasterizationOrderAMD(vkStream, (const VkPipelineRasterizationStateRasterizationOrderAMD*)ext);
+            break;
+#endif
+#ifdef VK_NV_dedicated_allocation
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV:
+            marshal_VkDedicatedAllocationImageCreateInfoNV(vkStream, (const VkDedicatedAllocationImageCreateInfoNV*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV:
+            marshal_VkDedicatedAllocationBufferCreateInfoNV(vkStream, (const VkDedicatedAllocationBufferCreateInfoNV*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
+            marshal_VkDedicatedAllocationMemoryAllocateInfoNV(vkStream, (const VkDedicatedAllocationMemoryAllocateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_AMD_texture_gather_bias_lod
+        case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD:
+            marshal_VkTextureLODGatherFormatPropertiesAMD(vkStream, (const VkTextureLODGatherFormatPropertiesAMD*)ext);
+            break;
+#endif
+#ifdef VK_NV_external_memory
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV:
+            marshal_VkExternalMemoryImageCreateInfoNV(vkStream, (const VkExternalMemoryImageCreateInfoNV*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV:
+            marshal_VkExportMemoryAllocateInfoNV(vkStream, (const VkExportMemoryAllocateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_NV_win32_keyed_mutex
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
+            marshal_VkWin32KeyedMutexAcquireReleaseInfoNV(vkStream, (const VkWin32KeyedMutexAcquireReleaseInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_EXT_validation_flags
+        case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT:
+            marshal_VkValidationFlagsEXT(vkStream, (const VkValidationFlagsEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_conditional_rendering
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT:
+            marshal_VkPhysicalDeviceConditionalRenderingFeaturesEXT(vkStream, (const VkPhysicalDeviceConditionalRenderingFeaturesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT:
+            marshal_VkCommandBufferInheritanceConditionalRenderingInfoEXT(vkStream, (const VkCommandBufferInheritanceConditionalRenderingInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_NV_clip_space_w_scaling
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV:
+            marshal_VkPipelineViewportWScalingStateCreateInfoNV(vkStream, (const VkPipelineViewportWScalingStateCreateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_EXT_display_control
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT:
+            marshal_VkSwapchainCounterCreateInfoEXT(vkStream, (const VkSwapchainCounterCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_GOOGLE_display_timing
+        case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE:
+            marshal_VkPresentTimesInfoGOOGLE(vkStream, (const VkPresentTimesInfoGOOGLE*)ext);
+            break;
+#endif
+#ifdef VK_NVX_multiview_per_view_attributes
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX:
+            marshal_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(vkStream, (const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX*)ext);
+            break;
+#endif
+#ifdef VK_NV_viewport_swizzle
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV:
+            marshal_VkPipelineViewportSwizzleStateCreateInfoNV(vkStream, (const VkPipelineViewportSwizzleStateCreateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_EXT_discard_rectangles
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT:
+            marshal_VkPhysicalDeviceDiscardRectanglePropertiesEXT(vkStream, (const VkPhysicalDeviceDiscardRectanglePropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT:
+            marshal_VkPipelineDiscardRectangleStateCreateInfoEXT(vkStream, (const VkPipelineDiscardRectangleStateCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_conservative_rasterization
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT:
+            marshal_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(vkStream, (const VkPhysicalDeviceConservativeRasterizationPropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT:
+            marshal_VkPipelineRasterizationConservativeStateCreateInfoEXT(vkStream, (const VkPipelineRasterizationConservativeStateCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_ANDROID_external_memory_android_hardware_buffer
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID:
+            marshal_VkAndroidHardwareBufferUsageANDROID(vkStream, (const VkAndroidHardwareBufferUsageANDROID*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID:
+            marshal_VkAndroidHardwareBufferFormatPropertiesANDROID(vkStream, (const VkAndroidHardwareBufferFormatPropertiesANDROID*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID:
+            marshal_VkExternalFormatANDROID(vkStream, (const VkExternalFormatANDROID*)ext);
+            break;
+#endif
+#ifdef VK_EXT_sampler_filter_minmax
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO_EXT:
+            marshal_VkSamplerReductionModeCreateInfoEXT(vkStream, (const VkSamplerReductionModeCreateInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES_EXT:
+            marshal_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT(vkStream, (const VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_sample_locations
+        case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT:
+            marshal_VkSampleLocationsInfoEXT(vkStream, (const VkSampleLocationsInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT:
+            marshal_VkRenderPassSampleLocationsBeginInfoEXT(vkStream, (const VkRenderPassSampleLocationsBeginInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT:
+            marshal_VkPipelineSampleLocationsStateCreateInfoEXT(vkStream, (const VkPipelineSampleLocationsStateCreateInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT:
+            marshal_VkPhysicalDeviceSampleLocationsPropertiesEXT(vkStream, (const VkPhysicalDeviceSampleLocationsPropertiesEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_blend_operation_advanced
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT:
+            marshal_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(vkStream, (const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT:
+            marshal_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(vkStream, (const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT:
+            marshal_VkPipelineColorBlendAdvancedStateCreateInfoEXT(vkStream, (const VkPipelineColorBlendAdvancedStateCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_NV_fragment_coverage_to_color
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV:
+            marshal_VkPipelineCoverageToColorStateCreateInfoNV(vkStream, (const VkPipelineCoverageToColorStateCreateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_NV_framebuffer_mixed_samples
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV:
+            marshal_VkPipelineCoverageModulationStateCreateInfoNV(vkStream, (const VkPipelineCoverageModulationStateCreateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_EXT_validation_cache
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT:
+            marshal_VkShaderModuleValidationCacheCreateInfoEXT(vkStream, (const VkShaderModuleValidationCacheCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_descriptor_indexing
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT:
+            marshal_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT(vkStream, (const VkDescriptorSetLayoutBindingFlagsCreateInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT:
+            marshal_VkPhysicalDeviceDescriptorIndexingFeaturesEXT(vkStream, (const VkPhysicalDeviceDescriptorIndexingFeaturesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT:
+            marshal_VkPhysicalDeviceDescriptorIndexingPropertiesEXT(vkStream, (const VkPhysicalDeviceDescriptorIndexingPropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO_EXT:
+            marshal_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT(vkStream, (const VkDescriptorSetVariableDescriptorCountAllocateInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT_EXT:
+            marshal_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT(vkStream, (const VkDescriptorSetVariableDescriptorCountLayoutSupportEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_global_priority
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT:
+            marshal_VkDeviceQueueGlobalPriorityCreateInfoEXT(vkStream, (const VkDeviceQueueGlobalPriorityCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_external_memory_host
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT:
+            marshal_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(vkStream, (const VkPhysicalDeviceExternalMemoryHostPropertiesEXT*)ext);
+            break;
+#endif
+#ifdef VK_AMD_shader_core_properties
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD:
+            marshal_VkPhysicalDeviceShaderCorePropertiesAMD(vkStream, (const VkPhysicalDeviceShaderCorePropertiesAMD*)ext);
+            break;
+#endif
+#ifdef VK_EXT_vertex_attribute_divisor
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT:
+            marshal_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(vkStream, (const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT:
+            marshal_VkPipelineVertexInputDivisorStateCreateInfoEXT(vkStream, (const VkPipelineVertexInputDivisorStateCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_NV_device_diagnostic_checkpoints
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV:
+            marshal_VkQueueFamilyCheckpointPropertiesNV(vkStream, (const VkQueueFamilyCheckpointPropertiesNV*)ext);
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+void unmarshal_extension_struct(
+    VulkanStream* vkStream,
+    void** pNext)
+{
+    const VkStructureType sType = (VkStructureType)vkStream->getU32();
+    if (!sType)
+    {
+        return;
+    }
+    const size_t size = goldfish_vk_extension_struct_size(sType);
+    if (!size)
+    {
+        vkStream->setError();
+        return;
+    }
+    VkBaseOutStructure* ext = (VkBaseOutStructure*)*pNext;
+    while (ext && ext->sType != sType)
+    {
+        ext = ext->pNext;
+    }
+    if (!ext)
+    {
+        // Not in the chain: add it, or read it into scratch memory if the
+        // chain is the application's.
+        ext = (VkBaseOutStructure*)vkStream->alloc(size);
+        if (!ext)
+        {
+            return;
+        }
+        if (!*pNext)
+        {
+            *pNext = ext;
+        }
+    }
+    switch (sType)
+    {
+#ifdef VK_VERSION_1_1
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES:
+            unmarshal_VkPhysicalDeviceSubgroupProperties(vkStream, (VkPhysicalDeviceSubgroupProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES:
+            unmarshal_VkPhysicalDevice16BitStorageFeatures(vkStream, (VkPhysicalDevice16BitStorageFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
+            unmarshal_VkMemoryDedicatedRequirements(vkStream, (VkMemoryDedicatedRequirements*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+            unmarshal_VkMemoryDedicatedAllocateInfo(vkStream, (VkMemoryDedicatedAllocateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO:
+            unmarshal_VkMemoryAllocateFlagsInfo(vkStream, (VkMemoryAllocateFlagsInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO:
+            unmarshal_VkDeviceGroupRenderPassBeginInfo(vkStream, (VkDeviceGroupRenderPassBeginInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO:
+            unmarshal_VkDeviceGroupCommandBufferBeginInfo(vkStream, (VkDeviceGroupCommandBufferBeginInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO:
+            unmarshal_VkDeviceGroupSubmitInfo(vkStream, (VkDeviceGroupSubmitInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO:
+            unmarshal_VkDeviceGroupBindSparseInfo(vkStream, (VkDeviceGroupBindSparseInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO:
+            unmarshal_VkBindBufferMemoryDeviceGroupInfo(vkStream, (VkBindBufferMemoryDeviceGroupInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO:
+            unmarshal_VkBindImageMemoryDeviceGroupInfo(vkStream, (VkBindImageMemoryDeviceGroupInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO:
+            unmarshal_VkDeviceGroupDeviceCreateInfo(vkStream, (VkDeviceGroupDeviceCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2:
+            unmarshal_VkPhysicalDeviceFeatures2(vkStream, (VkPhysicalDeviceFeatures2*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES:
+            unmarshal_VkPhysicalDevicePointClippingProperties(vkStream, (VkPhysicalDevicePointClippingProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO:
+            unmarshal_VkRenderPassInputAttachmentAspectCreateInfo(vkStream, (VkRenderPassInputAttachmentAspectCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+            unmarshal_VkImageViewUsageCreateInfo(vkStream, (VkImageViewUsageCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO:
+            unmarshal_VkPipelineTessellationDomainOriginStateCreateInfo(vkStream, (VkPipelineTessellationDomainOriginStateCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO:
+            unmarshal_VkRenderPassMultiviewCreateInfo(vkStream, (VkRenderPassMultiviewCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES:
+            unmarshal_VkPhysicalDeviceMultiviewFeatures(vkStream, (VkPhysicalDeviceMultiviewFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES:
+            unmarshal_VkPhysicalDeviceMultiviewProperties(vkStream, (VkPhysicalDeviceMultiviewProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTER_FEATURES:
+            unmarshal_VkPhysicalDeviceVariablePointerFeatures(vkStream, (VkPhysicalDeviceVariablePointerFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES:
+            unmarshal_VkPhysicalDeviceProtectedMemoryFeatures(vkStream, (VkPhysicalDeviceProtectedMemoryFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES:
+            unmarshal_VkPhysicalDeviceProtectedMemoryProperties(vkStream, (VkPhysicalDeviceProtectedMemoryProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO:
+            unmarshal_VkProtectedSubmitInfo(vkStream, (VkProtectedSubmitInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+            unmarshal_VkSamplerYcbcrConversionInfo(vkStream, (VkSamplerYcbcrConversionInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO:
+            unmarshal_VkBindImagePlaneMemoryInfo(vkStream, (VkBindImagePlaneMemoryInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO:
+            unmarshal_VkImagePlaneMemoryRequirementsInfo(vkStream, (VkImagePlaneMemoryRequirementsInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES:
+            unmarshal_VkPhysicalDeviceSamplerYcbcrConversionFeatures(vkStream, (VkPhysicalDeviceSamplerYcbcrConversionFeatures*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES:
+            unmarshal_VkSamplerYcbcrConversionImageFormatProperties(vkStream, (VkSamplerYcbcrConversionImageFormatProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
+            unmarshal_VkPhysicalDeviceExternalImageFormatInfo(vkStream, (VkPhysicalDeviceExternalImageFormatInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES:
+            unmarshal_VkExternalImageFormatProperties(vkStream, (VkExternalImageFormatProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES:
+            unmarshal_VkPhysicalDeviceIDProperties(vkStream, (VkPhysicalDeviceIDProperties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+            unmarshal_VkExternalMemoryImageCreateInfo(vkStream, (VkExternalMemoryImageCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+            unmarshal_VkExternalMemoryBufferCreateInfo(vkStream, (VkExternalMemoryBufferCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO:
+            unmarshal_VkExportMemoryAllocateInfo(vkStream, (VkExportMemoryAllocateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO:
+            unmarshal_VkExportFenceCreateInfo(vkStream, (VkExportFenceCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO:
+            unmarshal_VkExportSemaphoreCreateInfo(vkStream, (VkExportSemaphoreCreateInfo*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES:
+            unmarshal_VkPhysicalDeviceMaintenance3Properties(vkStream, (VkPhysicalDeviceMaintenance3Properties*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETER_FEATURES:
+            unmarshal_VkPhysicalDeviceShaderDrawParameterFeatures(vkStream, (VkPhysicalDeviceShaderDrawParameterFeatures*)ext);
+            break;
+#endif
+#ifdef VK_KHR_swapchain
+        case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+            unmarshal_VkImageSwapchainCreateInfoKHR(vkStream, (VkImageSwapchainCreateInfoKHR*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
+            unmarshal_VkBindImageMemorySwapchainInfoKHR(vkStream, (VkBindImageMemorySwapchainInfoKHR*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR:
+            unmarshal_VkDeviceGroupPresentInfoKHR(vkStream, (VkDeviceGroupPresentInfoKHR*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR:
+            unmarshal_VkDeviceGroupSwapchainCreateInfoKHR(vkStream, (VkDeviceGroupSwapchainCreateInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_display_swapchain
+        case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR:
+            unmarshal_VkDisplayPresentInfoKHR(vkStream, (VkDisplayPresentInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_external_memory_fd
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR:
+            unmarshal_VkImportMemoryFdInfoKHR(vkStream, (VkImportMemoryFdInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_win32_keyed_mutex
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR:
+            unmarshal_VkWin32KeyedMutexAcquireReleaseInfoKHR(vkStream, (VkWin32KeyedMutexAcquireReleaseInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_external_semaphore_win32
+        case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR:
+            unmarshal_VkD3D12FenceSubmitInfoKHR(vkStream, (VkD3D12FenceSubmitInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_push_descriptor
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR:
+            unmarshal_VkPhysicalDevicePushDescriptorPropertiesKHR(vkStream, (VkPhysicalDevicePushDescriptorPropertiesKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_incremental_present
+        case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR:
+            unmarshal_VkPresentRegionsKHR(vkStream, (VkPresentRegionsKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_shared_presentable_image
+        case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR:
+            unmarshal_VkSharedPresentSurfaceCapabilitiesKHR(vkStream, (VkSharedPresentSurfaceCapabilitiesKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_image_format_list
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO_KHR:
+            unmarshal_VkImageFormatListCreateInfoKHR(vkStream, (VkImageFormatListCreateInfoKHR*)ext);
+            break;
+#endif
+#ifdef VK_KHR_8bit_storage
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES_KHR:
+            unmarshal_VkPhysicalDevice8BitStorageFeaturesKHR(vkStream, (VkPhysicalDevice8BitStorageFeaturesKHR*)ext);
+            break;
+#endif
+#ifdef VK_AMD_rasterization_order
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD:
+            unmarshal_VkPipelineRasterizationStateRasterizationOrderAMD(vkStream, (VkPipelineRasterizationStateRasterizationOrderAMD*)ext);
+            break;
+#endif
+#ifdef VK_NV_dedicated_allocation
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV:
+            unmarshal_VkDedicatedAllocationImageCreateInfoNV(vkStream, (VkDedicatedAllocationImageCreateInfoNV*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV:
+            unmarshal_VkDedicatedAllocationBufferCreateInfoNV(vkStream, (VkDedicatedAllocationBufferCreateInfoNV*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
+            unmarshal_VkDedicatedAllocationMemoryAllocateInfoNV(vkStream, (VkDedicatedAllocationMemoryAllocateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_AMD_texture_gather_bias_lod
+        case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD:
+            unmarshal_VkTextureLODGatherFormatPropertiesAMD(vkStream, (VkTextureLODGatherFormatPropertiesAMD*)ext);
+            break;
+#endif
+#ifdef VK_NV_external_memory
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV:
+            unmarshal_VkExternalMemoryImageCreateInfoNV(vkStream, (VkExternalMemoryImageCreateInfoNV*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV:
+            unmarshal_VkExportMemoryAllocateInfoNV(vkStream, (VkExportMemoryAllocateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_NV_win32_keyed_mutex
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
+            unmarshal_VkWin32KeyedMutexAcquireReleaseInfoNV(vkStream, (VkWin32KeyedMutexAcquireReleaseInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_EXT_validation_flags
+        case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT:
+            unmarshal_VkValidationFlagsEXT(vkStream, (VkValidationFlagsEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_conditional_rendering
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT:
+            unmarshal_VkPhysicalDeviceConditionalRenderingFeaturesEXT(vkStream, (VkPhysicalDeviceConditionalRenderingFeaturesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT:
+            unmarshal_VkCommandBufferInheritanceConditionalRenderingInfoEXT(vkStream, (VkCommandBufferInheritanceConditionalRenderingInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_NV_clip_space_w_scaling
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV:
+            unmarshal_VkPipelineViewportWScalingStateCreateInfoNV(vkStream, (VkPipelineViewportWScalingStateCreateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_EXT_display_control
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT:
+            unmarshal_VkSwapchainCounterCreateInfoEXT(vkStream, (VkSwapchainCounterCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_GOOGLE_display_timing
+        case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE:
+            unmarshal_VkPresentTimesInfoGOOGLE(vkStream, (VkPresentTimesInfoGOOGLE*)ext);
+            break;
+#endif
+#ifdef VK_NVX_multiview_per_view_attributes
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX:
+            unmarshal_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX(vkStream, (VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX*)ext);
+            break;
+#endif
+#ifdef VK_NV_viewport_swizzle
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV:
+            unmarshal_VkPipelineViewportSwizzleStateCreateInfoNV(vkStream, (VkPipelineViewportSwizzleStateCreateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_EXT_discard_rectangles
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT:
+            unmarshal_VkPhysicalDeviceDiscardRectanglePropertiesEXT(vkStream, (VkPhysicalDeviceDiscardRectanglePropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT:
+            unmarshal_VkPipelineDiscardRectangleStateCreateInfoEXT(vkStream, (VkPipelineDiscardRectangleStateCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_conservative_rasterization
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT:
+            unmarshal_VkPhysicalDeviceConservativeRasterizationPropertiesEXT(vkStream, (VkPhysicalDeviceConservativeRasterizationPropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT:
+            unmarshal_VkPipelineRasterizationConservativeStateCreateInfoEXT(vkStream, (VkPipelineRasterizationConservativeStateCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_ANDROID_external_memory_android_hardware_buffer
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID:
+            unmarshal_VkAndroidHardwareBufferUsageANDROID(vkStream, (VkAndroidHardwareBufferUsageANDROID*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID:
+            unmarshal_VkAndroidHardwareBufferFormatPropertiesANDROID(vkStream, (VkAndroidHardwareBufferFormatPropertiesANDROID*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID:
+            unmarshal_VkExternalFormatANDROID(vkStream, (VkExternalFormatANDROID*)ext);
+            break;
+#endif
+#ifdef VK_EXT_sampler_filter_minmax
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO_EXT:
+            unmarshal_VkSamplerReductionModeCreateInfoEXT(vkStream, (VkSamplerReductionModeCreateInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES_EXT:
+            unmarshal_VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT(vkStream, (VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_sample_locations
+        case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT:
+            unmarshal_VkSampleLocationsInfoEXT(vkStream, (VkSampleLocationsInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT:
+            unmarshal_VkRenderPassSampleLocationsBeginInfoEXT(vkStream, (VkRenderPassSampleLocationsBeginInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT:
+            unmarshal_VkPipelineSampleLocationsStateCreateInfoEXT(vkStream, (VkPipelineSampleLocationsStateCreateInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT:
+            unmarshal_VkPhysicalDeviceSampleLocationsPropertiesEXT(vkStream, (VkPhysicalDeviceSampleLocationsPropertiesEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_blend_operation_advanced
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT:
+            unmarshal_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT(vkStream, (VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT:
+            unmarshal_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT(vkStream, (VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT:
+            unmarshal_VkPipelineColorBlendAdvancedStateCreateInfoEXT(vkStream, (VkPipelineColorBlendAdvancedStateCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_NV_fragment_coverage_to_color
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV:
+            unmarshal_VkPipelineCoverageToColorStateCreateInfoNV(vkStream, (VkPipelineCoverageToColorStateCreateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_NV_framebuffer_mixed_samples
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV:
+            unmarshal_VkPipelineCoverageModulationStateCreateInfoNV(vkStream, (VkPipelineCoverageModulationStateCreateInfoNV*)ext);
+            break;
+#endif
+#ifdef VK_EXT_validation_cache
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT:
+            unmarshal_VkShaderModuleValidationCacheCreateInfoEXT(vkStream, (VkShaderModuleValidationCacheCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_descriptor_indexing
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT:
+            unmarshal_VkDescriptorSetLayoutBindingFlagsCreateInfoEXT(vkStream, (VkDescriptorSetLayoutBindingFlagsCreateInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT:
+            unmarshal_VkPhysicalDeviceDescriptorIndexingFeaturesEXT(vkStream, (VkPhysicalDeviceDescriptorIndexingFeaturesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT:
+            unmarshal_VkPhysicalDeviceDescriptorIndexingPropertiesEXT(vkStream, (VkPhysicalDeviceDescriptorIndexingPropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO_EXT:
+            unmarshal_VkDescriptorSetVariableDescriptorCountAllocateInfoEXT(vkStream, (VkDescriptorSetVariableDescriptorCountAllocateInfoEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT_EXT:
+            unmarshal_VkDescriptorSetVariableDescriptorCountLayoutSupportEXT(vkStream, (VkDescriptorSetVariableDescriptorCountLayoutSupportEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_global_priority
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT:
+            unmarshal_VkDeviceQueueGlobalPriorityCreateInfoEXT(vkStream, (VkDeviceQueueGlobalPriorityCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_EXT_external_memory_host
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT:
+            unmarshal_VkPhysicalDeviceExternalMemoryHostPropertiesEXT(vkStream, (VkPhysicalDeviceExternalMemoryHostPropertiesEXT*)ext);
+            break;
+#endif
+#ifdef VK_AMD_shader_core_properties
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD:
+            unmarshal_VkPhysicalDeviceShaderCorePropertiesAMD(vkStream, (VkPhysicalDeviceShaderCorePropertiesAMD*)ext);
+            break;
+#endif
+#ifdef VK_EXT_vertex_attribute_divisor
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT:
+            unmarshal_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT(vkStream, (VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT*)ext);
+            break;
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT:
+            unmarshal_VkPipelineVertexInputDivisorStateCreateInfoEXT(vkStream, (VkPipelineVertexInputDivisorStateCreateInfoEXT*)ext);
+            break;
+#endif
+#ifdef VK_NV_device_diagnostic_checkpoints
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV:
+            unmarshal_VkQueueFamilyCheckpointPropertiesNV(vkStream, (VkQueueFamilyCheckpointPropertiesNV*)ext);
+            break;
+#endif
+        default:
+            break;
+    }
+}
+
+void marshal_extension_struct_types(
+    VulkanStream* vkStream,
+    const void* structExtension)
+{
+    const VkBaseInStructure* ext = (const VkBaseInStructure*)structExtension;
+    for (; ext; ext = ext->pNext)
+    {
+        if (goldfish_vk_extension_struct_size(ext->sType))
+        {
+            vkStream->putU32(ext->sType);
+        }
+    }
+    vkStream->putU32(0);
+}
+
+void unmarshal_extension_struct_types(
+    VulkanStream* vkStream,
+    void** pNext)
+{
+    VkBaseOutStructure** next = (VkBaseOutStructure**)pNext;
+    for (uint32_t sType = vkStream->getU32(); sType; sType = vkStream->getU32())
+    {
+        const size_t size = goldfish_vk_extension_struct_size((VkStructureType)sType);
+        VkBaseOutStructure* ext = size ? (VkBaseOutStructure*)vkStream->alloc(size) : nullptr;
+        if (!ext)
+        {
+            vkStream->setError();
+            return;
+        }
+        ext->sType = (VkStructureType)sType;
+        *next = ext;
+        next = &ext->pNext;
+    }
+}
+
+size_t goldfish_vk_extension_struct_size(
+    VkStructureType sType)
+{
+    switch (sType)
+    {
+#ifdef VK_VERSION_1_1
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES:
+            return sizeof(VkPhysicalDeviceSubgroupProperties);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES:
+            return sizeof(VkPhysicalDevice16BitStorageFeatures);
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
+            return sizeof(VkMemoryDedicatedRequirements);
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+            return sizeof(VkMemoryDedicatedAllocateInfo);
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO:
+            return sizeof(VkMemoryAllocateFlagsInfo);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO:
+            return sizeof(VkDeviceGroupRenderPassBeginInfo);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO:
+            return sizeof(VkDeviceGroupCommandBufferBeginInfo);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO:
+            return sizeof(VkDeviceGroupSubmitInfo);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO:
+            return sizeof(VkDeviceGroupBindSparseInfo);
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO:
+            return sizeof(VkBindBufferMemoryDeviceGroupInfo);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO:
+            return sizeof(VkBindImageMemoryDeviceGroupInfo);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO:
+            return sizeof(VkDeviceGroupDeviceCreateInfo);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2:
+            return sizeof(VkPhysicalDeviceFeatures2);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES:
+            return sizeof(VkPhysicalDevicePointClippingProperties);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO:
+            return sizeof(VkRenderPassInputAttachmentAspectCreateInfo);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+            return sizeof(VkImageViewUsageCreateInfo);
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO:
+            return sizeof(VkPipelineTessellationDomainOriginStateCreateInfo);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO:
+            return sizeof(VkRenderPassMultiviewCreateInfo);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES:
+            return sizeof(VkPhysicalDeviceMultiviewFeatures);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES:
+            return sizeof(VkPhysicalDeviceMultiviewProperties);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTER_FEATURES:
+            return sizeof(VkPhysicalDeviceVariablePointerFeatures);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES:
+            return sizeof(VkPhysicalDeviceProtectedMemoryFeatures);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES:
+            return sizeof(VkPhysicalDeviceProtectedMemoryProperties);
+        case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO:
+            return sizeof(VkProtectedSubmitInfo);
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+            return sizeof(VkSamplerYcbcrConversionInfo);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO:
+            return sizeof(VkBindImagePlaneMemoryInfo);
+        case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO:
+            return sizeof(VkImagePlaneMemoryRequirementsInfo);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES:
+            return sizeof(VkPhysicalDeviceSamplerYcbcrConversionFeatures);
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES:
+            return sizeof(VkSamplerYcbcrConversionImageFormatProperties);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
+            return sizeof(VkPhysicalDeviceExternalImageFormatInfo);
+        case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES:
+            return sizeof(VkExternalImageFormatProperties);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES:
+            return sizeof(VkPhysicalDeviceIDProperties);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+            return sizeof(VkExternalMemoryImageCreateInfo);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+            return sizeof(VkExternalMemoryBufferCreateInfo);
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO:
+            return sizeof(VkExportMemoryAllocateInfo);
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO:
+            return sizeof(VkExportFenceCreateInfo);
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO:
+            return sizeof(VkExportSemaphoreCreateInfo);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES:
+            return sizeof(VkPhysicalDeviceMaintenance3Properties);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETER_FEATURES:
+            return sizeof(VkPhysicalDeviceShaderDrawParameterFeatures);
+#endif
+#ifdef VK_KHR_swapchain
+        case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+            return sizeof(VkImageSwapchainCreateInfoKHR);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
+            return sizeof(VkBindImageMemorySwapchainInfoKHR);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR:
+            return sizeof(VkDeviceGroupPresentInfoKHR);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR:
+            return sizeof(VkDeviceGroupSwapchainCreateInfoKHR);
+#endif
+#ifdef VK_KHR_display_swapchain
+        case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR:
+            return sizeof(VkDisplayPresentInfoKHR);
+#endif
+#ifdef VK_KHR_external_memory_fd
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR:
+            return sizeof(VkImportMemoryFdInfoKHR);
+#endif
+#ifdef VK_KHR_win32_keyed_mutex
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR:
+            return sizeof(VkWin32KeyedMutexAcquireReleaseInfoKHR);
+#endif
+#ifdef VK_KHR_external_semaphore_win32
+        case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR:
+            return sizeof(VkD3D12FenceSubmitInfoKHR);
+#endif
+#ifdef VK_KHR_push_descriptor
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR:
+            return sizeof(VkPhysicalDevicePushDescriptorPropertiesKHR);
+#endif
+#ifdef VK_KHR_incremental_present
+        case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR:
+            return sizeof(VkPresentRegionsKHR);
+#endif
+#ifdef VK_KHR_shared_presentable_image
+        case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR:
+            return sizeof(VkSharedPresentSurfaceCapabilitiesKHR);
+#endif
+#ifdef VK_KHR_image_format_list
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO_KHR:
+            return sizeof(VkImageFormatListCreateInfoKHR);
+#endif
+#ifdef VK_KHR_8bit_storage
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES_KHR:
+            return sizeof(VkPhysicalDevice8BitStorageFeaturesKHR);
+#endif
+#ifdef VK_AMD_rasterization_order
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD:
+            return sizeof(VkPipelineRasterizationStateRasterizationOrderAMD);
+#endif
+#ifdef VK_NV_dedicated_allocation
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV:
+            return sizeof(VkDedicatedAllocationImageCreateInfoNV);
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV:
+            return sizeof(VkDedicatedAllocationBufferCreateInfoNV);
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
+            return sizeof(VkDedicatedAllocationMemoryAllocateInfoNV);
+#endif
+#ifdef VK_AMD_texture_gather_bias_lod
+        case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD:
+            return sizeof(VkTextureLODGatherFormatPropertiesAMD);
+#endif
+#ifdef VK_NV_external_memory
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV:
+            return sizeof(VkExternalMemoryImageCreateInfoNV);
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV:
+            return sizeof(VkExportMemoryAllocateInfoNV);
+#endif
+#ifdef VK_NV_win32_keyed_mutex
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
+            return sizeof(VkWin32KeyedMutexAcquireReleaseInfoNV);
+#endif
+#ifdef VK_EXT_validation_flags
+        case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT:
+            return sizeof(VkValidationFlagsEXT);
+#endif
+#ifdef VK_EXT_conditional_rendering
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT:
+            return sizeof(VkPhysicalDeviceConditionalRenderingFeaturesEXT);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT:
+            return sizeof(VkCommandBufferInheritanceConditionalRenderingInfoEXT);
+#endif
+#ifdef VK_NV_clip_space_w_scaling
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV:
+            return sizeof(VkPipelineViewportWScalingStateCreateInfoNV);
+#endif
+#ifdef VK_EXT_display_control
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT:
+            return sizeof(VkSwapchainCounterCreateInfoEXT);
+#endif
+#ifdef VK_GOOGLE_display_timing
+        case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE:
+            return sizeof(VkPresentTimesInfoGOOGLE);
+#endif
+#ifdef VK_NVX_multiview_per_view_attributes
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX:
+            return sizeof(VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX);
+#endif
+#ifdef VK_NV_viewport_swizzle
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV:
+            return sizeof(VkPipelineViewportSwizzleStateCreateInfoNV);
+#endif
+#ifdef VK_EXT_discard_rectangles
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT:
+            return sizeof(VkPhysicalDeviceDiscardRectanglePropertiesEXT);
+        case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT:
+            return sizeof(VkPipelineDiscardRectangleStateCreateInfoEXT);
+#endif
+#ifdef VK_EXT_conservative_rasterization
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT:
+            return sizeof(VkPhysicalDeviceConservativeRasterizationPropertiesEXT);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT:
+            return sizeof(VkPipelineRasterizationConservativeStateCreateInfoEXT);
+#endif
+#ifdef VK_ANDROID_external_memory_android_hardware_buffer
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID:
+            return sizeof(VkAndroidHardwareBufferUsageANDROID);
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID:
+            return sizeof(VkAndroidHardwareBufferFormatPropertiesANDROID);
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID:
+            return sizeof(VkExternalFormatANDROID);
+#endif
+#ifdef VK_EXT_sampler_filter_minmax
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO_EXT:
+            return sizeof(VkSamplerReductionModeCreateInfoEXT);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES_EXT:
+            return sizeof(VkPhysicalDeviceSamplerFilterMinmaxPropertiesEXT);
+#endif
+#ifdef VK_EXT_sample_locations
+        case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT:
+            return sizeof(VkSampleLocationsInfoEXT);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT:
+            return sizeof(VkRenderPassSampleLocationsBeginInfoEXT);
+        case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT:
+            return sizeof(VkPipelineSampleLocationsStateCreateInfoEXT);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT:
+            return sizeof(VkPhysicalDeviceSampleLocationsPropertiesEXT);
+#endif
+#ifdef VK_EXT_blend_operation_advanced
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT:
+            return sizeof(VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT:
+            return sizeof(VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT);
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT:
+            return sizeof(VkPipelineColorBlendAdvancedStateCreateInfoEXT);
+#endif
+#ifdef VK_NV_fragment_coverage_to_color
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV:
+            return sizeof(VkPipelineCoverageToColorStateCreateInfoNV);
+#endif
+#ifdef VK_NV_framebuffer_mixed_samples
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV:
+            return sizeof(VkPipelineCoverageModulationStateCreateInfoNV);
+#endif
+#ifdef VK_EXT_validation_cache
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT:
+            return sizeof(VkShaderModuleValidationCacheCreateInfoEXT);
+#endif
+#ifdef VK_EXT_descriptor_indexing
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT:
+            return sizeof(VkDescriptorSetLayoutBindingFlagsCreateInfoEXT);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT:
+            return sizeof(VkPhysicalDeviceDescriptorIndexingFeaturesEXT);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT:
+            return sizeof(VkPhysicalDeviceDescriptorIndexingPropertiesEXT);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO_EXT:
+            return sizeof(VkDescriptorSetVariableDescriptorCountAllocateInfoEXT);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT_EXT:
+            return sizeof(VkDescriptorSetVariableDescriptorCountLayoutSupportEXT);
+#endif
+#ifdef VK_EXT_global_priority
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT:
+            return sizeof(VkDeviceQueueGlobalPriorityCreateInfoEXT);
+#endif
+#ifdef VK_EXT_external_memory_host
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT:
+            return sizeof(VkPhysicalDeviceExternalMemoryHostPropertiesEXT);
+#endif
+#ifdef VK_AMD_shader_core_properties
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD:
+            return sizeof(VkPhysicalDeviceShaderCorePropertiesAMD);
+#endif
+#ifdef VK_EXT_vertex_attribute_divisor
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT:
+            return sizeof(VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT);
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT:
+            return sizeof(VkPipelineVertexInputDivisorStateCreateInfoEXT);
+#endif
+#ifdef VK_NV_device_diagnostic_checkpoints
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV:
+            return sizeof(VkQueueFamilyCheckpointPropertiesNV);
+#endif
+        default:
+            return 0;
+    }
+}
+
+}  // namespace goldfish_vk
+
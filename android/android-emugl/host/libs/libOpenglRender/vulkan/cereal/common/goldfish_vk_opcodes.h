@@ -0,0 +1,1127 @@
+// Module: goldfish_vk_opcodes (header) Autogenerated by CerealGenerator
+
+
+#pragma once
+
+// Each encoded call starts with its opcode and the size of its packet:
+//
+//     uint32_t opcode;      // OP_vk*
+//     uint32_t packetSize;  // including these 8 bytes
+//     ...                   // parameters
+
+#ifdef VK_VERSION_1_0
+
+#define OP_vkCreateInstance 20000
+
+#define OP_vkDestroyInstance 20001
+
+#define OP_vkEnumeratePhysicalDevices 20002
+
+#define OP_vkGetPhysicalDeviceFeatures 20003
+
+#define OP_vkGetPhysicalDeviceFormatProperties 20004
+
+#define OP_vkGetPhysicalDeviceImageFormatProperties 20005
+
+#define OP_vkGetPhysicalDeviceProperties 20006
+
+#define OP_vkGetPhysicalDeviceQueueFamilyProperties 20007
+
+#define OP_vkGetPhysicalDeviceMemoryProperties 20008
+
+#define OP_vkGetInstanceProcAddr 20009
+
+#define OP_vkGetDeviceProcAddr 20010
+
+#define OP_vkCreateDevice 20011
+
+#define OP_vkDestroyDevice 20012
+
+#define OP_vkEnumerateInstanceExtensionProperties 20013
+
+#define OP_vkEnumerateDeviceExtensionProperties 20014
+
+#define OP_vkEnumerateInstanceLayerProperties 20015
+
+#define OP_vkEnumerateDeviceLayerProperties 20016
+
+#define OP_vkGetDeviceQueue 20017
+
+#define OP_vkQueueSubmit 20018
+
+#define OP_vkQueueWaitIdle 20019
+
+#define OP_vkDeviceWaitIdle 20020
+
+#define OP_vkAllocateMemory 20021
+
+#define OP_vkFreeMemory 20022
+
+#define OP_vkMapMemory 20023
+
+#define OP_vkUnmapMemory 20024
+
+#define OP_vkFlushMappedMemoryRanges 20025
+
+#define OP_vkInvalidateMappedMemoryRanges 20026
+
+#define OP_vkGetDeviceMemoryCommitment 20027
+
+#define OP_vkBindBufferMemory 20028
+
+#define OP_vkBindImageMemory 20029
+
+#define OP_vkGetBufferMemoryRequirements 20030
+
+#define OP_vkGetImageMemoryRequirements 20031
+
+#define OP_vkGetImageSparseMemoryRequirements 20032
+
+#define OP_vkGetPhysicalDeviceSparseImageFormatProperties 20033
+
+#define OP_vkQueueBindSparse 20034
+
+#define OP_vkCreateFence 20035
+
+#define OP_vkDestroyFence 20036
+
+#define OP_vkResetFences 20037
+
+#define OP_vkGetFenceStatus 20038
+
+#define OP_vkWaitForFences 20039
+
+#define OP_vkCreateSemaphore 20040
+
+#define OP_vkDestroySemaphore 20041
+
+#define OP_vkCreateEvent 20042
+
+#define OP_vkDestroyEvent 20043
+
+#define OP_vkGetEventStatus 20044
+
+#define OP_vkSetEvent 20045
+
+#define OP_vkResetEvent 20046
+
+#define OP_vkCreateQueryPool 20047
+
+#define OP_vkDestroyQueryPool 20048
+
+#define OP_vkGetQueryPoolResults 20049
+
+#define OP_vkCreateBuffer 20050
+
+#define OP_vkDestroyBuffer 20051
+
+#define OP_vkCreateBufferView 20052
+
+#define OP_vkDestroyBufferView 20053
+
+#define OP_vkCreateImage 20054
+
+#define OP_vkDestroyImage 20055
+
+#define OP_vkGetImageSubresourceLayout 20056
+
+#define OP_vkCreateImageView 20057
+
+#define OP_vkDestroyImageView 20058
+
+#define OP_vkCreateShaderModule 20059
+
+#define OP_vkDestroyShaderModule 20060
+
+#define OP_vkCreatePipelineCache 20061
+
+#define OP_vkDestroyPipelineCache 20062
+
+#define OP_vkGetPipelineCacheData 20063
+
+#define OP_vkMergePipelineCaches 20064
+
+#define OP_vkCreateGraphicsPipelines 20065
+
+#define OP_vkCreateComputePipelines 20066
+
+#define OP_vkDestroyPipeline 20067
+
+#define OP_vkCreatePipelineLayout 20068
+
+#define OP_vkDestroyPipelineLayout 20069
+
+#define OP_vkCreateSampler 20070
+
+#define OP_vkDestroySampler 20071
+
+#define OP_vkCreateDescriptorSetLayout 20072
+
+#define OP_vkDestroyDescriptorSetLayout 20073
+
+#define OP_vkCreateDescriptorPool 20074
+
+#define OP_vkDestroyDescriptorPool 20075
+
+#define OP_vkResetDescriptorPool 20076
+
+#define OP_vkAllocateDescriptorSets 20077
+
+#define OP_vkFreeDescriptorSets 20078
+
+#define OP_vkUpdateDescriptorSets 20079
+
+#define OP_vkCreateFramebuffer 20080
+
+#define OP_vkDestroyFramebuffer 20081
+
+#define OP_vkCreateRenderPass 20082
+
+#define OP_vkDestroyRenderPass 20083
+
+#define OP_vkGetRenderAreaGranularity 20084
+
+#define OP_vkCreateCommandPool 20085
+
+#define OP_vkDestroyCommandPool 20086
+
+#define OP_vkResetCommandPool 20087
+
+#define OP_vkAllocateCommandBuffers 20088
+
+#define OP_vkFreeCommandBuffers 20089
+
+#define OP_vkBeginCommandBuffer 20090
+
+#define OP_vkEndCommandBuffer 20091
+
+#define OP_vkResetCommandBuffer 20092
+
+#define OP_vkCmdBindPipeline 20093
+
+#define OP_vkCmdSetViewport 20094
+
+#define OP_vkCmdSetScissor 20095
+
+#define OP_vkCmdSetLineWidth 20096
+
+#define OP_vkCmdSetDepthBias 20097
+
+#define OP_vkCmdSetBlendConstants 20098
+
+#define OP_vkCmdSetDepthBounds 20099
+
+#define OP_vkCmdSetStencilCompareMask 20100
+
+#define OP_vkCmdSetStencilWriteMask 20101
+
+#define OP_vkCmdSetStencilReference 20102
+
+#define OP_vkCmdBindDescriptorSets 20103
+
+#define OP_vkCmdBindIndexBuffer 20104
+
+#define OP_vkCmdBindVertexBuffers 20105
+
+#define OP_vkCmdDraw 20106
+
+#define OP_vkCmdDrawIndexed 20107
+
+#define OP_vkCmdDrawIndirect 20108
+
+#define OP_vkCmdDrawIndexedIndirect 20109
+
+#define OP_vkCmdDispatch 20110
+
+#define OP_vkCmdDispatchIndirect 20111
+
+#define OP_vkCmdCopyBuffer 20112
+
+#define OP_vkCmdCopyImage 20113
+
+#define OP_vkCmdBlitImage 20114
+
+#define OP_vkCmdCopyBufferToImage 20115
+
+#define OP_vkCmdCopyImageToBuffer 20116
+
+#define OP_vkCmdUpdateBuffer 20117
+
+#define OP_vkCmdFillBuffer 20118
+
+#define OP_vkCmdClearColorImage 20119
+
+#define OP_vkCmdClearDepthStencilImage 20120
+
+#define OP_vkCmdClearAttachments 20121
+
+#define OP_vkCmdResolveImage 20122
+
+#define OP_vkCmdSetEvent 20123
+
+#define OP_vkCmdResetEvent 20124
+
+#define OP_vkCmdWaitEvents 20125
+
+#define OP_vkCmdPipelineBarrier 20126
+
+#define OP_vkCmdBeginQuery 20127
+
+#define OP_vkCmdEndQuery 20128
+
+#define OP_vkCmdResetQueryPool 20129
+
+#define OP_vkCmdWriteTimestamp 20130
+
+#define OP_vkCmdCopyQueryPoolResults 20131
+
+#define OP_vkCmdPushConstants 20132
+
+#define OP_vkCmdBeginRenderPass 20133
+
+#define OP_vkCmdNextSubpass 20134
+
+#define OP_vkCmdEndRenderPass 20135
+
+#define OP_vkCmdExecuteCommands 20136
+
+#endif
+
+#ifdef VK_VERSION_1_1
+
+#define OP_vkEnumerateInstanceVersion 20137
+
+#define OP_vkBindBufferMemory2 20138
+
+#define OP_vkBindImageMemory2 20139
+
+#define OP_vkGetDeviceGroupPeerMemoryFeatures 20140
+
+#define OP_vkCmdSetDeviceMask 20141
+
+#define OP_vkCmdDispatchBase 20142
+
+#define OP_vkEnumeratePhysicalDeviceGroups 20143
+
+#define OP_vkGetImageMemoryRequirements2 20144
+
+#define OP_vkGetBufferMemoryRequirements2 20145
+
+#define OP_vkGetImageSparseMemoryRequirements2 20146
+
+#define OP_vkGetPhysicalDeviceFeatures2 20147
+
+#define OP_vkGetPhysicalDeviceProperties2 20148
+
+#define OP_vkGetPhysicalDeviceFormatProperties2 20149
+
+#define OP_vkGetPhysicalDeviceImageFormatProperties2 20150
+
+#define OP_vkGetPhysicalDeviceQueueFamilyProperties2 20151
+
+#define OP_vkGetPhysicalDeviceMemoryProperties2 20152
+
+#define OP_vkGetPhysicalDeviceSparseImageFormatProperties2 20153
+
+#define OP_vkTrimCommandPool 20154
+
+#define OP_vkGetDeviceQueue2 20155
+
+#define OP_vkCreateSamplerYcbcrConversion 20156
+
+#define OP_vkDestroySamplerYcbcrConversion 20157
+
+#define OP_vkCreateDescriptorUpdateTemplate 20158
+
+#define OP_vkDestroyDescriptorUpdateTemplate 20159
+
+#define OP_vkUpdateDescriptorSetWithTemplate 20160
+
+#define OP_vkGetPhysicalDeviceExternalBufferProperties 20161
+
+#define OP_vkGetPhysicalDeviceExternalFenceProperties 20162
+
+#define OP_vkGetPhysicalDeviceExternalSemaphoreProperties 20163
+
+#define OP_vkGetDescriptorSetLayoutSupport 20164
+
+#endif
+
+#ifdef VK_KHR_surface
+
+#define OP_vkDestroySurfaceKHR 20165
+
+#define OP_vkGetPhysicalDeviceSurfaceSupportKHR 20166
+
+#define OP_vkGetPhysicalDeviceSurfaceCapabilitiesKHR 20167
+
+#define OP_vkGetPhysicalDeviceSurfaceFormatsKHR 20168
+
+#define OP_vkGetPhysicalDeviceSurfacePresentModesKHR 20169
+
+#endif
+
+#ifdef VK_KHR_swapchain
+
+#define OP_vkCreateSwapchainKHR 20170
+
+#define OP_vkDestroySwapchainKHR 20171
+
+#define OP_vkGetSwapchainImagesKHR 20172
+
+#define OP_vkAcquireNextImageKHR 20173
+
+#define OP_vkQueuePresentKHR 20174
+
+#define OP_vkGetDeviceGroupPresentCapabilitiesKHR 20175
+
+#define OP_vkGetDeviceGroupSurfacePresentModesKHR 20176
+
+#define OP_vkGetPhysicalDevicePresentRectanglesKHR 20177
+
+#define OP_vkAcquireNextImage2KHR 20178
+
+#endif
+
+#ifdef VK_KHR_display
+
+#define OP_vkGetPhysicalDeviceDisplayPropertiesKHR 20179
+
+#define OP_vkGetPhysicalDeviceDisplayPlanePropertiesKHR 20180
+
+#define OP_vkGetDisplayPlaneSupportedDisplaysKHR 20181
+
+#define OP_vkGetDisplayModePropertiesKHR 20182
+
+#define OP_vkCreateDisplayModeKHR 20183
+
+#define OP_vkGetDisplayPlaneCapabilitiesKHR 20184
+
+#define OP_vkCreateDisplayPlaneSurfaceKHR 20185
+
+#endif
+
+#ifdef VK_KHR_display_swapchain
+
+#define OP_vkCreateSharedSwapchainsKHR 20186
+
+#endif
+
+#ifdef VK_KHR_xlib_surface
+
+#define OP_vkCreateXlibSurfaceKHR 20187
+
+#define OP_vkGetPhysicalDeviceXlibPresentationSupportKHR 20188
+
+#endif
+
+#ifdef VK_KHR_xcb_surface
+
+#define OP_vkCreateXcbSurfaceKHR 20189
+
+#define OP_vkGetPhysicalDeviceXcbPresentationSupportKHR 20190
+
+#endif
+
+#ifdef VK_KHR_wayland_surface
+
+#define OP_vkCreateWaylandSurfaceKHR 20191
+
+#define OP_vkGetPhysicalDeviceWaylandPresentationSupportKHR 20192
+
+#endif
+
+#ifdef VK_KHR_mir_surface
+
+#define OP_vkCreateMirSurfaceKHR 20193
+
+#define OP_vkGetPhysicalDeviceMirPresentationSupportKHR 20194
+
+#endif
+
+#ifdef VK_KHR_android_surface
+
+#define OP_vkCreateAndroidSurfaceKHR 20195
+
+#endif
+
+#ifdef VK_KHR_win32_surface
+
+#define OP_vkCreateWin32SurfaceKHR 20196
+
+#define OP_vkGetPhysicalDeviceWin32PresentationSupportKHR 20197
+
+#endif
+
+#ifdef VK_KHR_sampler_mirror_clamp_to_edge
+
+#endif
+
+#ifdef VK_KHR_multiview
+
+#endif
+
+#ifdef VK_KHR_get_physical_device_properties2
+
+#define OP_vkGetPhysicalDeviceFeatures2KHR 20198
+
+#define OP_vkGetPhysicalDeviceProperties2KHR 20199
+
+#define OP_vkGetPhysicalDeviceFormatProperties2KHR 20200
+
+#define OP_vkGetPhysicalDeviceImageFormatProperties2KHR 20201
+
+#define OP_vkGetPhysicalDeviceQueueFamilyProperties2KHR 20202
+
+#define OP_vkGetPhysicalDeviceMemoryProperties2KHR 20203
+
+#define OP_vkGetPhysicalDeviceSparseImageFormatProperties2KHR 20204
+
+#endif
+
+#ifdef VK_KHR_device_group
+
+#define OP_vkGetDeviceGroupPeerMemoryFeaturesKHR 20205
+
+#define OP_vkCmdSetDeviceMaskKHR 20206
+
+#define OP_vkCmdDispatchBaseKHR 20207
+
+#endif
+
+#ifdef VK_KHR_shader_draw_parameters
+
+#endif
+
+#ifdef VK_KHR_maintenance1
+
+#define OP_vkTrimCommandPoolKHR 20208
+
+#endif
+
+#ifdef VK_KHR_device_group_creation
+
+#define OP_vkEnumeratePhysicalDeviceGroupsKHR 20209
+
+#endif
+
+#ifdef VK_KHR_external_memory_capabilities
+
+#define OP_vkGetPhysicalDeviceExternalBufferPropertiesKHR 20210
+
+#endif
+
+#ifdef VK_KHR_external_memory
+
+#endif
+
+#ifdef VK_KHR_external_memory_win32
+
+#define OP_vkGetMemoryWin32HandleKHR 20211
+
+#define OP_vkGetMemoryWin32HandlePropertiesKHR 20212
+
+#endif
+
+#ifdef VK_KHR_external_memory_fd
+
+#define OP_vkGetMemoryFdKHR 20213
+
+#define OP_vkGetMemoryFdPropertiesKHR 20214
+
+#endif
+
+#ifdef VK_KHR_win32_keyed_mutex
+
+#endif
+
+#ifdef VK_KHR_external_semaphore_capabilities
+
+#define OP_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR 20215
+
+#endif
+
+#ifdef VK_KHR_external_semaphore
+
+#endif
+
+#ifdef VK_KHR_external_semaphore_win32
+
+#define OP_vkImportSemaphoreWin32HandleKHR 20216
+
+#define OP_vkGetSemaphoreWin32HandleKHR 20217
+
+#endif
+
+#ifdef VK_KHR_external_semaphore_fd
+
+#define OP_vkImportSemaphoreFdKHR 20218
+
+#define OP_vkGetSemaphoreFdKHR 20219
+
+#endif
+
+#ifdef VK_KHR_push_descriptor
+
+#define OP_vkCmdPushDescriptorSetKHR 20220
+
+#define OP_vkCmdPushDescriptorSetWithTemplateKHR 20221
+
+#endif
+
+#ifdef VK_KHR_16bit_storage
+
+#endif
+
+#ifdef VK_KHR_incremental_present
+
+#endif
+
+#ifdef VK_KHR_descriptor_update_template
+
+#define OP_vkCreateDescriptorUpdateTemplateKHR 20222
+
+#define OP_vkDestroyDescriptorUpdateTemplateKHR 20223
+
+#define OP_vkUpdateDescriptorSetWithTemplateKHR 20224
+
+#endif
+
+#ifdef VK_KHR_create_renderpass2
+
+#define OP_vkCreateRenderPass2KHR 20225
+
+#define OP_vkCmdBeginRenderPass2KHR 20226
+
+#define OP_vkCmdNextSubpass2KHR 20227
+
+#define OP_vkCmdEndRenderPass2KHR 20228
+
+#endif
+
+#ifdef VK_KHR_shared_presentable_image
+
+#define OP_vkGetSwapchainStatusKHR 20229
+
+#endif
+
+#ifdef VK_KHR_external_fence_capabilities
+
+#define OP_vkGetPhysicalDeviceExternalFencePropertiesKHR 20230
+
+#endif
+
+#ifdef VK_KHR_external_fence
+
+#endif
+
+#ifdef VK_KHR_external_fence_win32
+
+#define OP_vkImportFenceWin32HandleKHR 20231
+
+#define OP_vkGetFenceWin32HandleKHR 20232
+
+#endif
+
+#ifdef VK_KHR_external_fence_fd
+
+#define OP_vkImportFenceFdKHR 20233
+
+#define OP_vkGetFenceFdKHR 20234
+
+#endif
+
+#ifdef VK_KHR_maintenance2
+
+#endif
+
+#ifdef VK_KHR_get_surface_capabilities2
+
+#define OP_vkGetPhysicalDeviceSurfaceCapabilities2KHR 20235
+
+#define OP_vkGetPhysicalDeviceSurfaceFormats2KHR 20236
+
+#endif
+
+#ifdef VK_KHR_variable_pointers
+
+#endif
+
+#ifdef VK_KHR_get_display_properties2
+
+#define OP_vkGetPhysicalDeviceDisplayProperties2KHR 20237
+
+#define OP_vkGetPhysicalDeviceDisplayPlaneProperties2KHR 20238
+
+#define OP_vkGetDisplayModeProperties2KHR 20239
+
+#define OP_vkGetDisplayPlaneCapabilities2KHR 20240
+
+#endif
+
+#ifdef VK_KHR_dedicated_allocation
+
+#endif
+
+#ifdef VK_KHR_storage_buffer_storage_class
+
+#endif
+
+#ifdef VK_KHR_relaxed_block_layout
+
+#endif
+
+#ifdef VK_KHR_get_memory_requirements2
+
+#define OP_vkGetImageMemoryRequirements2KHR 20241
+
+#define OP_vkGetBufferMemoryRequirements2KHR 20242
+
+#define OP_vkGetImageSparseMemoryRequirements2KHR 20243
+
+#endif
+
+#ifdef VK_KHR_image_format_list
+
+#endif
+
+#ifdef VK_KHR_sampler_ycbcr_conversion
+
+#define OP_vkCreateSamplerYcbcrConversionKHR 20244
+
+#define OP_vkDestroySamplerYcbcrConversionKHR 20245
+
+#endif
+
+#ifdef VK_KHR_bind_memory2
+
+#define OP_vkBindBufferMemory2KHR 20246
+
+#define OP_vkBindImageMemory2KHR 20247
+
+#endif
+
+#ifdef VK_KHR_maintenance3
+
+#define OP_vkGetDescriptorSetLayoutSupportKHR 20248
+
+#endif
+
+#ifdef VK_KHR_draw_indirect_count
+
+#define OP_vkCmdDrawIndirectCountKHR 20249
+
+#define OP_vkCmdDrawIndexedIndirectCountKHR 20250
+
+#endif
+
+#ifdef VK_KHR_8bit_storage
+
+#endif
+
+#ifdef VK_EXT_debug_report
+
+#define OP_vkCreateDebugReportCallbackEXT 20251
+
+#define OP_vkDestroyDebugReportCallbackEXT 20252
+
+#define OP_vkDebugReportMessageEXT 20253
+
+#endif
+
+#ifdef VK_NV_glsl_shader
+
+#endif
+
+#ifdef VK_EXT_depth_range_unrestricted
+
+#endif
+
+#ifdef VK_IMG_filter_cubic
+
+#endif
+
+#ifdef VK_AMD_rasterization_order
+
+#endif
+
+#ifdef VK_AMD_shader_trinary_minmax
+
+#endif
+
+#ifdef VK_AMD_shader_explicit_vertex_parameter
+
+#endif
+
+#ifdef VK_EXT_debug_marker
+
+#define OP_vkDebugMarkerSetObjectTagEXT 20254
+
+#define OP_vkDebugMarkerSetObjectNameEXT 20255
+
+#define OP_vkCmdDebugMarkerBeginEXT 20256
+
+#define OP_vkCmdDebugMarkerEndEXT 20257
+
+#define OP_vkCmdDebugMarkerInsertEXT 20258
+
+#endif
+
+#ifdef VK_AMD_gcn_shader
+
+#endif
+
+#ifdef VK_NV_dedicated_allocation
+
+#endif
+
+#ifdef VK_AMD_draw_indirect_count
+
+#define OP_vkCmdDrawIndirectCountAMD 20259
+
+#define OP_vkCmdDrawIndexedIndirectCountAMD 20260
+
+#endif
+
+#ifdef VK_AMD_negative_viewport_height
+
+#endif
+
+#ifdef VK_AMD_gpu_shader_half_float
+
+#endif
+
+#ifdef VK_AMD_shader_ballot
+
+#endif
+
+#ifdef VK_AMD_texture_gather_bias_lod
+
+#endif
+
+#ifdef VK_AMD_shader_info
+
+#define OP_vkGetShaderInfoAMD 20261
+
+#endif
+
+#ifdef VK_AMD_shader_image_load_store_lod
+
+#endif
+
+#ifdef VK_IMG_format_pvrtc
+
+#endif
+
+#ifdef VK_NV_external_memory_capabilities
+
+#define OP_vkGetPhysicalDeviceExternalImageFormatPropertiesNV 20262
+
+#endif
+
+#ifdef VK_NV_external_memory
+
+#endif
+
+#ifdef VK_NV_external_memory_win32
+
+#define OP_vkGetMemoryWin32HandleNV 20263
+
+#endif
+
+#ifdef VK_NV_win32_keyed_mutex
+
+#endif
+
+#ifdef VK_EXT_validation_flags
+
+#endif
+
+#ifdef VK_NN_vi_surface
+
+#define OP_vkCreateViSurfaceNN 20264
+
+#endif
+
+#ifdef VK_EXT_shader_subgroup_ballot
+
+#endif
+
+#ifdef VK_EXT_shader_subgroup_vote
+
+#endif
+
+#ifdef VK_EXT_conditional_rendering
+
+#define OP_vkCmdBeginConditionalRenderingEXT 20265
+
+#define OP_vkCmdEndConditionalRenderingEXT 20266
+
+#endif
+
+#ifdef VK_NVX_device_generated_commands
+
+#define OP_vkCmdProcessCommandsNVX 20267
+
+#define OP_vkCmdReserveSpaceForCommandsNVX 20268
+
+#define OP_vkCreateIndirectCommandsLayoutNVX 20269
+
+#define OP_vkDestroyIndirectCommandsLayoutNVX 20270
+
+#define OP_vkCreateObjectTableNVX 20271
+
+#define OP_vkDestroyObjectTableNVX 20272
+
+#define OP_vkRegisterObjectsNVX 20273
+
+#define OP_vkUnregisterObjectsNVX 20274
+
+#define OP_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX 20275
+
+#endif
+
+#ifdef VK_NV_clip_space_w_scaling
+
+#define OP_vkCmdSetViewportWScalingNV 20276
+
+#endif
+
+#ifdef VK_EXT_direct_mode_display
+
+#define OP_vkReleaseDisplayEXT 20277
+
+#endif
+
+#ifdef VK_EXT_acquire_xlib_display
+
+#define OP_vkAcquireXlibDisplayEXT 20278
+
+#define OP_vkGetRandROutputDisplayEXT 20279
+
+#endif
+
+#ifdef VK_EXT_display_surface_counter
+
+#define OP_vkGetPhysicalDeviceSurfaceCapabilities2EXT 20280
+
+#endif
+
+#ifdef VK_EXT_display_control
+
+#define OP_vkDisplayPowerControlEXT 20281
+
+#define OP_vkRegisterDeviceEventEXT 20282
+
+#define OP_vkRegisterDisplayEventEXT 20283
+
+#define OP_vkGetSwapchainCounterEXT 20284
+
+#endif
+
+#ifdef VK_GOOGLE_display_timing
+
+#define OP_vkGetRefreshCycleDurationGOOGLE 20285
+
+#define OP_vkGetPastPresentationTimingGOOGLE 20286
+
+#endif
+
+#ifdef VK_NV_sample_mask_override_coverage
+
+#endif
+
+#ifdef VK_NV_geometry_shader_passthrough
+
+#endif
+
+#ifdef VK_NV_viewport_array2
+
+#endif
+
+#ifdef VK_NVX_multiview_per_view_attributes
+
+#endif
+
+#ifdef VK_NV_viewport_swizzle
+
+#endif
+
+#ifdef VK_EXT_discard_rectangles
+
+#define OP_vkCmdSetDiscardRectangleEXT 20287
+
+#endif
+
+#ifdef VK_EXT_conservative_rasterization
+
+#endif
+
+#ifdef VK_EXT_swapchain_colorspace
+
+#endif
+
+#ifdef VK_EXT_hdr_metadata
+
+#define OP_vkSetHdrMetadataEXT 20288
+
+#endif
+
+#ifdef VK_MVK_ios_surface
+
+#define OP_vkCreateIOSSurfaceMVK 20289
+
+#endif
+
+#ifdef VK_MVK_macos_surface
+
+#define OP_vkCreateMacOSSurfaceMVK 20290
+
+#endif
+
+#ifdef VK_EXT_external_memory_dma_buf
+
+#endif
+
+#ifdef VK_EXT_queue_family_foreign
+
+#endif
+
+#ifdef VK_EXT_debug_utils
+
+#define OP_vkSetDebugUtilsObjectNameEXT 20291
+
+#define OP_vkSetDebugUtilsObjectTagEXT 20292
+
+#define OP_vkQueueBeginDebugUtilsLabelEXT 20293
+
+#define OP_vkQueueEndDebugUtilsLabelEXT 20294
+
+#define OP_vkQueueInsertDebugUtilsLabelEXT 20295
+
+#define OP_vkCmdBeginDebugUtilsLabelEXT 20296
+
+#define OP_vkCmdEndDebugUtilsLabelEXT 20297
+
+#define OP_vkCmdInsertDebugUtilsLabelEXT 20298
+
+#define OP_vkCreateDebugUtilsMessengerEXT 20299
+
+#define OP_vkDestroyDebugUtilsMessengerEXT 20300
+
+#define OP_vkSubmitDebugUtilsMessageEXT 20301
+
+#endif
+
+#ifdef VK_ANDROID_external_memory_android_hardware_buffer
+
+#define OP_vkGetAndroidHardwareBufferPropertiesANDROID 20302
+
+#define OP_vkGetMemoryAndroidHardwareBufferANDROID 20303
+
+#endif
+
+#ifdef VK_EXT_sampler_filter_minmax
+
+#endif
+
+#ifdef VK_AMD_gpu_shader_int16
+
+#endif
+
+#ifdef VK_AMD_mixed_attachment_samples
+
+#endif
+
+#ifdef VK_AMD_shader_fragment_mask
+
+#endif
+
+#ifdef VK_EXT_shader_stencil_export
+
+#endif
+
+#ifdef VK_EXT_sample_locations
+
+#define OP_vkCmdSetSampleLocationsEXT 20304
+
+#define OP_vkGetPhysicalDeviceMultisamplePropertiesEXT 20305
+
+#endif
+
+#ifdef VK_EXT_blend_operation_advanced
+
+#endif
+
+#ifdef VK_NV_fragment_coverage_to_color
+
+#endif
+
+#ifdef VK_NV_framebuffer_mixed_samples
+
+#endif
+
+#ifdef VK_NV_fill_rectangle
+
+#endif
+
+#ifdef VK_EXT_post_depth_coverage
+
+#endif
+
+#ifdef VK_EXT_validation_cache
+
+#define OP_vkCreateValidationCacheEXT 20306
+
+#define OP_vkDestroyValidationCacheEXT 20307
+
+#define OP_vkMergeValidationCachesEXT 20308
+
+#define OP_vkGetValidationCacheDataEXT 20309
+
+#endif
+
+#ifdef VK_EXT_descriptor_indexing
+
+#endif
+
+#ifdef VK_EXT_shader_viewport_index_layer
+
+#endif
+
+#ifdef VK_EXT_global_priority
+
+#endif
+
+#ifdef VK_EXT_external_memory_host
+
+#define OP_vkGetMemoryHostPointerPropertiesEXT 20310
+
+#endif
+
+#ifdef VK_AMD_buffer_marker
+
+#define OP_vkCmdWriteBufferMarkerAMD 20311
+
+#endif
+
+#ifdef VK_AMD_shader_core_properties
+
+#endif
+
+#ifdef VK_EXT_vertex_attribute_divisor
+
+#endif
+
+#ifdef VK_NV_shader_subgroup_partitioned
+
+#endif
+
+#ifdef VK_NV_device_diagnostic_checkpoints
+
+#define OP_vkCmdSetCheckpointNV 20312
+
+#define OP_vkGetQueueCheckpointDataNV 20313
+
+#endif
+
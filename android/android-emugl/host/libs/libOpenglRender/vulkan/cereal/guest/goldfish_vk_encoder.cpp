@@ -1,49 +1,127 @@
 // Module: goldfish_vk_encoder (impl) Autogenerated by CerealGenerator
 
+
+#include "goldfish_vk_encoder.h"
+
+#include "common/goldfish_vk_marshaling.h"
+#include "common/goldfish_vk_opcodes.h"
+
+namespace goldfish_vk {
+
 #ifdef VK_VERSION_1_0
 
 VkResult encode_vkCreateInstance(
-    void* vkStream,
+    VulkanStream* vkStream,
     const VkInstanceCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkInstance* pInstance)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateInstance);
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkInstanceCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pInstance ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateInstance_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateInstance_VkResult_return, sizeof(VkResult));
+    if (vkCreateInstance_VkResult_return >= 0)
+    {
+        if (pInstance)
+        {
+            *pInstance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateInstance_VkResult_return;
 }
 
 void encode_vkDestroyInstance(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyInstance);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkEnumeratePhysicalDevices(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     uint32_t* pPhysicalDeviceCount,
     VkPhysicalDevice* pPhysicalDevices)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkEnumeratePhysicalDevices);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->putU32(pPhysicalDeviceCount ? 1 : 0);
+    if (pPhysicalDeviceCount)
+    {
+        vkStream->write(pPhysicalDeviceCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pPhysicalDevices ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkEnumeratePhysicalDevices_VkResult_return = (VkResult)0;
+    vkStream->read(&vkEnumeratePhysicalDevices_VkResult_return, sizeof(VkResult));
+    if (vkEnumeratePhysicalDevices_VkResult_return >= 0)
+    {
+        if (pPhysicalDeviceCount)
+        {
+            vkStream->read(pPhysicalDeviceCount, sizeof(uint32_t));
+        }
+        if (pPhysicalDevices)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceCount ? *pPhysicalDeviceCount : 0); ++i)
+            {
+                pPhysicalDevices[i] = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkEnumeratePhysicalDevices_VkResult_return;
 }
 
 void encode_vkGetPhysicalDeviceFeatures(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceFeatures* pFeatures)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceFeatures);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pFeatures ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pFeatures)
+    {
+        unmarshal_VkPhysicalDeviceFeatures(vkStream, pFeatures);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceFormatProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkFormatProperties* pFormatProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceFormatProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&format, sizeof(VkFormat));
+    vkStream->putU32(pFormatProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pFormatProperties)
+    {
+        unmarshal_VkFormatProperties(vkStream, pFormatProperties);
+    }
+    vkStream->clearPool();
 }
 
 VkResult encode_vkGetPhysicalDeviceImageFormatProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkImageType type,
@@ -52,153 +130,415 @@ VkResult encode_vkGetPhysicalDeviceImageFormatProperties(
     VkImageCreateFlags flags,
     VkImageFormatProperties* pImageFormatProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceImageFormatProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&format, sizeof(VkFormat));
+    vkStream->write(&type, sizeof(VkImageType));
+    vkStream->write(&tiling, sizeof(VkImageTiling));
+    vkStream->write(&usage, sizeof(VkImageUsageFlags));
+    vkStream->write(&flags, sizeof(VkImageCreateFlags));
+    vkStream->putU32(pImageFormatProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceImageFormatProperties_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceImageFormatProperties_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceImageFormatProperties_VkResult_return >= 0)
+    {
+        if (pImageFormatProperties)
+        {
+            unmarshal_VkImageFormatProperties(vkStream, pImageFormatProperties);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceImageFormatProperties_VkResult_return;
 }
 
 void encode_vkGetPhysicalDeviceProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceProperties* pProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pProperties)
+    {
+        unmarshal_VkPhysicalDeviceProperties(vkStream, pProperties);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceQueueFamilyProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pQueueFamilyPropertyCount,
     VkQueueFamilyProperties* pQueueFamilyProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceQueueFamilyProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pQueueFamilyPropertyCount ? 1 : 0);
+    if (pQueueFamilyPropertyCount)
+    {
+        vkStream->write(pQueueFamilyPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pQueueFamilyProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pQueueFamilyPropertyCount)
+    {
+        vkStream->read(pQueueFamilyPropertyCount, sizeof(uint32_t));
+    }
+    if (pQueueFamilyProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+        {
+            unmarshal_VkQueueFamilyProperties(vkStream, pQueueFamilyProperties + i);
+        }
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceMemoryProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceMemoryProperties* pMemoryProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceMemoryProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pMemoryProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMemoryProperties)
+    {
+        unmarshal_VkPhysicalDeviceMemoryProperties(vkStream, pMemoryProperties);
+    }
+    vkStream->clearPool();
 }
 
 PFN_vkVoidFunction encode_vkGetInstanceProcAddr(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const char* pName)
 {
+    // Not supported by the wire format.
     return (PFN_vkVoidFunction)0;
 }
 
 PFN_vkVoidFunction encode_vkGetDeviceProcAddr(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const char* pName)
 {
+    // Not supported by the wire format.
     return (PFN_vkVoidFunction)0;
 }
 
 VkResult encode_vkCreateDevice(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkDeviceCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkDevice* pDevice)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateDevice);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkDeviceCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pDevice ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateDevice_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateDevice_VkResult_return, sizeof(VkResult));
+    if (vkCreateDevice_VkResult_return >= 0)
+    {
+        if (pDevice)
+        {
+            *pDevice = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateDevice_VkResult_return;
 }
 
 void encode_vkDestroyDevice(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyDevice);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkEnumerateInstanceExtensionProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     const char* pLayerName,
     uint32_t* pPropertyCount,
     VkExtensionProperties* pProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkEnumerateInstanceExtensionProperties);
+    vkStream->putString(pLayerName);
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkEnumerateInstanceExtensionProperties_VkResult_return = (VkResult)0;
+    vkStream->read(&vkEnumerateInstanceExtensionProperties_VkResult_return, sizeof(VkResult));
+    if (vkEnumerateInstanceExtensionProperties_VkResult_return >= 0)
+    {
+        if (pPropertyCount)
+        {
+            vkStream->read(pPropertyCount, sizeof(uint32_t));
+        }
+        if (pProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+            {
+                unmarshal_VkExtensionProperties(vkStream, pProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkEnumerateInstanceExtensionProperties_VkResult_return;
 }
 
 VkResult encode_vkEnumerateDeviceExtensionProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const char* pLayerName,
     uint32_t* pPropertyCount,
     VkExtensionProperties* pProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkEnumerateDeviceExtensionProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putString(pLayerName);
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkEnumerateDeviceExtensionProperties_VkResult_return = (VkResult)0;
+    vkStream->read(&vkEnumerateDeviceExtensionProperties_VkResult_return, sizeof(VkResult));
+    if (vkEnumerateDeviceExtensionProperties_VkResult_return >= 0)
+    {
+        if (pPropertyCount)
+        {
+            vkStream->read(pPropertyCount, sizeof(uint32_t));
+        }
+        if (pProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+            {
+                unmarshal_VkExtensionProperties(vkStream, pProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkEnumerateDeviceExtensionProperties_VkResult_return;
 }
 
 VkResult encode_vkEnumerateInstanceLayerProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     uint32_t* pPropertyCount,
     VkLayerProperties* pProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkEnumerateInstanceLayerProperties);
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkEnumerateInstanceLayerProperties_VkResult_return = (VkResult)0;
+    vkStream->read(&vkEnumerateInstanceLayerProperties_VkResult_return, sizeof(VkResult));
+    if (vkEnumerateInstanceLayerProperties_VkResult_return >= 0)
+    {
+        if (pPropertyCount)
+        {
+            vkStream->read(pPropertyCount, sizeof(uint32_t));
+        }
+        if (pProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+            {
+                unmarshal_VkLayerProperties(vkStream, pProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkEnumerateInstanceLayerProperties_VkResult_return;
 }
 
 VkResult encode_vkEnumerateDeviceLayerProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkLayerProperties* pProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkEnumerateDeviceLayerProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkEnumerateDeviceLayerProperties_VkResult_return = (VkResult)0;
+    vkStream->read(&vkEnumerateDeviceLayerProperties_VkResult_return, sizeof(VkResult));
+    if (vkEnumerateDeviceLayerProperties_VkResult_return >= 0)
+    {
+        if (pPropertyCount)
+        {
+            vkStream->read(pPropertyCount, sizeof(uint32_t));
+        }
+        if (pProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+            {
+                unmarshal_VkLayerProperties(vkStream, pProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkEnumerateDeviceLayerProperties_VkResult_return;
 }
 
 void encode_vkGetDeviceQueue(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t queueFamilyIndex,
     uint32_t queueIndex,
     VkQueue* pQueue)
 {
+    vkStream->beginPacket(OP_vkGetDeviceQueue);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&queueFamilyIndex, sizeof(uint32_t));
+    vkStream->write(&queueIndex, sizeof(uint32_t));
+    vkStream->putU32(pQueue ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pQueue)
+    {
+        *pQueue = vkStream->handleMapping()->fromWire_VkQueue(vkStream, vkStream->getU64());
+    }
+    vkStream->clearPool();
 }
 
 VkResult encode_vkQueueSubmit(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     uint32_t submitCount,
     const VkSubmitInfo* pSubmits,
     VkFence fence)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkQueueSubmit);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueue(queue));
+    vkStream->write(&submitCount, sizeof(uint32_t));
+    vkStream->putU32(pSubmits ? 1 : 0);
+    if (pSubmits)
+    {
+        for (uint32_t i = 0; i < (uint32_t)submitCount; ++i)
+        {
+            marshal_VkSubmitInfo(vkStream, pSubmits + i);
+        }
+    }
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(fence));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkQueueSubmit_VkResult_return = (VkResult)0;
+    vkStream->read(&vkQueueSubmit_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkQueueSubmit_VkResult_return;
 }
 
 VkResult encode_vkQueueWaitIdle(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkQueueWaitIdle);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueue(queue));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkQueueWaitIdle_VkResult_return = (VkResult)0;
+    vkStream->read(&vkQueueWaitIdle_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkQueueWaitIdle_VkResult_return;
 }
 
 VkResult encode_vkDeviceWaitIdle(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkDeviceWaitIdle);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkDeviceWaitIdle_VkResult_return = (VkResult)0;
+    vkStream->read(&vkDeviceWaitIdle_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkDeviceWaitIdle_VkResult_return;
 }
 
 VkResult encode_vkAllocateMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkMemoryAllocateInfo* pAllocateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkDeviceMemory* pMemory)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkAllocateMemory);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pAllocateInfo ? 1 : 0);
+    if (pAllocateInfo)
+    {
+        marshal_VkMemoryAllocateInfo(vkStream, pAllocateInfo);
+    }
+    vkStream->putU32(pMemory ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkAllocateMemory_VkResult_return = (VkResult)0;
+    vkStream->read(&vkAllocateMemory_VkResult_return, sizeof(VkResult));
+    if (vkAllocateMemory_VkResult_return >= 0)
+    {
+        if (pMemory)
+        {
+            *pMemory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkAllocateMemory_VkResult_return;
 }
 
 void encode_vkFreeMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkFreeMemory);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(memory));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkMapMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory,
     VkDeviceSize offset,
@@ -206,89 +546,199 @@ VkResult encode_vkMapMemory(
     VkMemoryMapFlags flags,
     void** ppData)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 void encode_vkUnmapMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory)
 {
+    // Not supported by the wire format.
 }
 
 VkResult encode_vkFlushMappedMemoryRanges(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t memoryRangeCount,
     const VkMappedMemoryRange* pMemoryRanges)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkFlushMappedMemoryRanges);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&memoryRangeCount, sizeof(uint32_t));
+    vkStream->putU32(pMemoryRanges ? 1 : 0);
+    if (pMemoryRanges)
+    {
+        for (uint32_t i = 0; i < (uint32_t)memoryRangeCount; ++i)
+        {
+            marshal_VkMappedMemoryRange(vkStream, pMemoryRanges + i);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkFlushMappedMemoryRanges_VkResult_return = (VkResult)0;
+    vkStream->read(&vkFlushMappedMemoryRanges_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkFlushMappedMemoryRanges_VkResult_return;
 }
 
 VkResult encode_vkInvalidateMappedMemoryRanges(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t memoryRangeCount,
     const VkMappedMemoryRange* pMemoryRanges)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkInvalidateMappedMemoryRanges);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&memoryRangeCount, sizeof(uint32_t));
+    vkStream->putU32(pMemoryRanges ? 1 : 0);
+    if (pMemoryRanges)
+    {
+        for (uint32_t i = 0; i < (uint32_t)memoryRangeCount; ++i)
+        {
+            marshal_VkMappedMemoryRange(vkStream, pMemoryRanges + i);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkInvalidateMappedMemoryRanges_VkResult_return = (VkResult)0;
+    vkStream->read(&vkInvalidateMappedMemoryRanges_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkInvalidateMappedMemoryRanges_VkResult_return;
 }
 
 void encode_vkGetDeviceMemoryCommitment(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory,
     VkDeviceSize* pCommittedMemoryInBytes)
 {
+    vkStream->beginPacket(OP_vkGetDeviceMemoryCommitment);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(memory));
+    vkStream->putU32(pCommittedMemoryInBytes ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pCommittedMemoryInBytes)
+    {
+        vkStream->read(pCommittedMemoryInBytes, sizeof(VkDeviceSize));
+    }
+    vkStream->clearPool();
 }
 
 VkResult encode_vkBindBufferMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkBuffer buffer,
     VkDeviceMemory memory,
     VkDeviceSize memoryOffset)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkBindBufferMemory);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(memory));
+    vkStream->write(&memoryOffset, sizeof(VkDeviceSize));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkBindBufferMemory_VkResult_return = (VkResult)0;
+    vkStream->read(&vkBindBufferMemory_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkBindBufferMemory_VkResult_return;
 }
 
 VkResult encode_vkBindImageMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     VkDeviceMemory memory,
     VkDeviceSize memoryOffset)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkBindImageMemory);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(image));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(memory));
+    vkStream->write(&memoryOffset, sizeof(VkDeviceSize));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkBindImageMemory_VkResult_return = (VkResult)0;
+    vkStream->read(&vkBindImageMemory_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkBindImageMemory_VkResult_return;
 }
 
 void encode_vkGetBufferMemoryRequirements(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkBuffer buffer,
     VkMemoryRequirements* pMemoryRequirements)
 {
+    vkStream->beginPacket(OP_vkGetBufferMemoryRequirements);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->putU32(pMemoryRequirements ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMemoryRequirements)
+    {
+        unmarshal_VkMemoryRequirements(vkStream, pMemoryRequirements);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetImageMemoryRequirements(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     VkMemoryRequirements* pMemoryRequirements)
 {
+    vkStream->beginPacket(OP_vkGetImageMemoryRequirements);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(image));
+    vkStream->putU32(pMemoryRequirements ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMemoryRequirements)
+    {
+        unmarshal_VkMemoryRequirements(vkStream, pMemoryRequirements);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetImageSparseMemoryRequirements(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     uint32_t* pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements* pSparseMemoryRequirements)
 {
+    vkStream->beginPacket(OP_vkGetImageSparseMemoryRequirements);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(image));
+    vkStream->putU32(pSparseMemoryRequirementCount ? 1 : 0);
+    if (pSparseMemoryRequirementCount)
+    {
+        vkStream->write(pSparseMemoryRequirementCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pSparseMemoryRequirements ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pSparseMemoryRequirementCount)
+    {
+        vkStream->read(pSparseMemoryRequirementCount, sizeof(uint32_t));
+    }
+    if (pSparseMemoryRequirements)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+        {
+            unmarshal_VkSparseImageMemoryRequirements(vkStream, pSparseMemoryRequirements + i);
+        }
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceSparseImageFormatProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkImageType type,
@@ -298,144 +748,350 @@ void encode_vkGetPhysicalDeviceSparseImageFormatProperties(
     uint32_t* pPropertyCount,
     VkSparseImageFormatProperties* pProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSparseImageFormatProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&format, sizeof(VkFormat));
+    vkStream->write(&type, sizeof(VkImageType));
+    vkStream->write(&samples, sizeof(VkSampleCountFlagBits));
+    vkStream->write(&usage, sizeof(VkImageUsageFlags));
+    vkStream->write(&tiling, sizeof(VkImageTiling));
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pPropertyCount)
+    {
+        vkStream->read(pPropertyCount, sizeof(uint32_t));
+    }
+    if (pProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+        {
+            unmarshal_VkSparseImageFormatProperties(vkStream, pProperties + i);
+        }
+    }
+    vkStream->clearPool();
 }
 
 VkResult encode_vkQueueBindSparse(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     uint32_t bindInfoCount,
     const VkBindSparseInfo* pBindInfo,
     VkFence fence)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkQueueBindSparse);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueue(queue));
+    vkStream->write(&bindInfoCount, sizeof(uint32_t));
+    vkStream->putU32(pBindInfo ? 1 : 0);
+    if (pBindInfo)
+    {
+        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+        {
+            marshal_VkBindSparseInfo(vkStream, pBindInfo + i);
+        }
+    }
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(fence));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkQueueBindSparse_VkResult_return = (VkResult)0;
+    vkStream->read(&vkQueueBindSparse_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkQueueBindSparse_VkResult_return;
 }
 
 VkResult encode_vkCreateFence(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkFenceCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkFence* pFence)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateFence);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkFenceCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pFence ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateFence_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateFence_VkResult_return, sizeof(VkResult));
+    if (vkCreateFence_VkResult_return >= 0)
+    {
+        if (pFence)
+        {
+            *pFence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateFence_VkResult_return;
 }
 
 void encode_vkDestroyFence(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkFence fence,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyFence);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(fence));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkResetFences(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t fenceCount,
     const VkFence* pFences)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkResetFences);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&fenceCount, sizeof(uint32_t));
+    vkStream->putU32(pFences ? 1 : 0);
+    if (pFences)
+    {
+        for (uint32_t i = 0; i < (uint32_t)fenceCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(pFences[i]));
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkResetFences_VkResult_return = (VkResult)0;
+    vkStream->read(&vkResetFences_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkResetFences_VkResult_return;
 }
 
 VkResult encode_vkGetFenceStatus(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkFence fence)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetFenceStatus);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(fence));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetFenceStatus_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetFenceStatus_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkGetFenceStatus_VkResult_return;
 }
 
 VkResult encode_vkWaitForFences(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t fenceCount,
     const VkFence* pFences,
     VkBool32 waitAll,
     uint64_t timeout)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkWaitForFences);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&fenceCount, sizeof(uint32_t));
+    vkStream->putU32(pFences ? 1 : 0);
+    if (pFences)
+    {
+        for (uint32_t i = 0; i < (uint32_t)fenceCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(pFences[i]));
+        }
+    }
+    vkStream->write(&waitAll, sizeof(VkBool32));
+    vkStream->write(&timeout, sizeof(uint64_t));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkWaitForFences_VkResult_return = (VkResult)0;
+    vkStream->read(&vkWaitForFences_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkWaitForFences_VkResult_return;
 }
 
 VkResult encode_vkCreateSemaphore(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSemaphoreCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSemaphore* pSemaphore)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateSemaphore);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkSemaphoreCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pSemaphore ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateSemaphore_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateSemaphore_VkResult_return, sizeof(VkResult));
+    if (vkCreateSemaphore_VkResult_return >= 0)
+    {
+        if (pSemaphore)
+        {
+            *pSemaphore = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateSemaphore_VkResult_return;
 }
 
 void encode_vkDestroySemaphore(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSemaphore semaphore,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroySemaphore);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(semaphore));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkEventCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkEvent* pEvent)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateEvent);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkEventCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pEvent ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateEvent_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateEvent_VkResult_return, sizeof(VkResult));
+    if (vkCreateEvent_VkResult_return >= 0)
+    {
+        if (pEvent)
+        {
+            *pEvent = vkStream->handleMapping()->fromWire_VkEvent(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateEvent_VkResult_return;
 }
 
 void encode_vkDestroyEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkEvent event,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyEvent);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkEvent(event));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkGetEventStatus(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkEvent event)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetEventStatus);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkEvent(event));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetEventStatus_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetEventStatus_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkGetEventStatus_VkResult_return;
 }
 
 VkResult encode_vkSetEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkEvent event)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkSetEvent);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkEvent(event));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkSetEvent_VkResult_return = (VkResult)0;
+    vkStream->read(&vkSetEvent_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkSetEvent_VkResult_return;
 }
 
 VkResult encode_vkResetEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkEvent event)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkResetEvent);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkEvent(event));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkResetEvent_VkResult_return = (VkResult)0;
+    vkStream->read(&vkResetEvent_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkResetEvent_VkResult_return;
 }
 
 VkResult encode_vkCreateQueryPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkQueryPoolCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkQueryPool* pQueryPool)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateQueryPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkQueryPoolCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pQueryPool ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateQueryPool_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateQueryPool_VkResult_return, sizeof(VkResult));
+    if (vkCreateQueryPool_VkResult_return >= 0)
+    {
+        if (pQueryPool)
+        {
+            *pQueryPool = vkStream->handleMapping()->fromWire_VkQueryPool(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateQueryPool_VkResult_return;
 }
 
 void encode_vkDestroyQueryPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkQueryPool queryPool,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyQueryPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueryPool(queryPool));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkGetQueryPoolResults(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkQueryPool queryPool,
     uint32_t firstQuery,
@@ -445,148 +1101,371 @@ VkResult encode_vkGetQueryPoolResults(
     VkDeviceSize stride,
     VkQueryResultFlags flags)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetQueryPoolResults);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueryPool(queryPool));
+    vkStream->write(&firstQuery, sizeof(uint32_t));
+    vkStream->write(&queryCount, sizeof(uint32_t));
+    vkStream->putU64((uint64_t)dataSize);
+    vkStream->putU32(pData ? 1 : 0);
+    vkStream->write(&stride, sizeof(VkDeviceSize));
+    vkStream->write(&flags, sizeof(VkQueryResultFlags));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetQueryPoolResults_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetQueryPoolResults_VkResult_return, sizeof(VkResult));
+    if (vkGetQueryPoolResults_VkResult_return >= 0)
+    {
+        if (pData)
+        {
+            vkStream->read(pData, dataSize * sizeof(uint8_t));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetQueryPoolResults_VkResult_return;
 }
 
 VkResult encode_vkCreateBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkBufferCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkBuffer* pBuffer)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkBufferCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pBuffer ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateBuffer_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateBuffer_VkResult_return, sizeof(VkResult));
+    if (vkCreateBuffer_VkResult_return >= 0)
+    {
+        if (pBuffer)
+        {
+            *pBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateBuffer_VkResult_return;
 }
 
 void encode_vkDestroyBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkBuffer buffer,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateBufferView(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkBufferViewCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkBufferView* pView)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateBufferView);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkBufferViewCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pView ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateBufferView_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateBufferView_VkResult_return, sizeof(VkResult));
+    if (vkCreateBufferView_VkResult_return >= 0)
+    {
+        if (pView)
+        {
+            *pView = vkStream->handleMapping()->fromWire_VkBufferView(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateBufferView_VkResult_return;
 }
 
 void encode_vkDestroyBufferView(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkBufferView bufferView,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyBufferView);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBufferView(bufferView));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkImage* pImage)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateImage);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkImageCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pImage ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateImage_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateImage_VkResult_return, sizeof(VkResult));
+    if (vkCreateImage_VkResult_return >= 0)
+    {
+        if (pImage)
+        {
+            *pImage = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateImage_VkResult_return;
 }
 
 void encode_vkDestroyImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyImage);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(image));
+    vkStream->endPacket();
 }
 
 void encode_vkGetImageSubresourceLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     const VkImageSubresource* pSubresource,
     VkSubresourceLayout* pLayout)
 {
+    vkStream->beginPacket(OP_vkGetImageSubresourceLayout);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(image));
+    vkStream->putU32(pSubresource ? 1 : 0);
+    if (pSubresource)
+    {
+        marshal_VkImageSubresource(vkStream, pSubresource);
+    }
+    vkStream->putU32(pLayout ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pLayout)
+    {
+        unmarshal_VkSubresourceLayout(vkStream, pLayout);
+    }
+    vkStream->clearPool();
 }
 
 VkResult encode_vkCreateImageView(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageViewCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkImageView* pView)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateImageView);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkImageViewCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pView ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateImageView_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateImageView_VkResult_return, sizeof(VkResult));
+    if (vkCreateImageView_VkResult_return >= 0)
+    {
+        if (pView)
+        {
+            *pView = vkStream->handleMapping()->fromWire_VkImageView(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateImageView_VkResult_return;
 }
 
 void encode_vkDestroyImageView(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImageView imageView,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyImageView);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImageView(imageView));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateShaderModule(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkShaderModuleCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkShaderModule* pShaderModule)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateShaderModule);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkShaderModuleCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pShaderModule ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateShaderModule_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateShaderModule_VkResult_return, sizeof(VkResult));
+    if (vkCreateShaderModule_VkResult_return >= 0)
+    {
+        if (pShaderModule)
+        {
+            *pShaderModule = vkStream->handleMapping()->fromWire_VkShaderModule(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateShaderModule_VkResult_return;
 }
 
 void encode_vkDestroyShaderModule(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkShaderModule shaderModule,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyShaderModule);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkShaderModule(shaderModule));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreatePipelineCache(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkPipelineCacheCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkPipelineCache* pPipelineCache)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreatePipelineCache);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkPipelineCacheCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pPipelineCache ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreatePipelineCache_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreatePipelineCache_VkResult_return, sizeof(VkResult));
+    if (vkCreatePipelineCache_VkResult_return >= 0)
+    {
+        if (pPipelineCache)
+        {
+            *pPipelineCache = vkStream->handleMapping()->fromWire_VkPipelineCache(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreatePipelineCache_VkResult_return;
 }
 
 void encode_vkDestroyPipelineCache(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache pipelineCache,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyPipelineCache);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineCache(pipelineCache));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkGetPipelineCacheData(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache pipelineCache,
     size_t* pDataSize,
     void* pData)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPipelineCacheData);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineCache(pipelineCache));
+    vkStream->putU32(pDataSize ? 1 : 0);
+    if (pDataSize)
+    {
+        vkStream->putU64((uint64_t)*pDataSize);
+    }
+    vkStream->putU32(pData ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPipelineCacheData_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPipelineCacheData_VkResult_return, sizeof(VkResult));
+    if (vkGetPipelineCacheData_VkResult_return >= 0)
+    {
+        if (pDataSize)
+        {
+            *pDataSize = (size_t)vkStream->getU64();
+        }
+        if (pData)
+        {
+            vkStream->read(pData, (pDataSize ? *pDataSize : 0) * sizeof(uint8_t));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPipelineCacheData_VkResult_return;
 }
 
 VkResult encode_vkMergePipelineCaches(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache dstCache,
     uint32_t srcCacheCount,
     const VkPipelineCache* pSrcCaches)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkMergePipelineCaches);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineCache(dstCache));
+    vkStream->write(&srcCacheCount, sizeof(uint32_t));
+    vkStream->putU32(pSrcCaches ? 1 : 0);
+    if (pSrcCaches)
+    {
+        for (uint32_t i = 0; i < (uint32_t)srcCacheCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineCache(pSrcCaches[i]));
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkMergePipelineCaches_VkResult_return = (VkResult)0;
+    vkStream->read(&vkMergePipelineCaches_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkMergePipelineCaches_VkResult_return;
 }
 
 VkResult encode_vkCreateGraphicsPipelines(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache pipelineCache,
     uint32_t createInfoCount,
@@ -594,11 +1473,39 @@ VkResult encode_vkCreateGraphicsPipelines(
     const VkAllocationCallbacks* pAllocator,
     VkPipeline* pPipelines)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateGraphicsPipelines);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineCache(pipelineCache));
+    vkStream->write(&createInfoCount, sizeof(uint32_t));
+    vkStream->putU32(pCreateInfos ? 1 : 0);
+    if (pCreateInfos)
+    {
+        for (uint32_t i = 0; i < (uint32_t)createInfoCount; ++i)
+        {
+            marshal_VkGraphicsPipelineCreateInfo(vkStream, pCreateInfos + i);
+        }
+    }
+    vkStream->putU32(pPipelines ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateGraphicsPipelines_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateGraphicsPipelines_VkResult_return, sizeof(VkResult));
+    if (vkCreateGraphicsPipelines_VkResult_return >= 0)
+    {
+        if (pPipelines)
+        {
+            for (uint32_t i = 0; i < (uint32_t)createInfoCount; ++i)
+            {
+                pPipelines[i] = vkStream->handleMapping()->fromWire_VkPipeline(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateGraphicsPipelines_VkResult_return;
 }
 
 VkResult encode_vkCreateComputePipelines(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache pipelineCache,
     uint32_t createInfoCount,
@@ -606,322 +1513,740 @@ VkResult encode_vkCreateComputePipelines(
     const VkAllocationCallbacks* pAllocator,
     VkPipeline* pPipelines)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateComputePipelines);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineCache(pipelineCache));
+    vkStream->write(&createInfoCount, sizeof(uint32_t));
+    vkStream->putU32(pCreateInfos ? 1 : 0);
+    if (pCreateInfos)
+    {
+        for (uint32_t i = 0; i < (uint32_t)createInfoCount; ++i)
+        {
+            marshal_VkComputePipelineCreateInfo(vkStream, pCreateInfos + i);
+        }
+    }
+    vkStream->putU32(pPipelines ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateComputePipelines_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateComputePipelines_VkResult_return, sizeof(VkResult));
+    if (vkCreateComputePipelines_VkResult_return >= 0)
+    {
+        if (pPipelines)
+        {
+            for (uint32_t i = 0; i < (uint32_t)createInfoCount; ++i)
+            {
+                pPipelines[i] = vkStream->handleMapping()->fromWire_VkPipeline(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateComputePipelines_VkResult_return;
 }
 
 void encode_vkDestroyPipeline(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipeline pipeline,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyPipeline);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipeline(pipeline));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreatePipelineLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkPipelineLayoutCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkPipelineLayout* pPipelineLayout)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreatePipelineLayout);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkPipelineLayoutCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pPipelineLayout ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreatePipelineLayout_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreatePipelineLayout_VkResult_return, sizeof(VkResult));
+    if (vkCreatePipelineLayout_VkResult_return >= 0)
+    {
+        if (pPipelineLayout)
+        {
+            *pPipelineLayout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreatePipelineLayout_VkResult_return;
 }
 
 void encode_vkDestroyPipelineLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineLayout pipelineLayout,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyPipelineLayout);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(pipelineLayout));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateSampler(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSamplerCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSampler* pSampler)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateSampler);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkSamplerCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pSampler ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateSampler_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateSampler_VkResult_return, sizeof(VkResult));
+    if (vkCreateSampler_VkResult_return >= 0)
+    {
+        if (pSampler)
+        {
+            *pSampler = vkStream->handleMapping()->fromWire_VkSampler(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateSampler_VkResult_return;
 }
 
 void encode_vkDestroySampler(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSampler sampler,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroySampler);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSampler(sampler));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateDescriptorSetLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkDescriptorSetLayout* pSetLayout)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateDescriptorSetLayout);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkDescriptorSetLayoutCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pSetLayout ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateDescriptorSetLayout_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateDescriptorSetLayout_VkResult_return, sizeof(VkResult));
+    if (vkCreateDescriptorSetLayout_VkResult_return >= 0)
+    {
+        if (pSetLayout)
+        {
+            *pSetLayout = vkStream->handleMapping()->fromWire_VkDescriptorSetLayout(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateDescriptorSetLayout_VkResult_return;
 }
 
 void encode_vkDestroyDescriptorSetLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorSetLayout descriptorSetLayout,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyDescriptorSetLayout);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSetLayout(descriptorSetLayout));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateDescriptorPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorPoolCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkDescriptorPool* pDescriptorPool)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateDescriptorPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkDescriptorPoolCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pDescriptorPool ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateDescriptorPool_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateDescriptorPool_VkResult_return, sizeof(VkResult));
+    if (vkCreateDescriptorPool_VkResult_return >= 0)
+    {
+        if (pDescriptorPool)
+        {
+            *pDescriptorPool = vkStream->handleMapping()->fromWire_VkDescriptorPool(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateDescriptorPool_VkResult_return;
 }
 
 void encode_vkDestroyDescriptorPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorPool descriptorPool,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyDescriptorPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorPool(descriptorPool));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkResetDescriptorPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorPool descriptorPool,
     VkDescriptorPoolResetFlags flags)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkResetDescriptorPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorPool(descriptorPool));
+    vkStream->write(&flags, sizeof(VkDescriptorPoolResetFlags));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkResetDescriptorPool_VkResult_return = (VkResult)0;
+    vkStream->read(&vkResetDescriptorPool_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkResetDescriptorPool_VkResult_return;
 }
 
 VkResult encode_vkAllocateDescriptorSets(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorSetAllocateInfo* pAllocateInfo,
     VkDescriptorSet* pDescriptorSets)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkAllocateDescriptorSets);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pAllocateInfo ? 1 : 0);
+    if (pAllocateInfo)
+    {
+        marshal_VkDescriptorSetAllocateInfo(vkStream, pAllocateInfo);
+    }
+    vkStream->putU32(pDescriptorSets ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkAllocateDescriptorSets_VkResult_return = (VkResult)0;
+    vkStream->read(&vkAllocateDescriptorSets_VkResult_return, sizeof(VkResult));
+    if (vkAllocateDescriptorSets_VkResult_return >= 0)
+    {
+        if (pDescriptorSets)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pAllocateInfo ? pAllocateInfo->descriptorSetCount : 0); ++i)
+            {
+                pDescriptorSets[i] = vkStream->handleMapping()->fromWire_VkDescriptorSet(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkAllocateDescriptorSets_VkResult_return;
 }
 
 VkResult encode_vkFreeDescriptorSets(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorPool descriptorPool,
     uint32_t descriptorSetCount,
     const VkDescriptorSet* pDescriptorSets)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkFreeDescriptorSets);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorPool(descriptorPool));
+    vkStream->write(&descriptorSetCount, sizeof(uint32_t));
+    vkStream->putU32(pDescriptorSets ? 1 : 0);
+    if (pDescriptorSets)
+    {
+        for (uint32_t i = 0; i < (uint32_t)descriptorSetCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSet(pDescriptorSets[i]));
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkFreeDescriptorSets_VkResult_return = (VkResult)0;
+    vkStream->read(&vkFreeDescriptorSets_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkFreeDescriptorSets_VkResult_return;
 }
 
 void encode_vkUpdateDescriptorSets(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t descriptorWriteCount,
     const VkWriteDescriptorSet* pDescriptorWrites,
     uint32_t descriptorCopyCount,
     const VkCopyDescriptorSet* pDescriptorCopies)
 {
+    vkStream->beginPacket(OP_vkUpdateDescriptorSets);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&descriptorWriteCount, sizeof(uint32_t));
+    vkStream->putU32(pDescriptorWrites ? 1 : 0);
+    if (pDescriptorWrites)
+    {
+        for (uint32_t i = 0; i < (uint32_t)descriptorWriteCount; ++i)
+        {
+            marshal_VkWriteDescriptorSet(vkStream, pDescriptorWrites + i);
+        }
+    }
+    vkStream->write(&descriptorCopyCount, sizeof(uint32_t));
+    vkStream->putU32(pDescriptorCopies ? 1 : 0);
+    if (pDescriptorCopies)
+    {
+        for (uint32_t i = 0; i < (uint32_t)descriptorCopyCount; ++i)
+        {
+            marshal_VkCopyDescriptorSet(vkStream, pDescriptorCopies + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateFramebuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkFramebufferCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkFramebuffer* pFramebuffer)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateFramebuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkFramebufferCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pFramebuffer ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateFramebuffer_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateFramebuffer_VkResult_return, sizeof(VkResult));
+    if (vkCreateFramebuffer_VkResult_return >= 0)
+    {
+        if (pFramebuffer)
+        {
+            *pFramebuffer = vkStream->handleMapping()->fromWire_VkFramebuffer(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateFramebuffer_VkResult_return;
 }
 
 void encode_vkDestroyFramebuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkFramebuffer framebuffer,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyFramebuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFramebuffer(framebuffer));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateRenderPass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkRenderPassCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkRenderPass* pRenderPass)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateRenderPass);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkRenderPassCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pRenderPass ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateRenderPass_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateRenderPass_VkResult_return, sizeof(VkResult));
+    if (vkCreateRenderPass_VkResult_return >= 0)
+    {
+        if (pRenderPass)
+        {
+            *pRenderPass = vkStream->handleMapping()->fromWire_VkRenderPass(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateRenderPass_VkResult_return;
 }
 
 void encode_vkDestroyRenderPass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkRenderPass renderPass,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyRenderPass);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkRenderPass(renderPass));
+    vkStream->endPacket();
 }
 
 void encode_vkGetRenderAreaGranularity(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkRenderPass renderPass,
     VkExtent2D* pGranularity)
 {
+    vkStream->beginPacket(OP_vkGetRenderAreaGranularity);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkRenderPass(renderPass));
+    vkStream->putU32(pGranularity ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pGranularity)
+    {
+        unmarshal_VkExtent2D(vkStream, pGranularity);
+    }
+    vkStream->clearPool();
 }
 
 VkResult encode_vkCreateCommandPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkCommandPoolCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkCommandPool* pCommandPool)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateCommandPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkCommandPoolCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pCommandPool ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateCommandPool_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateCommandPool_VkResult_return, sizeof(VkResult));
+    if (vkCreateCommandPool_VkResult_return >= 0)
+    {
+        if (pCommandPool)
+        {
+            *pCommandPool = vkStream->handleMapping()->fromWire_VkCommandPool(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateCommandPool_VkResult_return;
 }
 
 void encode_vkDestroyCommandPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyCommandPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandPool(commandPool));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkResetCommandPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     VkCommandPoolResetFlags flags)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkResetCommandPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandPool(commandPool));
+    vkStream->write(&flags, sizeof(VkCommandPoolResetFlags));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkResetCommandPool_VkResult_return = (VkResult)0;
+    vkStream->read(&vkResetCommandPool_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkResetCommandPool_VkResult_return;
 }
 
 VkResult encode_vkAllocateCommandBuffers(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkCommandBufferAllocateInfo* pAllocateInfo,
     VkCommandBuffer* pCommandBuffers)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkAllocateCommandBuffers);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pAllocateInfo ? 1 : 0);
+    if (pAllocateInfo)
+    {
+        marshal_VkCommandBufferAllocateInfo(vkStream, pAllocateInfo);
+    }
+    vkStream->putU32(pCommandBuffers ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkAllocateCommandBuffers_VkResult_return = (VkResult)0;
+    vkStream->read(&vkAllocateCommandBuffers_VkResult_return, sizeof(VkResult));
+    if (vkAllocateCommandBuffers_VkResult_return >= 0)
+    {
+        if (pCommandBuffers)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pAllocateInfo ? pAllocateInfo->commandBufferCount : 0); ++i)
+            {
+                pCommandBuffers[i] = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkAllocateCommandBuffers_VkResult_return;
 }
 
 void encode_vkFreeCommandBuffers(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     uint32_t commandBufferCount,
     const VkCommandBuffer* pCommandBuffers)
 {
+    vkStream->beginPacket(OP_vkFreeCommandBuffers);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandPool(commandPool));
+    vkStream->write(&commandBufferCount, sizeof(uint32_t));
+    vkStream->putU32(pCommandBuffers ? 1 : 0);
+    if (pCommandBuffers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)commandBufferCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(pCommandBuffers[i]));
+        }
+    }
+    vkStream->endPacket();
 }
 
 VkResult encode_vkBeginCommandBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkCommandBufferBeginInfo* pBeginInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkBeginCommandBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pBeginInfo ? 1 : 0);
+    if (pBeginInfo)
+    {
+        marshal_VkCommandBufferBeginInfo(vkStream, pBeginInfo);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkBeginCommandBuffer_VkResult_return = (VkResult)0;
+    vkStream->read(&vkBeginCommandBuffer_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkBeginCommandBuffer_VkResult_return;
 }
 
 VkResult encode_vkEndCommandBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkEndCommandBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkEndCommandBuffer_VkResult_return = (VkResult)0;
+    vkStream->read(&vkEndCommandBuffer_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkEndCommandBuffer_VkResult_return;
 }
 
 VkResult encode_vkResetCommandBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkCommandBufferResetFlags flags)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkResetCommandBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&flags, sizeof(VkCommandBufferResetFlags));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkResetCommandBuffer_VkResult_return = (VkResult)0;
+    vkStream->read(&vkResetCommandBuffer_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkResetCommandBuffer_VkResult_return;
 }
 
 void encode_vkCmdBindPipeline(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineBindPoint pipelineBindPoint,
     VkPipeline pipeline)
 {
+    vkStream->beginPacket(OP_vkCmdBindPipeline);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipeline(pipeline));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetViewport(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstViewport,
     uint32_t viewportCount,
     const VkViewport* pViewports)
 {
+    vkStream->beginPacket(OP_vkCmdSetViewport);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&firstViewport, sizeof(uint32_t));
+    vkStream->write(&viewportCount, sizeof(uint32_t));
+    vkStream->putU32(pViewports ? 1 : 0);
+    if (pViewports)
+    {
+        for (uint32_t i = 0; i < (uint32_t)viewportCount; ++i)
+        {
+            marshal_VkViewport(vkStream, pViewports + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetScissor(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstScissor,
     uint32_t scissorCount,
     const VkRect2D* pScissors)
 {
+    vkStream->beginPacket(OP_vkCmdSetScissor);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&firstScissor, sizeof(uint32_t));
+    vkStream->write(&scissorCount, sizeof(uint32_t));
+    vkStream->putU32(pScissors ? 1 : 0);
+    if (pScissors)
+    {
+        for (uint32_t i = 0; i < (uint32_t)scissorCount; ++i)
+        {
+            marshal_VkRect2D(vkStream, pScissors + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetLineWidth(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     float lineWidth)
 {
+    vkStream->beginPacket(OP_vkCmdSetLineWidth);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&lineWidth, sizeof(float));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetDepthBias(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     float depthBiasConstantFactor,
     float depthBiasClamp,
     float depthBiasSlopeFactor)
 {
+    vkStream->beginPacket(OP_vkCmdSetDepthBias);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&depthBiasConstantFactor, sizeof(float));
+    vkStream->write(&depthBiasClamp, sizeof(float));
+    vkStream->write(&depthBiasSlopeFactor, sizeof(float));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetBlendConstants(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const float blendConstants[4])
 {
+    vkStream->beginPacket(OP_vkCmdSetBlendConstants);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(blendConstants, 4 * sizeof(float));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetDepthBounds(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     float minDepthBounds,
     float maxDepthBounds)
 {
+    vkStream->beginPacket(OP_vkCmdSetDepthBounds);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&minDepthBounds, sizeof(float));
+    vkStream->write(&maxDepthBounds, sizeof(float));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetStencilCompareMask(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkStencilFaceFlags faceMask,
     uint32_t compareMask)
 {
+    vkStream->beginPacket(OP_vkCmdSetStencilCompareMask);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&faceMask, sizeof(VkStencilFaceFlags));
+    vkStream->write(&compareMask, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetStencilWriteMask(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkStencilFaceFlags faceMask,
     uint32_t writeMask)
 {
+    vkStream->beginPacket(OP_vkCmdSetStencilWriteMask);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&faceMask, sizeof(VkStencilFaceFlags));
+    vkStream->write(&writeMask, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetStencilReference(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkStencilFaceFlags faceMask,
     uint32_t reference)
 {
+    vkStream->beginPacket(OP_vkCmdSetStencilReference);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&faceMask, sizeof(VkStencilFaceFlags));
+    vkStream->write(&reference, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdBindDescriptorSets(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineBindPoint pipelineBindPoint,
     VkPipelineLayout layout,
@@ -931,39 +2256,91 @@ void encode_vkCmdBindDescriptorSets(
     uint32_t dynamicOffsetCount,
     const uint32_t* pDynamicOffsets)
 {
+    vkStream->beginPacket(OP_vkCmdBindDescriptorSets);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(layout));
+    vkStream->write(&firstSet, sizeof(uint32_t));
+    vkStream->write(&descriptorSetCount, sizeof(uint32_t));
+    vkStream->putU32(pDescriptorSets ? 1 : 0);
+    if (pDescriptorSets)
+    {
+        for (uint32_t i = 0; i < (uint32_t)descriptorSetCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSet(pDescriptorSets[i]));
+        }
+    }
+    vkStream->write(&dynamicOffsetCount, sizeof(uint32_t));
+    vkStream->putU32(pDynamicOffsets ? 1 : 0);
+    if (pDynamicOffsets)
+    {
+        vkStream->write(pDynamicOffsets, dynamicOffsetCount * sizeof(uint32_t));
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdBindIndexBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
     VkIndexType indexType)
 {
+    vkStream->beginPacket(OP_vkCmdBindIndexBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->write(&offset, sizeof(VkDeviceSize));
+    vkStream->write(&indexType, sizeof(VkIndexType));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdBindVertexBuffers(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstBinding,
     uint32_t bindingCount,
     const VkBuffer* pBuffers,
     const VkDeviceSize* pOffsets)
 {
+    vkStream->beginPacket(OP_vkCmdBindVertexBuffers);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&firstBinding, sizeof(uint32_t));
+    vkStream->write(&bindingCount, sizeof(uint32_t));
+    vkStream->putU32(pBuffers ? 1 : 0);
+    if (pBuffers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)bindingCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(pBuffers[i]));
+        }
+    }
+    vkStream->putU32(pOffsets ? 1 : 0);
+    if (pOffsets)
+    {
+        vkStream->write(pOffsets, bindingCount * sizeof(VkDeviceSize));
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDraw(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t vertexCount,
     uint32_t instanceCount,
     uint32_t firstVertex,
     uint32_t firstInstance)
 {
+    vkStream->beginPacket(OP_vkCmdDraw);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&vertexCount, sizeof(uint32_t));
+    vkStream->write(&instanceCount, sizeof(uint32_t));
+    vkStream->write(&firstVertex, sizeof(uint32_t));
+    vkStream->write(&firstInstance, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDrawIndexed(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t indexCount,
     uint32_t instanceCount,
@@ -971,57 +2348,104 @@ void encode_vkCmdDrawIndexed(
     int32_t vertexOffset,
     uint32_t firstInstance)
 {
+    vkStream->beginPacket(OP_vkCmdDrawIndexed);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&indexCount, sizeof(uint32_t));
+    vkStream->write(&instanceCount, sizeof(uint32_t));
+    vkStream->write(&firstIndex, sizeof(uint32_t));
+    vkStream->write(&vertexOffset, sizeof(int32_t));
+    vkStream->write(&firstInstance, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDrawIndirect(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
     uint32_t drawCount,
     uint32_t stride)
 {
+    vkStream->beginPacket(OP_vkCmdDrawIndirect);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->write(&offset, sizeof(VkDeviceSize));
+    vkStream->write(&drawCount, sizeof(uint32_t));
+    vkStream->write(&stride, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDrawIndexedIndirect(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
     uint32_t drawCount,
     uint32_t stride)
 {
+    vkStream->beginPacket(OP_vkCmdDrawIndexedIndirect);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->write(&offset, sizeof(VkDeviceSize));
+    vkStream->write(&drawCount, sizeof(uint32_t));
+    vkStream->write(&stride, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDispatch(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t groupCountX,
     uint32_t groupCountY,
     uint32_t groupCountZ)
 {
+    vkStream->beginPacket(OP_vkCmdDispatch);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&groupCountX, sizeof(uint32_t));
+    vkStream->write(&groupCountY, sizeof(uint32_t));
+    vkStream->write(&groupCountZ, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDispatchIndirect(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset)
 {
+    vkStream->beginPacket(OP_vkCmdDispatchIndirect);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->write(&offset, sizeof(VkDeviceSize));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdCopyBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer srcBuffer,
     VkBuffer dstBuffer,
     uint32_t regionCount,
     const VkBufferCopy* pRegions)
 {
+    vkStream->beginPacket(OP_vkCmdCopyBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(srcBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(dstBuffer));
+    vkStream->write(&regionCount, sizeof(uint32_t));
+    vkStream->putU32(pRegions ? 1 : 0);
+    if (pRegions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+        {
+            marshal_VkBufferCopy(vkStream, pRegions + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdCopyImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage srcImage,
     VkImageLayout srcImageLayout,
@@ -1030,10 +2454,26 @@ void encode_vkCmdCopyImage(
     uint32_t regionCount,
     const VkImageCopy* pRegions)
 {
+    vkStream->beginPacket(OP_vkCmdCopyImage);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(srcImage));
+    vkStream->write(&srcImageLayout, sizeof(VkImageLayout));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(dstImage));
+    vkStream->write(&dstImageLayout, sizeof(VkImageLayout));
+    vkStream->write(&regionCount, sizeof(uint32_t));
+    vkStream->putU32(pRegions ? 1 : 0);
+    if (pRegions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+        {
+            marshal_VkImageCopy(vkStream, pRegions + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdBlitImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage srcImage,
     VkImageLayout srcImageLayout,
@@ -1043,10 +2483,27 @@ void encode_vkCmdBlitImage(
     const VkImageBlit* pRegions,
     VkFilter filter)
 {
+    vkStream->beginPacket(OP_vkCmdBlitImage);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(srcImage));
+    vkStream->write(&srcImageLayout, sizeof(VkImageLayout));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(dstImage));
+    vkStream->write(&dstImageLayout, sizeof(VkImageLayout));
+    vkStream->write(&regionCount, sizeof(uint32_t));
+    vkStream->putU32(pRegions ? 1 : 0);
+    if (pRegions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+        {
+            marshal_VkImageBlit(vkStream, pRegions + i);
+        }
+    }
+    vkStream->write(&filter, sizeof(VkFilter));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdCopyBufferToImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer srcBuffer,
     VkImage dstImage,
@@ -1054,10 +2511,25 @@ void encode_vkCmdCopyBufferToImage(
     uint32_t regionCount,
     const VkBufferImageCopy* pRegions)
 {
+    vkStream->beginPacket(OP_vkCmdCopyBufferToImage);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(srcBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(dstImage));
+    vkStream->write(&dstImageLayout, sizeof(VkImageLayout));
+    vkStream->write(&regionCount, sizeof(uint32_t));
+    vkStream->putU32(pRegions ? 1 : 0);
+    if (pRegions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+        {
+            marshal_VkBufferImageCopy(vkStream, pRegions + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdCopyImageToBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage srcImage,
     VkImageLayout srcImageLayout,
@@ -1065,30 +2537,63 @@ void encode_vkCmdCopyImageToBuffer(
     uint32_t regionCount,
     const VkBufferImageCopy* pRegions)
 {
+    vkStream->beginPacket(OP_vkCmdCopyImageToBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(srcImage));
+    vkStream->write(&srcImageLayout, sizeof(VkImageLayout));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(dstBuffer));
+    vkStream->write(&regionCount, sizeof(uint32_t));
+    vkStream->putU32(pRegions ? 1 : 0);
+    if (pRegions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+        {
+            marshal_VkBufferImageCopy(vkStream, pRegions + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdUpdateBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer dstBuffer,
     VkDeviceSize dstOffset,
     VkDeviceSize dataSize,
     const void* pData)
 {
+    vkStream->beginPacket(OP_vkCmdUpdateBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(dstBuffer));
+    vkStream->write(&dstOffset, sizeof(VkDeviceSize));
+    vkStream->write(&dataSize, sizeof(VkDeviceSize));
+    vkStream->putU32(pData ? 1 : 0);
+    if (pData)
+    {
+        vkStream->write(pData, dataSize * sizeof(uint8_t));
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdFillBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer dstBuffer,
     VkDeviceSize dstOffset,
     VkDeviceSize size,
     uint32_t data)
 {
+    vkStream->beginPacket(OP_vkCmdFillBuffer);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(dstBuffer));
+    vkStream->write(&dstOffset, sizeof(VkDeviceSize));
+    vkStream->write(&size, sizeof(VkDeviceSize));
+    vkStream->write(&data, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdClearColorImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage image,
     VkImageLayout imageLayout,
@@ -1096,10 +2601,29 @@ void encode_vkCmdClearColorImage(
     uint32_t rangeCount,
     const VkImageSubresourceRange* pRanges)
 {
+    vkStream->beginPacket(OP_vkCmdClearColorImage);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(image));
+    vkStream->write(&imageLayout, sizeof(VkImageLayout));
+    vkStream->putU32(pColor ? 1 : 0);
+    if (pColor)
+    {
+        vkStream->write(pColor, sizeof(VkClearColorValue));
+    }
+    vkStream->write(&rangeCount, sizeof(uint32_t));
+    vkStream->putU32(pRanges ? 1 : 0);
+    if (pRanges)
+    {
+        for (uint32_t i = 0; i < (uint32_t)rangeCount; ++i)
+        {
+            marshal_VkImageSubresourceRange(vkStream, pRanges + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdClearDepthStencilImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage image,
     VkImageLayout imageLayout,
@@ -1107,20 +2631,60 @@ void encode_vkCmdClearDepthStencilImage(
     uint32_t rangeCount,
     const VkImageSubresourceRange* pRanges)
 {
+    vkStream->beginPacket(OP_vkCmdClearDepthStencilImage);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(image));
+    vkStream->write(&imageLayout, sizeof(VkImageLayout));
+    vkStream->putU32(pDepthStencil ? 1 : 0);
+    if (pDepthStencil)
+    {
+        marshal_VkClearDepthStencilValue(vkStream, pDepthStencil);
+    }
+    vkStream->write(&rangeCount, sizeof(uint32_t));
+    vkStream->putU32(pRanges ? 1 : 0);
+    if (pRanges)
+    {
+        for (uint32_t i = 0; i < (uint32_t)rangeCount; ++i)
+        {
+            marshal_VkImageSubresourceRange(vkStream, pRanges + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdClearAttachments(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t attachmentCount,
     const VkClearAttachment* pAttachments,
     uint32_t rectCount,
     const VkClearRect* pRects)
 {
+    vkStream->beginPacket(OP_vkCmdClearAttachments);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&attachmentCount, sizeof(uint32_t));
+    vkStream->putU32(pAttachments ? 1 : 0);
+    if (pAttachments)
+    {
+        for (uint32_t i = 0; i < (uint32_t)attachmentCount; ++i)
+        {
+            marshal_VkClearAttachment(vkStream, pAttachments + i);
+        }
+    }
+    vkStream->write(&rectCount, sizeof(uint32_t));
+    vkStream->putU32(pRects ? 1 : 0);
+    if (pRects)
+    {
+        for (uint32_t i = 0; i < (uint32_t)rectCount; ++i)
+        {
+            marshal_VkClearRect(vkStream, pRects + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdResolveImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage srcImage,
     VkImageLayout srcImageLayout,
@@ -1129,26 +2693,52 @@ void encode_vkCmdResolveImage(
     uint32_t regionCount,
     const VkImageResolve* pRegions)
 {
+    vkStream->beginPacket(OP_vkCmdResolveImage);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(srcImage));
+    vkStream->write(&srcImageLayout, sizeof(VkImageLayout));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(dstImage));
+    vkStream->write(&dstImageLayout, sizeof(VkImageLayout));
+    vkStream->write(&regionCount, sizeof(uint32_t));
+    vkStream->putU32(pRegions ? 1 : 0);
+    if (pRegions)
+    {
+        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+        {
+            marshal_VkImageResolve(vkStream, pRegions + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdSetEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkEvent event,
     VkPipelineStageFlags stageMask)
 {
+    vkStream->beginPacket(OP_vkCmdSetEvent);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkEvent(event));
+    vkStream->write(&stageMask, sizeof(VkPipelineStageFlags));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdResetEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkEvent event,
     VkPipelineStageFlags stageMask)
 {
+    vkStream->beginPacket(OP_vkCmdResetEvent);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkEvent(event));
+    vkStream->write(&stageMask, sizeof(VkPipelineStageFlags));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdWaitEvents(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t eventCount,
     const VkEvent* pEvents,
@@ -1161,10 +2751,51 @@ void encode_vkCmdWaitEvents(
     uint32_t imageMemoryBarrierCount,
     const VkImageMemoryBarrier* pImageMemoryBarriers)
 {
+    vkStream->beginPacket(OP_vkCmdWaitEvents);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&eventCount, sizeof(uint32_t));
+    vkStream->putU32(pEvents ? 1 : 0);
+    if (pEvents)
+    {
+        for (uint32_t i = 0; i < (uint32_t)eventCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkEvent(pEvents[i]));
+        }
+    }
+    vkStream->write(&srcStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->write(&dstStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->write(&memoryBarrierCount, sizeof(uint32_t));
+    vkStream->putU32(pMemoryBarriers ? 1 : 0);
+    if (pMemoryBarriers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)memoryBarrierCount; ++i)
+        {
+            marshal_VkMemoryBarrier(vkStream, pMemoryBarriers + i);
+        }
+    }
+    vkStream->write(&bufferMemoryBarrierCount, sizeof(uint32_t));
+    vkStream->putU32(pBufferMemoryBarriers ? 1 : 0);
+    if (pBufferMemoryBarriers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)bufferMemoryBarrierCount; ++i)
+        {
+            marshal_VkBufferMemoryBarrier(vkStream, pBufferMemoryBarriers + i);
+        }
+    }
+    vkStream->write(&imageMemoryBarrierCount, sizeof(uint32_t));
+    vkStream->putU32(pImageMemoryBarriers ? 1 : 0);
+    if (pImageMemoryBarriers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)imageMemoryBarrierCount; ++i)
+        {
+            marshal_VkImageMemoryBarrier(vkStream, pImageMemoryBarriers + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdPipelineBarrier(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineStageFlags srcStageMask,
     VkPipelineStageFlags dstStageMask,
@@ -1176,45 +2807,101 @@ void encode_vkCmdPipelineBarrier(
     uint32_t imageMemoryBarrierCount,
     const VkImageMemoryBarrier* pImageMemoryBarriers)
 {
+    vkStream->beginPacket(OP_vkCmdPipelineBarrier);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&srcStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->write(&dstStageMask, sizeof(VkPipelineStageFlags));
+    vkStream->write(&dependencyFlags, sizeof(VkDependencyFlags));
+    vkStream->write(&memoryBarrierCount, sizeof(uint32_t));
+    vkStream->putU32(pMemoryBarriers ? 1 : 0);
+    if (pMemoryBarriers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)memoryBarrierCount; ++i)
+        {
+            marshal_VkMemoryBarrier(vkStream, pMemoryBarriers + i);
+        }
+    }
+    vkStream->write(&bufferMemoryBarrierCount, sizeof(uint32_t));
+    vkStream->putU32(pBufferMemoryBarriers ? 1 : 0);
+    if (pBufferMemoryBarriers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)bufferMemoryBarrierCount; ++i)
+        {
+            marshal_VkBufferMemoryBarrier(vkStream, pBufferMemoryBarriers + i);
+        }
+    }
+    vkStream->write(&imageMemoryBarrierCount, sizeof(uint32_t));
+    vkStream->putU32(pImageMemoryBarriers ? 1 : 0);
+    if (pImageMemoryBarriers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)imageMemoryBarrierCount; ++i)
+        {
+            marshal_VkImageMemoryBarrier(vkStream, pImageMemoryBarriers + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdBeginQuery(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkQueryPool queryPool,
     uint32_t query,
     VkQueryControlFlags flags)
 {
+    vkStream->beginPacket(OP_vkCmdBeginQuery);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueryPool(queryPool));
+    vkStream->write(&query, sizeof(uint32_t));
+    vkStream->write(&flags, sizeof(VkQueryControlFlags));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdEndQuery(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkQueryPool queryPool,
     uint32_t query)
 {
+    vkStream->beginPacket(OP_vkCmdEndQuery);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueryPool(queryPool));
+    vkStream->write(&query, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdResetQueryPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkQueryPool queryPool,
     uint32_t firstQuery,
     uint32_t queryCount)
 {
+    vkStream->beginPacket(OP_vkCmdResetQueryPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueryPool(queryPool));
+    vkStream->write(&firstQuery, sizeof(uint32_t));
+    vkStream->write(&queryCount, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdWriteTimestamp(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineStageFlagBits pipelineStage,
     VkQueryPool queryPool,
     uint32_t query)
 {
+    vkStream->beginPacket(OP_vkCmdWriteTimestamp);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&pipelineStage, sizeof(VkPipelineStageFlagBits));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueryPool(queryPool));
+    vkStream->write(&query, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdCopyQueryPoolResults(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkQueryPool queryPool,
     uint32_t firstQuery,
@@ -1224,10 +2911,20 @@ void encode_vkCmdCopyQueryPoolResults(
     VkDeviceSize stride,
     VkQueryResultFlags flags)
 {
+    vkStream->beginPacket(OP_vkCmdCopyQueryPoolResults);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueryPool(queryPool));
+    vkStream->write(&firstQuery, sizeof(uint32_t));
+    vkStream->write(&queryCount, sizeof(uint32_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(dstBuffer));
+    vkStream->write(&dstOffset, sizeof(VkDeviceSize));
+    vkStream->write(&stride, sizeof(VkDeviceSize));
+    vkStream->write(&flags, sizeof(VkQueryResultFlags));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdPushConstants(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineLayout layout,
     VkShaderStageFlags stageFlags,
@@ -1235,35 +2932,75 @@ void encode_vkCmdPushConstants(
     uint32_t size,
     const void* pValues)
 {
+    vkStream->beginPacket(OP_vkCmdPushConstants);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(layout));
+    vkStream->write(&stageFlags, sizeof(VkShaderStageFlags));
+    vkStream->write(&offset, sizeof(uint32_t));
+    vkStream->write(&size, sizeof(uint32_t));
+    vkStream->putU32(pValues ? 1 : 0);
+    if (pValues)
+    {
+        vkStream->write(pValues, size * sizeof(uint8_t));
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdBeginRenderPass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkRenderPassBeginInfo* pRenderPassBegin,
     VkSubpassContents contents)
 {
+    vkStream->beginPacket(OP_vkCmdBeginRenderPass);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pRenderPassBegin ? 1 : 0);
+    if (pRenderPassBegin)
+    {
+        marshal_VkRenderPassBeginInfo(vkStream, pRenderPassBegin);
+    }
+    vkStream->write(&contents, sizeof(VkSubpassContents));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdNextSubpass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkSubpassContents contents)
 {
+    vkStream->beginPacket(OP_vkCmdNextSubpass);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&contents, sizeof(VkSubpassContents));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdEndRenderPass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 {
+    vkStream->beginPacket(OP_vkCmdEndRenderPass);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdExecuteCommands(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t commandBufferCount,
     const VkCommandBuffer* pCommandBuffers)
 {
+    vkStream->beginPacket(OP_vkCmdExecuteCommands);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&commandBufferCount, sizeof(uint32_t));
+    vkStream->putU32(pCommandBuffers ? 1 : 0);
+    if (pCommandBuffers)
+    {
+        for (uint32_t i = 0; i < (uint32_t)commandBufferCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(pCommandBuffers[i]));
+        }
+    }
+    vkStream->endPacket();
 }
 
 #endif
@@ -1271,49 +3008,112 @@ void encode_vkCmdExecuteCommands(
 #ifdef VK_VERSION_1_1
 
 VkResult encode_vkEnumerateInstanceVersion(
-    void* vkStream,
+    VulkanStream* vkStream,
     uint32_t* pApiVersion)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkEnumerateInstanceVersion);
+    vkStream->putU32(pApiVersion ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkEnumerateInstanceVersion_VkResult_return = (VkResult)0;
+    vkStream->read(&vkEnumerateInstanceVersion_VkResult_return, sizeof(VkResult));
+    if (vkEnumerateInstanceVersion_VkResult_return >= 0)
+    {
+        if (pApiVersion)
+        {
+            vkStream->read(pApiVersion, sizeof(uint32_t));
+        }
+    }
+    vkStream->clearPool();
+    return vkEnumerateInstanceVersion_VkResult_return;
 }
 
 VkResult encode_vkBindBufferMemory2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t bindInfoCount,
     const VkBindBufferMemoryInfo* pBindInfos)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkBindBufferMemory2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&bindInfoCount, sizeof(uint32_t));
+    vkStream->putU32(pBindInfos ? 1 : 0);
+    if (pBindInfos)
+    {
+        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+        {
+            marshal_VkBindBufferMemoryInfo(vkStream, pBindInfos + i);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkBindBufferMemory2_VkResult_return = (VkResult)0;
+    vkStream->read(&vkBindBufferMemory2_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkBindBufferMemory2_VkResult_return;
 }
 
 VkResult encode_vkBindImageMemory2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t bindInfoCount,
     const VkBindImageMemoryInfo* pBindInfos)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkBindImageMemory2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&bindInfoCount, sizeof(uint32_t));
+    vkStream->putU32(pBindInfos ? 1 : 0);
+    if (pBindInfos)
+    {
+        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+        {
+            marshal_VkBindImageMemoryInfo(vkStream, pBindInfos + i);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkBindImageMemory2_VkResult_return = (VkResult)0;
+    vkStream->read(&vkBindImageMemory2_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkBindImageMemory2_VkResult_return;
 }
 
 void encode_vkGetDeviceGroupPeerMemoryFeatures(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t heapIndex,
     uint32_t localDeviceIndex,
     uint32_t remoteDeviceIndex,
     VkPeerMemoryFeatureFlags* pPeerMemoryFeatures)
 {
+    vkStream->beginPacket(OP_vkGetDeviceGroupPeerMemoryFeatures);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&heapIndex, sizeof(uint32_t));
+    vkStream->write(&localDeviceIndex, sizeof(uint32_t));
+    vkStream->write(&remoteDeviceIndex, sizeof(uint32_t));
+    vkStream->putU32(pPeerMemoryFeatures ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pPeerMemoryFeatures)
+    {
+        vkStream->read(pPeerMemoryFeatures, sizeof(VkPeerMemoryFeatureFlags));
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkCmdSetDeviceMask(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t deviceMask)
 {
+    vkStream->beginPacket(OP_vkCmdSetDeviceMask);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&deviceMask, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDispatchBase(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t baseGroupX,
     uint32_t baseGroupY,
@@ -1322,188 +3122,592 @@ void encode_vkCmdDispatchBase(
     uint32_t groupCountY,
     uint32_t groupCountZ)
 {
+    vkStream->beginPacket(OP_vkCmdDispatchBase);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&baseGroupX, sizeof(uint32_t));
+    vkStream->write(&baseGroupY, sizeof(uint32_t));
+    vkStream->write(&baseGroupZ, sizeof(uint32_t));
+    vkStream->write(&groupCountX, sizeof(uint32_t));
+    vkStream->write(&groupCountY, sizeof(uint32_t));
+    vkStream->write(&groupCountZ, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkEnumeratePhysicalDeviceGroups(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     uint32_t* pPhysicalDeviceGroupCount,
     VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkEnumeratePhysicalDeviceGroups);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->putU32(pPhysicalDeviceGroupCount ? 1 : 0);
+    if (pPhysicalDeviceGroupCount)
+    {
+        vkStream->write(pPhysicalDeviceGroupCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pPhysicalDeviceGroupProperties ? 1 : 0);
+    if (pPhysicalDeviceGroupProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pPhysicalDeviceGroupProperties[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkEnumeratePhysicalDeviceGroups_VkResult_return = (VkResult)0;
+    vkStream->read(&vkEnumeratePhysicalDeviceGroups_VkResult_return, sizeof(VkResult));
+    if (vkEnumeratePhysicalDeviceGroups_VkResult_return >= 0)
+    {
+        if (pPhysicalDeviceGroupCount)
+        {
+            vkStream->read(pPhysicalDeviceGroupCount, sizeof(uint32_t));
+        }
+        if (pPhysicalDeviceGroupProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0); ++i)
+            {
+                unmarshal_VkPhysicalDeviceGroupProperties(vkStream, pPhysicalDeviceGroupProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkEnumeratePhysicalDeviceGroups_VkResult_return;
 }
 
 void encode_vkGetImageMemoryRequirements2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageMemoryRequirementsInfo2* pInfo,
     VkMemoryRequirements2* pMemoryRequirements)
 {
+    vkStream->beginPacket(OP_vkGetImageMemoryRequirements2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pInfo ? 1 : 0);
+    if (pInfo)
+    {
+        marshal_VkImageMemoryRequirementsInfo2(vkStream, pInfo);
+    }
+    vkStream->putU32(pMemoryRequirements ? 1 : 0);
+    if (pMemoryRequirements)
+    {
+        marshal_extension_struct_types(vkStream, pMemoryRequirements->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMemoryRequirements)
+    {
+        unmarshal_VkMemoryRequirements2(vkStream, pMemoryRequirements);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetBufferMemoryRequirements2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkBufferMemoryRequirementsInfo2* pInfo,
     VkMemoryRequirements2* pMemoryRequirements)
 {
+    vkStream->beginPacket(OP_vkGetBufferMemoryRequirements2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pInfo ? 1 : 0);
+    if (pInfo)
+    {
+        marshal_VkBufferMemoryRequirementsInfo2(vkStream, pInfo);
+    }
+    vkStream->putU32(pMemoryRequirements ? 1 : 0);
+    if (pMemoryRequirements)
+    {
+        marshal_extension_struct_types(vkStream, pMemoryRequirements->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMemoryRequirements)
+    {
+        unmarshal_VkMemoryRequirements2(vkStream, pMemoryRequirements);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetImageSparseMemoryRequirements2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageSparseMemoryRequirementsInfo2* pInfo,
     uint32_t* pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements2* pSparseMemoryRequirements)
 {
+    vkStream->beginPacket(OP_vkGetImageSparseMemoryRequirements2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pInfo ? 1 : 0);
+    if (pInfo)
+    {
+        marshal_VkImageSparseMemoryRequirementsInfo2(vkStream, pInfo);
+    }
+    vkStream->putU32(pSparseMemoryRequirementCount ? 1 : 0);
+    if (pSparseMemoryRequirementCount)
+    {
+        vkStream->write(pSparseMemoryRequirementCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pSparseMemoryRequirements ? 1 : 0);
+    if (pSparseMemoryRequirements)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pSparseMemoryRequirements[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pSparseMemoryRequirementCount)
+    {
+        vkStream->read(pSparseMemoryRequirementCount, sizeof(uint32_t));
+    }
+    if (pSparseMemoryRequirements)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+        {
+            unmarshal_VkSparseImageMemoryRequirements2(vkStream, pSparseMemoryRequirements + i);
+        }
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceFeatures2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceFeatures2* pFeatures)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceFeatures2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pFeatures ? 1 : 0);
+    if (pFeatures)
+    {
+        marshal_extension_struct_types(vkStream, pFeatures->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pFeatures)
+    {
+        unmarshal_VkPhysicalDeviceFeatures2(vkStream, pFeatures);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceProperties2* pProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceProperties2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pProperties ? 1 : 0);
+    if (pProperties)
+    {
+        marshal_extension_struct_types(vkStream, pProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pProperties)
+    {
+        unmarshal_VkPhysicalDeviceProperties2(vkStream, pProperties);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceFormatProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkFormatProperties2* pFormatProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceFormatProperties2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&format, sizeof(VkFormat));
+    vkStream->putU32(pFormatProperties ? 1 : 0);
+    if (pFormatProperties)
+    {
+        marshal_extension_struct_types(vkStream, pFormatProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pFormatProperties)
+    {
+        unmarshal_VkFormatProperties2(vkStream, pFormatProperties);
+    }
+    vkStream->clearPool();
 }
 
 VkResult encode_vkGetPhysicalDeviceImageFormatProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo,
     VkImageFormatProperties2* pImageFormatProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceImageFormatProperties2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pImageFormatInfo ? 1 : 0);
+    if (pImageFormatInfo)
+    {
+        marshal_VkPhysicalDeviceImageFormatInfo2(vkStream, pImageFormatInfo);
+    }
+    vkStream->putU32(pImageFormatProperties ? 1 : 0);
+    if (pImageFormatProperties)
+    {
+        marshal_extension_struct_types(vkStream, pImageFormatProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceImageFormatProperties2_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceImageFormatProperties2_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceImageFormatProperties2_VkResult_return >= 0)
+    {
+        if (pImageFormatProperties)
+        {
+            unmarshal_VkImageFormatProperties2(vkStream, pImageFormatProperties);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceImageFormatProperties2_VkResult_return;
 }
 
 void encode_vkGetPhysicalDeviceQueueFamilyProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pQueueFamilyPropertyCount,
     VkQueueFamilyProperties2* pQueueFamilyProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceQueueFamilyProperties2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pQueueFamilyPropertyCount ? 1 : 0);
+    if (pQueueFamilyPropertyCount)
+    {
+        vkStream->write(pQueueFamilyPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pQueueFamilyProperties ? 1 : 0);
+    if (pQueueFamilyProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pQueueFamilyProperties[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pQueueFamilyPropertyCount)
+    {
+        vkStream->read(pQueueFamilyPropertyCount, sizeof(uint32_t));
+    }
+    if (pQueueFamilyProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+        {
+            unmarshal_VkQueueFamilyProperties2(vkStream, pQueueFamilyProperties + i);
+        }
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceMemoryProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceMemoryProperties2* pMemoryProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceMemoryProperties2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pMemoryProperties ? 1 : 0);
+    if (pMemoryProperties)
+    {
+        marshal_extension_struct_types(vkStream, pMemoryProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMemoryProperties)
+    {
+        unmarshal_VkPhysicalDeviceMemoryProperties2(vkStream, pMemoryProperties);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceSparseImageFormatProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo,
     uint32_t* pPropertyCount,
     VkSparseImageFormatProperties2* pProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSparseImageFormatProperties2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pFormatInfo ? 1 : 0);
+    if (pFormatInfo)
+    {
+        marshal_VkPhysicalDeviceSparseImageFormatInfo2(vkStream, pFormatInfo);
+    }
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    if (pProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pProperties[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pPropertyCount)
+    {
+        vkStream->read(pPropertyCount, sizeof(uint32_t));
+    }
+    if (pProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+        {
+            unmarshal_VkSparseImageFormatProperties2(vkStream, pProperties + i);
+        }
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkTrimCommandPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     VkCommandPoolTrimFlags flags)
 {
+    vkStream->beginPacket(OP_vkTrimCommandPool);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandPool(commandPool));
+    vkStream->write(&flags, sizeof(VkCommandPoolTrimFlags));
+    vkStream->endPacket();
 }
 
 void encode_vkGetDeviceQueue2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDeviceQueueInfo2* pQueueInfo,
     VkQueue* pQueue)
 {
+    vkStream->beginPacket(OP_vkGetDeviceQueue2);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pQueueInfo ? 1 : 0);
+    if (pQueueInfo)
+    {
+        marshal_VkDeviceQueueInfo2(vkStream, pQueueInfo);
+    }
+    vkStream->putU32(pQueue ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pQueue)
+    {
+        *pQueue = vkStream->handleMapping()->fromWire_VkQueue(vkStream, vkStream->getU64());
+    }
+    vkStream->clearPool();
 }
 
 VkResult encode_vkCreateSamplerYcbcrConversion(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSamplerYcbcrConversionCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSamplerYcbcrConversion* pYcbcrConversion)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateSamplerYcbcrConversion);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkSamplerYcbcrConversionCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pYcbcrConversion ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateSamplerYcbcrConversion_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateSamplerYcbcrConversion_VkResult_return, sizeof(VkResult));
+    if (vkCreateSamplerYcbcrConversion_VkResult_return >= 0)
+    {
+        if (pYcbcrConversion)
+        {
+            *pYcbcrConversion = vkStream->handleMapping()->fromWire_VkSamplerYcbcrConversion(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateSamplerYcbcrConversion_VkResult_return;
 }
 
 void encode_vkDestroySamplerYcbcrConversion(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSamplerYcbcrConversion ycbcrConversion,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroySamplerYcbcrConversion);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSamplerYcbcrConversion(ycbcrConversion));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateDescriptorUpdateTemplate(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateDescriptorUpdateTemplate);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkDescriptorUpdateTemplateCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pDescriptorUpdateTemplate ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateDescriptorUpdateTemplate_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateDescriptorUpdateTemplate_VkResult_return, sizeof(VkResult));
+    if (vkCreateDescriptorUpdateTemplate_VkResult_return >= 0)
+    {
+        if (pDescriptorUpdateTemplate)
+        {
+            *pDescriptorUpdateTemplate = vkStream->handleMapping()->fromWire_VkDescriptorUpdateTemplate(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateDescriptorUpdateTemplate_VkResult_return;
 }
 
 void encode_vkDestroyDescriptorUpdateTemplate(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyDescriptorUpdateTemplate);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorUpdateTemplate(descriptorUpdateTemplate));
+    vkStream->endPacket();
 }
 
 void encode_vkUpdateDescriptorSetWithTemplate(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorSet descriptorSet,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
     const void* pData)
 {
+    // Not supported by the wire format.
 }
 
 void encode_vkGetPhysicalDeviceExternalBufferProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo,
     VkExternalBufferProperties* pExternalBufferProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceExternalBufferProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pExternalBufferInfo ? 1 : 0);
+    if (pExternalBufferInfo)
+    {
+        marshal_VkPhysicalDeviceExternalBufferInfo(vkStream, pExternalBufferInfo);
+    }
+    vkStream->putU32(pExternalBufferProperties ? 1 : 0);
+    if (pExternalBufferProperties)
+    {
+        marshal_extension_struct_types(vkStream, pExternalBufferProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pExternalBufferProperties)
+    {
+        unmarshal_VkExternalBufferProperties(vkStream, pExternalBufferProperties);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceExternalFenceProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo,
     VkExternalFenceProperties* pExternalFenceProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceExternalFenceProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pExternalFenceInfo ? 1 : 0);
+    if (pExternalFenceInfo)
+    {
+        marshal_VkPhysicalDeviceExternalFenceInfo(vkStream, pExternalFenceInfo);
+    }
+    vkStream->putU32(pExternalFenceProperties ? 1 : 0);
+    if (pExternalFenceProperties)
+    {
+        marshal_extension_struct_types(vkStream, pExternalFenceProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pExternalFenceProperties)
+    {
+        unmarshal_VkExternalFenceProperties(vkStream, pExternalFenceProperties);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceExternalSemaphoreProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo,
     VkExternalSemaphoreProperties* pExternalSemaphoreProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceExternalSemaphoreProperties);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pExternalSemaphoreInfo ? 1 : 0);
+    if (pExternalSemaphoreInfo)
+    {
+        marshal_VkPhysicalDeviceExternalSemaphoreInfo(vkStream, pExternalSemaphoreInfo);
+    }
+    vkStream->putU32(pExternalSemaphoreProperties ? 1 : 0);
+    if (pExternalSemaphoreProperties)
+    {
+        marshal_extension_struct_types(vkStream, pExternalSemaphoreProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pExternalSemaphoreProperties)
+    {
+        unmarshal_VkExternalSemaphoreProperties(vkStream, pExternalSemaphoreProperties);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetDescriptorSetLayoutSupport(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
     VkDescriptorSetLayoutSupport* pSupport)
 {
+    vkStream->beginPacket(OP_vkGetDescriptorSetLayoutSupport);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkDescriptorSetLayoutCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pSupport ? 1 : 0);
+    if (pSupport)
+    {
+        marshal_extension_struct_types(vkStream, pSupport->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pSupport)
+    {
+        unmarshal_VkDescriptorSetLayoutSupport(vkStream, pSupport);
+    }
+    vkStream->clearPool();
 }
 
 #endif
@@ -1511,50 +3715,140 @@ void encode_vkGetDescriptorSetLayoutSupport(
 #ifdef VK_KHR_surface
 
 void encode_vkDestroySurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkSurfaceKHR surface,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroySurfaceKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(surface));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkGetPhysicalDeviceSurfaceSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     VkSurfaceKHR surface,
     VkBool32* pSupported)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSurfaceSupportKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&queueFamilyIndex, sizeof(uint32_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(surface));
+    vkStream->putU32(pSupported ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceSurfaceSupportKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceSurfaceSupportKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceSurfaceSupportKHR_VkResult_return >= 0)
+    {
+        if (pSupported)
+        {
+            vkStream->read(pSupported, sizeof(VkBool32));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceSurfaceSupportKHR_VkResult_return;
 }
 
 VkResult encode_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSurfaceCapabilitiesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(surface));
+    vkStream->putU32(pSurfaceCapabilities ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceSurfaceCapabilitiesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceSurfaceCapabilitiesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceSurfaceCapabilitiesKHR_VkResult_return >= 0)
+    {
+        if (pSurfaceCapabilities)
+        {
+            unmarshal_VkSurfaceCapabilitiesKHR(vkStream, pSurfaceCapabilities);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceSurfaceCapabilitiesKHR_VkResult_return;
 }
 
 VkResult encode_vkGetPhysicalDeviceSurfaceFormatsKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     uint32_t* pSurfaceFormatCount,
     VkSurfaceFormatKHR* pSurfaceFormats)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSurfaceFormatsKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(surface));
+    vkStream->putU32(pSurfaceFormatCount ? 1 : 0);
+    if (pSurfaceFormatCount)
+    {
+        vkStream->write(pSurfaceFormatCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pSurfaceFormats ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceSurfaceFormatsKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceSurfaceFormatsKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceSurfaceFormatsKHR_VkResult_return >= 0)
+    {
+        if (pSurfaceFormatCount)
+        {
+            vkStream->read(pSurfaceFormatCount, sizeof(uint32_t));
+        }
+        if (pSurfaceFormats)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pSurfaceFormatCount ? *pSurfaceFormatCount : 0); ++i)
+            {
+                unmarshal_VkSurfaceFormatKHR(vkStream, pSurfaceFormats + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceSurfaceFormatsKHR_VkResult_return;
 }
 
 VkResult encode_vkGetPhysicalDeviceSurfacePresentModesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     uint32_t* pPresentModeCount,
     VkPresentModeKHR* pPresentModes)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSurfacePresentModesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(surface));
+    vkStream->putU32(pPresentModeCount ? 1 : 0);
+    if (pPresentModeCount)
+    {
+        vkStream->write(pPresentModeCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pPresentModes ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceSurfacePresentModesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceSurfacePresentModesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceSurfacePresentModesKHR_VkResult_return >= 0)
+    {
+        if (pPresentModeCount)
+        {
+            vkStream->read(pPresentModeCount, sizeof(uint32_t));
+        }
+        if (pPresentModes)
+        {
+            vkStream->read(pPresentModes, (pPresentModeCount ? *pPresentModeCount : 0) * sizeof(VkPresentModeKHR));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceSurfacePresentModesKHR_VkResult_return;
 }
 
 #endif
@@ -1562,35 +3856,87 @@ VkResult encode_vkGetPhysicalDeviceSurfacePresentModesKHR(
 #ifdef VK_KHR_swapchain
 
 VkResult encode_vkCreateSwapchainKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSwapchainCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSwapchainKHR* pSwapchain)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateSwapchainKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkSwapchainCreateInfoKHR(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pSwapchain ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateSwapchainKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateSwapchainKHR_VkResult_return, sizeof(VkResult));
+    if (vkCreateSwapchainKHR_VkResult_return >= 0)
+    {
+        if (pSwapchain)
+        {
+            *pSwapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateSwapchainKHR_VkResult_return;
 }
 
 void encode_vkDestroySwapchainKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroySwapchainKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(swapchain));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkGetSwapchainImagesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     uint32_t* pSwapchainImageCount,
     VkImage* pSwapchainImages)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetSwapchainImagesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(swapchain));
+    vkStream->putU32(pSwapchainImageCount ? 1 : 0);
+    if (pSwapchainImageCount)
+    {
+        vkStream->write(pSwapchainImageCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pSwapchainImages ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetSwapchainImagesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetSwapchainImagesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetSwapchainImagesKHR_VkResult_return >= 0)
+    {
+        if (pSwapchainImageCount)
+        {
+            vkStream->read(pSwapchainImageCount, sizeof(uint32_t));
+        }
+        if (pSwapchainImages)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pSwapchainImageCount ? *pSwapchainImageCount : 0); ++i)
+            {
+                pSwapchainImages[i] = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetSwapchainImagesKHR_VkResult_return;
 }
 
 VkResult encode_vkAcquireNextImageKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     uint64_t timeout,
@@ -1598,51 +3944,165 @@ VkResult encode_vkAcquireNextImageKHR(
     VkFence fence,
     uint32_t* pImageIndex)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkAcquireNextImageKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(swapchain));
+    vkStream->write(&timeout, sizeof(uint64_t));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(semaphore));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(fence));
+    vkStream->putU32(pImageIndex ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkAcquireNextImageKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkAcquireNextImageKHR_VkResult_return, sizeof(VkResult));
+    if (vkAcquireNextImageKHR_VkResult_return >= 0)
+    {
+        if (pImageIndex)
+        {
+            vkStream->read(pImageIndex, sizeof(uint32_t));
+        }
+    }
+    vkStream->clearPool();
+    return vkAcquireNextImageKHR_VkResult_return;
 }
 
 VkResult encode_vkQueuePresentKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     const VkPresentInfoKHR* pPresentInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkQueuePresentKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueue(queue));
+    vkStream->putU32(pPresentInfo ? 1 : 0);
+    if (pPresentInfo)
+    {
+        marshal_VkPresentInfoKHR(vkStream, pPresentInfo);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkQueuePresentKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkQueuePresentKHR_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkQueuePresentKHR_VkResult_return;
 }
 
 VkResult encode_vkGetDeviceGroupPresentCapabilitiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetDeviceGroupPresentCapabilitiesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pDeviceGroupPresentCapabilities ? 1 : 0);
+    if (pDeviceGroupPresentCapabilities)
+    {
+        marshal_extension_struct_types(vkStream, pDeviceGroupPresentCapabilities->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetDeviceGroupPresentCapabilitiesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetDeviceGroupPresentCapabilitiesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetDeviceGroupPresentCapabilitiesKHR_VkResult_return >= 0)
+    {
+        if (pDeviceGroupPresentCapabilities)
+        {
+            unmarshal_VkDeviceGroupPresentCapabilitiesKHR(vkStream, pDeviceGroupPresentCapabilities);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetDeviceGroupPresentCapabilitiesKHR_VkResult_return;
 }
 
 VkResult encode_vkGetDeviceGroupSurfacePresentModesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSurfaceKHR surface,
     VkDeviceGroupPresentModeFlagsKHR* pModes)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetDeviceGroupSurfacePresentModesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(surface));
+    vkStream->putU32(pModes ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetDeviceGroupSurfacePresentModesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetDeviceGroupSurfacePresentModesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetDeviceGroupSurfacePresentModesKHR_VkResult_return >= 0)
+    {
+        if (pModes)
+        {
+            vkStream->read(pModes, sizeof(VkDeviceGroupPresentModeFlagsKHR));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetDeviceGroupSurfacePresentModesKHR_VkResult_return;
 }
 
 VkResult encode_vkGetPhysicalDevicePresentRectanglesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     uint32_t* pRectCount,
     VkRect2D* pRects)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDevicePresentRectanglesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(surface));
+    vkStream->putU32(pRectCount ? 1 : 0);
+    if (pRectCount)
+    {
+        vkStream->write(pRectCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pRects ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDevicePresentRectanglesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDevicePresentRectanglesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDevicePresentRectanglesKHR_VkResult_return >= 0)
+    {
+        if (pRectCount)
+        {
+            vkStream->read(pRectCount, sizeof(uint32_t));
+        }
+        if (pRects)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pRectCount ? *pRectCount : 0); ++i)
+            {
+                unmarshal_VkRect2D(vkStream, pRects + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDevicePresentRectanglesKHR_VkResult_return;
 }
 
 VkResult encode_vkAcquireNextImage2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkAcquireNextImageInfoKHR* pAcquireInfo,
     uint32_t* pImageIndex)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkAcquireNextImage2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pAcquireInfo ? 1 : 0);
+    if (pAcquireInfo)
+    {
+        marshal_VkAcquireNextImageInfoKHR(vkStream, pAcquireInfo);
+    }
+    vkStream->putU32(pImageIndex ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkAcquireNextImage2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkAcquireNextImage2KHR_VkResult_return, sizeof(VkResult));
+    if (vkAcquireNextImage2KHR_VkResult_return >= 0)
+    {
+        if (pImageIndex)
+        {
+            vkStream->read(pImageIndex, sizeof(uint32_t));
+        }
+    }
+    vkStream->clearPool();
+    return vkAcquireNextImage2KHR_VkResult_return;
 }
 
 #endif
@@ -1650,72 +4110,214 @@ VkResult encode_vkAcquireNextImage2KHR(
 #ifdef VK_KHR_display
 
 VkResult encode_vkGetPhysicalDeviceDisplayPropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkDisplayPropertiesKHR* pProperties)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkResult encode_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkDisplayPlanePropertiesKHR* pProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceDisplayPlanePropertiesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceDisplayPlanePropertiesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceDisplayPlanePropertiesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceDisplayPlanePropertiesKHR_VkResult_return >= 0)
+    {
+        if (pPropertyCount)
+        {
+            vkStream->read(pPropertyCount, sizeof(uint32_t));
+        }
+        if (pProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+            {
+                unmarshal_VkDisplayPlanePropertiesKHR(vkStream, pProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceDisplayPlanePropertiesKHR_VkResult_return;
 }
 
 VkResult encode_vkGetDisplayPlaneSupportedDisplaysKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t planeIndex,
     uint32_t* pDisplayCount,
     VkDisplayKHR* pDisplays)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetDisplayPlaneSupportedDisplaysKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&planeIndex, sizeof(uint32_t));
+    vkStream->putU32(pDisplayCount ? 1 : 0);
+    if (pDisplayCount)
+    {
+        vkStream->write(pDisplayCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pDisplays ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetDisplayPlaneSupportedDisplaysKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetDisplayPlaneSupportedDisplaysKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetDisplayPlaneSupportedDisplaysKHR_VkResult_return >= 0)
+    {
+        if (pDisplayCount)
+        {
+            vkStream->read(pDisplayCount, sizeof(uint32_t));
+        }
+        if (pDisplays)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pDisplayCount ? *pDisplayCount : 0); ++i)
+            {
+                pDisplays[i] = vkStream->handleMapping()->fromWire_VkDisplayKHR(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetDisplayPlaneSupportedDisplaysKHR_VkResult_return;
 }
 
 VkResult encode_vkGetDisplayModePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayKHR display,
     uint32_t* pPropertyCount,
     VkDisplayModePropertiesKHR* pProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetDisplayModePropertiesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayKHR(display));
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetDisplayModePropertiesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetDisplayModePropertiesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetDisplayModePropertiesKHR_VkResult_return >= 0)
+    {
+        if (pPropertyCount)
+        {
+            vkStream->read(pPropertyCount, sizeof(uint32_t));
+        }
+        if (pProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+            {
+                unmarshal_VkDisplayModePropertiesKHR(vkStream, pProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetDisplayModePropertiesKHR_VkResult_return;
 }
 
 VkResult encode_vkCreateDisplayModeKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayKHR display,
     const VkDisplayModeCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkDisplayModeKHR* pMode)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateDisplayModeKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayKHR(display));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkDisplayModeCreateInfoKHR(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pMode ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateDisplayModeKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateDisplayModeKHR_VkResult_return, sizeof(VkResult));
+    if (vkCreateDisplayModeKHR_VkResult_return >= 0)
+    {
+        if (pMode)
+        {
+            *pMode = vkStream->handleMapping()->fromWire_VkDisplayModeKHR(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateDisplayModeKHR_VkResult_return;
 }
 
 VkResult encode_vkGetDisplayPlaneCapabilitiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayModeKHR mode,
     uint32_t planeIndex,
     VkDisplayPlaneCapabilitiesKHR* pCapabilities)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetDisplayPlaneCapabilitiesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayModeKHR(mode));
+    vkStream->write(&planeIndex, sizeof(uint32_t));
+    vkStream->putU32(pCapabilities ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetDisplayPlaneCapabilitiesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetDisplayPlaneCapabilitiesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetDisplayPlaneCapabilitiesKHR_VkResult_return >= 0)
+    {
+        if (pCapabilities)
+        {
+            unmarshal_VkDisplayPlaneCapabilitiesKHR(vkStream, pCapabilities);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetDisplayPlaneCapabilitiesKHR_VkResult_return;
 }
 
 VkResult encode_vkCreateDisplayPlaneSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkDisplaySurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateDisplayPlaneSurfaceKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkDisplaySurfaceCreateInfoKHR(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pSurface ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateDisplayPlaneSurfaceKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateDisplayPlaneSurfaceKHR_VkResult_return, sizeof(VkResult));
+    if (vkCreateDisplayPlaneSurfaceKHR_VkResult_return >= 0)
+    {
+        if (pSurface)
+        {
+            *pSurface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateDisplayPlaneSurfaceKHR_VkResult_return;
 }
 
 #endif
@@ -1723,14 +4325,41 @@ VkResult encode_vkCreateDisplayPlaneSurfaceKHR(
 #ifdef VK_KHR_display_swapchain
 
 VkResult encode_vkCreateSharedSwapchainsKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t swapchainCount,
     const VkSwapchainCreateInfoKHR* pCreateInfos,
     const VkAllocationCallbacks* pAllocator,
     VkSwapchainKHR* pSwapchains)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateSharedSwapchainsKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&swapchainCount, sizeof(uint32_t));
+    vkStream->putU32(pCreateInfos ? 1 : 0);
+    if (pCreateInfos)
+    {
+        for (uint32_t i = 0; i < (uint32_t)swapchainCount; ++i)
+        {
+            marshal_VkSwapchainCreateInfoKHR(vkStream, pCreateInfos + i);
+        }
+    }
+    vkStream->putU32(pSwapchains ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateSharedSwapchainsKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateSharedSwapchainsKHR_VkResult_return, sizeof(VkResult));
+    if (vkCreateSharedSwapchainsKHR_VkResult_return >= 0)
+    {
+        if (pSwapchains)
+        {
+            for (uint32_t i = 0; i < (uint32_t)swapchainCount; ++i)
+            {
+                pSwapchains[i] = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateSharedSwapchainsKHR_VkResult_return;
 }
 
 #endif
@@ -1738,22 +4367,24 @@ VkResult encode_vkCreateSharedSwapchainsKHR(
 #ifdef VK_KHR_xlib_surface
 
 VkResult encode_vkCreateXlibSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkXlibSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkBool32 encode_vkGetPhysicalDeviceXlibPresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     Display* dpy,
     VisualID visualID)
 {
+    // Not supported by the wire format.
     return (VkBool32)0;
 }
 
@@ -1762,22 +4393,24 @@ VkBool32 encode_vkGetPhysicalDeviceXlibPresentationSupportKHR(
 #ifdef VK_KHR_xcb_surface
 
 VkResult encode_vkCreateXcbSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkXcbSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkBool32 encode_vkGetPhysicalDeviceXcbPresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     xcb_connection_t* connection,
     xcb_visualid_t visual_id)
 {
+    // Not supported by the wire format.
     return (VkBool32)0;
 }
 
@@ -1786,21 +4419,23 @@ VkBool32 encode_vkGetPhysicalDeviceXcbPresentationSupportKHR(
 #ifdef VK_KHR_wayland_surface
 
 VkResult encode_vkCreateWaylandSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkWaylandSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkBool32 encode_vkGetPhysicalDeviceWaylandPresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     struct wl_display* display)
 {
+    // Not supported by the wire format.
     return (VkBool32)0;
 }
 
@@ -1809,21 +4444,23 @@ VkBool32 encode_vkGetPhysicalDeviceWaylandPresentationSupportKHR(
 #ifdef VK_KHR_mir_surface
 
 VkResult encode_vkCreateMirSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkMirSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkBool32 encode_vkGetPhysicalDeviceMirPresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     MirConnection* connection)
 {
+    // Not supported by the wire format.
     return (VkBool32)0;
 }
 
@@ -1832,13 +4469,14 @@ VkBool32 encode_vkGetPhysicalDeviceMirPresentationSupportKHR(
 #ifdef VK_KHR_android_surface
 
 VkResult encode_vkCreateAndroidSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkAndroidSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -1846,21 +4484,30 @@ VkResult encode_vkCreateAndroidSurfaceKHR(
 #ifdef VK_KHR_win32_surface
 
 VkResult encode_vkCreateWin32SurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkWin32SurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkBool32 encode_vkGetPhysicalDeviceWin32PresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex)
 {
-    return (VkBool32)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceWin32PresentationSupportKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&queueFamilyIndex, sizeof(uint32_t));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkBool32 vkGetPhysicalDeviceWin32PresentationSupportKHR_VkBool32_return = (VkBool32)0;
+    vkStream->read(&vkGetPhysicalDeviceWin32PresentationSupportKHR_VkBool32_return, sizeof(VkBool32));
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceWin32PresentationSupportKHR_VkBool32_return;
 }
 
 #endif
@@ -1876,58 +4523,202 @@ VkBool32 encode_vkGetPhysicalDeviceWin32PresentationSupportKHR(
 #ifdef VK_KHR_get_physical_device_properties2
 
 void encode_vkGetPhysicalDeviceFeatures2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceFeatures2* pFeatures)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceFeatures2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pFeatures ? 1 : 0);
+    if (pFeatures)
+    {
+        marshal_extension_struct_types(vkStream, pFeatures->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pFeatures)
+    {
+        unmarshal_VkPhysicalDeviceFeatures2(vkStream, pFeatures);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceProperties2* pProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceProperties2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pProperties ? 1 : 0);
+    if (pProperties)
+    {
+        marshal_extension_struct_types(vkStream, pProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pProperties)
+    {
+        unmarshal_VkPhysicalDeviceProperties2(vkStream, pProperties);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceFormatProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkFormatProperties2* pFormatProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceFormatProperties2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&format, sizeof(VkFormat));
+    vkStream->putU32(pFormatProperties ? 1 : 0);
+    if (pFormatProperties)
+    {
+        marshal_extension_struct_types(vkStream, pFormatProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pFormatProperties)
+    {
+        unmarshal_VkFormatProperties2(vkStream, pFormatProperties);
+    }
+    vkStream->clearPool();
 }
 
 VkResult encode_vkGetPhysicalDeviceImageFormatProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo,
     VkImageFormatProperties2* pImageFormatProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceImageFormatProperties2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pImageFormatInfo ? 1 : 0);
+    if (pImageFormatInfo)
+    {
+        marshal_VkPhysicalDeviceImageFormatInfo2(vkStream, pImageFormatInfo);
+    }
+    vkStream->putU32(pImageFormatProperties ? 1 : 0);
+    if (pImageFormatProperties)
+    {
+        marshal_extension_struct_types(vkStream, pImageFormatProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceImageFormatProperties2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceImageFormatProperties2KHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceImageFormatProperties2KHR_VkResult_return >= 0)
+    {
+        if (pImageFormatProperties)
+        {
+            unmarshal_VkImageFormatProperties2(vkStream, pImageFormatProperties);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceImageFormatProperties2KHR_VkResult_return;
 }
 
 void encode_vkGetPhysicalDeviceQueueFamilyProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pQueueFamilyPropertyCount,
     VkQueueFamilyProperties2* pQueueFamilyProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceQueueFamilyProperties2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pQueueFamilyPropertyCount ? 1 : 0);
+    if (pQueueFamilyPropertyCount)
+    {
+        vkStream->write(pQueueFamilyPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pQueueFamilyProperties ? 1 : 0);
+    if (pQueueFamilyProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pQueueFamilyProperties[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pQueueFamilyPropertyCount)
+    {
+        vkStream->read(pQueueFamilyPropertyCount, sizeof(uint32_t));
+    }
+    if (pQueueFamilyProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+        {
+            unmarshal_VkQueueFamilyProperties2(vkStream, pQueueFamilyProperties + i);
+        }
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceMemoryProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceMemoryProperties2* pMemoryProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceMemoryProperties2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pMemoryProperties ? 1 : 0);
+    if (pMemoryProperties)
+    {
+        marshal_extension_struct_types(vkStream, pMemoryProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMemoryProperties)
+    {
+        unmarshal_VkPhysicalDeviceMemoryProperties2(vkStream, pMemoryProperties);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo,
     uint32_t* pPropertyCount,
     VkSparseImageFormatProperties2* pProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSparseImageFormatProperties2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pFormatInfo ? 1 : 0);
+    if (pFormatInfo)
+    {
+        marshal_VkPhysicalDeviceSparseImageFormatInfo2(vkStream, pFormatInfo);
+    }
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    if (pProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pProperties[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pPropertyCount)
+    {
+        vkStream->read(pPropertyCount, sizeof(uint32_t));
+    }
+    if (pProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+        {
+            unmarshal_VkSparseImageFormatProperties2(vkStream, pProperties + i);
+        }
+    }
+    vkStream->clearPool();
 }
 
 #endif
@@ -1935,24 +4726,41 @@ void encode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
 #ifdef VK_KHR_device_group
 
 void encode_vkGetDeviceGroupPeerMemoryFeaturesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t heapIndex,
     uint32_t localDeviceIndex,
     uint32_t remoteDeviceIndex,
     VkPeerMemoryFeatureFlags* pPeerMemoryFeatures)
 {
+    vkStream->beginPacket(OP_vkGetDeviceGroupPeerMemoryFeaturesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&heapIndex, sizeof(uint32_t));
+    vkStream->write(&localDeviceIndex, sizeof(uint32_t));
+    vkStream->write(&remoteDeviceIndex, sizeof(uint32_t));
+    vkStream->putU32(pPeerMemoryFeatures ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pPeerMemoryFeatures)
+    {
+        vkStream->read(pPeerMemoryFeatures, sizeof(VkPeerMemoryFeatureFlags));
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkCmdSetDeviceMaskKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t deviceMask)
 {
+    vkStream->beginPacket(OP_vkCmdSetDeviceMaskKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&deviceMask, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDispatchBaseKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t baseGroupX,
     uint32_t baseGroupY,
@@ -1961,6 +4769,15 @@ void encode_vkCmdDispatchBaseKHR(
     uint32_t groupCountY,
     uint32_t groupCountZ)
 {
+    vkStream->beginPacket(OP_vkCmdDispatchBaseKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&baseGroupX, sizeof(uint32_t));
+    vkStream->write(&baseGroupY, sizeof(uint32_t));
+    vkStream->write(&baseGroupZ, sizeof(uint32_t));
+    vkStream->write(&groupCountX, sizeof(uint32_t));
+    vkStream->write(&groupCountY, sizeof(uint32_t));
+    vkStream->write(&groupCountZ, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 #endif
@@ -1972,11 +4789,16 @@ void encode_vkCmdDispatchBaseKHR(
 #ifdef VK_KHR_maintenance1
 
 void encode_vkTrimCommandPoolKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     VkCommandPoolTrimFlags flags)
 {
+    vkStream->beginPacket(OP_vkTrimCommandPoolKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandPool(commandPool));
+    vkStream->write(&flags, sizeof(VkCommandPoolTrimFlags));
+    vkStream->endPacket();
 }
 
 #endif
@@ -1984,12 +4806,46 @@ void encode_vkTrimCommandPoolKHR(
 #ifdef VK_KHR_device_group_creation
 
 VkResult encode_vkEnumeratePhysicalDeviceGroupsKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     uint32_t* pPhysicalDeviceGroupCount,
     VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkEnumeratePhysicalDeviceGroupsKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->putU32(pPhysicalDeviceGroupCount ? 1 : 0);
+    if (pPhysicalDeviceGroupCount)
+    {
+        vkStream->write(pPhysicalDeviceGroupCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pPhysicalDeviceGroupProperties ? 1 : 0);
+    if (pPhysicalDeviceGroupProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pPhysicalDeviceGroupProperties[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkEnumeratePhysicalDeviceGroupsKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkEnumeratePhysicalDeviceGroupsKHR_VkResult_return, sizeof(VkResult));
+    if (vkEnumeratePhysicalDeviceGroupsKHR_VkResult_return >= 0)
+    {
+        if (pPhysicalDeviceGroupCount)
+        {
+            vkStream->read(pPhysicalDeviceGroupCount, sizeof(uint32_t));
+        }
+        if (pPhysicalDeviceGroupProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0); ++i)
+            {
+                unmarshal_VkPhysicalDeviceGroupProperties(vkStream, pPhysicalDeviceGroupProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkEnumeratePhysicalDeviceGroupsKHR_VkResult_return;
 }
 
 #endif
@@ -1997,11 +4853,30 @@ VkResult encode_vkEnumeratePhysicalDeviceGroupsKHR(
 #ifdef VK_KHR_external_memory_capabilities
 
 void encode_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo,
     VkExternalBufferProperties* pExternalBufferProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceExternalBufferPropertiesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pExternalBufferInfo ? 1 : 0);
+    if (pExternalBufferInfo)
+    {
+        marshal_VkPhysicalDeviceExternalBufferInfo(vkStream, pExternalBufferInfo);
+    }
+    vkStream->putU32(pExternalBufferProperties ? 1 : 0);
+    if (pExternalBufferProperties)
+    {
+        marshal_extension_struct_types(vkStream, pExternalBufferProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pExternalBufferProperties)
+    {
+        unmarshal_VkExternalBufferProperties(vkStream, pExternalBufferProperties);
+    }
+    vkStream->clearPool();
 }
 
 #endif
@@ -2013,22 +4888,24 @@ void encode_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
 #ifdef VK_KHR_external_memory_win32
 
 VkResult encode_vkGetMemoryWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo,
     HANDLE* pHandle)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkResult encode_vkGetMemoryWin32HandlePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkExternalMemoryHandleTypeFlagBits handleType,
     HANDLE handle,
     VkMemoryWin32HandlePropertiesKHR* pMemoryWin32HandleProperties)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -2036,22 +4913,63 @@ VkResult encode_vkGetMemoryWin32HandlePropertiesKHR(
 #ifdef VK_KHR_external_memory_fd
 
 VkResult encode_vkGetMemoryFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkMemoryGetFdInfoKHR* pGetFdInfo,
     int* pFd)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetMemoryFdKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pGetFdInfo ? 1 : 0);
+    if (pGetFdInfo)
+    {
+        marshal_VkMemoryGetFdInfoKHR(vkStream, pGetFdInfo);
+    }
+    vkStream->putU32(pFd ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetMemoryFdKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetMemoryFdKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetMemoryFdKHR_VkResult_return >= 0)
+    {
+        if (pFd)
+        {
+            vkStream->read(pFd, sizeof(int));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetMemoryFdKHR_VkResult_return;
 }
 
 VkResult encode_vkGetMemoryFdPropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkExternalMemoryHandleTypeFlagBits handleType,
     int fd,
     VkMemoryFdPropertiesKHR* pMemoryFdProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetMemoryFdPropertiesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+    vkStream->write(&fd, sizeof(int));
+    vkStream->putU32(pMemoryFdProperties ? 1 : 0);
+    if (pMemoryFdProperties)
+    {
+        marshal_extension_struct_types(vkStream, pMemoryFdProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetMemoryFdPropertiesKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetMemoryFdPropertiesKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetMemoryFdPropertiesKHR_VkResult_return >= 0)
+    {
+        if (pMemoryFdProperties)
+        {
+            unmarshal_VkMemoryFdPropertiesKHR(vkStream, pMemoryFdProperties);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetMemoryFdPropertiesKHR_VkResult_return;
 }
 
 #endif
@@ -2063,11 +4981,30 @@ VkResult encode_vkGetMemoryFdPropertiesKHR(
 #ifdef VK_KHR_external_semaphore_capabilities
 
 void encode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo,
     VkExternalSemaphoreProperties* pExternalSemaphoreProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pExternalSemaphoreInfo ? 1 : 0);
+    if (pExternalSemaphoreInfo)
+    {
+        marshal_VkPhysicalDeviceExternalSemaphoreInfo(vkStream, pExternalSemaphoreInfo);
+    }
+    vkStream->putU32(pExternalSemaphoreProperties ? 1 : 0);
+    if (pExternalSemaphoreProperties)
+    {
+        marshal_extension_struct_types(vkStream, pExternalSemaphoreProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pExternalSemaphoreProperties)
+    {
+        unmarshal_VkExternalSemaphoreProperties(vkStream, pExternalSemaphoreProperties);
+    }
+    vkStream->clearPool();
 }
 
 #endif
@@ -2079,20 +5016,22 @@ void encode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
 #ifdef VK_KHR_external_semaphore_win32
 
 VkResult encode_vkImportSemaphoreWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkResult encode_vkGetSemaphoreWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo,
     HANDLE* pHandle)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -2100,20 +5039,52 @@ VkResult encode_vkGetSemaphoreWin32HandleKHR(
 #ifdef VK_KHR_external_semaphore_fd
 
 VkResult encode_vkImportSemaphoreFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkImportSemaphoreFdKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pImportSemaphoreFdInfo ? 1 : 0);
+    if (pImportSemaphoreFdInfo)
+    {
+        marshal_VkImportSemaphoreFdInfoKHR(vkStream, pImportSemaphoreFdInfo);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkImportSemaphoreFdKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkImportSemaphoreFdKHR_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkImportSemaphoreFdKHR_VkResult_return;
 }
 
 VkResult encode_vkGetSemaphoreFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSemaphoreGetFdInfoKHR* pGetFdInfo,
     int* pFd)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetSemaphoreFdKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pGetFdInfo ? 1 : 0);
+    if (pGetFdInfo)
+    {
+        marshal_VkSemaphoreGetFdInfoKHR(vkStream, pGetFdInfo);
+    }
+    vkStream->putU32(pFd ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetSemaphoreFdKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetSemaphoreFdKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetSemaphoreFdKHR_VkResult_return >= 0)
+    {
+        if (pFd)
+        {
+            vkStream->read(pFd, sizeof(int));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetSemaphoreFdKHR_VkResult_return;
 }
 
 #endif
@@ -2121,7 +5092,7 @@ VkResult encode_vkGetSemaphoreFdKHR(
 #ifdef VK_KHR_push_descriptor
 
 void encode_vkCmdPushDescriptorSetKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineBindPoint pipelineBindPoint,
     VkPipelineLayout layout,
@@ -2129,16 +5100,32 @@ void encode_vkCmdPushDescriptorSetKHR(
     uint32_t descriptorWriteCount,
     const VkWriteDescriptorSet* pDescriptorWrites)
 {
+    vkStream->beginPacket(OP_vkCmdPushDescriptorSetKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&pipelineBindPoint, sizeof(VkPipelineBindPoint));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(layout));
+    vkStream->write(&set, sizeof(uint32_t));
+    vkStream->write(&descriptorWriteCount, sizeof(uint32_t));
+    vkStream->putU32(pDescriptorWrites ? 1 : 0);
+    if (pDescriptorWrites)
+    {
+        for (uint32_t i = 0; i < (uint32_t)descriptorWriteCount; ++i)
+        {
+            marshal_VkWriteDescriptorSet(vkStream, pDescriptorWrites + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdPushDescriptorSetWithTemplateKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
     VkPipelineLayout layout,
     uint32_t set,
     const void* pData)
 {
+    // Not supported by the wire format.
 }
 
 #endif
@@ -2154,30 +5141,55 @@ void encode_vkCmdPushDescriptorSetWithTemplateKHR(
 #ifdef VK_KHR_descriptor_update_template
 
 VkResult encode_vkCreateDescriptorUpdateTemplateKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateDescriptorUpdateTemplateKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkDescriptorUpdateTemplateCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pDescriptorUpdateTemplate ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateDescriptorUpdateTemplateKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateDescriptorUpdateTemplateKHR_VkResult_return, sizeof(VkResult));
+    if (vkCreateDescriptorUpdateTemplateKHR_VkResult_return >= 0)
+    {
+        if (pDescriptorUpdateTemplate)
+        {
+            *pDescriptorUpdateTemplate = vkStream->handleMapping()->fromWire_VkDescriptorUpdateTemplate(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateDescriptorUpdateTemplateKHR_VkResult_return;
 }
 
 void encode_vkDestroyDescriptorUpdateTemplateKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyDescriptorUpdateTemplateKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorUpdateTemplate(descriptorUpdateTemplate));
+    vkStream->endPacket();
 }
 
 void encode_vkUpdateDescriptorSetWithTemplateKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorSet descriptorSet,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
     const void* pData)
 {
+    // Not supported by the wire format.
 }
 
 #endif
@@ -2185,36 +5197,90 @@ void encode_vkUpdateDescriptorSetWithTemplateKHR(
 #ifdef VK_KHR_create_renderpass2
 
 VkResult encode_vkCreateRenderPass2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkRenderPassCreateInfo2KHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkRenderPass* pRenderPass)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateRenderPass2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkRenderPassCreateInfo2KHR(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pRenderPass ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateRenderPass2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateRenderPass2KHR_VkResult_return, sizeof(VkResult));
+    if (vkCreateRenderPass2KHR_VkResult_return >= 0)
+    {
+        if (pRenderPass)
+        {
+            *pRenderPass = vkStream->handleMapping()->fromWire_VkRenderPass(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateRenderPass2KHR_VkResult_return;
 }
 
 void encode_vkCmdBeginRenderPass2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkRenderPassBeginInfo*      pRenderPassBegin,
     const VkSubpassBeginInfoKHR*      pSubpassBeginInfo)
 {
+    vkStream->beginPacket(OP_vkCmdBeginRenderPass2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pRenderPassBegin ? 1 : 0);
+    if (pRenderPassBegin)
+    {
+        marshal_VkRenderPassBeginInfo(vkStream, pRenderPassBegin);
+    }
+    vkStream->putU32(pSubpassBeginInfo ? 1 : 0);
+    if (pSubpassBeginInfo)
+    {
+        marshal_VkSubpassBeginInfoKHR(vkStream, pSubpassBeginInfo);
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdNextSubpass2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkSubpassBeginInfoKHR*      pSubpassBeginInfo,
     const VkSubpassEndInfoKHR*        pSubpassEndInfo)
 {
+    vkStream->beginPacket(OP_vkCmdNextSubpass2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pSubpassBeginInfo ? 1 : 0);
+    if (pSubpassBeginInfo)
+    {
+        marshal_VkSubpassBeginInfoKHR(vkStream, pSubpassBeginInfo);
+    }
+    vkStream->putU32(pSubpassEndInfo ? 1 : 0);
+    if (pSubpassEndInfo)
+    {
+        marshal_VkSubpassEndInfoKHR(vkStream, pSubpassEndInfo);
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdEndRenderPass2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkSubpassEndInfoKHR*        pSubpassEndInfo)
 {
+    vkStream->beginPacket(OP_vkCmdEndRenderPass2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pSubpassEndInfo ? 1 : 0);
+    if (pSubpassEndInfo)
+    {
+        marshal_VkSubpassEndInfoKHR(vkStream, pSubpassEndInfo);
+    }
+    vkStream->endPacket();
 }
 
 #endif
@@ -2222,11 +5288,19 @@ void encode_vkCmdEndRenderPass2KHR(
 #ifdef VK_KHR_shared_presentable_image
 
 VkResult encode_vkGetSwapchainStatusKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetSwapchainStatusKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(swapchain));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetSwapchainStatusKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetSwapchainStatusKHR_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkGetSwapchainStatusKHR_VkResult_return;
 }
 
 #endif
@@ -2234,11 +5308,30 @@ VkResult encode_vkGetSwapchainStatusKHR(
 #ifdef VK_KHR_external_fence_capabilities
 
 void encode_vkGetPhysicalDeviceExternalFencePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo,
     VkExternalFenceProperties* pExternalFenceProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceExternalFencePropertiesKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pExternalFenceInfo ? 1 : 0);
+    if (pExternalFenceInfo)
+    {
+        marshal_VkPhysicalDeviceExternalFenceInfo(vkStream, pExternalFenceInfo);
+    }
+    vkStream->putU32(pExternalFenceProperties ? 1 : 0);
+    if (pExternalFenceProperties)
+    {
+        marshal_extension_struct_types(vkStream, pExternalFenceProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pExternalFenceProperties)
+    {
+        unmarshal_VkExternalFenceProperties(vkStream, pExternalFenceProperties);
+    }
+    vkStream->clearPool();
 }
 
 #endif
@@ -2250,20 +5343,22 @@ void encode_vkGetPhysicalDeviceExternalFencePropertiesKHR(
 #ifdef VK_KHR_external_fence_win32
 
 VkResult encode_vkImportFenceWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkResult encode_vkGetFenceWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo,
     HANDLE* pHandle)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -2271,20 +5366,52 @@ VkResult encode_vkGetFenceWin32HandleKHR(
 #ifdef VK_KHR_external_fence_fd
 
 VkResult encode_vkImportFenceFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImportFenceFdInfoKHR* pImportFenceFdInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkImportFenceFdKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pImportFenceFdInfo ? 1 : 0);
+    if (pImportFenceFdInfo)
+    {
+        marshal_VkImportFenceFdInfoKHR(vkStream, pImportFenceFdInfo);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkImportFenceFdKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkImportFenceFdKHR_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkImportFenceFdKHR_VkResult_return;
 }
 
 VkResult encode_vkGetFenceFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkFenceGetFdInfoKHR* pGetFdInfo,
     int* pFd)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetFenceFdKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pGetFdInfo ? 1 : 0);
+    if (pGetFdInfo)
+    {
+        marshal_VkFenceGetFdInfoKHR(vkStream, pGetFdInfo);
+    }
+    vkStream->putU32(pFd ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetFenceFdKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetFenceFdKHR_VkResult_return, sizeof(VkResult));
+    if (vkGetFenceFdKHR_VkResult_return >= 0)
+    {
+        if (pFd)
+        {
+            vkStream->read(pFd, sizeof(int));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetFenceFdKHR_VkResult_return;
 }
 
 #endif
@@ -2296,22 +5423,85 @@ VkResult encode_vkGetFenceFdKHR(
 #ifdef VK_KHR_get_surface_capabilities2
 
 VkResult encode_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo,
     VkSurfaceCapabilities2KHR* pSurfaceCapabilities)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSurfaceCapabilities2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pSurfaceInfo ? 1 : 0);
+    if (pSurfaceInfo)
+    {
+        marshal_VkPhysicalDeviceSurfaceInfo2KHR(vkStream, pSurfaceInfo);
+    }
+    vkStream->putU32(pSurfaceCapabilities ? 1 : 0);
+    if (pSurfaceCapabilities)
+    {
+        marshal_extension_struct_types(vkStream, pSurfaceCapabilities->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceSurfaceCapabilities2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceSurfaceCapabilities2KHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceSurfaceCapabilities2KHR_VkResult_return >= 0)
+    {
+        if (pSurfaceCapabilities)
+        {
+            unmarshal_VkSurfaceCapabilities2KHR(vkStream, pSurfaceCapabilities);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceSurfaceCapabilities2KHR_VkResult_return;
 }
 
 VkResult encode_vkGetPhysicalDeviceSurfaceFormats2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo,
     uint32_t* pSurfaceFormatCount,
     VkSurfaceFormat2KHR* pSurfaceFormats)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSurfaceFormats2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pSurfaceInfo ? 1 : 0);
+    if (pSurfaceInfo)
+    {
+        marshal_VkPhysicalDeviceSurfaceInfo2KHR(vkStream, pSurfaceInfo);
+    }
+    vkStream->putU32(pSurfaceFormatCount ? 1 : 0);
+    if (pSurfaceFormatCount)
+    {
+        vkStream->write(pSurfaceFormatCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pSurfaceFormats ? 1 : 0);
+    if (pSurfaceFormats)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pSurfaceFormatCount ? *pSurfaceFormatCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pSurfaceFormats[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceSurfaceFormats2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceSurfaceFormats2KHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceSurfaceFormats2KHR_VkResult_return >= 0)
+    {
+        if (pSurfaceFormatCount)
+        {
+            vkStream->read(pSurfaceFormatCount, sizeof(uint32_t));
+        }
+        if (pSurfaceFormats)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pSurfaceFormatCount ? *pSurfaceFormatCount : 0); ++i)
+            {
+                unmarshal_VkSurfaceFormat2KHR(vkStream, pSurfaceFormats + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceSurfaceFormats2KHR_VkResult_return;
 }
 
 #endif
@@ -2323,40 +5513,134 @@ VkResult encode_vkGetPhysicalDeviceSurfaceFormats2KHR(
 #ifdef VK_KHR_get_display_properties2
 
 VkResult encode_vkGetPhysicalDeviceDisplayProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkDisplayProperties2KHR* pProperties)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkResult encode_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkDisplayPlaneProperties2KHR* pProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceDisplayPlaneProperties2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    if (pProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pProperties[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceDisplayPlaneProperties2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceDisplayPlaneProperties2KHR_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceDisplayPlaneProperties2KHR_VkResult_return >= 0)
+    {
+        if (pPropertyCount)
+        {
+            vkStream->read(pPropertyCount, sizeof(uint32_t));
+        }
+        if (pProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+            {
+                unmarshal_VkDisplayPlaneProperties2KHR(vkStream, pProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceDisplayPlaneProperties2KHR_VkResult_return;
 }
 
 VkResult encode_vkGetDisplayModeProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayKHR display,
     uint32_t* pPropertyCount,
     VkDisplayModeProperties2KHR* pProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetDisplayModeProperties2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayKHR(display));
+    vkStream->putU32(pPropertyCount ? 1 : 0);
+    if (pPropertyCount)
+    {
+        vkStream->write(pPropertyCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pProperties ? 1 : 0);
+    if (pProperties)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pProperties[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetDisplayModeProperties2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetDisplayModeProperties2KHR_VkResult_return, sizeof(VkResult));
+    if (vkGetDisplayModeProperties2KHR_VkResult_return >= 0)
+    {
+        if (pPropertyCount)
+        {
+            vkStream->read(pPropertyCount, sizeof(uint32_t));
+        }
+        if (pProperties)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+            {
+                unmarshal_VkDisplayModeProperties2KHR(vkStream, pProperties + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetDisplayModeProperties2KHR_VkResult_return;
 }
 
 VkResult encode_vkGetDisplayPlaneCapabilities2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo,
     VkDisplayPlaneCapabilities2KHR* pCapabilities)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetDisplayPlaneCapabilities2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pDisplayPlaneInfo ? 1 : 0);
+    if (pDisplayPlaneInfo)
+    {
+        marshal_VkDisplayPlaneInfo2KHR(vkStream, pDisplayPlaneInfo);
+    }
+    vkStream->putU32(pCapabilities ? 1 : 0);
+    if (pCapabilities)
+    {
+        marshal_extension_struct_types(vkStream, pCapabilities->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetDisplayPlaneCapabilities2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetDisplayPlaneCapabilities2KHR_VkResult_return, sizeof(VkResult));
+    if (vkGetDisplayPlaneCapabilities2KHR_VkResult_return >= 0)
+    {
+        if (pCapabilities)
+        {
+            unmarshal_VkDisplayPlaneCapabilities2KHR(vkStream, pCapabilities);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetDisplayPlaneCapabilities2KHR_VkResult_return;
 }
 
 #endif
@@ -2376,28 +5660,100 @@ VkResult encode_vkGetDisplayPlaneCapabilities2KHR(
 #ifdef VK_KHR_get_memory_requirements2
 
 void encode_vkGetImageMemoryRequirements2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageMemoryRequirementsInfo2* pInfo,
     VkMemoryRequirements2* pMemoryRequirements)
 {
+    vkStream->beginPacket(OP_vkGetImageMemoryRequirements2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pInfo ? 1 : 0);
+    if (pInfo)
+    {
+        marshal_VkImageMemoryRequirementsInfo2(vkStream, pInfo);
+    }
+    vkStream->putU32(pMemoryRequirements ? 1 : 0);
+    if (pMemoryRequirements)
+    {
+        marshal_extension_struct_types(vkStream, pMemoryRequirements->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMemoryRequirements)
+    {
+        unmarshal_VkMemoryRequirements2(vkStream, pMemoryRequirements);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetBufferMemoryRequirements2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkBufferMemoryRequirementsInfo2* pInfo,
     VkMemoryRequirements2* pMemoryRequirements)
 {
+    vkStream->beginPacket(OP_vkGetBufferMemoryRequirements2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pInfo ? 1 : 0);
+    if (pInfo)
+    {
+        marshal_VkBufferMemoryRequirementsInfo2(vkStream, pInfo);
+    }
+    vkStream->putU32(pMemoryRequirements ? 1 : 0);
+    if (pMemoryRequirements)
+    {
+        marshal_extension_struct_types(vkStream, pMemoryRequirements->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMemoryRequirements)
+    {
+        unmarshal_VkMemoryRequirements2(vkStream, pMemoryRequirements);
+    }
+    vkStream->clearPool();
 }
 
 void encode_vkGetImageSparseMemoryRequirements2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageSparseMemoryRequirementsInfo2* pInfo,
     uint32_t* pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements2* pSparseMemoryRequirements)
 {
+    vkStream->beginPacket(OP_vkGetImageSparseMemoryRequirements2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pInfo ? 1 : 0);
+    if (pInfo)
+    {
+        marshal_VkImageSparseMemoryRequirementsInfo2(vkStream, pInfo);
+    }
+    vkStream->putU32(pSparseMemoryRequirementCount ? 1 : 0);
+    if (pSparseMemoryRequirementCount)
+    {
+        vkStream->write(pSparseMemoryRequirementCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pSparseMemoryRequirements ? 1 : 0);
+    if (pSparseMemoryRequirements)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+        {
+            marshal_extension_struct_types(vkStream, pSparseMemoryRequirements[i].pNext);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pSparseMemoryRequirementCount)
+    {
+        vkStream->read(pSparseMemoryRequirementCount, sizeof(uint32_t));
+    }
+    if (pSparseMemoryRequirements)
+    {
+        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+        {
+            unmarshal_VkSparseImageMemoryRequirements2(vkStream, pSparseMemoryRequirements + i);
+        }
+    }
+    vkStream->clearPool();
 }
 
 #endif
@@ -2409,21 +5765,45 @@ void encode_vkGetImageSparseMemoryRequirements2KHR(
 #ifdef VK_KHR_sampler_ycbcr_conversion
 
 VkResult encode_vkCreateSamplerYcbcrConversionKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSamplerYcbcrConversionCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSamplerYcbcrConversion* pYcbcrConversion)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateSamplerYcbcrConversionKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkSamplerYcbcrConversionCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pYcbcrConversion ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateSamplerYcbcrConversionKHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateSamplerYcbcrConversionKHR_VkResult_return, sizeof(VkResult));
+    if (vkCreateSamplerYcbcrConversionKHR_VkResult_return >= 0)
+    {
+        if (pYcbcrConversion)
+        {
+            *pYcbcrConversion = vkStream->handleMapping()->fromWire_VkSamplerYcbcrConversion(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateSamplerYcbcrConversionKHR_VkResult_return;
 }
 
 void encode_vkDestroySamplerYcbcrConversionKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSamplerYcbcrConversion ycbcrConversion,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroySamplerYcbcrConversionKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSamplerYcbcrConversion(ycbcrConversion));
+    vkStream->endPacket();
 }
 
 #endif
@@ -2431,21 +5811,53 @@ void encode_vkDestroySamplerYcbcrConversionKHR(
 #ifdef VK_KHR_bind_memory2
 
 VkResult encode_vkBindBufferMemory2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t bindInfoCount,
     const VkBindBufferMemoryInfo* pBindInfos)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkBindBufferMemory2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&bindInfoCount, sizeof(uint32_t));
+    vkStream->putU32(pBindInfos ? 1 : 0);
+    if (pBindInfos)
+    {
+        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+        {
+            marshal_VkBindBufferMemoryInfo(vkStream, pBindInfos + i);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkBindBufferMemory2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkBindBufferMemory2KHR_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkBindBufferMemory2KHR_VkResult_return;
 }
 
 VkResult encode_vkBindImageMemory2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t bindInfoCount,
     const VkBindImageMemoryInfo* pBindInfos)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkBindImageMemory2KHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&bindInfoCount, sizeof(uint32_t));
+    vkStream->putU32(pBindInfos ? 1 : 0);
+    if (pBindInfos)
+    {
+        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+        {
+            marshal_VkBindImageMemoryInfo(vkStream, pBindInfos + i);
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkBindImageMemory2KHR_VkResult_return = (VkResult)0;
+    vkStream->read(&vkBindImageMemory2KHR_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkBindImageMemory2KHR_VkResult_return;
 }
 
 #endif
@@ -2453,11 +5865,30 @@ VkResult encode_vkBindImageMemory2KHR(
 #ifdef VK_KHR_maintenance3
 
 void encode_vkGetDescriptorSetLayoutSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
     VkDescriptorSetLayoutSupport* pSupport)
 {
+    vkStream->beginPacket(OP_vkGetDescriptorSetLayoutSupportKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkDescriptorSetLayoutCreateInfo(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pSupport ? 1 : 0);
+    if (pSupport)
+    {
+        marshal_extension_struct_types(vkStream, pSupport->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pSupport)
+    {
+        unmarshal_VkDescriptorSetLayoutSupport(vkStream, pSupport);
+    }
+    vkStream->clearPool();
 }
 
 #endif
@@ -2465,7 +5896,7 @@ void encode_vkGetDescriptorSetLayoutSupportKHR(
 #ifdef VK_KHR_draw_indirect_count
 
 void encode_vkCmdDrawIndirectCountKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -2474,10 +5905,19 @@ void encode_vkCmdDrawIndirectCountKHR(
     uint32_t maxDrawCount,
     uint32_t stride)
 {
+    vkStream->beginPacket(OP_vkCmdDrawIndirectCountKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->write(&offset, sizeof(VkDeviceSize));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(countBuffer));
+    vkStream->write(&countBufferOffset, sizeof(VkDeviceSize));
+    vkStream->write(&maxDrawCount, sizeof(uint32_t));
+    vkStream->write(&stride, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDrawIndexedIndirectCountKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -2486,6 +5926,15 @@ void encode_vkCmdDrawIndexedIndirectCountKHR(
     uint32_t maxDrawCount,
     uint32_t stride)
 {
+    vkStream->beginPacket(OP_vkCmdDrawIndexedIndirectCountKHR);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->write(&offset, sizeof(VkDeviceSize));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(countBuffer));
+    vkStream->write(&countBufferOffset, sizeof(VkDeviceSize));
+    vkStream->write(&maxDrawCount, sizeof(uint32_t));
+    vkStream->write(&stride, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 #endif
@@ -2497,25 +5946,30 @@ void encode_vkCmdDrawIndexedIndirectCountKHR(
 #ifdef VK_EXT_debug_report
 
 VkResult encode_vkCreateDebugReportCallbackEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkDebugReportCallbackCreateInfoEXT* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkDebugReportCallbackEXT* pCallback)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 void encode_vkDestroyDebugReportCallbackEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkDebugReportCallbackEXT callback,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyDebugReportCallbackEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDebugReportCallbackEXT(callback));
+    vkStream->endPacket();
 }
 
 void encode_vkDebugReportMessageEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkDebugReportFlagsEXT flags,
     VkDebugReportObjectTypeEXT objectType,
@@ -2525,6 +5979,16 @@ void encode_vkDebugReportMessageEXT(
     const char* pLayerPrefix,
     const char* pMessage)
 {
+    vkStream->beginPacket(OP_vkDebugReportMessageEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->write(&flags, sizeof(VkDebugReportFlagsEXT));
+    vkStream->write(&objectType, sizeof(VkDebugReportObjectTypeEXT));
+    vkStream->write(&object, sizeof(uint64_t));
+    vkStream->putU64((uint64_t)location);
+    vkStream->write(&messageCode, sizeof(int32_t));
+    vkStream->putString(pLayerPrefix);
+    vkStream->putString(pMessage);
+    vkStream->endPacket();
 }
 
 #endif
@@ -2556,39 +6020,82 @@ void encode_vkDebugReportMessageEXT(
 #ifdef VK_EXT_debug_marker
 
 VkResult encode_vkDebugMarkerSetObjectTagEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDebugMarkerObjectTagInfoEXT* pTagInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkDebugMarkerSetObjectTagEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pTagInfo ? 1 : 0);
+    if (pTagInfo)
+    {
+        marshal_VkDebugMarkerObjectTagInfoEXT(vkStream, pTagInfo);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkDebugMarkerSetObjectTagEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkDebugMarkerSetObjectTagEXT_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkDebugMarkerSetObjectTagEXT_VkResult_return;
 }
 
 VkResult encode_vkDebugMarkerSetObjectNameEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDebugMarkerObjectNameInfoEXT* pNameInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkDebugMarkerSetObjectNameEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pNameInfo ? 1 : 0);
+    if (pNameInfo)
+    {
+        marshal_VkDebugMarkerObjectNameInfoEXT(vkStream, pNameInfo);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkDebugMarkerSetObjectNameEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkDebugMarkerSetObjectNameEXT_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkDebugMarkerSetObjectNameEXT_VkResult_return;
 }
 
 void encode_vkCmdDebugMarkerBeginEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
 {
+    vkStream->beginPacket(OP_vkCmdDebugMarkerBeginEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pMarkerInfo ? 1 : 0);
+    if (pMarkerInfo)
+    {
+        marshal_VkDebugMarkerMarkerInfoEXT(vkStream, pMarkerInfo);
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDebugMarkerEndEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 {
+    vkStream->beginPacket(OP_vkCmdDebugMarkerEndEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDebugMarkerInsertEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
 {
+    vkStream->beginPacket(OP_vkCmdDebugMarkerInsertEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pMarkerInfo ? 1 : 0);
+    if (pMarkerInfo)
+    {
+        marshal_VkDebugMarkerMarkerInfoEXT(vkStream, pMarkerInfo);
+    }
+    vkStream->endPacket();
 }
 
 #endif
@@ -2604,7 +6111,7 @@ void encode_vkCmdDebugMarkerInsertEXT(
 #ifdef VK_AMD_draw_indirect_count
 
 void encode_vkCmdDrawIndirectCountAMD(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -2613,10 +6120,19 @@ void encode_vkCmdDrawIndirectCountAMD(
     uint32_t maxDrawCount,
     uint32_t stride)
 {
+    vkStream->beginPacket(OP_vkCmdDrawIndirectCountAMD);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->write(&offset, sizeof(VkDeviceSize));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(countBuffer));
+    vkStream->write(&countBufferOffset, sizeof(VkDeviceSize));
+    vkStream->write(&maxDrawCount, sizeof(uint32_t));
+    vkStream->write(&stride, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdDrawIndexedIndirectCountAMD(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -2625,6 +6141,15 @@ void encode_vkCmdDrawIndexedIndirectCountAMD(
     uint32_t maxDrawCount,
     uint32_t stride)
 {
+    vkStream->beginPacket(OP_vkCmdDrawIndexedIndirectCountAMD);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(buffer));
+    vkStream->write(&offset, sizeof(VkDeviceSize));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(countBuffer));
+    vkStream->write(&countBufferOffset, sizeof(VkDeviceSize));
+    vkStream->write(&maxDrawCount, sizeof(uint32_t));
+    vkStream->write(&stride, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 #endif
@@ -2648,7 +6173,7 @@ void encode_vkCmdDrawIndexedIndirectCountAMD(
 #ifdef VK_AMD_shader_info
 
 VkResult encode_vkGetShaderInfoAMD(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipeline pipeline,
     VkShaderStageFlagBits shaderStage,
@@ -2656,7 +6181,34 @@ VkResult encode_vkGetShaderInfoAMD(
     size_t* pInfoSize,
     void* pInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetShaderInfoAMD);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPipeline(pipeline));
+    vkStream->write(&shaderStage, sizeof(VkShaderStageFlagBits));
+    vkStream->write(&infoType, sizeof(VkShaderInfoTypeAMD));
+    vkStream->putU32(pInfoSize ? 1 : 0);
+    if (pInfoSize)
+    {
+        vkStream->putU64((uint64_t)*pInfoSize);
+    }
+    vkStream->putU32(pInfo ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetShaderInfoAMD_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetShaderInfoAMD_VkResult_return, sizeof(VkResult));
+    if (vkGetShaderInfoAMD_VkResult_return >= 0)
+    {
+        if (pInfoSize)
+        {
+            *pInfoSize = (size_t)vkStream->getU64();
+        }
+        if (pInfo)
+        {
+            vkStream->read(pInfo, (pInfoSize ? *pInfoSize : 0) * sizeof(uint8_t));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetShaderInfoAMD_VkResult_return;
 }
 
 #endif
@@ -2672,7 +6224,7 @@ VkResult encode_vkGetShaderInfoAMD(
 #ifdef VK_NV_external_memory_capabilities
 
 VkResult encode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkImageType type,
@@ -2682,7 +6234,28 @@ VkResult encode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
     VkExternalMemoryHandleTypeFlagsNV externalHandleType,
     VkExternalImageFormatPropertiesNV* pExternalImageFormatProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceExternalImageFormatPropertiesNV);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&format, sizeof(VkFormat));
+    vkStream->write(&type, sizeof(VkImageType));
+    vkStream->write(&tiling, sizeof(VkImageTiling));
+    vkStream->write(&usage, sizeof(VkImageUsageFlags));
+    vkStream->write(&flags, sizeof(VkImageCreateFlags));
+    vkStream->write(&externalHandleType, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+    vkStream->putU32(pExternalImageFormatProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceExternalImageFormatPropertiesNV_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceExternalImageFormatPropertiesNV_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceExternalImageFormatPropertiesNV_VkResult_return >= 0)
+    {
+        if (pExternalImageFormatProperties)
+        {
+            unmarshal_VkExternalImageFormatPropertiesNV(vkStream, pExternalImageFormatProperties);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceExternalImageFormatPropertiesNV_VkResult_return;
 }
 
 #endif
@@ -2694,13 +6267,14 @@ VkResult encode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
 #ifdef VK_NV_external_memory_win32
 
 VkResult encode_vkGetMemoryWin32HandleNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory,
     VkExternalMemoryHandleTypeFlagsNV handleType,
     HANDLE* pHandle)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -2716,13 +6290,14 @@ VkResult encode_vkGetMemoryWin32HandleNV(
 #ifdef VK_NN_vi_surface
 
 VkResult encode_vkCreateViSurfaceNN(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkViSurfaceCreateInfoNN* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -2738,16 +6313,27 @@ VkResult encode_vkCreateViSurfaceNN(
 #ifdef VK_EXT_conditional_rendering
 
 void encode_vkCmdBeginConditionalRenderingEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin)
 {
+    vkStream->beginPacket(OP_vkCmdBeginConditionalRenderingEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pConditionalRenderingBegin ? 1 : 0);
+    if (pConditionalRenderingBegin)
+    {
+        marshal_VkConditionalRenderingBeginInfoEXT(vkStream, pConditionalRenderingBegin);
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdEndConditionalRenderingEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 {
+    vkStream->beginPacket(OP_vkCmdEndConditionalRenderingEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->endPacket();
 }
 
 #endif
@@ -2755,83 +6341,190 @@ void encode_vkCmdEndConditionalRenderingEXT(
 #ifdef VK_NVX_device_generated_commands
 
 void encode_vkCmdProcessCommandsNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkCmdProcessCommandsInfoNVX* pProcessCommandsInfo)
 {
+    vkStream->beginPacket(OP_vkCmdProcessCommandsNVX);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pProcessCommandsInfo ? 1 : 0);
+    if (pProcessCommandsInfo)
+    {
+        marshal_VkCmdProcessCommandsInfoNVX(vkStream, pProcessCommandsInfo);
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdReserveSpaceForCommandsNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkCmdReserveSpaceForCommandsInfoNVX* pReserveSpaceInfo)
 {
+    vkStream->beginPacket(OP_vkCmdReserveSpaceForCommandsNVX);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pReserveSpaceInfo ? 1 : 0);
+    if (pReserveSpaceInfo)
+    {
+        marshal_VkCmdReserveSpaceForCommandsInfoNVX(vkStream, pReserveSpaceInfo);
+    }
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateIndirectCommandsLayoutNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkIndirectCommandsLayoutCreateInfoNVX* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkIndirectCommandsLayoutNVX* pIndirectCommandsLayout)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateIndirectCommandsLayoutNVX);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkIndirectCommandsLayoutCreateInfoNVX(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pIndirectCommandsLayout ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateIndirectCommandsLayoutNVX_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateIndirectCommandsLayoutNVX_VkResult_return, sizeof(VkResult));
+    if (vkCreateIndirectCommandsLayoutNVX_VkResult_return >= 0)
+    {
+        if (pIndirectCommandsLayout)
+        {
+            *pIndirectCommandsLayout = vkStream->handleMapping()->fromWire_VkIndirectCommandsLayoutNVX(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateIndirectCommandsLayoutNVX_VkResult_return;
 }
 
 void encode_vkDestroyIndirectCommandsLayoutNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkIndirectCommandsLayoutNVX indirectCommandsLayout,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyIndirectCommandsLayoutNVX);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkIndirectCommandsLayoutNVX(indirectCommandsLayout));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateObjectTableNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkObjectTableCreateInfoNVX* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkObjectTableNVX* pObjectTable)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateObjectTableNVX);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkObjectTableCreateInfoNVX(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pObjectTable ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateObjectTableNVX_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateObjectTableNVX_VkResult_return, sizeof(VkResult));
+    if (vkCreateObjectTableNVX_VkResult_return >= 0)
+    {
+        if (pObjectTable)
+        {
+            *pObjectTable = vkStream->handleMapping()->fromWire_VkObjectTableNVX(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateObjectTableNVX_VkResult_return;
 }
 
 void encode_vkDestroyObjectTableNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkObjectTableNVX objectTable,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyObjectTableNVX);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkObjectTableNVX(objectTable));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkRegisterObjectsNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkObjectTableNVX objectTable,
     uint32_t objectCount,
     const VkObjectTableEntryNVX* const*    ppObjectTableEntries,
     const uint32_t* pObjectIndices)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkResult encode_vkUnregisterObjectsNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkObjectTableNVX objectTable,
     uint32_t objectCount,
     const VkObjectEntryTypeNVX* pObjectEntryTypes,
     const uint32_t* pObjectIndices)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkUnregisterObjectsNVX);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkObjectTableNVX(objectTable));
+    vkStream->write(&objectCount, sizeof(uint32_t));
+    vkStream->putU32(pObjectEntryTypes ? 1 : 0);
+    if (pObjectEntryTypes)
+    {
+        vkStream->write(pObjectEntryTypes, objectCount * sizeof(VkObjectEntryTypeNVX));
+    }
+    vkStream->putU32(pObjectIndices ? 1 : 0);
+    if (pObjectIndices)
+    {
+        vkStream->write(pObjectIndices, objectCount * sizeof(uint32_t));
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkUnregisterObjectsNVX_VkResult_return = (VkResult)0;
+    vkStream->read(&vkUnregisterObjectsNVX_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkUnregisterObjectsNVX_VkResult_return;
 }
 
 void encode_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDeviceGeneratedCommandsFeaturesNVX* pFeatures,
     VkDeviceGeneratedCommandsLimitsNVX* pLimits)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU32(pFeatures ? 1 : 0);
+    if (pFeatures)
+    {
+        marshal_extension_struct_types(vkStream, pFeatures->pNext);
+    }
+    vkStream->putU32(pLimits ? 1 : 0);
+    if (pLimits)
+    {
+        marshal_extension_struct_types(vkStream, pLimits->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pFeatures)
+    {
+        unmarshal_VkDeviceGeneratedCommandsFeaturesNVX(vkStream, pFeatures);
+    }
+    if (pLimits)
+    {
+        unmarshal_VkDeviceGeneratedCommandsLimitsNVX(vkStream, pLimits);
+    }
+    vkStream->clearPool();
 }
 
 #endif
@@ -2839,12 +6532,25 @@ void encode_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(
 #ifdef VK_NV_clip_space_w_scaling
 
 void encode_vkCmdSetViewportWScalingNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstViewport,
     uint32_t viewportCount,
     const VkViewportWScalingNV* pViewportWScalings)
 {
+    vkStream->beginPacket(OP_vkCmdSetViewportWScalingNV);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&firstViewport, sizeof(uint32_t));
+    vkStream->write(&viewportCount, sizeof(uint32_t));
+    vkStream->putU32(pViewportWScalings ? 1 : 0);
+    if (pViewportWScalings)
+    {
+        for (uint32_t i = 0; i < (uint32_t)viewportCount; ++i)
+        {
+            marshal_VkViewportWScalingNV(vkStream, pViewportWScalings + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 #endif
@@ -2852,11 +6558,19 @@ void encode_vkCmdSetViewportWScalingNV(
 #ifdef VK_EXT_direct_mode_display
 
 VkResult encode_vkReleaseDisplayEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayKHR display)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkReleaseDisplayEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayKHR(display));
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkReleaseDisplayEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkReleaseDisplayEXT_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkReleaseDisplayEXT_VkResult_return;
 }
 
 #endif
@@ -2864,22 +6578,24 @@ VkResult encode_vkReleaseDisplayEXT(
 #ifdef VK_EXT_acquire_xlib_display
 
 VkResult encode_vkAcquireXlibDisplayEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     Display* dpy,
     VkDisplayKHR display)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkResult encode_vkGetRandROutputDisplayEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     Display* dpy,
     RROutput rrOutput,
     VkDisplayKHR* pDisplay)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -2887,12 +6603,32 @@ VkResult encode_vkGetRandROutputDisplayEXT(
 #ifdef VK_EXT_display_surface_counter
 
 VkResult encode_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     VkSurfaceCapabilities2EXT* pSurfaceCapabilities)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceSurfaceCapabilities2EXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(surface));
+    vkStream->putU32(pSurfaceCapabilities ? 1 : 0);
+    if (pSurfaceCapabilities)
+    {
+        marshal_extension_struct_types(vkStream, pSurfaceCapabilities->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPhysicalDeviceSurfaceCapabilities2EXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPhysicalDeviceSurfaceCapabilities2EXT_VkResult_return, sizeof(VkResult));
+    if (vkGetPhysicalDeviceSurfaceCapabilities2EXT_VkResult_return >= 0)
+    {
+        if (pSurfaceCapabilities)
+        {
+            unmarshal_VkSurfaceCapabilities2EXT(vkStream, pSurfaceCapabilities);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPhysicalDeviceSurfaceCapabilities2EXT_VkResult_return;
 }
 
 #endif
@@ -2900,43 +6636,114 @@ VkResult encode_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
 #ifdef VK_EXT_display_control
 
 VkResult encode_vkDisplayPowerControlEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDisplayKHR display,
     const VkDisplayPowerInfoEXT* pDisplayPowerInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkDisplayPowerControlEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayKHR(display));
+    vkStream->putU32(pDisplayPowerInfo ? 1 : 0);
+    if (pDisplayPowerInfo)
+    {
+        marshal_VkDisplayPowerInfoEXT(vkStream, pDisplayPowerInfo);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkDisplayPowerControlEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkDisplayPowerControlEXT_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkDisplayPowerControlEXT_VkResult_return;
 }
 
 VkResult encode_vkRegisterDeviceEventEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDeviceEventInfoEXT* pDeviceEventInfo,
     const VkAllocationCallbacks* pAllocator,
     VkFence* pFence)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkRegisterDeviceEventEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pDeviceEventInfo ? 1 : 0);
+    if (pDeviceEventInfo)
+    {
+        marshal_VkDeviceEventInfoEXT(vkStream, pDeviceEventInfo);
+    }
+    vkStream->putU32(pFence ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkRegisterDeviceEventEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkRegisterDeviceEventEXT_VkResult_return, sizeof(VkResult));
+    if (vkRegisterDeviceEventEXT_VkResult_return >= 0)
+    {
+        if (pFence)
+        {
+            *pFence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkRegisterDeviceEventEXT_VkResult_return;
 }
 
 VkResult encode_vkRegisterDisplayEventEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDisplayKHR display,
     const VkDisplayEventInfoEXT* pDisplayEventInfo,
     const VkAllocationCallbacks* pAllocator,
     VkFence* pFence)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkRegisterDisplayEventEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayKHR(display));
+    vkStream->putU32(pDisplayEventInfo ? 1 : 0);
+    if (pDisplayEventInfo)
+    {
+        marshal_VkDisplayEventInfoEXT(vkStream, pDisplayEventInfo);
+    }
+    vkStream->putU32(pFence ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkRegisterDisplayEventEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkRegisterDisplayEventEXT_VkResult_return, sizeof(VkResult));
+    if (vkRegisterDisplayEventEXT_VkResult_return >= 0)
+    {
+        if (pFence)
+        {
+            *pFence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkRegisterDisplayEventEXT_VkResult_return;
 }
 
 VkResult encode_vkGetSwapchainCounterEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     VkSurfaceCounterFlagBitsEXT counter,
     uint64_t* pCounterValue)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetSwapchainCounterEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(swapchain));
+    vkStream->write(&counter, sizeof(VkSurfaceCounterFlagBitsEXT));
+    vkStream->putU32(pCounterValue ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetSwapchainCounterEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetSwapchainCounterEXT_VkResult_return, sizeof(VkResult));
+    if (vkGetSwapchainCounterEXT_VkResult_return >= 0)
+    {
+        if (pCounterValue)
+        {
+            vkStream->read(pCounterValue, sizeof(uint64_t));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetSwapchainCounterEXT_VkResult_return;
 }
 
 #endif
@@ -2944,22 +6751,66 @@ VkResult encode_vkGetSwapchainCounterEXT(
 #ifdef VK_GOOGLE_display_timing
 
 VkResult encode_vkGetRefreshCycleDurationGOOGLE(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetRefreshCycleDurationGOOGLE);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(swapchain));
+    vkStream->putU32(pDisplayTimingProperties ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetRefreshCycleDurationGOOGLE_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetRefreshCycleDurationGOOGLE_VkResult_return, sizeof(VkResult));
+    if (vkGetRefreshCycleDurationGOOGLE_VkResult_return >= 0)
+    {
+        if (pDisplayTimingProperties)
+        {
+            unmarshal_VkRefreshCycleDurationGOOGLE(vkStream, pDisplayTimingProperties);
+        }
+    }
+    vkStream->clearPool();
+    return vkGetRefreshCycleDurationGOOGLE_VkResult_return;
 }
 
 VkResult encode_vkGetPastPresentationTimingGOOGLE(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     uint32_t* pPresentationTimingCount,
     VkPastPresentationTimingGOOGLE* pPresentationTimings)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetPastPresentationTimingGOOGLE);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(swapchain));
+    vkStream->putU32(pPresentationTimingCount ? 1 : 0);
+    if (pPresentationTimingCount)
+    {
+        vkStream->write(pPresentationTimingCount, sizeof(uint32_t));
+    }
+    vkStream->putU32(pPresentationTimings ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetPastPresentationTimingGOOGLE_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetPastPresentationTimingGOOGLE_VkResult_return, sizeof(VkResult));
+    if (vkGetPastPresentationTimingGOOGLE_VkResult_return >= 0)
+    {
+        if (pPresentationTimingCount)
+        {
+            vkStream->read(pPresentationTimingCount, sizeof(uint32_t));
+        }
+        if (pPresentationTimings)
+        {
+            for (uint32_t i = 0; i < (uint32_t)(pPresentationTimingCount ? *pPresentationTimingCount : 0); ++i)
+            {
+                unmarshal_VkPastPresentationTimingGOOGLE(vkStream, pPresentationTimings + i);
+            }
+        }
+    }
+    vkStream->clearPool();
+    return vkGetPastPresentationTimingGOOGLE_VkResult_return;
 }
 
 #endif
@@ -2987,12 +6838,25 @@ VkResult encode_vkGetPastPresentationTimingGOOGLE(
 #ifdef VK_EXT_discard_rectangles
 
 void encode_vkCmdSetDiscardRectangleEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstDiscardRectangle,
     uint32_t discardRectangleCount,
     const VkRect2D* pDiscardRectangles)
 {
+    vkStream->beginPacket(OP_vkCmdSetDiscardRectangleEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&firstDiscardRectangle, sizeof(uint32_t));
+    vkStream->write(&discardRectangleCount, sizeof(uint32_t));
+    vkStream->putU32(pDiscardRectangles ? 1 : 0);
+    if (pDiscardRectangles)
+    {
+        for (uint32_t i = 0; i < (uint32_t)discardRectangleCount; ++i)
+        {
+            marshal_VkRect2D(vkStream, pDiscardRectangles + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 #endif
@@ -3008,12 +6872,32 @@ void encode_vkCmdSetDiscardRectangleEXT(
 #ifdef VK_EXT_hdr_metadata
 
 void encode_vkSetHdrMetadataEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t swapchainCount,
     const VkSwapchainKHR* pSwapchains,
     const VkHdrMetadataEXT* pMetadata)
 {
+    vkStream->beginPacket(OP_vkSetHdrMetadataEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->write(&swapchainCount, sizeof(uint32_t));
+    vkStream->putU32(pSwapchains ? 1 : 0);
+    if (pSwapchains)
+    {
+        for (uint32_t i = 0; i < (uint32_t)swapchainCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(pSwapchains[i]));
+        }
+    }
+    vkStream->putU32(pMetadata ? 1 : 0);
+    if (pMetadata)
+    {
+        for (uint32_t i = 0; i < (uint32_t)swapchainCount; ++i)
+        {
+            marshal_VkHdrMetadataEXT(vkStream, pMetadata + i);
+        }
+    }
+    vkStream->endPacket();
 }
 
 #endif
@@ -3021,13 +6905,14 @@ void encode_vkSetHdrMetadataEXT(
 #ifdef VK_MVK_ios_surface
 
 VkResult encode_vkCreateIOSSurfaceMVK(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkIOSSurfaceCreateInfoMVK* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -3035,13 +6920,14 @@ VkResult encode_vkCreateIOSSurfaceMVK(
 #ifdef VK_MVK_macos_surface
 
 VkResult encode_vkCreateMacOSSurfaceMVK(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkMacOSSurfaceCreateInfoMVK* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkSurfaceKHR* pSurface)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -3057,86 +6943,163 @@ VkResult encode_vkCreateMacOSSurfaceMVK(
 #ifdef VK_EXT_debug_utils
 
 VkResult encode_vkSetDebugUtilsObjectNameEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDebugUtilsObjectNameInfoEXT* pNameInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkSetDebugUtilsObjectNameEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pNameInfo ? 1 : 0);
+    if (pNameInfo)
+    {
+        marshal_VkDebugUtilsObjectNameInfoEXT(vkStream, pNameInfo);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkSetDebugUtilsObjectNameEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkSetDebugUtilsObjectNameEXT_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkSetDebugUtilsObjectNameEXT_VkResult_return;
 }
 
 VkResult encode_vkSetDebugUtilsObjectTagEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDebugUtilsObjectTagInfoEXT* pTagInfo)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkSetDebugUtilsObjectTagEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pTagInfo ? 1 : 0);
+    if (pTagInfo)
+    {
+        marshal_VkDebugUtilsObjectTagInfoEXT(vkStream, pTagInfo);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkSetDebugUtilsObjectTagEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkSetDebugUtilsObjectTagEXT_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkSetDebugUtilsObjectTagEXT_VkResult_return;
 }
 
 void encode_vkQueueBeginDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     const VkDebugUtilsLabelEXT* pLabelInfo)
 {
+    vkStream->beginPacket(OP_vkQueueBeginDebugUtilsLabelEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueue(queue));
+    vkStream->putU32(pLabelInfo ? 1 : 0);
+    if (pLabelInfo)
+    {
+        marshal_VkDebugUtilsLabelEXT(vkStream, pLabelInfo);
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkQueueEndDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue)
 {
+    vkStream->beginPacket(OP_vkQueueEndDebugUtilsLabelEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueue(queue));
+    vkStream->endPacket();
 }
 
 void encode_vkQueueInsertDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     const VkDebugUtilsLabelEXT* pLabelInfo)
 {
+    vkStream->beginPacket(OP_vkQueueInsertDebugUtilsLabelEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkQueue(queue));
+    vkStream->putU32(pLabelInfo ? 1 : 0);
+    if (pLabelInfo)
+    {
+        marshal_VkDebugUtilsLabelEXT(vkStream, pLabelInfo);
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdBeginDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkDebugUtilsLabelEXT* pLabelInfo)
 {
+    vkStream->beginPacket(OP_vkCmdBeginDebugUtilsLabelEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pLabelInfo ? 1 : 0);
+    if (pLabelInfo)
+    {
+        marshal_VkDebugUtilsLabelEXT(vkStream, pLabelInfo);
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkCmdEndDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 {
+    vkStream->beginPacket(OP_vkCmdEndDebugUtilsLabelEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->endPacket();
 }
 
 void encode_vkCmdInsertDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkDebugUtilsLabelEXT* pLabelInfo)
 {
+    vkStream->beginPacket(OP_vkCmdInsertDebugUtilsLabelEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pLabelInfo ? 1 : 0);
+    if (pLabelInfo)
+    {
+        marshal_VkDebugUtilsLabelEXT(vkStream, pLabelInfo);
+    }
+    vkStream->endPacket();
 }
 
 VkResult encode_vkCreateDebugUtilsMessengerEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkDebugUtilsMessengerEXT* pMessenger)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 void encode_vkDestroyDebugUtilsMessengerEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkDebugUtilsMessengerEXT messenger,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyDebugUtilsMessengerEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDebugUtilsMessengerEXT(messenger));
+    vkStream->endPacket();
 }
 
 void encode_vkSubmitDebugUtilsMessageEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
     VkDebugUtilsMessageTypeFlagsEXT messageTypes,
     const VkDebugUtilsMessengerCallbackDataEXT* pCallbackData)
 {
+    vkStream->beginPacket(OP_vkSubmitDebugUtilsMessageEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(instance));
+    vkStream->write(&messageSeverity, sizeof(VkDebugUtilsMessageSeverityFlagBitsEXT));
+    vkStream->write(&messageTypes, sizeof(VkDebugUtilsMessageTypeFlagsEXT));
+    vkStream->putU32(pCallbackData ? 1 : 0);
+    if (pCallbackData)
+    {
+        marshal_VkDebugUtilsMessengerCallbackDataEXT(vkStream, pCallbackData);
+    }
+    vkStream->endPacket();
 }
 
 #endif
@@ -3144,21 +7107,23 @@ void encode_vkSubmitDebugUtilsMessageEXT(
 #ifdef VK_ANDROID_external_memory_android_hardware_buffer
 
 VkResult encode_vkGetAndroidHardwareBufferPropertiesANDROID(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const struct AHardwareBuffer* buffer,
     VkAndroidHardwareBufferPropertiesANDROID* pProperties)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 VkResult encode_vkGetMemoryAndroidHardwareBufferANDROID(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo,
     struct AHardwareBuffer** pBuffer)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -3186,18 +7151,41 @@ VkResult encode_vkGetMemoryAndroidHardwareBufferANDROID(
 #ifdef VK_EXT_sample_locations
 
 void encode_vkCmdSetSampleLocationsEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkSampleLocationsInfoEXT* pSampleLocationsInfo)
 {
+    vkStream->beginPacket(OP_vkCmdSetSampleLocationsEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->putU32(pSampleLocationsInfo ? 1 : 0);
+    if (pSampleLocationsInfo)
+    {
+        marshal_VkSampleLocationsInfoEXT(vkStream, pSampleLocationsInfo);
+    }
+    vkStream->endPacket();
 }
 
 void encode_vkGetPhysicalDeviceMultisamplePropertiesEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSampleCountFlagBits samples,
     VkMultisamplePropertiesEXT* pMultisampleProperties)
 {
+    vkStream->beginPacket(OP_vkGetPhysicalDeviceMultisamplePropertiesEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(physicalDevice));
+    vkStream->write(&samples, sizeof(VkSampleCountFlagBits));
+    vkStream->putU32(pMultisampleProperties ? 1 : 0);
+    if (pMultisampleProperties)
+    {
+        marshal_extension_struct_types(vkStream, pMultisampleProperties->pNext);
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    if (pMultisampleProperties)
+    {
+        unmarshal_VkMultisamplePropertiesEXT(vkStream, pMultisampleProperties);
+    }
+    vkStream->clearPool();
 }
 
 #endif
@@ -3225,41 +7213,107 @@ void encode_vkGetPhysicalDeviceMultisamplePropertiesEXT(
 #ifdef VK_EXT_validation_cache
 
 VkResult encode_vkCreateValidationCacheEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkValidationCacheCreateInfoEXT* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkValidationCacheEXT* pValidationCache)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkCreateValidationCacheEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU32(pCreateInfo ? 1 : 0);
+    if (pCreateInfo)
+    {
+        marshal_VkValidationCacheCreateInfoEXT(vkStream, pCreateInfo);
+    }
+    vkStream->putU32(pValidationCache ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkCreateValidationCacheEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkCreateValidationCacheEXT_VkResult_return, sizeof(VkResult));
+    if (vkCreateValidationCacheEXT_VkResult_return >= 0)
+    {
+        if (pValidationCache)
+        {
+            *pValidationCache = vkStream->handleMapping()->fromWire_VkValidationCacheEXT(vkStream, vkStream->getU64());
+        }
+    }
+    vkStream->clearPool();
+    return vkCreateValidationCacheEXT_VkResult_return;
 }
 
 void encode_vkDestroyValidationCacheEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkValidationCacheEXT validationCache,
     const VkAllocationCallbacks* pAllocator)
 {
+    vkStream->beginPacket(OP_vkDestroyValidationCacheEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkValidationCacheEXT(validationCache));
+    vkStream->endPacket();
 }
 
 VkResult encode_vkMergeValidationCachesEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkValidationCacheEXT dstCache,
     uint32_t srcCacheCount,
     const VkValidationCacheEXT* pSrcCaches)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkMergeValidationCachesEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkValidationCacheEXT(dstCache));
+    vkStream->write(&srcCacheCount, sizeof(uint32_t));
+    vkStream->putU32(pSrcCaches ? 1 : 0);
+    if (pSrcCaches)
+    {
+        for (uint32_t i = 0; i < (uint32_t)srcCacheCount; ++i)
+        {
+            vkStream->putU64(vkStream->handleMapping()->toWire_VkValidationCacheEXT(pSrcCaches[i]));
+        }
+    }
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkMergeValidationCachesEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkMergeValidationCachesEXT_VkResult_return, sizeof(VkResult));
+    vkStream->clearPool();
+    return vkMergeValidationCachesEXT_VkResult_return;
 }
 
 VkResult encode_vkGetValidationCacheDataEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkValidationCacheEXT validationCache,
     size_t* pDataSize,
     void* pData)
 {
-    return (VkResult)0;
+    vkStream->beginPacket(OP_vkGetValidationCacheDataEXT);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(device));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkValidationCacheEXT(validationCache));
+    vkStream->putU32(pDataSize ? 1 : 0);
+    if (pDataSize)
+    {
+        vkStream->putU64((uint64_t)*pDataSize);
+    }
+    vkStream->putU32(pData ? 1 : 0);
+    vkStream->endPacket();
+    vkStream->readReply();
+    VkResult vkGetValidationCacheDataEXT_VkResult_return = (VkResult)0;
+    vkStream->read(&vkGetValidationCacheDataEXT_VkResult_return, sizeof(VkResult));
+    if (vkGetValidationCacheDataEXT_VkResult_return >= 0)
+    {
+        if (pDataSize)
+        {
+            *pDataSize = (size_t)vkStream->getU64();
+        }
+        if (pData)
+        {
+            vkStream->read(pData, (pDataSize ? *pDataSize : 0) * sizeof(uint8_t));
+        }
+    }
+    vkStream->clearPool();
+    return vkGetValidationCacheDataEXT_VkResult_return;
 }
 
 #endif
@@ -3279,13 +7333,14 @@ VkResult encode_vkGetValidationCacheDataEXT(
 #ifdef VK_EXT_external_memory_host
 
 VkResult encode_vkGetMemoryHostPointerPropertiesEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkExternalMemoryHandleTypeFlagBits handleType,
     const void* pHostPointer,
     VkMemoryHostPointerPropertiesEXT* pMemoryHostPointerProperties)
 {
-    return (VkResult)0;
+    // Not supported by the wire format.
+    return VK_ERROR_FEATURE_NOT_PRESENT;
 }
 
 #endif
@@ -3293,13 +7348,20 @@ VkResult encode_vkGetMemoryHostPointerPropertiesEXT(
 #ifdef VK_AMD_buffer_marker
 
 void encode_vkCmdWriteBufferMarkerAMD(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineStageFlagBits pipelineStage,
     VkBuffer dstBuffer,
     VkDeviceSize dstOffset,
     uint32_t marker)
 {
+    vkStream->beginPacket(OP_vkCmdWriteBufferMarkerAMD);
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(commandBuffer));
+    vkStream->write(&pipelineStage, sizeof(VkPipelineStageFlagBits));
+    vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(dstBuffer));
+    vkStream->write(&dstOffset, sizeof(VkDeviceSize));
+    vkStream->write(&marker, sizeof(uint32_t));
+    vkStream->endPacket();
 }
 
 #endif
@@ -3319,19 +7381,24 @@ void encode_vkCmdWriteBufferMarkerAMD(
 #ifdef VK_NV_device_diagnostic_checkpoints
 
 void encode_vkCmdSetCheckpointNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const void* pCheckpointMarker)
 {
+    // Not supported by the wire format.
 }
 
 void encode_vkGetQueueCheckpointDataNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     uint32_t* pCheckpointDataCount,
     VkCheckpointDataNV* pCheckpointData)
 {
+    // Not supported by the wire format.
 }
 
 #endif
 
+
+}  // namespace goldfish_vk
+
@@ -1,42 +1,57 @@
 // Module: goldfish_vk_encoder (header) Autogenerated by CerealGenerator
 
+
+#pragma once
+
+#include "VulkanStream.h"
+
+#include <vulkan.h>
+
+namespace goldfish_vk {
+
+// Commands that return nothing and have no output parameters, e.g. vkCmd*(),
+// are only queued in |vkStream|, which sends them in bulk with the next
+// command that needs a reply, or when its buffer fills up; see
+// VulkanStream::flush(). The others wait for their reply. Commands that the
+// wire format doesn't support return VK_ERROR_FEATURE_NOT_PRESENT.
+
 #ifdef VK_VERSION_1_0
 
 VkResult encode_vkCreateInstance(
-    void* vkStream,
+    VulkanStream* vkStream,
     const VkInstanceCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
     VkInstance* pInstance)
 ;
 
 void encode_vkDestroyInstance(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkEnumeratePhysicalDevices(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     uint32_t* pPhysicalDeviceCount,
     VkPhysicalDevice* pPhysicalDevices)
 ;
 
 void encode_vkGetPhysicalDeviceFeatures(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceFeatures* pFeatures)
 ;
 
 void encode_vkGetPhysicalDeviceFormatProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkFormatProperties* pFormatProperties)
 ;
 
 VkResult encode_vkGetPhysicalDeviceImageFormatProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkImageType type,
@@ -47,38 +62,38 @@ VkResult encode_vkGetPhysicalDeviceImageFormatProperties(
 ;
 
 void encode_vkGetPhysicalDeviceProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceProperties* pProperties)
 ;
 
 void encode_vkGetPhysicalDeviceQueueFamilyProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pQueueFamilyPropertyCount,
     VkQueueFamilyProperties* pQueueFamilyProperties)
 ;
 
 void encode_vkGetPhysicalDeviceMemoryProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceMemoryProperties* pMemoryProperties)
 ;
 
 PFN_vkVoidFunction encode_vkGetInstanceProcAddr(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const char* pName)
 ;
 
 PFN_vkVoidFunction encode_vkGetDeviceProcAddr(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const char* pName)
 ;
 
 VkResult encode_vkCreateDevice(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkDeviceCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -86,20 +101,20 @@ VkResult encode_vkCreateDevice(
 ;
 
 void encode_vkDestroyDevice(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkEnumerateInstanceExtensionProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     const char* pLayerName,
     uint32_t* pPropertyCount,
     VkExtensionProperties* pProperties)
 ;
 
 VkResult encode_vkEnumerateDeviceExtensionProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const char* pLayerName,
     uint32_t* pPropertyCount,
@@ -107,20 +122,20 @@ VkResult encode_vkEnumerateDeviceExtensionProperties(
 ;
 
 VkResult encode_vkEnumerateInstanceLayerProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     uint32_t* pPropertyCount,
     VkLayerProperties* pProperties)
 ;
 
 VkResult encode_vkEnumerateDeviceLayerProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkLayerProperties* pProperties)
 ;
 
 void encode_vkGetDeviceQueue(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t queueFamilyIndex,
     uint32_t queueIndex,
@@ -128,7 +143,7 @@ void encode_vkGetDeviceQueue(
 ;
 
 VkResult encode_vkQueueSubmit(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     uint32_t submitCount,
     const VkSubmitInfo* pSubmits,
@@ -136,17 +151,17 @@ VkResult encode_vkQueueSubmit(
 ;
 
 VkResult encode_vkQueueWaitIdle(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue)
 ;
 
 VkResult encode_vkDeviceWaitIdle(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device)
 ;
 
 VkResult encode_vkAllocateMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkMemoryAllocateInfo* pAllocateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -154,14 +169,14 @@ VkResult encode_vkAllocateMemory(
 ;
 
 void encode_vkFreeMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkMapMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory,
     VkDeviceSize offset,
@@ -171,34 +186,34 @@ VkResult encode_vkMapMemory(
 ;
 
 void encode_vkUnmapMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory)
 ;
 
 VkResult encode_vkFlushMappedMemoryRanges(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t memoryRangeCount,
     const VkMappedMemoryRange* pMemoryRanges)
 ;
 
 VkResult encode_vkInvalidateMappedMemoryRanges(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t memoryRangeCount,
     const VkMappedMemoryRange* pMemoryRanges)
 ;
 
 void encode_vkGetDeviceMemoryCommitment(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory,
     VkDeviceSize* pCommittedMemoryInBytes)
 ;
 
 VkResult encode_vkBindBufferMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkBuffer buffer,
     VkDeviceMemory memory,
@@ -206,7 +221,7 @@ VkResult encode_vkBindBufferMemory(
 ;
 
 VkResult encode_vkBindImageMemory(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     VkDeviceMemory memory,
@@ -214,21 +229,21 @@ VkResult encode_vkBindImageMemory(
 ;
 
 void encode_vkGetBufferMemoryRequirements(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkBuffer buffer,
     VkMemoryRequirements* pMemoryRequirements)
 ;
 
 void encode_vkGetImageMemoryRequirements(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     VkMemoryRequirements* pMemoryRequirements)
 ;
 
 void encode_vkGetImageSparseMemoryRequirements(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     uint32_t* pSparseMemoryRequirementCount,
@@ -236,7 +251,7 @@ void encode_vkGetImageSparseMemoryRequirements(
 ;
 
 void encode_vkGetPhysicalDeviceSparseImageFormatProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkImageType type,
@@ -248,7 +263,7 @@ void encode_vkGetPhysicalDeviceSparseImageFormatProperties(
 ;
 
 VkResult encode_vkQueueBindSparse(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     uint32_t bindInfoCount,
     const VkBindSparseInfo* pBindInfo,
@@ -256,7 +271,7 @@ VkResult encode_vkQueueBindSparse(
 ;
 
 VkResult encode_vkCreateFence(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkFenceCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -264,27 +279,27 @@ VkResult encode_vkCreateFence(
 ;
 
 void encode_vkDestroyFence(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkFence fence,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkResetFences(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t fenceCount,
     const VkFence* pFences)
 ;
 
 VkResult encode_vkGetFenceStatus(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkFence fence)
 ;
 
 VkResult encode_vkWaitForFences(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t fenceCount,
     const VkFence* pFences,
@@ -293,7 +308,7 @@ VkResult encode_vkWaitForFences(
 ;
 
 VkResult encode_vkCreateSemaphore(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSemaphoreCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -301,14 +316,14 @@ VkResult encode_vkCreateSemaphore(
 ;
 
 void encode_vkDestroySemaphore(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSemaphore semaphore,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkEventCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -316,32 +331,32 @@ VkResult encode_vkCreateEvent(
 ;
 
 void encode_vkDestroyEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkEvent event,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkGetEventStatus(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkEvent event)
 ;
 
 VkResult encode_vkSetEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkEvent event)
 ;
 
 VkResult encode_vkResetEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkEvent event)
 ;
 
 VkResult encode_vkCreateQueryPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkQueryPoolCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -349,14 +364,14 @@ VkResult encode_vkCreateQueryPool(
 ;
 
 void encode_vkDestroyQueryPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkQueryPool queryPool,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkGetQueryPoolResults(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkQueryPool queryPool,
     uint32_t firstQuery,
@@ -368,7 +383,7 @@ VkResult encode_vkGetQueryPoolResults(
 ;
 
 VkResult encode_vkCreateBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkBufferCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -376,14 +391,14 @@ VkResult encode_vkCreateBuffer(
 ;
 
 void encode_vkDestroyBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkBuffer buffer,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateBufferView(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkBufferViewCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -391,14 +406,14 @@ VkResult encode_vkCreateBufferView(
 ;
 
 void encode_vkDestroyBufferView(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkBufferView bufferView,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -406,14 +421,14 @@ VkResult encode_vkCreateImage(
 ;
 
 void encode_vkDestroyImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 void encode_vkGetImageSubresourceLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImage image,
     const VkImageSubresource* pSubresource,
@@ -421,7 +436,7 @@ void encode_vkGetImageSubresourceLayout(
 ;
 
 VkResult encode_vkCreateImageView(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageViewCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -429,14 +444,14 @@ VkResult encode_vkCreateImageView(
 ;
 
 void encode_vkDestroyImageView(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkImageView imageView,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateShaderModule(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkShaderModuleCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -444,14 +459,14 @@ VkResult encode_vkCreateShaderModule(
 ;
 
 void encode_vkDestroyShaderModule(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkShaderModule shaderModule,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreatePipelineCache(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkPipelineCacheCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -459,14 +474,14 @@ VkResult encode_vkCreatePipelineCache(
 ;
 
 void encode_vkDestroyPipelineCache(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache pipelineCache,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkGetPipelineCacheData(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache pipelineCache,
     size_t* pDataSize,
@@ -474,7 +489,7 @@ VkResult encode_vkGetPipelineCacheData(
 ;
 
 VkResult encode_vkMergePipelineCaches(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache dstCache,
     uint32_t srcCacheCount,
@@ -482,7 +497,7 @@ VkResult encode_vkMergePipelineCaches(
 ;
 
 VkResult encode_vkCreateGraphicsPipelines(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache pipelineCache,
     uint32_t createInfoCount,
@@ -492,7 +507,7 @@ VkResult encode_vkCreateGraphicsPipelines(
 ;
 
 VkResult encode_vkCreateComputePipelines(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineCache pipelineCache,
     uint32_t createInfoCount,
@@ -502,14 +517,14 @@ VkResult encode_vkCreateComputePipelines(
 ;
 
 void encode_vkDestroyPipeline(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipeline pipeline,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreatePipelineLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkPipelineLayoutCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -517,14 +532,14 @@ VkResult encode_vkCreatePipelineLayout(
 ;
 
 void encode_vkDestroyPipelineLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipelineLayout pipelineLayout,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateSampler(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSamplerCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -532,14 +547,14 @@ VkResult encode_vkCreateSampler(
 ;
 
 void encode_vkDestroySampler(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSampler sampler,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateDescriptorSetLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -547,14 +562,14 @@ VkResult encode_vkCreateDescriptorSetLayout(
 ;
 
 void encode_vkDestroyDescriptorSetLayout(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorSetLayout descriptorSetLayout,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateDescriptorPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorPoolCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -562,28 +577,28 @@ VkResult encode_vkCreateDescriptorPool(
 ;
 
 void encode_vkDestroyDescriptorPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorPool descriptorPool,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkResetDescriptorPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorPool descriptorPool,
     VkDescriptorPoolResetFlags flags)
 ;
 
 VkResult encode_vkAllocateDescriptorSets(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorSetAllocateInfo* pAllocateInfo,
     VkDescriptorSet* pDescriptorSets)
 ;
 
 VkResult encode_vkFreeDescriptorSets(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorPool descriptorPool,
     uint32_t descriptorSetCount,
@@ -591,7 +606,7 @@ VkResult encode_vkFreeDescriptorSets(
 ;
 
 void encode_vkUpdateDescriptorSets(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t descriptorWriteCount,
     const VkWriteDescriptorSet* pDescriptorWrites,
@@ -600,7 +615,7 @@ void encode_vkUpdateDescriptorSets(
 ;
 
 VkResult encode_vkCreateFramebuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkFramebufferCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -608,14 +623,14 @@ VkResult encode_vkCreateFramebuffer(
 ;
 
 void encode_vkDestroyFramebuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkFramebuffer framebuffer,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateRenderPass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkRenderPassCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -623,21 +638,21 @@ VkResult encode_vkCreateRenderPass(
 ;
 
 void encode_vkDestroyRenderPass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkRenderPass renderPass,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 void encode_vkGetRenderAreaGranularity(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkRenderPass renderPass,
     VkExtent2D* pGranularity)
 ;
 
 VkResult encode_vkCreateCommandPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkCommandPoolCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -645,28 +660,28 @@ VkResult encode_vkCreateCommandPool(
 ;
 
 void encode_vkDestroyCommandPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkResetCommandPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     VkCommandPoolResetFlags flags)
 ;
 
 VkResult encode_vkAllocateCommandBuffers(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkCommandBufferAllocateInfo* pAllocateInfo,
     VkCommandBuffer* pCommandBuffers)
 ;
 
 void encode_vkFreeCommandBuffers(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     uint32_t commandBufferCount,
@@ -674,31 +689,31 @@ void encode_vkFreeCommandBuffers(
 ;
 
 VkResult encode_vkBeginCommandBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkCommandBufferBeginInfo* pBeginInfo)
 ;
 
 VkResult encode_vkEndCommandBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 ;
 
 VkResult encode_vkResetCommandBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkCommandBufferResetFlags flags)
 ;
 
 void encode_vkCmdBindPipeline(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineBindPoint pipelineBindPoint,
     VkPipeline pipeline)
 ;
 
 void encode_vkCmdSetViewport(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstViewport,
     uint32_t viewportCount,
@@ -706,7 +721,7 @@ void encode_vkCmdSetViewport(
 ;
 
 void encode_vkCmdSetScissor(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstScissor,
     uint32_t scissorCount,
@@ -714,13 +729,13 @@ void encode_vkCmdSetScissor(
 ;
 
 void encode_vkCmdSetLineWidth(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     float lineWidth)
 ;
 
 void encode_vkCmdSetDepthBias(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     float depthBiasConstantFactor,
     float depthBiasClamp,
@@ -728,41 +743,41 @@ void encode_vkCmdSetDepthBias(
 ;
 
 void encode_vkCmdSetBlendConstants(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const float blendConstants[4])
 ;
 
 void encode_vkCmdSetDepthBounds(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     float minDepthBounds,
     float maxDepthBounds)
 ;
 
 void encode_vkCmdSetStencilCompareMask(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkStencilFaceFlags faceMask,
     uint32_t compareMask)
 ;
 
 void encode_vkCmdSetStencilWriteMask(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkStencilFaceFlags faceMask,
     uint32_t writeMask)
 ;
 
 void encode_vkCmdSetStencilReference(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkStencilFaceFlags faceMask,
     uint32_t reference)
 ;
 
 void encode_vkCmdBindDescriptorSets(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineBindPoint pipelineBindPoint,
     VkPipelineLayout layout,
@@ -774,7 +789,7 @@ void encode_vkCmdBindDescriptorSets(
 ;
 
 void encode_vkCmdBindIndexBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -782,7 +797,7 @@ void encode_vkCmdBindIndexBuffer(
 ;
 
 void encode_vkCmdBindVertexBuffers(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstBinding,
     uint32_t bindingCount,
@@ -791,7 +806,7 @@ void encode_vkCmdBindVertexBuffers(
 ;
 
 void encode_vkCmdDraw(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t vertexCount,
     uint32_t instanceCount,
@@ -800,7 +815,7 @@ void encode_vkCmdDraw(
 ;
 
 void encode_vkCmdDrawIndexed(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t indexCount,
     uint32_t instanceCount,
@@ -810,7 +825,7 @@ void encode_vkCmdDrawIndexed(
 ;
 
 void encode_vkCmdDrawIndirect(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -819,7 +834,7 @@ void encode_vkCmdDrawIndirect(
 ;
 
 void encode_vkCmdDrawIndexedIndirect(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -828,7 +843,7 @@ void encode_vkCmdDrawIndexedIndirect(
 ;
 
 void encode_vkCmdDispatch(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t groupCountX,
     uint32_t groupCountY,
@@ -836,14 +851,14 @@ void encode_vkCmdDispatch(
 ;
 
 void encode_vkCmdDispatchIndirect(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset)
 ;
 
 void encode_vkCmdCopyBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer srcBuffer,
     VkBuffer dstBuffer,
@@ -852,7 +867,7 @@ void encode_vkCmdCopyBuffer(
 ;
 
 void encode_vkCmdCopyImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage srcImage,
     VkImageLayout srcImageLayout,
@@ -863,7 +878,7 @@ void encode_vkCmdCopyImage(
 ;
 
 void encode_vkCmdBlitImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage srcImage,
     VkImageLayout srcImageLayout,
@@ -875,7 +890,7 @@ void encode_vkCmdBlitImage(
 ;
 
 void encode_vkCmdCopyBufferToImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer srcBuffer,
     VkImage dstImage,
@@ -885,7 +900,7 @@ void encode_vkCmdCopyBufferToImage(
 ;
 
 void encode_vkCmdCopyImageToBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage srcImage,
     VkImageLayout srcImageLayout,
@@ -895,7 +910,7 @@ void encode_vkCmdCopyImageToBuffer(
 ;
 
 void encode_vkCmdUpdateBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer dstBuffer,
     VkDeviceSize dstOffset,
@@ -904,7 +919,7 @@ void encode_vkCmdUpdateBuffer(
 ;
 
 void encode_vkCmdFillBuffer(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer dstBuffer,
     VkDeviceSize dstOffset,
@@ -913,7 +928,7 @@ void encode_vkCmdFillBuffer(
 ;
 
 void encode_vkCmdClearColorImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage image,
     VkImageLayout imageLayout,
@@ -923,7 +938,7 @@ void encode_vkCmdClearColorImage(
 ;
 
 void encode_vkCmdClearDepthStencilImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage image,
     VkImageLayout imageLayout,
@@ -933,7 +948,7 @@ void encode_vkCmdClearDepthStencilImage(
 ;
 
 void encode_vkCmdClearAttachments(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t attachmentCount,
     const VkClearAttachment* pAttachments,
@@ -942,7 +957,7 @@ void encode_vkCmdClearAttachments(
 ;
 
 void encode_vkCmdResolveImage(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkImage srcImage,
     VkImageLayout srcImageLayout,
@@ -953,21 +968,21 @@ void encode_vkCmdResolveImage(
 ;
 
 void encode_vkCmdSetEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkEvent event,
     VkPipelineStageFlags stageMask)
 ;
 
 void encode_vkCmdResetEvent(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkEvent event,
     VkPipelineStageFlags stageMask)
 ;
 
 void encode_vkCmdWaitEvents(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t eventCount,
     const VkEvent* pEvents,
@@ -982,7 +997,7 @@ void encode_vkCmdWaitEvents(
 ;
 
 void encode_vkCmdPipelineBarrier(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineStageFlags srcStageMask,
     VkPipelineStageFlags dstStageMask,
@@ -996,7 +1011,7 @@ void encode_vkCmdPipelineBarrier(
 ;
 
 void encode_vkCmdBeginQuery(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkQueryPool queryPool,
     uint32_t query,
@@ -1004,14 +1019,14 @@ void encode_vkCmdBeginQuery(
 ;
 
 void encode_vkCmdEndQuery(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkQueryPool queryPool,
     uint32_t query)
 ;
 
 void encode_vkCmdResetQueryPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkQueryPool queryPool,
     uint32_t firstQuery,
@@ -1019,7 +1034,7 @@ void encode_vkCmdResetQueryPool(
 ;
 
 void encode_vkCmdWriteTimestamp(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineStageFlagBits pipelineStage,
     VkQueryPool queryPool,
@@ -1027,7 +1042,7 @@ void encode_vkCmdWriteTimestamp(
 ;
 
 void encode_vkCmdCopyQueryPoolResults(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkQueryPool queryPool,
     uint32_t firstQuery,
@@ -1039,7 +1054,7 @@ void encode_vkCmdCopyQueryPoolResults(
 ;
 
 void encode_vkCmdPushConstants(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineLayout layout,
     VkShaderStageFlags stageFlags,
@@ -1049,25 +1064,25 @@ void encode_vkCmdPushConstants(
 ;
 
 void encode_vkCmdBeginRenderPass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkRenderPassBeginInfo* pRenderPassBegin,
     VkSubpassContents contents)
 ;
 
 void encode_vkCmdNextSubpass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkSubpassContents contents)
 ;
 
 void encode_vkCmdEndRenderPass(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 ;
 
 void encode_vkCmdExecuteCommands(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t commandBufferCount,
     const VkCommandBuffer* pCommandBuffers)
@@ -1078,26 +1093,26 @@ void encode_vkCmdExecuteCommands(
 #ifdef VK_VERSION_1_1
 
 VkResult encode_vkEnumerateInstanceVersion(
-    void* vkStream,
+    VulkanStream* vkStream,
     uint32_t* pApiVersion)
 ;
 
 VkResult encode_vkBindBufferMemory2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t bindInfoCount,
     const VkBindBufferMemoryInfo* pBindInfos)
 ;
 
 VkResult encode_vkBindImageMemory2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t bindInfoCount,
     const VkBindImageMemoryInfo* pBindInfos)
 ;
 
 void encode_vkGetDeviceGroupPeerMemoryFeatures(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t heapIndex,
     uint32_t localDeviceIndex,
@@ -1106,13 +1121,13 @@ void encode_vkGetDeviceGroupPeerMemoryFeatures(
 ;
 
 void encode_vkCmdSetDeviceMask(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t deviceMask)
 ;
 
 void encode_vkCmdDispatchBase(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t baseGroupX,
     uint32_t baseGroupY,
@@ -1123,28 +1138,28 @@ void encode_vkCmdDispatchBase(
 ;
 
 VkResult encode_vkEnumeratePhysicalDeviceGroups(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     uint32_t* pPhysicalDeviceGroupCount,
     VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties)
 ;
 
 void encode_vkGetImageMemoryRequirements2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageMemoryRequirementsInfo2* pInfo,
     VkMemoryRequirements2* pMemoryRequirements)
 ;
 
 void encode_vkGetBufferMemoryRequirements2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkBufferMemoryRequirementsInfo2* pInfo,
     VkMemoryRequirements2* pMemoryRequirements)
 ;
 
 void encode_vkGetImageSparseMemoryRequirements2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageSparseMemoryRequirementsInfo2* pInfo,
     uint32_t* pSparseMemoryRequirementCount,
@@ -1152,46 +1167,46 @@ void encode_vkGetImageSparseMemoryRequirements2(
 ;
 
 void encode_vkGetPhysicalDeviceFeatures2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceFeatures2* pFeatures)
 ;
 
 void encode_vkGetPhysicalDeviceProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceProperties2* pProperties)
 ;
 
 void encode_vkGetPhysicalDeviceFormatProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkFormatProperties2* pFormatProperties)
 ;
 
 VkResult encode_vkGetPhysicalDeviceImageFormatProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo,
     VkImageFormatProperties2* pImageFormatProperties)
 ;
 
 void encode_vkGetPhysicalDeviceQueueFamilyProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pQueueFamilyPropertyCount,
     VkQueueFamilyProperties2* pQueueFamilyProperties)
 ;
 
 void encode_vkGetPhysicalDeviceMemoryProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceMemoryProperties2* pMemoryProperties)
 ;
 
 void encode_vkGetPhysicalDeviceSparseImageFormatProperties2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo,
     uint32_t* pPropertyCount,
@@ -1199,21 +1214,21 @@ void encode_vkGetPhysicalDeviceSparseImageFormatProperties2(
 ;
 
 void encode_vkTrimCommandPool(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     VkCommandPoolTrimFlags flags)
 ;
 
 void encode_vkGetDeviceQueue2(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDeviceQueueInfo2* pQueueInfo,
     VkQueue* pQueue)
 ;
 
 VkResult encode_vkCreateSamplerYcbcrConversion(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSamplerYcbcrConversionCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1221,14 +1236,14 @@ VkResult encode_vkCreateSamplerYcbcrConversion(
 ;
 
 void encode_vkDestroySamplerYcbcrConversion(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSamplerYcbcrConversion ycbcrConversion,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateDescriptorUpdateTemplate(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1236,14 +1251,14 @@ VkResult encode_vkCreateDescriptorUpdateTemplate(
 ;
 
 void encode_vkDestroyDescriptorUpdateTemplate(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 void encode_vkUpdateDescriptorSetWithTemplate(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorSet descriptorSet,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
@@ -1251,28 +1266,28 @@ void encode_vkUpdateDescriptorSetWithTemplate(
 ;
 
 void encode_vkGetPhysicalDeviceExternalBufferProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo,
     VkExternalBufferProperties* pExternalBufferProperties)
 ;
 
 void encode_vkGetPhysicalDeviceExternalFenceProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo,
     VkExternalFenceProperties* pExternalFenceProperties)
 ;
 
 void encode_vkGetPhysicalDeviceExternalSemaphoreProperties(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo,
     VkExternalSemaphoreProperties* pExternalSemaphoreProperties)
 ;
 
 void encode_vkGetDescriptorSetLayoutSupport(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
     VkDescriptorSetLayoutSupport* pSupport)
@@ -1283,14 +1298,14 @@ void encode_vkGetDescriptorSetLayoutSupport(
 #ifdef VK_KHR_surface
 
 void encode_vkDestroySurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkSurfaceKHR surface,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkGetPhysicalDeviceSurfaceSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     VkSurfaceKHR surface,
@@ -1298,14 +1313,14 @@ VkResult encode_vkGetPhysicalDeviceSurfaceSupportKHR(
 ;
 
 VkResult encode_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
 ;
 
 VkResult encode_vkGetPhysicalDeviceSurfaceFormatsKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     uint32_t* pSurfaceFormatCount,
@@ -1313,7 +1328,7 @@ VkResult encode_vkGetPhysicalDeviceSurfaceFormatsKHR(
 ;
 
 VkResult encode_vkGetPhysicalDeviceSurfacePresentModesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     uint32_t* pPresentModeCount,
@@ -1325,7 +1340,7 @@ VkResult encode_vkGetPhysicalDeviceSurfacePresentModesKHR(
 #ifdef VK_KHR_swapchain
 
 VkResult encode_vkCreateSwapchainKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSwapchainCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1333,14 +1348,14 @@ VkResult encode_vkCreateSwapchainKHR(
 ;
 
 void encode_vkDestroySwapchainKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkGetSwapchainImagesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     uint32_t* pSwapchainImageCount,
@@ -1348,7 +1363,7 @@ VkResult encode_vkGetSwapchainImagesKHR(
 ;
 
 VkResult encode_vkAcquireNextImageKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     uint64_t timeout,
@@ -1358,26 +1373,26 @@ VkResult encode_vkAcquireNextImageKHR(
 ;
 
 VkResult encode_vkQueuePresentKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     const VkPresentInfoKHR* pPresentInfo)
 ;
 
 VkResult encode_vkGetDeviceGroupPresentCapabilitiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities)
 ;
 
 VkResult encode_vkGetDeviceGroupSurfacePresentModesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSurfaceKHR surface,
     VkDeviceGroupPresentModeFlagsKHR* pModes)
 ;
 
 VkResult encode_vkGetPhysicalDevicePresentRectanglesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     uint32_t* pRectCount,
@@ -1385,7 +1400,7 @@ VkResult encode_vkGetPhysicalDevicePresentRectanglesKHR(
 ;
 
 VkResult encode_vkAcquireNextImage2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkAcquireNextImageInfoKHR* pAcquireInfo,
     uint32_t* pImageIndex)
@@ -1396,21 +1411,21 @@ VkResult encode_vkAcquireNextImage2KHR(
 #ifdef VK_KHR_display
 
 VkResult encode_vkGetPhysicalDeviceDisplayPropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkDisplayPropertiesKHR* pProperties)
 ;
 
 VkResult encode_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkDisplayPlanePropertiesKHR* pProperties)
 ;
 
 VkResult encode_vkGetDisplayPlaneSupportedDisplaysKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t planeIndex,
     uint32_t* pDisplayCount,
@@ -1418,7 +1433,7 @@ VkResult encode_vkGetDisplayPlaneSupportedDisplaysKHR(
 ;
 
 VkResult encode_vkGetDisplayModePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayKHR display,
     uint32_t* pPropertyCount,
@@ -1426,7 +1441,7 @@ VkResult encode_vkGetDisplayModePropertiesKHR(
 ;
 
 VkResult encode_vkCreateDisplayModeKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayKHR display,
     const VkDisplayModeCreateInfoKHR* pCreateInfo,
@@ -1435,7 +1450,7 @@ VkResult encode_vkCreateDisplayModeKHR(
 ;
 
 VkResult encode_vkGetDisplayPlaneCapabilitiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayModeKHR mode,
     uint32_t planeIndex,
@@ -1443,7 +1458,7 @@ VkResult encode_vkGetDisplayPlaneCapabilitiesKHR(
 ;
 
 VkResult encode_vkCreateDisplayPlaneSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkDisplaySurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1455,7 +1470,7 @@ VkResult encode_vkCreateDisplayPlaneSurfaceKHR(
 #ifdef VK_KHR_display_swapchain
 
 VkResult encode_vkCreateSharedSwapchainsKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t swapchainCount,
     const VkSwapchainCreateInfoKHR* pCreateInfos,
@@ -1468,7 +1483,7 @@ VkResult encode_vkCreateSharedSwapchainsKHR(
 #ifdef VK_KHR_xlib_surface
 
 VkResult encode_vkCreateXlibSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkXlibSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1476,7 +1491,7 @@ VkResult encode_vkCreateXlibSurfaceKHR(
 ;
 
 VkBool32 encode_vkGetPhysicalDeviceXlibPresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     Display* dpy,
@@ -1488,7 +1503,7 @@ VkBool32 encode_vkGetPhysicalDeviceXlibPresentationSupportKHR(
 #ifdef VK_KHR_xcb_surface
 
 VkResult encode_vkCreateXcbSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkXcbSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1496,7 +1511,7 @@ VkResult encode_vkCreateXcbSurfaceKHR(
 ;
 
 VkBool32 encode_vkGetPhysicalDeviceXcbPresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     xcb_connection_t* connection,
@@ -1508,7 +1523,7 @@ VkBool32 encode_vkGetPhysicalDeviceXcbPresentationSupportKHR(
 #ifdef VK_KHR_wayland_surface
 
 VkResult encode_vkCreateWaylandSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkWaylandSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1516,7 +1531,7 @@ VkResult encode_vkCreateWaylandSurfaceKHR(
 ;
 
 VkBool32 encode_vkGetPhysicalDeviceWaylandPresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     struct wl_display* display)
@@ -1527,7 +1542,7 @@ VkBool32 encode_vkGetPhysicalDeviceWaylandPresentationSupportKHR(
 #ifdef VK_KHR_mir_surface
 
 VkResult encode_vkCreateMirSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkMirSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1535,7 +1550,7 @@ VkResult encode_vkCreateMirSurfaceKHR(
 ;
 
 VkBool32 encode_vkGetPhysicalDeviceMirPresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex,
     MirConnection* connection)
@@ -1546,7 +1561,7 @@ VkBool32 encode_vkGetPhysicalDeviceMirPresentationSupportKHR(
 #ifdef VK_KHR_android_surface
 
 VkResult encode_vkCreateAndroidSurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkAndroidSurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1558,7 +1573,7 @@ VkResult encode_vkCreateAndroidSurfaceKHR(
 #ifdef VK_KHR_win32_surface
 
 VkResult encode_vkCreateWin32SurfaceKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkWin32SurfaceCreateInfoKHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1566,7 +1581,7 @@ VkResult encode_vkCreateWin32SurfaceKHR(
 ;
 
 VkBool32 encode_vkGetPhysicalDeviceWin32PresentationSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t queueFamilyIndex)
 ;
@@ -1584,46 +1599,46 @@ VkBool32 encode_vkGetPhysicalDeviceWin32PresentationSupportKHR(
 #ifdef VK_KHR_get_physical_device_properties2
 
 void encode_vkGetPhysicalDeviceFeatures2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceFeatures2* pFeatures)
 ;
 
 void encode_vkGetPhysicalDeviceProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceProperties2* pProperties)
 ;
 
 void encode_vkGetPhysicalDeviceFormatProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkFormatProperties2* pFormatProperties)
 ;
 
 VkResult encode_vkGetPhysicalDeviceImageFormatProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo,
     VkImageFormatProperties2* pImageFormatProperties)
 ;
 
 void encode_vkGetPhysicalDeviceQueueFamilyProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pQueueFamilyPropertyCount,
     VkQueueFamilyProperties2* pQueueFamilyProperties)
 ;
 
 void encode_vkGetPhysicalDeviceMemoryProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkPhysicalDeviceMemoryProperties2* pMemoryProperties)
 ;
 
 void encode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo,
     uint32_t* pPropertyCount,
@@ -1635,7 +1650,7 @@ void encode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
 #ifdef VK_KHR_device_group
 
 void encode_vkGetDeviceGroupPeerMemoryFeaturesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t heapIndex,
     uint32_t localDeviceIndex,
@@ -1644,13 +1659,13 @@ void encode_vkGetDeviceGroupPeerMemoryFeaturesKHR(
 ;
 
 void encode_vkCmdSetDeviceMaskKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t deviceMask)
 ;
 
 void encode_vkCmdDispatchBaseKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t baseGroupX,
     uint32_t baseGroupY,
@@ -1669,7 +1684,7 @@ void encode_vkCmdDispatchBaseKHR(
 #ifdef VK_KHR_maintenance1
 
 void encode_vkTrimCommandPoolKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkCommandPool commandPool,
     VkCommandPoolTrimFlags flags)
@@ -1680,7 +1695,7 @@ void encode_vkTrimCommandPoolKHR(
 #ifdef VK_KHR_device_group_creation
 
 VkResult encode_vkEnumeratePhysicalDeviceGroupsKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     uint32_t* pPhysicalDeviceGroupCount,
     VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties)
@@ -1691,7 +1706,7 @@ VkResult encode_vkEnumeratePhysicalDeviceGroupsKHR(
 #ifdef VK_KHR_external_memory_capabilities
 
 void encode_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo,
     VkExternalBufferProperties* pExternalBufferProperties)
@@ -1706,14 +1721,14 @@ void encode_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
 #ifdef VK_KHR_external_memory_win32
 
 VkResult encode_vkGetMemoryWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkMemoryGetWin32HandleInfoKHR* pGetWin32HandleInfo,
     HANDLE* pHandle)
 ;
 
 VkResult encode_vkGetMemoryWin32HandlePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkExternalMemoryHandleTypeFlagBits handleType,
     HANDLE handle,
@@ -1725,14 +1740,14 @@ VkResult encode_vkGetMemoryWin32HandlePropertiesKHR(
 #ifdef VK_KHR_external_memory_fd
 
 VkResult encode_vkGetMemoryFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkMemoryGetFdInfoKHR* pGetFdInfo,
     int* pFd)
 ;
 
 VkResult encode_vkGetMemoryFdPropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkExternalMemoryHandleTypeFlagBits handleType,
     int fd,
@@ -1748,7 +1763,7 @@ VkResult encode_vkGetMemoryFdPropertiesKHR(
 #ifdef VK_KHR_external_semaphore_capabilities
 
 void encode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo,
     VkExternalSemaphoreProperties* pExternalSemaphoreProperties)
@@ -1763,13 +1778,13 @@ void encode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
 #ifdef VK_KHR_external_semaphore_win32
 
 VkResult encode_vkImportSemaphoreWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImportSemaphoreWin32HandleInfoKHR* pImportSemaphoreWin32HandleInfo)
 ;
 
 VkResult encode_vkGetSemaphoreWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSemaphoreGetWin32HandleInfoKHR* pGetWin32HandleInfo,
     HANDLE* pHandle)
@@ -1780,13 +1795,13 @@ VkResult encode_vkGetSemaphoreWin32HandleKHR(
 #ifdef VK_KHR_external_semaphore_fd
 
 VkResult encode_vkImportSemaphoreFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo)
 ;
 
 VkResult encode_vkGetSemaphoreFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSemaphoreGetFdInfoKHR* pGetFdInfo,
     int* pFd)
@@ -1797,7 +1812,7 @@ VkResult encode_vkGetSemaphoreFdKHR(
 #ifdef VK_KHR_push_descriptor
 
 void encode_vkCmdPushDescriptorSetKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineBindPoint pipelineBindPoint,
     VkPipelineLayout layout,
@@ -1807,7 +1822,7 @@ void encode_vkCmdPushDescriptorSetKHR(
 ;
 
 void encode_vkCmdPushDescriptorSetWithTemplateKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
     VkPipelineLayout layout,
@@ -1828,7 +1843,7 @@ void encode_vkCmdPushDescriptorSetWithTemplateKHR(
 #ifdef VK_KHR_descriptor_update_template
 
 VkResult encode_vkCreateDescriptorUpdateTemplateKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1836,14 +1851,14 @@ VkResult encode_vkCreateDescriptorUpdateTemplateKHR(
 ;
 
 void encode_vkDestroyDescriptorUpdateTemplateKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 void encode_vkUpdateDescriptorSetWithTemplateKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDescriptorSet descriptorSet,
     VkDescriptorUpdateTemplate descriptorUpdateTemplate,
@@ -1855,7 +1870,7 @@ void encode_vkUpdateDescriptorSetWithTemplateKHR(
 #ifdef VK_KHR_create_renderpass2
 
 VkResult encode_vkCreateRenderPass2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkRenderPassCreateInfo2KHR* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -1863,21 +1878,21 @@ VkResult encode_vkCreateRenderPass2KHR(
 ;
 
 void encode_vkCmdBeginRenderPass2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkRenderPassBeginInfo*      pRenderPassBegin,
     const VkSubpassBeginInfoKHR*      pSubpassBeginInfo)
 ;
 
 void encode_vkCmdNextSubpass2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkSubpassBeginInfoKHR*      pSubpassBeginInfo,
     const VkSubpassEndInfoKHR*        pSubpassEndInfo)
 ;
 
 void encode_vkCmdEndRenderPass2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkSubpassEndInfoKHR*        pSubpassEndInfo)
 ;
@@ -1887,7 +1902,7 @@ void encode_vkCmdEndRenderPass2KHR(
 #ifdef VK_KHR_shared_presentable_image
 
 VkResult encode_vkGetSwapchainStatusKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain)
 ;
@@ -1897,7 +1912,7 @@ VkResult encode_vkGetSwapchainStatusKHR(
 #ifdef VK_KHR_external_fence_capabilities
 
 void encode_vkGetPhysicalDeviceExternalFencePropertiesKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo,
     VkExternalFenceProperties* pExternalFenceProperties)
@@ -1912,13 +1927,13 @@ void encode_vkGetPhysicalDeviceExternalFencePropertiesKHR(
 #ifdef VK_KHR_external_fence_win32
 
 VkResult encode_vkImportFenceWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImportFenceWin32HandleInfoKHR* pImportFenceWin32HandleInfo)
 ;
 
 VkResult encode_vkGetFenceWin32HandleKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkFenceGetWin32HandleInfoKHR* pGetWin32HandleInfo,
     HANDLE* pHandle)
@@ -1929,13 +1944,13 @@ VkResult encode_vkGetFenceWin32HandleKHR(
 #ifdef VK_KHR_external_fence_fd
 
 VkResult encode_vkImportFenceFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImportFenceFdInfoKHR* pImportFenceFdInfo)
 ;
 
 VkResult encode_vkGetFenceFdKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkFenceGetFdInfoKHR* pGetFdInfo,
     int* pFd)
@@ -1950,14 +1965,14 @@ VkResult encode_vkGetFenceFdKHR(
 #ifdef VK_KHR_get_surface_capabilities2
 
 VkResult encode_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo,
     VkSurfaceCapabilities2KHR* pSurfaceCapabilities)
 ;
 
 VkResult encode_vkGetPhysicalDeviceSurfaceFormats2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo,
     uint32_t* pSurfaceFormatCount,
@@ -1973,21 +1988,21 @@ VkResult encode_vkGetPhysicalDeviceSurfaceFormats2KHR(
 #ifdef VK_KHR_get_display_properties2
 
 VkResult encode_vkGetPhysicalDeviceDisplayProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkDisplayProperties2KHR* pProperties)
 ;
 
 VkResult encode_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     uint32_t* pPropertyCount,
     VkDisplayPlaneProperties2KHR* pProperties)
 ;
 
 VkResult encode_vkGetDisplayModeProperties2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayKHR display,
     uint32_t* pPropertyCount,
@@ -1995,7 +2010,7 @@ VkResult encode_vkGetDisplayModeProperties2KHR(
 ;
 
 VkResult encode_vkGetDisplayPlaneCapabilities2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     const VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo,
     VkDisplayPlaneCapabilities2KHR* pCapabilities)
@@ -2018,21 +2033,21 @@ VkResult encode_vkGetDisplayPlaneCapabilities2KHR(
 #ifdef VK_KHR_get_memory_requirements2
 
 void encode_vkGetImageMemoryRequirements2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageMemoryRequirementsInfo2* pInfo,
     VkMemoryRequirements2* pMemoryRequirements)
 ;
 
 void encode_vkGetBufferMemoryRequirements2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkBufferMemoryRequirementsInfo2* pInfo,
     VkMemoryRequirements2* pMemoryRequirements)
 ;
 
 void encode_vkGetImageSparseMemoryRequirements2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkImageSparseMemoryRequirementsInfo2* pInfo,
     uint32_t* pSparseMemoryRequirementCount,
@@ -2048,7 +2063,7 @@ void encode_vkGetImageSparseMemoryRequirements2KHR(
 #ifdef VK_KHR_sampler_ycbcr_conversion
 
 VkResult encode_vkCreateSamplerYcbcrConversionKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkSamplerYcbcrConversionCreateInfo* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2056,7 +2071,7 @@ VkResult encode_vkCreateSamplerYcbcrConversionKHR(
 ;
 
 void encode_vkDestroySamplerYcbcrConversionKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSamplerYcbcrConversion ycbcrConversion,
     const VkAllocationCallbacks* pAllocator)
@@ -2067,14 +2082,14 @@ void encode_vkDestroySamplerYcbcrConversionKHR(
 #ifdef VK_KHR_bind_memory2
 
 VkResult encode_vkBindBufferMemory2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t bindInfoCount,
     const VkBindBufferMemoryInfo* pBindInfos)
 ;
 
 VkResult encode_vkBindImageMemory2KHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t bindInfoCount,
     const VkBindImageMemoryInfo* pBindInfos)
@@ -2085,7 +2100,7 @@ VkResult encode_vkBindImageMemory2KHR(
 #ifdef VK_KHR_maintenance3
 
 void encode_vkGetDescriptorSetLayoutSupportKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
     VkDescriptorSetLayoutSupport* pSupport)
@@ -2096,7 +2111,7 @@ void encode_vkGetDescriptorSetLayoutSupportKHR(
 #ifdef VK_KHR_draw_indirect_count
 
 void encode_vkCmdDrawIndirectCountKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -2107,7 +2122,7 @@ void encode_vkCmdDrawIndirectCountKHR(
 ;
 
 void encode_vkCmdDrawIndexedIndirectCountKHR(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -2126,7 +2141,7 @@ void encode_vkCmdDrawIndexedIndirectCountKHR(
 #ifdef VK_EXT_debug_report
 
 VkResult encode_vkCreateDebugReportCallbackEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkDebugReportCallbackCreateInfoEXT* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2134,14 +2149,14 @@ VkResult encode_vkCreateDebugReportCallbackEXT(
 ;
 
 void encode_vkDestroyDebugReportCallbackEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkDebugReportCallbackEXT callback,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 void encode_vkDebugReportMessageEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkDebugReportFlagsEXT flags,
     VkDebugReportObjectTypeEXT objectType,
@@ -2181,30 +2196,30 @@ void encode_vkDebugReportMessageEXT(
 #ifdef VK_EXT_debug_marker
 
 VkResult encode_vkDebugMarkerSetObjectTagEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDebugMarkerObjectTagInfoEXT* pTagInfo)
 ;
 
 VkResult encode_vkDebugMarkerSetObjectNameEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDebugMarkerObjectNameInfoEXT* pNameInfo)
 ;
 
 void encode_vkCmdDebugMarkerBeginEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
 ;
 
 void encode_vkCmdDebugMarkerEndEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 ;
 
 void encode_vkCmdDebugMarkerInsertEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkDebugMarkerMarkerInfoEXT* pMarkerInfo)
 ;
@@ -2222,7 +2237,7 @@ void encode_vkCmdDebugMarkerInsertEXT(
 #ifdef VK_AMD_draw_indirect_count
 
 void encode_vkCmdDrawIndirectCountAMD(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -2233,7 +2248,7 @@ void encode_vkCmdDrawIndirectCountAMD(
 ;
 
 void encode_vkCmdDrawIndexedIndirectCountAMD(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkBuffer buffer,
     VkDeviceSize offset,
@@ -2264,7 +2279,7 @@ void encode_vkCmdDrawIndexedIndirectCountAMD(
 #ifdef VK_AMD_shader_info
 
 VkResult encode_vkGetShaderInfoAMD(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkPipeline pipeline,
     VkShaderStageFlagBits shaderStage,
@@ -2286,7 +2301,7 @@ VkResult encode_vkGetShaderInfoAMD(
 #ifdef VK_NV_external_memory_capabilities
 
 VkResult encode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkFormat format,
     VkImageType type,
@@ -2306,7 +2321,7 @@ VkResult encode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
 #ifdef VK_NV_external_memory_win32
 
 VkResult encode_vkGetMemoryWin32HandleNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDeviceMemory memory,
     VkExternalMemoryHandleTypeFlagsNV handleType,
@@ -2326,7 +2341,7 @@ VkResult encode_vkGetMemoryWin32HandleNV(
 #ifdef VK_NN_vi_surface
 
 VkResult encode_vkCreateViSurfaceNN(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkViSurfaceCreateInfoNN* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2346,13 +2361,13 @@ VkResult encode_vkCreateViSurfaceNN(
 #ifdef VK_EXT_conditional_rendering
 
 void encode_vkCmdBeginConditionalRenderingEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin)
 ;
 
 void encode_vkCmdEndConditionalRenderingEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 ;
 
@@ -2361,19 +2376,19 @@ void encode_vkCmdEndConditionalRenderingEXT(
 #ifdef VK_NVX_device_generated_commands
 
 void encode_vkCmdProcessCommandsNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkCmdProcessCommandsInfoNVX* pProcessCommandsInfo)
 ;
 
 void encode_vkCmdReserveSpaceForCommandsNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkCmdReserveSpaceForCommandsInfoNVX* pReserveSpaceInfo)
 ;
 
 VkResult encode_vkCreateIndirectCommandsLayoutNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkIndirectCommandsLayoutCreateInfoNVX* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2381,14 +2396,14 @@ VkResult encode_vkCreateIndirectCommandsLayoutNVX(
 ;
 
 void encode_vkDestroyIndirectCommandsLayoutNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkIndirectCommandsLayoutNVX indirectCommandsLayout,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkCreateObjectTableNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkObjectTableCreateInfoNVX* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2396,14 +2411,14 @@ VkResult encode_vkCreateObjectTableNVX(
 ;
 
 void encode_vkDestroyObjectTableNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkObjectTableNVX objectTable,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkRegisterObjectsNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkObjectTableNVX objectTable,
     uint32_t objectCount,
@@ -2412,7 +2427,7 @@ VkResult encode_vkRegisterObjectsNVX(
 ;
 
 VkResult encode_vkUnregisterObjectsNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkObjectTableNVX objectTable,
     uint32_t objectCount,
@@ -2421,7 +2436,7 @@ VkResult encode_vkUnregisterObjectsNVX(
 ;
 
 void encode_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDeviceGeneratedCommandsFeaturesNVX* pFeatures,
     VkDeviceGeneratedCommandsLimitsNVX* pLimits)
@@ -2432,7 +2447,7 @@ void encode_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(
 #ifdef VK_NV_clip_space_w_scaling
 
 void encode_vkCmdSetViewportWScalingNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstViewport,
     uint32_t viewportCount,
@@ -2444,7 +2459,7 @@ void encode_vkCmdSetViewportWScalingNV(
 #ifdef VK_EXT_direct_mode_display
 
 VkResult encode_vkReleaseDisplayEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkDisplayKHR display)
 ;
@@ -2454,14 +2469,14 @@ VkResult encode_vkReleaseDisplayEXT(
 #ifdef VK_EXT_acquire_xlib_display
 
 VkResult encode_vkAcquireXlibDisplayEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     Display* dpy,
     VkDisplayKHR display)
 ;
 
 VkResult encode_vkGetRandROutputDisplayEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     Display* dpy,
     RROutput rrOutput,
@@ -2473,7 +2488,7 @@ VkResult encode_vkGetRandROutputDisplayEXT(
 #ifdef VK_EXT_display_surface_counter
 
 VkResult encode_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSurfaceKHR surface,
     VkSurfaceCapabilities2EXT* pSurfaceCapabilities)
@@ -2484,14 +2499,14 @@ VkResult encode_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
 #ifdef VK_EXT_display_control
 
 VkResult encode_vkDisplayPowerControlEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDisplayKHR display,
     const VkDisplayPowerInfoEXT* pDisplayPowerInfo)
 ;
 
 VkResult encode_vkRegisterDeviceEventEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDeviceEventInfoEXT* pDeviceEventInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2499,7 +2514,7 @@ VkResult encode_vkRegisterDeviceEventEXT(
 ;
 
 VkResult encode_vkRegisterDisplayEventEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkDisplayKHR display,
     const VkDisplayEventInfoEXT* pDisplayEventInfo,
@@ -2508,7 +2523,7 @@ VkResult encode_vkRegisterDisplayEventEXT(
 ;
 
 VkResult encode_vkGetSwapchainCounterEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     VkSurfaceCounterFlagBitsEXT counter,
@@ -2520,14 +2535,14 @@ VkResult encode_vkGetSwapchainCounterEXT(
 #ifdef VK_GOOGLE_display_timing
 
 VkResult encode_vkGetRefreshCycleDurationGOOGLE(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties)
 ;
 
 VkResult encode_vkGetPastPresentationTimingGOOGLE(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkSwapchainKHR swapchain,
     uint32_t* pPresentationTimingCount,
@@ -2559,7 +2574,7 @@ VkResult encode_vkGetPastPresentationTimingGOOGLE(
 #ifdef VK_EXT_discard_rectangles
 
 void encode_vkCmdSetDiscardRectangleEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     uint32_t firstDiscardRectangle,
     uint32_t discardRectangleCount,
@@ -2579,7 +2594,7 @@ void encode_vkCmdSetDiscardRectangleEXT(
 #ifdef VK_EXT_hdr_metadata
 
 void encode_vkSetHdrMetadataEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     uint32_t swapchainCount,
     const VkSwapchainKHR* pSwapchains,
@@ -2591,7 +2606,7 @@ void encode_vkSetHdrMetadataEXT(
 #ifdef VK_MVK_ios_surface
 
 VkResult encode_vkCreateIOSSurfaceMVK(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkIOSSurfaceCreateInfoMVK* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2603,7 +2618,7 @@ VkResult encode_vkCreateIOSSurfaceMVK(
 #ifdef VK_MVK_macos_surface
 
 VkResult encode_vkCreateMacOSSurfaceMVK(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkMacOSSurfaceCreateInfoMVK* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2623,53 +2638,53 @@ VkResult encode_vkCreateMacOSSurfaceMVK(
 #ifdef VK_EXT_debug_utils
 
 VkResult encode_vkSetDebugUtilsObjectNameEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDebugUtilsObjectNameInfoEXT* pNameInfo)
 ;
 
 VkResult encode_vkSetDebugUtilsObjectTagEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkDebugUtilsObjectTagInfoEXT* pTagInfo)
 ;
 
 void encode_vkQueueBeginDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     const VkDebugUtilsLabelEXT* pLabelInfo)
 ;
 
 void encode_vkQueueEndDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue)
 ;
 
 void encode_vkQueueInsertDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     const VkDebugUtilsLabelEXT* pLabelInfo)
 ;
 
 void encode_vkCmdBeginDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkDebugUtilsLabelEXT* pLabelInfo)
 ;
 
 void encode_vkCmdEndDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer)
 ;
 
 void encode_vkCmdInsertDebugUtilsLabelEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkDebugUtilsLabelEXT* pLabelInfo)
 ;
 
 VkResult encode_vkCreateDebugUtilsMessengerEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     const VkDebugUtilsMessengerCreateInfoEXT* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2677,14 +2692,14 @@ VkResult encode_vkCreateDebugUtilsMessengerEXT(
 ;
 
 void encode_vkDestroyDebugUtilsMessengerEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkDebugUtilsMessengerEXT messenger,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 void encode_vkSubmitDebugUtilsMessageEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkInstance instance,
     VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
     VkDebugUtilsMessageTypeFlagsEXT messageTypes,
@@ -2696,14 +2711,14 @@ void encode_vkSubmitDebugUtilsMessageEXT(
 #ifdef VK_ANDROID_external_memory_android_hardware_buffer
 
 VkResult encode_vkGetAndroidHardwareBufferPropertiesANDROID(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const struct AHardwareBuffer* buffer,
     VkAndroidHardwareBufferPropertiesANDROID* pProperties)
 ;
 
 VkResult encode_vkGetMemoryAndroidHardwareBufferANDROID(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo,
     struct AHardwareBuffer** pBuffer)
@@ -2734,13 +2749,13 @@ VkResult encode_vkGetMemoryAndroidHardwareBufferANDROID(
 #ifdef VK_EXT_sample_locations
 
 void encode_vkCmdSetSampleLocationsEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const VkSampleLocationsInfoEXT* pSampleLocationsInfo)
 ;
 
 void encode_vkGetPhysicalDeviceMultisamplePropertiesEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkPhysicalDevice physicalDevice,
     VkSampleCountFlagBits samples,
     VkMultisamplePropertiesEXT* pMultisampleProperties)
@@ -2771,7 +2786,7 @@ void encode_vkGetPhysicalDeviceMultisamplePropertiesEXT(
 #ifdef VK_EXT_validation_cache
 
 VkResult encode_vkCreateValidationCacheEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     const VkValidationCacheCreateInfoEXT* pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
@@ -2779,14 +2794,14 @@ VkResult encode_vkCreateValidationCacheEXT(
 ;
 
 void encode_vkDestroyValidationCacheEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkValidationCacheEXT validationCache,
     const VkAllocationCallbacks* pAllocator)
 ;
 
 VkResult encode_vkMergeValidationCachesEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkValidationCacheEXT dstCache,
     uint32_t srcCacheCount,
@@ -2794,7 +2809,7 @@ VkResult encode_vkMergeValidationCachesEXT(
 ;
 
 VkResult encode_vkGetValidationCacheDataEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkValidationCacheEXT validationCache,
     size_t* pDataSize,
@@ -2818,7 +2833,7 @@ VkResult encode_vkGetValidationCacheDataEXT(
 #ifdef VK_EXT_external_memory_host
 
 VkResult encode_vkGetMemoryHostPointerPropertiesEXT(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkDevice device,
     VkExternalMemoryHandleTypeFlagBits handleType,
     const void* pHostPointer,
@@ -2830,7 +2845,7 @@ VkResult encode_vkGetMemoryHostPointerPropertiesEXT(
 #ifdef VK_AMD_buffer_marker
 
 void encode_vkCmdWriteBufferMarkerAMD(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     VkPipelineStageFlagBits pipelineStage,
     VkBuffer dstBuffer,
@@ -2855,13 +2870,13 @@ void encode_vkCmdWriteBufferMarkerAMD(
 #ifdef VK_NV_device_diagnostic_checkpoints
 
 void encode_vkCmdSetCheckpointNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkCommandBuffer commandBuffer,
     const void* pCheckpointMarker)
 ;
 
 void encode_vkGetQueueCheckpointDataNV(
-    void* vkStream,
+    VulkanStream* vkStream,
     VkQueue queue,
     uint32_t* pCheckpointDataCount,
     VkCheckpointDataNV* pCheckpointData)
@@ -2869,3 +2884,6 @@ void encode_vkGetQueueCheckpointDataNV(
 
 #endif
 
+
+}  // namespace goldfish_vk
+
@@ -5,6 +5,16 @@
 
 #include "goldfish_vk_encoder.h"
 
+using goldfish_vk::VulkanStream;
+using namespace goldfish_vk;
+
+static VulkanStream* (*sGetVulkanStream)() = nullptr;
+
+void goldfish_vk_set_stream_accessor(VulkanStream* (*getStream)())
+{
+    sGetVulkanStream = getStream;
+}
+
 #ifdef VK_VERSION_1_0
 
 static void validate_vkCreateInstance(
@@ -27,8 +37,7 @@ VkResult goldfish_frontend_vkCreateInstance(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateInstance(vkStream, pCreateInfo, pAllocator, pInstance);
     return res;
 }
@@ -51,8 +60,7 @@ void goldfish_frontend_vkDestroyInstance(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyInstance(vkStream, instance, pAllocator);
 }
 
@@ -76,8 +84,7 @@ VkResult goldfish_frontend_vkEnumeratePhysicalDevices(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkEnumeratePhysicalDevices(vkStream, instance, pPhysicalDeviceCount, pPhysicalDevices);
     return res;
 }
@@ -100,8 +107,7 @@ void goldfish_frontend_vkGetPhysicalDeviceFeatures(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceFeatures(vkStream, physicalDevice, pFeatures);
 }
 
@@ -125,8 +131,7 @@ void goldfish_frontend_vkGetPhysicalDeviceFormatProperties(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceFormatProperties(vkStream, physicalDevice, format, pFormatProperties);
 }
 
@@ -158,8 +163,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceImageFormatProperties(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceImageFormatProperties(vkStream, physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
     return res;
 }
@@ -182,8 +186,7 @@ void goldfish_frontend_vkGetPhysicalDeviceProperties(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceProperties(vkStream, physicalDevice, pProperties);
 }
 
@@ -207,8 +210,7 @@ void goldfish_frontend_vkGetPhysicalDeviceQueueFamilyProperties(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceQueueFamilyProperties(vkStream, physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
 }
 
@@ -230,8 +232,7 @@ void goldfish_frontend_vkGetPhysicalDeviceMemoryProperties(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceMemoryProperties(vkStream, physicalDevice, pMemoryProperties);
 }
 
@@ -253,8 +254,7 @@ PFN_vkVoidFunction goldfish_frontend_vkGetInstanceProcAddr(
     {
         return (PFN_vkVoidFunction)0;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     PFN_vkVoidFunction res = encode_vkGetInstanceProcAddr(vkStream, instance, pName);
     return res;
 }
@@ -277,8 +277,7 @@ PFN_vkVoidFunction goldfish_frontend_vkGetDeviceProcAddr(
     {
         return (PFN_vkVoidFunction)0;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     PFN_vkVoidFunction res = encode_vkGetDeviceProcAddr(vkStream, device, pName);
     return res;
 }
@@ -305,8 +304,7 @@ VkResult goldfish_frontend_vkCreateDevice(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateDevice(vkStream, physicalDevice, pCreateInfo, pAllocator, pDevice);
     return res;
 }
@@ -329,8 +327,7 @@ void goldfish_frontend_vkDestroyDevice(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyDevice(vkStream, device, pAllocator);
 }
 
@@ -354,8 +351,7 @@ VkResult goldfish_frontend_vkEnumerateInstanceExtensionProperties(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkEnumerateInstanceExtensionProperties(vkStream, pLayerName, pPropertyCount, pProperties);
     return res;
 }
@@ -382,8 +378,7 @@ VkResult goldfish_frontend_vkEnumerateDeviceExtensionProperties(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkEnumerateDeviceExtensionProperties(vkStream, physicalDevice, pLayerName, pPropertyCount, pProperties);
     return res;
 }
@@ -406,8 +401,7 @@ VkResult goldfish_frontend_vkEnumerateInstanceLayerProperties(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkEnumerateInstanceLayerProperties(vkStream, pPropertyCount, pProperties);
     return res;
 }
@@ -432,8 +426,7 @@ VkResult goldfish_frontend_vkEnumerateDeviceLayerProperties(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkEnumerateDeviceLayerProperties(vkStream, physicalDevice, pPropertyCount, pProperties);
     return res;
 }
@@ -460,8 +453,7 @@ void goldfish_frontend_vkGetDeviceQueue(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetDeviceQueue(vkStream, device, queueFamilyIndex, queueIndex, pQueue);
 }
 
@@ -487,8 +479,7 @@ VkResult goldfish_frontend_vkQueueSubmit(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkQueueSubmit(vkStream, queue, submitCount, pSubmits, fence);
     return res;
 }
@@ -509,8 +500,7 @@ VkResult goldfish_frontend_vkQueueWaitIdle(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkQueueWaitIdle(vkStream, queue);
     return res;
 }
@@ -531,8 +521,7 @@ VkResult goldfish_frontend_vkDeviceWaitIdle(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkDeviceWaitIdle(vkStream, device);
     return res;
 }
@@ -559,8 +548,7 @@ VkResult goldfish_frontend_vkAllocateMemory(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkAllocateMemory(vkStream, device, pAllocateInfo, pAllocator, pMemory);
     return res;
 }
@@ -585,8 +573,7 @@ void goldfish_frontend_vkFreeMemory(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkFreeMemory(vkStream, device, memory, pAllocator);
 }
 
@@ -616,8 +603,7 @@ VkResult goldfish_frontend_vkMapMemory(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkMapMemory(vkStream, device, memory, offset, size, flags, ppData);
     return res;
 }
@@ -640,8 +626,7 @@ void goldfish_frontend_vkUnmapMemory(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkUnmapMemory(vkStream, device, memory);
 }
 
@@ -665,8 +650,7 @@ VkResult goldfish_frontend_vkFlushMappedMemoryRanges(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkFlushMappedMemoryRanges(vkStream, device, memoryRangeCount, pMemoryRanges);
     return res;
 }
@@ -691,8 +675,7 @@ VkResult goldfish_frontend_vkInvalidateMappedMemoryRanges(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkInvalidateMappedMemoryRanges(vkStream, device, memoryRangeCount, pMemoryRanges);
     return res;
 }
@@ -717,8 +700,7 @@ void goldfish_frontend_vkGetDeviceMemoryCommitment(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetDeviceMemoryCommitment(vkStream, device, memory, pCommittedMemoryInBytes);
 }
 
@@ -744,8 +726,7 @@ VkResult goldfish_frontend_vkBindBufferMemory(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkBindBufferMemory(vkStream, device, buffer, memory, memoryOffset);
     return res;
 }
@@ -772,8 +753,7 @@ VkResult goldfish_frontend_vkBindImageMemory(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkBindImageMemory(vkStream, device, image, memory, memoryOffset);
     return res;
 }
@@ -798,8 +778,7 @@ void goldfish_frontend_vkGetBufferMemoryRequirements(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetBufferMemoryRequirements(vkStream, device, buffer, pMemoryRequirements);
 }
 
@@ -823,8 +802,7 @@ void goldfish_frontend_vkGetImageMemoryRequirements(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetImageMemoryRequirements(vkStream, device, image, pMemoryRequirements);
 }
 
@@ -850,8 +828,7 @@ void goldfish_frontend_vkGetImageSparseMemoryRequirements(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetImageSparseMemoryRequirements(vkStream, device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
 }
 
@@ -885,8 +862,7 @@ void goldfish_frontend_vkGetPhysicalDeviceSparseImageFormatProperties(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceSparseImageFormatProperties(vkStream, physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
 }
 
@@ -912,8 +888,7 @@ VkResult goldfish_frontend_vkQueueBindSparse(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkQueueBindSparse(vkStream, queue, bindInfoCount, pBindInfo, fence);
     return res;
 }
@@ -940,8 +915,7 @@ VkResult goldfish_frontend_vkCreateFence(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateFence(vkStream, device, pCreateInfo, pAllocator, pFence);
     return res;
 }
@@ -966,8 +940,7 @@ void goldfish_frontend_vkDestroyFence(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyFence(vkStream, device, fence, pAllocator);
 }
 
@@ -991,8 +964,7 @@ VkResult goldfish_frontend_vkResetFences(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkResetFences(vkStream, device, fenceCount, pFences);
     return res;
 }
@@ -1015,8 +987,7 @@ VkResult goldfish_frontend_vkGetFenceStatus(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetFenceStatus(vkStream, device, fence);
     return res;
 }
@@ -1045,8 +1016,7 @@ VkResult goldfish_frontend_vkWaitForFences(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkWaitForFences(vkStream, device, fenceCount, pFences, waitAll, timeout);
     return res;
 }
@@ -1073,8 +1043,7 @@ VkResult goldfish_frontend_vkCreateSemaphore(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateSemaphore(vkStream, device, pCreateInfo, pAllocator, pSemaphore);
     return res;
 }
@@ -1099,8 +1068,7 @@ void goldfish_frontend_vkDestroySemaphore(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroySemaphore(vkStream, device, semaphore, pAllocator);
 }
 
@@ -1126,8 +1094,7 @@ VkResult goldfish_frontend_vkCreateEvent(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateEvent(vkStream, device, pCreateInfo, pAllocator, pEvent);
     return res;
 }
@@ -1152,8 +1119,7 @@ void goldfish_frontend_vkDestroyEvent(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyEvent(vkStream, device, event, pAllocator);
 }
 
@@ -1175,8 +1141,7 @@ VkResult goldfish_frontend_vkGetEventStatus(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetEventStatus(vkStream, device, event);
     return res;
 }
@@ -1199,8 +1164,7 @@ VkResult goldfish_frontend_vkSetEvent(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkSetEvent(vkStream, device, event);
     return res;
 }
@@ -1223,8 +1187,7 @@ VkResult goldfish_frontend_vkResetEvent(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkResetEvent(vkStream, device, event);
     return res;
 }
@@ -1251,8 +1214,7 @@ VkResult goldfish_frontend_vkCreateQueryPool(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateQueryPool(vkStream, device, pCreateInfo, pAllocator, pQueryPool);
     return res;
 }
@@ -1277,8 +1239,7 @@ void goldfish_frontend_vkDestroyQueryPool(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyQueryPool(vkStream, device, queryPool, pAllocator);
 }
 
@@ -1312,8 +1273,7 @@ VkResult goldfish_frontend_vkGetQueryPoolResults(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetQueryPoolResults(vkStream, device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
     return res;
 }
@@ -1340,8 +1300,7 @@ VkResult goldfish_frontend_vkCreateBuffer(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateBuffer(vkStream, device, pCreateInfo, pAllocator, pBuffer);
     return res;
 }
@@ -1366,8 +1325,7 @@ void goldfish_frontend_vkDestroyBuffer(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyBuffer(vkStream, device, buffer, pAllocator);
 }
 
@@ -1393,8 +1351,7 @@ VkResult goldfish_frontend_vkCreateBufferView(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateBufferView(vkStream, device, pCreateInfo, pAllocator, pView);
     return res;
 }
@@ -1419,8 +1376,7 @@ void goldfish_frontend_vkDestroyBufferView(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyBufferView(vkStream, device, bufferView, pAllocator);
 }
 
@@ -1446,8 +1402,7 @@ VkResult goldfish_frontend_vkCreateImage(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateImage(vkStream, device, pCreateInfo, pAllocator, pImage);
     return res;
 }
@@ -1472,8 +1427,7 @@ void goldfish_frontend_vkDestroyImage(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyImage(vkStream, device, image, pAllocator);
 }
 
@@ -1499,8 +1453,7 @@ void goldfish_frontend_vkGetImageSubresourceLayout(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetImageSubresourceLayout(vkStream, device, image, pSubresource, pLayout);
 }
 
@@ -1526,8 +1479,7 @@ VkResult goldfish_frontend_vkCreateImageView(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateImageView(vkStream, device, pCreateInfo, pAllocator, pView);
     return res;
 }
@@ -1552,8 +1504,7 @@ void goldfish_frontend_vkDestroyImageView(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyImageView(vkStream, device, imageView, pAllocator);
 }
 
@@ -1579,8 +1530,7 @@ VkResult goldfish_frontend_vkCreateShaderModule(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateShaderModule(vkStream, device, pCreateInfo, pAllocator, pShaderModule);
     return res;
 }
@@ -1605,8 +1555,7 @@ void goldfish_frontend_vkDestroyShaderModule(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyShaderModule(vkStream, device, shaderModule, pAllocator);
 }
 
@@ -1632,8 +1581,7 @@ VkResult goldfish_frontend_vkCreatePipelineCache(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreatePipelineCache(vkStream, device, pCreateInfo, pAllocator, pPipelineCache);
     return res;
 }
@@ -1658,8 +1606,7 @@ void goldfish_frontend_vkDestroyPipelineCache(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyPipelineCache(vkStream, device, pipelineCache, pAllocator);
 }
 
@@ -1685,8 +1632,7 @@ VkResult goldfish_frontend_vkGetPipelineCacheData(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPipelineCacheData(vkStream, device, pipelineCache, pDataSize, pData);
     return res;
 }
@@ -1713,8 +1659,7 @@ VkResult goldfish_frontend_vkMergePipelineCaches(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkMergePipelineCaches(vkStream, device, dstCache, srcCacheCount, pSrcCaches);
     return res;
 }
@@ -1745,8 +1690,7 @@ VkResult goldfish_frontend_vkCreateGraphicsPipelines(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateGraphicsPipelines(vkStream, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
     return res;
 }
@@ -1777,8 +1721,7 @@ VkResult goldfish_frontend_vkCreateComputePipelines(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateComputePipelines(vkStream, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
     return res;
 }
@@ -1803,8 +1746,7 @@ void goldfish_frontend_vkDestroyPipeline(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyPipeline(vkStream, device, pipeline, pAllocator);
 }
 
@@ -1830,8 +1772,7 @@ VkResult goldfish_frontend_vkCreatePipelineLayout(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreatePipelineLayout(vkStream, device, pCreateInfo, pAllocator, pPipelineLayout);
     return res;
 }
@@ -1856,8 +1797,7 @@ void goldfish_frontend_vkDestroyPipelineLayout(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyPipelineLayout(vkStream, device, pipelineLayout, pAllocator);
 }
 
@@ -1883,8 +1823,7 @@ VkResult goldfish_frontend_vkCreateSampler(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateSampler(vkStream, device, pCreateInfo, pAllocator, pSampler);
     return res;
 }
@@ -1909,8 +1848,7 @@ void goldfish_frontend_vkDestroySampler(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroySampler(vkStream, device, sampler, pAllocator);
 }
 
@@ -1936,8 +1874,7 @@ VkResult goldfish_frontend_vkCreateDescriptorSetLayout(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateDescriptorSetLayout(vkStream, device, pCreateInfo, pAllocator, pSetLayout);
     return res;
 }
@@ -1962,8 +1899,7 @@ void goldfish_frontend_vkDestroyDescriptorSetLayout(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyDescriptorSetLayout(vkStream, device, descriptorSetLayout, pAllocator);
 }
 
@@ -1989,8 +1925,7 @@ VkResult goldfish_frontend_vkCreateDescriptorPool(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateDescriptorPool(vkStream, device, pCreateInfo, pAllocator, pDescriptorPool);
     return res;
 }
@@ -2015,8 +1950,7 @@ void goldfish_frontend_vkDestroyDescriptorPool(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyDescriptorPool(vkStream, device, descriptorPool, pAllocator);
 }
 
@@ -2040,8 +1974,7 @@ VkResult goldfish_frontend_vkResetDescriptorPool(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkResetDescriptorPool(vkStream, device, descriptorPool, flags);
     return res;
 }
@@ -2066,8 +1999,7 @@ VkResult goldfish_frontend_vkAllocateDescriptorSets(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkAllocateDescriptorSets(vkStream, device, pAllocateInfo, pDescriptorSets);
     return res;
 }
@@ -2094,8 +2026,7 @@ VkResult goldfish_frontend_vkFreeDescriptorSets(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkFreeDescriptorSets(vkStream, device, descriptorPool, descriptorSetCount, pDescriptorSets);
     return res;
 }
@@ -2124,8 +2055,7 @@ void goldfish_frontend_vkUpdateDescriptorSets(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkUpdateDescriptorSets(vkStream, device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
@@ -2151,8 +2081,7 @@ VkResult goldfish_frontend_vkCreateFramebuffer(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateFramebuffer(vkStream, device, pCreateInfo, pAllocator, pFramebuffer);
     return res;
 }
@@ -2177,8 +2106,7 @@ void goldfish_frontend_vkDestroyFramebuffer(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyFramebuffer(vkStream, device, framebuffer, pAllocator);
 }
 
@@ -2204,8 +2132,7 @@ VkResult goldfish_frontend_vkCreateRenderPass(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateRenderPass(vkStream, device, pCreateInfo, pAllocator, pRenderPass);
     return res;
 }
@@ -2230,8 +2157,7 @@ void goldfish_frontend_vkDestroyRenderPass(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyRenderPass(vkStream, device, renderPass, pAllocator);
 }
 
@@ -2255,8 +2181,7 @@ void goldfish_frontend_vkGetRenderAreaGranularity(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetRenderAreaGranularity(vkStream, device, renderPass, pGranularity);
 }
 
@@ -2282,8 +2207,7 @@ VkResult goldfish_frontend_vkCreateCommandPool(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateCommandPool(vkStream, device, pCreateInfo, pAllocator, pCommandPool);
     return res;
 }
@@ -2308,8 +2232,7 @@ void goldfish_frontend_vkDestroyCommandPool(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyCommandPool(vkStream, device, commandPool, pAllocator);
 }
 
@@ -2333,8 +2256,7 @@ VkResult goldfish_frontend_vkResetCommandPool(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkResetCommandPool(vkStream, device, commandPool, flags);
     return res;
 }
@@ -2359,8 +2281,7 @@ VkResult goldfish_frontend_vkAllocateCommandBuffers(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkAllocateCommandBuffers(vkStream, device, pAllocateInfo, pCommandBuffers);
     return res;
 }
@@ -2387,8 +2308,7 @@ void goldfish_frontend_vkFreeCommandBuffers(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkFreeCommandBuffers(vkStream, device, commandPool, commandBufferCount, pCommandBuffers);
 }
 
@@ -2410,8 +2330,7 @@ VkResult goldfish_frontend_vkBeginCommandBuffer(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkBeginCommandBuffer(vkStream, commandBuffer, pBeginInfo);
     return res;
 }
@@ -2432,8 +2351,7 @@ VkResult goldfish_frontend_vkEndCommandBuffer(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkEndCommandBuffer(vkStream, commandBuffer);
     return res;
 }
@@ -2456,8 +2374,7 @@ VkResult goldfish_frontend_vkResetCommandBuffer(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkResetCommandBuffer(vkStream, commandBuffer, flags);
     return res;
 }
@@ -2482,8 +2399,7 @@ void goldfish_frontend_vkCmdBindPipeline(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBindPipeline(vkStream, commandBuffer, pipelineBindPoint, pipeline);
 }
 
@@ -2509,8 +2425,7 @@ void goldfish_frontend_vkCmdSetViewport(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetViewport(vkStream, commandBuffer, firstViewport, viewportCount, pViewports);
 }
 
@@ -2536,8 +2451,7 @@ void goldfish_frontend_vkCmdSetScissor(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetScissor(vkStream, commandBuffer, firstScissor, scissorCount, pScissors);
 }
 
@@ -2559,8 +2473,7 @@ void goldfish_frontend_vkCmdSetLineWidth(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetLineWidth(vkStream, commandBuffer, lineWidth);
 }
 
@@ -2586,8 +2499,7 @@ void goldfish_frontend_vkCmdSetDepthBias(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetDepthBias(vkStream, commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
 }
 
@@ -2609,8 +2521,7 @@ void goldfish_frontend_vkCmdSetBlendConstants(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetBlendConstants(vkStream, commandBuffer, blendConstants);
 }
 
@@ -2634,8 +2545,7 @@ void goldfish_frontend_vkCmdSetDepthBounds(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetDepthBounds(vkStream, commandBuffer, minDepthBounds, maxDepthBounds);
 }
 
@@ -2659,8 +2569,7 @@ void goldfish_frontend_vkCmdSetStencilCompareMask(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetStencilCompareMask(vkStream, commandBuffer, faceMask, compareMask);
 }
 
@@ -2684,8 +2593,7 @@ void goldfish_frontend_vkCmdSetStencilWriteMask(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetStencilWriteMask(vkStream, commandBuffer, faceMask, writeMask);
 }
 
@@ -2709,8 +2617,7 @@ void goldfish_frontend_vkCmdSetStencilReference(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetStencilReference(vkStream, commandBuffer, faceMask, reference);
 }
 
@@ -2744,8 +2651,7 @@ void goldfish_frontend_vkCmdBindDescriptorSets(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBindDescriptorSets(vkStream, commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
 }
 
@@ -2771,8 +2677,7 @@ void goldfish_frontend_vkCmdBindIndexBuffer(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBindIndexBuffer(vkStream, commandBuffer, buffer, offset, indexType);
 }
 
@@ -2800,8 +2705,7 @@ void goldfish_frontend_vkCmdBindVertexBuffers(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBindVertexBuffers(vkStream, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
 }
 
@@ -2829,8 +2733,7 @@ void goldfish_frontend_vkCmdDraw(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDraw(vkStream, commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
 }
 
@@ -2860,8 +2763,7 @@ void goldfish_frontend_vkCmdDrawIndexed(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDrawIndexed(vkStream, commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 }
 
@@ -2889,8 +2791,7 @@ void goldfish_frontend_vkCmdDrawIndirect(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDrawIndirect(vkStream, commandBuffer, buffer, offset, drawCount, stride);
 }
 
@@ -2918,8 +2819,7 @@ void goldfish_frontend_vkCmdDrawIndexedIndirect(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDrawIndexedIndirect(vkStream, commandBuffer, buffer, offset, drawCount, stride);
 }
 
@@ -2945,8 +2845,7 @@ void goldfish_frontend_vkCmdDispatch(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDispatch(vkStream, commandBuffer, groupCountX, groupCountY, groupCountZ);
 }
 
@@ -2970,8 +2869,7 @@ void goldfish_frontend_vkCmdDispatchIndirect(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDispatchIndirect(vkStream, commandBuffer, buffer, offset);
 }
 
@@ -2999,8 +2897,7 @@ void goldfish_frontend_vkCmdCopyBuffer(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdCopyBuffer(vkStream, commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
 }
 
@@ -3032,8 +2929,7 @@ void goldfish_frontend_vkCmdCopyImage(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdCopyImage(vkStream, commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
 }
 
@@ -3067,8 +2963,7 @@ void goldfish_frontend_vkCmdBlitImage(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBlitImage(vkStream, commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
 }
 
@@ -3098,8 +2993,7 @@ void goldfish_frontend_vkCmdCopyBufferToImage(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdCopyBufferToImage(vkStream, commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
 }
 
@@ -3129,8 +3023,7 @@ void goldfish_frontend_vkCmdCopyImageToBuffer(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdCopyImageToBuffer(vkStream, commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
 }
 
@@ -3158,8 +3051,7 @@ void goldfish_frontend_vkCmdUpdateBuffer(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdUpdateBuffer(vkStream, commandBuffer, dstBuffer, dstOffset, dataSize, pData);
 }
 
@@ -3187,8 +3079,7 @@ void goldfish_frontend_vkCmdFillBuffer(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdFillBuffer(vkStream, commandBuffer, dstBuffer, dstOffset, size, data);
 }
 
@@ -3218,8 +3109,7 @@ void goldfish_frontend_vkCmdClearColorImage(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdClearColorImage(vkStream, commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
 }
 
@@ -3249,8 +3139,7 @@ void goldfish_frontend_vkCmdClearDepthStencilImage(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdClearDepthStencilImage(vkStream, commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
 }
 
@@ -3278,8 +3167,7 @@ void goldfish_frontend_vkCmdClearAttachments(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdClearAttachments(vkStream, commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
 }
 
@@ -3311,8 +3199,7 @@ void goldfish_frontend_vkCmdResolveImage(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdResolveImage(vkStream, commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
 }
 
@@ -3336,8 +3223,7 @@ void goldfish_frontend_vkCmdSetEvent(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetEvent(vkStream, commandBuffer, event, stageMask);
 }
 
@@ -3361,8 +3247,7 @@ void goldfish_frontend_vkCmdResetEvent(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdResetEvent(vkStream, commandBuffer, event, stageMask);
 }
 
@@ -3402,8 +3287,7 @@ void goldfish_frontend_vkCmdWaitEvents(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdWaitEvents(vkStream, commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
 }
 
@@ -3441,8 +3325,7 @@ void goldfish_frontend_vkCmdPipelineBarrier(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdPipelineBarrier(vkStream, commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
 }
 
@@ -3468,8 +3351,7 @@ void goldfish_frontend_vkCmdBeginQuery(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBeginQuery(vkStream, commandBuffer, queryPool, query, flags);
 }
 
@@ -3493,8 +3375,7 @@ void goldfish_frontend_vkCmdEndQuery(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdEndQuery(vkStream, commandBuffer, queryPool, query);
 }
 
@@ -3520,8 +3401,7 @@ void goldfish_frontend_vkCmdResetQueryPool(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdResetQueryPool(vkStream, commandBuffer, queryPool, firstQuery, queryCount);
 }
 
@@ -3547,8 +3427,7 @@ void goldfish_frontend_vkCmdWriteTimestamp(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdWriteTimestamp(vkStream, commandBuffer, pipelineStage, queryPool, query);
 }
 
@@ -3582,8 +3461,7 @@ void goldfish_frontend_vkCmdCopyQueryPoolResults(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdCopyQueryPoolResults(vkStream, commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
 }
 
@@ -3613,8 +3491,7 @@ void goldfish_frontend_vkCmdPushConstants(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdPushConstants(vkStream, commandBuffer, layout, stageFlags, offset, size, pValues);
 }
 
@@ -3638,8 +3515,7 @@ void goldfish_frontend_vkCmdBeginRenderPass(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBeginRenderPass(vkStream, commandBuffer, pRenderPassBegin, contents);
 }
 
@@ -3661,8 +3537,7 @@ void goldfish_frontend_vkCmdNextSubpass(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdNextSubpass(vkStream, commandBuffer, contents);
 }
 
@@ -3682,8 +3557,7 @@ void goldfish_frontend_vkCmdEndRenderPass(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdEndRenderPass(vkStream, commandBuffer);
 }
 
@@ -3707,8 +3581,7 @@ void goldfish_frontend_vkCmdExecuteCommands(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdExecuteCommands(vkStream, commandBuffer, commandBufferCount, pCommandBuffers);
 }
 
@@ -3732,8 +3605,7 @@ VkResult goldfish_frontend_vkEnumerateInstanceVersion(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkEnumerateInstanceVersion(vkStream, pApiVersion);
     return res;
 }
@@ -3758,8 +3630,7 @@ VkResult goldfish_frontend_vkBindBufferMemory2(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkBindBufferMemory2(vkStream, device, bindInfoCount, pBindInfos);
     return res;
 }
@@ -3784,8 +3655,7 @@ VkResult goldfish_frontend_vkBindImageMemory2(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkBindImageMemory2(vkStream, device, bindInfoCount, pBindInfos);
     return res;
 }
@@ -3814,8 +3684,7 @@ void goldfish_frontend_vkGetDeviceGroupPeerMemoryFeatures(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetDeviceGroupPeerMemoryFeatures(vkStream, device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
 }
 
@@ -3837,8 +3706,7 @@ void goldfish_frontend_vkCmdSetDeviceMask(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetDeviceMask(vkStream, commandBuffer, deviceMask);
 }
 
@@ -3870,8 +3738,7 @@ void goldfish_frontend_vkCmdDispatchBase(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDispatchBase(vkStream, commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
 }
 
@@ -3895,8 +3762,7 @@ VkResult goldfish_frontend_vkEnumeratePhysicalDeviceGroups(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkEnumeratePhysicalDeviceGroups(vkStream, instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     return res;
 }
@@ -3921,8 +3787,7 @@ void goldfish_frontend_vkGetImageMemoryRequirements2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetImageMemoryRequirements2(vkStream, device, pInfo, pMemoryRequirements);
 }
 
@@ -3946,8 +3811,7 @@ void goldfish_frontend_vkGetBufferMemoryRequirements2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetBufferMemoryRequirements2(vkStream, device, pInfo, pMemoryRequirements);
 }
 
@@ -3973,8 +3837,7 @@ void goldfish_frontend_vkGetImageSparseMemoryRequirements2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetImageSparseMemoryRequirements2(vkStream, device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
 }
 
@@ -3996,8 +3859,7 @@ void goldfish_frontend_vkGetPhysicalDeviceFeatures2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceFeatures2(vkStream, physicalDevice, pFeatures);
 }
 
@@ -4019,8 +3881,7 @@ void goldfish_frontend_vkGetPhysicalDeviceProperties2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceProperties2(vkStream, physicalDevice, pProperties);
 }
 
@@ -4044,8 +3905,7 @@ void goldfish_frontend_vkGetPhysicalDeviceFormatProperties2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceFormatProperties2(vkStream, physicalDevice, format, pFormatProperties);
 }
 
@@ -4069,8 +3929,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceImageFormatProperties2(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceImageFormatProperties2(vkStream, physicalDevice, pImageFormatInfo, pImageFormatProperties);
     return res;
 }
@@ -4095,8 +3954,7 @@ void goldfish_frontend_vkGetPhysicalDeviceQueueFamilyProperties2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceQueueFamilyProperties2(vkStream, physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
 }
 
@@ -4118,8 +3976,7 @@ void goldfish_frontend_vkGetPhysicalDeviceMemoryProperties2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceMemoryProperties2(vkStream, physicalDevice, pMemoryProperties);
 }
 
@@ -4145,8 +4002,7 @@ void goldfish_frontend_vkGetPhysicalDeviceSparseImageFormatProperties2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceSparseImageFormatProperties2(vkStream, physicalDevice, pFormatInfo, pPropertyCount, pProperties);
 }
 
@@ -4170,8 +4026,7 @@ void goldfish_frontend_vkTrimCommandPool(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkTrimCommandPool(vkStream, device, commandPool, flags);
 }
 
@@ -4195,8 +4050,7 @@ void goldfish_frontend_vkGetDeviceQueue2(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetDeviceQueue2(vkStream, device, pQueueInfo, pQueue);
 }
 
@@ -4222,8 +4076,7 @@ VkResult goldfish_frontend_vkCreateSamplerYcbcrConversion(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateSamplerYcbcrConversion(vkStream, device, pCreateInfo, pAllocator, pYcbcrConversion);
     return res;
 }
@@ -4248,8 +4101,7 @@ void goldfish_frontend_vkDestroySamplerYcbcrConversion(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroySamplerYcbcrConversion(vkStream, device, ycbcrConversion, pAllocator);
 }
 
@@ -4275,8 +4127,7 @@ VkResult goldfish_frontend_vkCreateDescriptorUpdateTemplate(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateDescriptorUpdateTemplate(vkStream, device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     return res;
 }
@@ -4301,8 +4152,7 @@ void goldfish_frontend_vkDestroyDescriptorUpdateTemplate(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyDescriptorUpdateTemplate(vkStream, device, descriptorUpdateTemplate, pAllocator);
 }
 
@@ -4328,8 +4178,7 @@ void goldfish_frontend_vkUpdateDescriptorSetWithTemplate(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkUpdateDescriptorSetWithTemplate(vkStream, device, descriptorSet, descriptorUpdateTemplate, pData);
 }
 
@@ -4353,8 +4202,7 @@ void goldfish_frontend_vkGetPhysicalDeviceExternalBufferProperties(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceExternalBufferProperties(vkStream, physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
 }
 
@@ -4378,8 +4226,7 @@ void goldfish_frontend_vkGetPhysicalDeviceExternalFenceProperties(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceExternalFenceProperties(vkStream, physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
 }
 
@@ -4403,8 +4250,7 @@ void goldfish_frontend_vkGetPhysicalDeviceExternalSemaphoreProperties(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceExternalSemaphoreProperties(vkStream, physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
 }
 
@@ -4428,8 +4274,7 @@ void goldfish_frontend_vkGetDescriptorSetLayoutSupport(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetDescriptorSetLayoutSupport(vkStream, device, pCreateInfo, pSupport);
 }
 
@@ -4457,8 +4302,7 @@ void goldfish_frontend_vkDestroySurfaceKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroySurfaceKHR(vkStream, instance, surface, pAllocator);
 }
 
@@ -4484,8 +4328,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceSurfaceSupportKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceSurfaceSupportKHR(vkStream, physicalDevice, queueFamilyIndex, surface, pSupported);
     return res;
 }
@@ -4510,8 +4353,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(vkStream, physicalDevice, surface, pSurfaceCapabilities);
     return res;
 }
@@ -4538,8 +4380,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceSurfaceFormatsKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceSurfaceFormatsKHR(vkStream, physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
     return res;
 }
@@ -4566,8 +4407,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceSurfacePresentModesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceSurfacePresentModesKHR(vkStream, physicalDevice, surface, pPresentModeCount, pPresentModes);
     return res;
 }
@@ -4598,8 +4438,7 @@ VkResult goldfish_frontend_vkCreateSwapchainKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateSwapchainKHR(vkStream, device, pCreateInfo, pAllocator, pSwapchain);
     return res;
 }
@@ -4624,8 +4463,7 @@ void goldfish_frontend_vkDestroySwapchainKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroySwapchainKHR(vkStream, device, swapchain, pAllocator);
 }
 
@@ -4651,8 +4489,7 @@ VkResult goldfish_frontend_vkGetSwapchainImagesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetSwapchainImagesKHR(vkStream, device, swapchain, pSwapchainImageCount, pSwapchainImages);
     return res;
 }
@@ -4683,8 +4520,7 @@ VkResult goldfish_frontend_vkAcquireNextImageKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkAcquireNextImageKHR(vkStream, device, swapchain, timeout, semaphore, fence, pImageIndex);
     return res;
 }
@@ -4707,8 +4543,7 @@ VkResult goldfish_frontend_vkQueuePresentKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkQueuePresentKHR(vkStream, queue, pPresentInfo);
     return res;
 }
@@ -4731,8 +4566,7 @@ VkResult goldfish_frontend_vkGetDeviceGroupPresentCapabilitiesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetDeviceGroupPresentCapabilitiesKHR(vkStream, device, pDeviceGroupPresentCapabilities);
     return res;
 }
@@ -4757,8 +4591,7 @@ VkResult goldfish_frontend_vkGetDeviceGroupSurfacePresentModesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetDeviceGroupSurfacePresentModesKHR(vkStream, device, surface, pModes);
     return res;
 }
@@ -4785,8 +4618,7 @@ VkResult goldfish_frontend_vkGetPhysicalDevicePresentRectanglesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDevicePresentRectanglesKHR(vkStream, physicalDevice, surface, pRectCount, pRects);
     return res;
 }
@@ -4811,8 +4643,7 @@ VkResult goldfish_frontend_vkAcquireNextImage2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkAcquireNextImage2KHR(vkStream, device, pAcquireInfo, pImageIndex);
     return res;
 }
@@ -4841,8 +4672,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceDisplayPropertiesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceDisplayPropertiesKHR(vkStream, physicalDevice, pPropertyCount, pProperties);
     return res;
 }
@@ -4867,8 +4697,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(vkStream, physicalDevice, pPropertyCount, pProperties);
     return res;
 }
@@ -4895,8 +4724,7 @@ VkResult goldfish_frontend_vkGetDisplayPlaneSupportedDisplaysKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetDisplayPlaneSupportedDisplaysKHR(vkStream, physicalDevice, planeIndex, pDisplayCount, pDisplays);
     return res;
 }
@@ -4923,8 +4751,7 @@ VkResult goldfish_frontend_vkGetDisplayModePropertiesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetDisplayModePropertiesKHR(vkStream, physicalDevice, display, pPropertyCount, pProperties);
     return res;
 }
@@ -4953,8 +4780,7 @@ VkResult goldfish_frontend_vkCreateDisplayModeKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateDisplayModeKHR(vkStream, physicalDevice, display, pCreateInfo, pAllocator, pMode);
     return res;
 }
@@ -4981,8 +4807,7 @@ VkResult goldfish_frontend_vkGetDisplayPlaneCapabilitiesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetDisplayPlaneCapabilitiesKHR(vkStream, physicalDevice, mode, planeIndex, pCapabilities);
     return res;
 }
@@ -5009,8 +4834,7 @@ VkResult goldfish_frontend_vkCreateDisplayPlaneSurfaceKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateDisplayPlaneSurfaceKHR(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -5043,8 +4867,7 @@ VkResult goldfish_frontend_vkCreateSharedSwapchainsKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateSharedSwapchainsKHR(vkStream, device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
     return res;
 }
@@ -5075,8 +4898,7 @@ VkResult goldfish_frontend_vkCreateXlibSurfaceKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateXlibSurfaceKHR(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -5103,8 +4925,7 @@ VkBool32 goldfish_frontend_vkGetPhysicalDeviceXlibPresentationSupportKHR(
     {
         return (VkBool32)0;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkBool32 res = encode_vkGetPhysicalDeviceXlibPresentationSupportKHR(vkStream, physicalDevice, queueFamilyIndex, dpy, visualID);
     return res;
 }
@@ -5135,8 +4956,7 @@ VkResult goldfish_frontend_vkCreateXcbSurfaceKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateXcbSurfaceKHR(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -5163,8 +4983,7 @@ VkBool32 goldfish_frontend_vkGetPhysicalDeviceXcbPresentationSupportKHR(
     {
         return (VkBool32)0;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkBool32 res = encode_vkGetPhysicalDeviceXcbPresentationSupportKHR(vkStream, physicalDevice, queueFamilyIndex, connection, visual_id);
     return res;
 }
@@ -5195,8 +5014,7 @@ VkResult goldfish_frontend_vkCreateWaylandSurfaceKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateWaylandSurfaceKHR(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -5221,8 +5039,7 @@ VkBool32 goldfish_frontend_vkGetPhysicalDeviceWaylandPresentationSupportKHR(
     {
         return (VkBool32)0;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkBool32 res = encode_vkGetPhysicalDeviceWaylandPresentationSupportKHR(vkStream, physicalDevice, queueFamilyIndex, display);
     return res;
 }
@@ -5253,8 +5070,7 @@ VkResult goldfish_frontend_vkCreateMirSurfaceKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateMirSurfaceKHR(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -5279,8 +5095,7 @@ VkBool32 goldfish_frontend_vkGetPhysicalDeviceMirPresentationSupportKHR(
     {
         return (VkBool32)0;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkBool32 res = encode_vkGetPhysicalDeviceMirPresentationSupportKHR(vkStream, physicalDevice, queueFamilyIndex, connection);
     return res;
 }
@@ -5311,8 +5126,7 @@ VkResult goldfish_frontend_vkCreateAndroidSurfaceKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateAndroidSurfaceKHR(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -5343,8 +5157,7 @@ VkResult goldfish_frontend_vkCreateWin32SurfaceKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateWin32SurfaceKHR(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -5367,8 +5180,7 @@ VkBool32 goldfish_frontend_vkGetPhysicalDeviceWin32PresentationSupportKHR(
     {
         return (VkBool32)0;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkBool32 res = encode_vkGetPhysicalDeviceWin32PresentationSupportKHR(vkStream, physicalDevice, queueFamilyIndex);
     return res;
 }
@@ -5403,8 +5215,7 @@ void goldfish_frontend_vkGetPhysicalDeviceFeatures2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceFeatures2KHR(vkStream, physicalDevice, pFeatures);
 }
 
@@ -5426,8 +5237,7 @@ void goldfish_frontend_vkGetPhysicalDeviceProperties2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceProperties2KHR(vkStream, physicalDevice, pProperties);
 }
 
@@ -5451,8 +5261,7 @@ void goldfish_frontend_vkGetPhysicalDeviceFormatProperties2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceFormatProperties2KHR(vkStream, physicalDevice, format, pFormatProperties);
 }
 
@@ -5476,8 +5285,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceImageFormatProperties2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceImageFormatProperties2KHR(vkStream, physicalDevice, pImageFormatInfo, pImageFormatProperties);
     return res;
 }
@@ -5502,8 +5310,7 @@ void goldfish_frontend_vkGetPhysicalDeviceQueueFamilyProperties2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceQueueFamilyProperties2KHR(vkStream, physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
 }
 
@@ -5525,8 +5332,7 @@ void goldfish_frontend_vkGetPhysicalDeviceMemoryProperties2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceMemoryProperties2KHR(vkStream, physicalDevice, pMemoryProperties);
 }
 
@@ -5552,8 +5358,7 @@ void goldfish_frontend_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(vkStream, physicalDevice, pFormatInfo, pPropertyCount, pProperties);
 }
 
@@ -5585,8 +5390,7 @@ void goldfish_frontend_vkGetDeviceGroupPeerMemoryFeaturesKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetDeviceGroupPeerMemoryFeaturesKHR(vkStream, device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
 }
 
@@ -5608,8 +5412,7 @@ void goldfish_frontend_vkCmdSetDeviceMaskKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetDeviceMaskKHR(vkStream, commandBuffer, deviceMask);
 }
 
@@ -5641,8 +5444,7 @@ void goldfish_frontend_vkCmdDispatchBaseKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDispatchBaseKHR(vkStream, commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
 }
 
@@ -5674,8 +5476,7 @@ void goldfish_frontend_vkTrimCommandPoolKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkTrimCommandPoolKHR(vkStream, device, commandPool, flags);
 }
 
@@ -5703,8 +5504,7 @@ VkResult goldfish_frontend_vkEnumeratePhysicalDeviceGroupsKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkEnumeratePhysicalDeviceGroupsKHR(vkStream, instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
     return res;
 }
@@ -5733,8 +5533,7 @@ void goldfish_frontend_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceExternalBufferPropertiesKHR(vkStream, physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
 }
 
@@ -5766,8 +5565,7 @@ VkResult goldfish_frontend_vkGetMemoryWin32HandleKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetMemoryWin32HandleKHR(vkStream, device, pGetWin32HandleInfo, pHandle);
     return res;
 }
@@ -5794,8 +5592,7 @@ VkResult goldfish_frontend_vkGetMemoryWin32HandlePropertiesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetMemoryWin32HandlePropertiesKHR(vkStream, device, handleType, handle, pMemoryWin32HandleProperties);
     return res;
 }
@@ -5824,8 +5621,7 @@ VkResult goldfish_frontend_vkGetMemoryFdKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetMemoryFdKHR(vkStream, device, pGetFdInfo, pFd);
     return res;
 }
@@ -5852,8 +5648,7 @@ VkResult goldfish_frontend_vkGetMemoryFdPropertiesKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetMemoryFdPropertiesKHR(vkStream, device, handleType, fd, pMemoryFdProperties);
     return res;
 }
@@ -5886,8 +5681,7 @@ void goldfish_frontend_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(vkStream, physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
 }
 
@@ -5917,8 +5711,7 @@ VkResult goldfish_frontend_vkImportSemaphoreWin32HandleKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkImportSemaphoreWin32HandleKHR(vkStream, device, pImportSemaphoreWin32HandleInfo);
     return res;
 }
@@ -5943,8 +5736,7 @@ VkResult goldfish_frontend_vkGetSemaphoreWin32HandleKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetSemaphoreWin32HandleKHR(vkStream, device, pGetWin32HandleInfo, pHandle);
     return res;
 }
@@ -5971,8 +5763,7 @@ VkResult goldfish_frontend_vkImportSemaphoreFdKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkImportSemaphoreFdKHR(vkStream, device, pImportSemaphoreFdInfo);
     return res;
 }
@@ -5997,8 +5788,7 @@ VkResult goldfish_frontend_vkGetSemaphoreFdKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetSemaphoreFdKHR(vkStream, device, pGetFdInfo, pFd);
     return res;
 }
@@ -6033,8 +5823,7 @@ void goldfish_frontend_vkCmdPushDescriptorSetKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdPushDescriptorSetKHR(vkStream, commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
 }
 
@@ -6062,8 +5851,7 @@ void goldfish_frontend_vkCmdPushDescriptorSetWithTemplateKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdPushDescriptorSetWithTemplateKHR(vkStream, commandBuffer, descriptorUpdateTemplate, layout, set, pData);
 }
 
@@ -6101,8 +5889,7 @@ VkResult goldfish_frontend_vkCreateDescriptorUpdateTemplateKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateDescriptorUpdateTemplateKHR(vkStream, device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
     return res;
 }
@@ -6127,8 +5914,7 @@ void goldfish_frontend_vkDestroyDescriptorUpdateTemplateKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyDescriptorUpdateTemplateKHR(vkStream, device, descriptorUpdateTemplate, pAllocator);
 }
 
@@ -6154,8 +5940,7 @@ void goldfish_frontend_vkUpdateDescriptorSetWithTemplateKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkUpdateDescriptorSetWithTemplateKHR(vkStream, device, descriptorSet, descriptorUpdateTemplate, pData);
 }
 
@@ -6185,8 +5970,7 @@ VkResult goldfish_frontend_vkCreateRenderPass2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateRenderPass2KHR(vkStream, device, pCreateInfo, pAllocator, pRenderPass);
     return res;
 }
@@ -6211,8 +5995,7 @@ void goldfish_frontend_vkCmdBeginRenderPass2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBeginRenderPass2KHR(vkStream, commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
 }
 
@@ -6236,8 +6019,7 @@ void goldfish_frontend_vkCmdNextSubpass2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdNextSubpass2KHR(vkStream, commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
 }
 
@@ -6259,8 +6041,7 @@ void goldfish_frontend_vkCmdEndRenderPass2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdEndRenderPass2KHR(vkStream, commandBuffer, pSubpassEndInfo);
 }
 
@@ -6286,8 +6067,7 @@ VkResult goldfish_frontend_vkGetSwapchainStatusKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetSwapchainStatusKHR(vkStream, device, swapchain);
     return res;
 }
@@ -6316,8 +6096,7 @@ void goldfish_frontend_vkGetPhysicalDeviceExternalFencePropertiesKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceExternalFencePropertiesKHR(vkStream, physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
 }
 
@@ -6347,8 +6126,7 @@ VkResult goldfish_frontend_vkImportFenceWin32HandleKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkImportFenceWin32HandleKHR(vkStream, device, pImportFenceWin32HandleInfo);
     return res;
 }
@@ -6373,8 +6151,7 @@ VkResult goldfish_frontend_vkGetFenceWin32HandleKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetFenceWin32HandleKHR(vkStream, device, pGetWin32HandleInfo, pHandle);
     return res;
 }
@@ -6401,8 +6178,7 @@ VkResult goldfish_frontend_vkImportFenceFdKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkImportFenceFdKHR(vkStream, device, pImportFenceFdInfo);
     return res;
 }
@@ -6427,8 +6203,7 @@ VkResult goldfish_frontend_vkGetFenceFdKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetFenceFdKHR(vkStream, device, pGetFdInfo, pFd);
     return res;
 }
@@ -6461,8 +6236,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceSurfaceCapabilities2KHR(vkStream, physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
     return res;
 }
@@ -6489,8 +6263,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceSurfaceFormats2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceSurfaceFormats2KHR(vkStream, physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
     return res;
 }
@@ -6523,8 +6296,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceDisplayProperties2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceDisplayProperties2KHR(vkStream, physicalDevice, pPropertyCount, pProperties);
     return res;
 }
@@ -6549,8 +6321,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(vkStream, physicalDevice, pPropertyCount, pProperties);
     return res;
 }
@@ -6577,8 +6348,7 @@ VkResult goldfish_frontend_vkGetDisplayModeProperties2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetDisplayModeProperties2KHR(vkStream, physicalDevice, display, pPropertyCount, pProperties);
     return res;
 }
@@ -6603,8 +6373,7 @@ VkResult goldfish_frontend_vkGetDisplayPlaneCapabilities2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetDisplayPlaneCapabilities2KHR(vkStream, physicalDevice, pDisplayPlaneInfo, pCapabilities);
     return res;
 }
@@ -6645,8 +6414,7 @@ void goldfish_frontend_vkGetImageMemoryRequirements2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetImageMemoryRequirements2KHR(vkStream, device, pInfo, pMemoryRequirements);
 }
 
@@ -6670,8 +6438,7 @@ void goldfish_frontend_vkGetBufferMemoryRequirements2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetBufferMemoryRequirements2KHR(vkStream, device, pInfo, pMemoryRequirements);
 }
 
@@ -6697,8 +6464,7 @@ void goldfish_frontend_vkGetImageSparseMemoryRequirements2KHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetImageSparseMemoryRequirements2KHR(vkStream, device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
 }
 
@@ -6732,8 +6498,7 @@ VkResult goldfish_frontend_vkCreateSamplerYcbcrConversionKHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateSamplerYcbcrConversionKHR(vkStream, device, pCreateInfo, pAllocator, pYcbcrConversion);
     return res;
 }
@@ -6758,8 +6523,7 @@ void goldfish_frontend_vkDestroySamplerYcbcrConversionKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroySamplerYcbcrConversionKHR(vkStream, device, ycbcrConversion, pAllocator);
 }
 
@@ -6787,8 +6551,7 @@ VkResult goldfish_frontend_vkBindBufferMemory2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkBindBufferMemory2KHR(vkStream, device, bindInfoCount, pBindInfos);
     return res;
 }
@@ -6813,8 +6576,7 @@ VkResult goldfish_frontend_vkBindImageMemory2KHR(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkBindImageMemory2KHR(vkStream, device, bindInfoCount, pBindInfos);
     return res;
 }
@@ -6843,8 +6605,7 @@ void goldfish_frontend_vkGetDescriptorSetLayoutSupportKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetDescriptorSetLayoutSupportKHR(vkStream, device, pCreateInfo, pSupport);
 }
 
@@ -6880,8 +6641,7 @@ void goldfish_frontend_vkCmdDrawIndirectCountKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDrawIndirectCountKHR(vkStream, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 }
 
@@ -6913,8 +6673,7 @@ void goldfish_frontend_vkCmdDrawIndexedIndirectCountKHR(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDrawIndexedIndirectCountKHR(vkStream, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 }
 
@@ -6948,8 +6707,7 @@ VkResult goldfish_frontend_vkCreateDebugReportCallbackEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateDebugReportCallbackEXT(vkStream, instance, pCreateInfo, pAllocator, pCallback);
     return res;
 }
@@ -6974,8 +6732,7 @@ void goldfish_frontend_vkDestroyDebugReportCallbackEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyDebugReportCallbackEXT(vkStream, instance, callback, pAllocator);
 }
 
@@ -7009,8 +6766,7 @@ void goldfish_frontend_vkDebugReportMessageEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDebugReportMessageEXT(vkStream, instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
 }
 
@@ -7060,8 +6816,7 @@ VkResult goldfish_frontend_vkDebugMarkerSetObjectTagEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkDebugMarkerSetObjectTagEXT(vkStream, device, pTagInfo);
     return res;
 }
@@ -7084,8 +6839,7 @@ VkResult goldfish_frontend_vkDebugMarkerSetObjectNameEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkDebugMarkerSetObjectNameEXT(vkStream, device, pNameInfo);
     return res;
 }
@@ -7108,8 +6862,7 @@ void goldfish_frontend_vkCmdDebugMarkerBeginEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDebugMarkerBeginEXT(vkStream, commandBuffer, pMarkerInfo);
 }
 
@@ -7129,8 +6882,7 @@ void goldfish_frontend_vkCmdDebugMarkerEndEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDebugMarkerEndEXT(vkStream, commandBuffer);
 }
 
@@ -7152,8 +6904,7 @@ void goldfish_frontend_vkCmdDebugMarkerInsertEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDebugMarkerInsertEXT(vkStream, commandBuffer, pMarkerInfo);
 }
 
@@ -7197,8 +6948,7 @@ void goldfish_frontend_vkCmdDrawIndirectCountAMD(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDrawIndirectCountAMD(vkStream, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 }
 
@@ -7230,8 +6980,7 @@ void goldfish_frontend_vkCmdDrawIndexedIndirectCountAMD(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdDrawIndexedIndirectCountAMD(vkStream, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
 }
 
@@ -7281,8 +7030,7 @@ VkResult goldfish_frontend_vkGetShaderInfoAMD(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetShaderInfoAMD(vkStream, device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
     return res;
 }
@@ -7329,8 +7077,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(vkStream, physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
     return res;
 }
@@ -7365,8 +7112,7 @@ VkResult goldfish_frontend_vkGetMemoryWin32HandleNV(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetMemoryWin32HandleNV(vkStream, device, memory, handleType, pHandle);
     return res;
 }
@@ -7405,8 +7151,7 @@ VkResult goldfish_frontend_vkCreateViSurfaceNN(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateViSurfaceNN(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -7441,8 +7186,7 @@ void goldfish_frontend_vkCmdBeginConditionalRenderingEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBeginConditionalRenderingEXT(vkStream, commandBuffer, pConditionalRenderingBegin);
 }
 
@@ -7462,8 +7206,7 @@ void goldfish_frontend_vkCmdEndConditionalRenderingEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdEndConditionalRenderingEXT(vkStream, commandBuffer);
 }
 
@@ -7489,8 +7232,7 @@ void goldfish_frontend_vkCmdProcessCommandsNVX(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdProcessCommandsNVX(vkStream, commandBuffer, pProcessCommandsInfo);
 }
 
@@ -7512,8 +7254,7 @@ void goldfish_frontend_vkCmdReserveSpaceForCommandsNVX(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdReserveSpaceForCommandsNVX(vkStream, commandBuffer, pReserveSpaceInfo);
 }
 
@@ -7539,8 +7280,7 @@ VkResult goldfish_frontend_vkCreateIndirectCommandsLayoutNVX(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateIndirectCommandsLayoutNVX(vkStream, device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
     return res;
 }
@@ -7565,8 +7305,7 @@ void goldfish_frontend_vkDestroyIndirectCommandsLayoutNVX(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyIndirectCommandsLayoutNVX(vkStream, device, indirectCommandsLayout, pAllocator);
 }
 
@@ -7592,8 +7331,7 @@ VkResult goldfish_frontend_vkCreateObjectTableNVX(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateObjectTableNVX(vkStream, device, pCreateInfo, pAllocator, pObjectTable);
     return res;
 }
@@ -7618,8 +7356,7 @@ void goldfish_frontend_vkDestroyObjectTableNVX(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyObjectTableNVX(vkStream, device, objectTable, pAllocator);
 }
 
@@ -7647,8 +7384,7 @@ VkResult goldfish_frontend_vkRegisterObjectsNVX(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkRegisterObjectsNVX(vkStream, device, objectTable, objectCount, ppObjectTableEntries, pObjectIndices);
     return res;
 }
@@ -7677,8 +7413,7 @@ VkResult goldfish_frontend_vkUnregisterObjectsNVX(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkUnregisterObjectsNVX(vkStream, device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
     return res;
 }
@@ -7703,8 +7438,7 @@ void goldfish_frontend_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(vkStream, physicalDevice, pFeatures, pLimits);
 }
 
@@ -7734,8 +7468,7 @@ void goldfish_frontend_vkCmdSetViewportWScalingNV(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetViewportWScalingNV(vkStream, commandBuffer, firstViewport, viewportCount, pViewportWScalings);
 }
 
@@ -7761,8 +7494,7 @@ VkResult goldfish_frontend_vkReleaseDisplayEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkReleaseDisplayEXT(vkStream, physicalDevice, display);
     return res;
 }
@@ -7791,8 +7523,7 @@ VkResult goldfish_frontend_vkAcquireXlibDisplayEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkAcquireXlibDisplayEXT(vkStream, physicalDevice, dpy, display);
     return res;
 }
@@ -7819,8 +7550,7 @@ VkResult goldfish_frontend_vkGetRandROutputDisplayEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetRandROutputDisplayEXT(vkStream, physicalDevice, dpy, rrOutput, pDisplay);
     return res;
 }
@@ -7849,8 +7579,7 @@ VkResult goldfish_frontend_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPhysicalDeviceSurfaceCapabilities2EXT(vkStream, physicalDevice, surface, pSurfaceCapabilities);
     return res;
 }
@@ -7879,8 +7608,7 @@ VkResult goldfish_frontend_vkDisplayPowerControlEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkDisplayPowerControlEXT(vkStream, device, display, pDisplayPowerInfo);
     return res;
 }
@@ -7907,8 +7635,7 @@ VkResult goldfish_frontend_vkRegisterDeviceEventEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkRegisterDeviceEventEXT(vkStream, device, pDeviceEventInfo, pAllocator, pFence);
     return res;
 }
@@ -7937,8 +7664,7 @@ VkResult goldfish_frontend_vkRegisterDisplayEventEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkRegisterDisplayEventEXT(vkStream, device, display, pDisplayEventInfo, pAllocator, pFence);
     return res;
 }
@@ -7965,8 +7691,7 @@ VkResult goldfish_frontend_vkGetSwapchainCounterEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetSwapchainCounterEXT(vkStream, device, swapchain, counter, pCounterValue);
     return res;
 }
@@ -7995,8 +7720,7 @@ VkResult goldfish_frontend_vkGetRefreshCycleDurationGOOGLE(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetRefreshCycleDurationGOOGLE(vkStream, device, swapchain, pDisplayTimingProperties);
     return res;
 }
@@ -8023,8 +7747,7 @@ VkResult goldfish_frontend_vkGetPastPresentationTimingGOOGLE(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetPastPresentationTimingGOOGLE(vkStream, device, swapchain, pPresentationTimingCount, pPresentationTimings);
     return res;
 }
@@ -8075,8 +7798,7 @@ void goldfish_frontend_vkCmdSetDiscardRectangleEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetDiscardRectangleEXT(vkStream, commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
 }
 
@@ -8114,8 +7836,7 @@ void goldfish_frontend_vkSetHdrMetadataEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkSetHdrMetadataEXT(vkStream, device, swapchainCount, pSwapchains, pMetadata);
 }
 
@@ -8145,8 +7866,7 @@ VkResult goldfish_frontend_vkCreateIOSSurfaceMVK(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateIOSSurfaceMVK(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -8177,8 +7897,7 @@ VkResult goldfish_frontend_vkCreateMacOSSurfaceMVK(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateMacOSSurfaceMVK(vkStream, instance, pCreateInfo, pAllocator, pSurface);
     return res;
 }
@@ -8213,8 +7932,7 @@ VkResult goldfish_frontend_vkSetDebugUtilsObjectNameEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkSetDebugUtilsObjectNameEXT(vkStream, device, pNameInfo);
     return res;
 }
@@ -8237,8 +7955,7 @@ VkResult goldfish_frontend_vkSetDebugUtilsObjectTagEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkSetDebugUtilsObjectTagEXT(vkStream, device, pTagInfo);
     return res;
 }
@@ -8261,8 +7978,7 @@ void goldfish_frontend_vkQueueBeginDebugUtilsLabelEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkQueueBeginDebugUtilsLabelEXT(vkStream, queue, pLabelInfo);
 }
 
@@ -8282,8 +7998,7 @@ void goldfish_frontend_vkQueueEndDebugUtilsLabelEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkQueueEndDebugUtilsLabelEXT(vkStream, queue);
 }
 
@@ -8305,8 +8020,7 @@ void goldfish_frontend_vkQueueInsertDebugUtilsLabelEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkQueueInsertDebugUtilsLabelEXT(vkStream, queue, pLabelInfo);
 }
 
@@ -8328,8 +8042,7 @@ void goldfish_frontend_vkCmdBeginDebugUtilsLabelEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdBeginDebugUtilsLabelEXT(vkStream, commandBuffer, pLabelInfo);
 }
 
@@ -8349,8 +8062,7 @@ void goldfish_frontend_vkCmdEndDebugUtilsLabelEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdEndDebugUtilsLabelEXT(vkStream, commandBuffer);
 }
 
@@ -8372,8 +8084,7 @@ void goldfish_frontend_vkCmdInsertDebugUtilsLabelEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdInsertDebugUtilsLabelEXT(vkStream, commandBuffer, pLabelInfo);
 }
 
@@ -8399,8 +8110,7 @@ VkResult goldfish_frontend_vkCreateDebugUtilsMessengerEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateDebugUtilsMessengerEXT(vkStream, instance, pCreateInfo, pAllocator, pMessenger);
     return res;
 }
@@ -8425,8 +8135,7 @@ void goldfish_frontend_vkDestroyDebugUtilsMessengerEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyDebugUtilsMessengerEXT(vkStream, instance, messenger, pAllocator);
 }
 
@@ -8452,8 +8161,7 @@ void goldfish_frontend_vkSubmitDebugUtilsMessageEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkSubmitDebugUtilsMessageEXT(vkStream, instance, messageSeverity, messageTypes, pCallbackData);
 }
 
@@ -8481,8 +8189,7 @@ VkResult goldfish_frontend_vkGetAndroidHardwareBufferPropertiesANDROID(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetAndroidHardwareBufferPropertiesANDROID(vkStream, device, buffer, pProperties);
     return res;
 }
@@ -8507,8 +8214,7 @@ VkResult goldfish_frontend_vkGetMemoryAndroidHardwareBufferANDROID(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetMemoryAndroidHardwareBufferANDROID(vkStream, device, pInfo, pBuffer);
     return res;
 }
@@ -8555,8 +8261,7 @@ void goldfish_frontend_vkCmdSetSampleLocationsEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetSampleLocationsEXT(vkStream, commandBuffer, pSampleLocationsInfo);
 }
 
@@ -8580,8 +8285,7 @@ void goldfish_frontend_vkGetPhysicalDeviceMultisamplePropertiesEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetPhysicalDeviceMultisamplePropertiesEXT(vkStream, physicalDevice, samples, pMultisampleProperties);
 }
 
@@ -8631,8 +8335,7 @@ VkResult goldfish_frontend_vkCreateValidationCacheEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkCreateValidationCacheEXT(vkStream, device, pCreateInfo, pAllocator, pValidationCache);
     return res;
 }
@@ -8657,8 +8360,7 @@ void goldfish_frontend_vkDestroyValidationCacheEXT(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkDestroyValidationCacheEXT(vkStream, device, validationCache, pAllocator);
 }
 
@@ -8684,8 +8386,7 @@ VkResult goldfish_frontend_vkMergeValidationCachesEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkMergeValidationCachesEXT(vkStream, device, dstCache, srcCacheCount, pSrcCaches);
     return res;
 }
@@ -8712,8 +8413,7 @@ VkResult goldfish_frontend_vkGetValidationCacheDataEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetValidationCacheDataEXT(vkStream, device, validationCache, pDataSize, pData);
     return res;
 }
@@ -8756,8 +8456,7 @@ VkResult goldfish_frontend_vkGetMemoryHostPointerPropertiesEXT(
     {
         return validateResult;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     VkResult res = encode_vkGetMemoryHostPointerPropertiesEXT(vkStream, device, handleType, pHostPointer, pMemoryHostPointerProperties);
     return res;
 }
@@ -8790,8 +8489,7 @@ void goldfish_frontend_vkCmdWriteBufferMarkerAMD(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdWriteBufferMarkerAMD(vkStream, commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
 }
 
@@ -8829,8 +8527,7 @@ void goldfish_frontend_vkCmdSetCheckpointNV(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkCmdSetCheckpointNV(vkStream, commandBuffer, pCheckpointMarker);
 }
 
@@ -8854,8 +8551,7 @@ void goldfish_frontend_vkGetQueueCheckpointDataNV(
     {
         return;
     }
-    // VULKAN_STREAM_GET();
-    void* vkStream = 0;
+    VulkanStream* vkStream = sGetVulkanStream();
     encode_vkGetQueueCheckpointDataNV(vkStream, queue, pCheckpointDataCount, pCheckpointData);
 }
 
@@ -1,8 +1,18 @@
 // Module: goldfish_vk_frontend (header) Autogenerated by CerealGenerator
 
 
+#pragma once
+
 #include <vulkan.h>
 
+namespace goldfish_vk {
+class VulkanStream;
+}  // namespace goldfish_vk
+
+// Sets the function that returns the stream of the current thread, which the
+// entry points below encode their calls into.
+void goldfish_vk_set_stream_accessor(goldfish_vk::VulkanStream* (*getStream)());
+
 #ifdef VK_VERSION_1_0
 
 VkResult goldfish_frontend_vkCreateInstance(
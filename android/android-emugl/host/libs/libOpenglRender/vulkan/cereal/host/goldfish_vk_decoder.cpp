@@ -0,0 +1,10347 @@
+// Module: goldfish_vk_decoder (impl) Autogenerated by CerealGenerator
+
+
+#include "goldfish_vk_decoder.h"
+
+#include "common/goldfish_vk_marshaling.h"
+#include "common/goldfish_vk_opcodes.h"
+#include "goldfish_vk_dispatch.h"
+#include "VulkanHandleTable.h"
+#include "VulkanStream.h"
+
+#include "android/base/memory/LazyInstance.h"
+#include "android/base/synchronization/Lock.h"
+
+#include "ErrorLog.h"
+#include "OpenglRender/IOStream.h"
+
+#include <string.h>
+
+namespace goldfish_vk {
+
+using android::base::LazyInstance;
+using android::base::ReadWriteLock;
+
+static constexpr size_t kPacketHeaderSize = 8;
+
+
+struct HandleTables {
+    ReadWriteLock lock;
+#ifdef VK_VERSION_1_0
+    VulkanHandleTable<VkInstance> table_VkInstance;
+    VulkanHandleTable<VkPhysicalDevice> table_VkPhysicalDevice;
+    VulkanHandleTable<VkDevice> table_VkDevice;
+    VulkanHandleTable<VkQueue> table_VkQueue;
+    VulkanHandleTable<VkSemaphore> table_VkSemaphore;
+    VulkanHandleTable<VkCommandBuffer> table_VkCommandBuffer;
+    VulkanHandleTable<VkFence> table_VkFence;
+    VulkanHandleTable<VkDeviceMemory> table_VkDeviceMemory;
+    VulkanHandleTable<VkBuffer> table_VkBuffer;
+    VulkanHandleTable<VkImage> table_VkImage;
+    VulkanHandleTable<VkEvent> table_VkEvent;
+    VulkanHandleTable<VkQueryPool> table_VkQueryPool;
+    VulkanHandleTable<VkBufferView> table_VkBufferView;
+    VulkanHandleTable<VkImageView> table_VkImageView;
+    VulkanHandleTable<VkShaderModule> table_VkShaderModule;
+    VulkanHandleTable<VkPipelineCache> table_VkPipelineCache;
+    VulkanHandleTable<VkPipelineLayout> table_VkPipelineLayout;
+    VulkanHandleTable<VkRenderPass> table_VkRenderPass;
+    VulkanHandleTable<VkPipeline> table_VkPipeline;
+    VulkanHandleTable<VkDescriptorSetLayout> table_VkDescriptorSetLayout;
+    VulkanHandleTable<VkSampler> table_VkSampler;
+    VulkanHandleTable<VkDescriptorPool> table_VkDescriptorPool;
+    VulkanHandleTable<VkDescriptorSet> table_VkDescriptorSet;
+    VulkanHandleTable<VkFramebuffer> table_VkFramebuffer;
+    VulkanHandleTable<VkCommandPool> table_VkCommandPool;
+#endif
+#ifdef VK_VERSION_1_1
+    VulkanHandleTable<VkSamplerYcbcrConversion> table_VkSamplerYcbcrConversion;
+    VulkanHandleTable<VkDescriptorUpdateTemplate> table_VkDescriptorUpdateTemplate;
+#endif
+#ifdef VK_KHR_surface
+    VulkanHandleTable<VkSurfaceKHR> table_VkSurfaceKHR;
+#endif
+#ifdef VK_KHR_swapchain
+    VulkanHandleTable<VkSwapchainKHR> table_VkSwapchainKHR;
+#endif
+#ifdef VK_KHR_display
+    VulkanHandleTable<VkDisplayKHR> table_VkDisplayKHR;
+    VulkanHandleTable<VkDisplayModeKHR> table_VkDisplayModeKHR;
+#endif
+#ifdef VK_EXT_debug_report
+    VulkanHandleTable<VkDebugReportCallbackEXT> table_VkDebugReportCallbackEXT;
+#endif
+#ifdef VK_NVX_device_generated_commands
+    VulkanHandleTable<VkObjectTableNVX> table_VkObjectTableNVX;
+    VulkanHandleTable<VkIndirectCommandsLayoutNVX> table_VkIndirectCommandsLayoutNVX;
+#endif
+#ifdef VK_EXT_debug_utils
+    VulkanHandleTable<VkDebugUtilsMessengerEXT> table_VkDebugUtilsMessengerEXT;
+#endif
+#ifdef VK_EXT_validation_cache
+    VulkanHandleTable<VkValidationCacheEXT> table_VkValidationCacheEXT;
+#endif
+};
+
+static LazyInstance<HandleTables> sHandleTables = LAZY_INSTANCE_INIT;
+
+// The lock a decoder holds on the handle tables. Calls that only look up
+// handles keep holding it for reading from one to the next, so that a chunk
+// of them takes it once.
+class HandleTablesLock {
+public:
+    explicit HandleTablesLock(ReadWriteLock& lock) : mLock(lock) {}
+    ~HandleTablesLock() { unlock(); }
+
+    void read() {
+        if (mState != Read) {
+            unlock();
+            mLock.lockRead();
+            mState = Read;
+        }
+    }
+
+    void write() {
+        if (mState != Write) {
+            unlock();
+            mLock.lockWrite();
+            mState = Write;
+        }
+    }
+
+    void unlock() {
+        if (mState == Read) {
+            mLock.unlockRead();
+        } else if (mState == Write) {
+            mLock.unlockWrite();
+        }
+        mState = Unlocked;
+    }
+
+private:
+    enum State { Unlocked, Read, Write };
+
+    ReadWriteLock& mLock;
+    State mState = Unlocked;
+};
+
+// Handles written to the stream are added to the tables, which needs the
+// write lock, and ids read from it must be in the tables.
+class DecoderHandleMapping : public VulkanHandleMapping {
+public:
+    explicit DecoderHandleMapping(HandleTables* tables) : mTables(tables) {}
+
+#ifdef VK_VERSION_1_0
+    uint64_t toWire_VkInstance(VkInstance handle) override {
+        return mTables->table_VkInstance.add(handle);
+    }
+    VkInstance fromWire_VkInstance(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkInstance handle = mTables->table_VkInstance.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkPhysicalDevice(VkPhysicalDevice handle) override {
+        return mTables->table_VkPhysicalDevice.add(handle);
+    }
+    VkPhysicalDevice fromWire_VkPhysicalDevice(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkPhysicalDevice handle = mTables->table_VkPhysicalDevice.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkDevice(VkDevice handle) override {
+        return mTables->table_VkDevice.add(handle);
+    }
+    VkDevice fromWire_VkDevice(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDevice handle = mTables->table_VkDevice.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkQueue(VkQueue handle) override {
+        return mTables->table_VkQueue.add(handle);
+    }
+    VkQueue fromWire_VkQueue(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkQueue handle = mTables->table_VkQueue.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkSemaphore(VkSemaphore handle) override {
+        return mTables->table_VkSemaphore.add(handle);
+    }
+    VkSemaphore fromWire_VkSemaphore(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkSemaphore handle = mTables->table_VkSemaphore.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkCommandBuffer(VkCommandBuffer handle) override {
+        return mTables->table_VkCommandBuffer.add(handle);
+    }
+    VkCommandBuffer fromWire_VkCommandBuffer(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkCommandBuffer handle = mTables->table_VkCommandBuffer.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkFence(VkFence handle) override {
+        return mTables->table_VkFence.add(handle);
+    }
+    VkFence fromWire_VkFence(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkFence handle = mTables->table_VkFence.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkDeviceMemory(VkDeviceMemory handle) override {
+        return mTables->table_VkDeviceMemory.add(handle);
+    }
+    VkDeviceMemory fromWire_VkDeviceMemory(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDeviceMemory handle = mTables->table_VkDeviceMemory.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkBuffer(VkBuffer handle) override {
+        return mTables->table_VkBuffer.add(handle);
+    }
+    VkBuffer fromWire_VkBuffer(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkBuffer handle = mTables->table_VkBuffer.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkImage(VkImage handle) override {
+        return mTables->table_VkImage.add(handle);
+    }
+    VkImage fromWire_VkImage(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkImage handle = mTables->table_VkImage.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkEvent(VkEvent handle) override {
+        return mTables->table_VkEvent.add(handle);
+    }
+    VkEvent fromWire_VkEvent(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkEvent handle = mTables->table_VkEvent.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkQueryPool(VkQueryPool handle) override {
+        return mTables->table_VkQueryPool.add(handle);
+    }
+    VkQueryPool fromWire_VkQueryPool(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkQueryPool handle = mTables->table_VkQueryPool.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkBufferView(VkBufferView handle) override {
+        return mTables->table_VkBufferView.add(handle);
+    }
+    VkBufferView fromWire_VkBufferView(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkBufferView handle = mTables->table_VkBufferView.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkImageView(VkImageView handle) override {
+        return mTables->table_VkImageView.add(handle);
+    }
+    VkImageView fromWire_VkImageView(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkImageView handle = mTables->table_VkImageView.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkShaderModule(VkShaderModule handle) override {
+        return mTables->table_VkShaderModule.add(handle);
+    }
+    VkShaderModule fromWire_VkShaderModule(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkShaderModule handle = mTables->table_VkShaderModule.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkPipelineCache(VkPipelineCache handle) override {
+        return mTables->table_VkPipelineCache.add(handle);
+    }
+    VkPipelineCache fromWire_VkPipelineCache(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkPipelineCache handle = mTables->table_VkPipelineCache.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkPipelineLayout(VkPipelineLayout handle) override {
+        return mTables->table_VkPipelineLayout.add(handle);
+    }
+    VkPipelineLayout fromWire_VkPipelineLayout(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkPipelineLayout handle = mTables->table_VkPipelineLayout.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkRenderPass(VkRenderPass handle) override {
+        return mTables->table_VkRenderPass.add(handle);
+    }
+    VkRenderPass fromWire_VkRenderPass(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkRenderPass handle = mTables->table_VkRenderPass.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkPipeline(VkPipeline handle) override {
+        return mTables->table_VkPipeline.add(handle);
+    }
+    VkPipeline fromWire_VkPipeline(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkPipeline handle = mTables->table_VkPipeline.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkDescriptorSetLayout(VkDescriptorSetLayout handle) override {
+        return mTables->table_VkDescriptorSetLayout.add(handle);
+    }
+    VkDescriptorSetLayout fromWire_VkDescriptorSetLayout(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDescriptorSetLayout handle = mTables->table_VkDescriptorSetLayout.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkSampler(VkSampler handle) override {
+        return mTables->table_VkSampler.add(handle);
+    }
+    VkSampler fromWire_VkSampler(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkSampler handle = mTables->table_VkSampler.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkDescriptorPool(VkDescriptorPool handle) override {
+        return mTables->table_VkDescriptorPool.add(handle);
+    }
+    VkDescriptorPool fromWire_VkDescriptorPool(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDescriptorPool handle = mTables->table_VkDescriptorPool.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkDescriptorSet(VkDescriptorSet handle) override {
+        return mTables->table_VkDescriptorSet.add(handle);
+    }
+    VkDescriptorSet fromWire_VkDescriptorSet(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDescriptorSet handle = mTables->table_VkDescriptorSet.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkFramebuffer(VkFramebuffer handle) override {
+        return mTables->table_VkFramebuffer.add(handle);
+    }
+    VkFramebuffer fromWire_VkFramebuffer(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkFramebuffer handle = mTables->table_VkFramebuffer.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkCommandPool(VkCommandPool handle) override {
+        return mTables->table_VkCommandPool.add(handle);
+    }
+    VkCommandPool fromWire_VkCommandPool(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkCommandPool handle = mTables->table_VkCommandPool.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+#endif
+#ifdef VK_VERSION_1_1
+    uint64_t toWire_VkSamplerYcbcrConversion(VkSamplerYcbcrConversion handle) override {
+        return mTables->table_VkSamplerYcbcrConversion.add(handle);
+    }
+    VkSamplerYcbcrConversion fromWire_VkSamplerYcbcrConversion(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkSamplerYcbcrConversion handle = mTables->table_VkSamplerYcbcrConversion.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkDescriptorUpdateTemplate(VkDescriptorUpdateTemplate handle) override {
+        return mTables->table_VkDescriptorUpdateTemplate.add(handle);
+    }
+    VkDescriptorUpdateTemplate fromWire_VkDescriptorUpdateTemplate(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDescriptorUpdateTemplate handle = mTables->table_VkDescriptorUpdateTemplate.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+#endif
+#ifdef VK_KHR_surface
+    uint64_t toWire_VkSurfaceKHR(VkSurfaceKHR handle) override {
+        return mTables->table_VkSurfaceKHR.add(handle);
+    }
+    VkSurfaceKHR fromWire_VkSurfaceKHR(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkSurfaceKHR handle = mTables->table_VkSurfaceKHR.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+#endif
+#ifdef VK_KHR_swapchain
+    uint64_t toWire_VkSwapchainKHR(VkSwapchainKHR handle) override {
+        return mTables->table_VkSwapchainKHR.add(handle);
+    }
+    VkSwapchainKHR fromWire_VkSwapchainKHR(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkSwapchainKHR handle = mTables->table_VkSwapchainKHR.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+#endif
+#ifdef VK_KHR_display
+    uint64_t toWire_VkDisplayKHR(VkDisplayKHR handle) override {
+        return mTables->table_VkDisplayKHR.add(handle);
+    }
+    VkDisplayKHR fromWire_VkDisplayKHR(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDisplayKHR handle = mTables->table_VkDisplayKHR.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkDisplayModeKHR(VkDisplayModeKHR handle) override {
+        return mTables->table_VkDisplayModeKHR.add(handle);
+    }
+    VkDisplayModeKHR fromWire_VkDisplayModeKHR(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDisplayModeKHR handle = mTables->table_VkDisplayModeKHR.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+#endif
+#ifdef VK_EXT_debug_report
+    uint64_t toWire_VkDebugReportCallbackEXT(VkDebugReportCallbackEXT handle) override {
+        return mTables->table_VkDebugReportCallbackEXT.add(handle);
+    }
+    VkDebugReportCallbackEXT fromWire_VkDebugReportCallbackEXT(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDebugReportCallbackEXT handle = mTables->table_VkDebugReportCallbackEXT.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+#endif
+#ifdef VK_NVX_device_generated_commands
+    uint64_t toWire_VkObjectTableNVX(VkObjectTableNVX handle) override {
+        return mTables->table_VkObjectTableNVX.add(handle);
+    }
+    VkObjectTableNVX fromWire_VkObjectTableNVX(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkObjectTableNVX handle = mTables->table_VkObjectTableNVX.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+    uint64_t toWire_VkIndirectCommandsLayoutNVX(VkIndirectCommandsLayoutNVX handle) override {
+        return mTables->table_VkIndirectCommandsLayoutNVX.add(handle);
+    }
+    VkIndirectCommandsLayoutNVX fromWire_VkIndirectCommandsLayoutNVX(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkIndirectCommandsLayoutNVX handle = mTables->table_VkIndirectCommandsLayoutNVX.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+#endif
+#ifdef VK_EXT_debug_utils
+    uint64_t toWire_VkDebugUtilsMessengerEXT(VkDebugUtilsMessengerEXT handle) override {
+        return mTables->table_VkDebugUtilsMessengerEXT.add(handle);
+    }
+    VkDebugUtilsMessengerEXT fromWire_VkDebugUtilsMessengerEXT(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkDebugUtilsMessengerEXT handle = mTables->table_VkDebugUtilsMessengerEXT.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+#endif
+#ifdef VK_EXT_validation_cache
+    uint64_t toWire_VkValidationCacheEXT(VkValidationCacheEXT handle) override {
+        return mTables->table_VkValidationCacheEXT.add(handle);
+    }
+    VkValidationCacheEXT fromWire_VkValidationCacheEXT(VulkanStream* vkStream, uint64_t id) override {
+        bool valid = true;
+        VkValidationCacheEXT handle = mTables->table_VkValidationCacheEXT.get(id, &valid);
+        if (!valid) {
+            vkStream->setError();
+        }
+        return handle;
+    }
+#endif
+
+private:
+    HandleTables* mTables;
+};
+
+class VkDecoder::Impl {
+public:
+    explicit Impl(const VulkanDispatch* vk)
+        : m_vk(vk),
+          m_tables(sHandleTables.ptr()),
+          m_lock(m_tables->lock),
+          m_handleMapping(m_tables),
+          m_vkStream(nullptr, &m_handleMapping) {}
+
+    size_t decode(void* buf, size_t bufsize, IOStream* ioStream);
+
+private:
+    void onFailedCall(const char* name);
+    void sendReply(IOStream* ioStream);
+
+    const VulkanDispatch* m_vk;
+    HandleTables* m_tables;
+    HandleTablesLock m_lock;
+    DecoderHandleMapping m_handleMapping;
+    VulkanStream m_vkStream;
+};
+
+void VkDecoder::Impl::onFailedCall(const char* name)
+{
+    ERR("VkDecoder: %s: %s\n", name,
+        m_vkStream.error() ? "malformed packet"
+                           : "not supported by the host driver");
+}
+
+void VkDecoder::Impl::sendReply(IOStream* ioStream)
+{
+    const std::vector<uint8_t>& reply = m_vkStream.endReply();
+    unsigned char* dst = ioStream->alloc(reply.size());
+    if (!dst)
+    {
+        ERR("VkDecoder: cannot allocate a reply of %zu bytes\n", reply.size());
+        return;
+    }
+    memcpy(dst, reply.data(), reply.size());
+    ioStream->flush();
+}
+
+size_t VkDecoder::Impl::decode(void* buf, size_t bufsize, IOStream* ioStream)
+{
+    VulkanStream* vkStream = &m_vkStream;
+    const unsigned char* ptr = (const unsigned char*)buf;
+    const unsigned char* const end = ptr + bufsize;
+    while (end - ptr >= (ptrdiff_t)kPacketHeaderSize)
+    {
+        uint32_t opcode;
+        uint32_t packetSize;
+        memcpy(&opcode, ptr, sizeof(opcode));
+        memcpy(&packetSize, ptr + 4, sizeof(packetSize));
+        if (packetSize < kPacketHeaderSize)
+        {
+            ERR("VkDecoder: bad packet size %u, dropping %zu bytes\n",
+                packetSize, (size_t)(end - ptr));
+            ptr = end;
+            break;
+        }
+        if ((size_t)(end - ptr) < packetSize)
+        {
+            break;
+        }
+        vkStream->setReadBuffer(ptr + kPacketHeaderSize, packetSize - kPacketHeaderSize);
+        switch (opcode)
+        {
+#ifdef VK_VERSION_1_0
+            case OP_vkCreateInstance:
+            {
+                m_lock.read();
+                VkInstanceCreateInfo* pCreateInfo = nullptr;
+                VkInstance* pInstance = nullptr;
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkInstanceCreateInfo*)vkStream->allocArray(1, sizeof(VkInstanceCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkInstanceCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pInstance = (VkInstance*)vkStream->allocArray(1, sizeof(VkInstance));
+                }
+                m_lock.unlock();
+                VkResult vkCreateInstance_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateInstance)
+                {
+                    vkCreateInstance_VkResult_return = m_vk->vkCreateInstance(pCreateInfo, nullptr, pInstance);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateInstance");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateInstance_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateInstance_VkResult_return >= 0)
+                {
+                    if (pInstance)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkInstance(*pInstance));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyInstance:
+            {
+                m_lock.read();
+                VkInstance instance;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyInstance)
+                {
+                    m_vk->vkDestroyInstance(instance, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkInstance.remove(instance);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyInstance");
+                }
+                break;
+            }
+            case OP_vkEnumeratePhysicalDevices:
+            {
+                m_lock.read();
+                VkInstance instance;
+                uint32_t* pPhysicalDeviceCount = nullptr;
+                VkPhysicalDevice* pPhysicalDevices = nullptr;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPhysicalDeviceCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPhysicalDeviceCount)
+                    {
+                        vkStream->read(pPhysicalDeviceCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPhysicalDevices = (VkPhysicalDevice*)vkStream->allocArray((pPhysicalDeviceCount ? *pPhysicalDeviceCount : 0), sizeof(VkPhysicalDevice));
+                }
+                m_lock.unlock();
+                VkResult vkEnumeratePhysicalDevices_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkEnumeratePhysicalDevices)
+                {
+                    vkEnumeratePhysicalDevices_VkResult_return = m_vk->vkEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkEnumeratePhysicalDevices");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkEnumeratePhysicalDevices_VkResult_return, sizeof(VkResult));
+                if (called && vkEnumeratePhysicalDevices_VkResult_return >= 0)
+                {
+                    if (pPhysicalDeviceCount)
+                    {
+                        vkStream->write(pPhysicalDeviceCount, sizeof(uint32_t));
+                    }
+                    if (pPhysicalDevices)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceCount ? *pPhysicalDeviceCount : 0); ++i)
+                        {
+                            vkStream->putU64(vkStream->handleMapping()->toWire_VkPhysicalDevice(pPhysicalDevices[i]));
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceFeatures:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceFeatures* pFeatures = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pFeatures = (VkPhysicalDeviceFeatures*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceFeatures));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceFeatures)
+                {
+                    m_vk->vkGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceFeatures");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pFeatures)
+                    {
+                        marshal_VkPhysicalDeviceFeatures(vkStream, pFeatures);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceFormatProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkFormat format;
+                VkFormatProperties* pFormatProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&format, sizeof(VkFormat));
+                if (vkStream->getU32())
+                {
+                    pFormatProperties = (VkFormatProperties*)vkStream->allocArray(1, sizeof(VkFormatProperties));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceFormatProperties)
+                {
+                    m_vk->vkGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceFormatProperties");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pFormatProperties)
+                    {
+                        marshal_VkFormatProperties(vkStream, pFormatProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceImageFormatProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkFormat format;
+                VkImageType type;
+                VkImageTiling tiling;
+                VkImageUsageFlags usage;
+                VkImageCreateFlags flags;
+                VkImageFormatProperties* pImageFormatProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&format, sizeof(VkFormat));
+                vkStream->read(&type, sizeof(VkImageType));
+                vkStream->read(&tiling, sizeof(VkImageTiling));
+                vkStream->read(&usage, sizeof(VkImageUsageFlags));
+                vkStream->read(&flags, sizeof(VkImageCreateFlags));
+                if (vkStream->getU32())
+                {
+                    pImageFormatProperties = (VkImageFormatProperties*)vkStream->allocArray(1, sizeof(VkImageFormatProperties));
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceImageFormatProperties_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceImageFormatProperties)
+                {
+                    vkGetPhysicalDeviceImageFormatProperties_VkResult_return = m_vk->vkGetPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceImageFormatProperties");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceImageFormatProperties_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceImageFormatProperties_VkResult_return >= 0)
+                {
+                    if (pImageFormatProperties)
+                    {
+                        marshal_VkImageFormatProperties(vkStream, pImageFormatProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceProperties* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkPhysicalDeviceProperties*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceProperties));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceProperties)
+                {
+                    m_vk->vkGetPhysicalDeviceProperties(physicalDevice, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceProperties");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pProperties)
+                    {
+                        marshal_VkPhysicalDeviceProperties(vkStream, pProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceQueueFamilyProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                uint32_t* pQueueFamilyPropertyCount = nullptr;
+                VkQueueFamilyProperties* pQueueFamilyProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pQueueFamilyPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pQueueFamilyPropertyCount)
+                    {
+                        vkStream->read(pQueueFamilyPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pQueueFamilyProperties = (VkQueueFamilyProperties*)vkStream->allocArray((pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0), sizeof(VkQueueFamilyProperties));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceQueueFamilyProperties)
+                {
+                    m_vk->vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceQueueFamilyProperties");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pQueueFamilyPropertyCount)
+                    {
+                        vkStream->write(pQueueFamilyPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pQueueFamilyProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+                        {
+                            marshal_VkQueueFamilyProperties(vkStream, pQueueFamilyProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceMemoryProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceMemoryProperties* pMemoryProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pMemoryProperties = (VkPhysicalDeviceMemoryProperties*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceMemoryProperties));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceMemoryProperties)
+                {
+                    m_vk->vkGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceMemoryProperties");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMemoryProperties)
+                    {
+                        marshal_VkPhysicalDeviceMemoryProperties(vkStream, pMemoryProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateDevice:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkDeviceCreateInfo* pCreateInfo = nullptr;
+                VkDevice* pDevice = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkDeviceCreateInfo*)vkStream->allocArray(1, sizeof(VkDeviceCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkDeviceCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pDevice = (VkDevice*)vkStream->allocArray(1, sizeof(VkDevice));
+                }
+                m_lock.unlock();
+                VkResult vkCreateDevice_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateDevice)
+                {
+                    vkCreateDevice_VkResult_return = m_vk->vkCreateDevice(physicalDevice, pCreateInfo, nullptr, pDevice);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateDevice");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateDevice_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateDevice_VkResult_return >= 0)
+                {
+                    if (pDevice)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkDevice(*pDevice));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyDevice:
+            {
+                m_lock.read();
+                VkDevice device;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyDevice)
+                {
+                    m_vk->vkDestroyDevice(device, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkDevice.remove(device);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyDevice");
+                }
+                break;
+            }
+            case OP_vkEnumerateInstanceExtensionProperties:
+            {
+                m_lock.read();
+                char* pLayerName = nullptr;
+                uint32_t* pPropertyCount = nullptr;
+                VkExtensionProperties* pProperties = nullptr;
+                pLayerName = vkStream->getString();
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkExtensionProperties*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkExtensionProperties));
+                }
+                m_lock.unlock();
+                VkResult vkEnumerateInstanceExtensionProperties_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkEnumerateInstanceExtensionProperties)
+                {
+                    vkEnumerateInstanceExtensionProperties_VkResult_return = m_vk->vkEnumerateInstanceExtensionProperties(pLayerName, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkEnumerateInstanceExtensionProperties");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkEnumerateInstanceExtensionProperties_VkResult_return, sizeof(VkResult));
+                if (called && vkEnumerateInstanceExtensionProperties_VkResult_return >= 0)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkExtensionProperties(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkEnumerateDeviceExtensionProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                char* pLayerName = nullptr;
+                uint32_t* pPropertyCount = nullptr;
+                VkExtensionProperties* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                pLayerName = vkStream->getString();
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkExtensionProperties*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkExtensionProperties));
+                }
+                m_lock.unlock();
+                VkResult vkEnumerateDeviceExtensionProperties_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkEnumerateDeviceExtensionProperties)
+                {
+                    vkEnumerateDeviceExtensionProperties_VkResult_return = m_vk->vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkEnumerateDeviceExtensionProperties");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkEnumerateDeviceExtensionProperties_VkResult_return, sizeof(VkResult));
+                if (called && vkEnumerateDeviceExtensionProperties_VkResult_return >= 0)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkExtensionProperties(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkEnumerateInstanceLayerProperties:
+            {
+                m_lock.read();
+                uint32_t* pPropertyCount = nullptr;
+                VkLayerProperties* pProperties = nullptr;
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkLayerProperties*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkLayerProperties));
+                }
+                m_lock.unlock();
+                VkResult vkEnumerateInstanceLayerProperties_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkEnumerateInstanceLayerProperties)
+                {
+                    vkEnumerateInstanceLayerProperties_VkResult_return = m_vk->vkEnumerateInstanceLayerProperties(pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkEnumerateInstanceLayerProperties");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkEnumerateInstanceLayerProperties_VkResult_return, sizeof(VkResult));
+                if (called && vkEnumerateInstanceLayerProperties_VkResult_return >= 0)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkLayerProperties(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkEnumerateDeviceLayerProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                uint32_t* pPropertyCount = nullptr;
+                VkLayerProperties* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkLayerProperties*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkLayerProperties));
+                }
+                m_lock.unlock();
+                VkResult vkEnumerateDeviceLayerProperties_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkEnumerateDeviceLayerProperties)
+                {
+                    vkEnumerateDeviceLayerProperties_VkResult_return = m_vk->vkEnumerateDeviceLayerProperties(physicalDevice, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkEnumerateDeviceLayerProperties");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkEnumerateDeviceLayerProperties_VkResult_return, sizeof(VkResult));
+                if (called && vkEnumerateDeviceLayerProperties_VkResult_return >= 0)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkLayerProperties(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDeviceQueue:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t queueFamilyIndex;
+                uint32_t queueIndex;
+                VkQueue* pQueue = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&queueFamilyIndex, sizeof(uint32_t));
+                vkStream->read(&queueIndex, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pQueue = (VkQueue*)vkStream->allocArray(1, sizeof(VkQueue));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDeviceQueue)
+                {
+                    m_vk->vkGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDeviceQueue");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pQueue)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkQueue(*pQueue));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkQueueSubmit:
+            {
+                m_lock.read();
+                VkQueue queue;
+                uint32_t submitCount;
+                VkSubmitInfo* pSubmits = nullptr;
+                VkFence fence;
+                queue = vkStream->handleMapping()->fromWire_VkQueue(vkStream, vkStream->getU64());
+                vkStream->read(&submitCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pSubmits = (VkSubmitInfo*)vkStream->allocArray(submitCount, sizeof(VkSubmitInfo));
+                    if (pSubmits)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)submitCount; ++i)
+                        {
+                            unmarshal_VkSubmitInfo(vkStream, pSubmits + i);
+                        }
+                    }
+                }
+                fence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkQueueSubmit_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkQueueSubmit)
+                {
+                    vkQueueSubmit_VkResult_return = m_vk->vkQueueSubmit(queue, submitCount, pSubmits, fence);
+                }
+                else
+                {
+                    onFailedCall("vkQueueSubmit");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkQueueSubmit_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkQueueWaitIdle:
+            {
+                m_lock.read();
+                VkQueue queue;
+                queue = vkStream->handleMapping()->fromWire_VkQueue(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkQueueWaitIdle_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkQueueWaitIdle)
+                {
+                    vkQueueWaitIdle_VkResult_return = m_vk->vkQueueWaitIdle(queue);
+                }
+                else
+                {
+                    onFailedCall("vkQueueWaitIdle");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkQueueWaitIdle_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDeviceWaitIdle:
+            {
+                m_lock.read();
+                VkDevice device;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkDeviceWaitIdle_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkDeviceWaitIdle)
+                {
+                    vkDeviceWaitIdle_VkResult_return = m_vk->vkDeviceWaitIdle(device);
+                }
+                else
+                {
+                    onFailedCall("vkDeviceWaitIdle");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkDeviceWaitIdle_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkAllocateMemory:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkMemoryAllocateInfo* pAllocateInfo = nullptr;
+                VkDeviceMemory* pMemory = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pAllocateInfo = (VkMemoryAllocateInfo*)vkStream->allocArray(1, sizeof(VkMemoryAllocateInfo));
+                    if (pAllocateInfo)
+                    {
+                        unmarshal_VkMemoryAllocateInfo(vkStream, pAllocateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pMemory = (VkDeviceMemory*)vkStream->allocArray(1, sizeof(VkDeviceMemory));
+                }
+                m_lock.unlock();
+                VkResult vkAllocateMemory_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkAllocateMemory)
+                {
+                    vkAllocateMemory_VkResult_return = m_vk->vkAllocateMemory(device, pAllocateInfo, nullptr, pMemory);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkAllocateMemory");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkAllocateMemory_VkResult_return, sizeof(VkResult));
+                if (called && vkAllocateMemory_VkResult_return >= 0)
+                {
+                    if (pMemory)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkDeviceMemory(*pMemory));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkFreeMemory:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDeviceMemory memory;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkFreeMemory)
+                {
+                    m_vk->vkFreeMemory(device, memory, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkDeviceMemory.remove(memory);
+                }
+                else
+                {
+                    onFailedCall("vkFreeMemory");
+                }
+                break;
+            }
+            case OP_vkFlushMappedMemoryRanges:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t memoryRangeCount;
+                VkMappedMemoryRange* pMemoryRanges = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&memoryRangeCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pMemoryRanges = (VkMappedMemoryRange*)vkStream->allocArray(memoryRangeCount, sizeof(VkMappedMemoryRange));
+                    if (pMemoryRanges)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)memoryRangeCount; ++i)
+                        {
+                            unmarshal_VkMappedMemoryRange(vkStream, pMemoryRanges + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkFlushMappedMemoryRanges_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkFlushMappedMemoryRanges)
+                {
+                    vkFlushMappedMemoryRanges_VkResult_return = m_vk->vkFlushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+                }
+                else
+                {
+                    onFailedCall("vkFlushMappedMemoryRanges");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkFlushMappedMemoryRanges_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkInvalidateMappedMemoryRanges:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t memoryRangeCount;
+                VkMappedMemoryRange* pMemoryRanges = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&memoryRangeCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pMemoryRanges = (VkMappedMemoryRange*)vkStream->allocArray(memoryRangeCount, sizeof(VkMappedMemoryRange));
+                    if (pMemoryRanges)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)memoryRangeCount; ++i)
+                        {
+                            unmarshal_VkMappedMemoryRange(vkStream, pMemoryRanges + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkInvalidateMappedMemoryRanges_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkInvalidateMappedMemoryRanges)
+                {
+                    vkInvalidateMappedMemoryRanges_VkResult_return = m_vk->vkInvalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+                }
+                else
+                {
+                    onFailedCall("vkInvalidateMappedMemoryRanges");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkInvalidateMappedMemoryRanges_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDeviceMemoryCommitment:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDeviceMemory memory;
+                VkDeviceSize* pCommittedMemoryInBytes = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCommittedMemoryInBytes = (VkDeviceSize*)vkStream->allocArray(1, sizeof(VkDeviceSize));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDeviceMemoryCommitment)
+                {
+                    m_vk->vkGetDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDeviceMemoryCommitment");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pCommittedMemoryInBytes)
+                    {
+                        vkStream->write(pCommittedMemoryInBytes, sizeof(VkDeviceSize));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkBindBufferMemory:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkBuffer buffer;
+                VkDeviceMemory memory;
+                VkDeviceSize memoryOffset;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+                vkStream->read(&memoryOffset, sizeof(VkDeviceSize));
+                m_lock.unlock();
+                VkResult vkBindBufferMemory_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkBindBufferMemory)
+                {
+                    vkBindBufferMemory_VkResult_return = m_vk->vkBindBufferMemory(device, buffer, memory, memoryOffset);
+                }
+                else
+                {
+                    onFailedCall("vkBindBufferMemory");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkBindBufferMemory_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkBindImageMemory:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImage image;
+                VkDeviceMemory memory;
+                VkDeviceSize memoryOffset;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                memory = vkStream->handleMapping()->fromWire_VkDeviceMemory(vkStream, vkStream->getU64());
+                vkStream->read(&memoryOffset, sizeof(VkDeviceSize));
+                m_lock.unlock();
+                VkResult vkBindImageMemory_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkBindImageMemory)
+                {
+                    vkBindImageMemory_VkResult_return = m_vk->vkBindImageMemory(device, image, memory, memoryOffset);
+                }
+                else
+                {
+                    onFailedCall("vkBindImageMemory");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkBindImageMemory_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetBufferMemoryRequirements:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkBuffer buffer;
+                VkMemoryRequirements* pMemoryRequirements = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pMemoryRequirements = (VkMemoryRequirements*)vkStream->allocArray(1, sizeof(VkMemoryRequirements));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetBufferMemoryRequirements)
+                {
+                    m_vk->vkGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetBufferMemoryRequirements");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMemoryRequirements)
+                    {
+                        marshal_VkMemoryRequirements(vkStream, pMemoryRequirements);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetImageMemoryRequirements:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImage image;
+                VkMemoryRequirements* pMemoryRequirements = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pMemoryRequirements = (VkMemoryRequirements*)vkStream->allocArray(1, sizeof(VkMemoryRequirements));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetImageMemoryRequirements)
+                {
+                    m_vk->vkGetImageMemoryRequirements(device, image, pMemoryRequirements);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetImageMemoryRequirements");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMemoryRequirements)
+                    {
+                        marshal_VkMemoryRequirements(vkStream, pMemoryRequirements);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetImageSparseMemoryRequirements:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImage image;
+                uint32_t* pSparseMemoryRequirementCount = nullptr;
+                VkSparseImageMemoryRequirements* pSparseMemoryRequirements = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSparseMemoryRequirementCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pSparseMemoryRequirementCount)
+                    {
+                        vkStream->read(pSparseMemoryRequirementCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSparseMemoryRequirements = (VkSparseImageMemoryRequirements*)vkStream->allocArray((pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0), sizeof(VkSparseImageMemoryRequirements));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetImageSparseMemoryRequirements)
+                {
+                    m_vk->vkGetImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetImageSparseMemoryRequirements");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pSparseMemoryRequirementCount)
+                    {
+                        vkStream->write(pSparseMemoryRequirementCount, sizeof(uint32_t));
+                    }
+                    if (pSparseMemoryRequirements)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+                        {
+                            marshal_VkSparseImageMemoryRequirements(vkStream, pSparseMemoryRequirements + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceSparseImageFormatProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkFormat format;
+                VkImageType type;
+                VkSampleCountFlagBits samples;
+                VkImageUsageFlags usage;
+                VkImageTiling tiling;
+                uint32_t* pPropertyCount = nullptr;
+                VkSparseImageFormatProperties* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&format, sizeof(VkFormat));
+                vkStream->read(&type, sizeof(VkImageType));
+                vkStream->read(&samples, sizeof(VkSampleCountFlagBits));
+                vkStream->read(&usage, sizeof(VkImageUsageFlags));
+                vkStream->read(&tiling, sizeof(VkImageTiling));
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkSparseImageFormatProperties*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkSparseImageFormatProperties));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSparseImageFormatProperties)
+                {
+                    m_vk->vkGetPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSparseImageFormatProperties");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkSparseImageFormatProperties(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkQueueBindSparse:
+            {
+                m_lock.read();
+                VkQueue queue;
+                uint32_t bindInfoCount;
+                VkBindSparseInfo* pBindInfo = nullptr;
+                VkFence fence;
+                queue = vkStream->handleMapping()->fromWire_VkQueue(vkStream, vkStream->getU64());
+                vkStream->read(&bindInfoCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pBindInfo = (VkBindSparseInfo*)vkStream->allocArray(bindInfoCount, sizeof(VkBindSparseInfo));
+                    if (pBindInfo)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+                        {
+                            unmarshal_VkBindSparseInfo(vkStream, pBindInfo + i);
+                        }
+                    }
+                }
+                fence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkQueueBindSparse_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkQueueBindSparse)
+                {
+                    vkQueueBindSparse_VkResult_return = m_vk->vkQueueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+                }
+                else
+                {
+                    onFailedCall("vkQueueBindSparse");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkQueueBindSparse_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateFence:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkFenceCreateInfo* pCreateInfo = nullptr;
+                VkFence* pFence = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkFenceCreateInfo*)vkStream->allocArray(1, sizeof(VkFenceCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkFenceCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pFence = (VkFence*)vkStream->allocArray(1, sizeof(VkFence));
+                }
+                m_lock.unlock();
+                VkResult vkCreateFence_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateFence)
+                {
+                    vkCreateFence_VkResult_return = m_vk->vkCreateFence(device, pCreateInfo, nullptr, pFence);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateFence");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateFence_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateFence_VkResult_return >= 0)
+                {
+                    if (pFence)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(*pFence));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyFence:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkFence fence;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                fence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyFence)
+                {
+                    m_vk->vkDestroyFence(device, fence, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkFence.remove(fence);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyFence");
+                }
+                break;
+            }
+            case OP_vkResetFences:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t fenceCount;
+                VkFence* pFences = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&fenceCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pFences = (VkFence*)vkStream->allocArray(fenceCount, sizeof(VkFence));
+                    if (pFences)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)fenceCount; ++i)
+                        {
+                            pFences[i] = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkResetFences_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkResetFences)
+                {
+                    vkResetFences_VkResult_return = m_vk->vkResetFences(device, fenceCount, pFences);
+                }
+                else
+                {
+                    onFailedCall("vkResetFences");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkResetFences_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetFenceStatus:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkFence fence;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                fence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkGetFenceStatus_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkGetFenceStatus)
+                {
+                    vkGetFenceStatus_VkResult_return = m_vk->vkGetFenceStatus(device, fence);
+                }
+                else
+                {
+                    onFailedCall("vkGetFenceStatus");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetFenceStatus_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkWaitForFences:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t fenceCount;
+                VkFence* pFences = nullptr;
+                VkBool32 waitAll;
+                uint64_t timeout;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&fenceCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pFences = (VkFence*)vkStream->allocArray(fenceCount, sizeof(VkFence));
+                    if (pFences)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)fenceCount; ++i)
+                        {
+                            pFences[i] = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                vkStream->read(&waitAll, sizeof(VkBool32));
+                vkStream->read(&timeout, sizeof(uint64_t));
+                m_lock.unlock();
+                VkResult vkWaitForFences_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkWaitForFences)
+                {
+                    vkWaitForFences_VkResult_return = m_vk->vkWaitForFences(device, fenceCount, pFences, waitAll, timeout);
+                }
+                else
+                {
+                    onFailedCall("vkWaitForFences");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkWaitForFences_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateSemaphore:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSemaphoreCreateInfo* pCreateInfo = nullptr;
+                VkSemaphore* pSemaphore = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkSemaphoreCreateInfo*)vkStream->allocArray(1, sizeof(VkSemaphoreCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkSemaphoreCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSemaphore = (VkSemaphore*)vkStream->allocArray(1, sizeof(VkSemaphore));
+                }
+                m_lock.unlock();
+                VkResult vkCreateSemaphore_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateSemaphore)
+                {
+                    vkCreateSemaphore_VkResult_return = m_vk->vkCreateSemaphore(device, pCreateInfo, nullptr, pSemaphore);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateSemaphore");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateSemaphore_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateSemaphore_VkResult_return >= 0)
+                {
+                    if (pSemaphore)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkSemaphore(*pSemaphore));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroySemaphore:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSemaphore semaphore;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                semaphore = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroySemaphore)
+                {
+                    m_vk->vkDestroySemaphore(device, semaphore, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkSemaphore.remove(semaphore);
+                }
+                else
+                {
+                    onFailedCall("vkDestroySemaphore");
+                }
+                break;
+            }
+            case OP_vkCreateEvent:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkEventCreateInfo* pCreateInfo = nullptr;
+                VkEvent* pEvent = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkEventCreateInfo*)vkStream->allocArray(1, sizeof(VkEventCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkEventCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pEvent = (VkEvent*)vkStream->allocArray(1, sizeof(VkEvent));
+                }
+                m_lock.unlock();
+                VkResult vkCreateEvent_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateEvent)
+                {
+                    vkCreateEvent_VkResult_return = m_vk->vkCreateEvent(device, pCreateInfo, nullptr, pEvent);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateEvent");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateEvent_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateEvent_VkResult_return >= 0)
+                {
+                    if (pEvent)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkEvent(*pEvent));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyEvent:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkEvent event;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                event = vkStream->handleMapping()->fromWire_VkEvent(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyEvent)
+                {
+                    m_vk->vkDestroyEvent(device, event, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkEvent.remove(event);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyEvent");
+                }
+                break;
+            }
+            case OP_vkGetEventStatus:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkEvent event;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                event = vkStream->handleMapping()->fromWire_VkEvent(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkGetEventStatus_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkGetEventStatus)
+                {
+                    vkGetEventStatus_VkResult_return = m_vk->vkGetEventStatus(device, event);
+                }
+                else
+                {
+                    onFailedCall("vkGetEventStatus");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetEventStatus_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkSetEvent:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkEvent event;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                event = vkStream->handleMapping()->fromWire_VkEvent(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkSetEvent_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkSetEvent)
+                {
+                    vkSetEvent_VkResult_return = m_vk->vkSetEvent(device, event);
+                }
+                else
+                {
+                    onFailedCall("vkSetEvent");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkSetEvent_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkResetEvent:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkEvent event;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                event = vkStream->handleMapping()->fromWire_VkEvent(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkResetEvent_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkResetEvent)
+                {
+                    vkResetEvent_VkResult_return = m_vk->vkResetEvent(device, event);
+                }
+                else
+                {
+                    onFailedCall("vkResetEvent");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkResetEvent_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateQueryPool:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkQueryPoolCreateInfo* pCreateInfo = nullptr;
+                VkQueryPool* pQueryPool = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkQueryPoolCreateInfo*)vkStream->allocArray(1, sizeof(VkQueryPoolCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkQueryPoolCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pQueryPool = (VkQueryPool*)vkStream->allocArray(1, sizeof(VkQueryPool));
+                }
+                m_lock.unlock();
+                VkResult vkCreateQueryPool_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateQueryPool)
+                {
+                    vkCreateQueryPool_VkResult_return = m_vk->vkCreateQueryPool(device, pCreateInfo, nullptr, pQueryPool);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateQueryPool");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateQueryPool_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateQueryPool_VkResult_return >= 0)
+                {
+                    if (pQueryPool)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkQueryPool(*pQueryPool));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyQueryPool:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkQueryPool queryPool;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                queryPool = vkStream->handleMapping()->fromWire_VkQueryPool(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyQueryPool)
+                {
+                    m_vk->vkDestroyQueryPool(device, queryPool, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkQueryPool.remove(queryPool);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyQueryPool");
+                }
+                break;
+            }
+            case OP_vkGetQueryPoolResults:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkQueryPool queryPool;
+                uint32_t firstQuery;
+                uint32_t queryCount;
+                size_t dataSize;
+                uint8_t* pData = nullptr;
+                VkDeviceSize stride;
+                VkQueryResultFlags flags;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                queryPool = vkStream->handleMapping()->fromWire_VkQueryPool(vkStream, vkStream->getU64());
+                vkStream->read(&firstQuery, sizeof(uint32_t));
+                vkStream->read(&queryCount, sizeof(uint32_t));
+                dataSize = (size_t)vkStream->getU64();
+                if (vkStream->getU32())
+                {
+                    pData = (uint8_t*)vkStream->allocArray(dataSize, sizeof(uint8_t));
+                }
+                vkStream->read(&stride, sizeof(VkDeviceSize));
+                vkStream->read(&flags, sizeof(VkQueryResultFlags));
+                m_lock.unlock();
+                VkResult vkGetQueryPoolResults_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetQueryPoolResults)
+                {
+                    vkGetQueryPoolResults_VkResult_return = m_vk->vkGetQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetQueryPoolResults");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetQueryPoolResults_VkResult_return, sizeof(VkResult));
+                if (called && vkGetQueryPoolResults_VkResult_return >= 0)
+                {
+                    if (pData)
+                    {
+                        vkStream->write(pData, dataSize * sizeof(uint8_t));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateBuffer:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkBufferCreateInfo* pCreateInfo = nullptr;
+                VkBuffer* pBuffer = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkBufferCreateInfo*)vkStream->allocArray(1, sizeof(VkBufferCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkBufferCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pBuffer = (VkBuffer*)vkStream->allocArray(1, sizeof(VkBuffer));
+                }
+                m_lock.unlock();
+                VkResult vkCreateBuffer_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateBuffer)
+                {
+                    vkCreateBuffer_VkResult_return = m_vk->vkCreateBuffer(device, pCreateInfo, nullptr, pBuffer);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateBuffer");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateBuffer_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateBuffer_VkResult_return >= 0)
+                {
+                    if (pBuffer)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkBuffer(*pBuffer));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyBuffer:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkBuffer buffer;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyBuffer)
+                {
+                    m_vk->vkDestroyBuffer(device, buffer, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkBuffer.remove(buffer);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyBuffer");
+                }
+                break;
+            }
+            case OP_vkCreateBufferView:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkBufferViewCreateInfo* pCreateInfo = nullptr;
+                VkBufferView* pView = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkBufferViewCreateInfo*)vkStream->allocArray(1, sizeof(VkBufferViewCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkBufferViewCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pView = (VkBufferView*)vkStream->allocArray(1, sizeof(VkBufferView));
+                }
+                m_lock.unlock();
+                VkResult vkCreateBufferView_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateBufferView)
+                {
+                    vkCreateBufferView_VkResult_return = m_vk->vkCreateBufferView(device, pCreateInfo, nullptr, pView);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateBufferView");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateBufferView_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateBufferView_VkResult_return >= 0)
+                {
+                    if (pView)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkBufferView(*pView));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyBufferView:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkBufferView bufferView;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                bufferView = vkStream->handleMapping()->fromWire_VkBufferView(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyBufferView)
+                {
+                    m_vk->vkDestroyBufferView(device, bufferView, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkBufferView.remove(bufferView);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyBufferView");
+                }
+                break;
+            }
+            case OP_vkCreateImage:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImageCreateInfo* pCreateInfo = nullptr;
+                VkImage* pImage = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkImageCreateInfo*)vkStream->allocArray(1, sizeof(VkImageCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkImageCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pImage = (VkImage*)vkStream->allocArray(1, sizeof(VkImage));
+                }
+                m_lock.unlock();
+                VkResult vkCreateImage_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateImage)
+                {
+                    vkCreateImage_VkResult_return = m_vk->vkCreateImage(device, pCreateInfo, nullptr, pImage);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateImage");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateImage_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateImage_VkResult_return >= 0)
+                {
+                    if (pImage)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(*pImage));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyImage:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImage image;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyImage)
+                {
+                    m_vk->vkDestroyImage(device, image, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkImage.remove(image);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyImage");
+                }
+                break;
+            }
+            case OP_vkGetImageSubresourceLayout:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImage image;
+                VkImageSubresource* pSubresource = nullptr;
+                VkSubresourceLayout* pLayout = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSubresource = (VkImageSubresource*)vkStream->allocArray(1, sizeof(VkImageSubresource));
+                    if (pSubresource)
+                    {
+                        unmarshal_VkImageSubresource(vkStream, pSubresource);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pLayout = (VkSubresourceLayout*)vkStream->allocArray(1, sizeof(VkSubresourceLayout));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetImageSubresourceLayout)
+                {
+                    m_vk->vkGetImageSubresourceLayout(device, image, pSubresource, pLayout);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetImageSubresourceLayout");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pLayout)
+                    {
+                        marshal_VkSubresourceLayout(vkStream, pLayout);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateImageView:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImageViewCreateInfo* pCreateInfo = nullptr;
+                VkImageView* pView = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkImageViewCreateInfo*)vkStream->allocArray(1, sizeof(VkImageViewCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkImageViewCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pView = (VkImageView*)vkStream->allocArray(1, sizeof(VkImageView));
+                }
+                m_lock.unlock();
+                VkResult vkCreateImageView_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateImageView)
+                {
+                    vkCreateImageView_VkResult_return = m_vk->vkCreateImageView(device, pCreateInfo, nullptr, pView);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateImageView");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateImageView_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateImageView_VkResult_return >= 0)
+                {
+                    if (pView)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkImageView(*pView));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyImageView:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImageView imageView;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                imageView = vkStream->handleMapping()->fromWire_VkImageView(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyImageView)
+                {
+                    m_vk->vkDestroyImageView(device, imageView, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkImageView.remove(imageView);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyImageView");
+                }
+                break;
+            }
+            case OP_vkCreateShaderModule:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkShaderModuleCreateInfo* pCreateInfo = nullptr;
+                VkShaderModule* pShaderModule = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkShaderModuleCreateInfo*)vkStream->allocArray(1, sizeof(VkShaderModuleCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkShaderModuleCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pShaderModule = (VkShaderModule*)vkStream->allocArray(1, sizeof(VkShaderModule));
+                }
+                m_lock.unlock();
+                VkResult vkCreateShaderModule_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateShaderModule)
+                {
+                    vkCreateShaderModule_VkResult_return = m_vk->vkCreateShaderModule(device, pCreateInfo, nullptr, pShaderModule);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateShaderModule");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateShaderModule_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateShaderModule_VkResult_return >= 0)
+                {
+                    if (pShaderModule)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkShaderModule(*pShaderModule));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyShaderModule:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkShaderModule shaderModule;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                shaderModule = vkStream->handleMapping()->fromWire_VkShaderModule(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyShaderModule)
+                {
+                    m_vk->vkDestroyShaderModule(device, shaderModule, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkShaderModule.remove(shaderModule);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyShaderModule");
+                }
+                break;
+            }
+            case OP_vkCreatePipelineCache:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipelineCacheCreateInfo* pCreateInfo = nullptr;
+                VkPipelineCache* pPipelineCache = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkPipelineCacheCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineCacheCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkPipelineCacheCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPipelineCache = (VkPipelineCache*)vkStream->allocArray(1, sizeof(VkPipelineCache));
+                }
+                m_lock.unlock();
+                VkResult vkCreatePipelineCache_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreatePipelineCache)
+                {
+                    vkCreatePipelineCache_VkResult_return = m_vk->vkCreatePipelineCache(device, pCreateInfo, nullptr, pPipelineCache);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreatePipelineCache");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreatePipelineCache_VkResult_return, sizeof(VkResult));
+                if (called && vkCreatePipelineCache_VkResult_return >= 0)
+                {
+                    if (pPipelineCache)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineCache(*pPipelineCache));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyPipelineCache:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipelineCache pipelineCache;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                pipelineCache = vkStream->handleMapping()->fromWire_VkPipelineCache(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyPipelineCache)
+                {
+                    m_vk->vkDestroyPipelineCache(device, pipelineCache, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkPipelineCache.remove(pipelineCache);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyPipelineCache");
+                }
+                break;
+            }
+            case OP_vkGetPipelineCacheData:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipelineCache pipelineCache;
+                size_t* pDataSize = nullptr;
+                uint8_t* pData = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                pipelineCache = vkStream->handleMapping()->fromWire_VkPipelineCache(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pDataSize = (size_t*)vkStream->allocArray(1, sizeof(size_t));
+                    if (pDataSize)
+                    {
+                        *pDataSize = (size_t)vkStream->getU64();
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pData = (uint8_t*)vkStream->allocArray((pDataSize ? *pDataSize : 0), sizeof(uint8_t));
+                }
+                m_lock.unlock();
+                VkResult vkGetPipelineCacheData_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPipelineCacheData)
+                {
+                    vkGetPipelineCacheData_VkResult_return = m_vk->vkGetPipelineCacheData(device, pipelineCache, pDataSize, pData);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPipelineCacheData");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPipelineCacheData_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPipelineCacheData_VkResult_return >= 0)
+                {
+                    if (pDataSize)
+                    {
+                        vkStream->putU64((uint64_t)*pDataSize);
+                    }
+                    if (pData)
+                    {
+                        vkStream->write(pData, (pDataSize ? *pDataSize : 0) * sizeof(uint8_t));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkMergePipelineCaches:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipelineCache dstCache;
+                uint32_t srcCacheCount;
+                VkPipelineCache* pSrcCaches = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                dstCache = vkStream->handleMapping()->fromWire_VkPipelineCache(vkStream, vkStream->getU64());
+                vkStream->read(&srcCacheCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pSrcCaches = (VkPipelineCache*)vkStream->allocArray(srcCacheCount, sizeof(VkPipelineCache));
+                    if (pSrcCaches)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)srcCacheCount; ++i)
+                        {
+                            pSrcCaches[i] = vkStream->handleMapping()->fromWire_VkPipelineCache(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkMergePipelineCaches_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkMergePipelineCaches)
+                {
+                    vkMergePipelineCaches_VkResult_return = m_vk->vkMergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+                }
+                else
+                {
+                    onFailedCall("vkMergePipelineCaches");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkMergePipelineCaches_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateGraphicsPipelines:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipelineCache pipelineCache;
+                uint32_t createInfoCount;
+                VkGraphicsPipelineCreateInfo* pCreateInfos = nullptr;
+                VkPipeline* pPipelines = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                pipelineCache = vkStream->handleMapping()->fromWire_VkPipelineCache(vkStream, vkStream->getU64());
+                vkStream->read(&createInfoCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pCreateInfos = (VkGraphicsPipelineCreateInfo*)vkStream->allocArray(createInfoCount, sizeof(VkGraphicsPipelineCreateInfo));
+                    if (pCreateInfos)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)createInfoCount; ++i)
+                        {
+                            unmarshal_VkGraphicsPipelineCreateInfo(vkStream, pCreateInfos + i);
+                        }
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPipelines = (VkPipeline*)vkStream->allocArray(createInfoCount, sizeof(VkPipeline));
+                }
+                m_lock.unlock();
+                VkResult vkCreateGraphicsPipelines_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateGraphicsPipelines)
+                {
+                    vkCreateGraphicsPipelines_VkResult_return = m_vk->vkCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, nullptr, pPipelines);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateGraphicsPipelines");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateGraphicsPipelines_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateGraphicsPipelines_VkResult_return >= 0)
+                {
+                    if (pPipelines)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)createInfoCount; ++i)
+                        {
+                            vkStream->putU64(vkStream->handleMapping()->toWire_VkPipeline(pPipelines[i]));
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateComputePipelines:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipelineCache pipelineCache;
+                uint32_t createInfoCount;
+                VkComputePipelineCreateInfo* pCreateInfos = nullptr;
+                VkPipeline* pPipelines = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                pipelineCache = vkStream->handleMapping()->fromWire_VkPipelineCache(vkStream, vkStream->getU64());
+                vkStream->read(&createInfoCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pCreateInfos = (VkComputePipelineCreateInfo*)vkStream->allocArray(createInfoCount, sizeof(VkComputePipelineCreateInfo));
+                    if (pCreateInfos)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)createInfoCount; ++i)
+                        {
+                            unmarshal_VkComputePipelineCreateInfo(vkStream, pCreateInfos + i);
+                        }
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPipelines = (VkPipeline*)vkStream->allocArray(createInfoCount, sizeof(VkPipeline));
+                }
+                m_lock.unlock();
+                VkResult vkCreateComputePipelines_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateComputePipelines)
+                {
+                    vkCreateComputePipelines_VkResult_return = m_vk->vkCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, nullptr, pPipelines);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateComputePipelines");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateComputePipelines_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateComputePipelines_VkResult_return >= 0)
+                {
+                    if (pPipelines)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)createInfoCount; ++i)
+                        {
+                            vkStream->putU64(vkStream->handleMapping()->toWire_VkPipeline(pPipelines[i]));
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyPipeline:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipeline pipeline;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                pipeline = vkStream->handleMapping()->fromWire_VkPipeline(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyPipeline)
+                {
+                    m_vk->vkDestroyPipeline(device, pipeline, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkPipeline.remove(pipeline);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyPipeline");
+                }
+                break;
+            }
+            case OP_vkCreatePipelineLayout:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipelineLayoutCreateInfo* pCreateInfo = nullptr;
+                VkPipelineLayout* pPipelineLayout = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkPipelineLayoutCreateInfo*)vkStream->allocArray(1, sizeof(VkPipelineLayoutCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkPipelineLayoutCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPipelineLayout = (VkPipelineLayout*)vkStream->allocArray(1, sizeof(VkPipelineLayout));
+                }
+                m_lock.unlock();
+                VkResult vkCreatePipelineLayout_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreatePipelineLayout)
+                {
+                    vkCreatePipelineLayout_VkResult_return = m_vk->vkCreatePipelineLayout(device, pCreateInfo, nullptr, pPipelineLayout);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreatePipelineLayout");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreatePipelineLayout_VkResult_return, sizeof(VkResult));
+                if (called && vkCreatePipelineLayout_VkResult_return >= 0)
+                {
+                    if (pPipelineLayout)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkPipelineLayout(*pPipelineLayout));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyPipelineLayout:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipelineLayout pipelineLayout;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                pipelineLayout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyPipelineLayout)
+                {
+                    m_vk->vkDestroyPipelineLayout(device, pipelineLayout, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkPipelineLayout.remove(pipelineLayout);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyPipelineLayout");
+                }
+                break;
+            }
+            case OP_vkCreateSampler:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSamplerCreateInfo* pCreateInfo = nullptr;
+                VkSampler* pSampler = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkSamplerCreateInfo*)vkStream->allocArray(1, sizeof(VkSamplerCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkSamplerCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSampler = (VkSampler*)vkStream->allocArray(1, sizeof(VkSampler));
+                }
+                m_lock.unlock();
+                VkResult vkCreateSampler_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateSampler)
+                {
+                    vkCreateSampler_VkResult_return = m_vk->vkCreateSampler(device, pCreateInfo, nullptr, pSampler);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateSampler");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateSampler_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateSampler_VkResult_return >= 0)
+                {
+                    if (pSampler)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkSampler(*pSampler));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroySampler:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSampler sampler;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                sampler = vkStream->handleMapping()->fromWire_VkSampler(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroySampler)
+                {
+                    m_vk->vkDestroySampler(device, sampler, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkSampler.remove(sampler);
+                }
+                else
+                {
+                    onFailedCall("vkDestroySampler");
+                }
+                break;
+            }
+            case OP_vkCreateDescriptorSetLayout:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorSetLayoutCreateInfo* pCreateInfo = nullptr;
+                VkDescriptorSetLayout* pSetLayout = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkDescriptorSetLayoutCreateInfo*)vkStream->allocArray(1, sizeof(VkDescriptorSetLayoutCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkDescriptorSetLayoutCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSetLayout = (VkDescriptorSetLayout*)vkStream->allocArray(1, sizeof(VkDescriptorSetLayout));
+                }
+                m_lock.unlock();
+                VkResult vkCreateDescriptorSetLayout_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateDescriptorSetLayout)
+                {
+                    vkCreateDescriptorSetLayout_VkResult_return = m_vk->vkCreateDescriptorSetLayout(device, pCreateInfo, nullptr, pSetLayout);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateDescriptorSetLayout");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateDescriptorSetLayout_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateDescriptorSetLayout_VkResult_return >= 0)
+                {
+                    if (pSetLayout)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSetLayout(*pSetLayout));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyDescriptorSetLayout:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorSetLayout descriptorSetLayout;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                descriptorSetLayout = vkStream->handleMapping()->fromWire_VkDescriptorSetLayout(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyDescriptorSetLayout)
+                {
+                    m_vk->vkDestroyDescriptorSetLayout(device, descriptorSetLayout, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkDescriptorSetLayout.remove(descriptorSetLayout);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyDescriptorSetLayout");
+                }
+                break;
+            }
+            case OP_vkCreateDescriptorPool:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorPoolCreateInfo* pCreateInfo = nullptr;
+                VkDescriptorPool* pDescriptorPool = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkDescriptorPoolCreateInfo*)vkStream->allocArray(1, sizeof(VkDescriptorPoolCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkDescriptorPoolCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pDescriptorPool = (VkDescriptorPool*)vkStream->allocArray(1, sizeof(VkDescriptorPool));
+                }
+                m_lock.unlock();
+                VkResult vkCreateDescriptorPool_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateDescriptorPool)
+                {
+                    vkCreateDescriptorPool_VkResult_return = m_vk->vkCreateDescriptorPool(device, pCreateInfo, nullptr, pDescriptorPool);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateDescriptorPool");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateDescriptorPool_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateDescriptorPool_VkResult_return >= 0)
+                {
+                    if (pDescriptorPool)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorPool(*pDescriptorPool));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyDescriptorPool:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorPool descriptorPool;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                descriptorPool = vkStream->handleMapping()->fromWire_VkDescriptorPool(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyDescriptorPool)
+                {
+                    m_vk->vkDestroyDescriptorPool(device, descriptorPool, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkDescriptorPool.remove(descriptorPool);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyDescriptorPool");
+                }
+                break;
+            }
+            case OP_vkResetDescriptorPool:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorPool descriptorPool;
+                VkDescriptorPoolResetFlags flags;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                descriptorPool = vkStream->handleMapping()->fromWire_VkDescriptorPool(vkStream, vkStream->getU64());
+                vkStream->read(&flags, sizeof(VkDescriptorPoolResetFlags));
+                m_lock.unlock();
+                VkResult vkResetDescriptorPool_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkResetDescriptorPool)
+                {
+                    vkResetDescriptorPool_VkResult_return = m_vk->vkResetDescriptorPool(device, descriptorPool, flags);
+                }
+                else
+                {
+                    onFailedCall("vkResetDescriptorPool");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkResetDescriptorPool_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkAllocateDescriptorSets:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorSetAllocateInfo* pAllocateInfo = nullptr;
+                VkDescriptorSet* pDescriptorSets = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pAllocateInfo = (VkDescriptorSetAllocateInfo*)vkStream->allocArray(1, sizeof(VkDescriptorSetAllocateInfo));
+                    if (pAllocateInfo)
+                    {
+                        unmarshal_VkDescriptorSetAllocateInfo(vkStream, pAllocateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pDescriptorSets = (VkDescriptorSet*)vkStream->allocArray((pAllocateInfo ? pAllocateInfo->descriptorSetCount : 0), sizeof(VkDescriptorSet));
+                }
+                m_lock.unlock();
+                VkResult vkAllocateDescriptorSets_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkAllocateDescriptorSets)
+                {
+                    vkAllocateDescriptorSets_VkResult_return = m_vk->vkAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkAllocateDescriptorSets");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkAllocateDescriptorSets_VkResult_return, sizeof(VkResult));
+                if (called && vkAllocateDescriptorSets_VkResult_return >= 0)
+                {
+                    if (pDescriptorSets)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pAllocateInfo ? pAllocateInfo->descriptorSetCount : 0); ++i)
+                        {
+                            vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorSet(pDescriptorSets[i]));
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkFreeDescriptorSets:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorPool descriptorPool;
+                uint32_t descriptorSetCount;
+                VkDescriptorSet* pDescriptorSets = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                descriptorPool = vkStream->handleMapping()->fromWire_VkDescriptorPool(vkStream, vkStream->getU64());
+                vkStream->read(&descriptorSetCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pDescriptorSets = (VkDescriptorSet*)vkStream->allocArray(descriptorSetCount, sizeof(VkDescriptorSet));
+                    if (pDescriptorSets)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)descriptorSetCount; ++i)
+                        {
+                            pDescriptorSets[i] = vkStream->handleMapping()->fromWire_VkDescriptorSet(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkFreeDescriptorSets_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkFreeDescriptorSets)
+                {
+                    vkFreeDescriptorSets_VkResult_return = m_vk->vkFreeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+                    m_lock.write();
+                    for (uint32_t i = 0; pDescriptorSets && i < (uint32_t)descriptorSetCount; ++i)
+                    {
+                        m_tables->table_VkDescriptorSet.remove(pDescriptorSets[i]);
+                    }
+                }
+                else
+                {
+                    onFailedCall("vkFreeDescriptorSets");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkFreeDescriptorSets_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkUpdateDescriptorSets:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t descriptorWriteCount;
+                VkWriteDescriptorSet* pDescriptorWrites = nullptr;
+                uint32_t descriptorCopyCount;
+                VkCopyDescriptorSet* pDescriptorCopies = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&descriptorWriteCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pDescriptorWrites = (VkWriteDescriptorSet*)vkStream->allocArray(descriptorWriteCount, sizeof(VkWriteDescriptorSet));
+                    if (pDescriptorWrites)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)descriptorWriteCount; ++i)
+                        {
+                            unmarshal_VkWriteDescriptorSet(vkStream, pDescriptorWrites + i);
+                        }
+                    }
+                }
+                vkStream->read(&descriptorCopyCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pDescriptorCopies = (VkCopyDescriptorSet*)vkStream->allocArray(descriptorCopyCount, sizeof(VkCopyDescriptorSet));
+                    if (pDescriptorCopies)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)descriptorCopyCount; ++i)
+                        {
+                            unmarshal_VkCopyDescriptorSet(vkStream, pDescriptorCopies + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkUpdateDescriptorSets)
+                {
+                    m_vk->vkUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+                }
+                else
+                {
+                    onFailedCall("vkUpdateDescriptorSets");
+                }
+                break;
+            }
+            case OP_vkCreateFramebuffer:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkFramebufferCreateInfo* pCreateInfo = nullptr;
+                VkFramebuffer* pFramebuffer = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkFramebufferCreateInfo*)vkStream->allocArray(1, sizeof(VkFramebufferCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkFramebufferCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pFramebuffer = (VkFramebuffer*)vkStream->allocArray(1, sizeof(VkFramebuffer));
+                }
+                m_lock.unlock();
+                VkResult vkCreateFramebuffer_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateFramebuffer)
+                {
+                    vkCreateFramebuffer_VkResult_return = m_vk->vkCreateFramebuffer(device, pCreateInfo, nullptr, pFramebuffer);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateFramebuffer");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateFramebuffer_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateFramebuffer_VkResult_return >= 0)
+                {
+                    if (pFramebuffer)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkFramebuffer(*pFramebuffer));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyFramebuffer:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkFramebuffer framebuffer;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                framebuffer = vkStream->handleMapping()->fromWire_VkFramebuffer(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyFramebuffer)
+                {
+                    m_vk->vkDestroyFramebuffer(device, framebuffer, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkFramebuffer.remove(framebuffer);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyFramebuffer");
+                }
+                break;
+            }
+            case OP_vkCreateRenderPass:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkRenderPassCreateInfo* pCreateInfo = nullptr;
+                VkRenderPass* pRenderPass = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkRenderPassCreateInfo*)vkStream->allocArray(1, sizeof(VkRenderPassCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkRenderPassCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pRenderPass = (VkRenderPass*)vkStream->allocArray(1, sizeof(VkRenderPass));
+                }
+                m_lock.unlock();
+                VkResult vkCreateRenderPass_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateRenderPass)
+                {
+                    vkCreateRenderPass_VkResult_return = m_vk->vkCreateRenderPass(device, pCreateInfo, nullptr, pRenderPass);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateRenderPass");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateRenderPass_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateRenderPass_VkResult_return >= 0)
+                {
+                    if (pRenderPass)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkRenderPass(*pRenderPass));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyRenderPass:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkRenderPass renderPass;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                renderPass = vkStream->handleMapping()->fromWire_VkRenderPass(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyRenderPass)
+                {
+                    m_vk->vkDestroyRenderPass(device, renderPass, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkRenderPass.remove(renderPass);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyRenderPass");
+                }
+                break;
+            }
+            case OP_vkGetRenderAreaGranularity:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkRenderPass renderPass;
+                VkExtent2D* pGranularity = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                renderPass = vkStream->handleMapping()->fromWire_VkRenderPass(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pGranularity = (VkExtent2D*)vkStream->allocArray(1, sizeof(VkExtent2D));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetRenderAreaGranularity)
+                {
+                    m_vk->vkGetRenderAreaGranularity(device, renderPass, pGranularity);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetRenderAreaGranularity");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pGranularity)
+                    {
+                        marshal_VkExtent2D(vkStream, pGranularity);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateCommandPool:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkCommandPoolCreateInfo* pCreateInfo = nullptr;
+                VkCommandPool* pCommandPool = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkCommandPoolCreateInfo*)vkStream->allocArray(1, sizeof(VkCommandPoolCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkCommandPoolCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pCommandPool = (VkCommandPool*)vkStream->allocArray(1, sizeof(VkCommandPool));
+                }
+                m_lock.unlock();
+                VkResult vkCreateCommandPool_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateCommandPool)
+                {
+                    vkCreateCommandPool_VkResult_return = m_vk->vkCreateCommandPool(device, pCreateInfo, nullptr, pCommandPool);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateCommandPool");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateCommandPool_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateCommandPool_VkResult_return >= 0)
+                {
+                    if (pCommandPool)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandPool(*pCommandPool));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyCommandPool:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkCommandPool commandPool;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                commandPool = vkStream->handleMapping()->fromWire_VkCommandPool(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyCommandPool)
+                {
+                    m_vk->vkDestroyCommandPool(device, commandPool, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkCommandPool.remove(commandPool);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyCommandPool");
+                }
+                break;
+            }
+            case OP_vkResetCommandPool:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkCommandPool commandPool;
+                VkCommandPoolResetFlags flags;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                commandPool = vkStream->handleMapping()->fromWire_VkCommandPool(vkStream, vkStream->getU64());
+                vkStream->read(&flags, sizeof(VkCommandPoolResetFlags));
+                m_lock.unlock();
+                VkResult vkResetCommandPool_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkResetCommandPool)
+                {
+                    vkResetCommandPool_VkResult_return = m_vk->vkResetCommandPool(device, commandPool, flags);
+                }
+                else
+                {
+                    onFailedCall("vkResetCommandPool");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkResetCommandPool_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkAllocateCommandBuffers:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkCommandBufferAllocateInfo* pAllocateInfo = nullptr;
+                VkCommandBuffer* pCommandBuffers = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pAllocateInfo = (VkCommandBufferAllocateInfo*)vkStream->allocArray(1, sizeof(VkCommandBufferAllocateInfo));
+                    if (pAllocateInfo)
+                    {
+                        unmarshal_VkCommandBufferAllocateInfo(vkStream, pAllocateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pCommandBuffers = (VkCommandBuffer*)vkStream->allocArray((pAllocateInfo ? pAllocateInfo->commandBufferCount : 0), sizeof(VkCommandBuffer));
+                }
+                m_lock.unlock();
+                VkResult vkAllocateCommandBuffers_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkAllocateCommandBuffers)
+                {
+                    vkAllocateCommandBuffers_VkResult_return = m_vk->vkAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkAllocateCommandBuffers");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkAllocateCommandBuffers_VkResult_return, sizeof(VkResult));
+                if (called && vkAllocateCommandBuffers_VkResult_return >= 0)
+                {
+                    if (pCommandBuffers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pAllocateInfo ? pAllocateInfo->commandBufferCount : 0); ++i)
+                        {
+                            vkStream->putU64(vkStream->handleMapping()->toWire_VkCommandBuffer(pCommandBuffers[i]));
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkFreeCommandBuffers:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkCommandPool commandPool;
+                uint32_t commandBufferCount;
+                VkCommandBuffer* pCommandBuffers = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                commandPool = vkStream->handleMapping()->fromWire_VkCommandPool(vkStream, vkStream->getU64());
+                vkStream->read(&commandBufferCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pCommandBuffers = (VkCommandBuffer*)vkStream->allocArray(commandBufferCount, sizeof(VkCommandBuffer));
+                    if (pCommandBuffers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)commandBufferCount; ++i)
+                        {
+                            pCommandBuffers[i] = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkFreeCommandBuffers)
+                {
+                    m_vk->vkFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+                    m_lock.write();
+                    for (uint32_t i = 0; pCommandBuffers && i < (uint32_t)commandBufferCount; ++i)
+                    {
+                        m_tables->table_VkCommandBuffer.remove(pCommandBuffers[i]);
+                    }
+                }
+                else
+                {
+                    onFailedCall("vkFreeCommandBuffers");
+                }
+                break;
+            }
+            case OP_vkBeginCommandBuffer:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkCommandBufferBeginInfo* pBeginInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pBeginInfo = (VkCommandBufferBeginInfo*)vkStream->allocArray(1, sizeof(VkCommandBufferBeginInfo));
+                    if (pBeginInfo)
+                    {
+                        unmarshal_VkCommandBufferBeginInfo(vkStream, pBeginInfo);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkBeginCommandBuffer_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkBeginCommandBuffer)
+                {
+                    vkBeginCommandBuffer_VkResult_return = m_vk->vkBeginCommandBuffer(commandBuffer, pBeginInfo);
+                }
+                else
+                {
+                    onFailedCall("vkBeginCommandBuffer");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkBeginCommandBuffer_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkEndCommandBuffer:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkEndCommandBuffer_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkEndCommandBuffer)
+                {
+                    vkEndCommandBuffer_VkResult_return = m_vk->vkEndCommandBuffer(commandBuffer);
+                }
+                else
+                {
+                    onFailedCall("vkEndCommandBuffer");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkEndCommandBuffer_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkResetCommandBuffer:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkCommandBufferResetFlags flags;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&flags, sizeof(VkCommandBufferResetFlags));
+                m_lock.unlock();
+                VkResult vkResetCommandBuffer_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkResetCommandBuffer)
+                {
+                    vkResetCommandBuffer_VkResult_return = m_vk->vkResetCommandBuffer(commandBuffer, flags);
+                }
+                else
+                {
+                    onFailedCall("vkResetCommandBuffer");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkResetCommandBuffer_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCmdBindPipeline:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkPipelineBindPoint pipelineBindPoint;
+                VkPipeline pipeline;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&pipelineBindPoint, sizeof(VkPipelineBindPoint));
+                pipeline = vkStream->handleMapping()->fromWire_VkPipeline(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkCmdBindPipeline)
+                {
+                    m_vk->vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBindPipeline");
+                }
+                break;
+            }
+            case OP_vkCmdSetViewport:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t firstViewport;
+                uint32_t viewportCount;
+                VkViewport* pViewports = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&firstViewport, sizeof(uint32_t));
+                vkStream->read(&viewportCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pViewports = (VkViewport*)vkStream->allocArray(viewportCount, sizeof(VkViewport));
+                    if (pViewports)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)viewportCount; ++i)
+                        {
+                            unmarshal_VkViewport(vkStream, pViewports + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdSetViewport)
+                {
+                    m_vk->vkCmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetViewport");
+                }
+                break;
+            }
+            case OP_vkCmdSetScissor:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t firstScissor;
+                uint32_t scissorCount;
+                VkRect2D* pScissors = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&firstScissor, sizeof(uint32_t));
+                vkStream->read(&scissorCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pScissors = (VkRect2D*)vkStream->allocArray(scissorCount, sizeof(VkRect2D));
+                    if (pScissors)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)scissorCount; ++i)
+                        {
+                            unmarshal_VkRect2D(vkStream, pScissors + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdSetScissor)
+                {
+                    m_vk->vkCmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetScissor");
+                }
+                break;
+            }
+            case OP_vkCmdSetLineWidth:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                float lineWidth;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&lineWidth, sizeof(float));
+                if (!vkStream->error() && m_vk->vkCmdSetLineWidth)
+                {
+                    m_vk->vkCmdSetLineWidth(commandBuffer, lineWidth);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetLineWidth");
+                }
+                break;
+            }
+            case OP_vkCmdSetDepthBias:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                float depthBiasConstantFactor;
+                float depthBiasClamp;
+                float depthBiasSlopeFactor;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&depthBiasConstantFactor, sizeof(float));
+                vkStream->read(&depthBiasClamp, sizeof(float));
+                vkStream->read(&depthBiasSlopeFactor, sizeof(float));
+                if (!vkStream->error() && m_vk->vkCmdSetDepthBias)
+                {
+                    m_vk->vkCmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetDepthBias");
+                }
+                break;
+            }
+            case OP_vkCmdSetBlendConstants:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                float blendConstants[4];
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(blendConstants, 4 * sizeof(float));
+                if (!vkStream->error() && m_vk->vkCmdSetBlendConstants)
+                {
+                    m_vk->vkCmdSetBlendConstants(commandBuffer, blendConstants);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetBlendConstants");
+                }
+                break;
+            }
+            case OP_vkCmdSetDepthBounds:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                float minDepthBounds;
+                float maxDepthBounds;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&minDepthBounds, sizeof(float));
+                vkStream->read(&maxDepthBounds, sizeof(float));
+                if (!vkStream->error() && m_vk->vkCmdSetDepthBounds)
+                {
+                    m_vk->vkCmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetDepthBounds");
+                }
+                break;
+            }
+            case OP_vkCmdSetStencilCompareMask:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkStencilFaceFlags faceMask;
+                uint32_t compareMask;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&faceMask, sizeof(VkStencilFaceFlags));
+                vkStream->read(&compareMask, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdSetStencilCompareMask)
+                {
+                    m_vk->vkCmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetStencilCompareMask");
+                }
+                break;
+            }
+            case OP_vkCmdSetStencilWriteMask:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkStencilFaceFlags faceMask;
+                uint32_t writeMask;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&faceMask, sizeof(VkStencilFaceFlags));
+                vkStream->read(&writeMask, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdSetStencilWriteMask)
+                {
+                    m_vk->vkCmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetStencilWriteMask");
+                }
+                break;
+            }
+            case OP_vkCmdSetStencilReference:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkStencilFaceFlags faceMask;
+                uint32_t reference;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&faceMask, sizeof(VkStencilFaceFlags));
+                vkStream->read(&reference, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdSetStencilReference)
+                {
+                    m_vk->vkCmdSetStencilReference(commandBuffer, faceMask, reference);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetStencilReference");
+                }
+                break;
+            }
+            case OP_vkCmdBindDescriptorSets:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkPipelineBindPoint pipelineBindPoint;
+                VkPipelineLayout layout;
+                uint32_t firstSet;
+                uint32_t descriptorSetCount;
+                VkDescriptorSet* pDescriptorSets = nullptr;
+                uint32_t dynamicOffsetCount;
+                uint32_t* pDynamicOffsets = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&pipelineBindPoint, sizeof(VkPipelineBindPoint));
+                layout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+                vkStream->read(&firstSet, sizeof(uint32_t));
+                vkStream->read(&descriptorSetCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pDescriptorSets = (VkDescriptorSet*)vkStream->allocArray(descriptorSetCount, sizeof(VkDescriptorSet));
+                    if (pDescriptorSets)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)descriptorSetCount; ++i)
+                        {
+                            pDescriptorSets[i] = vkStream->handleMapping()->fromWire_VkDescriptorSet(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                vkStream->read(&dynamicOffsetCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pDynamicOffsets = (uint32_t*)vkStream->allocArray(dynamicOffsetCount, sizeof(uint32_t));
+                    if (pDynamicOffsets)
+                    {
+                        vkStream->read(pDynamicOffsets, dynamicOffsetCount * sizeof(uint32_t));
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdBindDescriptorSets)
+                {
+                    m_vk->vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBindDescriptorSets");
+                }
+                break;
+            }
+            case OP_vkCmdBindIndexBuffer:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer buffer;
+                VkDeviceSize offset;
+                VkIndexType indexType;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&offset, sizeof(VkDeviceSize));
+                vkStream->read(&indexType, sizeof(VkIndexType));
+                if (!vkStream->error() && m_vk->vkCmdBindIndexBuffer)
+                {
+                    m_vk->vkCmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBindIndexBuffer");
+                }
+                break;
+            }
+            case OP_vkCmdBindVertexBuffers:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t firstBinding;
+                uint32_t bindingCount;
+                VkBuffer* pBuffers = nullptr;
+                VkDeviceSize* pOffsets = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&firstBinding, sizeof(uint32_t));
+                vkStream->read(&bindingCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pBuffers = (VkBuffer*)vkStream->allocArray(bindingCount, sizeof(VkBuffer));
+                    if (pBuffers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)bindingCount; ++i)
+                        {
+                            pBuffers[i] = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pOffsets = (VkDeviceSize*)vkStream->allocArray(bindingCount, sizeof(VkDeviceSize));
+                    if (pOffsets)
+                    {
+                        vkStream->read(pOffsets, bindingCount * sizeof(VkDeviceSize));
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdBindVertexBuffers)
+                {
+                    m_vk->vkCmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBindVertexBuffers");
+                }
+                break;
+            }
+            case OP_vkCmdDraw:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t vertexCount;
+                uint32_t instanceCount;
+                uint32_t firstVertex;
+                uint32_t firstInstance;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&vertexCount, sizeof(uint32_t));
+                vkStream->read(&instanceCount, sizeof(uint32_t));
+                vkStream->read(&firstVertex, sizeof(uint32_t));
+                vkStream->read(&firstInstance, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDraw)
+                {
+                    m_vk->vkCmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDraw");
+                }
+                break;
+            }
+            case OP_vkCmdDrawIndexed:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t indexCount;
+                uint32_t instanceCount;
+                uint32_t firstIndex;
+                int32_t vertexOffset;
+                uint32_t firstInstance;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&indexCount, sizeof(uint32_t));
+                vkStream->read(&instanceCount, sizeof(uint32_t));
+                vkStream->read(&firstIndex, sizeof(uint32_t));
+                vkStream->read(&vertexOffset, sizeof(int32_t));
+                vkStream->read(&firstInstance, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDrawIndexed)
+                {
+                    m_vk->vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDrawIndexed");
+                }
+                break;
+            }
+            case OP_vkCmdDrawIndirect:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer buffer;
+                VkDeviceSize offset;
+                uint32_t drawCount;
+                uint32_t stride;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&offset, sizeof(VkDeviceSize));
+                vkStream->read(&drawCount, sizeof(uint32_t));
+                vkStream->read(&stride, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDrawIndirect)
+                {
+                    m_vk->vkCmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDrawIndirect");
+                }
+                break;
+            }
+            case OP_vkCmdDrawIndexedIndirect:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer buffer;
+                VkDeviceSize offset;
+                uint32_t drawCount;
+                uint32_t stride;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&offset, sizeof(VkDeviceSize));
+                vkStream->read(&drawCount, sizeof(uint32_t));
+                vkStream->read(&stride, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDrawIndexedIndirect)
+                {
+                    m_vk->vkCmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDrawIndexedIndirect");
+                }
+                break;
+            }
+            case OP_vkCmdDispatch:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t groupCountX;
+                uint32_t groupCountY;
+                uint32_t groupCountZ;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&groupCountX, sizeof(uint32_t));
+                vkStream->read(&groupCountY, sizeof(uint32_t));
+                vkStream->read(&groupCountZ, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDispatch)
+                {
+                    m_vk->vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDispatch");
+                }
+                break;
+            }
+            case OP_vkCmdDispatchIndirect:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer buffer;
+                VkDeviceSize offset;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&offset, sizeof(VkDeviceSize));
+                if (!vkStream->error() && m_vk->vkCmdDispatchIndirect)
+                {
+                    m_vk->vkCmdDispatchIndirect(commandBuffer, buffer, offset);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDispatchIndirect");
+                }
+                break;
+            }
+            case OP_vkCmdCopyBuffer:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer srcBuffer;
+                VkBuffer dstBuffer;
+                uint32_t regionCount;
+                VkBufferCopy* pRegions = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                srcBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                dstBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&regionCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pRegions = (VkBufferCopy*)vkStream->allocArray(regionCount, sizeof(VkBufferCopy));
+                    if (pRegions)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+                        {
+                            unmarshal_VkBufferCopy(vkStream, pRegions + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdCopyBuffer)
+                {
+                    m_vk->vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+                }
+                else
+                {
+                    onFailedCall("vkCmdCopyBuffer");
+                }
+                break;
+            }
+            case OP_vkCmdCopyImage:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkImage srcImage;
+                VkImageLayout srcImageLayout;
+                VkImage dstImage;
+                VkImageLayout dstImageLayout;
+                uint32_t regionCount;
+                VkImageCopy* pRegions = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                srcImage = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&srcImageLayout, sizeof(VkImageLayout));
+                dstImage = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&dstImageLayout, sizeof(VkImageLayout));
+                vkStream->read(&regionCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pRegions = (VkImageCopy*)vkStream->allocArray(regionCount, sizeof(VkImageCopy));
+                    if (pRegions)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+                        {
+                            unmarshal_VkImageCopy(vkStream, pRegions + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdCopyImage)
+                {
+                    m_vk->vkCmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+                }
+                else
+                {
+                    onFailedCall("vkCmdCopyImage");
+                }
+                break;
+            }
+            case OP_vkCmdBlitImage:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkImage srcImage;
+                VkImageLayout srcImageLayout;
+                VkImage dstImage;
+                VkImageLayout dstImageLayout;
+                uint32_t regionCount;
+                VkImageBlit* pRegions = nullptr;
+                VkFilter filter;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                srcImage = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&srcImageLayout, sizeof(VkImageLayout));
+                dstImage = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&dstImageLayout, sizeof(VkImageLayout));
+                vkStream->read(&regionCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pRegions = (VkImageBlit*)vkStream->allocArray(regionCount, sizeof(VkImageBlit));
+                    if (pRegions)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+                        {
+                            unmarshal_VkImageBlit(vkStream, pRegions + i);
+                        }
+                    }
+                }
+                vkStream->read(&filter, sizeof(VkFilter));
+                if (!vkStream->error() && m_vk->vkCmdBlitImage)
+                {
+                    m_vk->vkCmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBlitImage");
+                }
+                break;
+            }
+            case OP_vkCmdCopyBufferToImage:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer srcBuffer;
+                VkImage dstImage;
+                VkImageLayout dstImageLayout;
+                uint32_t regionCount;
+                VkBufferImageCopy* pRegions = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                srcBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                dstImage = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&dstImageLayout, sizeof(VkImageLayout));
+                vkStream->read(&regionCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pRegions = (VkBufferImageCopy*)vkStream->allocArray(regionCount, sizeof(VkBufferImageCopy));
+                    if (pRegions)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+                        {
+                            unmarshal_VkBufferImageCopy(vkStream, pRegions + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdCopyBufferToImage)
+                {
+                    m_vk->vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+                }
+                else
+                {
+                    onFailedCall("vkCmdCopyBufferToImage");
+                }
+                break;
+            }
+            case OP_vkCmdCopyImageToBuffer:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkImage srcImage;
+                VkImageLayout srcImageLayout;
+                VkBuffer dstBuffer;
+                uint32_t regionCount;
+                VkBufferImageCopy* pRegions = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                srcImage = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&srcImageLayout, sizeof(VkImageLayout));
+                dstBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&regionCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pRegions = (VkBufferImageCopy*)vkStream->allocArray(regionCount, sizeof(VkBufferImageCopy));
+                    if (pRegions)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+                        {
+                            unmarshal_VkBufferImageCopy(vkStream, pRegions + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdCopyImageToBuffer)
+                {
+                    m_vk->vkCmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+                }
+                else
+                {
+                    onFailedCall("vkCmdCopyImageToBuffer");
+                }
+                break;
+            }
+            case OP_vkCmdUpdateBuffer:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer dstBuffer;
+                VkDeviceSize dstOffset;
+                VkDeviceSize dataSize;
+                uint8_t* pData = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                dstBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&dstOffset, sizeof(VkDeviceSize));
+                vkStream->read(&dataSize, sizeof(VkDeviceSize));
+                if (vkStream->getU32())
+                {
+                    pData = (uint8_t*)vkStream->allocArray(dataSize, sizeof(uint8_t));
+                    if (pData)
+                    {
+                        vkStream->read(pData, dataSize * sizeof(uint8_t));
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdUpdateBuffer)
+                {
+                    m_vk->vkCmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+                }
+                else
+                {
+                    onFailedCall("vkCmdUpdateBuffer");
+                }
+                break;
+            }
+            case OP_vkCmdFillBuffer:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer dstBuffer;
+                VkDeviceSize dstOffset;
+                VkDeviceSize size;
+                uint32_t data;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                dstBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&dstOffset, sizeof(VkDeviceSize));
+                vkStream->read(&size, sizeof(VkDeviceSize));
+                vkStream->read(&data, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdFillBuffer)
+                {
+                    m_vk->vkCmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+                }
+                else
+                {
+                    onFailedCall("vkCmdFillBuffer");
+                }
+                break;
+            }
+            case OP_vkCmdClearColorImage:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkImage image;
+                VkImageLayout imageLayout;
+                VkClearColorValue* pColor = nullptr;
+                uint32_t rangeCount;
+                VkImageSubresourceRange* pRanges = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&imageLayout, sizeof(VkImageLayout));
+                if (vkStream->getU32())
+                {
+                    pColor = (VkClearColorValue*)vkStream->allocArray(1, sizeof(VkClearColorValue));
+                    if (pColor)
+                    {
+                        vkStream->read(pColor, sizeof(VkClearColorValue));
+                    }
+                }
+                vkStream->read(&rangeCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pRanges = (VkImageSubresourceRange*)vkStream->allocArray(rangeCount, sizeof(VkImageSubresourceRange));
+                    if (pRanges)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)rangeCount; ++i)
+                        {
+                            unmarshal_VkImageSubresourceRange(vkStream, pRanges + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdClearColorImage)
+                {
+                    m_vk->vkCmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+                }
+                else
+                {
+                    onFailedCall("vkCmdClearColorImage");
+                }
+                break;
+            }
+            case OP_vkCmdClearDepthStencilImage:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkImage image;
+                VkImageLayout imageLayout;
+                VkClearDepthStencilValue* pDepthStencil = nullptr;
+                uint32_t rangeCount;
+                VkImageSubresourceRange* pRanges = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                image = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&imageLayout, sizeof(VkImageLayout));
+                if (vkStream->getU32())
+                {
+                    pDepthStencil = (VkClearDepthStencilValue*)vkStream->allocArray(1, sizeof(VkClearDepthStencilValue));
+                    if (pDepthStencil)
+                    {
+                        unmarshal_VkClearDepthStencilValue(vkStream, pDepthStencil);
+                    }
+                }
+                vkStream->read(&rangeCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pRanges = (VkImageSubresourceRange*)vkStream->allocArray(rangeCount, sizeof(VkImageSubresourceRange));
+                    if (pRanges)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)rangeCount; ++i)
+                        {
+                            unmarshal_VkImageSubresourceRange(vkStream, pRanges + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdClearDepthStencilImage)
+                {
+                    m_vk->vkCmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+                }
+                else
+                {
+                    onFailedCall("vkCmdClearDepthStencilImage");
+                }
+                break;
+            }
+            case OP_vkCmdClearAttachments:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t attachmentCount;
+                VkClearAttachment* pAttachments = nullptr;
+                uint32_t rectCount;
+                VkClearRect* pRects = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&attachmentCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pAttachments = (VkClearAttachment*)vkStream->allocArray(attachmentCount, sizeof(VkClearAttachment));
+                    if (pAttachments)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)attachmentCount; ++i)
+                        {
+                            unmarshal_VkClearAttachment(vkStream, pAttachments + i);
+                        }
+                    }
+                }
+                vkStream->read(&rectCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pRects = (VkClearRect*)vkStream->allocArray(rectCount, sizeof(VkClearRect));
+                    if (pRects)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)rectCount; ++i)
+                        {
+                            unmarshal_VkClearRect(vkStream, pRects + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdClearAttachments)
+                {
+                    m_vk->vkCmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+                }
+                else
+                {
+                    onFailedCall("vkCmdClearAttachments");
+                }
+                break;
+            }
+            case OP_vkCmdResolveImage:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkImage srcImage;
+                VkImageLayout srcImageLayout;
+                VkImage dstImage;
+                VkImageLayout dstImageLayout;
+                uint32_t regionCount;
+                VkImageResolve* pRegions = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                srcImage = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&srcImageLayout, sizeof(VkImageLayout));
+                dstImage = vkStream->handleMapping()->fromWire_VkImage(vkStream, vkStream->getU64());
+                vkStream->read(&dstImageLayout, sizeof(VkImageLayout));
+                vkStream->read(&regionCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pRegions = (VkImageResolve*)vkStream->allocArray(regionCount, sizeof(VkImageResolve));
+                    if (pRegions)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)regionCount; ++i)
+                        {
+                            unmarshal_VkImageResolve(vkStream, pRegions + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdResolveImage)
+                {
+                    m_vk->vkCmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+                }
+                else
+                {
+                    onFailedCall("vkCmdResolveImage");
+                }
+                break;
+            }
+            case OP_vkCmdSetEvent:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkEvent event;
+                VkPipelineStageFlags stageMask;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                event = vkStream->handleMapping()->fromWire_VkEvent(vkStream, vkStream->getU64());
+                vkStream->read(&stageMask, sizeof(VkPipelineStageFlags));
+                if (!vkStream->error() && m_vk->vkCmdSetEvent)
+                {
+                    m_vk->vkCmdSetEvent(commandBuffer, event, stageMask);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetEvent");
+                }
+                break;
+            }
+            case OP_vkCmdResetEvent:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkEvent event;
+                VkPipelineStageFlags stageMask;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                event = vkStream->handleMapping()->fromWire_VkEvent(vkStream, vkStream->getU64());
+                vkStream->read(&stageMask, sizeof(VkPipelineStageFlags));
+                if (!vkStream->error() && m_vk->vkCmdResetEvent)
+                {
+                    m_vk->vkCmdResetEvent(commandBuffer, event, stageMask);
+                }
+                else
+                {
+                    onFailedCall("vkCmdResetEvent");
+                }
+                break;
+            }
+            case OP_vkCmdWaitEvents:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t eventCount;
+                VkEvent* pEvents = nullptr;
+                VkPipelineStageFlags srcStageMask;
+                VkPipelineStageFlags dstStageMask;
+                uint32_t memoryBarrierCount;
+                VkMemoryBarrier* pMemoryBarriers = nullptr;
+                uint32_t bufferMemoryBarrierCount;
+                VkBufferMemoryBarrier* pBufferMemoryBarriers = nullptr;
+                uint32_t imageMemoryBarrierCount;
+                VkImageMemoryBarrier* pImageMemoryBarriers = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&eventCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pEvents = (VkEvent*)vkStream->allocArray(eventCount, sizeof(VkEvent));
+                    if (pEvents)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)eventCount; ++i)
+                        {
+                            pEvents[i] = vkStream->handleMapping()->fromWire_VkEvent(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                vkStream->read(&srcStageMask, sizeof(VkPipelineStageFlags));
+                vkStream->read(&dstStageMask, sizeof(VkPipelineStageFlags));
+                vkStream->read(&memoryBarrierCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pMemoryBarriers = (VkMemoryBarrier*)vkStream->allocArray(memoryBarrierCount, sizeof(VkMemoryBarrier));
+                    if (pMemoryBarriers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)memoryBarrierCount; ++i)
+                        {
+                            unmarshal_VkMemoryBarrier(vkStream, pMemoryBarriers + i);
+                        }
+                    }
+                }
+                vkStream->read(&bufferMemoryBarrierCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pBufferMemoryBarriers = (VkBufferMemoryBarrier*)vkStream->allocArray(bufferMemoryBarrierCount, sizeof(VkBufferMemoryBarrier));
+                    if (pBufferMemoryBarriers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)bufferMemoryBarrierCount; ++i)
+                        {
+                            unmarshal_VkBufferMemoryBarrier(vkStream, pBufferMemoryBarriers + i);
+                        }
+                    }
+                }
+                vkStream->read(&imageMemoryBarrierCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pImageMemoryBarriers = (VkImageMemoryBarrier*)vkStream->allocArray(imageMemoryBarrierCount, sizeof(VkImageMemoryBarrier));
+                    if (pImageMemoryBarriers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)imageMemoryBarrierCount; ++i)
+                        {
+                            unmarshal_VkImageMemoryBarrier(vkStream, pImageMemoryBarriers + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdWaitEvents)
+                {
+                    m_vk->vkCmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+                }
+                else
+                {
+                    onFailedCall("vkCmdWaitEvents");
+                }
+                break;
+            }
+            case OP_vkCmdPipelineBarrier:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkPipelineStageFlags srcStageMask;
+                VkPipelineStageFlags dstStageMask;
+                VkDependencyFlags dependencyFlags;
+                uint32_t memoryBarrierCount;
+                VkMemoryBarrier* pMemoryBarriers = nullptr;
+                uint32_t bufferMemoryBarrierCount;
+                VkBufferMemoryBarrier* pBufferMemoryBarriers = nullptr;
+                uint32_t imageMemoryBarrierCount;
+                VkImageMemoryBarrier* pImageMemoryBarriers = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&srcStageMask, sizeof(VkPipelineStageFlags));
+                vkStream->read(&dstStageMask, sizeof(VkPipelineStageFlags));
+                vkStream->read(&dependencyFlags, sizeof(VkDependencyFlags));
+                vkStream->read(&memoryBarrierCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pMemoryBarriers = (VkMemoryBarrier*)vkStream->allocArray(memoryBarrierCount, sizeof(VkMemoryBarrier));
+                    if (pMemoryBarriers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)memoryBarrierCount; ++i)
+                        {
+                            unmarshal_VkMemoryBarrier(vkStream, pMemoryBarriers + i);
+                        }
+                    }
+                }
+                vkStream->read(&bufferMemoryBarrierCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pBufferMemoryBarriers = (VkBufferMemoryBarrier*)vkStream->allocArray(bufferMemoryBarrierCount, sizeof(VkBufferMemoryBarrier));
+                    if (pBufferMemoryBarriers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)bufferMemoryBarrierCount; ++i)
+                        {
+                            unmarshal_VkBufferMemoryBarrier(vkStream, pBufferMemoryBarriers + i);
+                        }
+                    }
+                }
+                vkStream->read(&imageMemoryBarrierCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pImageMemoryBarriers = (VkImageMemoryBarrier*)vkStream->allocArray(imageMemoryBarrierCount, sizeof(VkImageMemoryBarrier));
+                    if (pImageMemoryBarriers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)imageMemoryBarrierCount; ++i)
+                        {
+                            unmarshal_VkImageMemoryBarrier(vkStream, pImageMemoryBarriers + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdPipelineBarrier)
+                {
+                    m_vk->vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+                }
+                else
+                {
+                    onFailedCall("vkCmdPipelineBarrier");
+                }
+                break;
+            }
+            case OP_vkCmdBeginQuery:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkQueryPool queryPool;
+                uint32_t query;
+                VkQueryControlFlags flags;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                queryPool = vkStream->handleMapping()->fromWire_VkQueryPool(vkStream, vkStream->getU64());
+                vkStream->read(&query, sizeof(uint32_t));
+                vkStream->read(&flags, sizeof(VkQueryControlFlags));
+                if (!vkStream->error() && m_vk->vkCmdBeginQuery)
+                {
+                    m_vk->vkCmdBeginQuery(commandBuffer, queryPool, query, flags);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBeginQuery");
+                }
+                break;
+            }
+            case OP_vkCmdEndQuery:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkQueryPool queryPool;
+                uint32_t query;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                queryPool = vkStream->handleMapping()->fromWire_VkQueryPool(vkStream, vkStream->getU64());
+                vkStream->read(&query, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdEndQuery)
+                {
+                    m_vk->vkCmdEndQuery(commandBuffer, queryPool, query);
+                }
+                else
+                {
+                    onFailedCall("vkCmdEndQuery");
+                }
+                break;
+            }
+            case OP_vkCmdResetQueryPool:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkQueryPool queryPool;
+                uint32_t firstQuery;
+                uint32_t queryCount;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                queryPool = vkStream->handleMapping()->fromWire_VkQueryPool(vkStream, vkStream->getU64());
+                vkStream->read(&firstQuery, sizeof(uint32_t));
+                vkStream->read(&queryCount, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdResetQueryPool)
+                {
+                    m_vk->vkCmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+                }
+                else
+                {
+                    onFailedCall("vkCmdResetQueryPool");
+                }
+                break;
+            }
+            case OP_vkCmdWriteTimestamp:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkPipelineStageFlagBits pipelineStage;
+                VkQueryPool queryPool;
+                uint32_t query;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&pipelineStage, sizeof(VkPipelineStageFlagBits));
+                queryPool = vkStream->handleMapping()->fromWire_VkQueryPool(vkStream, vkStream->getU64());
+                vkStream->read(&query, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdWriteTimestamp)
+                {
+                    m_vk->vkCmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+                }
+                else
+                {
+                    onFailedCall("vkCmdWriteTimestamp");
+                }
+                break;
+            }
+            case OP_vkCmdCopyQueryPoolResults:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkQueryPool queryPool;
+                uint32_t firstQuery;
+                uint32_t queryCount;
+                VkBuffer dstBuffer;
+                VkDeviceSize dstOffset;
+                VkDeviceSize stride;
+                VkQueryResultFlags flags;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                queryPool = vkStream->handleMapping()->fromWire_VkQueryPool(vkStream, vkStream->getU64());
+                vkStream->read(&firstQuery, sizeof(uint32_t));
+                vkStream->read(&queryCount, sizeof(uint32_t));
+                dstBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&dstOffset, sizeof(VkDeviceSize));
+                vkStream->read(&stride, sizeof(VkDeviceSize));
+                vkStream->read(&flags, sizeof(VkQueryResultFlags));
+                if (!vkStream->error() && m_vk->vkCmdCopyQueryPoolResults)
+                {
+                    m_vk->vkCmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+                }
+                else
+                {
+                    onFailedCall("vkCmdCopyQueryPoolResults");
+                }
+                break;
+            }
+            case OP_vkCmdPushConstants:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkPipelineLayout layout;
+                VkShaderStageFlags stageFlags;
+                uint32_t offset;
+                uint32_t size;
+                uint8_t* pValues = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                layout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+                vkStream->read(&stageFlags, sizeof(VkShaderStageFlags));
+                vkStream->read(&offset, sizeof(uint32_t));
+                vkStream->read(&size, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pValues = (uint8_t*)vkStream->allocArray(size, sizeof(uint8_t));
+                    if (pValues)
+                    {
+                        vkStream->read(pValues, size * sizeof(uint8_t));
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdPushConstants)
+                {
+                    m_vk->vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+                }
+                else
+                {
+                    onFailedCall("vkCmdPushConstants");
+                }
+                break;
+            }
+            case OP_vkCmdBeginRenderPass:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkRenderPassBeginInfo* pRenderPassBegin = nullptr;
+                VkSubpassContents contents;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pRenderPassBegin = (VkRenderPassBeginInfo*)vkStream->allocArray(1, sizeof(VkRenderPassBeginInfo));
+                    if (pRenderPassBegin)
+                    {
+                        unmarshal_VkRenderPassBeginInfo(vkStream, pRenderPassBegin);
+                    }
+                }
+                vkStream->read(&contents, sizeof(VkSubpassContents));
+                if (!vkStream->error() && m_vk->vkCmdBeginRenderPass)
+                {
+                    m_vk->vkCmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBeginRenderPass");
+                }
+                break;
+            }
+            case OP_vkCmdNextSubpass:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkSubpassContents contents;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&contents, sizeof(VkSubpassContents));
+                if (!vkStream->error() && m_vk->vkCmdNextSubpass)
+                {
+                    m_vk->vkCmdNextSubpass(commandBuffer, contents);
+                }
+                else
+                {
+                    onFailedCall("vkCmdNextSubpass");
+                }
+                break;
+            }
+            case OP_vkCmdEndRenderPass:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkCmdEndRenderPass)
+                {
+                    m_vk->vkCmdEndRenderPass(commandBuffer);
+                }
+                else
+                {
+                    onFailedCall("vkCmdEndRenderPass");
+                }
+                break;
+            }
+            case OP_vkCmdExecuteCommands:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t commandBufferCount;
+                VkCommandBuffer* pCommandBuffers = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&commandBufferCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pCommandBuffers = (VkCommandBuffer*)vkStream->allocArray(commandBufferCount, sizeof(VkCommandBuffer));
+                    if (pCommandBuffers)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)commandBufferCount; ++i)
+                        {
+                            pCommandBuffers[i] = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdExecuteCommands)
+                {
+                    m_vk->vkCmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+                }
+                else
+                {
+                    onFailedCall("vkCmdExecuteCommands");
+                }
+                break;
+            }
+#endif
+#ifdef VK_VERSION_1_1
+            case OP_vkEnumerateInstanceVersion:
+            {
+                m_lock.read();
+                uint32_t* pApiVersion = nullptr;
+                if (vkStream->getU32())
+                {
+                    pApiVersion = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                }
+                m_lock.unlock();
+                VkResult vkEnumerateInstanceVersion_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkEnumerateInstanceVersion)
+                {
+                    vkEnumerateInstanceVersion_VkResult_return = m_vk->vkEnumerateInstanceVersion(pApiVersion);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkEnumerateInstanceVersion");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkEnumerateInstanceVersion_VkResult_return, sizeof(VkResult));
+                if (called && vkEnumerateInstanceVersion_VkResult_return >= 0)
+                {
+                    if (pApiVersion)
+                    {
+                        vkStream->write(pApiVersion, sizeof(uint32_t));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkBindBufferMemory2:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t bindInfoCount;
+                VkBindBufferMemoryInfo* pBindInfos = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&bindInfoCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pBindInfos = (VkBindBufferMemoryInfo*)vkStream->allocArray(bindInfoCount, sizeof(VkBindBufferMemoryInfo));
+                    if (pBindInfos)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+                        {
+                            unmarshal_VkBindBufferMemoryInfo(vkStream, pBindInfos + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkBindBufferMemory2_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkBindBufferMemory2)
+                {
+                    vkBindBufferMemory2_VkResult_return = m_vk->vkBindBufferMemory2(device, bindInfoCount, pBindInfos);
+                }
+                else
+                {
+                    onFailedCall("vkBindBufferMemory2");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkBindBufferMemory2_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkBindImageMemory2:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t bindInfoCount;
+                VkBindImageMemoryInfo* pBindInfos = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&bindInfoCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pBindInfos = (VkBindImageMemoryInfo*)vkStream->allocArray(bindInfoCount, sizeof(VkBindImageMemoryInfo));
+                    if (pBindInfos)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+                        {
+                            unmarshal_VkBindImageMemoryInfo(vkStream, pBindInfos + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkBindImageMemory2_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkBindImageMemory2)
+                {
+                    vkBindImageMemory2_VkResult_return = m_vk->vkBindImageMemory2(device, bindInfoCount, pBindInfos);
+                }
+                else
+                {
+                    onFailedCall("vkBindImageMemory2");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkBindImageMemory2_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDeviceGroupPeerMemoryFeatures:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t heapIndex;
+                uint32_t localDeviceIndex;
+                uint32_t remoteDeviceIndex;
+                VkPeerMemoryFeatureFlags* pPeerMemoryFeatures = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&heapIndex, sizeof(uint32_t));
+                vkStream->read(&localDeviceIndex, sizeof(uint32_t));
+                vkStream->read(&remoteDeviceIndex, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pPeerMemoryFeatures = (VkPeerMemoryFeatureFlags*)vkStream->allocArray(1, sizeof(VkPeerMemoryFeatureFlags));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDeviceGroupPeerMemoryFeatures)
+                {
+                    m_vk->vkGetDeviceGroupPeerMemoryFeatures(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDeviceGroupPeerMemoryFeatures");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pPeerMemoryFeatures)
+                    {
+                        vkStream->write(pPeerMemoryFeatures, sizeof(VkPeerMemoryFeatureFlags));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCmdSetDeviceMask:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t deviceMask;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&deviceMask, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdSetDeviceMask)
+                {
+                    m_vk->vkCmdSetDeviceMask(commandBuffer, deviceMask);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetDeviceMask");
+                }
+                break;
+            }
+            case OP_vkCmdDispatchBase:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t baseGroupX;
+                uint32_t baseGroupY;
+                uint32_t baseGroupZ;
+                uint32_t groupCountX;
+                uint32_t groupCountY;
+                uint32_t groupCountZ;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&baseGroupX, sizeof(uint32_t));
+                vkStream->read(&baseGroupY, sizeof(uint32_t));
+                vkStream->read(&baseGroupZ, sizeof(uint32_t));
+                vkStream->read(&groupCountX, sizeof(uint32_t));
+                vkStream->read(&groupCountY, sizeof(uint32_t));
+                vkStream->read(&groupCountZ, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDispatchBase)
+                {
+                    m_vk->vkCmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDispatchBase");
+                }
+                break;
+            }
+            case OP_vkEnumeratePhysicalDeviceGroups:
+            {
+                m_lock.read();
+                VkInstance instance;
+                uint32_t* pPhysicalDeviceGroupCount = nullptr;
+                VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties = nullptr;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPhysicalDeviceGroupCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPhysicalDeviceGroupCount)
+                    {
+                        vkStream->read(pPhysicalDeviceGroupCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPhysicalDeviceGroupProperties = (VkPhysicalDeviceGroupProperties*)vkStream->allocArray((pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0), sizeof(VkPhysicalDeviceGroupProperties));
+                    if (pPhysicalDeviceGroupProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0); ++i)
+                        {
+                            pPhysicalDeviceGroupProperties[i].sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pPhysicalDeviceGroupProperties[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkEnumeratePhysicalDeviceGroups_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkEnumeratePhysicalDeviceGroups)
+                {
+                    vkEnumeratePhysicalDeviceGroups_VkResult_return = m_vk->vkEnumeratePhysicalDeviceGroups(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkEnumeratePhysicalDeviceGroups");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkEnumeratePhysicalDeviceGroups_VkResult_return, sizeof(VkResult));
+                if (called && vkEnumeratePhysicalDeviceGroups_VkResult_return >= 0)
+                {
+                    if (pPhysicalDeviceGroupCount)
+                    {
+                        vkStream->write(pPhysicalDeviceGroupCount, sizeof(uint32_t));
+                    }
+                    if (pPhysicalDeviceGroupProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0); ++i)
+                        {
+                            marshal_VkPhysicalDeviceGroupProperties(vkStream, pPhysicalDeviceGroupProperties + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetImageMemoryRequirements2:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImageMemoryRequirementsInfo2* pInfo = nullptr;
+                VkMemoryRequirements2* pMemoryRequirements = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pInfo = (VkImageMemoryRequirementsInfo2*)vkStream->allocArray(1, sizeof(VkImageMemoryRequirementsInfo2));
+                    if (pInfo)
+                    {
+                        unmarshal_VkImageMemoryRequirementsInfo2(vkStream, pInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pMemoryRequirements = (VkMemoryRequirements2*)vkStream->allocArray(1, sizeof(VkMemoryRequirements2));
+                    if (pMemoryRequirements)
+                    {
+                        (*pMemoryRequirements).sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pMemoryRequirements).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetImageMemoryRequirements2)
+                {
+                    m_vk->vkGetImageMemoryRequirements2(device, pInfo, pMemoryRequirements);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetImageMemoryRequirements2");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMemoryRequirements)
+                    {
+                        marshal_VkMemoryRequirements2(vkStream, pMemoryRequirements);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetBufferMemoryRequirements2:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkBufferMemoryRequirementsInfo2* pInfo = nullptr;
+                VkMemoryRequirements2* pMemoryRequirements = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pInfo = (VkBufferMemoryRequirementsInfo2*)vkStream->allocArray(1, sizeof(VkBufferMemoryRequirementsInfo2));
+                    if (pInfo)
+                    {
+                        unmarshal_VkBufferMemoryRequirementsInfo2(vkStream, pInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pMemoryRequirements = (VkMemoryRequirements2*)vkStream->allocArray(1, sizeof(VkMemoryRequirements2));
+                    if (pMemoryRequirements)
+                    {
+                        (*pMemoryRequirements).sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pMemoryRequirements).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetBufferMemoryRequirements2)
+                {
+                    m_vk->vkGetBufferMemoryRequirements2(device, pInfo, pMemoryRequirements);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetBufferMemoryRequirements2");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMemoryRequirements)
+                    {
+                        marshal_VkMemoryRequirements2(vkStream, pMemoryRequirements);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetImageSparseMemoryRequirements2:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImageSparseMemoryRequirementsInfo2* pInfo = nullptr;
+                uint32_t* pSparseMemoryRequirementCount = nullptr;
+                VkSparseImageMemoryRequirements2* pSparseMemoryRequirements = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pInfo = (VkImageSparseMemoryRequirementsInfo2*)vkStream->allocArray(1, sizeof(VkImageSparseMemoryRequirementsInfo2));
+                    if (pInfo)
+                    {
+                        unmarshal_VkImageSparseMemoryRequirementsInfo2(vkStream, pInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSparseMemoryRequirementCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pSparseMemoryRequirementCount)
+                    {
+                        vkStream->read(pSparseMemoryRequirementCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSparseMemoryRequirements = (VkSparseImageMemoryRequirements2*)vkStream->allocArray((pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0), sizeof(VkSparseImageMemoryRequirements2));
+                    if (pSparseMemoryRequirements)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+                        {
+                            pSparseMemoryRequirements[i].sType = VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pSparseMemoryRequirements[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetImageSparseMemoryRequirements2)
+                {
+                    m_vk->vkGetImageSparseMemoryRequirements2(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetImageSparseMemoryRequirements2");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pSparseMemoryRequirementCount)
+                    {
+                        vkStream->write(pSparseMemoryRequirementCount, sizeof(uint32_t));
+                    }
+                    if (pSparseMemoryRequirements)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+                        {
+                            marshal_VkSparseImageMemoryRequirements2(vkStream, pSparseMemoryRequirements + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceFeatures2:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceFeatures2* pFeatures = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pFeatures = (VkPhysicalDeviceFeatures2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceFeatures2));
+                    if (pFeatures)
+                    {
+                        (*pFeatures).sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pFeatures).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceFeatures2)
+                {
+                    m_vk->vkGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceFeatures2");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pFeatures)
+                    {
+                        marshal_VkPhysicalDeviceFeatures2(vkStream, pFeatures);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceProperties2:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceProperties2* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkPhysicalDeviceProperties2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceProperties2));
+                    if (pProperties)
+                    {
+                        (*pProperties).sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceProperties2)
+                {
+                    m_vk->vkGetPhysicalDeviceProperties2(physicalDevice, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceProperties2");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pProperties)
+                    {
+                        marshal_VkPhysicalDeviceProperties2(vkStream, pProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceFormatProperties2:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkFormat format;
+                VkFormatProperties2* pFormatProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&format, sizeof(VkFormat));
+                if (vkStream->getU32())
+                {
+                    pFormatProperties = (VkFormatProperties2*)vkStream->allocArray(1, sizeof(VkFormatProperties2));
+                    if (pFormatProperties)
+                    {
+                        (*pFormatProperties).sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pFormatProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceFormatProperties2)
+                {
+                    m_vk->vkGetPhysicalDeviceFormatProperties2(physicalDevice, format, pFormatProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceFormatProperties2");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pFormatProperties)
+                    {
+                        marshal_VkFormatProperties2(vkStream, pFormatProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceImageFormatProperties2:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo = nullptr;
+                VkImageFormatProperties2* pImageFormatProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pImageFormatInfo = (VkPhysicalDeviceImageFormatInfo2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceImageFormatInfo2));
+                    if (pImageFormatInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceImageFormatInfo2(vkStream, pImageFormatInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pImageFormatProperties = (VkImageFormatProperties2*)vkStream->allocArray(1, sizeof(VkImageFormatProperties2));
+                    if (pImageFormatProperties)
+                    {
+                        (*pImageFormatProperties).sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pImageFormatProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceImageFormatProperties2_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceImageFormatProperties2)
+                {
+                    vkGetPhysicalDeviceImageFormatProperties2_VkResult_return = m_vk->vkGetPhysicalDeviceImageFormatProperties2(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceImageFormatProperties2");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceImageFormatProperties2_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceImageFormatProperties2_VkResult_return >= 0)
+                {
+                    if (pImageFormatProperties)
+                    {
+                        marshal_VkImageFormatProperties2(vkStream, pImageFormatProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceQueueFamilyProperties2:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                uint32_t* pQueueFamilyPropertyCount = nullptr;
+                VkQueueFamilyProperties2* pQueueFamilyProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pQueueFamilyPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pQueueFamilyPropertyCount)
+                    {
+                        vkStream->read(pQueueFamilyPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pQueueFamilyProperties = (VkQueueFamilyProperties2*)vkStream->allocArray((pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0), sizeof(VkQueueFamilyProperties2));
+                    if (pQueueFamilyProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+                        {
+                            pQueueFamilyProperties[i].sType = VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pQueueFamilyProperties[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceQueueFamilyProperties2)
+                {
+                    m_vk->vkGetPhysicalDeviceQueueFamilyProperties2(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceQueueFamilyProperties2");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pQueueFamilyPropertyCount)
+                    {
+                        vkStream->write(pQueueFamilyPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pQueueFamilyProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+                        {
+                            marshal_VkQueueFamilyProperties2(vkStream, pQueueFamilyProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceMemoryProperties2:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceMemoryProperties2* pMemoryProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pMemoryProperties = (VkPhysicalDeviceMemoryProperties2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceMemoryProperties2));
+                    if (pMemoryProperties)
+                    {
+                        (*pMemoryProperties).sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pMemoryProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceMemoryProperties2)
+                {
+                    m_vk->vkGetPhysicalDeviceMemoryProperties2(physicalDevice, pMemoryProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceMemoryProperties2");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMemoryProperties)
+                    {
+                        marshal_VkPhysicalDeviceMemoryProperties2(vkStream, pMemoryProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceSparseImageFormatProperties2:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo = nullptr;
+                uint32_t* pPropertyCount = nullptr;
+                VkSparseImageFormatProperties2* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pFormatInfo = (VkPhysicalDeviceSparseImageFormatInfo2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceSparseImageFormatInfo2));
+                    if (pFormatInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceSparseImageFormatInfo2(vkStream, pFormatInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkSparseImageFormatProperties2*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkSparseImageFormatProperties2));
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            pProperties[i].sType = VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pProperties[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSparseImageFormatProperties2)
+                {
+                    m_vk->vkGetPhysicalDeviceSparseImageFormatProperties2(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSparseImageFormatProperties2");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkSparseImageFormatProperties2(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkTrimCommandPool:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkCommandPool commandPool;
+                VkCommandPoolTrimFlags flags;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                commandPool = vkStream->handleMapping()->fromWire_VkCommandPool(vkStream, vkStream->getU64());
+                vkStream->read(&flags, sizeof(VkCommandPoolTrimFlags));
+                if (!vkStream->error() && m_vk->vkTrimCommandPool)
+                {
+                    m_vk->vkTrimCommandPool(device, commandPool, flags);
+                }
+                else
+                {
+                    onFailedCall("vkTrimCommandPool");
+                }
+                break;
+            }
+            case OP_vkGetDeviceQueue2:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDeviceQueueInfo2* pQueueInfo = nullptr;
+                VkQueue* pQueue = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pQueueInfo = (VkDeviceQueueInfo2*)vkStream->allocArray(1, sizeof(VkDeviceQueueInfo2));
+                    if (pQueueInfo)
+                    {
+                        unmarshal_VkDeviceQueueInfo2(vkStream, pQueueInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pQueue = (VkQueue*)vkStream->allocArray(1, sizeof(VkQueue));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDeviceQueue2)
+                {
+                    m_vk->vkGetDeviceQueue2(device, pQueueInfo, pQueue);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDeviceQueue2");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pQueue)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkQueue(*pQueue));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateSamplerYcbcrConversion:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSamplerYcbcrConversionCreateInfo* pCreateInfo = nullptr;
+                VkSamplerYcbcrConversion* pYcbcrConversion = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkSamplerYcbcrConversionCreateInfo*)vkStream->allocArray(1, sizeof(VkSamplerYcbcrConversionCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkSamplerYcbcrConversionCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pYcbcrConversion = (VkSamplerYcbcrConversion*)vkStream->allocArray(1, sizeof(VkSamplerYcbcrConversion));
+                }
+                m_lock.unlock();
+                VkResult vkCreateSamplerYcbcrConversion_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateSamplerYcbcrConversion)
+                {
+                    vkCreateSamplerYcbcrConversion_VkResult_return = m_vk->vkCreateSamplerYcbcrConversion(device, pCreateInfo, nullptr, pYcbcrConversion);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateSamplerYcbcrConversion");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateSamplerYcbcrConversion_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateSamplerYcbcrConversion_VkResult_return >= 0)
+                {
+                    if (pYcbcrConversion)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkSamplerYcbcrConversion(*pYcbcrConversion));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroySamplerYcbcrConversion:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSamplerYcbcrConversion ycbcrConversion;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                ycbcrConversion = vkStream->handleMapping()->fromWire_VkSamplerYcbcrConversion(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroySamplerYcbcrConversion)
+                {
+                    m_vk->vkDestroySamplerYcbcrConversion(device, ycbcrConversion, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkSamplerYcbcrConversion.remove(ycbcrConversion);
+                }
+                else
+                {
+                    onFailedCall("vkDestroySamplerYcbcrConversion");
+                }
+                break;
+            }
+            case OP_vkCreateDescriptorUpdateTemplate:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorUpdateTemplateCreateInfo* pCreateInfo = nullptr;
+                VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkDescriptorUpdateTemplateCreateInfo*)vkStream->allocArray(1, sizeof(VkDescriptorUpdateTemplateCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkDescriptorUpdateTemplateCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate*)vkStream->allocArray(1, sizeof(VkDescriptorUpdateTemplate));
+                }
+                m_lock.unlock();
+                VkResult vkCreateDescriptorUpdateTemplate_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateDescriptorUpdateTemplate)
+                {
+                    vkCreateDescriptorUpdateTemplate_VkResult_return = m_vk->vkCreateDescriptorUpdateTemplate(device, pCreateInfo, nullptr, pDescriptorUpdateTemplate);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateDescriptorUpdateTemplate");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateDescriptorUpdateTemplate_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateDescriptorUpdateTemplate_VkResult_return >= 0)
+                {
+                    if (pDescriptorUpdateTemplate)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorUpdateTemplate(*pDescriptorUpdateTemplate));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyDescriptorUpdateTemplate:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorUpdateTemplate descriptorUpdateTemplate;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                descriptorUpdateTemplate = vkStream->handleMapping()->fromWire_VkDescriptorUpdateTemplate(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyDescriptorUpdateTemplate)
+                {
+                    m_vk->vkDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkDescriptorUpdateTemplate.remove(descriptorUpdateTemplate);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyDescriptorUpdateTemplate");
+                }
+                break;
+            }
+            case OP_vkGetPhysicalDeviceExternalBufferProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo = nullptr;
+                VkExternalBufferProperties* pExternalBufferProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pExternalBufferInfo = (VkPhysicalDeviceExternalBufferInfo*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceExternalBufferInfo));
+                    if (pExternalBufferInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceExternalBufferInfo(vkStream, pExternalBufferInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pExternalBufferProperties = (VkExternalBufferProperties*)vkStream->allocArray(1, sizeof(VkExternalBufferProperties));
+                    if (pExternalBufferProperties)
+                    {
+                        (*pExternalBufferProperties).sType = VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pExternalBufferProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceExternalBufferProperties)
+                {
+                    m_vk->vkGetPhysicalDeviceExternalBufferProperties(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceExternalBufferProperties");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pExternalBufferProperties)
+                    {
+                        marshal_VkExternalBufferProperties(vkStream, pExternalBufferProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceExternalFenceProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo = nullptr;
+                VkExternalFenceProperties* pExternalFenceProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pExternalFenceInfo = (VkPhysicalDeviceExternalFenceInfo*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceExternalFenceInfo));
+                    if (pExternalFenceInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceExternalFenceInfo(vkStream, pExternalFenceInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pExternalFenceProperties = (VkExternalFenceProperties*)vkStream->allocArray(1, sizeof(VkExternalFenceProperties));
+                    if (pExternalFenceProperties)
+                    {
+                        (*pExternalFenceProperties).sType = VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pExternalFenceProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceExternalFenceProperties)
+                {
+                    m_vk->vkGetPhysicalDeviceExternalFenceProperties(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceExternalFenceProperties");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pExternalFenceProperties)
+                    {
+                        marshal_VkExternalFenceProperties(vkStream, pExternalFenceProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceExternalSemaphoreProperties:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo = nullptr;
+                VkExternalSemaphoreProperties* pExternalSemaphoreProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pExternalSemaphoreInfo = (VkPhysicalDeviceExternalSemaphoreInfo*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceExternalSemaphoreInfo));
+                    if (pExternalSemaphoreInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceExternalSemaphoreInfo(vkStream, pExternalSemaphoreInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pExternalSemaphoreProperties = (VkExternalSemaphoreProperties*)vkStream->allocArray(1, sizeof(VkExternalSemaphoreProperties));
+                    if (pExternalSemaphoreProperties)
+                    {
+                        (*pExternalSemaphoreProperties).sType = VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pExternalSemaphoreProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceExternalSemaphoreProperties)
+                {
+                    m_vk->vkGetPhysicalDeviceExternalSemaphoreProperties(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceExternalSemaphoreProperties");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pExternalSemaphoreProperties)
+                    {
+                        marshal_VkExternalSemaphoreProperties(vkStream, pExternalSemaphoreProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDescriptorSetLayoutSupport:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorSetLayoutCreateInfo* pCreateInfo = nullptr;
+                VkDescriptorSetLayoutSupport* pSupport = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkDescriptorSetLayoutCreateInfo*)vkStream->allocArray(1, sizeof(VkDescriptorSetLayoutCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkDescriptorSetLayoutCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSupport = (VkDescriptorSetLayoutSupport*)vkStream->allocArray(1, sizeof(VkDescriptorSetLayoutSupport));
+                    if (pSupport)
+                    {
+                        (*pSupport).sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pSupport).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDescriptorSetLayoutSupport)
+                {
+                    m_vk->vkGetDescriptorSetLayoutSupport(device, pCreateInfo, pSupport);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDescriptorSetLayoutSupport");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pSupport)
+                    {
+                        marshal_VkDescriptorSetLayoutSupport(vkStream, pSupport);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_surface
+            case OP_vkDestroySurfaceKHR:
+            {
+                m_lock.read();
+                VkInstance instance;
+                VkSurfaceKHR surface;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroySurfaceKHR)
+                {
+                    m_vk->vkDestroySurfaceKHR(instance, surface, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkSurfaceKHR.remove(surface);
+                }
+                else
+                {
+                    onFailedCall("vkDestroySurfaceKHR");
+                }
+                break;
+            }
+            case OP_vkGetPhysicalDeviceSurfaceSupportKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                uint32_t queueFamilyIndex;
+                VkSurfaceKHR surface;
+                VkBool32* pSupported = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&queueFamilyIndex, sizeof(uint32_t));
+                surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSupported = (VkBool32*)vkStream->allocArray(1, sizeof(VkBool32));
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceSurfaceSupportKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSurfaceSupportKHR)
+                {
+                    vkGetPhysicalDeviceSurfaceSupportKHR_VkResult_return = m_vk->vkGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSurfaceSupportKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceSurfaceSupportKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceSurfaceSupportKHR_VkResult_return >= 0)
+                {
+                    if (pSupported)
+                    {
+                        vkStream->write(pSupported, sizeof(VkBool32));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceSurfaceCapabilitiesKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkSurfaceKHR surface;
+                VkSurfaceCapabilitiesKHR* pSurfaceCapabilities = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSurfaceCapabilities = (VkSurfaceCapabilitiesKHR*)vkStream->allocArray(1, sizeof(VkSurfaceCapabilitiesKHR));
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceSurfaceCapabilitiesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSurfaceCapabilitiesKHR)
+                {
+                    vkGetPhysicalDeviceSurfaceCapabilitiesKHR_VkResult_return = m_vk->vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceSurfaceCapabilitiesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceSurfaceCapabilitiesKHR_VkResult_return >= 0)
+                {
+                    if (pSurfaceCapabilities)
+                    {
+                        marshal_VkSurfaceCapabilitiesKHR(vkStream, pSurfaceCapabilities);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceSurfaceFormatsKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkSurfaceKHR surface;
+                uint32_t* pSurfaceFormatCount = nullptr;
+                VkSurfaceFormatKHR* pSurfaceFormats = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSurfaceFormatCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pSurfaceFormatCount)
+                    {
+                        vkStream->read(pSurfaceFormatCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSurfaceFormats = (VkSurfaceFormatKHR*)vkStream->allocArray((pSurfaceFormatCount ? *pSurfaceFormatCount : 0), sizeof(VkSurfaceFormatKHR));
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceSurfaceFormatsKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSurfaceFormatsKHR)
+                {
+                    vkGetPhysicalDeviceSurfaceFormatsKHR_VkResult_return = m_vk->vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSurfaceFormatsKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceSurfaceFormatsKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceSurfaceFormatsKHR_VkResult_return >= 0)
+                {
+                    if (pSurfaceFormatCount)
+                    {
+                        vkStream->write(pSurfaceFormatCount, sizeof(uint32_t));
+                    }
+                    if (pSurfaceFormats)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pSurfaceFormatCount ? *pSurfaceFormatCount : 0); ++i)
+                        {
+                            marshal_VkSurfaceFormatKHR(vkStream, pSurfaceFormats + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceSurfacePresentModesKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkSurfaceKHR surface;
+                uint32_t* pPresentModeCount = nullptr;
+                VkPresentModeKHR* pPresentModes = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPresentModeCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPresentModeCount)
+                    {
+                        vkStream->read(pPresentModeCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPresentModes = (VkPresentModeKHR*)vkStream->allocArray((pPresentModeCount ? *pPresentModeCount : 0), sizeof(VkPresentModeKHR));
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceSurfacePresentModesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSurfacePresentModesKHR)
+                {
+                    vkGetPhysicalDeviceSurfacePresentModesKHR_VkResult_return = m_vk->vkGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSurfacePresentModesKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceSurfacePresentModesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceSurfacePresentModesKHR_VkResult_return >= 0)
+                {
+                    if (pPresentModeCount)
+                    {
+                        vkStream->write(pPresentModeCount, sizeof(uint32_t));
+                    }
+                    if (pPresentModes)
+                    {
+                        vkStream->write(pPresentModes, (pPresentModeCount ? *pPresentModeCount : 0) * sizeof(VkPresentModeKHR));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_swapchain
+            case OP_vkCreateSwapchainKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSwapchainCreateInfoKHR* pCreateInfo = nullptr;
+                VkSwapchainKHR* pSwapchain = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkSwapchainCreateInfoKHR*)vkStream->allocArray(1, sizeof(VkSwapchainCreateInfoKHR));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkSwapchainCreateInfoKHR(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSwapchain = (VkSwapchainKHR*)vkStream->allocArray(1, sizeof(VkSwapchainKHR));
+                }
+                m_lock.unlock();
+                VkResult vkCreateSwapchainKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateSwapchainKHR)
+                {
+                    vkCreateSwapchainKHR_VkResult_return = m_vk->vkCreateSwapchainKHR(device, pCreateInfo, nullptr, pSwapchain);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateSwapchainKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateSwapchainKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateSwapchainKHR_VkResult_return >= 0)
+                {
+                    if (pSwapchain)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(*pSwapchain));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroySwapchainKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSwapchainKHR swapchain;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroySwapchainKHR)
+                {
+                    m_vk->vkDestroySwapchainKHR(device, swapchain, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkSwapchainKHR.remove(swapchain);
+                }
+                else
+                {
+                    onFailedCall("vkDestroySwapchainKHR");
+                }
+                break;
+            }
+            case OP_vkGetSwapchainImagesKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSwapchainKHR swapchain;
+                uint32_t* pSwapchainImageCount = nullptr;
+                VkImage* pSwapchainImages = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSwapchainImageCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pSwapchainImageCount)
+                    {
+                        vkStream->read(pSwapchainImageCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSwapchainImages = (VkImage*)vkStream->allocArray((pSwapchainImageCount ? *pSwapchainImageCount : 0), sizeof(VkImage));
+                }
+                m_lock.unlock();
+                VkResult vkGetSwapchainImagesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetSwapchainImagesKHR)
+                {
+                    vkGetSwapchainImagesKHR_VkResult_return = m_vk->vkGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetSwapchainImagesKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkGetSwapchainImagesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetSwapchainImagesKHR_VkResult_return >= 0)
+                {
+                    if (pSwapchainImageCount)
+                    {
+                        vkStream->write(pSwapchainImageCount, sizeof(uint32_t));
+                    }
+                    if (pSwapchainImages)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pSwapchainImageCount ? *pSwapchainImageCount : 0); ++i)
+                        {
+                            vkStream->putU64(vkStream->handleMapping()->toWire_VkImage(pSwapchainImages[i]));
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkAcquireNextImageKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSwapchainKHR swapchain;
+                uint64_t timeout;
+                VkSemaphore semaphore;
+                VkFence fence;
+                uint32_t* pImageIndex = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+                vkStream->read(&timeout, sizeof(uint64_t));
+                semaphore = vkStream->handleMapping()->fromWire_VkSemaphore(vkStream, vkStream->getU64());
+                fence = vkStream->handleMapping()->fromWire_VkFence(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pImageIndex = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                }
+                m_lock.unlock();
+                VkResult vkAcquireNextImageKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkAcquireNextImageKHR)
+                {
+                    vkAcquireNextImageKHR_VkResult_return = m_vk->vkAcquireNextImageKHR(device, swapchain, timeout, semaphore, fence, pImageIndex);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkAcquireNextImageKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkAcquireNextImageKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkAcquireNextImageKHR_VkResult_return >= 0)
+                {
+                    if (pImageIndex)
+                    {
+                        vkStream->write(pImageIndex, sizeof(uint32_t));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkQueuePresentKHR:
+            {
+                m_lock.read();
+                VkQueue queue;
+                VkPresentInfoKHR* pPresentInfo = nullptr;
+                queue = vkStream->handleMapping()->fromWire_VkQueue(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPresentInfo = (VkPresentInfoKHR*)vkStream->allocArray(1, sizeof(VkPresentInfoKHR));
+                    if (pPresentInfo)
+                    {
+                        unmarshal_VkPresentInfoKHR(vkStream, pPresentInfo);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkQueuePresentKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkQueuePresentKHR)
+                {
+                    vkQueuePresentKHR_VkResult_return = m_vk->vkQueuePresentKHR(queue, pPresentInfo);
+                }
+                else
+                {
+                    onFailedCall("vkQueuePresentKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkQueuePresentKHR_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDeviceGroupPresentCapabilitiesKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pDeviceGroupPresentCapabilities = (VkDeviceGroupPresentCapabilitiesKHR*)vkStream->allocArray(1, sizeof(VkDeviceGroupPresentCapabilitiesKHR));
+                    if (pDeviceGroupPresentCapabilities)
+                    {
+                        (*pDeviceGroupPresentCapabilities).sType = VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pDeviceGroupPresentCapabilities).pNext);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetDeviceGroupPresentCapabilitiesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDeviceGroupPresentCapabilitiesKHR)
+                {
+                    vkGetDeviceGroupPresentCapabilitiesKHR_VkResult_return = m_vk->vkGetDeviceGroupPresentCapabilitiesKHR(device, pDeviceGroupPresentCapabilities);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDeviceGroupPresentCapabilitiesKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetDeviceGroupPresentCapabilitiesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetDeviceGroupPresentCapabilitiesKHR_VkResult_return >= 0)
+                {
+                    if (pDeviceGroupPresentCapabilities)
+                    {
+                        marshal_VkDeviceGroupPresentCapabilitiesKHR(vkStream, pDeviceGroupPresentCapabilities);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDeviceGroupSurfacePresentModesKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSurfaceKHR surface;
+                VkDeviceGroupPresentModeFlagsKHR* pModes = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pModes = (VkDeviceGroupPresentModeFlagsKHR*)vkStream->allocArray(1, sizeof(VkDeviceGroupPresentModeFlagsKHR));
+                }
+                m_lock.unlock();
+                VkResult vkGetDeviceGroupSurfacePresentModesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDeviceGroupSurfacePresentModesKHR)
+                {
+                    vkGetDeviceGroupSurfacePresentModesKHR_VkResult_return = m_vk->vkGetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDeviceGroupSurfacePresentModesKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetDeviceGroupSurfacePresentModesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetDeviceGroupSurfacePresentModesKHR_VkResult_return >= 0)
+                {
+                    if (pModes)
+                    {
+                        vkStream->write(pModes, sizeof(VkDeviceGroupPresentModeFlagsKHR));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDevicePresentRectanglesKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkSurfaceKHR surface;
+                uint32_t* pRectCount = nullptr;
+                VkRect2D* pRects = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pRectCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pRectCount)
+                    {
+                        vkStream->read(pRectCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pRects = (VkRect2D*)vkStream->allocArray((pRectCount ? *pRectCount : 0), sizeof(VkRect2D));
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDevicePresentRectanglesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDevicePresentRectanglesKHR)
+                {
+                    vkGetPhysicalDevicePresentRectanglesKHR_VkResult_return = m_vk->vkGetPhysicalDevicePresentRectanglesKHR(physicalDevice, surface, pRectCount, pRects);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDevicePresentRectanglesKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDevicePresentRectanglesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDevicePresentRectanglesKHR_VkResult_return >= 0)
+                {
+                    if (pRectCount)
+                    {
+                        vkStream->write(pRectCount, sizeof(uint32_t));
+                    }
+                    if (pRects)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pRectCount ? *pRectCount : 0); ++i)
+                        {
+                            marshal_VkRect2D(vkStream, pRects + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkAcquireNextImage2KHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkAcquireNextImageInfoKHR* pAcquireInfo = nullptr;
+                uint32_t* pImageIndex = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pAcquireInfo = (VkAcquireNextImageInfoKHR*)vkStream->allocArray(1, sizeof(VkAcquireNextImageInfoKHR));
+                    if (pAcquireInfo)
+                    {
+                        unmarshal_VkAcquireNextImageInfoKHR(vkStream, pAcquireInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pImageIndex = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                }
+                m_lock.unlock();
+                VkResult vkAcquireNextImage2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkAcquireNextImage2KHR)
+                {
+                    vkAcquireNextImage2KHR_VkResult_return = m_vk->vkAcquireNextImage2KHR(device, pAcquireInfo, pImageIndex);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkAcquireNextImage2KHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkAcquireNextImage2KHR_VkResult_return, sizeof(VkResult));
+                if (called && vkAcquireNextImage2KHR_VkResult_return >= 0)
+                {
+                    if (pImageIndex)
+                    {
+                        vkStream->write(pImageIndex, sizeof(uint32_t));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_display
+            case OP_vkGetPhysicalDeviceDisplayPlanePropertiesKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                uint32_t* pPropertyCount = nullptr;
+                VkDisplayPlanePropertiesKHR* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkDisplayPlanePropertiesKHR*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkDisplayPlanePropertiesKHR));
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceDisplayPlanePropertiesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceDisplayPlanePropertiesKHR)
+                {
+                    vkGetPhysicalDeviceDisplayPlanePropertiesKHR_VkResult_return = m_vk->vkGetPhysicalDeviceDisplayPlanePropertiesKHR(physicalDevice, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceDisplayPlanePropertiesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceDisplayPlanePropertiesKHR_VkResult_return >= 0)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkDisplayPlanePropertiesKHR(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDisplayPlaneSupportedDisplaysKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                uint32_t planeIndex;
+                uint32_t* pDisplayCount = nullptr;
+                VkDisplayKHR* pDisplays = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&planeIndex, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pDisplayCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pDisplayCount)
+                    {
+                        vkStream->read(pDisplayCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pDisplays = (VkDisplayKHR*)vkStream->allocArray((pDisplayCount ? *pDisplayCount : 0), sizeof(VkDisplayKHR));
+                }
+                m_lock.unlock();
+                VkResult vkGetDisplayPlaneSupportedDisplaysKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDisplayPlaneSupportedDisplaysKHR)
+                {
+                    vkGetDisplayPlaneSupportedDisplaysKHR_VkResult_return = m_vk->vkGetDisplayPlaneSupportedDisplaysKHR(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDisplayPlaneSupportedDisplaysKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkGetDisplayPlaneSupportedDisplaysKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetDisplayPlaneSupportedDisplaysKHR_VkResult_return >= 0)
+                {
+                    if (pDisplayCount)
+                    {
+                        vkStream->write(pDisplayCount, sizeof(uint32_t));
+                    }
+                    if (pDisplays)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pDisplayCount ? *pDisplayCount : 0); ++i)
+                        {
+                            vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayKHR(pDisplays[i]));
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDisplayModePropertiesKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkDisplayKHR display;
+                uint32_t* pPropertyCount = nullptr;
+                VkDisplayModePropertiesKHR* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                display = vkStream->handleMapping()->fromWire_VkDisplayKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkDisplayModePropertiesKHR*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkDisplayModePropertiesKHR));
+                }
+                m_lock.unlock();
+                VkResult vkGetDisplayModePropertiesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDisplayModePropertiesKHR)
+                {
+                    vkGetDisplayModePropertiesKHR_VkResult_return = m_vk->vkGetDisplayModePropertiesKHR(physicalDevice, display, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDisplayModePropertiesKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkGetDisplayModePropertiesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetDisplayModePropertiesKHR_VkResult_return >= 0)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkDisplayModePropertiesKHR(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateDisplayModeKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkDisplayKHR display;
+                VkDisplayModeCreateInfoKHR* pCreateInfo = nullptr;
+                VkDisplayModeKHR* pMode = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                display = vkStream->handleMapping()->fromWire_VkDisplayKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkDisplayModeCreateInfoKHR*)vkStream->allocArray(1, sizeof(VkDisplayModeCreateInfoKHR));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkDisplayModeCreateInfoKHR(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pMode = (VkDisplayModeKHR*)vkStream->allocArray(1, sizeof(VkDisplayModeKHR));
+                }
+                m_lock.unlock();
+                VkResult vkCreateDisplayModeKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateDisplayModeKHR)
+                {
+                    vkCreateDisplayModeKHR_VkResult_return = m_vk->vkCreateDisplayModeKHR(physicalDevice, display, pCreateInfo, nullptr, pMode);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateDisplayModeKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateDisplayModeKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateDisplayModeKHR_VkResult_return >= 0)
+                {
+                    if (pMode)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkDisplayModeKHR(*pMode));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDisplayPlaneCapabilitiesKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkDisplayModeKHR mode;
+                uint32_t planeIndex;
+                VkDisplayPlaneCapabilitiesKHR* pCapabilities = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                mode = vkStream->handleMapping()->fromWire_VkDisplayModeKHR(vkStream, vkStream->getU64());
+                vkStream->read(&planeIndex, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pCapabilities = (VkDisplayPlaneCapabilitiesKHR*)vkStream->allocArray(1, sizeof(VkDisplayPlaneCapabilitiesKHR));
+                }
+                m_lock.unlock();
+                VkResult vkGetDisplayPlaneCapabilitiesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDisplayPlaneCapabilitiesKHR)
+                {
+                    vkGetDisplayPlaneCapabilitiesKHR_VkResult_return = m_vk->vkGetDisplayPlaneCapabilitiesKHR(physicalDevice, mode, planeIndex, pCapabilities);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDisplayPlaneCapabilitiesKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetDisplayPlaneCapabilitiesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetDisplayPlaneCapabilitiesKHR_VkResult_return >= 0)
+                {
+                    if (pCapabilities)
+                    {
+                        marshal_VkDisplayPlaneCapabilitiesKHR(vkStream, pCapabilities);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCreateDisplayPlaneSurfaceKHR:
+            {
+                m_lock.read();
+                VkInstance instance;
+                VkDisplaySurfaceCreateInfoKHR* pCreateInfo = nullptr;
+                VkSurfaceKHR* pSurface = nullptr;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkDisplaySurfaceCreateInfoKHR*)vkStream->allocArray(1, sizeof(VkDisplaySurfaceCreateInfoKHR));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkDisplaySurfaceCreateInfoKHR(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSurface = (VkSurfaceKHR*)vkStream->allocArray(1, sizeof(VkSurfaceKHR));
+                }
+                m_lock.unlock();
+                VkResult vkCreateDisplayPlaneSurfaceKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateDisplayPlaneSurfaceKHR)
+                {
+                    vkCreateDisplayPlaneSurfaceKHR_VkResult_return = m_vk->vkCreateDisplayPlaneSurfaceKHR(instance, pCreateInfo, nullptr, pSurface);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateDisplayPlaneSurfaceKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateDisplayPlaneSurfaceKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateDisplayPlaneSurfaceKHR_VkResult_return >= 0)
+                {
+                    if (pSurface)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkSurfaceKHR(*pSurface));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_display_swapchain
+            case OP_vkCreateSharedSwapchainsKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t swapchainCount;
+                VkSwapchainCreateInfoKHR* pCreateInfos = nullptr;
+                VkSwapchainKHR* pSwapchains = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&swapchainCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pCreateInfos = (VkSwapchainCreateInfoKHR*)vkStream->allocArray(swapchainCount, sizeof(VkSwapchainCreateInfoKHR));
+                    if (pCreateInfos)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)swapchainCount; ++i)
+                        {
+                            unmarshal_VkSwapchainCreateInfoKHR(vkStream, pCreateInfos + i);
+                        }
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSwapchains = (VkSwapchainKHR*)vkStream->allocArray(swapchainCount, sizeof(VkSwapchainKHR));
+                }
+                m_lock.unlock();
+                VkResult vkCreateSharedSwapchainsKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateSharedSwapchainsKHR)
+                {
+                    vkCreateSharedSwapchainsKHR_VkResult_return = m_vk->vkCreateSharedSwapchainsKHR(device, swapchainCount, pCreateInfos, nullptr, pSwapchains);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateSharedSwapchainsKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateSharedSwapchainsKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateSharedSwapchainsKHR_VkResult_return >= 0)
+                {
+                    if (pSwapchains)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)swapchainCount; ++i)
+                        {
+                            vkStream->putU64(vkStream->handleMapping()->toWire_VkSwapchainKHR(pSwapchains[i]));
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_win32_surface
+            case OP_vkGetPhysicalDeviceWin32PresentationSupportKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                uint32_t queueFamilyIndex;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&queueFamilyIndex, sizeof(uint32_t));
+                m_lock.unlock();
+                VkBool32 vkGetPhysicalDeviceWin32PresentationSupportKHR_VkBool32_return = (VkBool32)0;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceWin32PresentationSupportKHR)
+                {
+                    vkGetPhysicalDeviceWin32PresentationSupportKHR_VkBool32_return = m_vk->vkGetPhysicalDeviceWin32PresentationSupportKHR(physicalDevice, queueFamilyIndex);
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceWin32PresentationSupportKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceWin32PresentationSupportKHR_VkBool32_return, sizeof(VkBool32));
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_get_physical_device_properties2
+            case OP_vkGetPhysicalDeviceFeatures2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceFeatures2* pFeatures = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pFeatures = (VkPhysicalDeviceFeatures2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceFeatures2));
+                    if (pFeatures)
+                    {
+                        (*pFeatures).sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pFeatures).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceFeatures2KHR)
+                {
+                    m_vk->vkGetPhysicalDeviceFeatures2KHR(physicalDevice, pFeatures);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceFeatures2KHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pFeatures)
+                    {
+                        marshal_VkPhysicalDeviceFeatures2(vkStream, pFeatures);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceProperties2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceProperties2* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkPhysicalDeviceProperties2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceProperties2));
+                    if (pProperties)
+                    {
+                        (*pProperties).sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceProperties2KHR)
+                {
+                    m_vk->vkGetPhysicalDeviceProperties2KHR(physicalDevice, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceProperties2KHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pProperties)
+                    {
+                        marshal_VkPhysicalDeviceProperties2(vkStream, pProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceFormatProperties2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkFormat format;
+                VkFormatProperties2* pFormatProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&format, sizeof(VkFormat));
+                if (vkStream->getU32())
+                {
+                    pFormatProperties = (VkFormatProperties2*)vkStream->allocArray(1, sizeof(VkFormatProperties2));
+                    if (pFormatProperties)
+                    {
+                        (*pFormatProperties).sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pFormatProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceFormatProperties2KHR)
+                {
+                    m_vk->vkGetPhysicalDeviceFormatProperties2KHR(physicalDevice, format, pFormatProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceFormatProperties2KHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pFormatProperties)
+                    {
+                        marshal_VkFormatProperties2(vkStream, pFormatProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceImageFormatProperties2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo = nullptr;
+                VkImageFormatProperties2* pImageFormatProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pImageFormatInfo = (VkPhysicalDeviceImageFormatInfo2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceImageFormatInfo2));
+                    if (pImageFormatInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceImageFormatInfo2(vkStream, pImageFormatInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pImageFormatProperties = (VkImageFormatProperties2*)vkStream->allocArray(1, sizeof(VkImageFormatProperties2));
+                    if (pImageFormatProperties)
+                    {
+                        (*pImageFormatProperties).sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pImageFormatProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceImageFormatProperties2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceImageFormatProperties2KHR)
+                {
+                    vkGetPhysicalDeviceImageFormatProperties2KHR_VkResult_return = m_vk->vkGetPhysicalDeviceImageFormatProperties2KHR(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceImageFormatProperties2KHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceImageFormatProperties2KHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceImageFormatProperties2KHR_VkResult_return >= 0)
+                {
+                    if (pImageFormatProperties)
+                    {
+                        marshal_VkImageFormatProperties2(vkStream, pImageFormatProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceQueueFamilyProperties2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                uint32_t* pQueueFamilyPropertyCount = nullptr;
+                VkQueueFamilyProperties2* pQueueFamilyProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pQueueFamilyPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pQueueFamilyPropertyCount)
+                    {
+                        vkStream->read(pQueueFamilyPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pQueueFamilyProperties = (VkQueueFamilyProperties2*)vkStream->allocArray((pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0), sizeof(VkQueueFamilyProperties2));
+                    if (pQueueFamilyProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+                        {
+                            pQueueFamilyProperties[i].sType = VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pQueueFamilyProperties[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceQueueFamilyProperties2KHR)
+                {
+                    m_vk->vkGetPhysicalDeviceQueueFamilyProperties2KHR(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceQueueFamilyProperties2KHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pQueueFamilyPropertyCount)
+                    {
+                        vkStream->write(pQueueFamilyPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pQueueFamilyProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pQueueFamilyPropertyCount ? *pQueueFamilyPropertyCount : 0); ++i)
+                        {
+                            marshal_VkQueueFamilyProperties2(vkStream, pQueueFamilyProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceMemoryProperties2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceMemoryProperties2* pMemoryProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pMemoryProperties = (VkPhysicalDeviceMemoryProperties2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceMemoryProperties2));
+                    if (pMemoryProperties)
+                    {
+                        (*pMemoryProperties).sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pMemoryProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceMemoryProperties2KHR)
+                {
+                    m_vk->vkGetPhysicalDeviceMemoryProperties2KHR(physicalDevice, pMemoryProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceMemoryProperties2KHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMemoryProperties)
+                    {
+                        marshal_VkPhysicalDeviceMemoryProperties2(vkStream, pMemoryProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceSparseImageFormatProperties2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo = nullptr;
+                uint32_t* pPropertyCount = nullptr;
+                VkSparseImageFormatProperties2* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pFormatInfo = (VkPhysicalDeviceSparseImageFormatInfo2*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceSparseImageFormatInfo2));
+                    if (pFormatInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceSparseImageFormatInfo2(vkStream, pFormatInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkSparseImageFormatProperties2*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkSparseImageFormatProperties2));
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            pProperties[i].sType = VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pProperties[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSparseImageFormatProperties2KHR)
+                {
+                    m_vk->vkGetPhysicalDeviceSparseImageFormatProperties2KHR(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkSparseImageFormatProperties2(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_device_group
+            case OP_vkGetDeviceGroupPeerMemoryFeaturesKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t heapIndex;
+                uint32_t localDeviceIndex;
+                uint32_t remoteDeviceIndex;
+                VkPeerMemoryFeatureFlags* pPeerMemoryFeatures = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&heapIndex, sizeof(uint32_t));
+                vkStream->read(&localDeviceIndex, sizeof(uint32_t));
+                vkStream->read(&remoteDeviceIndex, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pPeerMemoryFeatures = (VkPeerMemoryFeatureFlags*)vkStream->allocArray(1, sizeof(VkPeerMemoryFeatureFlags));
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDeviceGroupPeerMemoryFeaturesKHR)
+                {
+                    m_vk->vkGetDeviceGroupPeerMemoryFeaturesKHR(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDeviceGroupPeerMemoryFeaturesKHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pPeerMemoryFeatures)
+                    {
+                        vkStream->write(pPeerMemoryFeatures, sizeof(VkPeerMemoryFeatureFlags));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCmdSetDeviceMaskKHR:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t deviceMask;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&deviceMask, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdSetDeviceMaskKHR)
+                {
+                    m_vk->vkCmdSetDeviceMaskKHR(commandBuffer, deviceMask);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetDeviceMaskKHR");
+                }
+                break;
+            }
+            case OP_vkCmdDispatchBaseKHR:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t baseGroupX;
+                uint32_t baseGroupY;
+                uint32_t baseGroupZ;
+                uint32_t groupCountX;
+                uint32_t groupCountY;
+                uint32_t groupCountZ;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&baseGroupX, sizeof(uint32_t));
+                vkStream->read(&baseGroupY, sizeof(uint32_t));
+                vkStream->read(&baseGroupZ, sizeof(uint32_t));
+                vkStream->read(&groupCountX, sizeof(uint32_t));
+                vkStream->read(&groupCountY, sizeof(uint32_t));
+                vkStream->read(&groupCountZ, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDispatchBaseKHR)
+                {
+                    m_vk->vkCmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDispatchBaseKHR");
+                }
+                break;
+            }
+#endif
+#ifdef VK_KHR_maintenance1
+            case OP_vkTrimCommandPoolKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkCommandPool commandPool;
+                VkCommandPoolTrimFlags flags;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                commandPool = vkStream->handleMapping()->fromWire_VkCommandPool(vkStream, vkStream->getU64());
+                vkStream->read(&flags, sizeof(VkCommandPoolTrimFlags));
+                if (!vkStream->error() && m_vk->vkTrimCommandPoolKHR)
+                {
+                    m_vk->vkTrimCommandPoolKHR(device, commandPool, flags);
+                }
+                else
+                {
+                    onFailedCall("vkTrimCommandPoolKHR");
+                }
+                break;
+            }
+#endif
+#ifdef VK_KHR_device_group_creation
+            case OP_vkEnumeratePhysicalDeviceGroupsKHR:
+            {
+                m_lock.read();
+                VkInstance instance;
+                uint32_t* pPhysicalDeviceGroupCount = nullptr;
+                VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties = nullptr;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPhysicalDeviceGroupCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPhysicalDeviceGroupCount)
+                    {
+                        vkStream->read(pPhysicalDeviceGroupCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPhysicalDeviceGroupProperties = (VkPhysicalDeviceGroupProperties*)vkStream->allocArray((pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0), sizeof(VkPhysicalDeviceGroupProperties));
+                    if (pPhysicalDeviceGroupProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0); ++i)
+                        {
+                            pPhysicalDeviceGroupProperties[i].sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pPhysicalDeviceGroupProperties[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkEnumeratePhysicalDeviceGroupsKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkEnumeratePhysicalDeviceGroupsKHR)
+                {
+                    vkEnumeratePhysicalDeviceGroupsKHR_VkResult_return = m_vk->vkEnumeratePhysicalDeviceGroupsKHR(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkEnumeratePhysicalDeviceGroupsKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkEnumeratePhysicalDeviceGroupsKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkEnumeratePhysicalDeviceGroupsKHR_VkResult_return >= 0)
+                {
+                    if (pPhysicalDeviceGroupCount)
+                    {
+                        vkStream->write(pPhysicalDeviceGroupCount, sizeof(uint32_t));
+                    }
+                    if (pPhysicalDeviceGroupProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPhysicalDeviceGroupCount ? *pPhysicalDeviceGroupCount : 0); ++i)
+                        {
+                            marshal_VkPhysicalDeviceGroupProperties(vkStream, pPhysicalDeviceGroupProperties + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_external_memory_capabilities
+            case OP_vkGetPhysicalDeviceExternalBufferPropertiesKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo = nullptr;
+                VkExternalBufferProperties* pExternalBufferProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pExternalBufferInfo = (VkPhysicalDeviceExternalBufferInfo*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceExternalBufferInfo));
+                    if (pExternalBufferInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceExternalBufferInfo(vkStream, pExternalBufferInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pExternalBufferProperties = (VkExternalBufferProperties*)vkStream->allocArray(1, sizeof(VkExternalBufferProperties));
+                    if (pExternalBufferProperties)
+                    {
+                        (*pExternalBufferProperties).sType = VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pExternalBufferProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceExternalBufferPropertiesKHR)
+                {
+                    m_vk->vkGetPhysicalDeviceExternalBufferPropertiesKHR(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceExternalBufferPropertiesKHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pExternalBufferProperties)
+                    {
+                        marshal_VkExternalBufferProperties(vkStream, pExternalBufferProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_external_memory_fd
+            case OP_vkGetMemoryFdKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkMemoryGetFdInfoKHR* pGetFdInfo = nullptr;
+                int* pFd = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pGetFdInfo = (VkMemoryGetFdInfoKHR*)vkStream->allocArray(1, sizeof(VkMemoryGetFdInfoKHR));
+                    if (pGetFdInfo)
+                    {
+                        unmarshal_VkMemoryGetFdInfoKHR(vkStream, pGetFdInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pFd = (int*)vkStream->allocArray(1, sizeof(int));
+                }
+                m_lock.unlock();
+                VkResult vkGetMemoryFdKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetMemoryFdKHR)
+                {
+                    vkGetMemoryFdKHR_VkResult_return = m_vk->vkGetMemoryFdKHR(device, pGetFdInfo, pFd);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetMemoryFdKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetMemoryFdKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetMemoryFdKHR_VkResult_return >= 0)
+                {
+                    if (pFd)
+                    {
+                        vkStream->write(pFd, sizeof(int));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetMemoryFdPropertiesKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkExternalMemoryHandleTypeFlagBits handleType;
+                int fd;
+                VkMemoryFdPropertiesKHR* pMemoryFdProperties = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&handleType, sizeof(VkExternalMemoryHandleTypeFlagBits));
+                vkStream->read(&fd, sizeof(int));
+                if (vkStream->getU32())
+                {
+                    pMemoryFdProperties = (VkMemoryFdPropertiesKHR*)vkStream->allocArray(1, sizeof(VkMemoryFdPropertiesKHR));
+                    if (pMemoryFdProperties)
+                    {
+                        (*pMemoryFdProperties).sType = VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pMemoryFdProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetMemoryFdPropertiesKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetMemoryFdPropertiesKHR)
+                {
+                    vkGetMemoryFdPropertiesKHR_VkResult_return = m_vk->vkGetMemoryFdPropertiesKHR(device, handleType, fd, pMemoryFdProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetMemoryFdPropertiesKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetMemoryFdPropertiesKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetMemoryFdPropertiesKHR_VkResult_return >= 0)
+                {
+                    if (pMemoryFdProperties)
+                    {
+                        marshal_VkMemoryFdPropertiesKHR(vkStream, pMemoryFdProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_external_semaphore_capabilities
+            case OP_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo = nullptr;
+                VkExternalSemaphoreProperties* pExternalSemaphoreProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pExternalSemaphoreInfo = (VkPhysicalDeviceExternalSemaphoreInfo*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceExternalSemaphoreInfo));
+                    if (pExternalSemaphoreInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceExternalSemaphoreInfo(vkStream, pExternalSemaphoreInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pExternalSemaphoreProperties = (VkExternalSemaphoreProperties*)vkStream->allocArray(1, sizeof(VkExternalSemaphoreProperties));
+                    if (pExternalSemaphoreProperties)
+                    {
+                        (*pExternalSemaphoreProperties).sType = VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pExternalSemaphoreProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceExternalSemaphorePropertiesKHR)
+                {
+                    m_vk->vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pExternalSemaphoreProperties)
+                    {
+                        marshal_VkExternalSemaphoreProperties(vkStream, pExternalSemaphoreProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_external_semaphore_fd
+            case OP_vkImportSemaphoreFdKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pImportSemaphoreFdInfo = (VkImportSemaphoreFdInfoKHR*)vkStream->allocArray(1, sizeof(VkImportSemaphoreFdInfoKHR));
+                    if (pImportSemaphoreFdInfo)
+                    {
+                        unmarshal_VkImportSemaphoreFdInfoKHR(vkStream, pImportSemaphoreFdInfo);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkImportSemaphoreFdKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkImportSemaphoreFdKHR)
+                {
+                    vkImportSemaphoreFdKHR_VkResult_return = m_vk->vkImportSemaphoreFdKHR(device, pImportSemaphoreFdInfo);
+                }
+                else
+                {
+                    onFailedCall("vkImportSemaphoreFdKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkImportSemaphoreFdKHR_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetSemaphoreFdKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSemaphoreGetFdInfoKHR* pGetFdInfo = nullptr;
+                int* pFd = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pGetFdInfo = (VkSemaphoreGetFdInfoKHR*)vkStream->allocArray(1, sizeof(VkSemaphoreGetFdInfoKHR));
+                    if (pGetFdInfo)
+                    {
+                        unmarshal_VkSemaphoreGetFdInfoKHR(vkStream, pGetFdInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pFd = (int*)vkStream->allocArray(1, sizeof(int));
+                }
+                m_lock.unlock();
+                VkResult vkGetSemaphoreFdKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetSemaphoreFdKHR)
+                {
+                    vkGetSemaphoreFdKHR_VkResult_return = m_vk->vkGetSemaphoreFdKHR(device, pGetFdInfo, pFd);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetSemaphoreFdKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetSemaphoreFdKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetSemaphoreFdKHR_VkResult_return >= 0)
+                {
+                    if (pFd)
+                    {
+                        vkStream->write(pFd, sizeof(int));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_push_descriptor
+            case OP_vkCmdPushDescriptorSetKHR:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkPipelineBindPoint pipelineBindPoint;
+                VkPipelineLayout layout;
+                uint32_t set;
+                uint32_t descriptorWriteCount;
+                VkWriteDescriptorSet* pDescriptorWrites = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&pipelineBindPoint, sizeof(VkPipelineBindPoint));
+                layout = vkStream->handleMapping()->fromWire_VkPipelineLayout(vkStream, vkStream->getU64());
+                vkStream->read(&set, sizeof(uint32_t));
+                vkStream->read(&descriptorWriteCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pDescriptorWrites = (VkWriteDescriptorSet*)vkStream->allocArray(descriptorWriteCount, sizeof(VkWriteDescriptorSet));
+                    if (pDescriptorWrites)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)descriptorWriteCount; ++i)
+                        {
+                            unmarshal_VkWriteDescriptorSet(vkStream, pDescriptorWrites + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdPushDescriptorSetKHR)
+                {
+                    m_vk->vkCmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+                }
+                else
+                {
+                    onFailedCall("vkCmdPushDescriptorSetKHR");
+                }
+                break;
+            }
+#endif
+#ifdef VK_KHR_descriptor_update_template
+            case OP_vkCreateDescriptorUpdateTemplateKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorUpdateTemplateCreateInfo* pCreateInfo = nullptr;
+                VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkDescriptorUpdateTemplateCreateInfo*)vkStream->allocArray(1, sizeof(VkDescriptorUpdateTemplateCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkDescriptorUpdateTemplateCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate*)vkStream->allocArray(1, sizeof(VkDescriptorUpdateTemplate));
+                }
+                m_lock.unlock();
+                VkResult vkCreateDescriptorUpdateTemplateKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateDescriptorUpdateTemplateKHR)
+                {
+                    vkCreateDescriptorUpdateTemplateKHR_VkResult_return = m_vk->vkCreateDescriptorUpdateTemplateKHR(device, pCreateInfo, nullptr, pDescriptorUpdateTemplate);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateDescriptorUpdateTemplateKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateDescriptorUpdateTemplateKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateDescriptorUpdateTemplateKHR_VkResult_return >= 0)
+                {
+                    if (pDescriptorUpdateTemplate)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkDescriptorUpdateTemplate(*pDescriptorUpdateTemplate));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyDescriptorUpdateTemplateKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorUpdateTemplate descriptorUpdateTemplate;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                descriptorUpdateTemplate = vkStream->handleMapping()->fromWire_VkDescriptorUpdateTemplate(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyDescriptorUpdateTemplateKHR)
+                {
+                    m_vk->vkDestroyDescriptorUpdateTemplateKHR(device, descriptorUpdateTemplate, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkDescriptorUpdateTemplate.remove(descriptorUpdateTemplate);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyDescriptorUpdateTemplateKHR");
+                }
+                break;
+            }
+#endif
+#ifdef VK_KHR_create_renderpass2
+            case OP_vkCreateRenderPass2KHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkRenderPassCreateInfo2KHR* pCreateInfo = nullptr;
+                VkRenderPass* pRenderPass = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkRenderPassCreateInfo2KHR*)vkStream->allocArray(1, sizeof(VkRenderPassCreateInfo2KHR));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkRenderPassCreateInfo2KHR(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pRenderPass = (VkRenderPass*)vkStream->allocArray(1, sizeof(VkRenderPass));
+                }
+                m_lock.unlock();
+                VkResult vkCreateRenderPass2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateRenderPass2KHR)
+                {
+                    vkCreateRenderPass2KHR_VkResult_return = m_vk->vkCreateRenderPass2KHR(device, pCreateInfo, nullptr, pRenderPass);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateRenderPass2KHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateRenderPass2KHR_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateRenderPass2KHR_VkResult_return >= 0)
+                {
+                    if (pRenderPass)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkRenderPass(*pRenderPass));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCmdBeginRenderPass2KHR:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkRenderPassBeginInfo* pRenderPassBegin = nullptr;
+                VkSubpassBeginInfoKHR* pSubpassBeginInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pRenderPassBegin = (VkRenderPassBeginInfo*)vkStream->allocArray(1, sizeof(VkRenderPassBeginInfo));
+                    if (pRenderPassBegin)
+                    {
+                        unmarshal_VkRenderPassBeginInfo(vkStream, pRenderPassBegin);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSubpassBeginInfo = (VkSubpassBeginInfoKHR*)vkStream->allocArray(1, sizeof(VkSubpassBeginInfoKHR));
+                    if (pSubpassBeginInfo)
+                    {
+                        unmarshal_VkSubpassBeginInfoKHR(vkStream, pSubpassBeginInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdBeginRenderPass2KHR)
+                {
+                    m_vk->vkCmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBeginRenderPass2KHR");
+                }
+                break;
+            }
+            case OP_vkCmdNextSubpass2KHR:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkSubpassBeginInfoKHR* pSubpassBeginInfo = nullptr;
+                VkSubpassEndInfoKHR* pSubpassEndInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSubpassBeginInfo = (VkSubpassBeginInfoKHR*)vkStream->allocArray(1, sizeof(VkSubpassBeginInfoKHR));
+                    if (pSubpassBeginInfo)
+                    {
+                        unmarshal_VkSubpassBeginInfoKHR(vkStream, pSubpassBeginInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSubpassEndInfo = (VkSubpassEndInfoKHR*)vkStream->allocArray(1, sizeof(VkSubpassEndInfoKHR));
+                    if (pSubpassEndInfo)
+                    {
+                        unmarshal_VkSubpassEndInfoKHR(vkStream, pSubpassEndInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdNextSubpass2KHR)
+                {
+                    m_vk->vkCmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdNextSubpass2KHR");
+                }
+                break;
+            }
+            case OP_vkCmdEndRenderPass2KHR:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkSubpassEndInfoKHR* pSubpassEndInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSubpassEndInfo = (VkSubpassEndInfoKHR*)vkStream->allocArray(1, sizeof(VkSubpassEndInfoKHR));
+                    if (pSubpassEndInfo)
+                    {
+                        unmarshal_VkSubpassEndInfoKHR(vkStream, pSubpassEndInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdEndRenderPass2KHR)
+                {
+                    m_vk->vkCmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdEndRenderPass2KHR");
+                }
+                break;
+            }
+#endif
+#ifdef VK_KHR_shared_presentable_image
+            case OP_vkGetSwapchainStatusKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSwapchainKHR swapchain;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkGetSwapchainStatusKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkGetSwapchainStatusKHR)
+                {
+                    vkGetSwapchainStatusKHR_VkResult_return = m_vk->vkGetSwapchainStatusKHR(device, swapchain);
+                }
+                else
+                {
+                    onFailedCall("vkGetSwapchainStatusKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetSwapchainStatusKHR_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_external_fence_capabilities
+            case OP_vkGetPhysicalDeviceExternalFencePropertiesKHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo = nullptr;
+                VkExternalFenceProperties* pExternalFenceProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pExternalFenceInfo = (VkPhysicalDeviceExternalFenceInfo*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceExternalFenceInfo));
+                    if (pExternalFenceInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceExternalFenceInfo(vkStream, pExternalFenceInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pExternalFenceProperties = (VkExternalFenceProperties*)vkStream->allocArray(1, sizeof(VkExternalFenceProperties));
+                    if (pExternalFenceProperties)
+                    {
+                        (*pExternalFenceProperties).sType = VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pExternalFenceProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceExternalFencePropertiesKHR)
+                {
+                    m_vk->vkGetPhysicalDeviceExternalFencePropertiesKHR(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceExternalFencePropertiesKHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pExternalFenceProperties)
+                    {
+                        marshal_VkExternalFenceProperties(vkStream, pExternalFenceProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_external_fence_fd
+            case OP_vkImportFenceFdKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImportFenceFdInfoKHR* pImportFenceFdInfo = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pImportFenceFdInfo = (VkImportFenceFdInfoKHR*)vkStream->allocArray(1, sizeof(VkImportFenceFdInfoKHR));
+                    if (pImportFenceFdInfo)
+                    {
+                        unmarshal_VkImportFenceFdInfoKHR(vkStream, pImportFenceFdInfo);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkImportFenceFdKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkImportFenceFdKHR)
+                {
+                    vkImportFenceFdKHR_VkResult_return = m_vk->vkImportFenceFdKHR(device, pImportFenceFdInfo);
+                }
+                else
+                {
+                    onFailedCall("vkImportFenceFdKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkImportFenceFdKHR_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetFenceFdKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkFenceGetFdInfoKHR* pGetFdInfo = nullptr;
+                int* pFd = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pGetFdInfo = (VkFenceGetFdInfoKHR*)vkStream->allocArray(1, sizeof(VkFenceGetFdInfoKHR));
+                    if (pGetFdInfo)
+                    {
+                        unmarshal_VkFenceGetFdInfoKHR(vkStream, pGetFdInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pFd = (int*)vkStream->allocArray(1, sizeof(int));
+                }
+                m_lock.unlock();
+                VkResult vkGetFenceFdKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetFenceFdKHR)
+                {
+                    vkGetFenceFdKHR_VkResult_return = m_vk->vkGetFenceFdKHR(device, pGetFdInfo, pFd);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetFenceFdKHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetFenceFdKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetFenceFdKHR_VkResult_return >= 0)
+                {
+                    if (pFd)
+                    {
+                        vkStream->write(pFd, sizeof(int));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_get_surface_capabilities2
+            case OP_vkGetPhysicalDeviceSurfaceCapabilities2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo = nullptr;
+                VkSurfaceCapabilities2KHR* pSurfaceCapabilities = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSurfaceInfo = (VkPhysicalDeviceSurfaceInfo2KHR*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceSurfaceInfo2KHR));
+                    if (pSurfaceInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceSurfaceInfo2KHR(vkStream, pSurfaceInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSurfaceCapabilities = (VkSurfaceCapabilities2KHR*)vkStream->allocArray(1, sizeof(VkSurfaceCapabilities2KHR));
+                    if (pSurfaceCapabilities)
+                    {
+                        (*pSurfaceCapabilities).sType = VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pSurfaceCapabilities).pNext);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceSurfaceCapabilities2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSurfaceCapabilities2KHR)
+                {
+                    vkGetPhysicalDeviceSurfaceCapabilities2KHR_VkResult_return = m_vk->vkGetPhysicalDeviceSurfaceCapabilities2KHR(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSurfaceCapabilities2KHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceSurfaceCapabilities2KHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceSurfaceCapabilities2KHR_VkResult_return >= 0)
+                {
+                    if (pSurfaceCapabilities)
+                    {
+                        marshal_VkSurfaceCapabilities2KHR(vkStream, pSurfaceCapabilities);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceSurfaceFormats2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo = nullptr;
+                uint32_t* pSurfaceFormatCount = nullptr;
+                VkSurfaceFormat2KHR* pSurfaceFormats = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSurfaceInfo = (VkPhysicalDeviceSurfaceInfo2KHR*)vkStream->allocArray(1, sizeof(VkPhysicalDeviceSurfaceInfo2KHR));
+                    if (pSurfaceInfo)
+                    {
+                        unmarshal_VkPhysicalDeviceSurfaceInfo2KHR(vkStream, pSurfaceInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSurfaceFormatCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pSurfaceFormatCount)
+                    {
+                        vkStream->read(pSurfaceFormatCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSurfaceFormats = (VkSurfaceFormat2KHR*)vkStream->allocArray((pSurfaceFormatCount ? *pSurfaceFormatCount : 0), sizeof(VkSurfaceFormat2KHR));
+                    if (pSurfaceFormats)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pSurfaceFormatCount ? *pSurfaceFormatCount : 0); ++i)
+                        {
+                            pSurfaceFormats[i].sType = VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pSurfaceFormats[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceSurfaceFormats2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSurfaceFormats2KHR)
+                {
+                    vkGetPhysicalDeviceSurfaceFormats2KHR_VkResult_return = m_vk->vkGetPhysicalDeviceSurfaceFormats2KHR(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSurfaceFormats2KHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceSurfaceFormats2KHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceSurfaceFormats2KHR_VkResult_return >= 0)
+                {
+                    if (pSurfaceFormatCount)
+                    {
+                        vkStream->write(pSurfaceFormatCount, sizeof(uint32_t));
+                    }
+                    if (pSurfaceFormats)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pSurfaceFormatCount ? *pSurfaceFormatCount : 0); ++i)
+                        {
+                            marshal_VkSurfaceFormat2KHR(vkStream, pSurfaceFormats + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_get_display_properties2
+            case OP_vkGetPhysicalDeviceDisplayPlaneProperties2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                uint32_t* pPropertyCount = nullptr;
+                VkDisplayPlaneProperties2KHR* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkDisplayPlaneProperties2KHR*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkDisplayPlaneProperties2KHR));
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            pProperties[i].sType = VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pProperties[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceDisplayPlaneProperties2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceDisplayPlaneProperties2KHR)
+                {
+                    vkGetPhysicalDeviceDisplayPlaneProperties2KHR_VkResult_return = m_vk->vkGetPhysicalDeviceDisplayPlaneProperties2KHR(physicalDevice, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceDisplayPlaneProperties2KHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceDisplayPlaneProperties2KHR_VkResult_return >= 0)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkDisplayPlaneProperties2KHR(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDisplayModeProperties2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkDisplayKHR display;
+                uint32_t* pPropertyCount = nullptr;
+                VkDisplayModeProperties2KHR* pProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                display = vkStream->handleMapping()->fromWire_VkDisplayKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPropertyCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPropertyCount)
+                    {
+                        vkStream->read(pPropertyCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pProperties = (VkDisplayModeProperties2KHR*)vkStream->allocArray((pPropertyCount ? *pPropertyCount : 0), sizeof(VkDisplayModeProperties2KHR));
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            pProperties[i].sType = VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pProperties[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetDisplayModeProperties2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDisplayModeProperties2KHR)
+                {
+                    vkGetDisplayModeProperties2KHR_VkResult_return = m_vk->vkGetDisplayModeProperties2KHR(physicalDevice, display, pPropertyCount, pProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDisplayModeProperties2KHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkGetDisplayModeProperties2KHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetDisplayModeProperties2KHR_VkResult_return >= 0)
+                {
+                    if (pPropertyCount)
+                    {
+                        vkStream->write(pPropertyCount, sizeof(uint32_t));
+                    }
+                    if (pProperties)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPropertyCount ? *pPropertyCount : 0); ++i)
+                        {
+                            marshal_VkDisplayModeProperties2KHR(vkStream, pProperties + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetDisplayPlaneCapabilities2KHR:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo = nullptr;
+                VkDisplayPlaneCapabilities2KHR* pCapabilities = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pDisplayPlaneInfo = (VkDisplayPlaneInfo2KHR*)vkStream->allocArray(1, sizeof(VkDisplayPlaneInfo2KHR));
+                    if (pDisplayPlaneInfo)
+                    {
+                        unmarshal_VkDisplayPlaneInfo2KHR(vkStream, pDisplayPlaneInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pCapabilities = (VkDisplayPlaneCapabilities2KHR*)vkStream->allocArray(1, sizeof(VkDisplayPlaneCapabilities2KHR));
+                    if (pCapabilities)
+                    {
+                        (*pCapabilities).sType = VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pCapabilities).pNext);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetDisplayPlaneCapabilities2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDisplayPlaneCapabilities2KHR)
+                {
+                    vkGetDisplayPlaneCapabilities2KHR_VkResult_return = m_vk->vkGetDisplayPlaneCapabilities2KHR(physicalDevice, pDisplayPlaneInfo, pCapabilities);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDisplayPlaneCapabilities2KHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetDisplayPlaneCapabilities2KHR_VkResult_return, sizeof(VkResult));
+                if (called && vkGetDisplayPlaneCapabilities2KHR_VkResult_return >= 0)
+                {
+                    if (pCapabilities)
+                    {
+                        marshal_VkDisplayPlaneCapabilities2KHR(vkStream, pCapabilities);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_get_memory_requirements2
+            case OP_vkGetImageMemoryRequirements2KHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImageMemoryRequirementsInfo2* pInfo = nullptr;
+                VkMemoryRequirements2* pMemoryRequirements = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pInfo = (VkImageMemoryRequirementsInfo2*)vkStream->allocArray(1, sizeof(VkImageMemoryRequirementsInfo2));
+                    if (pInfo)
+                    {
+                        unmarshal_VkImageMemoryRequirementsInfo2(vkStream, pInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pMemoryRequirements = (VkMemoryRequirements2*)vkStream->allocArray(1, sizeof(VkMemoryRequirements2));
+                    if (pMemoryRequirements)
+                    {
+                        (*pMemoryRequirements).sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pMemoryRequirements).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetImageMemoryRequirements2KHR)
+                {
+                    m_vk->vkGetImageMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetImageMemoryRequirements2KHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMemoryRequirements)
+                    {
+                        marshal_VkMemoryRequirements2(vkStream, pMemoryRequirements);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetBufferMemoryRequirements2KHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkBufferMemoryRequirementsInfo2* pInfo = nullptr;
+                VkMemoryRequirements2* pMemoryRequirements = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pInfo = (VkBufferMemoryRequirementsInfo2*)vkStream->allocArray(1, sizeof(VkBufferMemoryRequirementsInfo2));
+                    if (pInfo)
+                    {
+                        unmarshal_VkBufferMemoryRequirementsInfo2(vkStream, pInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pMemoryRequirements = (VkMemoryRequirements2*)vkStream->allocArray(1, sizeof(VkMemoryRequirements2));
+                    if (pMemoryRequirements)
+                    {
+                        (*pMemoryRequirements).sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pMemoryRequirements).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetBufferMemoryRequirements2KHR)
+                {
+                    m_vk->vkGetBufferMemoryRequirements2KHR(device, pInfo, pMemoryRequirements);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetBufferMemoryRequirements2KHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMemoryRequirements)
+                    {
+                        marshal_VkMemoryRequirements2(vkStream, pMemoryRequirements);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetImageSparseMemoryRequirements2KHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkImageSparseMemoryRequirementsInfo2* pInfo = nullptr;
+                uint32_t* pSparseMemoryRequirementCount = nullptr;
+                VkSparseImageMemoryRequirements2* pSparseMemoryRequirements = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pInfo = (VkImageSparseMemoryRequirementsInfo2*)vkStream->allocArray(1, sizeof(VkImageSparseMemoryRequirementsInfo2));
+                    if (pInfo)
+                    {
+                        unmarshal_VkImageSparseMemoryRequirementsInfo2(vkStream, pInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSparseMemoryRequirementCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pSparseMemoryRequirementCount)
+                    {
+                        vkStream->read(pSparseMemoryRequirementCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSparseMemoryRequirements = (VkSparseImageMemoryRequirements2*)vkStream->allocArray((pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0), sizeof(VkSparseImageMemoryRequirements2));
+                    if (pSparseMemoryRequirements)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+                        {
+                            pSparseMemoryRequirements[i].sType = VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2;
+                            unmarshal_extension_struct_types(vkStream, (void**)&pSparseMemoryRequirements[i].pNext);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetImageSparseMemoryRequirements2KHR)
+                {
+                    m_vk->vkGetImageSparseMemoryRequirements2KHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetImageSparseMemoryRequirements2KHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pSparseMemoryRequirementCount)
+                    {
+                        vkStream->write(pSparseMemoryRequirementCount, sizeof(uint32_t));
+                    }
+                    if (pSparseMemoryRequirements)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pSparseMemoryRequirementCount ? *pSparseMemoryRequirementCount : 0); ++i)
+                        {
+                            marshal_VkSparseImageMemoryRequirements2(vkStream, pSparseMemoryRequirements + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_sampler_ycbcr_conversion
+            case OP_vkCreateSamplerYcbcrConversionKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSamplerYcbcrConversionCreateInfo* pCreateInfo = nullptr;
+                VkSamplerYcbcrConversion* pYcbcrConversion = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkSamplerYcbcrConversionCreateInfo*)vkStream->allocArray(1, sizeof(VkSamplerYcbcrConversionCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkSamplerYcbcrConversionCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pYcbcrConversion = (VkSamplerYcbcrConversion*)vkStream->allocArray(1, sizeof(VkSamplerYcbcrConversion));
+                }
+                m_lock.unlock();
+                VkResult vkCreateSamplerYcbcrConversionKHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateSamplerYcbcrConversionKHR)
+                {
+                    vkCreateSamplerYcbcrConversionKHR_VkResult_return = m_vk->vkCreateSamplerYcbcrConversionKHR(device, pCreateInfo, nullptr, pYcbcrConversion);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateSamplerYcbcrConversionKHR");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateSamplerYcbcrConversionKHR_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateSamplerYcbcrConversionKHR_VkResult_return >= 0)
+                {
+                    if (pYcbcrConversion)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkSamplerYcbcrConversion(*pYcbcrConversion));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroySamplerYcbcrConversionKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSamplerYcbcrConversion ycbcrConversion;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                ycbcrConversion = vkStream->handleMapping()->fromWire_VkSamplerYcbcrConversion(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroySamplerYcbcrConversionKHR)
+                {
+                    m_vk->vkDestroySamplerYcbcrConversionKHR(device, ycbcrConversion, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkSamplerYcbcrConversion.remove(ycbcrConversion);
+                }
+                else
+                {
+                    onFailedCall("vkDestroySamplerYcbcrConversionKHR");
+                }
+                break;
+            }
+#endif
+#ifdef VK_KHR_bind_memory2
+            case OP_vkBindBufferMemory2KHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t bindInfoCount;
+                VkBindBufferMemoryInfo* pBindInfos = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&bindInfoCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pBindInfos = (VkBindBufferMemoryInfo*)vkStream->allocArray(bindInfoCount, sizeof(VkBindBufferMemoryInfo));
+                    if (pBindInfos)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+                        {
+                            unmarshal_VkBindBufferMemoryInfo(vkStream, pBindInfos + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkBindBufferMemory2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkBindBufferMemory2KHR)
+                {
+                    vkBindBufferMemory2KHR_VkResult_return = m_vk->vkBindBufferMemory2KHR(device, bindInfoCount, pBindInfos);
+                }
+                else
+                {
+                    onFailedCall("vkBindBufferMemory2KHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkBindBufferMemory2KHR_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkBindImageMemory2KHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t bindInfoCount;
+                VkBindImageMemoryInfo* pBindInfos = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&bindInfoCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pBindInfos = (VkBindImageMemoryInfo*)vkStream->allocArray(bindInfoCount, sizeof(VkBindImageMemoryInfo));
+                    if (pBindInfos)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)bindInfoCount; ++i)
+                        {
+                            unmarshal_VkBindImageMemoryInfo(vkStream, pBindInfos + i);
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkBindImageMemory2KHR_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkBindImageMemory2KHR)
+                {
+                    vkBindImageMemory2KHR_VkResult_return = m_vk->vkBindImageMemory2KHR(device, bindInfoCount, pBindInfos);
+                }
+                else
+                {
+                    onFailedCall("vkBindImageMemory2KHR");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkBindImageMemory2KHR_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_maintenance3
+            case OP_vkGetDescriptorSetLayoutSupportKHR:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDescriptorSetLayoutCreateInfo* pCreateInfo = nullptr;
+                VkDescriptorSetLayoutSupport* pSupport = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkDescriptorSetLayoutCreateInfo*)vkStream->allocArray(1, sizeof(VkDescriptorSetLayoutCreateInfo));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkDescriptorSetLayoutCreateInfo(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pSupport = (VkDescriptorSetLayoutSupport*)vkStream->allocArray(1, sizeof(VkDescriptorSetLayoutSupport));
+                    if (pSupport)
+                    {
+                        (*pSupport).sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pSupport).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetDescriptorSetLayoutSupportKHR)
+                {
+                    m_vk->vkGetDescriptorSetLayoutSupportKHR(device, pCreateInfo, pSupport);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetDescriptorSetLayoutSupportKHR");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pSupport)
+                    {
+                        marshal_VkDescriptorSetLayoutSupport(vkStream, pSupport);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_KHR_draw_indirect_count
+            case OP_vkCmdDrawIndirectCountKHR:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer buffer;
+                VkDeviceSize offset;
+                VkBuffer countBuffer;
+                VkDeviceSize countBufferOffset;
+                uint32_t maxDrawCount;
+                uint32_t stride;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&offset, sizeof(VkDeviceSize));
+                countBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&countBufferOffset, sizeof(VkDeviceSize));
+                vkStream->read(&maxDrawCount, sizeof(uint32_t));
+                vkStream->read(&stride, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDrawIndirectCountKHR)
+                {
+                    m_vk->vkCmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDrawIndirectCountKHR");
+                }
+                break;
+            }
+            case OP_vkCmdDrawIndexedIndirectCountKHR:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer buffer;
+                VkDeviceSize offset;
+                VkBuffer countBuffer;
+                VkDeviceSize countBufferOffset;
+                uint32_t maxDrawCount;
+                uint32_t stride;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&offset, sizeof(VkDeviceSize));
+                countBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&countBufferOffset, sizeof(VkDeviceSize));
+                vkStream->read(&maxDrawCount, sizeof(uint32_t));
+                vkStream->read(&stride, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDrawIndexedIndirectCountKHR)
+                {
+                    m_vk->vkCmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDrawIndexedIndirectCountKHR");
+                }
+                break;
+            }
+#endif
+#ifdef VK_EXT_debug_report
+            case OP_vkDestroyDebugReportCallbackEXT:
+            {
+                m_lock.read();
+                VkInstance instance;
+                VkDebugReportCallbackEXT callback;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                callback = vkStream->handleMapping()->fromWire_VkDebugReportCallbackEXT(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyDebugReportCallbackEXT)
+                {
+                    m_vk->vkDestroyDebugReportCallbackEXT(instance, callback, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkDebugReportCallbackEXT.remove(callback);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyDebugReportCallbackEXT");
+                }
+                break;
+            }
+            case OP_vkDebugReportMessageEXT:
+            {
+                m_lock.read();
+                VkInstance instance;
+                VkDebugReportFlagsEXT flags;
+                VkDebugReportObjectTypeEXT objectType;
+                uint64_t object;
+                size_t location;
+                int32_t messageCode;
+                char* pLayerPrefix = nullptr;
+                char* pMessage = nullptr;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                vkStream->read(&flags, sizeof(VkDebugReportFlagsEXT));
+                vkStream->read(&objectType, sizeof(VkDebugReportObjectTypeEXT));
+                vkStream->read(&object, sizeof(uint64_t));
+                location = (size_t)vkStream->getU64();
+                vkStream->read(&messageCode, sizeof(int32_t));
+                pLayerPrefix = vkStream->getString();
+                pMessage = vkStream->getString();
+                if (!vkStream->error() && m_vk->vkDebugReportMessageEXT)
+                {
+                    m_vk->vkDebugReportMessageEXT(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+                }
+                else
+                {
+                    onFailedCall("vkDebugReportMessageEXT");
+                }
+                break;
+            }
+#endif
+#ifdef VK_EXT_debug_marker
+            case OP_vkDebugMarkerSetObjectTagEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDebugMarkerObjectTagInfoEXT* pTagInfo = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pTagInfo = (VkDebugMarkerObjectTagInfoEXT*)vkStream->allocArray(1, sizeof(VkDebugMarkerObjectTagInfoEXT));
+                    if (pTagInfo)
+                    {
+                        unmarshal_VkDebugMarkerObjectTagInfoEXT(vkStream, pTagInfo);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkDebugMarkerSetObjectTagEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkDebugMarkerSetObjectTagEXT)
+                {
+                    vkDebugMarkerSetObjectTagEXT_VkResult_return = m_vk->vkDebugMarkerSetObjectTagEXT(device, pTagInfo);
+                }
+                else
+                {
+                    onFailedCall("vkDebugMarkerSetObjectTagEXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkDebugMarkerSetObjectTagEXT_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDebugMarkerSetObjectNameEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDebugMarkerObjectNameInfoEXT* pNameInfo = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pNameInfo = (VkDebugMarkerObjectNameInfoEXT*)vkStream->allocArray(1, sizeof(VkDebugMarkerObjectNameInfoEXT));
+                    if (pNameInfo)
+                    {
+                        unmarshal_VkDebugMarkerObjectNameInfoEXT(vkStream, pNameInfo);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkDebugMarkerSetObjectNameEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkDebugMarkerSetObjectNameEXT)
+                {
+                    vkDebugMarkerSetObjectNameEXT_VkResult_return = m_vk->vkDebugMarkerSetObjectNameEXT(device, pNameInfo);
+                }
+                else
+                {
+                    onFailedCall("vkDebugMarkerSetObjectNameEXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkDebugMarkerSetObjectNameEXT_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkCmdDebugMarkerBeginEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkDebugMarkerMarkerInfoEXT* pMarkerInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pMarkerInfo = (VkDebugMarkerMarkerInfoEXT*)vkStream->allocArray(1, sizeof(VkDebugMarkerMarkerInfoEXT));
+                    if (pMarkerInfo)
+                    {
+                        unmarshal_VkDebugMarkerMarkerInfoEXT(vkStream, pMarkerInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdDebugMarkerBeginEXT)
+                {
+                    m_vk->vkCmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDebugMarkerBeginEXT");
+                }
+                break;
+            }
+            case OP_vkCmdDebugMarkerEndEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkCmdDebugMarkerEndEXT)
+                {
+                    m_vk->vkCmdDebugMarkerEndEXT(commandBuffer);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDebugMarkerEndEXT");
+                }
+                break;
+            }
+            case OP_vkCmdDebugMarkerInsertEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkDebugMarkerMarkerInfoEXT* pMarkerInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pMarkerInfo = (VkDebugMarkerMarkerInfoEXT*)vkStream->allocArray(1, sizeof(VkDebugMarkerMarkerInfoEXT));
+                    if (pMarkerInfo)
+                    {
+                        unmarshal_VkDebugMarkerMarkerInfoEXT(vkStream, pMarkerInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdDebugMarkerInsertEXT)
+                {
+                    m_vk->vkCmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDebugMarkerInsertEXT");
+                }
+                break;
+            }
+#endif
+#ifdef VK_AMD_draw_indirect_count
+            case OP_vkCmdDrawIndirectCountAMD:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer buffer;
+                VkDeviceSize offset;
+                VkBuffer countBuffer;
+                VkDeviceSize countBufferOffset;
+                uint32_t maxDrawCount;
+                uint32_t stride;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&offset, sizeof(VkDeviceSize));
+                countBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&countBufferOffset, sizeof(VkDeviceSize));
+                vkStream->read(&maxDrawCount, sizeof(uint32_t));
+                vkStream->read(&stride, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDrawIndirectCountAMD)
+                {
+                    m_vk->vkCmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDrawIndirectCountAMD");
+                }
+                break;
+            }
+            case OP_vkCmdDrawIndexedIndirectCountAMD:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkBuffer buffer;
+                VkDeviceSize offset;
+                VkBuffer countBuffer;
+                VkDeviceSize countBufferOffset;
+                uint32_t maxDrawCount;
+                uint32_t stride;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                buffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&offset, sizeof(VkDeviceSize));
+                countBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&countBufferOffset, sizeof(VkDeviceSize));
+                vkStream->read(&maxDrawCount, sizeof(uint32_t));
+                vkStream->read(&stride, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdDrawIndexedIndirectCountAMD)
+                {
+                    m_vk->vkCmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+                }
+                else
+                {
+                    onFailedCall("vkCmdDrawIndexedIndirectCountAMD");
+                }
+                break;
+            }
+#endif
+#ifdef VK_AMD_shader_info
+            case OP_vkGetShaderInfoAMD:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkPipeline pipeline;
+                VkShaderStageFlagBits shaderStage;
+                VkShaderInfoTypeAMD infoType;
+                size_t* pInfoSize = nullptr;
+                uint8_t* pInfo = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                pipeline = vkStream->handleMapping()->fromWire_VkPipeline(vkStream, vkStream->getU64());
+                vkStream->read(&shaderStage, sizeof(VkShaderStageFlagBits));
+                vkStream->read(&infoType, sizeof(VkShaderInfoTypeAMD));
+                if (vkStream->getU32())
+                {
+                    pInfoSize = (size_t*)vkStream->allocArray(1, sizeof(size_t));
+                    if (pInfoSize)
+                    {
+                        *pInfoSize = (size_t)vkStream->getU64();
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pInfo = (uint8_t*)vkStream->allocArray((pInfoSize ? *pInfoSize : 0), sizeof(uint8_t));
+                }
+                m_lock.unlock();
+                VkResult vkGetShaderInfoAMD_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetShaderInfoAMD)
+                {
+                    vkGetShaderInfoAMD_VkResult_return = m_vk->vkGetShaderInfoAMD(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetShaderInfoAMD");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetShaderInfoAMD_VkResult_return, sizeof(VkResult));
+                if (called && vkGetShaderInfoAMD_VkResult_return >= 0)
+                {
+                    if (pInfoSize)
+                    {
+                        vkStream->putU64((uint64_t)*pInfoSize);
+                    }
+                    if (pInfo)
+                    {
+                        vkStream->write(pInfo, (pInfoSize ? *pInfoSize : 0) * sizeof(uint8_t));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_NV_external_memory_capabilities
+            case OP_vkGetPhysicalDeviceExternalImageFormatPropertiesNV:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkFormat format;
+                VkImageType type;
+                VkImageTiling tiling;
+                VkImageUsageFlags usage;
+                VkImageCreateFlags flags;
+                VkExternalMemoryHandleTypeFlagsNV externalHandleType;
+                VkExternalImageFormatPropertiesNV* pExternalImageFormatProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&format, sizeof(VkFormat));
+                vkStream->read(&type, sizeof(VkImageType));
+                vkStream->read(&tiling, sizeof(VkImageTiling));
+                vkStream->read(&usage, sizeof(VkImageUsageFlags));
+                vkStream->read(&flags, sizeof(VkImageCreateFlags));
+                vkStream->read(&externalHandleType, sizeof(VkExternalMemoryHandleTypeFlagsNV));
+                if (vkStream->getU32())
+                {
+                    pExternalImageFormatProperties = (VkExternalImageFormatPropertiesNV*)vkStream->allocArray(1, sizeof(VkExternalImageFormatPropertiesNV));
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceExternalImageFormatPropertiesNV_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceExternalImageFormatPropertiesNV)
+                {
+                    vkGetPhysicalDeviceExternalImageFormatPropertiesNV_VkResult_return = m_vk->vkGetPhysicalDeviceExternalImageFormatPropertiesNV(physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceExternalImageFormatPropertiesNV_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceExternalImageFormatPropertiesNV_VkResult_return >= 0)
+                {
+                    if (pExternalImageFormatProperties)
+                    {
+                        marshal_VkExternalImageFormatPropertiesNV(vkStream, pExternalImageFormatProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_EXT_conditional_rendering
+            case OP_vkCmdBeginConditionalRenderingEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkConditionalRenderingBeginInfoEXT* pConditionalRenderingBegin = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pConditionalRenderingBegin = (VkConditionalRenderingBeginInfoEXT*)vkStream->allocArray(1, sizeof(VkConditionalRenderingBeginInfoEXT));
+                    if (pConditionalRenderingBegin)
+                    {
+                        unmarshal_VkConditionalRenderingBeginInfoEXT(vkStream, pConditionalRenderingBegin);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdBeginConditionalRenderingEXT)
+                {
+                    m_vk->vkCmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBeginConditionalRenderingEXT");
+                }
+                break;
+            }
+            case OP_vkCmdEndConditionalRenderingEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkCmdEndConditionalRenderingEXT)
+                {
+                    m_vk->vkCmdEndConditionalRenderingEXT(commandBuffer);
+                }
+                else
+                {
+                    onFailedCall("vkCmdEndConditionalRenderingEXT");
+                }
+                break;
+            }
+#endif
+#ifdef VK_NVX_device_generated_commands
+            case OP_vkCmdProcessCommandsNVX:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkCmdProcessCommandsInfoNVX* pProcessCommandsInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pProcessCommandsInfo = (VkCmdProcessCommandsInfoNVX*)vkStream->allocArray(1, sizeof(VkCmdProcessCommandsInfoNVX));
+                    if (pProcessCommandsInfo)
+                    {
+                        unmarshal_VkCmdProcessCommandsInfoNVX(vkStream, pProcessCommandsInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdProcessCommandsNVX)
+                {
+                    m_vk->vkCmdProcessCommandsNVX(commandBuffer, pProcessCommandsInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdProcessCommandsNVX");
+                }
+                break;
+            }
+            case OP_vkCmdReserveSpaceForCommandsNVX:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkCmdReserveSpaceForCommandsInfoNVX* pReserveSpaceInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pReserveSpaceInfo = (VkCmdReserveSpaceForCommandsInfoNVX*)vkStream->allocArray(1, sizeof(VkCmdReserveSpaceForCommandsInfoNVX));
+                    if (pReserveSpaceInfo)
+                    {
+                        unmarshal_VkCmdReserveSpaceForCommandsInfoNVX(vkStream, pReserveSpaceInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdReserveSpaceForCommandsNVX)
+                {
+                    m_vk->vkCmdReserveSpaceForCommandsNVX(commandBuffer, pReserveSpaceInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdReserveSpaceForCommandsNVX");
+                }
+                break;
+            }
+            case OP_vkCreateIndirectCommandsLayoutNVX:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkIndirectCommandsLayoutCreateInfoNVX* pCreateInfo = nullptr;
+                VkIndirectCommandsLayoutNVX* pIndirectCommandsLayout = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkIndirectCommandsLayoutCreateInfoNVX*)vkStream->allocArray(1, sizeof(VkIndirectCommandsLayoutCreateInfoNVX));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkIndirectCommandsLayoutCreateInfoNVX(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pIndirectCommandsLayout = (VkIndirectCommandsLayoutNVX*)vkStream->allocArray(1, sizeof(VkIndirectCommandsLayoutNVX));
+                }
+                m_lock.unlock();
+                VkResult vkCreateIndirectCommandsLayoutNVX_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateIndirectCommandsLayoutNVX)
+                {
+                    vkCreateIndirectCommandsLayoutNVX_VkResult_return = m_vk->vkCreateIndirectCommandsLayoutNVX(device, pCreateInfo, nullptr, pIndirectCommandsLayout);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateIndirectCommandsLayoutNVX");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateIndirectCommandsLayoutNVX_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateIndirectCommandsLayoutNVX_VkResult_return >= 0)
+                {
+                    if (pIndirectCommandsLayout)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkIndirectCommandsLayoutNVX(*pIndirectCommandsLayout));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyIndirectCommandsLayoutNVX:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkIndirectCommandsLayoutNVX indirectCommandsLayout;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                indirectCommandsLayout = vkStream->handleMapping()->fromWire_VkIndirectCommandsLayoutNVX(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyIndirectCommandsLayoutNVX)
+                {
+                    m_vk->vkDestroyIndirectCommandsLayoutNVX(device, indirectCommandsLayout, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkIndirectCommandsLayoutNVX.remove(indirectCommandsLayout);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyIndirectCommandsLayoutNVX");
+                }
+                break;
+            }
+            case OP_vkCreateObjectTableNVX:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkObjectTableCreateInfoNVX* pCreateInfo = nullptr;
+                VkObjectTableNVX* pObjectTable = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkObjectTableCreateInfoNVX*)vkStream->allocArray(1, sizeof(VkObjectTableCreateInfoNVX));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkObjectTableCreateInfoNVX(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pObjectTable = (VkObjectTableNVX*)vkStream->allocArray(1, sizeof(VkObjectTableNVX));
+                }
+                m_lock.unlock();
+                VkResult vkCreateObjectTableNVX_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateObjectTableNVX)
+                {
+                    vkCreateObjectTableNVX_VkResult_return = m_vk->vkCreateObjectTableNVX(device, pCreateInfo, nullptr, pObjectTable);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateObjectTableNVX");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateObjectTableNVX_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateObjectTableNVX_VkResult_return >= 0)
+                {
+                    if (pObjectTable)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkObjectTableNVX(*pObjectTable));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyObjectTableNVX:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkObjectTableNVX objectTable;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                objectTable = vkStream->handleMapping()->fromWire_VkObjectTableNVX(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyObjectTableNVX)
+                {
+                    m_vk->vkDestroyObjectTableNVX(device, objectTable, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkObjectTableNVX.remove(objectTable);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyObjectTableNVX");
+                }
+                break;
+            }
+            case OP_vkUnregisterObjectsNVX:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkObjectTableNVX objectTable;
+                uint32_t objectCount;
+                VkObjectEntryTypeNVX* pObjectEntryTypes = nullptr;
+                uint32_t* pObjectIndices = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                objectTable = vkStream->handleMapping()->fromWire_VkObjectTableNVX(vkStream, vkStream->getU64());
+                vkStream->read(&objectCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pObjectEntryTypes = (VkObjectEntryTypeNVX*)vkStream->allocArray(objectCount, sizeof(VkObjectEntryTypeNVX));
+                    if (pObjectEntryTypes)
+                    {
+                        vkStream->read(pObjectEntryTypes, objectCount * sizeof(VkObjectEntryTypeNVX));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pObjectIndices = (uint32_t*)vkStream->allocArray(objectCount, sizeof(uint32_t));
+                    if (pObjectIndices)
+                    {
+                        vkStream->read(pObjectIndices, objectCount * sizeof(uint32_t));
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkUnregisterObjectsNVX_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkUnregisterObjectsNVX)
+                {
+                    vkUnregisterObjectsNVX_VkResult_return = m_vk->vkUnregisterObjectsNVX(device, objectTable, objectCount, pObjectEntryTypes, pObjectIndices);
+                }
+                else
+                {
+                    onFailedCall("vkUnregisterObjectsNVX");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkUnregisterObjectsNVX_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkDeviceGeneratedCommandsFeaturesNVX* pFeatures = nullptr;
+                VkDeviceGeneratedCommandsLimitsNVX* pLimits = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pFeatures = (VkDeviceGeneratedCommandsFeaturesNVX*)vkStream->allocArray(1, sizeof(VkDeviceGeneratedCommandsFeaturesNVX));
+                    if (pFeatures)
+                    {
+                        (*pFeatures).sType = VK_STRUCTURE_TYPE_DEVICE_GENERATED_COMMANDS_FEATURES_NVX;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pFeatures).pNext);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pLimits = (VkDeviceGeneratedCommandsLimitsNVX*)vkStream->allocArray(1, sizeof(VkDeviceGeneratedCommandsLimitsNVX));
+                    if (pLimits)
+                    {
+                        (*pLimits).sType = VK_STRUCTURE_TYPE_DEVICE_GENERATED_COMMANDS_LIMITS_NVX;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pLimits).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX)
+                {
+                    m_vk->vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX(physicalDevice, pFeatures, pLimits);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pFeatures)
+                    {
+                        marshal_VkDeviceGeneratedCommandsFeaturesNVX(vkStream, pFeatures);
+                    }
+                    if (pLimits)
+                    {
+                        marshal_VkDeviceGeneratedCommandsLimitsNVX(vkStream, pLimits);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_NV_clip_space_w_scaling
+            case OP_vkCmdSetViewportWScalingNV:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t firstViewport;
+                uint32_t viewportCount;
+                VkViewportWScalingNV* pViewportWScalings = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&firstViewport, sizeof(uint32_t));
+                vkStream->read(&viewportCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pViewportWScalings = (VkViewportWScalingNV*)vkStream->allocArray(viewportCount, sizeof(VkViewportWScalingNV));
+                    if (pViewportWScalings)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)viewportCount; ++i)
+                        {
+                            unmarshal_VkViewportWScalingNV(vkStream, pViewportWScalings + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdSetViewportWScalingNV)
+                {
+                    m_vk->vkCmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetViewportWScalingNV");
+                }
+                break;
+            }
+#endif
+#ifdef VK_EXT_direct_mode_display
+            case OP_vkReleaseDisplayEXT:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkDisplayKHR display;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                display = vkStream->handleMapping()->fromWire_VkDisplayKHR(vkStream, vkStream->getU64());
+                m_lock.unlock();
+                VkResult vkReleaseDisplayEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkReleaseDisplayEXT)
+                {
+                    vkReleaseDisplayEXT_VkResult_return = m_vk->vkReleaseDisplayEXT(physicalDevice, display);
+                }
+                else
+                {
+                    onFailedCall("vkReleaseDisplayEXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkReleaseDisplayEXT_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_EXT_display_surface_counter
+            case OP_vkGetPhysicalDeviceSurfaceCapabilities2EXT:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkSurfaceKHR surface;
+                VkSurfaceCapabilities2EXT* pSurfaceCapabilities = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                surface = vkStream->handleMapping()->fromWire_VkSurfaceKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSurfaceCapabilities = (VkSurfaceCapabilities2EXT*)vkStream->allocArray(1, sizeof(VkSurfaceCapabilities2EXT));
+                    if (pSurfaceCapabilities)
+                    {
+                        (*pSurfaceCapabilities).sType = VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pSurfaceCapabilities).pNext);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkGetPhysicalDeviceSurfaceCapabilities2EXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceSurfaceCapabilities2EXT)
+                {
+                    vkGetPhysicalDeviceSurfaceCapabilities2EXT_VkResult_return = m_vk->vkGetPhysicalDeviceSurfaceCapabilities2EXT(physicalDevice, surface, pSurfaceCapabilities);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceSurfaceCapabilities2EXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPhysicalDeviceSurfaceCapabilities2EXT_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPhysicalDeviceSurfaceCapabilities2EXT_VkResult_return >= 0)
+                {
+                    if (pSurfaceCapabilities)
+                    {
+                        marshal_VkSurfaceCapabilities2EXT(vkStream, pSurfaceCapabilities);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_EXT_display_control
+            case OP_vkDisplayPowerControlEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDisplayKHR display;
+                VkDisplayPowerInfoEXT* pDisplayPowerInfo = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                display = vkStream->handleMapping()->fromWire_VkDisplayKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pDisplayPowerInfo = (VkDisplayPowerInfoEXT*)vkStream->allocArray(1, sizeof(VkDisplayPowerInfoEXT));
+                    if (pDisplayPowerInfo)
+                    {
+                        unmarshal_VkDisplayPowerInfoEXT(vkStream, pDisplayPowerInfo);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkDisplayPowerControlEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkDisplayPowerControlEXT)
+                {
+                    vkDisplayPowerControlEXT_VkResult_return = m_vk->vkDisplayPowerControlEXT(device, display, pDisplayPowerInfo);
+                }
+                else
+                {
+                    onFailedCall("vkDisplayPowerControlEXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkDisplayPowerControlEXT_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkRegisterDeviceEventEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDeviceEventInfoEXT* pDeviceEventInfo = nullptr;
+                VkFence* pFence = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pDeviceEventInfo = (VkDeviceEventInfoEXT*)vkStream->allocArray(1, sizeof(VkDeviceEventInfoEXT));
+                    if (pDeviceEventInfo)
+                    {
+                        unmarshal_VkDeviceEventInfoEXT(vkStream, pDeviceEventInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pFence = (VkFence*)vkStream->allocArray(1, sizeof(VkFence));
+                }
+                m_lock.unlock();
+                VkResult vkRegisterDeviceEventEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkRegisterDeviceEventEXT)
+                {
+                    vkRegisterDeviceEventEXT_VkResult_return = m_vk->vkRegisterDeviceEventEXT(device, pDeviceEventInfo, nullptr, pFence);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkRegisterDeviceEventEXT");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkRegisterDeviceEventEXT_VkResult_return, sizeof(VkResult));
+                if (called && vkRegisterDeviceEventEXT_VkResult_return >= 0)
+                {
+                    if (pFence)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(*pFence));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkRegisterDisplayEventEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDisplayKHR display;
+                VkDisplayEventInfoEXT* pDisplayEventInfo = nullptr;
+                VkFence* pFence = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                display = vkStream->handleMapping()->fromWire_VkDisplayKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pDisplayEventInfo = (VkDisplayEventInfoEXT*)vkStream->allocArray(1, sizeof(VkDisplayEventInfoEXT));
+                    if (pDisplayEventInfo)
+                    {
+                        unmarshal_VkDisplayEventInfoEXT(vkStream, pDisplayEventInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pFence = (VkFence*)vkStream->allocArray(1, sizeof(VkFence));
+                }
+                m_lock.unlock();
+                VkResult vkRegisterDisplayEventEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkRegisterDisplayEventEXT)
+                {
+                    vkRegisterDisplayEventEXT_VkResult_return = m_vk->vkRegisterDisplayEventEXT(device, display, pDisplayEventInfo, nullptr, pFence);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkRegisterDisplayEventEXT");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkRegisterDisplayEventEXT_VkResult_return, sizeof(VkResult));
+                if (called && vkRegisterDisplayEventEXT_VkResult_return >= 0)
+                {
+                    if (pFence)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkFence(*pFence));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetSwapchainCounterEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSwapchainKHR swapchain;
+                VkSurfaceCounterFlagBitsEXT counter;
+                uint64_t* pCounterValue = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+                vkStream->read(&counter, sizeof(VkSurfaceCounterFlagBitsEXT));
+                if (vkStream->getU32())
+                {
+                    pCounterValue = (uint64_t*)vkStream->allocArray(1, sizeof(uint64_t));
+                }
+                m_lock.unlock();
+                VkResult vkGetSwapchainCounterEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetSwapchainCounterEXT)
+                {
+                    vkGetSwapchainCounterEXT_VkResult_return = m_vk->vkGetSwapchainCounterEXT(device, swapchain, counter, pCounterValue);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetSwapchainCounterEXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetSwapchainCounterEXT_VkResult_return, sizeof(VkResult));
+                if (called && vkGetSwapchainCounterEXT_VkResult_return >= 0)
+                {
+                    if (pCounterValue)
+                    {
+                        vkStream->write(pCounterValue, sizeof(uint64_t));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_GOOGLE_display_timing
+            case OP_vkGetRefreshCycleDurationGOOGLE:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSwapchainKHR swapchain;
+                VkRefreshCycleDurationGOOGLE* pDisplayTimingProperties = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pDisplayTimingProperties = (VkRefreshCycleDurationGOOGLE*)vkStream->allocArray(1, sizeof(VkRefreshCycleDurationGOOGLE));
+                }
+                m_lock.unlock();
+                VkResult vkGetRefreshCycleDurationGOOGLE_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetRefreshCycleDurationGOOGLE)
+                {
+                    vkGetRefreshCycleDurationGOOGLE_VkResult_return = m_vk->vkGetRefreshCycleDurationGOOGLE(device, swapchain, pDisplayTimingProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetRefreshCycleDurationGOOGLE");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetRefreshCycleDurationGOOGLE_VkResult_return, sizeof(VkResult));
+                if (called && vkGetRefreshCycleDurationGOOGLE_VkResult_return >= 0)
+                {
+                    if (pDisplayTimingProperties)
+                    {
+                        marshal_VkRefreshCycleDurationGOOGLE(vkStream, pDisplayTimingProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetPastPresentationTimingGOOGLE:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkSwapchainKHR swapchain;
+                uint32_t* pPresentationTimingCount = nullptr;
+                VkPastPresentationTimingGOOGLE* pPresentationTimings = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                swapchain = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pPresentationTimingCount = (uint32_t*)vkStream->allocArray(1, sizeof(uint32_t));
+                    if (pPresentationTimingCount)
+                    {
+                        vkStream->read(pPresentationTimingCount, sizeof(uint32_t));
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pPresentationTimings = (VkPastPresentationTimingGOOGLE*)vkStream->allocArray((pPresentationTimingCount ? *pPresentationTimingCount : 0), sizeof(VkPastPresentationTimingGOOGLE));
+                }
+                m_lock.unlock();
+                VkResult vkGetPastPresentationTimingGOOGLE_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPastPresentationTimingGOOGLE)
+                {
+                    vkGetPastPresentationTimingGOOGLE_VkResult_return = m_vk->vkGetPastPresentationTimingGOOGLE(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPastPresentationTimingGOOGLE");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetPastPresentationTimingGOOGLE_VkResult_return, sizeof(VkResult));
+                if (called && vkGetPastPresentationTimingGOOGLE_VkResult_return >= 0)
+                {
+                    if (pPresentationTimingCount)
+                    {
+                        vkStream->write(pPresentationTimingCount, sizeof(uint32_t));
+                    }
+                    if (pPresentationTimings)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)(pPresentationTimingCount ? *pPresentationTimingCount : 0); ++i)
+                        {
+                            marshal_VkPastPresentationTimingGOOGLE(vkStream, pPresentationTimings + i);
+                        }
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_EXT_discard_rectangles
+            case OP_vkCmdSetDiscardRectangleEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                uint32_t firstDiscardRectangle;
+                uint32_t discardRectangleCount;
+                VkRect2D* pDiscardRectangles = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&firstDiscardRectangle, sizeof(uint32_t));
+                vkStream->read(&discardRectangleCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pDiscardRectangles = (VkRect2D*)vkStream->allocArray(discardRectangleCount, sizeof(VkRect2D));
+                    if (pDiscardRectangles)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)discardRectangleCount; ++i)
+                        {
+                            unmarshal_VkRect2D(vkStream, pDiscardRectangles + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdSetDiscardRectangleEXT)
+                {
+                    m_vk->vkCmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetDiscardRectangleEXT");
+                }
+                break;
+            }
+#endif
+#ifdef VK_EXT_hdr_metadata
+            case OP_vkSetHdrMetadataEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                uint32_t swapchainCount;
+                VkSwapchainKHR* pSwapchains = nullptr;
+                VkHdrMetadataEXT* pMetadata = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                vkStream->read(&swapchainCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pSwapchains = (VkSwapchainKHR*)vkStream->allocArray(swapchainCount, sizeof(VkSwapchainKHR));
+                    if (pSwapchains)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)swapchainCount; ++i)
+                        {
+                            pSwapchains[i] = vkStream->handleMapping()->fromWire_VkSwapchainKHR(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pMetadata = (VkHdrMetadataEXT*)vkStream->allocArray(swapchainCount, sizeof(VkHdrMetadataEXT));
+                    if (pMetadata)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)swapchainCount; ++i)
+                        {
+                            unmarshal_VkHdrMetadataEXT(vkStream, pMetadata + i);
+                        }
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkSetHdrMetadataEXT)
+                {
+                    m_vk->vkSetHdrMetadataEXT(device, swapchainCount, pSwapchains, pMetadata);
+                }
+                else
+                {
+                    onFailedCall("vkSetHdrMetadataEXT");
+                }
+                break;
+            }
+#endif
+#ifdef VK_EXT_debug_utils
+            case OP_vkSetDebugUtilsObjectNameEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDebugUtilsObjectNameInfoEXT* pNameInfo = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pNameInfo = (VkDebugUtilsObjectNameInfoEXT*)vkStream->allocArray(1, sizeof(VkDebugUtilsObjectNameInfoEXT));
+                    if (pNameInfo)
+                    {
+                        unmarshal_VkDebugUtilsObjectNameInfoEXT(vkStream, pNameInfo);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkSetDebugUtilsObjectNameEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkSetDebugUtilsObjectNameEXT)
+                {
+                    vkSetDebugUtilsObjectNameEXT_VkResult_return = m_vk->vkSetDebugUtilsObjectNameEXT(device, pNameInfo);
+                }
+                else
+                {
+                    onFailedCall("vkSetDebugUtilsObjectNameEXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkSetDebugUtilsObjectNameEXT_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkSetDebugUtilsObjectTagEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkDebugUtilsObjectTagInfoEXT* pTagInfo = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pTagInfo = (VkDebugUtilsObjectTagInfoEXT*)vkStream->allocArray(1, sizeof(VkDebugUtilsObjectTagInfoEXT));
+                    if (pTagInfo)
+                    {
+                        unmarshal_VkDebugUtilsObjectTagInfoEXT(vkStream, pTagInfo);
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkSetDebugUtilsObjectTagEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkSetDebugUtilsObjectTagEXT)
+                {
+                    vkSetDebugUtilsObjectTagEXT_VkResult_return = m_vk->vkSetDebugUtilsObjectTagEXT(device, pTagInfo);
+                }
+                else
+                {
+                    onFailedCall("vkSetDebugUtilsObjectTagEXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkSetDebugUtilsObjectTagEXT_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkQueueBeginDebugUtilsLabelEXT:
+            {
+                m_lock.read();
+                VkQueue queue;
+                VkDebugUtilsLabelEXT* pLabelInfo = nullptr;
+                queue = vkStream->handleMapping()->fromWire_VkQueue(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pLabelInfo = (VkDebugUtilsLabelEXT*)vkStream->allocArray(1, sizeof(VkDebugUtilsLabelEXT));
+                    if (pLabelInfo)
+                    {
+                        unmarshal_VkDebugUtilsLabelEXT(vkStream, pLabelInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkQueueBeginDebugUtilsLabelEXT)
+                {
+                    m_vk->vkQueueBeginDebugUtilsLabelEXT(queue, pLabelInfo);
+                }
+                else
+                {
+                    onFailedCall("vkQueueBeginDebugUtilsLabelEXT");
+                }
+                break;
+            }
+            case OP_vkQueueEndDebugUtilsLabelEXT:
+            {
+                m_lock.read();
+                VkQueue queue;
+                queue = vkStream->handleMapping()->fromWire_VkQueue(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkQueueEndDebugUtilsLabelEXT)
+                {
+                    m_vk->vkQueueEndDebugUtilsLabelEXT(queue);
+                }
+                else
+                {
+                    onFailedCall("vkQueueEndDebugUtilsLabelEXT");
+                }
+                break;
+            }
+            case OP_vkQueueInsertDebugUtilsLabelEXT:
+            {
+                m_lock.read();
+                VkQueue queue;
+                VkDebugUtilsLabelEXT* pLabelInfo = nullptr;
+                queue = vkStream->handleMapping()->fromWire_VkQueue(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pLabelInfo = (VkDebugUtilsLabelEXT*)vkStream->allocArray(1, sizeof(VkDebugUtilsLabelEXT));
+                    if (pLabelInfo)
+                    {
+                        unmarshal_VkDebugUtilsLabelEXT(vkStream, pLabelInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkQueueInsertDebugUtilsLabelEXT)
+                {
+                    m_vk->vkQueueInsertDebugUtilsLabelEXT(queue, pLabelInfo);
+                }
+                else
+                {
+                    onFailedCall("vkQueueInsertDebugUtilsLabelEXT");
+                }
+                break;
+            }
+            case OP_vkCmdBeginDebugUtilsLabelEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkDebugUtilsLabelEXT* pLabelInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pLabelInfo = (VkDebugUtilsLabelEXT*)vkStream->allocArray(1, sizeof(VkDebugUtilsLabelEXT));
+                    if (pLabelInfo)
+                    {
+                        unmarshal_VkDebugUtilsLabelEXT(vkStream, pLabelInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdBeginDebugUtilsLabelEXT)
+                {
+                    m_vk->vkCmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdBeginDebugUtilsLabelEXT");
+                }
+                break;
+            }
+            case OP_vkCmdEndDebugUtilsLabelEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkCmdEndDebugUtilsLabelEXT)
+                {
+                    m_vk->vkCmdEndDebugUtilsLabelEXT(commandBuffer);
+                }
+                else
+                {
+                    onFailedCall("vkCmdEndDebugUtilsLabelEXT");
+                }
+                break;
+            }
+            case OP_vkCmdInsertDebugUtilsLabelEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkDebugUtilsLabelEXT* pLabelInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pLabelInfo = (VkDebugUtilsLabelEXT*)vkStream->allocArray(1, sizeof(VkDebugUtilsLabelEXT));
+                    if (pLabelInfo)
+                    {
+                        unmarshal_VkDebugUtilsLabelEXT(vkStream, pLabelInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdInsertDebugUtilsLabelEXT)
+                {
+                    m_vk->vkCmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdInsertDebugUtilsLabelEXT");
+                }
+                break;
+            }
+            case OP_vkDestroyDebugUtilsMessengerEXT:
+            {
+                m_lock.read();
+                VkInstance instance;
+                VkDebugUtilsMessengerEXT messenger;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                messenger = vkStream->handleMapping()->fromWire_VkDebugUtilsMessengerEXT(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyDebugUtilsMessengerEXT)
+                {
+                    m_vk->vkDestroyDebugUtilsMessengerEXT(instance, messenger, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkDebugUtilsMessengerEXT.remove(messenger);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyDebugUtilsMessengerEXT");
+                }
+                break;
+            }
+            case OP_vkSubmitDebugUtilsMessageEXT:
+            {
+                m_lock.read();
+                VkInstance instance;
+                VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity;
+                VkDebugUtilsMessageTypeFlagsEXT messageTypes;
+                VkDebugUtilsMessengerCallbackDataEXT* pCallbackData = nullptr;
+                instance = vkStream->handleMapping()->fromWire_VkInstance(vkStream, vkStream->getU64());
+                vkStream->read(&messageSeverity, sizeof(VkDebugUtilsMessageSeverityFlagBitsEXT));
+                vkStream->read(&messageTypes, sizeof(VkDebugUtilsMessageTypeFlagsEXT));
+                if (vkStream->getU32())
+                {
+                    pCallbackData = (VkDebugUtilsMessengerCallbackDataEXT*)vkStream->allocArray(1, sizeof(VkDebugUtilsMessengerCallbackDataEXT));
+                    if (pCallbackData)
+                    {
+                        unmarshal_VkDebugUtilsMessengerCallbackDataEXT(vkStream, pCallbackData);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkSubmitDebugUtilsMessageEXT)
+                {
+                    m_vk->vkSubmitDebugUtilsMessageEXT(instance, messageSeverity, messageTypes, pCallbackData);
+                }
+                else
+                {
+                    onFailedCall("vkSubmitDebugUtilsMessageEXT");
+                }
+                break;
+            }
+#endif
+#ifdef VK_EXT_sample_locations
+            case OP_vkCmdSetSampleLocationsEXT:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkSampleLocationsInfoEXT* pSampleLocationsInfo = nullptr;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pSampleLocationsInfo = (VkSampleLocationsInfoEXT*)vkStream->allocArray(1, sizeof(VkSampleLocationsInfoEXT));
+                    if (pSampleLocationsInfo)
+                    {
+                        unmarshal_VkSampleLocationsInfoEXT(vkStream, pSampleLocationsInfo);
+                    }
+                }
+                if (!vkStream->error() && m_vk->vkCmdSetSampleLocationsEXT)
+                {
+                    m_vk->vkCmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
+                }
+                else
+                {
+                    onFailedCall("vkCmdSetSampleLocationsEXT");
+                }
+                break;
+            }
+            case OP_vkGetPhysicalDeviceMultisamplePropertiesEXT:
+            {
+                m_lock.read();
+                VkPhysicalDevice physicalDevice;
+                VkSampleCountFlagBits samples;
+                VkMultisamplePropertiesEXT* pMultisampleProperties = nullptr;
+                physicalDevice = vkStream->handleMapping()->fromWire_VkPhysicalDevice(vkStream, vkStream->getU64());
+                vkStream->read(&samples, sizeof(VkSampleCountFlagBits));
+                if (vkStream->getU32())
+                {
+                    pMultisampleProperties = (VkMultisamplePropertiesEXT*)vkStream->allocArray(1, sizeof(VkMultisamplePropertiesEXT));
+                    if (pMultisampleProperties)
+                    {
+                        (*pMultisampleProperties).sType = VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT;
+                        unmarshal_extension_struct_types(vkStream, (void**)&(*pMultisampleProperties).pNext);
+                    }
+                }
+                m_lock.unlock();
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetPhysicalDeviceMultisamplePropertiesEXT)
+                {
+                    m_vk->vkGetPhysicalDeviceMultisamplePropertiesEXT(physicalDevice, samples, pMultisampleProperties);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetPhysicalDeviceMultisamplePropertiesEXT");
+                }
+                vkStream->beginReply();
+                if (called)
+                {
+                    if (pMultisampleProperties)
+                    {
+                        marshal_VkMultisamplePropertiesEXT(vkStream, pMultisampleProperties);
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_EXT_validation_cache
+            case OP_vkCreateValidationCacheEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkValidationCacheCreateInfoEXT* pCreateInfo = nullptr;
+                VkValidationCacheEXT* pValidationCache = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pCreateInfo = (VkValidationCacheCreateInfoEXT*)vkStream->allocArray(1, sizeof(VkValidationCacheCreateInfoEXT));
+                    if (pCreateInfo)
+                    {
+                        unmarshal_VkValidationCacheCreateInfoEXT(vkStream, pCreateInfo);
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pValidationCache = (VkValidationCacheEXT*)vkStream->allocArray(1, sizeof(VkValidationCacheEXT));
+                }
+                m_lock.unlock();
+                VkResult vkCreateValidationCacheEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkCreateValidationCacheEXT)
+                {
+                    vkCreateValidationCacheEXT_VkResult_return = m_vk->vkCreateValidationCacheEXT(device, pCreateInfo, nullptr, pValidationCache);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkCreateValidationCacheEXT");
+                }
+                m_lock.write();
+                vkStream->beginReply();
+                vkStream->write(&vkCreateValidationCacheEXT_VkResult_return, sizeof(VkResult));
+                if (called && vkCreateValidationCacheEXT_VkResult_return >= 0)
+                {
+                    if (pValidationCache)
+                    {
+                        vkStream->putU64(vkStream->handleMapping()->toWire_VkValidationCacheEXT(*pValidationCache));
+                    }
+                }
+                m_lock.unlock();
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkDestroyValidationCacheEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkValidationCacheEXT validationCache;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                validationCache = vkStream->handleMapping()->fromWire_VkValidationCacheEXT(vkStream, vkStream->getU64());
+                if (!vkStream->error() && m_vk->vkDestroyValidationCacheEXT)
+                {
+                    m_vk->vkDestroyValidationCacheEXT(device, validationCache, nullptr);
+                    m_lock.write();
+                    m_tables->table_VkValidationCacheEXT.remove(validationCache);
+                }
+                else
+                {
+                    onFailedCall("vkDestroyValidationCacheEXT");
+                }
+                break;
+            }
+            case OP_vkMergeValidationCachesEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkValidationCacheEXT dstCache;
+                uint32_t srcCacheCount;
+                VkValidationCacheEXT* pSrcCaches = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                dstCache = vkStream->handleMapping()->fromWire_VkValidationCacheEXT(vkStream, vkStream->getU64());
+                vkStream->read(&srcCacheCount, sizeof(uint32_t));
+                if (vkStream->getU32())
+                {
+                    pSrcCaches = (VkValidationCacheEXT*)vkStream->allocArray(srcCacheCount, sizeof(VkValidationCacheEXT));
+                    if (pSrcCaches)
+                    {
+                        for (uint32_t i = 0; i < (uint32_t)srcCacheCount; ++i)
+                        {
+                            pSrcCaches[i] = vkStream->handleMapping()->fromWire_VkValidationCacheEXT(vkStream, vkStream->getU64());
+                        }
+                    }
+                }
+                m_lock.unlock();
+                VkResult vkMergeValidationCachesEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                if (!vkStream->error() && m_vk->vkMergeValidationCachesEXT)
+                {
+                    vkMergeValidationCachesEXT_VkResult_return = m_vk->vkMergeValidationCachesEXT(device, dstCache, srcCacheCount, pSrcCaches);
+                }
+                else
+                {
+                    onFailedCall("vkMergeValidationCachesEXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkMergeValidationCachesEXT_VkResult_return, sizeof(VkResult));
+                sendReply(ioStream);
+                break;
+            }
+            case OP_vkGetValidationCacheDataEXT:
+            {
+                m_lock.read();
+                VkDevice device;
+                VkValidationCacheEXT validationCache;
+                size_t* pDataSize = nullptr;
+                uint8_t* pData = nullptr;
+                device = vkStream->handleMapping()->fromWire_VkDevice(vkStream, vkStream->getU64());
+                validationCache = vkStream->handleMapping()->fromWire_VkValidationCacheEXT(vkStream, vkStream->getU64());
+                if (vkStream->getU32())
+                {
+                    pDataSize = (size_t*)vkStream->allocArray(1, sizeof(size_t));
+                    if (pDataSize)
+                    {
+                        *pDataSize = (size_t)vkStream->getU64();
+                    }
+                }
+                if (vkStream->getU32())
+                {
+                    pData = (uint8_t*)vkStream->allocArray((pDataSize ? *pDataSize : 0), sizeof(uint8_t));
+                }
+                m_lock.unlock();
+                VkResult vkGetValidationCacheDataEXT_VkResult_return = VK_ERROR_DEVICE_LOST;
+                bool called = false;
+                if (!vkStream->error() && m_vk->vkGetValidationCacheDataEXT)
+                {
+                    vkGetValidationCacheDataEXT_VkResult_return = m_vk->vkGetValidationCacheDataEXT(device, validationCache, pDataSize, pData);
+                    called = true;
+                }
+                else
+                {
+                    onFailedCall("vkGetValidationCacheDataEXT");
+                }
+                vkStream->beginReply();
+                vkStream->write(&vkGetValidationCacheDataEXT_VkResult_return, sizeof(VkResult));
+                if (called && vkGetValidationCacheDataEXT_VkResult_return >= 0)
+                {
+                    if (pDataSize)
+                    {
+                        vkStream->putU64((uint64_t)*pDataSize);
+                    }
+                    if (pData)
+                    {
+                        vkStream->write(pData, (pDataSize ? *pDataSize : 0) * sizeof(uint8_t));
+                    }
+                }
+                sendReply(ioStream);
+                break;
+            }
+#endif
+#ifdef VK_AMD_buffer_marker
+            case OP_vkCmdWriteBufferMarkerAMD:
+            {
+                m_lock.read();
+                VkCommandBuffer commandBuffer;
+                VkPipelineStageFlagBits pipelineStage;
+                VkBuffer dstBuffer;
+                VkDeviceSize dstOffset;
+                uint32_t marker;
+                commandBuffer = vkStream->handleMapping()->fromWire_VkCommandBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&pipelineStage, sizeof(VkPipelineStageFlagBits));
+                dstBuffer = vkStream->handleMapping()->fromWire_VkBuffer(vkStream, vkStream->getU64());
+                vkStream->read(&dstOffset, sizeof(VkDeviceSize));
+                vkStream->read(&marker, sizeof(uint32_t));
+                if (!vkStream->error() && m_vk->vkCmdWriteBufferMarkerAMD)
+                {
+                    m_vk->vkCmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+                }
+                else
+                {
+                    onFailedCall("vkCmdWriteBufferMarkerAMD");
+                }
+                break;
+            }
+#endif
+            default:
+                ERR("VkDecoder: unknown opcode %u\n", opcode);
+                break;
+        }
+        vkStream->clearPool();
+        ptr += packetSize;
+    }
+    m_lock.unlock();
+    return ptr - (const unsigned char*)buf;
+}
+
+VkDecoder::VkDecoder(const VulkanDispatch* vk) : mImpl(new Impl(vk)) {}
+
+VkDecoder::~VkDecoder() = default;
+
+size_t VkDecoder::decode(void* buf, size_t bufsize, IOStream* ioStream)
+{
+    return mImpl->decode(buf, bufsize, ioStream);
+}
+
+}  // namespace goldfish_vk
+
@@ -0,0 +1,46 @@
+// Module: goldfish_vk_decoder (header) Autogenerated by CerealGenerator
+
+
+#pragma once
+
+#include <memory>
+
+#include <stddef.h>
+
+class IOStream;
+
+namespace goldfish_vk {
+
+struct VulkanDispatch;
+
+// Decodes the Vulkan calls encoded by goldfish_vk_encoder, and makes them
+// through a VulkanDispatch.
+//
+// The guest doesn't wait for calls that return nothing: vkCmd*, vkUpdate*,
+// vkDestroy* and the like are queued in its stream and sent in bulk, so
+// one read from the transport usually holds thousands of them. decode()
+// goes through all the packets of such a chunk in one call, and only
+// calls that return a value or have output parameters get a reply.
+//
+// Handles are the ids of handle tables that all decoders share. Looking up
+// an id is an array access, and a chunk of calls that create or destroy
+// nothing takes the lock of the tables once. The children of a pool that
+// is reset or destroyed stay in the tables until their handles are reused.
+class VkDecoder {
+public:
+    explicit VkDecoder(const VulkanDispatch* vk);
+    ~VkDecoder();
+
+    // Decodes and makes the calls of the complete packets at the start of
+    // |buf|, and writes their replies to |ioStream|. Returns the number of
+    // bytes consumed; what is left is the start of a packet that isn't
+    // complete yet.
+    size_t decode(void* buf, size_t bufsize, IOStream* ioStream);
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> mImpl;
+};
+
+}  // namespace goldfish_vk
+
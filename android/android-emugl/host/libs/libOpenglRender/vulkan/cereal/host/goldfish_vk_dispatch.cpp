@@ -0,0 +1,1133 @@
+// Module: goldfish_vk_dispatch (impl) Autogenerated by CerealGenerator
+
+
+#include "goldfish_vk_dispatch.h"
+
+namespace goldfish_vk {
+
+void init_vulkan_dispatch(
+    void* (*getProc)(const char* name, void* userData),
+    void* userData,
+    VulkanDispatch* out)
+{
+
+#ifdef VK_VERSION_1_0
+
+    out->vkCreateInstance = (PFN_vkCreateInstance)getProc("vkCreateInstance", userData);
+
+    out->vkDestroyInstance = (PFN_vkDestroyInstance)getProc("vkDestroyInstance", userData);
+
+    out->vkEnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices)getProc("vkEnumeratePhysicalDevices", userData);
+
+    out->vkGetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures)getProc("vkGetPhysicalDeviceFeatures", userData);
+
+    out->vkGetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties)getProc("vkGetPhysicalDeviceFormatProperties", userData);
+
+    out->vkGetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties)getProc("vkGetPhysicalDeviceImageFormatProperties", userData);
+
+    out->vkGetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties)getProc("vkGetPhysicalDeviceProperties", userData);
+
+    out->vkGetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties)getProc("vkGetPhysicalDeviceQueueFamilyProperties", userData);
+
+    out->vkGetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties)getProc("vkGetPhysicalDeviceMemoryProperties", userData);
+
+    out->vkGetInstanceProcAddr = (PFN_vkGetInstanceProcAddr)getProc("vkGetInstanceProcAddr", userData);
+
+    out->vkGetDeviceProcAddr = (PFN_vkGetDeviceProcAddr)getProc("vkGetDeviceProcAddr", userData);
+
+    out->vkCreateDevice = (PFN_vkCreateDevice)getProc("vkCreateDevice", userData);
+
+    out->vkDestroyDevice = (PFN_vkDestroyDevice)getProc("vkDestroyDevice", userData);
+
+    out->vkEnumerateInstanceExtensionProperties = (PFN_vkEnumerateInstanceExtensionProperties)getProc("vkEnumerateInstanceExtensionProperties", userData);
+
+    out->vkEnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties)getProc("vkEnumerateDeviceExtensionProperties", userData);
+
+    out->vkEnumerateInstanceLayerProperties = (PFN_vkEnumerateInstanceLayerProperties)getProc("vkEnumerateInstanceLayerProperties", userData);
+
+    out->vkEnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties)getProc("vkEnumerateDeviceLayerProperties", userData);
+
+    out->vkGetDeviceQueue = (PFN_vkGetDeviceQueue)getProc("vkGetDeviceQueue", userData);
+
+    out->vkQueueSubmit = (PFN_vkQueueSubmit)getProc("vkQueueSubmit", userData);
+
+    out->vkQueueWaitIdle = (PFN_vkQueueWaitIdle)getProc("vkQueueWaitIdle", userData);
+
+    out->vkDeviceWaitIdle = (PFN_vkDeviceWaitIdle)getProc("vkDeviceWaitIdle", userData);
+
+    out->vkAllocateMemory = (PFN_vkAllocateMemory)getProc("vkAllocateMemory", userData);
+
+    out->vkFreeMemory = (PFN_vkFreeMemory)getProc("vkFreeMemory", userData);
+
+    out->vkMapMemory = (PFN_vkMapMemory)getProc("vkMapMemory", userData);
+
+    out->vkUnmapMemory = (PFN_vkUnmapMemory)getProc("vkUnmapMemory", userData);
+
+    out->vkFlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges)getProc("vkFlushMappedMemoryRanges", userData);
+
+    out->vkInvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges)getProc("vkInvalidateMappedMemoryRanges", userData);
+
+    out->vkGetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment)getProc("vkGetDeviceMemoryCommitment", userData);
+
+    out->vkBindBufferMemory = (PFN_vkBindBufferMemory)getProc("vkBindBufferMemory", userData);
+
+    out->vkBindImageMemory = (PFN_vkBindImageMemory)getProc("vkBindImageMemory", userData);
+
+    out->vkGetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements)getProc("vkGetBufferMemoryRequirements", userData);
+
+    out->vkGetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements)getProc("vkGetImageMemoryRequirements", userData);
+
+    out->vkGetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements)getProc("vkGetImageSparseMemoryRequirements", userData);
+
+    out->vkGetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties)getProc("vkGetPhysicalDeviceSparseImageFormatProperties", userData);
+
+    out->vkQueueBindSparse = (PFN_vkQueueBindSparse)getProc("vkQueueBindSparse", userData);
+
+    out->vkCreateFence = (PFN_vkCreateFence)getProc("vkCreateFence", userData);
+
+    out->vkDestroyFence = (PFN_vkDestroyFence)getProc("vkDestroyFence", userData);
+
+    out->vkResetFences = (PFN_vkResetFences)getProc("vkResetFences", userData);
+
+    out->vkGetFenceStatus = (PFN_vkGetFenceStatus)getProc("vkGetFenceStatus", userData);
+
+    out->vkWaitForFences = (PFN_vkWaitForFences)getProc("vkWaitForFences", userData);
+
+    out->vkCreateSemaphore = (PFN_vkCreateSemaphore)getProc("vkCreateSemaphore", userData);
+
+    out->vkDestroySemaphore = (PFN_vkDestroySemaphore)getProc("vkDestroySemaphore", userData);
+
+    out->vkCreateEvent = (PFN_vkCreateEvent)getProc("vkCreateEvent", userData);
+
+    out->vkDestroyEvent = (PFN_vkDestroyEvent)getProc("vkDestroyEvent", userData);
+
+    out->vkGetEventStatus = (PFN_vkGetEventStatus)getProc("vkGetEventStatus", userData);
+
+    out->vkSetEvent = (PFN_vkSetEvent)getProc("vkSetEvent", userData);
+
+    out->vkResetEvent = (PFN_vkResetEvent)getProc("vkResetEvent", userData);
+
+    out->vkCreateQueryPool = (PFN_vkCreateQueryPool)getProc("vkCreateQueryPool", userData);
+
+    out->vkDestroyQueryPool = (PFN_vkDestroyQueryPool)getProc("vkDestroyQueryPool", userData);
+
+    out->vkGetQueryPoolResults = (PFN_vkGetQueryPoolResults)getProc("vkGetQueryPoolResults", userData);
+
+    out->vkCreateBuffer = (PFN_vkCreateBuffer)getProc("vkCreateBuffer", userData);
+
+    out->vkDestroyBuffer = (PFN_vkDestroyBuffer)getProc("vkDestroyBuffer", userData);
+
+    out->vkCreateBufferView = (PFN_vkCreateBufferView)getProc("vkCreateBufferView", userData);
+
+    out->vkDestroyBufferView = (PFN_vkDestroyBufferView)getProc("vkDestroyBufferView", userData);
+
+    out->vkCreateImage = (PFN_vkCreateImage)getProc("vkCreateImage", userData);
+
+    out->vkDestroyImage = (PFN_vkDestroyImage)getProc("vkDestroyImage", userData);
+
+    out->vkGetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout)getProc("vkGetImageSubresourceLayout", userData);
+
+    out->vkCreateImageView = (PFN_vkCreateImageView)getProc("vkCreateImageView", userData);
+
+    out->vkDestroyImageView = (PFN_vkDestroyImageView)getProc("vkDestroyImageView", userData);
+
+    out->vkCreateShaderModule = (PFN_vkCreateShaderModule)getProc("vkCreateShaderModule", userData);
+
+    out->vkDestroyShaderModule = (PFN_vkDestroyShaderModule)getProc("vkDestroyShaderModule", userData);
+
+    out->vkCreatePipelineCache = (PFN_vkCreatePipelineCache)getProc("vkCreatePipelineCache", userData);
+
+    out->vkDestroyPipelineCache = (PFN_vkDestroyPipelineCache)getProc("vkDestroyPipelineCache", userData);
+
+    out->vkGetPipelineCacheData = (PFN_vkGetPipelineCacheData)getProc("vkGetPipelineCacheData", userData);
+
+    out->vkMergePipelineCaches = (PFN_vkMergePipelineCaches)getProc("vkMergePipelineCaches", userData);
+
+    out->vkCreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines)getProc("vkCreateGraphicsPipelines", userData);
+
+    out->vkCreateComputePipelines = (PFN_vkCreateComputePipelines)getProc("vkCreateComputePipelines", userData);
+
+    out->vkDestroyPipeline = (PFN_vkDestroyPipeline)getProc("vkDestroyPipeline", userData);
+
+    out->vkCreatePipelineLayout = (PFN_vkCreatePipelineLayout)getProc("vkCreatePipelineLayout", userData);
+
+    out->vkDestroyPipelineLayout = (PFN_vkDestroyPipelineLayout)getProc("vkDestroyPipelineLayout", userData);
+
+    out->vkCreateSampler = (PFN_vkCreateSampler)getProc("vkCreateSampler", userData);
+
+    out->vkDestroySampler = (PFN_vkDestroySampler)getProc("vkDestroySampler", userData);
+
+    out->vkCreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout)getProc("vkCreateDescriptorSetLayout", userData);
+
+    out->vkDestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout)getProc("vkDestroyDescriptorSetLayout", userData);
+
+    out->vkCreateDescriptorPool = (PFN_vkCreateDescriptorPool)getProc("vkCreateDescriptorPool", userData);
+
+    out->vkDestroyDescriptorPool = (PFN_vkDestroyDescriptorPool)getProc("vkDestroyDescriptorPool", userData);
+
+    out->vkResetDescriptorPool = (PFN_vkResetDescriptorPool)getProc("vkResetDescriptorPool", userData);
+
+    out->vkAllocateDescriptorSets = (PFN_vkAllocateDescriptorSets)getProc("vkAllocateDescriptorSets", userData);
+
+    out->vkFreeDescriptorSets = (PFN_vkFreeDescriptorSets)getProc("vkFreeDescriptorSets", userData);
+
+    out->vkUpdateDescriptorSets = (PFN_vkUpdateDescriptorSets)getProc("vkUpdateDescriptorSets", userData);
+
+    out->vkCreateFramebuffer = (PFN_vkCreateFramebuffer)getProc("vkCreateFramebuffer", userData);
+
+    out->vkDestroyFramebuffer = (PFN_vkDestroyFramebuffer)getProc("vkDestroyFramebuffer", userData);
+
+    out->vkCreateRenderPass = (PFN_vkCreateRenderPass)getProc("vkCreateRenderPass", userData);
+
+    out->vkDestroyRenderPass = (PFN_vkDestroyRenderPass)getProc("vkDestroyRenderPass", userData);
+
+    out->vkGetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity)getProc("vkGetRenderAreaGranularity", userData);
+
+    out->vkCreateCommandPool = (PFN_vkCreateCommandPool)getProc("vkCreateCommandPool", userData);
+
+    out->vkDestroyCommandPool = (PFN_vkDestroyCommandPool)getProc("vkDestroyCommandPool", userData);
+
+    out->vkResetCommandPool = (PFN_vkResetCommandPool)getProc("vkResetCommandPool", userData);
+
+    out->vkAllocateCommandBuffers = (PFN_vkAllocateCommandBuffers)getProc("vkAllocateCommandBuffers", userData);
+
+    out->vkFreeCommandBuffers = (PFN_vkFreeCommandBuffers)getProc("vkFreeCommandBuffers", userData);
+
+    out->vkBeginCommandBuffer = (PFN_vkBeginCommandBuffer)getProc("vkBeginCommandBuffer", userData);
+
+    out->vkEndCommandBuffer = (PFN_vkEndCommandBuffer)getProc("vkEndCommandBuffer", userData);
+
+    out->vkResetCommandBuffer = (PFN_vkResetCommandBuffer)getProc("vkResetCommandBuffer", userData);
+
+    out->vkCmdBindPipeline = (PFN_vkCmdBindPipeline)getProc("vkCmdBindPipeline", userData);
+
+    out->vkCmdSetViewport = (PFN_vkCmdSetViewport)getProc("vkCmdSetViewport", userData);
+
+    out->vkCmdSetScissor = (PFN_vkCmdSetScissor)getProc("vkCmdSetScissor", userData);
+
+    out->vkCmdSetLineWidth = (PFN_vkCmdSetLineWidth)getProc("vkCmdSetLineWidth", userData);
+
+    out->vkCmdSetDepthBias = (PFN_vkCmdSetDepthBias)getProc("vkCmdSetDepthBias", userData);
+
+    out->vkCmdSetBlendConstants = (PFN_vkCmdSetBlendConstants)getProc("vkCmdSetBlendConstants", userData);
+
+    out->vkCmdSetDepthBounds = (PFN_vkCmdSetDepthBounds)getProc("vkCmdSetDepthBounds", userData);
+
+    out->vkCmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask)getProc("vkCmdSetStencilCompareMask", userData);
+
+    out->vkCmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask)getProc("vkCmdSetStencilWriteMask", userData);
+
+    out->vkCmdSetStencilReference = (PFN_vkCmdSetStencilReference)getProc("vkCmdSetStencilReference", userData);
+
+    out->vkCmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets)getProc("vkCmdBindDescriptorSets", userData);
+
+    out->vkCmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer)getProc("vkCmdBindIndexBuffer", userData);
+
+    out->vkCmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers)getProc("vkCmdBindVertexBuffers", userData);
+
+    out->vkCmdDraw = (PFN_vkCmdDraw)getProc("vkCmdDraw", userData);
+
+    out->vkCmdDrawIndexed = (PFN_vkCmdDrawIndexed)getProc("vkCmdDrawIndexed", userData);
+
+    out->vkCmdDrawIndirect = (PFN_vkCmdDrawIndirect)getProc("vkCmdDrawIndirect", userData);
+
+    out->vkCmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect)getProc("vkCmdDrawIndexedIndirect", userData);
+
+    out->vkCmdDispatch = (PFN_vkCmdDispatch)getProc("vkCmdDispatch", userData);
+
+    out->vkCmdDispatchIndirect = (PFN_vkCmdDispatchIndirect)getProc("vkCmdDispatchIndirect", userData);
+
+    out->vkCmdCopyBuffer = (PFN_vkCmdCopyBuffer)getProc("vkCmdCopyBuffer", userData);
+
+    out->vkCmdCopyImage = (PFN_vkCmdCopyImage)getProc("vkCmdCopyImage", userData);
+
+    out->vkCmdBlitImage = (PFN_vkCmdBlitImage)getProc("vkCmdBlitImage", userData);
+
+    out->vkCmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage)getProc("vkCmdCopyBufferToImage", userData);
+
+    out->vkCmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer)getProc("vkCmdCopyImageToBuffer", userData);
+
+    out->vkCmdUpdateBuffer = (PFN_vkCmdUpdateBuffer)getProc("vkCmdUpdateBuffer", userData);
+
+    out->vkCmdFillBuffer = (PFN_vkCmdFillBuffer)getProc("vkCmdFillBuffer", userData);
+
+    out->vkCmdClearColorImage = (PFN_vkCmdClearColorImage)getProc("vkCmdClearColorImage", userData);
+
+    out->vkCmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage)getProc("vkCmdClearDepthStencilImage", userData);
+
+    out->vkCmdClearAttachments = (PFN_vkCmdClearAttachments)getProc("vkCmdClearAttachments", userData);
+
+    out->vkCmdResolveImage = (PFN_vkCmdResolveImage)getProc("vkCmdResolveImage", userData);
+
+    out->vkCmdSetEvent = (PFN_vkCmdSetEvent)getProc("vkCmdSetEvent", userData);
+
+    out->vkCmdResetEvent = (PFN_vkCmdResetEvent)getProc("vkCmdResetEvent", userData);
+
+    out->vkCmdWaitEvents = (PFN_vkCmdWaitEvents)getProc("vkCmdWaitEvents", userData);
+
+    out->vkCmdPipelineBarrier = (PFN_vkCmdPipelineBarrier)getProc("vkCmdPipelineBarrier", userData);
+
+    out->vkCmdBeginQuery = (PFN_vkCmdBeginQuery)getProc("vkCmdBeginQuery", userData);
+
+    out->vkCmdEndQuery = (PFN_vkCmdEndQuery)getProc("vkCmdEndQuery", userData);
+
+    out->vkCmdResetQueryPool = (PFN_vkCmdResetQueryPool)getProc("vkCmdResetQueryPool", userData);
+
+    out->vkCmdWriteTimestamp = (PFN_vkCmdWriteTimestamp)getProc("vkCmdWriteTimestamp", userData);
+
+    out->vkCmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults)getProc("vkCmdCopyQueryPoolResults", userData);
+
+    out->vkCmdPushConstants = (PFN_vkCmdPushConstants)getProc("vkCmdPushConstants", userData);
+
+    out->vkCmdBeginRenderPass = (PFN_vkCmdBeginRenderPass)getProc("vkCmdBeginRenderPass", userData);
+
+    out->vkCmdNextSubpass = (PFN_vkCmdNextSubpass)getProc("vkCmdNextSubpass", userData);
+
+    out->vkCmdEndRenderPass = (PFN_vkCmdEndRenderPass)getProc("vkCmdEndRenderPass", userData);
+
+    out->vkCmdExecuteCommands = (PFN_vkCmdExecuteCommands)getProc("vkCmdExecuteCommands", userData);
+
+#endif
+
+#ifdef VK_VERSION_1_1
+
+    out->vkEnumerateInstanceVersion = (PFN_vkEnumerateInstanceVersion)getProc("vkEnumerateInstanceVersion", userData);
+
+    out->vkBindBufferMemory2 = (PFN_vkBindBufferMemory2)getProc("vkBindBufferMemory2", userData);
+
+    out->vkBindImageMemory2 = (PFN_vkBindImageMemory2)getProc("vkBindImageMemory2", userData);
+
+    out->vkGetDeviceGroupPeerMemoryFeatures = (PFN_vkGetDeviceGroupPeerMemoryFeatures)getProc("vkGetDeviceGroupPeerMemoryFeatures", userData);
+
+    out->vkCmdSetDeviceMask = (PFN_vkCmdSetDeviceMask)getProc("vkCmdSetDeviceMask", userData);
+
+    out->vkCmdDispatchBase = (PFN_vkCmdDispatchBase)getProc("vkCmdDispatchBase", userData);
+
+    out->vkEnumeratePhysicalDeviceGroups = (PFN_vkEnumeratePhysicalDeviceGroups)getProc("vkEnumeratePhysicalDeviceGroups", userData);
+
+    out->vkGetImageMemoryRequirements2 = (PFN_vkGetImageMemoryRequirements2)getProc("vkGetImageMemoryRequirements2", userData);
+
+    out->vkGetBufferMemoryRequirements2 = (PFN_vkGetBufferMemoryRequirements2)getProc("vkGetBufferMemoryRequirements2", userData);
+
+    out->vkGetImageSparseMemoryRequirements2 = (PFN_vkGetImageSparseMemoryRequirements2)getProc("vkGetImageSparseMemoryRequirements2", userData);
+
+    out->vkGetPhysicalDeviceFeatures2 = (PFN_vkGetPhysicalDeviceFeatures2)getProc("vkGetPhysicalDeviceFeatures2", userData);
+
+    out->vkGetPhysicalDeviceProperties2 = (PFN_vkGetPhysicalDeviceProperties2)getProc("vkGetPhysicalDeviceProperties2", userData);
+
+    out->vkGetPhysicalDeviceFormatProperties2 = (PFN_vkGetPhysicalDeviceFormatProperties2)getProc("vkGetPhysicalDeviceFormatProperties2", userData);
+
+    out->vkGetPhysicalDeviceImageFormatProperties2 = (PFN_vkGetPhysicalDeviceImageFormatProperties2)getProc("vkGetPhysicalDeviceImageFormatProperties2", userData);
+
+    out->vkGetPhysicalDeviceQueueFamilyProperties2 = (PFN_vkGetPhysicalDeviceQueueFamilyProperties2)getProc("vkGetPhysicalDeviceQueueFamilyProperties2", userData);
+
+    out->vkGetPhysicalDeviceMemoryProperties2 = (PFN_vkGetPhysicalDeviceMemoryProperties2)getProc("vkGetPhysicalDeviceMemoryProperties2", userData);
+
+    out->vkGetPhysicalDeviceSparseImageFormatProperties2 = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties2)getProc("vkGetPhysicalDeviceSparseImageFormatProperties2", userData);
+
+    out->vkTrimCommandPool = (PFN_vkTrimCommandPool)getProc("vkTrimCommandPool", userData);
+
+    out->vkGetDeviceQueue2 = (PFN_vkGetDeviceQueue2)getProc("vkGetDeviceQueue2", userData);
+
+    out->vkCreateSamplerYcbcrConversion = (PFN_vkCreateSamplerYcbcrConversion)getProc("vkCreateSamplerYcbcrConversion", userData);
+
+    out->vkDestroySamplerYcbcrConversion = (PFN_vkDestroySamplerYcbcrConversion)getProc("vkDestroySamplerYcbcrConversion", userData);
+
+    out->vkCreateDescriptorUpdateTemplate = (PFN_vkCreateDescriptorUpdateTemplate)getProc("vkCreateDescriptorUpdateTemplate", userData);
+
+    out->vkDestroyDescriptorUpdateTemplate = (PFN_vkDestroyDescriptorUpdateTemplate)getProc("vkDestroyDescriptorUpdateTemplate", userData);
+
+    out->vkUpdateDescriptorSetWithTemplate = (PFN_vkUpdateDescriptorSetWithTemplate)getProc("vkUpdateDescriptorSetWithTemplate", userData);
+
+    out->vkGetPhysicalDeviceExternalBufferProperties = (PFN_vkGetPhysicalDeviceExternalBufferProperties)getProc("vkGetPhysicalDeviceExternalBufferProperties", userData);
+
+    out->vkGetPhysicalDeviceExternalFenceProperties = (PFN_vkGetPhysicalDeviceExternalFenceProperties)getProc("vkGetPhysicalDeviceExternalFenceProperties", userData);
+
+    out->vkGetPhysicalDeviceExternalSemaphoreProperties = (PFN_vkGetPhysicalDeviceExternalSemaphoreProperties)getProc("vkGetPhysicalDeviceExternalSemaphoreProperties", userData);
+
+    out->vkGetDescriptorSetLayoutSupport = (PFN_vkGetDescriptorSetLayoutSupport)getProc("vkGetDescriptorSetLayoutSupport", userData);
+
+#endif
+
+#ifdef VK_KHR_surface
+
+    out->vkDestroySurfaceKHR = (PFN_vkDestroySurfaceKHR)getProc("vkDestroySurfaceKHR", userData);
+
+    out->vkGetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR)getProc("vkGetPhysicalDeviceSurfaceSupportKHR", userData);
+
+    out->vkGetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR)getProc("vkGetPhysicalDeviceSurfaceCapabilitiesKHR", userData);
+
+    out->vkGetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR)getProc("vkGetPhysicalDeviceSurfaceFormatsKHR", userData);
+
+    out->vkGetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR)getProc("vkGetPhysicalDeviceSurfacePresentModesKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_swapchain
+
+    out->vkCreateSwapchainKHR = (PFN_vkCreateSwapchainKHR)getProc("vkCreateSwapchainKHR", userData);
+
+    out->vkDestroySwapchainKHR = (PFN_vkDestroySwapchainKHR)getProc("vkDestroySwapchainKHR", userData);
+
+    out->vkGetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR)getProc("vkGetSwapchainImagesKHR", userData);
+
+    out->vkAcquireNextImageKHR = (PFN_vkAcquireNextImageKHR)getProc("vkAcquireNextImageKHR", userData);
+
+    out->vkQueuePresentKHR = (PFN_vkQueuePresentKHR)getProc("vkQueuePresentKHR", userData);
+
+    out->vkGetDeviceGroupPresentCapabilitiesKHR = (PFN_vkGetDeviceGroupPresentCapabilitiesKHR)getProc("vkGetDeviceGroupPresentCapabilitiesKHR", userData);
+
+    out->vkGetDeviceGroupSurfacePresentModesKHR = (PFN_vkGetDeviceGroupSurfacePresentModesKHR)getProc("vkGetDeviceGroupSurfacePresentModesKHR", userData);
+
+    out->vkGetPhysicalDevicePresentRectanglesKHR = (PFN_vkGetPhysicalDevicePresentRectanglesKHR)getProc("vkGetPhysicalDevicePresentRectanglesKHR", userData);
+
+    out->vkAcquireNextImage2KHR = (PFN_vkAcquireNextImage2KHR)getProc("vkAcquireNextImage2KHR", userData);
+
+#endif
+
+#ifdef VK_KHR_display
+
+    out->vkGetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR)getProc("vkGetPhysicalDeviceDisplayPropertiesKHR", userData);
+
+    out->vkGetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR)getProc("vkGetPhysicalDeviceDisplayPlanePropertiesKHR", userData);
+
+    out->vkGetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR)getProc("vkGetDisplayPlaneSupportedDisplaysKHR", userData);
+
+    out->vkGetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR)getProc("vkGetDisplayModePropertiesKHR", userData);
+
+    out->vkCreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR)getProc("vkCreateDisplayModeKHR", userData);
+
+    out->vkGetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR)getProc("vkGetDisplayPlaneCapabilitiesKHR", userData);
+
+    out->vkCreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR)getProc("vkCreateDisplayPlaneSurfaceKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_display_swapchain
+
+    out->vkCreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR)getProc("vkCreateSharedSwapchainsKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_xlib_surface
+
+    out->vkCreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR)getProc("vkCreateXlibSurfaceKHR", userData);
+
+    out->vkGetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR)getProc("vkGetPhysicalDeviceXlibPresentationSupportKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_xcb_surface
+
+    out->vkCreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR)getProc("vkCreateXcbSurfaceKHR", userData);
+
+    out->vkGetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR)getProc("vkGetPhysicalDeviceXcbPresentationSupportKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_wayland_surface
+
+    out->vkCreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR)getProc("vkCreateWaylandSurfaceKHR", userData);
+
+    out->vkGetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR)getProc("vkGetPhysicalDeviceWaylandPresentationSupportKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_mir_surface
+
+    out->vkCreateMirSurfaceKHR = (PFN_vkCreateMirSurfaceKHR)getProc("vkCreateMirSurfaceKHR", userData);
+
+    out->vkGetPhysicalDeviceMirPresentationSupportKHR = (PFN_vkGetPhysicalDeviceMirPresentationSupportKHR)getProc("vkGetPhysicalDeviceMirPresentationSupportKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_android_surface
+
+    out->vkCreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR)getProc("vkCreateAndroidSurfaceKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_win32_surface
+
+    out->vkCreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR)getProc("vkCreateWin32SurfaceKHR", userData);
+
+    out->vkGetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR)getProc("vkGetPhysicalDeviceWin32PresentationSupportKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_sampler_mirror_clamp_to_edge
+
+#endif
+
+#ifdef VK_KHR_multiview
+
+#endif
+
+#ifdef VK_KHR_get_physical_device_properties2
+
+    out->vkGetPhysicalDeviceFeatures2KHR = (PFN_vkGetPhysicalDeviceFeatures2KHR)getProc("vkGetPhysicalDeviceFeatures2KHR", userData);
+
+    out->vkGetPhysicalDeviceProperties2KHR = (PFN_vkGetPhysicalDeviceProperties2KHR)getProc("vkGetPhysicalDeviceProperties2KHR", userData);
+
+    out->vkGetPhysicalDeviceFormatProperties2KHR = (PFN_vkGetPhysicalDeviceFormatProperties2KHR)getProc("vkGetPhysicalDeviceFormatProperties2KHR", userData);
+
+    out->vkGetPhysicalDeviceImageFormatProperties2KHR = (PFN_vkGetPhysicalDeviceImageFormatProperties2KHR)getProc("vkGetPhysicalDeviceImageFormatProperties2KHR", userData);
+
+    out->vkGetPhysicalDeviceQueueFamilyProperties2KHR = (PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR)getProc("vkGetPhysicalDeviceQueueFamilyProperties2KHR", userData);
+
+    out->vkGetPhysicalDeviceMemoryProperties2KHR = (PFN_vkGetPhysicalDeviceMemoryProperties2KHR)getProc("vkGetPhysicalDeviceMemoryProperties2KHR", userData);
+
+    out->vkGetPhysicalDeviceSparseImageFormatProperties2KHR = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR)getProc("vkGetPhysicalDeviceSparseImageFormatProperties2KHR", userData);
+
+#endif
+
+#ifdef VK_KHR_device_group
+
+    out->vkGetDeviceGroupPeerMemoryFeaturesKHR = (PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR)getProc("vkGetDeviceGroupPeerMemoryFeaturesKHR", userData);
+
+    out->vkCmdSetDeviceMaskKHR = (PFN_vkCmdSetDeviceMaskKHR)getProc("vkCmdSetDeviceMaskKHR", userData);
+
+    out->vkCmdDispatchBaseKHR = (PFN_vkCmdDispatchBaseKHR)getProc("vkCmdDispatchBaseKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_shader_draw_parameters
+
+#endif
+
+#ifdef VK_KHR_maintenance1
+
+    out->vkTrimCommandPoolKHR = (PFN_vkTrimCommandPoolKHR)getProc("vkTrimCommandPoolKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_device_group_creation
+
+    out->vkEnumeratePhysicalDeviceGroupsKHR = (PFN_vkEnumeratePhysicalDeviceGroupsKHR)getProc("vkEnumeratePhysicalDeviceGroupsKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_external_memory_capabilities
+
+    out->vkGetPhysicalDeviceExternalBufferPropertiesKHR = (PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR)getProc("vkGetPhysicalDeviceExternalBufferPropertiesKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_external_memory
+
+#endif
+
+#ifdef VK_KHR_external_memory_win32
+
+    out->vkGetMemoryWin32HandleKHR = (PFN_vkGetMemoryWin32HandleKHR)getProc("vkGetMemoryWin32HandleKHR", userData);
+
+    out->vkGetMemoryWin32HandlePropertiesKHR = (PFN_vkGetMemoryWin32HandlePropertiesKHR)getProc("vkGetMemoryWin32HandlePropertiesKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_external_memory_fd
+
+    out->vkGetMemoryFdKHR = (PFN_vkGetMemoryFdKHR)getProc("vkGetMemoryFdKHR", userData);
+
+    out->vkGetMemoryFdPropertiesKHR = (PFN_vkGetMemoryFdPropertiesKHR)getProc("vkGetMemoryFdPropertiesKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_win32_keyed_mutex
+
+#endif
+
+#ifdef VK_KHR_external_semaphore_capabilities
+
+    out->vkGetPhysicalDeviceExternalSemaphorePropertiesKHR = (PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR)getProc("vkGetPhysicalDeviceExternalSemaphorePropertiesKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_external_semaphore
+
+#endif
+
+#ifdef VK_KHR_external_semaphore_win32
+
+    out->vkImportSemaphoreWin32HandleKHR = (PFN_vkImportSemaphoreWin32HandleKHR)getProc("vkImportSemaphoreWin32HandleKHR", userData);
+
+    out->vkGetSemaphoreWin32HandleKHR = (PFN_vkGetSemaphoreWin32HandleKHR)getProc("vkGetSemaphoreWin32HandleKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_external_semaphore_fd
+
+    out->vkImportSemaphoreFdKHR = (PFN_vkImportSemaphoreFdKHR)getProc("vkImportSemaphoreFdKHR", userData);
+
+    out->vkGetSemaphoreFdKHR = (PFN_vkGetSemaphoreFdKHR)getProc("vkGetSemaphoreFdKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_push_descriptor
+
+    out->vkCmdPushDescriptorSetKHR = (PFN_vkCmdPushDescriptorSetKHR)getProc("vkCmdPushDescriptorSetKHR", userData);
+
+    out->vkCmdPushDescriptorSetWithTemplateKHR = (PFN_vkCmdPushDescriptorSetWithTemplateKHR)getProc("vkCmdPushDescriptorSetWithTemplateKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_16bit_storage
+
+#endif
+
+#ifdef VK_KHR_incremental_present
+
+#endif
+
+#ifdef VK_KHR_descriptor_update_template
+
+    out->vkCreateDescriptorUpdateTemplateKHR = (PFN_vkCreateDescriptorUpdateTemplateKHR)getProc("vkCreateDescriptorUpdateTemplateKHR", userData);
+
+    out->vkDestroyDescriptorUpdateTemplateKHR = (PFN_vkDestroyDescriptorUpdateTemplateKHR)getProc("vkDestroyDescriptorUpdateTemplateKHR", userData);
+
+    out->vkUpdateDescriptorSetWithTemplateKHR = (PFN_vkUpdateDescriptorSetWithTemplateKHR)getProc("vkUpdateDescriptorSetWithTemplateKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_create_renderpass2
+
+    out->vkCreateRenderPass2KHR = (PFN_vkCreateRenderPass2KHR)getProc("vkCreateRenderPass2KHR", userData);
+
+    out->vkCmdBeginRenderPass2KHR = (PFN_vkCmdBeginRenderPass2KHR)getProc("vkCmdBeginRenderPass2KHR", userData);
+
+    out->vkCmdNextSubpass2KHR = (PFN_vkCmdNextSubpass2KHR)getProc("vkCmdNextSubpass2KHR", userData);
+
+    out->vkCmdEndRenderPass2KHR = (PFN_vkCmdEndRenderPass2KHR)getProc("vkCmdEndRenderPass2KHR", userData);
+
+#endif
+
+#ifdef VK_KHR_shared_presentable_image
+
+    out->vkGetSwapchainStatusKHR = (PFN_vkGetSwapchainStatusKHR)getProc("vkGetSwapchainStatusKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_external_fence_capabilities
+
+    out->vkGetPhysicalDeviceExternalFencePropertiesKHR = (PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR)getProc("vkGetPhysicalDeviceExternalFencePropertiesKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_external_fence
+
+#endif
+
+#ifdef VK_KHR_external_fence_win32
+
+    out->vkImportFenceWin32HandleKHR = (PFN_vkImportFenceWin32HandleKHR)getProc("vkImportFenceWin32HandleKHR", userData);
+
+    out->vkGetFenceWin32HandleKHR = (PFN_vkGetFenceWin32HandleKHR)getProc("vkGetFenceWin32HandleKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_external_fence_fd
+
+    out->vkImportFenceFdKHR = (PFN_vkImportFenceFdKHR)getProc("vkImportFenceFdKHR", userData);
+
+    out->vkGetFenceFdKHR = (PFN_vkGetFenceFdKHR)getProc("vkGetFenceFdKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_maintenance2
+
+#endif
+
+#ifdef VK_KHR_get_surface_capabilities2
+
+    out->vkGetPhysicalDeviceSurfaceCapabilities2KHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR)getProc("vkGetPhysicalDeviceSurfaceCapabilities2KHR", userData);
+
+    out->vkGetPhysicalDeviceSurfaceFormats2KHR = (PFN_vkGetPhysicalDeviceSurfaceFormats2KHR)getProc("vkGetPhysicalDeviceSurfaceFormats2KHR", userData);
+
+#endif
+
+#ifdef VK_KHR_variable_pointers
+
+#endif
+
+#ifdef VK_KHR_get_display_properties2
+
+    out->vkGetPhysicalDeviceDisplayProperties2KHR = (PFN_vkGetPhysicalDeviceDisplayProperties2KHR)getProc("vkGetPhysicalDeviceDisplayProperties2KHR", userData);
+
+    out->vkGetPhysicalDeviceDisplayPlaneProperties2KHR = (PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR)getProc("vkGetPhysicalDeviceDisplayPlaneProperties2KHR", userData);
+
+    out->vkGetDisplayModeProperties2KHR = (PFN_vkGetDisplayModeProperties2KHR)getProc("vkGetDisplayModeProperties2KHR", userData);
+
+    out->vkGetDisplayPlaneCapabilities2KHR = (PFN_vkGetDisplayPlaneCapabilities2KHR)getProc("vkGetDisplayPlaneCapabilities2KHR", userData);
+
+#endif
+
+#ifdef VK_KHR_dedicated_allocation
+
+#endif
+
+#ifdef VK_KHR_storage_buffer_storage_class
+
+#endif
+
+#ifdef VK_KHR_relaxed_block_layout
+
+#endif
+
+#ifdef VK_KHR_get_memory_requirements2
+
+    out->vkGetImageMemoryRequirements2KHR = (PFN_vkGetImageMemoryRequirements2KHR)getProc("vkGetImageMemoryRequirements2KHR", userData);
+
+    out->vkGetBufferMemoryRequirements2KHR = (PFN_vkGetBufferMemoryRequirements2KHR)getProc("vkGetBufferMemoryRequirements2KHR", userData);
+
+    out->vkGetImageSparseMemoryRequirements2KHR = (PFN_vkGetImageSparseMemoryRequirements2KHR)getProc("vkGetImageSparseMemoryRequirements2KHR", userData);
+
+#endif
+
+#ifdef VK_KHR_image_format_list
+
+#endif
+
+#ifdef VK_KHR_sampler_ycbcr_conversion
+
+    out->vkCreateSamplerYcbcrConversionKHR = (PFN_vkCreateSamplerYcbcrConversionKHR)getProc("vkCreateSamplerYcbcrConversionKHR", userData);
+
+    out->vkDestroySamplerYcbcrConversionKHR = (PFN_vkDestroySamplerYcbcrConversionKHR)getProc("vkDestroySamplerYcbcrConversionKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_bind_memory2
+
+    out->vkBindBufferMemory2KHR = (PFN_vkBindBufferMemory2KHR)getProc("vkBindBufferMemory2KHR", userData);
+
+    out->vkBindImageMemory2KHR = (PFN_vkBindImageMemory2KHR)getProc("vkBindImageMemory2KHR", userData);
+
+#endif
+
+#ifdef VK_KHR_maintenance3
+
+    out->vkGetDescriptorSetLayoutSupportKHR = (PFN_vkGetDescriptorSetLayoutSupportKHR)getProc("vkGetDescriptorSetLayoutSupportKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_draw_indirect_count
+
+    out->vkCmdDrawIndirectCountKHR = (PFN_vkCmdDrawIndirectCountKHR)getProc("vkCmdDrawIndirectCountKHR", userData);
+
+    out->vkCmdDrawIndexedIndirectCountKHR = (PFN_vkCmdDrawIndexedIndirectCountKHR)getProc("vkCmdDrawIndexedIndirectCountKHR", userData);
+
+#endif
+
+#ifdef VK_KHR_8bit_storage
+
+#endif
+
+#ifdef VK_EXT_debug_report
+
+    out->vkCreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT)getProc("vkCreateDebugReportCallbackEXT", userData);
+
+    out->vkDestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT)getProc("vkDestroyDebugReportCallbackEXT", userData);
+
+    out->vkDebugReportMessageEXT = (PFN_vkDebugReportMessageEXT)getProc("vkDebugReportMessageEXT", userData);
+
+#endif
+
+#ifdef VK_NV_glsl_shader
+
+#endif
+
+#ifdef VK_EXT_depth_range_unrestricted
+
+#endif
+
+#ifdef VK_IMG_filter_cubic
+
+#endif
+
+#ifdef VK_AMD_rasterization_order
+
+#endif
+
+#ifdef VK_AMD_shader_trinary_minmax
+
+#endif
+
+#ifdef VK_AMD_shader_explicit_vertex_parameter
+
+#endif
+
+#ifdef VK_EXT_debug_marker
+
+    out->vkDebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT)getProc("vkDebugMarkerSetObjectTagEXT", userData);
+
+    out->vkDebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT)getProc("vkDebugMarkerSetObjectNameEXT", userData);
+
+    out->vkCmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT)getProc("vkCmdDebugMarkerBeginEXT", userData);
+
+    out->vkCmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT)getProc("vkCmdDebugMarkerEndEXT", userData);
+
+    out->vkCmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT)getProc("vkCmdDebugMarkerInsertEXT", userData);
+
+#endif
+
+#ifdef VK_AMD_gcn_shader
+
+#endif
+
+#ifdef VK_NV_dedicated_allocation
+
+#endif
+
+#ifdef VK_AMD_draw_indirect_count
+
+    out->vkCmdDrawIndirectCountAMD = (PFN_vkCmdDrawIndirectCountAMD)getProc("vkCmdDrawIndirectCountAMD", userData);
+
+    out->vkCmdDrawIndexedIndirectCountAMD = (PFN_vkCmdDrawIndexedIndirectCountAMD)getProc("vkCmdDrawIndexedIndirectCountAMD", userData);
+
+#endif
+
+#ifdef VK_AMD_negative_viewport_height
+
+#endif
+
+#ifdef VK_AMD_gpu_shader_half_float
+
+#endif
+
+#ifdef VK_AMD_shader_ballot
+
+#endif
+
+#ifdef VK_AMD_texture_gather_bias_lod
+
+#endif
+
+#ifdef VK_AMD_shader_info
+
+    out->vkGetShaderInfoAMD = (PFN_vkGetShaderInfoAMD)getProc("vkGetShaderInfoAMD", userData);
+
+#endif
+
+#ifdef VK_AMD_shader_image_load_store_lod
+
+#endif
+
+#ifdef VK_IMG_format_pvrtc
+
+#endif
+
+#ifdef VK_NV_external_memory_capabilities
+
+    out->vkGetPhysicalDeviceExternalImageFormatPropertiesNV = (PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV)getProc("vkGetPhysicalDeviceExternalImageFormatPropertiesNV", userData);
+
+#endif
+
+#ifdef VK_NV_external_memory
+
+#endif
+
+#ifdef VK_NV_external_memory_win32
+
+    out->vkGetMemoryWin32HandleNV = (PFN_vkGetMemoryWin32HandleNV)getProc("vkGetMemoryWin32HandleNV", userData);
+
+#endif
+
+#ifdef VK_NV_win32_keyed_mutex
+
+#endif
+
+#ifdef VK_EXT_validation_flags
+
+#endif
+
+#ifdef VK_NN_vi_surface
+
+    out->vkCreateViSurfaceNN = (PFN_vkCreateViSurfaceNN)getProc("vkCreateViSurfaceNN", userData);
+
+#endif
+
+#ifdef VK_EXT_shader_subgroup_ballot
+
+#endif
+
+#ifdef VK_EXT_shader_subgroup_vote
+
+#endif
+
+#ifdef VK_EXT_conditional_rendering
+
+    out->vkCmdBeginConditionalRenderingEXT = (PFN_vkCmdBeginConditionalRenderingEXT)getProc("vkCmdBeginConditionalRenderingEXT", userData);
+
+    out->vkCmdEndConditionalRenderingEXT = (PFN_vkCmdEndConditionalRenderingEXT)getProc("vkCmdEndConditionalRenderingEXT", userData);
+
+#endif
+
+#ifdef VK_NVX_device_generated_commands
+
+    out->vkCmdProcessCommandsNVX = (PFN_vkCmdProcessCommandsNVX)getProc("vkCmdProcessCommandsNVX", userData);
+
+    out->vkCmdReserveSpaceForCommandsNVX = (PFN_vkCmdReserveSpaceForCommandsNVX)getProc("vkCmdReserveSpaceForCommandsNVX", userData);
+
+    out->vkCreateIndirectCommandsLayoutNVX = (PFN_vkCreateIndirectCommandsLayoutNVX)getProc("vkCreateIndirectCommandsLayoutNVX", userData);
+
+    out->vkDestroyIndirectCommandsLayoutNVX = (PFN_vkDestroyIndirectCommandsLayoutNVX)getProc("vkDestroyIndirectCommandsLayoutNVX", userData);
+
+    out->vkCreateObjectTableNVX = (PFN_vkCreateObjectTableNVX)getProc("vkCreateObjectTableNVX", userData);
+
+    out->vkDestroyObjectTableNVX = (PFN_vkDestroyObjectTableNVX)getProc("vkDestroyObjectTableNVX", userData);
+
+    out->vkRegisterObjectsNVX = (PFN_vkRegisterObjectsNVX)getProc("vkRegisterObjectsNVX", userData);
+
+    out->vkUnregisterObjectsNVX = (PFN_vkUnregisterObjectsNVX)getProc("vkUnregisterObjectsNVX", userData);
+
+    out->vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX = (PFN_vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX)getProc("vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX", userData);
+
+#endif
+
+#ifdef VK_NV_clip_space_w_scaling
+
+    out->vkCmdSetViewportWScalingNV = (PFN_vkCmdSetViewportWScalingNV)getProc("vkCmdSetViewportWScalingNV", userData);
+
+#endif
+
+#ifdef VK_EXT_direct_mode_display
+
+    out->vkReleaseDisplayEXT = (PFN_vkReleaseDisplayEXT)getProc("vkReleaseDisplayEXT", userData);
+
+#endif
+
+#ifdef VK_EXT_acquire_xlib_display
+
+    out->vkAcquireXlibDisplayEXT = (PFN_vkAcquireXlibDisplayEXT)getProc("vkAcquireXlibDisplayEXT", userData);
+
+    out->vkGetRandROutputDisplayEXT = (PFN_vkGetRandROutputDisplayEXT)getProc("vkGetRandROutputDisplayEXT", userData);
+
+#endif
+
+#ifdef VK_EXT_display_surface_counter
+
+    out->vkGetPhysicalDeviceSurfaceCapabilities2EXT = (PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT)getProc("vkGetPhysicalDeviceSurfaceCapabilities2EXT", userData);
+
+#endif
+
+#ifdef VK_EXT_display_control
+
+    out->vkDisplayPowerControlEXT = (PFN_vkDisplayPowerControlEXT)getProc("vkDisplayPowerControlEXT", userData);
+
+    out->vkRegisterDeviceEventEXT = (PFN_vkRegisterDeviceEventEXT)getProc("vkRegisterDeviceEventEXT", userData);
+
+    out->vkRegisterDisplayEventEXT = (PFN_vkRegisterDisplayEventEXT)getProc("vkRegisterDisplayEventEXT", userData);
+
+    out->vkGetSwapchainCounterEXT = (PFN_vkGetSwapchainCounterEXT)getProc("vkGetSwapchainCounterEXT", userData);
+
+#endif
+
+#ifdef VK_GOOGLE_display_timing
+
+    out->vkGetRefreshCycleDurationGOOGLE = (PFN_vkGetRefreshCycleDurationGOOGLE)getProc("vkGetRefreshCycleDurationGOOGLE", userData);
+
+    out->vkGetPastPresentationTimingGOOGLE = (PFN_vkGetPastPresentationTimingGOOGLE)getProc("vkGetPastPresentationTimingGOOGLE", userData);
+
+#endif
+
+#ifdef VK_NV_sample_mask_override_coverage
+
+#endif
+
+#ifdef VK_NV_geometry_shader_passthrough
+
+#endif
+
+#ifdef VK_NV_viewport_array2
+
+#endif
+
+#ifdef VK_NVX_multiview_per_view_attributes
+
+#endif
+
+#ifdef VK_NV_viewport_swizzle
+
+#endif
+
+#ifdef VK_EXT_discard_rectangles
+
+    out->vkCmdSetDiscardRectangleEXT = (PFN_vkCmdSetDiscardRectangleEXT)getProc("vkCmdSetDiscardRectangleEXT", userData);
+
+#endif
+
+#ifdef VK_EXT_conservative_rasterization
+
+#endif
+
+#ifdef VK_EXT_swapchain_colorspace
+
+#endif
+
+#ifdef VK_EXT_hdr_metadata
+
+    out->vkSetHdrMetadataEXT = (PFN_vkSetHdrMetadataEXT)getProc("vkSetHdrMetadataEXT", userData);
+
+#endif
+
+#ifdef VK_MVK_ios_surface
+
+    out->vkCreateIOSSurfaceMVK = (PFN_vkCreateIOSSurfaceMVK)getProc("vkCreateIOSSurfaceMVK", userData);
+
+#endif
+
+#ifdef VK_MVK_macos_surface
+
+    out->vkCreateMacOSSurfaceMVK = (PFN_vkCreateMacOSSurfaceMVK)getProc("vkCreateMacOSSurfaceMVK", userData);
+
+#endif
+
+#ifdef VK_EXT_external_memory_dma_buf
+
+#endif
+
+#ifdef VK_EXT_queue_family_foreign
+
+#endif
+
+#ifdef VK_EXT_debug_utils
+
+    out->vkSetDebugUtilsObjectNameEXT = (PFN_vkSetDebugUtilsObjectNameEXT)getProc("vkSetDebugUtilsObjectNameEXT", userData);
+
+    out->vkSetDebugUtilsObjectTagEXT = (PFN_vkSetDebugUtilsObjectTagEXT)getProc("vkSetDebugUtilsObjectTagEXT", userData);
+
+    out->vkQueueBeginDebugUtilsLabelEXT = (PFN_vkQueueBeginDebugUtilsLabelEXT)getProc("vkQueueBeginDebugUtilsLabelEXT", userData);
+
+    out->vkQueueEndDebugUtilsLabelEXT = (PFN_vkQueueEndDebugUtilsLabelEXT)getProc("vkQueueEndDebugUtilsLabelEXT", userData);
+
+    out->vkQueueInsertDebugUtilsLabelEXT = (PFN_vkQueueInsertDebugUtilsLabelEXT)getProc("vkQueueInsertDebugUtilsLabelEXT", userData);
+
+    out->vkCmdBeginDebugUtilsLabelEXT = (PFN_vkCmdBeginDebugUtilsLabelEXT)getProc("vkCmdBeginDebugUtilsLabelEXT", userData);
+
+    out->vkCmdEndDebugUtilsLabelEXT = (PFN_vkCmdEndDebugUtilsLabelEXT)getProc("vkCmdEndDebugUtilsLabelEXT", userData);
+
+    out->vkCmdInsertDebugUtilsLabelEXT = (PFN_vkCmdInsertDebugUtilsLabelEXT)getProc("vkCmdInsertDebugUtilsLabelEXT", userData);
+
+    out->vkCreateDebugUtilsMessengerEXT = (PFN_vkCreateDebugUtilsMessengerEXT)getProc("vkCreateDebugUtilsMessengerEXT", userData);
+
+    out->vkDestroyDebugUtilsMessengerEXT = (PFN_vkDestroyDebugUtilsMessengerEXT)getProc("vkDestroyDebugUtilsMessengerEXT", userData);
+
+    out->vkSubmitDebugUtilsMessageEXT = (PFN_vkSubmitDebugUtilsMessageEXT)getProc("vkSubmitDebugUtilsMessageEXT", userData);
+
+#endif
+
+#ifdef VK_ANDROID_external_memory_android_hardware_buffer
+
+    out->vkGetAndroidHardwareBufferPropertiesANDROID = (PFN_vkGetAndroidHardwareBufferPropertiesANDROID)getProc("vkGetAndroidHardwareBufferPropertiesANDROID", userData);
+
+    out->vkGetMemoryAndroidHardwareBufferANDROID = (PFN_vkGetMemoryAndroidHardwareBufferANDROID)getProc("vkGetMemoryAndroidHardwareBufferANDROID", userData);
+
+#endif
+
+#ifdef VK_EXT_sampler_filter_minmax
+
+#endif
+
+#ifdef VK_AMD_gpu_shader_int16
+
+#endif
+
+#ifdef VK_AMD_mixed_attachment_samples
+
+#endif
+
+#ifdef VK_AMD_shader_fragment_mask
+
+#endif
+
+#ifdef VK_EXT_shader_stencil_export
+
+#endif
+
+#ifdef VK_EXT_sample_locations
+
+    out->vkCmdSetSampleLocationsEXT = (PFN_vkCmdSetSampleLocationsEXT)getProc("vkCmdSetSampleLocationsEXT", userData);
+
+    out->vkGetPhysicalDeviceMultisamplePropertiesEXT = (PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT)getProc("vkGetPhysicalDeviceMultisamplePropertiesEXT", userData);
+
+#endif
+
+#ifdef VK_EXT_blend_operation_advanced
+
+#endif
+
+#ifdef VK_NV_fragment_coverage_to_color
+
+#endif
+
+#ifdef VK_NV_framebuffer_mixed_samples
+
+#endif
+
+#ifdef VK_NV_fill_rectangle
+
+#endif
+
+#ifdef VK_EXT_post_depth_coverage
+
+#endif
+
+#ifdef VK_EXT_validation_cache
+
+    out->vkCreateValidationCacheEXT = (PFN_vkCreateValidationCacheEXT)getProc("vkCreateValidationCacheEXT", userData);
+
+    out->vkDestroyValidationCacheEXT = (PFN_vkDestroyValidationCacheEXT)getProc("vkDestroyValidationCacheEXT", userData);
+
+    out->vkMergeValidationCachesEXT = (PFN_vkMergeValidationCachesEXT)getProc("vkMergeValidationCachesEXT", userData);
+
+    out->vkGetValidationCacheDataEXT = (PFN_vkGetValidationCacheDataEXT)getProc("vkGetValidationCacheDataEXT", userData);
+
+#endif
+
+#ifdef VK_EXT_descriptor_indexing
+
+#endif
+
+#ifdef VK_EXT_shader_viewport_index_layer
+
+#endif
+
+#ifdef VK_EXT_global_priority
+
+#endif
+
+#ifdef VK_EXT_external_memory_host
+
+    out->vkGetMemoryHostPointerPropertiesEXT = (PFN_vkGetMemoryHostPointerPropertiesEXT)getProc("vkGetMemoryHostPointerPropertiesEXT", userData);
+
+#endif
+
+#ifdef VK_AMD_buffer_marker
+
+    out->vkCmdWriteBufferMarkerAMD = (PFN_vkCmdWriteBufferMarkerAMD)getProc("vkCmdWriteBufferMarkerAMD", userData);
+
+#endif
+
+#ifdef VK_AMD_shader_core_properties
+
+#endif
+
+#ifdef VK_EXT_vertex_attribute_divisor
+
+#endif
+
+#ifdef VK_NV_shader_subgroup_partitioned
+
+#endif
+
+#ifdef VK_NV_device_diagnostic_checkpoints
+
+    out->vkCmdSetCheckpointNV = (PFN_vkCmdSetCheckpointNV)getProc("vkCmdSetCheckpointNV", userData);
+
+    out->vkGetQueueCheckpointDataNV = (PFN_vkGetQueueCheckpointDataNV)getProc("vkGetQueueCheckpointDataNV", userData);
+
+#endif
+
+}
+
+}  // namespace goldfish_vk
+
@@ -880,6 +880,9 @@ int ApiGen::genDecoderHeader(const std::string &filename)
 #if INSTRUMENT_TIMING_HOST
     fprintf(fp, "#include \"time.h\"\n");
 #endif
+    if (m_recordCommands) {
+        fprintf(fp, "#include \"DecoderCommandList.h\"\n");
+    }
 
     for (size_t i = 0; i < m_decoderHeaders.size(); i++) {
         fprintf(fp, "#include %s\n", m_decoderHeaders[i].c_str());
@@ -889,6 +892,10 @@ int ApiGen::genDecoderHeader(const std::string &filename)
     fprintf(fp, "struct %s : public %s_%s_context_t {\n\n",
             classname.c_str(), m_basename.c_str(), sideString(SERVER_SIDE));
     fprintf(fp, "\tsize_t decode(void *buf, size_t bufsize, IOStream *stream, ChecksumCalculator* checksumCalc);\n");
+    if (m_recordCommands) {
+        fprintf(fp, "\tsize_t record(void *buf, size_t bufsize, emugl::DecoderCommandList *cmds, ChecksumCalculator* checksumCalc) const;\n");
+        fprintf(fp, "\tvoid execute(const emugl::DecoderCommandList &cmds);\n");
+    }
     fprintf(fp, "\n};\n\n");
     fprintf(fp, "#endif  // GUARD_%s\n", classname.c_str());
 
@@ -1450,10 +1457,273 @@ R"(        // Do this on every iteration, as some commands may change the checks
     fprintf(fp, "\treturn ptr - (unsigned char*)buf;\n");
     fprintf(fp, "}\n");
 
+    if (m_recordCommands) {
+        genDecoderRecord(fp);
+        genDecoderExecute(fp);
+    }
+
     fclose(fp);
     return 0;
 }
 
+// Whether the decoder can record a call to |e| and run it later: it must not
+// send anything back to the guest, nor access guest memory.
+static bool isRecordable(EntryPoint *e)
+{
+    if (!e->retval().isVoid()) {
+        return false;
+    }
+    VarsArray & evars = e->vars();
+    for (size_t j = 0; j < evars.size(); j++) {
+        Var *v = &evars[j];
+        if (v->isPointer() &&
+            (v->isDMA() || (v->pointerDir() & Var::POINTER_OUT))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// record() parses and validates the same packets as decode(), but instead
+// of calling the entry points, it stores their arguments in a command list
+// for execute(). It stops at the first packet it can't record, which the
+// caller passes to decode() once the list is executed.
+void ApiGen::genDecoderRecord(FILE *fp)
+{
+    std::string classname = m_basename + "_decoder_context_t";
+    size_t n = size();
+
+    // The arguments of each command.
+    fprintf(fp, "\nnamespace {\n\n");
+    for (size_t f = 0; f < n; f++) {
+        EntryPoint *e = &at(f);
+        if (!isRecordable(e)) {
+            continue;
+        }
+        fprintf(fp, "struct %s_record_t {\n", e->name().c_str());
+        VarsArray & evars = e->vars();
+        for (size_t j = 0; j < evars.size(); j++) {
+            Var *v = &evars[j];
+            if (v->isVoid()) {
+                continue;
+            }
+            if (v->isPointer()) {
+                fprintf(fp, "\tconst unsigned char *inptr_%s;\n", v->name().c_str());
+                fprintf(fp, "\tuint32_t size_%s;\n", v->name().c_str());
+            } else {
+                fprintf(fp, "\t%s var_%s;\n", v->type()->name().c_str(), v->name().c_str());
+            }
+        }
+        fprintf(fp, "};\n\n");
+    }
+    fprintf(fp, "}  // namespace\n\n");
+
+    fprintf(fp, "size_t %s::record(void *buf, size_t len, DecoderCommandList *cmds, ChecksumCalculator* checksumCalc) const {\n", classname.c_str());
+    fprintf(fp,
+"\tunsigned char *ptr = (unsigned char *)buf;\n\
+\tconst unsigned char* const end = (const unsigned char*)buf + len;\n\
+\twhile (end - ptr >= 8) {\n\
+\t\tuint32_t opcode = *(uint32_t *)ptr;   \n\
+\t\tint32_t packetLen = *(int32_t *)(ptr + 4);\n\
+\t\tif (packetLen < 8 || end - ptr < packetLen) return ptr - (unsigned char*)buf;\n\
+\t\tconst size_t checksumSize = checksumCalc->checksumByteSize();\n\
+\t\tconst bool useChecksum = checksumSize > 0;\n\
+\t\tswitch(opcode) {\n");
+
+    for (size_t f = 0; f < n; f++) {
+        EntryPoint *e = &at(f);
+        if (!isRecordable(e)) {
+            continue;
+        }
+        VarsArray & evars = e->vars();
+
+        // The size of the packet without its variable-length data.
+        unsigned fixedSize = 8;
+        for (size_t j = 0; j < evars.size(); j++) {
+            Var *v = &evars[j];
+            if (!v->isVoid()) {
+                fixedSize += v->isPointer() ? 4 : v->type()->bytes();
+            }
+        }
+
+        fprintf(fp, "\t\tcase OP_%s: {\n", e->name().c_str());
+        std::string minLen = toString(fixedSize) + " + checksumSize";
+        fprintf(fp, "\t\t\tif ((size_t)packetLen < %s) return ptr - (unsigned char*)buf;\n",
+                minLen.c_str());
+
+        std::string varoffset = "8"; // skip the header
+        for (size_t j = 0; j < evars.size(); j++) {
+            Var *v = &evars[j];
+            if (v->isVoid()) {
+                continue;
+            }
+            const char* var_name = v->name().c_str();
+            const char* var_type_name = v->type()->name().c_str();
+            if (!v->isPointer()) {
+                fprintf(fp,
+                        "\t\t\t%s var_%s = Unpack<%s,uint%u_t>(ptr + %s);\n",
+                        var_type_name,
+                        var_name,
+                        var_type_name,
+                        v->type()->bytes() * 8U,
+                        varoffset.c_str());
+                varoffset += " + " + toString(v->type()->bytes());
+                continue;
+            }
+            fprintf(fp,
+                    "\t\t\tuint32_t size_%s = Unpack<uint32_t,uint32_t>(ptr + %s);\n",
+                    var_name,
+                    varoffset.c_str());
+            minLen += " + size_";
+            minLen += var_name;
+            fprintf(fp, "\t\t\tif ((size_t)packetLen < %s) return ptr - (unsigned char*)buf;\n",
+                    minLen.c_str());
+            varoffset += " + 4 + size_";
+            varoffset += var_name;
+        }
+
+        fprintf(fp,
+                "\t\t\tif (useChecksum) {\n"
+                "\t\t\t\tChecksumCalculatorThreadInfo::validOrDie(checksumCalc, ptr, %s, "
+                "ptr + %s, checksumSize, "
+                "\n\t\t\t\t\t\"%s::record,"
+                " OP_%s: GL checksumCalculator failure\\n\");\n"
+                "\t\t\t}\n",
+                varoffset.c_str(),
+                varoffset.c_str(),
+                classname.c_str(),
+                e->name().c_str());
+
+        if (fixedSize == 8) {
+            fprintf(fp, "\t\t\tcmds->append<%s_record_t>(OP_%s);\n",
+                    e->name().c_str(), e->name().c_str());
+        } else {
+            fprintf(fp, "\t\t\t%s_record_t *args = cmds->append<%s_record_t>(OP_%s);\n",
+                    e->name().c_str(), e->name().c_str(), e->name().c_str());
+        }
+        varoffset = "8";
+        for (size_t j = 0; j < evars.size(); j++) {
+            Var *v = &evars[j];
+            if (v->isVoid()) {
+                continue;
+            }
+            const char* var_name = v->name().c_str();
+            if (!v->isPointer()) {
+                fprintf(fp, "\t\t\targs->var_%s = var_%s;\n", var_name, var_name);
+                varoffset += " + " + toString(v->type()->bytes());
+                continue;
+            }
+            fprintf(fp, "\t\t\targs->inptr_%s = ptr + %s + 4;\n", var_name, varoffset.c_str());
+            fprintf(fp, "\t\t\targs->size_%s = size_%s;\n", var_name, var_name);
+            varoffset += " + 4 + size_";
+            varoffset += var_name;
+        }
+        fprintf(fp, "\t\t\tbreak;\n");
+        fprintf(fp, "\t\t}\n");
+    }
+
+    fprintf(fp, "\t\tdefault:\n");
+    fprintf(fp, "\t\t\treturn ptr - (unsigned char*)buf;\n");
+    fprintf(fp, "\t\t} //switch\n");
+    fprintf(fp, "\t\tptr += packetLen;\n");
+    fprintf(fp, "\t} // while\n");
+    fprintf(fp, "\treturn ptr - (unsigned char*)buf;\n");
+    fprintf(fp, "}\n");
+}
+
+void ApiGen::genDecoderExecute(FILE *fp)
+{
+    std::string classname = m_basename + "_decoder_context_t";
+    size_t n = size();
+
+    fprintf(fp, "\nvoid %s::execute(const DecoderCommandList &cmds) {\n", classname.c_str());
+    fprintf(fp,
+"\tconst unsigned char *ptr = cmds.data();\n\
+\tconst unsigned char* const end = ptr + cmds.size();\n\
+\twhile (ptr < end) {\n\
+\t\tconst DecoderCommandList::Header *header = (const DecoderCommandList::Header *)ptr;\n\
+\t\tswitch(header->opcode) {\n");
+
+    for (size_t f = 0; f < n; f++) {
+        EntryPoint *e = &at(f);
+        if (!isRecordable(e)) {
+            continue;
+        }
+        VarsArray & evars = e->vars();
+        bool hasArgs = false;
+        for (size_t j = 0; j < evars.size(); j++) {
+            hasArgs = hasArgs || !evars[j].isVoid();
+        }
+
+        fprintf(fp, "\t\tcase OP_%s: {\n", e->name().c_str());
+        if (hasArgs) {
+            fprintf(fp, "\t\t\tconst %s_record_t *args = (const %s_record_t *)(header + 1);\n",
+                    e->name().c_str(), e->name().c_str());
+        }
+        for (size_t j = 0; j < evars.size(); j++) {
+            Var *v = &evars[j];
+            if (v->isVoid()) {
+                continue;
+            }
+            const char* var_name = v->name().c_str();
+            if (!v->isPointer()) {
+                fprintf(fp, "\t\t\t%s var_%s = args->var_%s;\n",
+                        v->type()->name().c_str(), var_name, var_name);
+                continue;
+            }
+            fprintf(fp,
+                    "\t\t\tuint32_t size_%s __attribute__((unused)) = args->size_%s;\n"
+                    "\t\t\tInputBuffer inptr_%s(args->inptr_%s, size_%s);\n",
+                    var_name, var_name, var_name, var_name, var_name);
+            if (v->unpackExpression().size() > 0) {
+                fprintf(fp,
+                        "\t\t\tvoid* inptr_%s_unpacked;\n"
+                        "\t\t\t%s;\n",
+                        var_name,
+                        v->unpackExpression().c_str());
+            }
+        }
+
+        if (e->customDecoder() && !e->notApi()) {
+            fprintf(fp, "\t\t\tthis->%s_dec(", e->name().c_str());
+        } else {
+            fprintf(fp, "\t\t\tthis->%s(", e->name().c_str());
+        }
+        if (e->customDecoder()) {
+            fprintf(fp, "this");
+        }
+        for (size_t j = 0; j < evars.size(); j++) {
+            Var *v = &evars[j];
+            if (v->isVoid()) {
+                continue;
+            }
+            const char* var_name = v->name().c_str();
+            const char* var_type_name = v->type()->name().c_str();
+            if (j != 0 || e->customDecoder()) {
+                fprintf(fp, ", ");
+            }
+            if (!v->isPointer()) {
+                fprintf(fp, "var_%s", var_name);
+            } else if (v->nullAllowed()) {
+                fprintf(fp, "size_%s == 0 ? nullptr : (%s)(inptr_%s.get())",
+                        var_name, var_type_name, var_name);
+            } else if (v->unpackExpression().size() > 0) {
+                fprintf(fp, "(%s)(inptr_%s_unpacked)", var_type_name, var_name);
+            } else {
+                fprintf(fp, "(%s)(inptr_%s.get())", var_type_name, var_name);
+            }
+        }
+        fprintf(fp, ");\n");
+        fprintf(fp, "\t\t\tbreak;\n");
+        fprintf(fp, "\t\t}\n");
+    }
+
+    fprintf(fp, "\t\t} //switch\n");
+    fprintf(fp, "\t\tptr += header->size;\n");
+    fprintf(fp, "\t} // while\n");
+    fprintf(fp, "}\n");
+}
+
 int ApiGen::readSpec(const std::string & filename)
 {
     FILE *specfp = fopen(filename.c_str(), "rt");
@@ -1567,6 +1837,8 @@ int ApiGen::setGlobalAttribute(const std::string & line, size_t lc)
             str = getNextToken(line, pos, &last, WHITESPACE);
             pos = last;
         }
+    } else if (token == "record_commands") {
+        m_recordCommands = true;
     } else if (token == "decoder_headers") {
         std::string str = getNextToken(line, pos, &last, WHITESPACE);
         pos = last;
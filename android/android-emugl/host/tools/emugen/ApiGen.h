@@ -30,7 +30,8 @@ public:
     ApiGen(const std::string & basename) :
         m_basename(basename),
         m_maxEntryPointsParams(0),
-        m_baseOpcode(0)
+        m_baseOpcode(0),
+        m_recordCommands(false)
     { }
     virtual ~ApiGen() {}
     int readSpec(const std::string & filename);
@@ -41,6 +42,7 @@ public:
     }
     int baseOpcode() { return m_baseOpcode; }
     void setBaseOpcode(int base) { m_baseOpcode = base; }
+    bool recordCommands() const { return m_recordCommands; }
 
     const char *sideString(SideType side) {
         const char *retval;
@@ -91,7 +93,10 @@ protected:
     StringVec m_decoderHeaders;
     size_t m_maxEntryPointsParams; // record the maximum number of parameters in the entry points;
     int m_baseOpcode;
+    bool m_recordCommands; // generate record() and execute() in the decoder
     int setGlobalAttribute(const std::string & line, size_t lc);
+    void genDecoderRecord(FILE *fp);
+    void genDecoderExecute(FILE *fp);
 };
 
 #endif
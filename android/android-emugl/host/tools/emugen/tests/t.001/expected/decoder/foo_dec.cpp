@@ -176,3 +176,159 @@ size_t foo_decoder_context_t::decode(void *buf, size_t len, IOStream *stream, Ch
 	} // while
 	return ptr - (unsigned char*)buf;
 }
+
+namespace {
+
+struct fooAlphaFunc_record_t {
+	FooInt var_func;
+	FooFloat var_ref;
+};
+
+struct fooUnsupported_record_t {
+	const unsigned char *inptr_params;
+	uint32_t size_params;
+};
+
+struct fooDoEncoderFlush_record_t {
+	FooInt var_param;
+};
+
+struct fooTakeConstVoidPtrConstPtr_record_t {
+	const unsigned char *inptr_param;
+	uint32_t size_param;
+};
+
+struct fooSetComplexStruct_record_t {
+	const unsigned char *inptr_obj;
+	uint32_t size_obj;
+};
+
+}  // namespace
+
+size_t foo_decoder_context_t::record(void *buf, size_t len, DecoderCommandList *cmds, ChecksumCalculator* checksumCalc) const {
+	unsigned char *ptr = (unsigned char *)buf;
+	const unsigned char* const end = (const unsigned char*)buf + len;
+	while (end - ptr >= 8) {
+		uint32_t opcode = *(uint32_t *)ptr;   
+		int32_t packetLen = *(int32_t *)(ptr + 4);
+		if (packetLen < 8 || end - ptr < packetLen) return ptr - (unsigned char*)buf;
+		const size_t checksumSize = checksumCalc->checksumByteSize();
+		const bool useChecksum = checksumSize > 0;
+		switch(opcode) {
+		case OP_fooAlphaFunc: {
+			if ((size_t)packetLen < 16 + checksumSize) return ptr - (unsigned char*)buf;
+			FooInt var_func = Unpack<FooInt,uint32_t>(ptr + 8);
+			FooFloat var_ref = Unpack<FooFloat,uint32_t>(ptr + 8 + 4);
+			if (useChecksum) {
+				ChecksumCalculatorThreadInfo::validOrDie(checksumCalc, ptr, 8 + 4 + 4, ptr + 8 + 4 + 4, checksumSize, 
+					"foo_decoder_context_t::record, OP_fooAlphaFunc: GL checksumCalculator failure\n");
+			}
+			fooAlphaFunc_record_t *args = cmds->append<fooAlphaFunc_record_t>(OP_fooAlphaFunc);
+			args->var_func = var_func;
+			args->var_ref = var_ref;
+			break;
+		}
+		case OP_fooUnsupported: {
+			if ((size_t)packetLen < 12 + checksumSize) return ptr - (unsigned char*)buf;
+			uint32_t size_params = Unpack<uint32_t,uint32_t>(ptr + 8);
+			if ((size_t)packetLen < 12 + checksumSize + size_params) return ptr - (unsigned char*)buf;
+			if (useChecksum) {
+				ChecksumCalculatorThreadInfo::validOrDie(checksumCalc, ptr, 8 + 4 + size_params, ptr + 8 + 4 + size_params, checksumSize, 
+					"foo_decoder_context_t::record, OP_fooUnsupported: GL checksumCalculator failure\n");
+			}
+			fooUnsupported_record_t *args = cmds->append<fooUnsupported_record_t>(OP_fooUnsupported);
+			args->inptr_params = ptr + 8 + 4;
+			args->size_params = size_params;
+			break;
+		}
+		case OP_fooDoEncoderFlush: {
+			if ((size_t)packetLen < 12 + checksumSize) return ptr - (unsigned char*)buf;
+			FooInt var_param = Unpack<FooInt,uint32_t>(ptr + 8);
+			if (useChecksum) {
+				ChecksumCalculatorThreadInfo::validOrDie(checksumCalc, ptr, 8 + 4, ptr + 8 + 4, checksumSize, 
+					"foo_decoder_context_t::record, OP_fooDoEncoderFlush: GL checksumCalculator failure\n");
+			}
+			fooDoEncoderFlush_record_t *args = cmds->append<fooDoEncoderFlush_record_t>(OP_fooDoEncoderFlush);
+			args->var_param = var_param;
+			break;
+		}
+		case OP_fooTakeConstVoidPtrConstPtr: {
+			if ((size_t)packetLen < 12 + checksumSize) return ptr - (unsigned char*)buf;
+			uint32_t size_param = Unpack<uint32_t,uint32_t>(ptr + 8);
+			if ((size_t)packetLen < 12 + checksumSize + size_param) return ptr - (unsigned char*)buf;
+			if (useChecksum) {
+				ChecksumCalculatorThreadInfo::validOrDie(checksumCalc, ptr, 8 + 4 + size_param, ptr + 8 + 4 + size_param, checksumSize, 
+					"foo_decoder_context_t::record, OP_fooTakeConstVoidPtrConstPtr: GL checksumCalculator failure\n");
+			}
+			fooTakeConstVoidPtrConstPtr_record_t *args = cmds->append<fooTakeConstVoidPtrConstPtr_record_t>(OP_fooTakeConstVoidPtrConstPtr);
+			args->inptr_param = ptr + 8 + 4;
+			args->size_param = size_param;
+			break;
+		}
+		case OP_fooSetComplexStruct: {
+			if ((size_t)packetLen < 12 + checksumSize) return ptr - (unsigned char*)buf;
+			uint32_t size_obj = Unpack<uint32_t,uint32_t>(ptr + 8);
+			if ((size_t)packetLen < 12 + checksumSize + size_obj) return ptr - (unsigned char*)buf;
+			if (useChecksum) {
+				ChecksumCalculatorThreadInfo::validOrDie(checksumCalc, ptr, 8 + 4 + size_obj, ptr + 8 + 4 + size_obj, checksumSize, 
+					"foo_decoder_context_t::record, OP_fooSetComplexStruct: GL checksumCalculator failure\n");
+			}
+			fooSetComplexStruct_record_t *args = cmds->append<fooSetComplexStruct_record_t>(OP_fooSetComplexStruct);
+			args->inptr_obj = ptr + 8 + 4;
+			args->size_obj = size_obj;
+			break;
+		}
+		default:
+			return ptr - (unsigned char*)buf;
+		} //switch
+		ptr += packetLen;
+	} // while
+	return ptr - (unsigned char*)buf;
+}
+
+void foo_decoder_context_t::execute(const DecoderCommandList &cmds) {
+	const unsigned char *ptr = cmds.data();
+	const unsigned char* const end = ptr + cmds.size();
+	while (ptr < end) {
+		const DecoderCommandList::Header *header = (const DecoderCommandList::Header *)ptr;
+		switch(header->opcode) {
+		case OP_fooAlphaFunc: {
+			const fooAlphaFunc_record_t *args = (const fooAlphaFunc_record_t *)(header + 1);
+			FooInt var_func = args->var_func;
+			FooFloat var_ref = args->var_ref;
+			this->fooAlphaFunc(var_func, var_ref);
+			break;
+		}
+		case OP_fooUnsupported: {
+			const fooUnsupported_record_t *args = (const fooUnsupported_record_t *)(header + 1);
+			uint32_t size_params __attribute__((unused)) = args->size_params;
+			InputBuffer inptr_params(args->inptr_params, size_params);
+			this->fooUnsupported((void*)(inptr_params.get()));
+			break;
+		}
+		case OP_fooDoEncoderFlush: {
+			const fooDoEncoderFlush_record_t *args = (const fooDoEncoderFlush_record_t *)(header + 1);
+			FooInt var_param = args->var_param;
+			this->fooDoEncoderFlush(var_param);
+			break;
+		}
+		case OP_fooTakeConstVoidPtrConstPtr: {
+			const fooTakeConstVoidPtrConstPtr_record_t *args = (const fooTakeConstVoidPtrConstPtr_record_t *)(header + 1);
+			uint32_t size_param __attribute__((unused)) = args->size_param;
+			InputBuffer inptr_param(args->inptr_param, size_param);
+			this->fooTakeConstVoidPtrConstPtr((const void* const*)(inptr_param.get()));
+			break;
+		}
+		case OP_fooSetComplexStruct: {
+			const fooSetComplexStruct_record_t *args = (const fooSetComplexStruct_record_t *)(header + 1);
+			uint32_t size_obj __attribute__((unused)) = args->size_obj;
+			InputBuffer inptr_obj(args->inptr_obj, size_obj);
+			void* inptr_obj_unpacked;
+			 FooStruct unpacked; inptr_obj_unpacked = (void*)(&unpacked); fooStructUnpack((unsigned char*)(inptr_obj.get()), size_obj, inptr_obj_unpacked);
+			this->fooSetComplexStruct((const FooStruct*)(inptr_obj_unpacked));
+			break;
+		}
+		} //switch
+		ptr += header->size;
+	} // while
+}
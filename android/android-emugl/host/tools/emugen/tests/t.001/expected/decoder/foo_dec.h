@@ -10,10 +10,13 @@
 
 
 #include "emugl/common/logging.h"
+#include "DecoderCommandList.h"
 
 struct foo_decoder_context_t : public foo_server_context_t {
 
 	size_t decode(void *buf, size_t bufsize, IOStream *stream, ChecksumCalculator* checksumCalc);
+	size_t record(void *buf, size_t bufsize, emugl::DecoderCommandList *cmds, ChecksumCalculator* checksumCalc) const;
+	void execute(const emugl::DecoderCommandList &cmds);
 
 };
 
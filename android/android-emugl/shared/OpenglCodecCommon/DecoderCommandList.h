@@ -0,0 +1,68 @@
+/*
+* Copyright (C) 2018 The Android Open Source Project
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace emugl {
+
+// A list of decoded commands, filled by the record() method of an emugen
+// decoder and run later by its execute() method, usually on another thread.
+//
+// Each command is a Header followed by its arguments, as a struct that the
+// decoder defines for each entry point. Pointer arguments point into the
+// buffer the commands were recorded from, which must stay alive and
+// unchanged until they are executed.
+class DecoderCommandList {
+public:
+    struct Header {
+        uint32_t opcode;
+        uint32_t size;  // Of the whole command, a multiple of 8.
+    };
+
+    // Appends a command and returns its arguments, for the caller to fill.
+    template <class Args>
+    Args* append(uint32_t opcode) {
+        static_assert(std::is_trivially_destructible<Args>::value,
+                      "Command arguments are never destroyed");
+        const size_t words = (sizeof(Header) + sizeof(Args) + 7) / 8;
+        const size_t pos = mData.size();
+        mData.resize(pos + words);
+        Header* header = reinterpret_cast<Header*>(&mData[pos]);
+        header->opcode = opcode;
+        header->size = static_cast<uint32_t>(words * 8);
+        return new (header + 1) Args();
+    }
+
+    const unsigned char* data() const {
+        return reinterpret_cast<const unsigned char*>(mData.data());
+    }
+    size_t size() const { return mData.size() * 8; }
+    bool empty() const { return mData.empty(); }
+    void clear() { mData.clear(); }
+
+private:
+    // 64-bit words keep pointer arguments aligned.
+    std::vector<uint64_t> mData;
+};
+
+}  // namespace emugl
@@ -155,6 +155,7 @@ typedef struct TimersState {
 
 static TimersState timers_state;
 bool mttcg_enabled;
+static unsigned int tb_prefetch_threads;
 
 /*
  * We default to false if we know other options have been enabled
@@ -201,6 +202,8 @@ static bool default_mttcg_enabled(void)
 void qemu_tcg_configure(QemuOpts *opts, Error **errp)
 {
     const char *t = qemu_opt_get(opts, "thread");
+    uint64_t n;
+
     if (t) {
         if (strcmp(t, "multi") == 0) {
             if (TCG_OVERSIZED_GUEST) {
@@ -227,6 +230,33 @@ void qemu_tcg_configure(QemuOpts *opts, Error **errp)
     } else {
         mttcg_enabled = default_mttcg_enabled();
     }
+
+    n = qemu_opt_get_number(opts, "prefetch", 0);
+    if (n) {
+        if (!mttcg_enabled) {
+            error_setg(errp, "TB prefetching needs multi-threaded TCG");
+        } else if (n > TB_PREFETCH_MAX_THREADS) {
+            error_setg(errp, "Invalid number of translator threads %" PRIu64,
+                       n);
+        } else {
+            tb_prefetch_threads = n;
+            tcg_reserve_helper_threads(n);
+        }
+    }
+}
+
+/* Start the translator threads requested with -accel tcg,prefetch=N.  */
+void qemu_tcg_start_prefetch(void)
+{
+    unsigned int i;
+
+    /* HAX turns MTTCG off when it falls back to TCG.  */
+    if (!qemu_tcg_mttcg_enabled()) {
+        return;
+    }
+    for (i = 0; i < tb_prefetch_threads; i++) {
+        tb_prefetch_add_thread(tb_prefetch_copy_cpu(first_cpu));
+    }
 }
 
 /* The current number of executed instructions is based on what we
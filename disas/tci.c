@@ -45,8 +45,18 @@ int print_insn_tci(bfd_vma addr, disassemble_info *info)
     }
     length = byte;
 
-    if (op >= tcg_op_defs_max) {
+    if (op >= tcg_op_defs_max + TCI_FUSED_NB) {
         info->fprintf_func(info->stream, "illegal opcode %d", op);
+    } else if (op >= tcg_op_defs_max) {
+        static const char * const fused_names[TCI_FUSED_NB] = {
+            [TCI_FUSED_ld_add_st_i32] = "ld_add_st_i32",
+            [TCI_FUSED_setcond_brcond_i32] = "setcond_brcond_i32",
+            [TCI_FUSED_ld_add_st_i64] = "ld_add_st_i64",
+            [TCI_FUSED_setcond_brcond_i64] = "setcond_brcond_i64",
+        };
+        /* Only the first op of the sequence; the others follow as is. */
+        info->fprintf_func(info->stream, "%s\t(fused)",
+                           fused_names[op - tcg_op_defs_max]);
     } else {
         const TCGOpDef *def = &tcg_op_defs[op];
         int nb_oargs = def->nb_oargs;
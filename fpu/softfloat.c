@@ -83,6 +83,8 @@ this code that are retained.
  * target-dependent and needs the TARGET_* macros.
  */
 #include "qemu/osdep.h"
+#include <float.h>
+#include <math.h>
 #include "qemu/bitops.h"
 #include "fpu/softfloat.h"
 
@@ -722,6 +724,87 @@ static FloatParts addsub_floats(FloatParts a, FloatParts b, bool subtract,
     g_assert_not_reached();
 }
 
+/*
+ * Host FPU fast path
+ *
+ * Most guest float operations are on finite, normal operands in
+ * round-to-nearest-even mode, and most guests leave the sticky inexact
+ * flag set once any inexact result has been seen.  In that case the host
+ * FPU produces bit-identical results and the only flag left to compute is
+ * overflow, so the float32/float64 add, sub, mul, div, sqrt and muladd
+ * entry points try the host operation first.  Anything that could need
+ * exact flag handling (NaN, infinite or denormal inputs, tiny results,
+ * other rounding modes, inexact not yet raised) falls back to softfloat.
+ *
+ * The host must evaluate float and double at their own precision and the
+ * compiler must not reassociate, otherwise results would differ.
+ */
+#if defined(__FAST_MATH__) || !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD != 0
+# define QEMU_NO_HARDFLOAT 1
+#else
+# define QEMU_NO_HARDFLOAT 0
+#endif
+
+typedef union {
+    float32 s;
+    float h;
+} union_float32;
+
+typedef union {
+    float64 s;
+    double h;
+} union_float64;
+
+static inline bool can_use_fpu(const float_status *s)
+{
+    if (QEMU_NO_HARDFLOAT) {
+        return false;
+    }
+    return likely(s->float_exception_flags & float_flag_inexact &&
+                  s->float_rounding_mode == float_round_nearest_even);
+}
+
+static inline bool f32_is_zon(union_float32 a)
+{
+    return fpclassify(a.h) == FP_NORMAL || fpclassify(a.h) == FP_ZERO;
+}
+
+static inline bool f64_is_zon(union_float64 a)
+{
+    return fpclassify(a.h) == FP_NORMAL || fpclassify(a.h) == FP_ZERO;
+}
+
+/*
+ * Check a host result.  Infinities can only come from overflow since the
+ * inputs are finite; results that might be tiny are redone in softfloat
+ * unless the caller knows that a zero result is exact.
+ */
+static inline bool f32_result_ok(union_float32 r, bool exact_zero,
+                                 float_status *s)
+{
+    if (unlikely(isinf(r.h))) {
+        s->float_exception_flags |= float_flag_overflow;
+        return true;
+    }
+    if (likely(fabsf(r.h) > FLT_MIN)) {
+        return true;
+    }
+    return r.h == 0 && exact_zero;
+}
+
+static inline bool f64_result_ok(union_float64 r, bool exact_zero,
+                                 float_status *s)
+{
+    if (unlikely(isinf(r.h))) {
+        s->float_exception_flags |= float_flag_overflow;
+        return true;
+    }
+    if (likely(fabs(r.h) > DBL_MIN)) {
+        return true;
+    }
+    return r.h == 0 && exact_zero;
+}
+
 /*
  * Returns the result of adding or subtracting the floating-point
  * values `a' and `b'. The operation is performed according to the
@@ -741,6 +824,17 @@ float16  __attribute__((flatten)) float16_add(float16 a, float16 b,
 float32 __attribute__((flatten)) float32_add(float32 a, float32 b,
                                              float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float32 ua = { .s = a }, ub = { .s = b }, ur;
+
+        if (likely(f32_is_zon(ua) && f32_is_zon(ub))) {
+            ur.h = ua.h + ub.h;
+            if (f32_result_ok(ur, true, status)) {
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float32_unpack_canonical(a, status);
     FloatParts pb = float32_unpack_canonical(b, status);
     FloatParts pr = addsub_floats(pa, pb, false, status);
@@ -751,6 +845,17 @@ float32 __attribute__((flatten)) float32_add(float32 a, float32 b,
 float64 __attribute__((flatten)) float64_add(float64 a, float64 b,
                                              float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float64 ua = { .s = a }, ub = { .s = b }, ur;
+
+        if (likely(f64_is_zon(ua) && f64_is_zon(ub))) {
+            ur.h = ua.h + ub.h;
+            if (f64_result_ok(ur, true, status)) {
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float64_unpack_canonical(a, status);
     FloatParts pb = float64_unpack_canonical(b, status);
     FloatParts pr = addsub_floats(pa, pb, false, status);
@@ -771,6 +876,17 @@ float16 __attribute__((flatten)) float16_sub(float16 a, float16 b,
 float32 __attribute__((flatten)) float32_sub(float32 a, float32 b,
                                              float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float32 ua = { .s = a }, ub = { .s = b }, ur;
+
+        if (likely(f32_is_zon(ua) && f32_is_zon(ub))) {
+            ur.h = ua.h - ub.h;
+            if (f32_result_ok(ur, true, status)) {
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float32_unpack_canonical(a, status);
     FloatParts pb = float32_unpack_canonical(b, status);
     FloatParts pr = addsub_floats(pa, pb, true, status);
@@ -781,6 +897,17 @@ float32 __attribute__((flatten)) float32_sub(float32 a, float32 b,
 float64 __attribute__((flatten)) float64_sub(float64 a, float64 b,
                                              float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float64 ua = { .s = a }, ub = { .s = b }, ur;
+
+        if (likely(f64_is_zon(ua) && f64_is_zon(ub))) {
+            ur.h = ua.h - ub.h;
+            if (f64_result_ok(ur, true, status)) {
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float64_unpack_canonical(a, status);
     FloatParts pb = float64_unpack_canonical(b, status);
     FloatParts pr = addsub_floats(pa, pb, true, status);
@@ -852,6 +979,17 @@ float16 __attribute__((flatten)) float16_mul(float16 a, float16 b,
 float32 __attribute__((flatten)) float32_mul(float32 a, float32 b,
                                              float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float32 ua = { .s = a }, ub = { .s = b }, ur;
+
+        if (likely(f32_is_zon(ua) && f32_is_zon(ub))) {
+            ur.h = ua.h * ub.h;
+            if (f32_result_ok(ur, ua.h == 0 || ub.h == 0, status)) {
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float32_unpack_canonical(a, status);
     FloatParts pb = float32_unpack_canonical(b, status);
     FloatParts pr = mul_floats(pa, pb, status);
@@ -862,6 +1000,17 @@ float32 __attribute__((flatten)) float32_mul(float32 a, float32 b,
 float64 __attribute__((flatten)) float64_mul(float64 a, float64 b,
                                              float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float64 ua = { .s = a }, ub = { .s = b }, ur;
+
+        if (likely(f64_is_zon(ua) && f64_is_zon(ub))) {
+            ur.h = ua.h * ub.h;
+            if (f64_result_ok(ur, ua.h == 0 || ub.h == 0, status)) {
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float64_unpack_canonical(a, status);
     FloatParts pb = float64_unpack_canonical(b, status);
     FloatParts pr = mul_floats(pa, pb, status);
@@ -1087,6 +1236,26 @@ float16 __attribute__((flatten)) float16_muladd(float16 a, float16 b, float16 c,
 float32 __attribute__((flatten)) float32_muladd(float32 a, float32 b, float32 c,
                                                 int flags, float_status *status)
 {
+    if (can_use_fpu(status) && !(flags & float_muladd_halve_result)) {
+        union_float32 ua = { .s = a }, ub = { .s = b }, uc = { .s = c }, ur;
+
+        if (likely(f32_is_zon(ua) && f32_is_zon(ub) && f32_is_zon(uc))) {
+            if (flags & float_muladd_negate_product) {
+                ua.h = -ua.h;
+            }
+            if (flags & float_muladd_negate_c) {
+                uc.h = -uc.h;
+            }
+            ur.h = fmaf(ua.h, ub.h, uc.h);
+            if (f32_result_ok(ur, ua.h == 0 || ub.h == 0, status)) {
+                if (flags & float_muladd_negate_result) {
+                    ur.h = -ur.h;
+                }
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float32_unpack_canonical(a, status);
     FloatParts pb = float32_unpack_canonical(b, status);
     FloatParts pc = float32_unpack_canonical(c, status);
@@ -1098,6 +1267,26 @@ float32 __attribute__((flatten)) float32_muladd(float32 a, float32 b, float32 c,
 float64 __attribute__((flatten)) float64_muladd(float64 a, float64 b, float64 c,
                                                 int flags, float_status *status)
 {
+    if (can_use_fpu(status) && !(flags & float_muladd_halve_result)) {
+        union_float64 ua = { .s = a }, ub = { .s = b }, uc = { .s = c }, ur;
+
+        if (likely(f64_is_zon(ua) && f64_is_zon(ub) && f64_is_zon(uc))) {
+            if (flags & float_muladd_negate_product) {
+                ua.h = -ua.h;
+            }
+            if (flags & float_muladd_negate_c) {
+                uc.h = -uc.h;
+            }
+            ur.h = fma(ua.h, ub.h, uc.h);
+            if (f64_result_ok(ur, ua.h == 0 || ub.h == 0, status)) {
+                if (flags & float_muladd_negate_result) {
+                    ur.h = -ur.h;
+                }
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float64_unpack_canonical(a, status);
     FloatParts pb = float64_unpack_canonical(b, status);
     FloatParts pc = float64_unpack_canonical(c, status);
@@ -1178,6 +1367,18 @@ float16 float16_div(float16 a, float16 b, float_status *status)
 
 float32 float32_div(float32 a, float32 b, float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float32 ua = { .s = a }, ub = { .s = b }, ur;
+
+        /* division by zero needs the divbyzero flag */
+        if (likely(f32_is_zon(ua) && fpclassify(ub.h) == FP_NORMAL)) {
+            ur.h = ua.h / ub.h;
+            if (f32_result_ok(ur, ua.h == 0, status)) {
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float32_unpack_canonical(a, status);
     FloatParts pb = float32_unpack_canonical(b, status);
     FloatParts pr = div_floats(pa, pb, status);
@@ -1187,6 +1388,18 @@ float32 float32_div(float32 a, float32 b, float_status *status)
 
 float64 float64_div(float64 a, float64 b, float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float64 ua = { .s = a }, ub = { .s = b }, ur;
+
+        /* division by zero needs the divbyzero flag */
+        if (likely(f64_is_zon(ua) && fpclassify(ub.h) == FP_NORMAL)) {
+            ur.h = ua.h / ub.h;
+            if (f64_result_ok(ur, ua.h == 0, status)) {
+                return ur.s;
+            }
+        }
+    }
+
     FloatParts pa = float64_unpack_canonical(a, status);
     FloatParts pb = float64_unpack_canonical(b, status);
     FloatParts pr = div_floats(pa, pb, status);
@@ -1993,6 +2206,16 @@ float16 __attribute__((flatten)) float16_sqrt(float16 a, float_status *status)
 
 float32 __attribute__((flatten)) float32_sqrt(float32 a, float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float32 ua = { .s = a }, ur;
+
+        /* the root of a normal number is normal, so only check the input */
+        if (likely(f32_is_zon(ua) && !signbit(ua.h))) {
+            ur.h = sqrtf(ua.h);
+            return ur.s;
+        }
+    }
+
     FloatParts pa = float32_unpack_canonical(a, status);
     FloatParts pr = sqrt_float(pa, status, &float32_params);
     return float32_round_pack_canonical(pr, status);
@@ -2000,6 +2223,16 @@ float32 __attribute__((flatten)) float32_sqrt(float32 a, float_status *status)
 
 float64 __attribute__((flatten)) float64_sqrt(float64 a, float_status *status)
 {
+    if (can_use_fpu(status)) {
+        union_float64 ua = { .s = a }, ur;
+
+        /* the root of a normal number is normal, so only check the input */
+        if (likely(f64_is_zon(ua) && !signbit(ua.h))) {
+            ur.h = sqrt(ua.h);
+            return ur.s;
+        }
+    }
+
     FloatParts pa = float64_unpack_canonical(a, status);
     FloatParts pr = sqrt_float(pa, status, &float64_params);
     return float64_round_pack_canonical(pr, status);
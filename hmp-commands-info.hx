@@ -293,6 +293,23 @@ STEXI
 @item info opcount
 @findex info opcount
 Show dynamic compiler opcode counters
+ETEXI
+
+#if defined(CONFIG_TCG)
+    {
+        .name       = "tb-hot",
+        .args_type  = "count:i?",
+        .params     = "[count]",
+        .help       = "show the most executed translation blocks",
+        .cmd        = hmp_info_tb_hot,
+    },
+#endif
+
+STEXI
+@item info tb-hot [@var{count}]
+@findex info tb-hot
+Show the @var{count} (default 10) most executed translation blocks with
+their guest PC, sizes and symbol.  Needs @code{tb-count on}.
 ETEXI
 
     {
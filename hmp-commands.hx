@@ -388,6 +388,24 @@ STEXI
 @findex singlestep
 Run the emulation in single step mode.
 If called with option off, the emulation returns to normal mode.
+ETEXI
+
+#if defined(CONFIG_TCG)
+    {
+        .name       = "tb-count",
+        .args_type  = "option:s?",
+        .params     = "[on|off]",
+        .help       = "count translation block executions",
+        .cmd        = hmp_tb_count,
+    },
+#endif
+
+STEXI
+@item tb-count [off]
+@findex tb-count
+Count how often each translation block is executed, see @code{info tb-hot}.
+This flushes the translation cache; with option off, the counters are
+removed from the generated code again.
 ETEXI
 
     {
@@ -679,8 +679,10 @@ static void goldfish_evdev_init(Object *obj)
     DeviceState *dev = DEVICE(obj);
     SysBusDevice *sbd = SYS_BUS_DEVICE(obj);
 
+    qemu_mutex_init(&s->lock);
     memory_region_init_io(&s->iomem, obj, &goldfish_evdev_ops, s,
                           "goldfish-events", 0x1000);
+    memory_region_clear_global_locking(&s->iomem);
     sysbus_init_mmio(sbd, &s->iomem);
     sysbus_init_irq(sbd, &s->irq);
 
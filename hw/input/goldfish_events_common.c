@@ -7,6 +7,7 @@
 #include "hw/input/goldfish_events_common.h"
 
 #include "qemu/log.h"
+#include "qemu/main-loop.h"
 #include "hw/sysbus.h"
 
 static int get_page_len(GoldfishEvDevState *s)
@@ -45,7 +46,41 @@ static int get_page_data(GoldfishEvDevState *s, int offset)
     return 0;
 }
 
-static unsigned dequeue_event(GoldfishEvDevState *s)
+/*
+ * Lower the IRQ if the queue is empty, otherwise raise it, first lowering
+ * it if |pulse| is set. Must be called without s->lock; takes the BQL if
+ * the caller doesn't hold it.
+ */
+static void goldfish_events_update_irq(GoldfishEvDevState *s, bool pulse)
+{
+    bool locked = !qemu_mutex_iothread_locked();
+    bool pending;
+
+    if (locked) {
+        qemu_mutex_lock_iothread();
+    }
+    qemu_mutex_lock(&s->lock);
+    pending = s->first != s->last;
+    qemu_mutex_unlock(&s->lock);
+
+    if (!pending) {
+        qemu_irq_lower(s->irq);
+    } else {
+        if (pulse) {
+            qemu_irq_lower(s->irq);
+        }
+        qemu_irq_raise(s->irq);
+    }
+    if (locked) {
+        qemu_mutex_unlock_iothread();
+    }
+}
+
+/*
+ * Called with s->lock held. Sets *update and *pulse if the IRQ needs to be
+ * updated with goldfish_events_update_irq() once the lock is dropped.
+ */
+static unsigned dequeue_event(GoldfishEvDevState *s, bool *update, bool *pulse)
 {
     unsigned n;
 
@@ -58,7 +93,7 @@ static unsigned dequeue_event(GoldfishEvDevState *s)
     s->first = (s->first + 1) & (MAX_EVENTS - 1);
 
     if (s->first == s->last) {
-        qemu_irq_lower(s->irq);
+        *update = true;
     }
 #ifdef TARGET_I386
     /*
@@ -74,8 +109,8 @@ static unsigned dequeue_event(GoldfishEvDevState *s)
     else if (((s->first + 2) & (MAX_EVENTS - 1)) < s->last ||
                (s->first & (MAX_EVENTS - 1)) > s->last) {
         /* if there still is an event */
-        qemu_irq_lower(s->irq);
-        qemu_irq_raise(s->irq);
+        *update = true;
+        *pulse = true;
     }
 #endif
     return n;
@@ -88,9 +123,13 @@ int goldfish_event_drop_count() {
 }
 
 
+/* Called with the BQL held. */
 void goldfish_enqueue_event(GoldfishEvDevState *s,
                    unsigned int type, unsigned int code, int value)
 {
+    bool live;
+
+    qemu_mutex_lock(&s->lock);
     int  enqueued = s->last - s->first;
 
     if (enqueued < 0) {
@@ -98,16 +137,15 @@ void goldfish_enqueue_event(GoldfishEvDevState *s,
     }
 
     if (enqueued + 3 > MAX_EVENTS) {
+        qemu_mutex_unlock(&s->lock);
         g_events_dropped++;
         fprintf(stderr, "##KBD: Full queue, dropping event, current drop count: %d\n", g_events_dropped);
         return;
     }
 
     g_events_dropped = 0;
-    if (s->state == STATE_LIVE) {
-        qemu_irq_lower(s->irq);
-        qemu_irq_raise(s->irq);
-    } else {
+    live = s->state == STATE_LIVE;
+    if (!live) {
         s->state = STATE_BUFFERED;
     }
 
@@ -117,13 +155,21 @@ void goldfish_enqueue_event(GoldfishEvDevState *s,
     s->last = (s->last + 1) & (MAX_EVENTS-1);
     s->events[s->last] = value;
     s->last = (s->last + 1) & (MAX_EVENTS-1);
+    qemu_mutex_unlock(&s->lock);
 
+    if (live) {
+        qemu_irq_lower(s->irq);
+        qemu_irq_raise(s->irq);
+    }
 }
 
 uint64_t goldfish_events_read(void *opaque, hwaddr offset, unsigned size)
 {
     GoldfishEvDevState *s = (GoldfishEvDevState *)opaque;
+    bool update = false, pulse = false;
+    uint64_t val;
 
+    qemu_mutex_lock(&s->lock);
     /* This gross hack below is used to ensure that we
      * only raise the IRQ when the kernel driver is
      * properly ready! If done before this, the driver
@@ -132,25 +178,35 @@ uint64_t goldfish_events_read(void *opaque, hwaddr offset, unsigned size)
      */
     if (offset == REG_LEN && s->page == PAGE_ABSDATA) {
         if (s->state == STATE_BUFFERED) {
-            qemu_irq_raise(s->irq);
+            update = true;
         }
         s->state = STATE_LIVE;
     }
 
     switch (offset) {
     case REG_READ:
-        return dequeue_event(s);
+        val = dequeue_event(s, &update, &pulse);
+        break;
     case REG_LEN:
-        return get_page_len(s);
+        val = get_page_len(s);
+        break;
     default:
         if (offset >= REG_DATA) {
-            return get_page_data(s, offset - REG_DATA);
+            val = get_page_data(s, offset - REG_DATA);
+            break;
         }
         qemu_log_mask(LOG_GUEST_ERROR,
                       "goldfish events device read: bad offset %x\n",
                       (int)offset);
-        return 0;
+        val = 0;
+        break;
+    }
+    qemu_mutex_unlock(&s->lock);
+
+    if (update) {
+        goldfish_events_update_irq(s, pulse);
     }
+    return val;
 }
 
 void goldfish_events_write(void *opaque, hwaddr offset,
@@ -159,7 +215,9 @@ void goldfish_events_write(void *opaque, hwaddr offset,
     GoldfishEvDevState *s = (GoldfishEvDevState *)opaque;
     switch (offset) {
     case REG_SET_PAGE:
+        qemu_mutex_lock(&s->lock);
         s->page = val;
+        qemu_mutex_unlock(&s->lock);
         break;
     default:
         qemu_log_mask(LOG_GUEST_ERROR,
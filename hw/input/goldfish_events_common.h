@@ -20,6 +20,7 @@
 
 #include "qemu/osdep.h"
 #include "qemu/log.h"
+#include "qemu/thread.h"
 #include "hw/sysbus.h"
 #include "ui/input.h"
 #include "ui/console.h"
@@ -180,6 +181,13 @@ typedef struct GoldfishEvDevState {
     MemoryRegion iomem;
     qemu_irq irq;
 
+    /*
+     * The registers are accessed without the BQL; |lock| protects the
+     * event queue and the page selection. The IRQ line is only changed
+     * with the BQL held, which is taken before |lock|.
+     */
+    QemuMutex lock;
+
     /* Device properties */
     bool have_dpad;
     bool have_trackball;
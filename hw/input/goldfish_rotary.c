@@ -60,8 +60,10 @@ static void rotary_evdev_init(Object *obj)
     GoldfishEvDevState *s = GOLDFISHEVDEV(obj, TYPE_ROTARYEVDEV);
     SysBusDevice *sbd = SYS_BUS_DEVICE(obj);
 
+    qemu_mutex_init(&s->lock);
     memory_region_init_io(&s->iomem, obj, &rotary_evdev_ops, s,
                           "goldfish_rotary", 0x1000);
+    memory_region_clear_global_locking(&s->iomem);
     sysbus_init_mmio(sbd, &s->iomem);
     sysbus_init_irq(sbd, &s->irq);
 }
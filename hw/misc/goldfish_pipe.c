@@ -33,9 +33,13 @@
 #include "qemu/osdep.h"
 #include "hw/hw.h"
 #include "hw/sysbus.h"
+#include "exec/address-spaces.h"
 
 #include "qemu-common.h"
 #include "qemu/log.h"
+#include "qemu/main-loop.h"
+#include "qemu/rcu.h"
+#include "qemu/thread.h"
 #include "qemu/timer.h"
 #include "qemu/error-report.h"
 
@@ -126,6 +130,8 @@ typedef enum PipeCmd {
     PIPE_CMD_WAKE_ON_DONE_IO,
     PIPE_CMD_DMA_MAPHOST,
     PIPE_CMD_DMA_UNMAPHOST,
+    PIPE_CMD_RING_REGISTER,
+    PIPE_CMD_RING_KICK,
 } PipeCmd;
 
 enum {
@@ -140,10 +146,12 @@ enum {
 enum {
     PIPE_DEVICE_VERSION = 2,
     PIPE_DEVICE_VERSION_v1 = 1,
-    // Currently we support {v3,v4} driver for v2 pipe device, and anything
+    // Currently we support {v4,v5} driver for v2 pipe device, and anything
     // else for v1 device.
-    MAX_SUPPORTED_DRIVER_VERSION = 4,
+    MIN_V2_DRIVER_VERSION = 4,
+    MAX_SUPPORTED_DRIVER_VERSION = 5,
     PIPE_DRIVER_VERSION_v1 = 0,  // used to not report its version at all
+    PIPE_DRIVER_VERSION_RING = 5,  // knows PIPE_CMD_RING_*
 };
 
 /* These default callbacks are provided to detect when emulation setup
@@ -273,9 +281,72 @@ typedef struct PipeCommand {
             uint64_t dma_paddr;
             uint64_t sz;
         } dma_maphost_params;
+        struct {
+            uint64_t ring_paddr;
+            uint32_t ring_count;
+            uint32_t reserved;
+        } ring_params;
     };
 } PipeCommand;
 
+// Shared descriptor ring, registered once per pipe with
+// PIPE_CMD_RING_REGISTER. The guest fills descriptors and advances |head|;
+// the host consumes them in order, writes back |status| and advances
+// |tail|. The guest only kicks the ring (PIPE_CMD_RING_KICK) when it was
+// empty before posting, or after a wake for a stalled ring.
+// See android/docs/ANDROID-QEMU-PIPE.TXT for the full protocol.
+typedef struct PipeRingDesc {
+    uint64_t ptr;       // guest physical buffer address, guest -> host
+    uint32_t size;      // buffer size, guest -> host
+    uint16_t cmd;       // PIPE_CMD_READ or PIPE_CMD_WRITE, guest -> host
+    uint16_t flags;     // reserved
+    int32_t status;     // bytes transferred or error, host -> guest
+    uint32_t reserved;
+} PipeRingDesc;
+
+typedef struct PipeRingHeader {
+    uint32_t head;      // next descriptor to be posted, guest -> host
+    uint32_t tail;      // next descriptor to be consumed, host -> guest
+    uint32_t flags;     // PIPE_RING_FLAG_*
+    uint32_t reserved;
+    PipeRingDesc desc[];
+} PipeRingHeader;
+
+enum {
+    // Set by the host when the descriptor at |tail| would block. A wake is
+    // armed for its direction, and the guest kicks again once it arrives.
+    PIPE_RING_FLAG_STALLED = 1 << 0,
+    // Set by the guest while a task waits for a descriptor it didn't kick;
+    // the host then signals GOLDFISH_PIPE_WAKE_RING after consuming some.
+    PIPE_RING_FLAG_WANT_COMPLETION = 1 << 1,
+
+    PIPE_RING_MAX_COUNT = 4096,
+    PIPE_RING_MAX_BATCH = 64,
+    PIPE_RING_RAM_CACHE_SIZE = 4,
+};
+
+// A guest RAM range that is contiguous in host memory.
+typedef struct PipeRamRange {
+    hwaddr start;
+    hwaddr end;
+    uint8_t* host;      // host address of |start|
+    MemoryRegion* mr;   // referenced while cached
+    hwaddr mr_offset;   // offset of |start| in |mr|
+    bool writable;
+} PipeRamRange;
+
+typedef struct PipeRing {
+    uint64_t paddr;
+    uint32_t count;
+    PipeRingHeader* header;
+    // Guest buffers are translated through these instead of mapping and
+    // unmapping each of them.
+    PipeRamRange ram[PIPE_RING_RAM_CACHE_SIZE];
+    unsigned ram_next;
+    // PipeDevice::ram_generation when |ram| was last flushed.
+    unsigned ram_generation;
+} PipeRing;
+
 struct GoldfishHwPipe {
     struct GoldfishHwPipe *wanted_next;
     struct GoldfishHwPipe *wanted_prev;
@@ -287,10 +358,17 @@ struct GoldfishHwPipe {
     uint64_t command_buffer_addr;
     PipeCommand* command_buffer;
     uint32_t rw_params_max_count;
+    PipeRing* ring;  // registered shared ring or NULL, under |lock|
 
     // v1-specific fields
     struct GoldfishHwPipe* next;
     uint64_t channel; /* opaque kernel handle */
+
+    // v2-specific fields, see the locking notes above PipeDevice.
+    QemuMutex lock;     // serializes guest commands on this pipe
+    unsigned refcount;  // pipe table + in-flight commands, under dev->lock
+    bool detached;      // removed from the pipe table, under dev->lock
+    GoldfishPipeCloseReason close_reason;
 };
 
 typedef GoldfishHwPipe HwPipe;
@@ -306,8 +384,23 @@ typedef struct OpenCommandParams {
     uint32_t rw_params_max_count;
 } OpenCommandParams;
 
+// Locking:
+//
+// The MMIO region doesn't take the BQL. |lock| protects the pipe table, the
+// wanted list and the v2 registers. It is never held across calls into
+// |service_ops|, since a service may signal a wake (and so take |lock|) from
+// within those calls. Guest commands for a v2 pipe are serialized by the
+// pipe's own lock, and the pipe is kept alive by a reference for the
+// duration of the command.
+//
+// The IRQ line is only changed with the BQL held, and its level is computed
+// under |lock| after taking the BQL, so the lock order is BQL -> |lock|.
+//
+// The v1 protocol splits each command over several device-wide registers
+// and is only used by old guests, so it still runs entirely under the BQL.
 struct PipeDevice {
     GoldfishPipeState* ps;  // backlink to instance state
+    QemuMutex lock;
     int device_version;    // host device verion
     int driver_version;    // guest's driver version
 
@@ -347,6 +440,11 @@ struct PipeDevice {
     uint64_t channel;
     uint32_t wakes;
     uint64_t params_addr;
+
+    // Bumped on each change of the guest memory map, so the rings drop the
+    // host addresses they cached.
+    MemoryListener ram_listener;
+    unsigned ram_generation;
 };
 
 
@@ -430,6 +528,8 @@ static HwPipe* hwpipe_new0(PipeDevice* dev) {
     HwPipe* pipe;
     pipe = g_malloc0(sizeof(HwPipe));
     pipe->dev = dev;
+    pipe->refcount = 1;
+    qemu_mutex_init(&pipe->lock);
     return pipe;
 }
 
@@ -441,13 +541,33 @@ static HwPipe* hwpipe_new(uint32_t id, uint64_t channel, PipeDevice* dev) {
     return pipe;
 }
 
+static void pipe_ring_free(PipeRing* ring);
+
 static void hwpipe_free(HwPipe* pipe, GoldfishPipeCloseReason reason) {
     if (pipe->host_pipe)
         service_ops->guest_close(pipe->host_pipe, reason);
 
+    if (pipe->ring) {
+        pipe_ring_free(pipe->ring);
+    }
+    qemu_mutex_destroy(&pipe->lock);
     g_free(pipe);
 }
 
+static bool pipe_lock_iothread(void) {
+    if (qemu_mutex_iothread_locked()) {
+        return false;
+    }
+    qemu_mutex_lock_iothread();
+    return true;
+}
+
+static void pipe_unlock_iothread(bool locked) {
+    if (locked) {
+        qemu_mutex_unlock_iothread();
+    }
+}
+
 // Wanted pipe linked list operations
 static HwPipe* wanted_pipes_pop_first_v2(PipeDevice* dev) {
     HwPipe* pipe = dev->wanted_pipes_first;
@@ -567,6 +687,310 @@ static void unmap_command_buffer(void* buffer) {
                               COMMAND_BUFFER_SIZE);
 }
 
+// Look up a v2 pipe by |id| and take a reference to it.
+static HwPipe* hwpipe_get_v2(PipeDevice* dev, uint32_t id) {
+    HwPipe* pipe = NULL;
+
+    qemu_mutex_lock(&dev->lock);
+    if (id < dev->pipes_capacity) {
+        pipe = dev->pipes[id];
+        if (pipe) {
+            ++pipe->refcount;
+        }
+    }
+    qemu_mutex_unlock(&dev->lock);
+    return pipe;
+}
+
+static void hwpipe_unref_v2(HwPipe* pipe) {
+    PipeDevice* dev = pipe->dev;
+    bool last;
+
+    qemu_mutex_lock(&dev->lock);
+    last = --pipe->refcount == 0;
+    qemu_mutex_unlock(&dev->lock);
+
+    if (last) {
+        unmap_command_buffer(pipe->command_buffer);
+        hwpipe_free(pipe, pipe->close_reason);
+    }
+}
+
+// Remove |pipe| from the device tables. The caller must hold |dev->lock|
+// and drop the table's reference with hwpipe_unref_v2() after releasing it.
+static void hwpipe_detach_locked_v2(PipeDevice* dev, HwPipe* pipe,
+                                    GoldfishPipeCloseReason reason) {
+    dev->pipes[pipe->id] = NULL;
+    wanted_pipes_remove_v2(dev, pipe);
+    pipe->detached = true;
+    pipe->close_reason = reason;
+}
+
+// Set the IRQ level from the wanted list. Takes the BQL if needed, so the
+// caller must not hold |dev->lock|.
+static void goldfish_pipe_update_irq_v2(PipeDevice* dev) {
+    bool locked = pipe_lock_iothread();
+    bool level;
+
+    qemu_mutex_lock(&dev->lock);
+    level = dev->wanted_pipes_first != NULL;
+    qemu_mutex_unlock(&dev->lock);
+    qemu_set_irq(dev->ps->irq, level);
+    pipe_unlock_iothread(locked);
+}
+
+// Ask the host pipe to signal |wake_flags| when it can make progress.
+// Called with |pipe->lock| held.
+static void hwpipe_wake_on_v2(HwPipe* pipe, int wake_flags) {
+    PipeDevice* dev = pipe->dev;
+    int wanted = 0;
+
+    qemu_mutex_lock(&dev->lock);
+    if ((pipe->wanted & wake_flags) == 0) {
+        pipe->wanted |= wake_flags;
+        wanted = pipe->wanted;
+    }
+    qemu_mutex_unlock(&dev->lock);
+    if (wanted) {
+        service_ops->guest_wake_on(pipe->host_pipe, wanted);
+    }
+}
+
+static size_t pipe_ring_size(uint32_t count) {
+    return sizeof(PipeRingHeader) + count * sizeof(PipeRingDesc);
+}
+
+static PipeRing* pipe_ring_new(uint64_t paddr, uint32_t count) {
+    PipeRingHeader* header;
+    PipeRing* ring;
+
+    if (count == 0 || count > PIPE_RING_MAX_COUNT || (count & (count - 1))) {
+        return NULL;
+    }
+    header = (PipeRingHeader*)map_guest_buffer(paddr, pipe_ring_size(count),
+                                               /*is_write*/1);
+    if (!header) {
+        return NULL;
+    }
+    ring = g_new0(PipeRing, 1);
+    ring->paddr = paddr;
+    ring->count = count;
+    ring->header = header;
+    return ring;
+}
+
+static void pipe_ring_flush_ram(PipeRing* ring) {
+    unsigned i;
+
+    for (i = 0; i < PIPE_RING_RAM_CACHE_SIZE; ++i) {
+        if (ring->ram[i].mr) {
+            memory_region_unref(ring->ram[i].mr);
+        }
+    }
+    memset(ring->ram, 0, sizeof(ring->ram));
+}
+
+static void pipe_ring_free(PipeRing* ring) {
+    const size_t size = pipe_ring_size(ring->count);
+
+    pipe_ring_flush_ram(ring);
+    cpu_physical_memory_unmap(ring->header, size, 1, size);
+    g_free(ring);
+}
+
+// Return the host address of the guest buffer at |ptr|, or NULL if it isn't
+// entirely in RAM. The ranges found stay valid until the guest memory map
+// changes, see pipe_ring_drain_v2().
+static void* pipe_ring_translate(PipeRing* ring, uint64_t ptr, uint32_t size,
+                                 bool is_write, PipeRamRange** out) {
+    PipeRamRange* range;
+    MemoryRegion* mr;
+    hwaddr xlat, len;
+    unsigned i;
+
+    if (ptr + size < ptr) {
+        return NULL;
+    }
+    for (i = 0; i < PIPE_RING_RAM_CACHE_SIZE; ++i) {
+        range = &ring->ram[i];
+        if (range->mr && ptr >= range->start && ptr + size <= range->end &&
+            (range->writable || !is_write)) {
+            *out = range;
+            return range->host + (ptr - range->start);
+        }
+    }
+
+    rcu_read_lock();
+    len = UINT64_MAX - ptr;
+    mr = address_space_translate(&address_space_memory, ptr, &xlat, &len,
+                                 is_write);
+    if (!memory_access_is_direct(mr, is_write) || len < size) {
+        rcu_read_unlock();
+        return NULL;
+    }
+    range = &ring->ram[ring->ram_next++ % PIPE_RING_RAM_CACHE_SIZE];
+    if (range->mr) {
+        memory_region_unref(range->mr);
+    }
+    memory_region_ref(mr);
+    range->start = ptr;
+    range->end = ptr + len;
+    range->host = qemu_map_ram_ptr(mr->ram_block, xlat);
+    range->mr = mr;
+    range->mr_offset = xlat;
+    range->writable = memory_access_is_direct(mr, true);
+    rcu_read_unlock();
+
+    *out = range;
+    return range->host;
+}
+
+// Consume the descriptors posted on |pipe|'s ring, passing runs of
+// descriptors with the same command to the host pipe as one transfer.
+// Called with |pipe->lock| held.
+static void pipe_ring_drain_v2(HwPipe* pipe) {
+    PipeRing* ring = pipe->ring;
+    PipeRingHeader* header = ring->header;
+    const uint32_t mask = ring->count - 1;
+    uint32_t tail = atomic_read(&header->tail);
+    bool completed = false;
+    const unsigned ram_generation = atomic_read(&pipe->dev->ram_generation);
+
+    if (ring->ram_generation != ram_generation) {
+        pipe_ring_flush_ram(ring);
+        ring->ram_generation = ram_generation;
+    }
+    atomic_and(&header->flags, ~PIPE_RING_FLAG_STALLED);
+    for (;;) {
+        uint32_t head = atomic_read(&header->head);
+        if (head == tail) {
+            // The guest doesn't kick a ring that it sees non-empty, so
+            // publish our progress and look again for late descriptors.
+            atomic_mb_set(&header->tail, tail);
+            if (atomic_read(&header->head) == tail) {
+                break;
+            }
+            continue;
+        }
+        if (head - tail > ring->count) {
+            D("%s: id=%d bad ring indices head=%u tail=%u", __func__,
+              (int)pipe->id, head, tail);
+            break;
+        }
+        smp_rmb();  // read the descriptors after |head|
+
+        PipeRingDesc* first = &header->desc[tail & mask];
+        const uint16_t cmd = first->cmd;
+        if (cmd != PIPE_CMD_READ && cmd != PIPE_CMD_WRITE) {
+            first->status = GOLDFISH_PIPE_ERROR_INVAL;
+            ++tail;
+            completed = true;
+            continue;
+        }
+
+        const bool willModifyData = cmd == PIPE_CMD_READ;
+        GoldfishPipeBuffer buffers[PIPE_RING_MAX_BATCH];
+        PipeRamRange* ranges[PIPE_RING_MAX_BATCH];
+        uint64_t ptrs[PIPE_RING_MAX_BATCH];
+        unsigned count = 0;
+        while (count < PIPE_RING_MAX_BATCH && tail + count != head) {
+            PipeRingDesc* desc = &header->desc[(tail + count) & mask];
+            if (desc->cmd != cmd) {
+                break;
+            }
+            ptrs[count] = desc->ptr;
+            buffers[count].size = desc->size;
+            buffers[count].data =
+                    buffers[count].size
+                            ? pipe_ring_translate(ring, ptrs[count],
+                                                  buffers[count].size,
+                                                  willModifyData,
+                                                  &ranges[count])
+                            : NULL;
+            if (!buffers[count].data) {
+                break;
+            }
+            ++count;
+        }
+        if (!count) {
+            first->status = GOLDFISH_PIPE_ERROR_INVAL;
+            ++tail;
+            completed = true;
+            continue;
+        }
+
+        int status = willModifyData
+                ? service_ops->guest_recv(pipe->host_pipe, buffers, count)
+                : service_ops->guest_send(pipe->host_pipe, buffers, count);
+        DD("%s: id=%d %s buffers=%u > status=%d", __func__, (int)pipe->id,
+           willModifyData ? "READ" : "WRITE", count, status);
+
+        if (status == GOLDFISH_PIPE_ERROR_AGAIN) {
+            // Leave the descriptor on the ring; the guest kicks again after
+            // the wake.
+            atomic_or(&header->flags, PIPE_RING_FLAG_STALLED);
+            hwpipe_wake_on_v2(pipe, willModifyData ? GOLDFISH_PIPE_WAKE_READ
+                                                   : GOLDFISH_PIPE_WAKE_WRITE);
+            break;
+        }
+        if (status < 0) {
+            // Report bytes already written from this descriptor, if any.
+            if (willModifyData || first->status <= 0) {
+                first->status = status;
+            }
+            ++tail;
+            completed = true;
+            continue;
+        }
+
+        // Hand the transferred bytes out to the descriptors in order. A short
+        // read completes the descriptor it ends in; a short write leaves the
+        // rest of its descriptor on the ring so the stream stays ordered.
+        uint32_t left = status;
+        unsigned i;
+        for (i = 0; i < count; ++i) {
+            PipeRingDesc* desc = &header->desc[tail & mask];
+            const uint32_t size = buffers[i].size;
+            const uint32_t done = MIN(left, size);
+            left -= done;
+            if (willModifyData) {
+                if (done) {
+                    memory_region_invalidate_and_set_dirty(
+                            ranges[i]->mr,
+                            ranges[i]->mr_offset +
+                                    (ptrs[i] - ranges[i]->start),
+                            done);
+                }
+                desc->status = done;
+                ++tail;
+                completed = true;
+                if (done < size) {
+                    break;
+                }
+            } else if (done == size || (done == 0 && i == 0)) {
+                // A write of 0 bytes means end-of-stream.
+                desc->status += done;
+                ++tail;
+                completed = true;
+                if (done < size) {
+                    break;
+                }
+            } else {
+                desc->ptr = ptrs[i] + done;
+                desc->size = size - done;
+                desc->status += done;
+                break;
+            }
+        }
+    }
+    atomic_mb_set(&header->tail, tail);
+
+    if (completed &&
+        (atomic_read(&header->flags) & PIPE_RING_FLAG_WANT_COMPLETION)) {
+        goldfish_pipe_signal_wake(pipe, GOLDFISH_PIPE_WAKE_RING);
+    }
+}
+
 static void close_all_pipes_v1(PipeDevice* dev, GoldfishPipeCloseReason reason) {
     HwPipe* pipe = dev->pipes_list;
     while (pipe) {
@@ -580,18 +1004,23 @@ static void close_all_pipes_v1(PipeDevice* dev, GoldfishPipeCloseReason reason)
 static void close_all_pipes_v2(PipeDevice* dev, GoldfishPipeCloseReason reason) {
     int i = 0;
     for (; i < dev->pipes_capacity; ++i) {
+        qemu_mutex_lock(&dev->lock);
         HwPipe* pipe = dev->pipes[i];
         if (pipe) {
-            unmap_command_buffer(pipe->command_buffer);
-            hwpipe_free(pipe, reason);
-            dev->pipes[i] = NULL;
+            hwpipe_detach_locked_v2(dev, pipe, reason);
+        }
+        qemu_mutex_unlock(&dev->lock);
+        if (pipe) {
+            hwpipe_unref_v2(pipe);
         }
     }
 }
 
 static void reset_pipe_device(PipeDevice* dev) {
+    qemu_mutex_lock(&dev->lock);
     dev->wanted_pipes_first = NULL;
     dev->wanted_pipe_after_channel_high = NULL;
+    qemu_mutex_unlock(&dev->lock);
     g_hash_table_remove_all(dev->pipes_by_channel);
     qemu_set_irq(dev->ps->irq, 0);
     service_ops->dma_reset_host_mappings();
@@ -725,14 +1154,21 @@ static void pipeDevice_doCommand_v1(PipeDevice* dev, uint32_t command) {
 }
 
 static void pipeDevice_doOpenClose_v2(PipeDevice* dev, uint32_t id) {
+    // The open parameters live in guest memory; take a snapshot so that the
+    // checks below and the values stored in the pipe agree.
+    OpenCommandParams params;
+    qemu_mutex_lock(&dev->lock);
+    params = *dev->open_command;
+    qemu_mutex_unlock(&dev->lock);
+
     PipeCommand* commandBuffer = (PipeCommand*)map_guest_buffer(
-            dev->open_command->command_buffer_ptr,
+            params.command_buffer_ptr,
             COMMAND_BUFFER_SIZE, /*is_write*/1);
     if (!commandBuffer) {
         // well, what can we do here?
         return;
     }
-    if (dev->open_command->rw_params_max_count < 1) {
+    if (params.rw_params_max_count < 1) {
         commandBuffer->status = GOLDFISH_PIPE_ERROR_INVAL;
         unmap_command_buffer(commandBuffer);
         return;
@@ -753,33 +1189,49 @@ static void pipeDevice_doOpenClose_v2(PipeDevice* dev, uint32_t id) {
         unmap_command_buffer(commandBuffer);
         return;
     }
+
+    // Opening the host side may call back into the device, so do it before
+    // taking the lock.
+    HwPipe* pipe = hwpipe_new(id, 0, dev);
+    if (!pipe || !pipe->host_pipe) {
+        hwpipe_free(pipe, GOLDFISH_PIPE_CLOSE_ERROR);
+        commandBuffer->status = GOLDFISH_PIPE_ERROR_NOMEM;
+        unmap_command_buffer(commandBuffer);
+        return;
+    }
+
+    pipe->command_buffer_addr = params.command_buffer_ptr;
+    pipe->command_buffer = commandBuffer;
+    pipe->rw_params_max_count = params.rw_params_max_count;
+
+    qemu_mutex_lock(&dev->lock);
     if (id >= dev->pipes_capacity) {
         int newCapacity = (id + 1 > 2 * dev->pipes_capacity)
                                   ? id + 1
                                   : 2 * dev->pipes_capacity;
         HwPipe** pipes = calloc(newCapacity, sizeof(HwPipe*));
         if (!pipes) {
+            qemu_mutex_unlock(&dev->lock);
+            hwpipe_free(pipe, GOLDFISH_PIPE_CLOSE_ERROR);
             commandBuffer->status = GOLDFISH_PIPE_ERROR_NOMEM;
             unmap_command_buffer(commandBuffer);
             return;
         }
         memcpy(pipes, dev->pipes, sizeof(HwPipe*) * dev->pipes_capacity);
+        free(dev->pipes);
         dev->pipes = pipes;
         dev->pipes_capacity = newCapacity;
     }
-
-    HwPipe* pipe = hwpipe_new(id, 0, dev);
-    if (!pipe || !pipe->host_pipe) {
+    if (dev->pipes[id]) {
+        // Another vCPU opened the same id concurrently.
+        qemu_mutex_unlock(&dev->lock);
         hwpipe_free(pipe, GOLDFISH_PIPE_CLOSE_ERROR);
-        commandBuffer->status = GOLDFISH_PIPE_ERROR_NOMEM;
+        commandBuffer->status = GOLDFISH_PIPE_ERROR_INVAL;
         unmap_command_buffer(commandBuffer);
         return;
     }
-
-    pipe->command_buffer_addr = dev->open_command->command_buffer_ptr;
-    pipe->command_buffer = commandBuffer;
-    pipe->rw_params_max_count = dev->open_command->rw_params_max_count;
     dev->pipes[id] = pipe;
+    qemu_mutex_unlock(&dev->lock);
     commandBuffer->status = 0;
 }
 
@@ -799,12 +1251,20 @@ static void pipeDevice_doCommand_v2(HwPipe* pipe) {
     switch (command) {
         case PIPE_CMD_CLOSE: {
             DD("%s: CMD_CLOSE id=%d", __func__, (int)pipe->id);
-            // Remove from device's lists.
-            dev->pipes[pipe->id] = NULL;
-            wanted_pipes_remove_v2(dev, pipe);
+            // Remove from device's lists; the pipe itself goes away once the
+            // caller drops its reference.
+            bool detach;
+            qemu_mutex_lock(&dev->lock);
+            detach = !pipe->detached;
+            if (detach) {
+                hwpipe_detach_locked_v2(dev, pipe,
+                                        GOLDFISH_PIPE_CLOSE_GRACEFUL);
+            }
+            qemu_mutex_unlock(&dev->lock);
             pipe->command_buffer->status = 0;
-            unmap_command_buffer(pipe->command_buffer);
-            hwpipe_free(pipe, GOLDFISH_PIPE_CLOSE_GRACEFUL);
+            if (detach) {
+                hwpipe_unref_v2(pipe);
+            }
             break;
         }
 
@@ -949,10 +1409,7 @@ static void pipeDevice_doCommand_v2(HwPipe* pipe) {
                     ? GOLDFISH_PIPE_WAKE_READ : GOLDFISH_PIPE_WAKE_WRITE;
             DD("%s: CMD_WAKE_ON_%s id=%d", __func__, (read ? "READ" : "WRITE"),
                (int)pipe->id);
-            if ((pipe->wanted & wake_flags) == 0) {
-                pipe->wanted |= wake_flags;
-                service_ops->guest_wake_on(pipe->host_pipe, pipe->wanted);
-            }
+            hwpipe_wake_on_v2(pipe, wake_flags);
             pipe->command_buffer->status = 0;
             break;
         }
@@ -968,6 +1425,35 @@ static void pipeDevice_doCommand_v2(HwPipe* pipe) {
                     pipe->command_buffer->dma_maphost_params.dma_paddr);
             pipe->command_buffer->status = 0;
             break;
+        case PIPE_CMD_RING_REGISTER: {
+            PipeRing* ring = NULL;
+            if (dev->driver_version >= PIPE_DRIVER_VERSION_RING) {
+                ring = pipe_ring_new(
+                        pipe->command_buffer->ring_params.ring_paddr,
+                        pipe->command_buffer->ring_params.ring_count);
+            }
+            DD("%s: CMD_RING_REGISTER id=%d count=%u > %p", __func__,
+               (int)pipe->id, pipe->command_buffer->ring_params.ring_count,
+               ring);
+            if (!ring) {
+                pipe->command_buffer->status = GOLDFISH_PIPE_ERROR_INVAL;
+                break;
+            }
+            if (pipe->ring) {
+                pipe_ring_free(pipe->ring);
+            }
+            pipe->ring = ring;
+            pipe->command_buffer->status = 0;
+            break;
+        }
+        case PIPE_CMD_RING_KICK:
+            if (!pipe->ring) {
+                pipe->command_buffer->status = GOLDFISH_PIPE_ERROR_INVAL;
+                break;
+            }
+            pipe_ring_drain_v2(pipe);
+            pipe->command_buffer->status = 0;
+            break;
         default:
             D("%s: command=%d (0x%x)\n", __func__, command, command);
     }
@@ -983,9 +1469,15 @@ static void pipe_dev_write(void* opaque,
     DR("%s: offset = 0x%" HWADDR_PRIx " value=%" PRIu64 "/0x%" PRIx64, __func__,
        offset, value, value);
     if (offset == PIPE_REG_VERSION) {
+        bool locked = pipe_lock_iothread();
         dev->driver_version = value;
+        pipe_unlock_iothread(locked);
+    } else if (dev->ops == &pipe_ops_v2) {
+        dev->ops->dev_write(dev, offset, value);
     } else {
+        bool locked = pipe_lock_iothread();
         dev->ops->dev_write(dev, offset, value);
+        pipe_unlock_iothread(locked);
     }
 }
 
@@ -996,9 +1488,11 @@ static uint64_t pipe_dev_read(void* opaque, hwaddr offset, unsigned size) {
         // PIPE_REG_VERSION is issued on probe, which means that
         // we should clean up all existing stale pipes.
         // This helps keep the right state on rebooting.
+        bool locked = pipe_lock_iothread();
+        uint64_t version;
         dev->ops->close_all(dev, GOLDFISH_PIPE_CLOSE_REBOOT);
         reset_pipe_device(dev);
-        if (dev->driver_version < MAX_SUPPORTED_DRIVER_VERSION) {
+        if (dev->driver_version < MIN_V2_DRIVER_VERSION) {
             // Old driver used to not report its version at all.
             dev->device_version = PIPE_DEVICE_VERSION_v1;
             dev->ops = &pipe_ops_v1;
@@ -1006,9 +1500,18 @@ static uint64_t pipe_dev_read(void* opaque, hwaddr offset, unsigned size) {
             dev->device_version = PIPE_DEVICE_VERSION;
             dev->ops = &pipe_ops_v2;
         }
-        return dev->device_version;
+        version = dev->device_version;
+        pipe_unlock_iothread(locked);
+        return version;
+    }
+    if (dev->ops == &pipe_ops_v2) {
+        return dev->ops->dev_read(dev, offset);
+    } else {
+        bool locked = pipe_lock_iothread();
+        uint64_t value = dev->ops->dev_read(dev, offset);
+        pipe_unlock_iothread(locked);
+        return value;
     }
-    return dev->ops->dev_read(dev, offset);
 }
 
 static void pipe_dev_write_v1(PipeDevice* dev,
@@ -1108,6 +1611,21 @@ static void pipe_dev_write_v1(PipeDevice* dev,
 static void pipe_dev_write_v2(PipeDevice* dev,
                                   hwaddr offset,
                                   uint64_t value) {
+    if (offset == PIPE_REG_CMD) {
+        unsigned id = value;
+        HwPipe* pipe = hwpipe_get_v2(dev, id);
+        if (pipe) {
+            qemu_mutex_lock(&pipe->lock);
+            pipeDevice_doCommand_v2(pipe);
+            qemu_mutex_unlock(&pipe->lock);
+            hwpipe_unref_v2(pipe);
+        } else {
+            pipeDevice_doOpenClose_v2(dev, id);
+        }
+        return;
+    }
+
+    qemu_mutex_lock(&dev->lock);
     switch (offset) {
         case PIPE_REG_SIGNAL_BUFFER_HIGH:
             dev->signalled_pipe_buffer_addr = value << 32;
@@ -1138,15 +1656,6 @@ static void pipe_dev_write_v2(PipeDevice* dev,
                 APANIC("%s: failed to map open command buffer\n", __func__);
             }
             break;
-        case PIPE_REG_CMD: {
-            unsigned id = value;
-            if (id < dev->pipes_capacity && dev->pipes[id]) {
-                pipeDevice_doCommand_v2(dev->pipes[id]);
-            } else {
-                pipeDevice_doOpenClose_v2(dev, id);
-            }
-            break;
-        }
         default:
             qemu_log_mask(LOG_GUEST_ERROR,
                           "%s: unknown register offset = 0x%" HWADDR_PRIx
@@ -1154,6 +1663,7 @@ static void pipe_dev_write_v2(PipeDevice* dev,
                           __func__, offset, value, value);
             break;
     }
+    qemu_mutex_unlock(&dev->lock);
 }
 
 static uint64_t pipe_dev_read_v1(PipeDevice* dev, hwaddr offset)
@@ -1218,7 +1728,9 @@ static uint64_t pipe_dev_read_v2(PipeDevice* dev, hwaddr offset) {
     switch (offset) {
         case PIPE_REG_GET_SIGNALLED: {
             int count = 0;
+            bool drained;
             HwPipe* pipe;
+            qemu_mutex_lock(&dev->lock);
             while (count < dev->signalled_pipe_buffer_size &&
                    (pipe = wanted_pipes_pop_first_v2(dev)) != NULL) {
                 dev->signalled_pipe_buffer[count].id = pipe->id;
@@ -1226,8 +1738,12 @@ static uint64_t pipe_dev_read_v2(PipeDevice* dev, hwaddr offset) {
                         hwpipe_get_and_clear_wanted(pipe);
                 ++count;
             }
-            if (!dev->wanted_pipes_first) {
-                qemu_set_irq(dev->ps->irq, 0);  // we've passed all wanted pipes
+            drained = !dev->wanted_pipes_first;
+            qemu_mutex_unlock(&dev->lock);
+            if (drained) {
+                // we've passed all wanted pipes; a wake may have raced in
+                // since, so the level is recomputed under the BQL.
+                goldfish_pipe_update_irq_v2(dev);
             }
             return count;
         }
@@ -1341,6 +1857,10 @@ static void goldfish_pipe_save_v2(QEMUFile* file, PipeDevice* dev) {
         qemu_put_be32(file, pipe->rw_params_max_count);
         qemu_put_byte(file, pipe->closed);
         qemu_put_byte(file, pipe->wanted);
+        if (dev->driver_version >= PIPE_DRIVER_VERSION_RING) {
+            qemu_put_be64(file, pipe->ring ? pipe->ring->paddr : 0);
+            qemu_put_be32(file, pipe->ring ? pipe->ring->count : 0);
+        }
         // It's possible to get a 'save' command right after the 'load' one,
         // when some force-closed pipes are still on the list.
         if (pipe->host_pipe) {
@@ -1554,6 +2074,18 @@ static int goldfish_pipe_load_v2(QEMUFile* file, PipeDevice* dev) {
         pipe->rw_params_max_count = qemu_get_be32(file);
         pipe->closed = qemu_get_byte(file);
         pipe->wanted = qemu_get_byte(file);
+        if (dev->driver_version >= PIPE_DRIVER_VERSION_RING) {
+            uint64_t ring_paddr = qemu_get_be64(file);
+            uint32_t ring_count = qemu_get_be32(file);
+            if (ring_count) {
+                pipe->ring = pipe_ring_new(ring_paddr, ring_count);
+                if (!pipe->ring) {
+                    unmap_command_buffer(pipe->command_buffer);
+                    hwpipe_free(pipe, GOLDFISH_PIPE_CLOSE_ERROR);
+                    goto done;
+                }
+            }
+        }
 
         char force_close = 0;
         char has_host_pipe = qemu_get_byte(file);
@@ -1644,6 +2176,11 @@ static void goldfish_pipe_post_load(void* opaque) {
 
 static GoldfishPipeState* s_goldfish_pipe_state = NULL;
 
+static void goldfish_pipe_ram_commit(MemoryListener* listener) {
+    PipeDevice* dev = container_of(listener, PipeDevice, ram_listener);
+    atomic_inc(&dev->ram_generation);
+}
+
 static void goldfish_pipe_realize(DeviceState* dev, Error** errp) {
     SysBusDevice* sbdev = SYS_BUS_DEVICE(dev);
     GoldfishPipeState* s = GOLDFISH_PIPE(dev);
@@ -1651,6 +2188,7 @@ static void goldfish_pipe_realize(DeviceState* dev, Error** errp) {
 
     s->dev = (PipeDevice*)g_malloc0(sizeof(PipeDevice));
     s->dev->ps = s; /* HACK: backlink */
+    qemu_mutex_init(&s->dev->lock);
 
     s->dev->ops = &pipe_ops_v2;
     s->dev->device_version = PIPE_DEVICE_VERSION;
@@ -1670,9 +2208,14 @@ static void goldfish_pipe_realize(DeviceState* dev, Error** errp) {
 
     memory_region_init_io(&s->iomem, OBJECT(s), &goldfish_pipe_iomem_ops, s,
                           "goldfish_pipe", 0x2000 /*TODO: ?how big?*/);
+    /* See the locking notes above PipeDevice. */
+    memory_region_clear_global_locking(&s->iomem);
     sysbus_init_mmio(sbdev, &s->iomem);
     sysbus_init_irq(sbdev, &s->irq);
 
+    s->dev->ram_listener.commit = goldfish_pipe_ram_commit;
+    memory_listener_register(&s->dev->ram_listener, &address_space_memory);
+
     register_savevm_with_post_load(
             dev, "goldfish_pipe", 0, GOLDFISH_PIPE_SAVE_VERSION,
             goldfish_pipe_save, goldfish_pipe_load, goldfish_pipe_post_load, s);
@@ -1691,12 +2234,24 @@ void goldfish_pipe_signal_wake(GoldfishHwPipe *pipe,
     DD("%s: id=%d channel=0x%llx flags=%d", __func__, (int)pipe->id,
        pipe->channel, flags);
 
-    hwpipe_set_wanted(pipe, (unsigned char)flags);
-    dev->ops->wanted_list_add(dev, pipe);
+    /* Host services may signal from their own threads; the v1 device state
+     * is only protected by the BQL. */
+    bool locked = pipe_lock_iothread();
+    bool raise = false;
+    qemu_mutex_lock(&dev->lock);
+    if (!pipe->detached) {
+        hwpipe_set_wanted(pipe, (unsigned char)flags);
+        dev->ops->wanted_list_add(dev, pipe);
+        raise = true;
+    }
+    qemu_mutex_unlock(&dev->lock);
 
     /* Raise IRQ to indicate there are items on our list ! */
-    qemu_set_irq(dev->ps->irq, 1);
-    DD("%s: raising IRQ", __func__);
+    if (raise) {
+        qemu_set_irq(dev->ps->irq, 1);
+        DD("%s: raising IRQ", __func__);
+    }
+    pipe_unlock_iothread(locked);
 }
 
 /* Function to look up hwpipe by pipe id and vice versa. */
@@ -1706,8 +2261,16 @@ int goldfish_pipe_get_id(GoldfishHwPipe* pipe) {
 }
 
 GoldfishHwPipe* goldfish_pipe_lookup_by_id(int id) {
-    assert(s_goldfish_pipe_state->dev->device_version == PIPE_DEVICE_VERSION);
-    return s_goldfish_pipe_state->dev->pipes[id];
+    PipeDevice* dev = s_goldfish_pipe_state->dev;
+    GoldfishHwPipe* pipe = NULL;
+
+    assert(dev->device_version == PIPE_DEVICE_VERSION);
+    qemu_mutex_lock(&dev->lock);
+    if (id >= 0 && id < dev->pipes_capacity) {
+        pipe = dev->pipes[id];
+    }
+    qemu_mutex_unlock(&dev->lock);
+    return pipe;
 }
 
 void goldfish_pipe_close_from_host(GoldfishHwPipe *pipe)
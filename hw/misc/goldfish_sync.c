@@ -16,6 +16,7 @@
 #include "qemu-common.h"
 #include "qemu/error-report.h"
 #include "qemu/main-loop.h"
+#include "qemu/thread.h"
 #include "trace.h"
 #include "hw/misc/goldfish_sync.h"
 #include "migration/register.h"
@@ -78,8 +79,6 @@ struct goldfish_sync_pending_cmd {
 // |first_pending_cmd|: maintains a pointer to the earliest pending command
 // that needs to be sent. We plan to process pending commands in the same
 // order in which they were received.
-// |current|: Intermediate value that represents a popped-off pending
-// command.
 // |batch_cmd_addr|: Physical memory address where we write the details
 // of each command that comes in from the host. We also read replies
 // from the same address (if applicable)
@@ -87,14 +86,19 @@ struct goldfish_sync_pending_cmd {
 // details of each command that comes in from the guest.
 // |ops|: Callbacks to other areas of the emulator that need to be
 // triggered upon reading a guest->host command.
+// |lock|: The registers are accessed without the BQL. |lock| protects
+// the pending list and the batch addresses; it is never held across
+// |service_ops| calls or guest memory accesses, since the guest may point
+// the batch addresses at MMIO. The IRQ level is only changed with the BQL
+// held.
 struct goldfish_sync_state {
     SysBusDevice parent;
     MemoryRegion iomem;
     qemu_irq irq;
+    QemuMutex lock;
 
     struct goldfish_sync_pending_cmd* pending;
     struct goldfish_sync_pending_cmd* first_pending_cmd;
-    struct goldfish_sync_pending_cmd* current;
 
     uint64_t batch_cmd_addr;
     uint64_t batch_guestcmd_addr;
@@ -175,9 +179,29 @@ static void goldfish_sync_clear_pending(struct goldfish_sync_state* state) {
     state->first_pending_cmd = NULL;
 }
 
+// Set the IRQ level from the pending list. Takes the BQL if the caller
+// doesn't hold it, and must be called without |state->lock|.
+static void goldfish_sync_update_irq(struct goldfish_sync_state* state) {
+    bool locked = !qemu_mutex_iothread_locked();
+    bool level;
+
+    if (locked) {
+        qemu_mutex_lock_iothread();
+    }
+    qemu_mutex_lock(&state->lock);
+    level = state->first_pending_cmd != NULL;
+    qemu_mutex_unlock(&state->lock);
+    qemu_set_irq(state->irq, level);
+    if (locked) {
+        qemu_mutex_unlock_iothread();
+    }
+}
+
 static void goldfish_sync_reset_device(struct goldfish_sync_state* state) {
+    qemu_mutex_lock(&state->lock);
     goldfish_sync_clear_pending(state);
-    qemu_set_irq(state->irq, 0);
+    qemu_mutex_unlock(&state->lock);
+    goldfish_sync_update_irq(state);
 }
 
 // Callbacks and hw_funcs struct================================================
@@ -202,15 +226,27 @@ void goldfish_sync_send_command(uint32_t cmd,
            "hostcmd_handle=0x%llx",
            cmd, handle, time_arg, hostcmd_handle);
 
+    qemu_mutex_lock(&s->lock);
+    // Fold a timeline increment into the last pending one for the same
+    // timeline: the guest then signals all the fences at once, with one
+    // command read instead of one per fence.
+    if (cmd == GOLDFISH_SYNC_CMD_INCREMENT_TIMELINE && s->pending &&
+        s->pending->cmd == cmd && s->pending->handle == handle &&
+        s->pending->time_arg <= UINT32_MAX - time_arg) {
+        s->pending->time_arg += time_arg;
+        qemu_mutex_unlock(&s->lock);
+        DPRINT("Merged into pending increment");
+        return;
+    }
     to_send = goldfish_sync_new_cmd();
     to_send->cmd = cmd;
     to_send->handle = handle;
     to_send->time_arg = time_arg;
     to_send->hostcmd_handle = hostcmd_handle;
-
     goldfish_sync_push_cmd(s, to_send);
+    qemu_mutex_unlock(&s->lock);
 
-    qemu_set_irq(s->irq, 1);
+    goldfish_sync_update_irq(s);
 
     DPRINT("Exit");
 }
@@ -227,7 +263,9 @@ goldfish_sync_read(void *opaque,
     DPRINT("opaque=%p offset=0x%lx sz=0x%x", opaque, offset, size);
 
     struct goldfish_sync_state* s = opaque;
+    struct goldfish_sync_pending_cmd* current;
     struct goldfish_sync_batch_cmd* curr_batch_cmd;
+    uint64_t batch_cmd_addr;
 
     switch (offset) {
     // SYNC_REG_BATCH_COMMAND read:
@@ -243,32 +281,35 @@ goldfish_sync_read(void *opaque,
     // host (the linked list) are processed. At that point, IRQ
     // is lowered.
     case SYNC_REG_BATCH_COMMAND:
-        s->current = goldfish_sync_pop_first_cmd(s);
-        if (!s->current) {
+        qemu_mutex_lock(&s->lock);
+        current = goldfish_sync_pop_first_cmd(s);
+        batch_cmd_addr = s->batch_cmd_addr;
+        qemu_mutex_unlock(&s->lock);
+        if (!current) {
             DPRINT("Out of pending commands. Lower IRQ.");
             struct goldfish_sync_batch_cmd quit_cmd = {
                 .cmd = 0, .handle = 0, .time_arg = 0, .hostcmd_handle = 0
             };
-            cpu_physical_memory_write(s->batch_cmd_addr,
+            cpu_physical_memory_write(batch_cmd_addr,
                                       (void*)&quit_cmd,
                                       sizeof(struct goldfish_sync_batch_cmd));
-            qemu_set_irq(s->irq, 0);
+            // A command may have been pushed since; this rechecks.
+            goldfish_sync_update_irq(s);
             return 0;
         } else {
             // goldfish_sync_batch_cmd is a prefix of
             // goldfish_sync_pending_cmd, so we can avoid a copy.
-            curr_batch_cmd = (struct goldfish_sync_batch_cmd*)(s->current);
+            curr_batch_cmd = (struct goldfish_sync_batch_cmd*)current;
             DPRINT("read SYNC_REG_BATCH_COMMAND. writing to batch addr: "
                    "cmd=%u handle=0x%llx time_arg=%u hostcmd_handle=0x%llx\n",
                    curr_batch_cmd->cmd,
                    (unsigned long long)curr_batch_cmd->handle,
                    curr_batch_cmd->time_arg,
                    (unsigned long long)curr_batch_cmd->hostcmd_handle);
-            cpu_physical_memory_write(s->batch_cmd_addr,
+            cpu_physical_memory_write(batch_cmd_addr,
                                       (void*)curr_batch_cmd,
                                       sizeof(struct goldfish_sync_batch_cmd));
-            goldfish_sync_free_cmd(s->current);
-            s->current = NULL;
+            goldfish_sync_free_cmd(current);
         }
         DPRINT("done SYNC_REG_BATCH_COMMAND. returning result val?");
         return 0;
@@ -308,6 +349,7 @@ goldfish_sync_write(void *opaque,
            opaque, offset, size, val);
 
     struct goldfish_sync_state* s = opaque;
+    uint64_t batch_addr;
 
     switch (offset) {
     // SYNC_REG_BATCH_COMMAND write: Used to send acknowledgements
@@ -325,7 +367,10 @@ goldfish_sync_write(void *opaque,
             .time_arg = 0,
             .hostcmd_handle = 0,
         };
-        cpu_physical_memory_read(s->batch_cmd_addr,
+        qemu_mutex_lock(&s->lock);
+        batch_addr = s->batch_cmd_addr;
+        qemu_mutex_unlock(&s->lock);
+        cpu_physical_memory_read(batch_addr,
                                  (void*)&incoming,
                                  sizeof(struct goldfish_sync_batch_cmd));
         DPRINT("got: cmd=%u handle=0x%llx time_arg=%u hostcmd_handle=0x%llx",
@@ -351,11 +396,14 @@ goldfish_sync_write(void *opaque,
             .thread_handle = 0,
             .guest_timeline_handle = 0,
         };
-        cpu_physical_memory_read(s->batch_guestcmd_addr,
+        qemu_mutex_lock(&s->lock);
+        batch_addr = s->batch_guestcmd_addr;
+        qemu_mutex_unlock(&s->lock);
+        cpu_physical_memory_read(batch_addr,
                                  (void*)&guest_incoming,
                                  sizeof(struct goldfish_sync_batch_guestcmd));
         DPRINT("got: batchaddr 0x%llx cmd=%llu glsync=0x%llx thread=0x%llx timeline=0x%llx\n",
-               (unsigned long long)(s->batch_guestcmd_addr),
+               (unsigned long long)batch_addr,
                (unsigned long long)(guest_incoming.host_command),
                (unsigned long long)(guest_incoming.glsync_handle),
                (unsigned long long)(guest_incoming.thread_handle),
@@ -376,18 +424,26 @@ goldfish_sync_write(void *opaque,
     // Used to communicate the physical address on the guest where
     // we write all the info for commands.
     case SYNC_REG_BATCH_COMMAND_ADDR:
+        qemu_mutex_lock(&s->lock);
         s->batch_cmd_addr = val;
+        qemu_mutex_unlock(&s->lock);
         break;
     case SYNC_REG_BATCH_COMMAND_ADDR_HIGH:
+        qemu_mutex_lock(&s->lock);
         s->batch_cmd_addr |= (uint64_t)(val << 32);
+        qemu_mutex_unlock(&s->lock);
         DPRINT("Got batch command address. addr=0x%llx",
                s->batch_cmd_addr);
         break;
     case SYNC_REG_BATCH_GUESTCOMMAND_ADDR:
+        qemu_mutex_lock(&s->lock);
         s->batch_guestcmd_addr = val;
+        qemu_mutex_unlock(&s->lock);
         break;
     case SYNC_REG_BATCH_GUESTCOMMAND_ADDR_HIGH:
+        qemu_mutex_lock(&s->lock);
         s->batch_guestcmd_addr |= (uint64_t)(val << 32);
+        qemu_mutex_unlock(&s->lock);
         DPRINT("Got batch guestcommand address. addr=0x%llx",
                s->batch_guestcmd_addr);
         break;
@@ -509,13 +565,14 @@ static void goldfish_sync_realize(DeviceState *dev, Error **errp) {
     s_goldfish_sync_dev = s;
 
     s->pending = NULL;
-    s->current = NULL;
+    qemu_mutex_init(&s->lock);
 
     memory_region_init_io(&s->iomem, OBJECT(s),
                           &goldfish_sync_iomem_ops,
                           s,
                           "goldfish_sync",
                           0x2000);
+    memory_region_clear_global_locking(&s->iomem);
     sysbus_init_mmio(sbdev, &s->iomem);
     sysbus_init_irq(sbdev, &s->irq);
 
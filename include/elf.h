@@ -455,6 +455,17 @@ typedef struct {
 #define HWCAP_VFPD32            (1 << 19)       /* set if VFP has 32 regs */
 #define HWCAP_LPAE              (1 << 20)
 
+/* Bits present in AT_HWCAP for AArch64.  */
+
+#define HWCAP_AARCH64_FP        (1 << 0)
+#define HWCAP_AARCH64_ASIMD     (1 << 1)
+#define HWCAP_AARCH64_EVTSTRM   (1 << 2)
+#define HWCAP_AARCH64_AES       (1 << 3)
+#define HWCAP_AARCH64_PMULL     (1 << 4)
+#define HWCAP_AARCH64_SHA1      (1 << 5)
+#define HWCAP_AARCH64_SHA2      (1 << 6)
+#define HWCAP_AARCH64_CRC32     (1 << 7)
+
 /* Bits present in AT_HWCAP for PowerPC.  */
 
 #define PPC_FEATURE_32                  0x80000000
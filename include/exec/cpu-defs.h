@@ -131,6 +131,9 @@ typedef struct CPUIOTLBEntry {
     MemTxAttrs attrs;
 } CPUIOTLBEntry;
 
+/* Saved per-ASID TLB tables, private to cputlb.c */
+typedef struct CPUTLBASIDCache CPUTLBASIDCache;
+
 #define CPU_COMMON_TLB \
     /* The meaning of the MMU modes is defined in the target code. */   \
     CPUTLBEntry tlb_table[NB_MMU_MODES][CPU_TLB_SIZE];                  \
@@ -138,9 +141,12 @@ typedef struct CPUIOTLBEntry {
     CPUIOTLBEntry iotlb[NB_MMU_MODES][CPU_TLB_SIZE];                    \
     CPUIOTLBEntry iotlb_v[NB_MMU_MODES][CPU_VTLB_SIZE];                 \
     size_t tlb_flush_count;                                             \
+    /* Bumped whenever entries are dropped, see tb-prefetch.c */        \
+    unsigned int tlb_gen;                                               \
     target_ulong tlb_flush_addr;                                        \
     target_ulong tlb_flush_mask;                                        \
     target_ulong vtlb_index;                                            \
+    CPUTLBASIDCache *tlb_asid_cache;                                    \
 
 #else
 
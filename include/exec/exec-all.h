@@ -221,6 +221,40 @@ void tlb_flush_by_mmuidx_all_cpus(CPUState *cpu, uint16_t idxmap);
  * depend on when the guests translation ends the TB.
  */
 void tlb_flush_by_mmuidx_all_cpus_synced(CPUState *cpu, uint16_t idxmap);
+/**
+ * tlb_set_asid_by_mmuidx:
+ * @cpu: CPU whose address space identifier changed
+ * @asid: the new ASID (at most 16 bits)
+ * @idxmap: bitmap of MMU indexes tagged by the ASID
+ *
+ * Tell the TLB that the entries for the specified MMU indexes now belong
+ * to @asid. Rather than being flushed, the entries for the previous ASID
+ * are set aside and the entries last seen for @asid, if still held, are
+ * made live again. Must be called from @cpu's own thread, and the
+ * target must call it for every ASID change once it starts using it.
+ */
+void tlb_set_asid_by_mmuidx(CPUState *cpu, uint32_t asid, uint16_t idxmap);
+/**
+ * tlb_flush_asid_by_mmuidx:
+ * @cpu: CPU whose TLB should be flushed
+ * @asid: ASID whose entries should be flushed
+ * @idxmap: bitmap of MMU indexes tagged by the ASID
+ *
+ * Flush the entries belonging to @asid from the TLB of the specified CPU,
+ * for the specified MMU indexes. Entries for other ASIDs are kept.
+ */
+void tlb_flush_asid_by_mmuidx(CPUState *cpu, uint32_t asid, uint16_t idxmap);
+/**
+ * tlb_flush_asid_by_mmuidx_all_cpus_synced:
+ * @cpu: Originating CPU of the flush
+ * @asid: ASID whose entries should be flushed
+ * @idxmap: bitmap of MMU indexes tagged by the ASID
+ *
+ * Like tlb_flush_asid_by_mmuidx, but for all CPUs, with the source
+ * vCPUs work scheduled as safe work like tlb_flush_by_mmuidx_all_cpus_synced.
+ */
+void tlb_flush_asid_by_mmuidx_all_cpus_synced(CPUState *cpu, uint32_t asid,
+                                              uint16_t idxmap);
 /**
  * tlb_set_page_with_attrs:
  * @cpu: CPU to add this TLB entry for
@@ -255,6 +289,8 @@ void tlb_set_page_with_attrs(CPUState *cpu, target_ulong vaddr,
 void tlb_set_page(CPUState *cpu, target_ulong vaddr,
                   hwaddr paddr, int prot,
                   int mmu_idx, target_ulong size);
+bool tlb_set_code_page_private(CPUState *cpu, target_ulong vaddr,
+                               hwaddr paddr, MemTxAttrs attrs);
 void tb_invalidate_phys_addr(AddressSpace *as, hwaddr addr);
 void probe_write(CPUArchState *env, target_ulong addr, int size, int mmu_idx,
                  uintptr_t retaddr);
@@ -303,6 +339,19 @@ static inline void tlb_flush_by_mmuidx_all_cpus_synced(CPUState *cpu,
                                                        uint16_t idxmap)
 {
 }
+static inline void tlb_set_asid_by_mmuidx(CPUState *cpu, uint32_t asid,
+                                          uint16_t idxmap)
+{
+}
+static inline void tlb_flush_asid_by_mmuidx(CPUState *cpu, uint32_t asid,
+                                            uint16_t idxmap)
+{
+}
+static inline void tlb_flush_asid_by_mmuidx_all_cpus_synced(CPUState *cpu,
+                                                            uint32_t asid,
+                                                            uint16_t idxmap)
+{
+}
 static inline void tb_invalidate_phys_addr(AddressSpace *as, hwaddr addr)
 {
 }
@@ -353,6 +402,9 @@ struct TranslationBlock {
     /* Per-vCPU dynamic tracing state used to generate this TB */
     uint32_t trace_vcpu_dstate;
 
+    /* Execution count, only updated with TCG_INSTRUMENT_TB_COUNT */
+    uint64_t exec_count;
+
     struct tb_tc tc;
 
     /* original tb when cflags has CF_NOCACHE */
@@ -406,6 +458,45 @@ static inline uint32_t curr_cflags(void)
 
 void tb_remove(TranslationBlock *tb);
 void tb_flush(CPUState *cpu);
+
+/* TCG instrumentation.  It is decided when a TB is translated, so
+ * changing it flushes the translation cache; while disabled it does not
+ * cost anything in the generated code.
+ */
+#define TCG_INSTRUMENT_TB_COUNT  (1 << 0)   /* count TB executions */
+#define TCG_INSTRUMENT_MEM       (1 << 1)   /* call back on guest accesses */
+
+extern int tcg_instrument;
+
+/* Called before each guest memory access, @info is encoded as in
+ * trace/mem.h.
+ */
+typedef void TCGMemAccessFunc(CPUState *cpu, target_ulong vaddr,
+                              uint8_t info, void *opaque);
+
+void tcg_instrument_tb_count(bool enable);
+void tcg_instrument_mem(TCGMemAccessFunc *func, void *opaque);
+
+/* Translation ahead of execution, see accel/tcg/tb-prefetch.c */
+#define TB_PREFETCH_MAX_THREADS 64
+
+extern bool tb_prefetch_active;
+
+static inline bool tb_prefetch_enabled(void)
+{
+    return atomic_read(&tb_prefetch_active);
+}
+
+void tb_prefetch_add_thread(CPUState *cpu);
+void tb_prefetch(CPUState *cpu, target_ulong pc, TranslationBlock *from);
+void tb_prefetch_wait(target_ulong pc, target_ulong cs_base, uint32_t flags,
+                      uint32_t cflags);
+#ifdef CONFIG_USER_ONLY
+void tb_prefetch_fork_start(void);
+void tb_prefetch_fork_end(int child);
+#else
+CPUState *tb_prefetch_copy_cpu(CPUState *cpu);
+#endif
 void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr);
 TranslationBlock *tb_htable_lookup(CPUState *cpu, target_ulong pc,
                                    target_ulong cs_base, uint32_t flags,
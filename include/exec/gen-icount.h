@@ -41,6 +41,18 @@ static inline void gen_tb_start(TranslationBlock *tb)
     }
 
     tcg_temp_free_i32(count);
+
+    if (unlikely(atomic_read(&tcg_instrument) & TCG_INSTRUMENT_TB_COUNT)) {
+        /* Not atomic: concurrent vCPUs may lose an increment now and then */
+        TCGv_ptr ptr = tcg_const_ptr(&tb->exec_count);
+        TCGv_i64 cnt = tcg_temp_new_i64();
+
+        tcg_gen_ld_i64(cnt, ptr, 0);
+        tcg_gen_addi_i64(cnt, cnt, 1);
+        tcg_gen_st_i64(cnt, ptr, 0);
+        tcg_temp_free_i64(cnt);
+        tcg_temp_free_ptr(ptr);
+    }
 }
 
 static inline void gen_tb_end(TranslationBlock *tb, int num_insns)
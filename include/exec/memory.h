@@ -340,6 +340,8 @@ struct FlatView {
     unsigned nr_allocated;
     struct AddressSpaceDispatch *dispatch;
     MemoryRegion *root;
+    /* Ranges to re-render at the end of the current transaction */
+    GArray *dirty;
 };
 
 static inline FlatView *address_space_to_flatview(AddressSpace *as)
@@ -1131,6 +1133,21 @@ bool memory_region_get_dirty(MemoryRegion *mr, hwaddr addr,
 void memory_region_set_dirty(MemoryRegion *mr, hwaddr addr,
                              hwaddr size);
 
+/**
+ * memory_region_invalidate_and_set_dirty: Mark a range of bytes as dirty
+ *                                         after writing to it directly.
+ *
+ * Like memory_region_set_dirty(), but also invalidates the translated code
+ * in the range, as address_space_write() and address_space_unmap() do.
+ * Use it for RAM that a device writes through a host pointer.
+ *
+ * @mr: the memory region being dirtied.
+ * @addr: the address (relative to the start of the region) being dirtied.
+ * @size: size of the range being dirtied.
+ */
+void memory_region_invalidate_and_set_dirty(MemoryRegion *mr, hwaddr addr,
+                                            hwaddr size);
+
 /**
  * memory_region_snapshot_and_clear_dirty: Get a snapshot of the dirty
  *                                         bitmap and clear it.
@@ -39,6 +39,8 @@ struct TBContext {
     /* statistics */
     unsigned tb_flush_count;
     int tb_phys_invalidate_count;
+    /* TBs run with all other vCPUs stopped, see cpu_exec_step_atomic() */
+    unsigned serial_exec_count;
 };
 
 extern TBContext tb_ctx;
@@ -57,6 +57,14 @@ static inline unsigned int tb_jmp_cache_hash_func(target_ulong pc)
 
 #endif /* CONFIG_SOFTMMU */
 
+/* @src is the host return address of the lookup helper, unique for each
+   lookup site in the generated code.  */
+static inline unsigned int tb_ibtc_hash_func(uintptr_t src, target_ulong pc)
+{
+    uintptr_t tmp = (src >> 2) ^ pc ^ (pc >> TB_IBTC_BITS);
+    return (tmp ^ (tmp >> TB_IBTC_BITS)) & (TB_IBTC_SIZE - 1);
+}
+
 static inline
 uint32_t tb_hash_func(tb_page_addr_t phys_pc, target_ulong pc, uint32_t flags,
                       uint32_t cf_mask, uint32_t trace_vcpu_dstate)
@@ -16,6 +16,19 @@
 #include "exec/exec-all.h"
 #include "exec/tb-hash.h"
 
+/* Check that a cached @tb can run with the current CPU state */
+static inline bool tb_lookup_cmp(const TranslationBlock *tb, CPUState *cpu,
+                                 target_ulong pc, target_ulong cs_base,
+                                 uint32_t flags, uint32_t cf_mask)
+{
+    return tb &&
+           tb->pc == pc &&
+           tb->cs_base == cs_base &&
+           tb->flags == flags &&
+           tb->trace_vcpu_dstate == *cpu->trace_dstate &&
+           (tb_cflags(tb) & (CF_HASH_MASK | CF_INVALID)) == cf_mask;
+}
+
 /* Might cause an exception, so have a longjmp destination ready */
 static inline TranslationBlock *
 tb_lookup__cpu_state(CPUState *cpu, target_ulong *pc, target_ulong *cs_base,
@@ -28,12 +41,7 @@ tb_lookup__cpu_state(CPUState *cpu, target_ulong *pc, target_ulong *cs_base,
     cpu_get_tb_cpu_state(env, pc, cs_base, flags);
     hash = tb_jmp_cache_hash_func(*pc);
     tb = atomic_rcu_read(&cpu->tb_jmp_cache[hash]);
-    if (likely(tb &&
-               tb->pc == *pc &&
-               tb->cs_base == *cs_base &&
-               tb->flags == *flags &&
-               tb->trace_vcpu_dstate == *cpu->trace_dstate &&
-               (tb_cflags(tb) & (CF_HASH_MASK | CF_INVALID)) == cf_mask)) {
+    if (likely(tb_lookup_cmp(tb, cpu, *pc, *cs_base, *flags, cf_mask))) {
         return tb;
     }
     tb = tb_htable_lookup(cpu, *pc, *cs_base, *flags, cf_mask);
@@ -59,6 +59,8 @@ typedef enum DisasJumpType {
  * @is_jmp: What instruction to disassemble next.
  * @num_insns: Number of translated instructions (including current).
  * @singlestep_enabled: "Hardware" single stepping enabled.
+ * @jmp_dest: Static successors of this TB, see translator_note_jmp_dest().
+ * @jmp_dest_mask: Which entries of @jmp_dest are valid.
  *
  * Architecture-agnostic disassembly context.
  */
@@ -69,6 +71,8 @@ typedef struct DisasContextBase {
     DisasJumpType is_jmp;
     unsigned int num_insns;
     bool singlestep_enabled;
+    target_ulong jmp_dest[2];
+    unsigned int jmp_dest_mask;
 } DisasContextBase;
 
 /**
@@ -141,4 +145,20 @@ void translator_loop(const TranslatorOps *ops, DisasContextBase *db,
 
 void translator_loop_temp_check(DisasContextBase *db);
 
+/**
+ * translator_note_jmp_dest:
+ * @db: Disassembly context
+ * @n: Jump slot, as for tcg_gen_goto_tb()
+ * @dest: Guest PC of the jump target
+ *
+ * Record a static successor of the TB.  It is only a hint, used to
+ * translate successors ahead of time (see tb_prefetch_add_thread()).
+ */
+static inline void translator_note_jmp_dest(DisasContextBase *db, int n,
+                                            target_ulong dest)
+{
+    db->jmp_dest[n] = dest;
+    db->jmp_dest_mask |= 1 << n;
+}
+
 #endif  /* EXEC__TRANSLATOR_H */
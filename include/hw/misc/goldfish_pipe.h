@@ -40,6 +40,7 @@ typedef enum {
     GOLDFISH_PIPE_WAKE_READ = (1 << 1),       /* pipe can now be read from */
     GOLDFISH_PIPE_WAKE_WRITE = (1 << 2),      /* pipe can now be written to */
     GOLDFISH_PIPE_WAKE_UNLOCK_DMA  = (1 << 3),/* unlock this pipe's DMA buffer */
+    GOLDFISH_PIPE_WAKE_RING = (1 << 4),       /* ring descriptors completed */
 } GoldfishPipeWakeFlags;
 
 /* List of error values possibly returned by guest_recv() and
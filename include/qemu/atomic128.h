@@ -0,0 +1,39 @@
+/*
+ * Simple interface for 128-bit atomic operations.
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#ifndef QEMU_ATOMIC128_H
+#define QEMU_ATOMIC128_H
+
+#include "qemu/int128.h"
+
+/*
+ * GCC expands the 16-byte __atomic builtins inline only on some hosts;
+ * where it does, configure sets CONFIG_ATOMIC128.  On x86_64 they become
+ * calls into libatomic, which may take a lock, while the legacy __sync
+ * compare-and-swap is expanded to cmpxchg16b with -mcx16.  configure
+ * checks for the latter as CONFIG_CMPXCHG128.
+ *
+ * Callers test HAVE_CMPXCHG128 and otherwise fall back to serial
+ * execution with cpu_loop_exit_atomic().
+ */
+#if defined(CONFIG_ATOMIC128)
+static inline Int128 atomic16_cmpxchg(Int128 *ptr, Int128 cmp, Int128 new)
+{
+    return atomic_cmpxchg__nocheck(ptr, cmp, new);
+}
+# define HAVE_CMPXCHG128 1
+#elif defined(CONFIG_CMPXCHG128)
+static inline Int128 atomic16_cmpxchg(Int128 *ptr, Int128 cmp, Int128 new)
+{
+    return __sync_val_compare_and_swap_16(ptr, cmp, new);
+}
+# define HAVE_CMPXCHG128 1
+#else
+# define HAVE_CMPXCHG128 0
+#endif
+
+#endif /* QEMU_ATOMIC128_H */
@@ -255,6 +255,27 @@ struct hax_vcpu_state;
 #define TB_JMP_CACHE_BITS 12
 #define TB_JMP_CACHE_SIZE (1 << TB_JMP_CACHE_BITS)
 
+/* Indirect branch target cache, indexed by the lookup site in the
+ * generated code and the target PC; see helper_lookup_tb_ptr().
+ * Entries whose gen differs from tb_ibtc_gen are stale.
+ */
+#define TB_IBTC_BITS 10
+#define TB_IBTC_SIZE (1 << TB_IBTC_BITS)
+
+typedef struct TBIndirectCacheEntry {
+    uintptr_t src;
+    struct TranslationBlock *tb;
+    unsigned int gen;
+} TBIndirectCacheEntry;
+
+/* Where indirect branch lookups were resolved */
+typedef struct TBLookupStats {
+    uint64_t ibtc_hit;
+    uint64_t jmp_cache_hit;
+    uint64_t htable_hit;
+    uint64_t miss;
+} TBLookupStats;
+
 /* work queue */
 
 /* The union type allows passing of 64 bit target pointers on 32 bit
@@ -295,6 +316,8 @@ struct qemu_work_item;
  * @stopped: Indicates the CPU has been artificially stopped.
  * @unplug: Indicates a pending CPU unplug request.
  * @crash_occurred: Indicates the OS reported a crash (panic) for this CPU
+ * @tb_prefetch_worker: This is a private copy of a CPU that only translates
+ * code ahead of a vCPU, see tb_prefetch_add_thread().
  * @singlestep_enabled: Flags for single-stepping.
  * @icount_extra: Instructions until next timer event.
  * @icount_decr: Low 16 bits: number of cycles left, only used in icount mode.
@@ -352,6 +375,7 @@ struct CPUState {
     bool stopped;
     bool unplug;
     bool crash_occurred;
+    bool tb_prefetch_worker;
     bool exit_request;
     uint32_t cflags_next_tb;
     /* updates protected by BQL */
@@ -374,6 +398,11 @@ struct CPUState {
     /* Accessed in parallel; all accesses must be atomic */
     struct TranslationBlock *tb_jmp_cache[TB_JMP_CACHE_SIZE];
 
+    /* Only accessed by the vCPU thread, or while it is stopped */
+    TBIndirectCacheEntry tb_ibtc[TB_IBTC_SIZE];
+    unsigned int tb_ibtc_gen;
+    TBLookupStats tb_lookup_stats;
+
     struct GDBRegisterState *gdb_regs;
     int gdb_num_regs;
     int gdb_num_g_regs;
@@ -454,6 +483,14 @@ extern struct CPUTailQ cpus;
 
 extern __thread CPUState *current_cpu;
 
+static inline void cpu_tb_ibtc_clear(CPUState *cpu)
+{
+    /* A new generation invalidates all entries at once */
+    if (++cpu->tb_ibtc_gen == 0) {
+        memset(cpu->tb_ibtc, 0, sizeof(cpu->tb_ibtc));
+    }
+}
+
 static inline void cpu_tb_jmp_cache_clear(CPUState *cpu)
 {
     unsigned int i;
@@ -461,6 +498,7 @@ static inline void cpu_tb_jmp_cache_clear(CPUState *cpu)
     for (i = 0; i < TB_JMP_CACHE_SIZE; i++) {
         atomic_set(&cpu->tb_jmp_cache[i], NULL);
     }
+    cpu_tb_ibtc_clear(cpu);
 }
 
 /**
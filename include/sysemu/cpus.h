@@ -41,5 +41,6 @@ extern int smp_threads;
 void list_cpus(FILE *f, fprintf_function cpu_fprintf, const char *optarg);
 
 void qemu_tcg_configure(QemuOpts *opts, Error **errp);
+void qemu_tcg_start_prefetch(void);
 
 #endif
@@ -40,6 +40,7 @@
 char *exec_path;
 
 int singlestep;
+static unsigned int tb_prefetch_threads;
 static const char *filename;
 static const char *argv0;
 static int gdbstub_port;
@@ -131,6 +132,7 @@ void fork_start(void)
 {
     mmap_fork_start();
     qemu_mutex_lock(&tb_ctx.tb_lock);
+    tb_prefetch_fork_start();
     cpu_list_lock();
 }
 
@@ -147,12 +149,14 @@ void fork_end(int child)
             }
         }
         qemu_mutex_init(&tb_ctx.tb_lock);
+        tb_prefetch_fork_end(child);
         qemu_init_cpu_list();
         gdbserver_fork(thread_cpu);
         /* qemu_init_cpu_list() takes care of reinitializing the
          * exclusive state, so we don't need to end_exclusive() here.
          */
     } else {
+        tb_prefetch_fork_end(child);
         qemu_mutex_unlock(&tb_ctx.tb_lock);
         cpu_list_unlock();
         end_exclusive();
@@ -4182,6 +4186,17 @@ static void handle_arg_randseed(const char *arg)
     srand(seed);
 }
 
+static void handle_arg_tb_prefetch(const char *arg)
+{
+    unsigned long long n;
+
+    if (parse_uint_full(arg, &n, 0) != 0 || n > TB_PREFETCH_MAX_THREADS) {
+        fprintf(stderr, "Invalid number of translator threads: %s\n", arg);
+        exit(EXIT_FAILURE);
+    }
+    tb_prefetch_threads = n;
+}
+
 static void handle_arg_gdb(const char *arg)
 {
     gdbstub_port = atoi(arg);
@@ -4312,6 +4327,8 @@ static const struct qemu_argument arg_table[] = {
      "pagesize",   "set the host page size to 'pagesize'"},
     {"singlestep", "QEMU_SINGLESTEP",  false, handle_arg_singlestep,
      "",           "run in singlestep mode"},
+    {"tb-prefetch", "QEMU_TB_PREFETCH", true, handle_arg_tb_prefetch,
+     "threads",    "translate branch targets ahead in 'threads' threads"},
     {"strace",     "QEMU_STRACE",      false, handle_arg_strace,
      "",           "log system calls"},
     {"seed",       "QEMU_RAND_SEED",   true,  handle_arg_randseed,
@@ -5085,6 +5102,11 @@ int main(int argc, char **argv, char **envp)
         }
         gdb_handlesig(cpu, 0);
     }
+
+    for (i = 0; i < tb_prefetch_threads; i++) {
+        tb_prefetch_add_thread(ENV_GET_CPU(cpu_copy(env)));
+    }
+
     cpu_loop(env);
     /* never exits */
     return 0;
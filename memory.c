@@ -30,6 +30,7 @@
 #include "exec/ram_addr.h"
 #include "sysemu/kvm.h"
 #include "sysemu/sysemu.h"
+#include "sysemu/qtest.h"
 #include "hw/misc/mmio_interface.h"
 #include "hw/qdev-properties.h"
 #include "migration/vmstate.h"
@@ -38,6 +39,7 @@
 
 static unsigned memory_region_transaction_depth;
 static bool memory_region_update_pending;
+static bool memory_region_update_full;
 static bool ioeventfd_update_pending;
 static bool global_dirty_log = false;
 
@@ -49,6 +51,9 @@ static QTAILQ_HEAD(, AddressSpace) address_spaces
 
 static GHashTable *flat_views;
 
+/* Regions changed in the current transaction, compared by address only */
+static GHashTable *changed_regions;
+
 typedef struct AddrRange AddrRange;
 
 /*
@@ -285,6 +290,9 @@ static void flatview_destroy(FlatView *view)
     if (view->dispatch) {
         address_space_dispatch_free(view->dispatch);
     }
+    if (view->dirty) {
+        g_array_free(view->dirty, true);
+    }
     for (i = 0; i < view->nr; i++) {
         memory_region_unref(view->ranges[i].mr);
     }
@@ -747,10 +755,22 @@ static MemoryRegion *memory_region_get_flatview_root(MemoryRegion *mr)
     return NULL;
 }
 
-/* Render a memory topology into a list of disjoint absolute ranges. */
-static FlatView *generate_memory_topology(MemoryRegion *mr)
+static void flatview_build_dispatch(FlatView *view)
 {
     int i;
+
+    view->dispatch = address_space_dispatch_new(view);
+    for (i = 0; i < view->nr; i++) {
+        MemoryRegionSection mrs =
+            section_from_flat_range(&view->ranges[i], view);
+        flatview_add_to_dispatch(view, &mrs);
+    }
+    address_space_dispatch_compact(view->dispatch);
+}
+
+/* Render a memory topology into a list of disjoint absolute ranges. */
+static FlatView *flatview_render(MemoryRegion *mr)
+{
     FlatView *view;
 
     view = flatview_new(mr);
@@ -760,14 +780,229 @@ static FlatView *generate_memory_topology(MemoryRegion *mr)
                              addrrange_make(int128_zero(), int128_2_64()), false);
     }
     flatview_simplify(view);
+    return view;
+}
 
-    view->dispatch = address_space_dispatch_new(view);
-    for (i = 0; i < view->nr; i++) {
-        MemoryRegionSection mrs =
-            section_from_flat_range(&view->ranges[i], view);
-        flatview_add_to_dispatch(view, &mrs);
+static FlatView *generate_memory_topology(MemoryRegion *mr)
+{
+    FlatView *view;
+
+    view = flatview_render(mr);
+    flatview_build_dispatch(view);
+    g_hash_table_replace(flat_views, mr, view);
+
+    return view;
+}
+
+/* Append to @out the ranges where the changed regions are visible when
+ * @mr is rendered.  These are the regions in @changed, or @changed_mr alone
+ * if @changed is NULL.  This follows the same rules as render_memory_region;
+ * the walk stops at a changed region, whose extent covers its subregions.
+ */
+static void collect_changed_ranges(MemoryRegion *mr,
+                                   Int128 base,
+                                   AddrRange clip,
+                                   MemoryRegion *changed_mr,
+                                   GHashTable *changed,
+                                   GArray *out)
+{
+    MemoryRegion *subregion;
+    AddrRange tmp;
+
+    if (!mr->enabled) {
+        return;
     }
-    address_space_dispatch_compact(view->dispatch);
+
+    int128_addto(&base, int128_make64(mr->addr));
+
+    tmp = addrrange_make(base, mr->size);
+
+    if (!addrrange_intersects(tmp, clip)) {
+        return;
+    }
+
+    clip = addrrange_intersection(tmp, clip);
+
+    if (changed ? g_hash_table_contains(changed, mr) : mr == changed_mr) {
+        g_array_append_val(out, clip);
+        return;
+    }
+
+    if (mr->alias) {
+        int128_subfrom(&base, int128_make64(mr->alias->addr));
+        int128_subfrom(&base, int128_make64(mr->alias_offset));
+        collect_changed_ranges(mr->alias, base, clip, changed_mr, changed, out);
+        return;
+    }
+
+    QTAILQ_FOREACH(subregion, &mr->subregions, subregions_link) {
+        collect_changed_ranges(subregion, base, clip, changed_mr, changed, out);
+    }
+}
+
+static void flatview_collect_changes(gpointer key, gpointer value,
+                                     gpointer user_data)
+{
+    FlatView *view = value;
+    MemoryRegion *mr = user_data;
+
+    if (!view->root) {
+        return;
+    }
+    if (!view->dirty) {
+        view->dirty = g_array_new(false, false, sizeof(AddrRange));
+    }
+    collect_changed_ranges(view->root, int128_zero(),
+                           addrrange_make(int128_zero(), int128_2_64()),
+                           mr, NULL, view->dirty);
+}
+
+/* Remember where @mr is currently visible, so that the next commit only
+ * needs to re-render those ranges.  Call this before @mr is modified; the
+ * ranges covered after the modification are collected at commit time.
+ *
+ * Only the first change to @mr in a transaction is recorded.  Wherever @mr
+ * became visible since then, another recorded change made it so.
+ */
+static void memory_region_record_change(MemoryRegion *mr)
+{
+    if (!flat_views || memory_region_update_full) {
+        return;
+    }
+    if (!changed_regions) {
+        changed_regions = g_hash_table_new(NULL, NULL);
+    }
+    if (g_hash_table_contains(changed_regions, mr)) {
+        return;
+    }
+    g_hash_table_add(changed_regions, mr);
+    g_hash_table_foreach(flat_views, flatview_collect_changes, mr);
+}
+
+static gint addrrange_cmp(gconstpointer a_, gconstpointer b_)
+{
+    const AddrRange *a = a_, *b = b_;
+
+    if (int128_lt(a->start, b->start)) {
+        return -1;
+    }
+    return int128_eq(a->start, b->start) ? 0 : 1;
+}
+
+/* Sort @ranges and merge overlapping or adjacent entries. */
+static void addrrange_array_normalize(GArray *ranges)
+{
+    AddrRange *r;
+    unsigned i, n;
+
+    g_array_sort(ranges, addrrange_cmp);
+    r = (AddrRange *)ranges->data;
+    for (i = 1, n = 0; i < ranges->len; i++) {
+        if (int128_le(r[i].start, addrrange_end(r[n]))) {
+            Int128 end = int128_max(addrrange_end(r[n]), addrrange_end(r[i]));
+            r[n].size = int128_sub(end, r[n].start);
+        } else {
+            r[++n] = r[i];
+        }
+    }
+    if (ranges->len) {
+        g_array_set_size(ranges, n + 1);
+    }
+}
+
+/* Append the part of @fr that starts at @start and ends at @end. */
+static void flatview_append_piece(FlatView *view, FlatRange *fr,
+                                  Int128 start, Int128 end)
+{
+    FlatRange piece = *fr;
+
+    piece.offset_in_region += int128_get64(int128_sub(start, fr->addr.start));
+    piece.addr = addrrange_make(start, int128_sub(end, start));
+    flatview_insert(view, view->nr, &piece);
+}
+
+/* qtest runs check that an incrementally updated @view is the same as the
+ * one a full render gives.
+ */
+static void flatview_check_incremental(FlatView *view)
+{
+    FlatView *full = flatview_render(view->root);
+    bool equal = view->nr == full->nr;
+    unsigned i;
+
+    for (i = 0; equal && i < view->nr; i++) {
+        equal = flatrange_equal(&view->ranges[i], &full->ranges[i]) &&
+            view->ranges[i].dirty_log_mask == full->ranges[i].dirty_log_mask;
+    }
+    if (!equal) {
+        error_report("incremental FlatView of %s differs from a full render",
+                     memory_region_name(view->root));
+        abort();
+    }
+    flatview_unref(full);
+}
+
+/* Build a new view for @old->root that reuses the ranges of @old outside
+ * @old->dirty and renders the rest again.  If nothing visible changed,
+ * @old itself is returned.  The result is stored into flat_views.
+ */
+static FlatView *flatview_update_incremental(FlatView *old)
+{
+    MemoryRegion *mr = old->root;
+    GArray *dirty = old->dirty;
+    AddrRange *d;
+    FlatView *view;
+    unsigned i, j, k;
+
+    if (mr && changed_regions) {
+        if (!dirty) {
+            dirty = old->dirty = g_array_new(false, false, sizeof(AddrRange));
+        }
+        collect_changed_ranges(mr, int128_zero(),
+                               addrrange_make(int128_zero(), int128_2_64()),
+                               NULL, changed_regions, dirty);
+    }
+    if (!dirty || !dirty->len) {
+        flatview_ref(old);
+        g_hash_table_replace(flat_views, mr, old);
+        if (qtest_enabled()) {
+            flatview_check_incremental(old);
+        }
+        return old;
+    }
+
+    addrrange_array_normalize(dirty);
+    d = (AddrRange *)dirty->data;
+
+    view = flatview_new(mr);
+    for (i = 0, j = 0; i < old->nr; i++) {
+        FlatRange *fr = &old->ranges[i];
+        Int128 cur = fr->addr.start;
+        Int128 end = addrrange_end(fr->addr);
+
+        while (j < dirty->len && int128_le(addrrange_end(d[j]), cur)) {
+            j++;
+        }
+        for (k = j; k < dirty->len && int128_lt(d[k].start, end); k++) {
+            if (int128_lt(cur, d[k].start)) {
+                flatview_append_piece(view, fr, cur, d[k].start);
+            }
+            cur = int128_max(cur, addrrange_end(d[k]));
+        }
+        if (int128_lt(cur, end)) {
+            flatview_append_piece(view, fr, cur, end);
+        }
+    }
+
+    /* All of the dirty ranges are now gaps in the view.  */
+    for (k = 0; k < dirty->len; k++) {
+        render_memory_region(view, mr, int128_zero(), d[k], false);
+    }
+    flatview_simplify(view);
+    if (qtest_enabled()) {
+        flatview_check_incremental(view);
+    }
+    flatview_build_dispatch(view);
     g_hash_table_replace(flat_views, mr, view);
 
     return view;
@@ -980,7 +1215,67 @@ static void flatviews_reset(void)
     }
 }
 
-static void address_space_set_flatview(AddressSpace *as)
+/* Like flatviews_reset, but only re-render the ranges that were recorded
+ * by memory_region_record_change.  Views that did not change are kept, so
+ * address spaces using them see no update at all.
+ */
+static void flatviews_update(void)
+{
+    GHashTable *old_views = flat_views;
+    AddressSpace *as;
+
+    if (!old_views || memory_region_update_full) {
+        flatviews_reset();
+        return;
+    }
+
+    flat_views = NULL;
+    flatviews_init();
+
+    QTAILQ_FOREACH(as, &address_spaces, address_spaces_link) {
+        MemoryRegion *physmr = memory_region_get_flatview_root(as->root);
+        FlatView *old;
+
+        if (g_hash_table_lookup(flat_views, physmr)) {
+            continue;
+        }
+
+        old = g_hash_table_lookup(old_views, physmr);
+        if (old) {
+            flatview_update_incremental(old);
+        } else {
+            generate_memory_topology(physmr);
+        }
+    }
+
+    g_hash_table_unref(old_views);
+}
+
+static void flatview_clear_changes(gpointer key, gpointer value,
+                                   gpointer user_data)
+{
+    FlatView *view = value;
+
+    if (view->dirty) {
+        g_array_free(view->dirty, true);
+        view->dirty = NULL;
+    }
+}
+
+static void memory_region_clear_changes(void)
+{
+    if (flat_views) {
+        g_hash_table_foreach(flat_views, flatview_clear_changes, NULL);
+    }
+    if (changed_regions) {
+        g_hash_table_destroy(changed_regions);
+        changed_regions = NULL;
+    }
+    memory_region_update_full = false;
+}
+
+/* Returns true if @as now uses a different FlatView.  */
+static bool address_space_set_flatview(AddressSpace *as)
 {
     FlatView *old_view = address_space_to_flatview(as);
     MemoryRegion *physmr = memory_region_get_flatview_root(as->root);
@@ -989,7 +1284,7 @@ static void address_space_set_flatview(AddressSpace *as)
     assert(new_view);
 
     if (old_view == new_view) {
-        return;
+        return false;
     }
 
     if (old_view) {
@@ -1023,6 +1318,7 @@ static void address_space_set_flatview(AddressSpace *as)
     if (old_view) {
         flatview_unref(old_view);
     }
+    return true;
 }
 
 static void address_space_update_topology(AddressSpace *as)
@@ -1052,13 +1348,15 @@ void memory_region_transaction_commit(void)
     --memory_region_transaction_depth;
     if (!memory_region_transaction_depth) {
         if (memory_region_update_pending) {
-            flatviews_reset();
+            flatviews_update();
 
             MEMORY_LISTENER_CALL_GLOBAL(begin, Forward);
 
             QTAILQ_FOREACH(as, &address_spaces, address_spaces_link) {
-                address_space_set_flatview(as);
-                address_space_update_ioeventfds(as);
+                if (address_space_set_flatview(as) ||
+                    ioeventfd_update_pending) {
+                    address_space_update_ioeventfds(as);
+                }
             }
             memory_region_update_pending = false;
             ioeventfd_update_pending = false;
@@ -1069,6 +1367,7 @@ void memory_region_transaction_commit(void)
             }
             ioeventfd_update_pending = false;
         }
+        memory_region_clear_changes();
    }
 }
 
@@ -1927,6 +2226,7 @@ void memory_region_set_log(MemoryRegion *mr, bool log, unsigned client)
     }
 
     memory_region_transaction_begin();
+    memory_region_record_change(mr);
     mr->dirty_log_mask = (mr->dirty_log_mask & ~mask) | (log * mask);
     memory_region_update_pending |= mr->enabled;
     memory_region_transaction_commit();
@@ -2000,6 +2300,7 @@ void memory_region_set_readonly(MemoryRegion *mr, bool readonly)
 {
     if (mr->readonly != readonly) {
         memory_region_transaction_begin();
+        memory_region_record_change(mr);
         mr->readonly = readonly;
         memory_region_update_pending |= mr->enabled;
         memory_region_transaction_commit();
@@ -2010,6 +2311,7 @@ void memory_region_rom_device_set_romd(MemoryRegion *mr, bool romd_mode)
 {
     if (mr->romd_mode != romd_mode) {
         memory_region_transaction_begin();
+        memory_region_record_change(mr);
         mr->romd_mode = romd_mode;
         memory_region_update_pending |= mr->enabled;
         memory_region_transaction_commit();
@@ -2276,6 +2578,7 @@ static void memory_region_update_container_subregions(MemoryRegion *subregion)
     }
     QTAILQ_INSERT_TAIL(&mr->subregions, subregion, subregions_link);
 done:
+    memory_region_record_change(subregion);
     memory_region_update_pending |= mr->enabled && subregion->enabled;
     memory_region_transaction_commit();
 }
@@ -2312,6 +2615,7 @@ void memory_region_del_subregion(MemoryRegion *mr,
 {
     memory_region_transaction_begin();
     assert(subregion->container == mr);
+    memory_region_record_change(subregion);
     subregion->container = NULL;
     QTAILQ_REMOVE(&mr->subregions, subregion, subregions_link);
     memory_region_unref(subregion);
@@ -2325,6 +2629,7 @@ void memory_region_set_enabled(MemoryRegion *mr, bool enabled)
         return;
     }
     memory_region_transaction_begin();
+    memory_region_record_change(mr);
     mr->enabled = enabled;
     memory_region_update_pending = true;
     memory_region_transaction_commit();
@@ -2341,6 +2646,7 @@ void memory_region_set_size(MemoryRegion *mr, uint64_t size)
         return;
     }
     memory_region_transaction_begin();
+    memory_region_record_change(mr);
     mr->size = s;
     memory_region_update_pending = true;
     memory_region_transaction_commit();
@@ -2364,6 +2670,7 @@ static void memory_region_readd_subregion(MemoryRegion *mr)
 void memory_region_set_address(MemoryRegion *mr, hwaddr addr)
 {
     if (addr != mr->addr) {
+        memory_region_record_change(mr);
         mr->addr = addr;
         memory_region_readd_subregion(mr);
     }
@@ -2378,6 +2685,7 @@ void memory_region_set_alias_offset(MemoryRegion *mr, hwaddr offset)
     }
 
     memory_region_transaction_begin();
+    memory_region_record_change(mr);
     mr->alias_offset = offset;
     memory_region_update_pending |= mr->enabled;
     memory_region_transaction_commit();
@@ -2503,6 +2811,7 @@ void memory_global_dirty_log_start(void)
     /* Refresh DIRTY_LOG_MIGRATION bit.  */
     memory_region_transaction_begin();
     memory_region_update_pending = true;
+    memory_region_update_full = true;
     memory_region_transaction_commit();
 }
 
@@ -2513,6 +2822,7 @@ static void memory_global_dirty_log_do_stop(void)
     /* Refresh DIRTY_LOG_MIGRATION bit.  */
     memory_region_transaction_begin();
     memory_region_update_pending = true;
+    memory_region_update_full = true;
     memory_region_transaction_commit();
 
     MEMORY_LISTENER_CALL_GLOBAL(log_global_stop, Reverse);
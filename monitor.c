@@ -1407,6 +1407,34 @@ static void hmp_info_opcount(Monitor *mon, const QDict *qdict)
 {
     dump_opcount_info((FILE *)mon, monitor_fprintf);
 }
+
+static void hmp_info_tb_hot(Monitor *mon, const QDict *qdict)
+{
+    if (!tcg_enabled()) {
+        error_report("TB information is only available with accel=tcg");
+        return;
+    }
+
+    dump_tb_hot_info((FILE *)mon, monitor_fprintf,
+                     qdict_get_try_int(qdict, "count", 10));
+}
+
+static void hmp_tb_count(Monitor *mon, const QDict *qdict)
+{
+    const char *option = qdict_get_try_str(qdict, "option");
+
+    if (!tcg_enabled()) {
+        error_report("TB counting is only available with accel=tcg");
+        return;
+    }
+    if (!option || !strcmp(option, "on")) {
+        tcg_instrument_tb_count(true);
+    } else if (!strcmp(option, "off")) {
+        tcg_instrument_tb_count(false);
+    } else {
+        monitor_printf(mon, "unexpected option %s\n", option);
+    }
+}
 #endif
 
 static void hmp_info_history(Monitor *mon, const QDict *qdict)
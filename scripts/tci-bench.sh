@@ -0,0 +1,66 @@
+#!/bin/sh
+#
+# Compare the speed of the TCG interpreter with and without threaded
+# dispatch and superinstructions, by booting a guest kernel until it
+# powers off.
+#
+# Usage: tci-bench.sh <target> <kernel> [extra qemu args...]
+#
+# for example
+#
+#   scripts/tci-bench.sh x86_64 bzImage -initrd initrd.img
+#
+# The guest must shut down by itself; the kernel is booted with
+# "panic=-1" and -no-reboot, so an init that exits is enough.
+#
+# This code is licensed under the GPL version 2 or later.  See
+# the COPYING file in the top-level directory.
+
+error() {
+    printf %s\\n "$*" >&2
+    exit 1
+}
+
+if test $# -lt 2; then
+    error "Usage: $0 <target> <kernel> [extra qemu args...]"
+fi
+
+target="$1"
+kernel="$2"
+shift 2
+
+src_dir=$(cd "$(dirname "$0")/.." && pwd)
+bench_dir=${TCI_BENCH_DIR:-$(pwd)/tci-bench}
+runs=${TCI_BENCH_RUNS:-3}
+jobs=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)
+
+build() {
+    name="$1"
+    shift
+    mkdir -p "$bench_dir/$name" || exit 1
+    (cd "$bench_dir/$name" &&
+     "$src_dir/configure" --target-list="$target-softmmu" \
+         --enable-tcg-interpreter --disable-werror "$@" >/dev/null &&
+     make -j"$jobs" >/dev/null) || error "build of $name failed"
+}
+
+run() {
+    name="$1"
+    shift
+    qemu="$bench_dir/$name/$target-softmmu/qemu-system-$target"
+    i=0
+    while test $i -lt $runs; do
+        start=$(date +%s.%N)
+        "$qemu" -nographic -no-reboot -kernel "$kernel" \
+            -append "console=ttyS0 panic=-1" "$@" >/dev/null 2>&1 </dev/null
+        end=$(date +%s.%N)
+        echo "$name: $(echo "$end - $start" | bc) s"
+        i=$((i + 1))
+    done
+}
+
+build switch --extra-cflags="-DTCI_SWITCH_DISPATCH -DTCI_NO_FUSE"
+build threaded
+
+run switch "$@"
+run threaded "$@"
@@ -111,6 +111,8 @@ enum {
 #define ARM_CPU_VFIQ 3
 
 #define NB_MMU_MODES 8
+/* Number of translation table pages remembered by the page table walker */
+#define ARM_PTW_CACHE_SIZE 16
 /* ARM-specific extra insn start words:
  * 1: Conditional execution bits
  * 2: Partial exception syndrome for data aborts
@@ -535,6 +537,13 @@ typedef struct CPUARMState {
         int vec_len;
         int vec_stride;
 
+        /* The cumulative saturation flag, FPSCR.QC.  It is kept apart
+         * from xregs[ARM_VFP_FPSCR] as a vector so that inline vector
+         * code can OR in a per-element saturation mask; QC is set if
+         * any bit in the array is nonzero.
+         */
+        uint32_t qc[4] QEMU_ALIGNED(16);
+
         /* scratch space when Tn are not sufficient.  */
         uint32_t scratch[8];
 
@@ -586,6 +595,22 @@ typedef struct CPUARMState {
     struct CPUBreakpoint *cpu_breakpoint[16];
     struct CPUWatchpoint *cpu_watchpoint[16];
 
+#if !defined(CONFIG_USER_ONLY)
+    /* Host addresses of recently walked translation table pages, so that
+     * descriptor loads can skip the memory dispatch.  Only valid while
+     * tlb_flush_count matches that of the softmmu TLB.  Only used from
+     * the vCPU thread.
+     */
+    struct {
+        size_t tlb_flush_count;
+        struct {
+            hwaddr page;
+            void *host;
+            bool secure;
+        } entry[ARM_PTW_CACHE_SIZE];
+    } ptw_cache;
+#endif
+
     /* Fields up to this point are cleared by a CPU reset */
     struct {} end_reset_fields;
 
@@ -1227,6 +1252,7 @@ void vfp_set_fpscr(CPUARMState *env, uint32_t val);
 #define FPSR_MASK 0xf800009f
 #define FPCR_MASK 0x07f79f00
 
+#define FPSR_QC     (1 << 27)   /* Cumulative saturation bit */
 #define FPCR_FZ16   (1 << 19)   /* ARMv8.2+, FP16 flush-to-zero */
 #define FPCR_FZ     (1 << 24)   /* Flush-to-zero enable bit */
 #define FPCR_DN     (1 << 25)   /* Default NaN enable bit */
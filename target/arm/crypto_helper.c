@@ -15,6 +15,7 @@
 #include "exec/exec-all.h"
 #include "exec/helper-proto.h"
 #include "crypto/aes.h"
+#include "elf.h"
 
 union CRYPTO_STATE {
     uint8_t    bytes[16];
@@ -30,6 +31,279 @@ union CRYPTO_STATE {
 #define CR_ST_WORD(state, i)   (state.words[i])
 #endif
 
+/*
+ * Host accelerated versions
+ *
+ * When the host has AES and SHA instructions of its own, the helpers use
+ * them instead of the table driven code above.  The choice is made once
+ * at startup; see crypto_accel_init().
+ */
+static unsigned crypto_accel;
+
+#ifdef CONFIG_CRYPTO_OPT
+#if defined(__x86_64__) || defined(__i386__)
+#pragma GCC push_options
+#pragma GCC target("aes,sha,sse4.1")
+#include <immintrin.h>
+#include "qemu/cpuid.h"
+
+#define CRYPTO_ACCEL_AES   1
+#define CRYPTO_ACCEL_SHA   2
+
+/*
+ * The x86 instructions fold the round key into the end of the round
+ * rather than the start, and have no bare (Inv)MixColumns, so AESE/AESD
+ * xor the key up front and use the "last round" forms with a zero key.
+ * MixColumns(x) is obtained as AESENC(AESDECLAST(x, 0), 0) since the
+ * byte substitutions and row shifts cancel out.
+ */
+static void crypto_aese_accel(uint64_t *rd, uint64_t *rm, uint32_t decrypt)
+{
+    __m128i st = _mm_loadu_si128((__m128i *)rd);
+    __m128i zero = _mm_setzero_si128();
+
+    st = _mm_xor_si128(st, _mm_loadu_si128((__m128i *)rm));
+    if (decrypt) {
+        st = _mm_aesdeclast_si128(st, zero);
+    } else {
+        st = _mm_aesenclast_si128(st, zero);
+    }
+    _mm_storeu_si128((__m128i *)rd, st);
+}
+
+static void crypto_aesmc_accel(uint64_t *rd, uint64_t *rm, uint32_t decrypt)
+{
+    __m128i st = _mm_loadu_si128((__m128i *)rm);
+    __m128i zero = _mm_setzero_si128();
+
+    if (decrypt) {
+        st = _mm_aesimc_si128(st);
+    } else {
+        st = _mm_aesenc_si128(_mm_aesdeclast_si128(st, zero), zero);
+    }
+    _mm_storeu_si128((__m128i *)rd, st);
+}
+
+/*
+ * The x86 SHA instructions keep the state words in the opposite order to
+ * the Arm ones, and SHA1RNDS4 adds the round constant itself whereas the
+ * Arm instructions expect it to be included in the schedule words.
+ */
+#define REVERSE_WORDS 0x1b
+
+static void crypto_sha1_3reg_accel(uint64_t *rd, uint64_t *rn, uint64_t *rm,
+                                   uint32_t op)
+{
+    static const uint32_t k[3] = { 0x5a827999, 0x6ed9eba1, 0x8f1bbcdc };
+    __m128i d = _mm_shuffle_epi32(_mm_loadu_si128((__m128i *)rd),
+                                  REVERSE_WORDS);
+    __m128i m = _mm_shuffle_epi32(_mm_loadu_si128((__m128i *)rm),
+                                  REVERSE_WORDS);
+    uint32_t e = (uint32_t)rn[0];
+
+    m = _mm_sub_epi32(m, _mm_set1_epi32(k[op]));
+    m = _mm_add_epi32(m, _mm_set_epi32(e, 0, 0, 0));
+    switch (op) {
+    case 0: /* sha1c */
+        d = _mm_sha1rnds4_epu32(d, m, 0);
+        break;
+    case 1: /* sha1p */
+        d = _mm_sha1rnds4_epu32(d, m, 1);
+        break;
+    case 2: /* sha1m */
+        d = _mm_sha1rnds4_epu32(d, m, 2);
+        break;
+    default:
+        g_assert_not_reached();
+    }
+    _mm_storeu_si128((__m128i *)rd, _mm_shuffle_epi32(d, REVERSE_WORDS));
+}
+
+static void crypto_sha1su1_accel(uint64_t *rd, uint64_t *rm)
+{
+    __m128i d = _mm_shuffle_epi32(_mm_loadu_si128((__m128i *)rd),
+                                  REVERSE_WORDS);
+    __m128i m = _mm_shuffle_epi32(_mm_loadu_si128((__m128i *)rm),
+                                  REVERSE_WORDS);
+
+    d = _mm_sha1msg2_epu32(d, m);
+    _mm_storeu_si128((__m128i *)rd, _mm_shuffle_epi32(d, REVERSE_WORDS));
+}
+
+/*
+ * Run four SHA-256 rounds as two SHA256RNDS2, which work on the state
+ * split as ABEF and CDGH rather than ABCD and EFGH.
+ */
+static void crypto_sha256_rounds_accel(uint64_t *abcd_p, uint64_t *efgh_p,
+                                       uint64_t *wk_p, __m128i *abcd,
+                                       __m128i *efgh)
+{
+    __m128i dcba = _mm_shuffle_epi32(_mm_loadu_si128((__m128i *)abcd_p),
+                                     REVERSE_WORDS);
+    __m128i hgfe = _mm_shuffle_epi32(_mm_loadu_si128((__m128i *)efgh_p),
+                                     REVERSE_WORDS);
+    __m128i wk = _mm_loadu_si128((__m128i *)wk_p);
+    __m128i abef = _mm_unpackhi_epi64(hgfe, dcba);
+    __m128i cdgh = _mm_unpacklo_epi64(hgfe, dcba);
+
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(wk, 0x0e));
+
+    *abcd = _mm_shuffle_epi32(_mm_unpackhi_epi64(cdgh, abef), REVERSE_WORDS);
+    *efgh = _mm_shuffle_epi32(_mm_unpacklo_epi64(cdgh, abef), REVERSE_WORDS);
+}
+
+static void crypto_sha256h_accel(uint64_t *rd, uint64_t *rn, uint64_t *rm)
+{
+    __m128i abcd, efgh;
+
+    crypto_sha256_rounds_accel(rd, rn, rm, &abcd, &efgh);
+    _mm_storeu_si128((__m128i *)rd, abcd);
+}
+
+static void crypto_sha256h2_accel(uint64_t *rd, uint64_t *rn, uint64_t *rm)
+{
+    __m128i abcd, efgh;
+
+    crypto_sha256_rounds_accel(rn, rd, rm, &abcd, &efgh);
+    _mm_storeu_si128((__m128i *)rd, efgh);
+}
+
+static void crypto_sha256su0_accel(uint64_t *rd, uint64_t *rm)
+{
+    __m128i d = _mm_loadu_si128((__m128i *)rd);
+    __m128i m = _mm_loadu_si128((__m128i *)rm);
+
+    _mm_storeu_si128((__m128i *)rd, _mm_sha256msg1_epu32(d, m));
+}
+
+static void crypto_sha256su1_accel(uint64_t *rd, uint64_t *rn, uint64_t *rm)
+{
+    __m128i d = _mm_loadu_si128((__m128i *)rd);
+    __m128i n = _mm_loadu_si128((__m128i *)rn);
+    __m128i m = _mm_loadu_si128((__m128i *)rm);
+
+    /* W[t-7] for the four new words is n[1..3]:m[0] */
+    d = _mm_add_epi32(d, _mm_alignr_epi8(m, n, 4));
+    _mm_storeu_si128((__m128i *)rd, _mm_sha256msg2_epu32(d, m));
+}
+
+#pragma GCC pop_options
+
+static void __attribute__((constructor)) crypto_accel_init(void)
+{
+    int max = __get_cpuid_max(0, NULL);
+    int a, b, c, d;
+
+    if (max >= 1) {
+        __cpuid(1, a, b, c, d);
+        if (c & bit_AES) {
+            crypto_accel |= CRYPTO_ACCEL_AES;
+        }
+        if (max >= 7 && (c & bit_SSE4_1)) {
+            __cpuid_count(7, 0, a, b, c, d);
+            if (b & bit_SHA) {
+                crypto_accel |= CRYPTO_ACCEL_SHA;
+            }
+        }
+    }
+}
+
+#elif defined(__aarch64__) && !defined(HOST_WORDS_BIGENDIAN)
+#pragma GCC push_options
+#pragma GCC target("+crypto")
+#include <arm_neon.h>
+
+#define CRYPTO_ACCEL_AES   1
+#define CRYPTO_ACCEL_SHA   2
+
+static void crypto_aese_accel(uint64_t *rd, uint64_t *rm, uint32_t decrypt)
+{
+    uint8x16_t st = vld1q_u8((uint8_t *)rd);
+    uint8x16_t rk = vld1q_u8((uint8_t *)rm);
+
+    vst1q_u8((uint8_t *)rd, decrypt ? vaesdq_u8(st, rk) : vaeseq_u8(st, rk));
+}
+
+static void crypto_aesmc_accel(uint64_t *rd, uint64_t *rm, uint32_t decrypt)
+{
+    uint8x16_t st = vld1q_u8((uint8_t *)rm);
+
+    vst1q_u8((uint8_t *)rd, decrypt ? vaesimcq_u8(st) : vaesmcq_u8(st));
+}
+
+static void crypto_sha1_3reg_accel(uint64_t *rd, uint64_t *rn, uint64_t *rm,
+                                   uint32_t op)
+{
+    uint32x4_t d = vld1q_u32((uint32_t *)rd);
+    uint32x4_t m = vld1q_u32((uint32_t *)rm);
+    uint32_t e = (uint32_t)rn[0];
+
+    switch (op) {
+    case 0: /* sha1c */
+        d = vsha1cq_u32(d, e, m);
+        break;
+    case 1: /* sha1p */
+        d = vsha1pq_u32(d, e, m);
+        break;
+    case 2: /* sha1m */
+        d = vsha1mq_u32(d, e, m);
+        break;
+    default:
+        g_assert_not_reached();
+    }
+    vst1q_u32((uint32_t *)rd, d);
+}
+
+static void crypto_sha1su1_accel(uint64_t *rd, uint64_t *rm)
+{
+    vst1q_u32((uint32_t *)rd, vsha1su1q_u32(vld1q_u32((uint32_t *)rd),
+                                            vld1q_u32((uint32_t *)rm)));
+}
+
+static void crypto_sha256h_accel(uint64_t *rd, uint64_t *rn, uint64_t *rm)
+{
+    vst1q_u32((uint32_t *)rd, vsha256hq_u32(vld1q_u32((uint32_t *)rd),
+                                            vld1q_u32((uint32_t *)rn),
+                                            vld1q_u32((uint32_t *)rm)));
+}
+
+static void crypto_sha256h2_accel(uint64_t *rd, uint64_t *rn, uint64_t *rm)
+{
+    vst1q_u32((uint32_t *)rd, vsha256h2q_u32(vld1q_u32((uint32_t *)rd),
+                                             vld1q_u32((uint32_t *)rn),
+                                             vld1q_u32((uint32_t *)rm)));
+}
+
+static void crypto_sha256su0_accel(uint64_t *rd, uint64_t *rm)
+{
+    vst1q_u32((uint32_t *)rd, vsha256su0q_u32(vld1q_u32((uint32_t *)rd),
+                                              vld1q_u32((uint32_t *)rm)));
+}
+
+static void crypto_sha256su1_accel(uint64_t *rd, uint64_t *rn, uint64_t *rm)
+{
+    vst1q_u32((uint32_t *)rd, vsha256su1q_u32(vld1q_u32((uint32_t *)rd),
+                                              vld1q_u32((uint32_t *)rn),
+                                              vld1q_u32((uint32_t *)rm)));
+}
+
+#pragma GCC pop_options
+
+static void __attribute__((constructor)) crypto_accel_init(void)
+{
+    unsigned long hwcap = qemu_getauxval(AT_HWCAP);
+
+    if (hwcap & HWCAP_AARCH64_AES) {
+        crypto_accel |= CRYPTO_ACCEL_AES;
+    }
+    if ((hwcap & HWCAP_AARCH64_SHA1) && (hwcap & HWCAP_AARCH64_SHA2)) {
+        crypto_accel |= CRYPTO_ACCEL_SHA;
+    }
+}
+#endif
+#endif /* CONFIG_CRYPTO_OPT */
+
 void HELPER(crypto_aese)(void *vd, void *vm, uint32_t decrypt)
 {
     static uint8_t const * const sbox[2] = { AES_sbox, AES_isbox };
@@ -40,6 +314,13 @@ void HELPER(crypto_aese)(void *vd, void *vm, uint32_t decrypt)
     union CRYPTO_STATE st = { .l = { rd[0], rd[1] } };
     int i;
 
+#ifdef CRYPTO_ACCEL_AES
+    if (crypto_accel & CRYPTO_ACCEL_AES) {
+        crypto_aese_accel(rd, rm, decrypt);
+        return;
+    }
+#endif
+
     assert(decrypt < 2);
 
     /* xor state vector with round key */
@@ -196,6 +477,13 @@ void HELPER(crypto_aesmc)(void *vd, void *vm, uint32_t decrypt)
     union CRYPTO_STATE st = { .l = { rm[0], rm[1] } };
     int i;
 
+#ifdef CRYPTO_ACCEL_AES
+    if (crypto_accel & CRYPTO_ACCEL_AES) {
+        crypto_aesmc_accel(rd, rm, decrypt);
+        return;
+    }
+#endif
+
     assert(decrypt < 2);
 
     for (i = 0; i < 16; i += 4) {
@@ -238,6 +526,13 @@ void HELPER(crypto_sha1_3reg)(void *vd, void *vn, void *vm, uint32_t op)
     union CRYPTO_STATE n = { .l = { rn[0], rn[1] } };
     union CRYPTO_STATE m = { .l = { rm[0], rm[1] } };
 
+#ifdef CRYPTO_ACCEL_SHA
+    if ((crypto_accel & CRYPTO_ACCEL_SHA) && op != 3) {
+        crypto_sha1_3reg_accel(rd, rn, rm, op);
+        return;
+    }
+#endif
+
     if (op == 3) { /* sha1su0 */
         d.l[0] ^= d.l[1] ^ m.l[0];
         d.l[1] ^= n.l[0] ^ m.l[1];
@@ -294,6 +589,13 @@ void HELPER(crypto_sha1su1)(void *vd, void *vm)
     union CRYPTO_STATE d = { .l = { rd[0], rd[1] } };
     union CRYPTO_STATE m = { .l = { rm[0], rm[1] } };
 
+#ifdef CRYPTO_ACCEL_SHA
+    if (crypto_accel & CRYPTO_ACCEL_SHA) {
+        crypto_sha1su1_accel(rd, rm);
+        return;
+    }
+#endif
+
     CR_ST_WORD(d, 0) = rol32(CR_ST_WORD(d, 0) ^ CR_ST_WORD(m, 1), 1);
     CR_ST_WORD(d, 1) = rol32(CR_ST_WORD(d, 1) ^ CR_ST_WORD(m, 2), 1);
     CR_ST_WORD(d, 2) = rol32(CR_ST_WORD(d, 2) ^ CR_ST_WORD(m, 3), 1);
@@ -338,6 +640,13 @@ void HELPER(crypto_sha256h)(void *vd, void *vn, void *vm)
     union CRYPTO_STATE m = { .l = { rm[0], rm[1] } };
     int i;
 
+#ifdef CRYPTO_ACCEL_SHA
+    if (crypto_accel & CRYPTO_ACCEL_SHA) {
+        crypto_sha256h_accel(rd, rn, rm);
+        return;
+    }
+#endif
+
     for (i = 0; i < 4; i++) {
         uint32_t t = cho(CR_ST_WORD(n, 0), CR_ST_WORD(n, 1), CR_ST_WORD(n, 2))
                      + CR_ST_WORD(n, 3) + S1(CR_ST_WORD(n, 0))
@@ -371,6 +680,13 @@ void HELPER(crypto_sha256h2)(void *vd, void *vn, void *vm)
     union CRYPTO_STATE m = { .l = { rm[0], rm[1] } };
     int i;
 
+#ifdef CRYPTO_ACCEL_SHA
+    if (crypto_accel & CRYPTO_ACCEL_SHA) {
+        crypto_sha256h2_accel(rd, rn, rm);
+        return;
+    }
+#endif
+
     for (i = 0; i < 4; i++) {
         uint32_t t = cho(CR_ST_WORD(d, 0), CR_ST_WORD(d, 1), CR_ST_WORD(d, 2))
                      + CR_ST_WORD(d, 3) + S1(CR_ST_WORD(d, 0))
@@ -393,6 +709,13 @@ void HELPER(crypto_sha256su0)(void *vd, void *vm)
     union CRYPTO_STATE d = { .l = { rd[0], rd[1] } };
     union CRYPTO_STATE m = { .l = { rm[0], rm[1] } };
 
+#ifdef CRYPTO_ACCEL_SHA
+    if (crypto_accel & CRYPTO_ACCEL_SHA) {
+        crypto_sha256su0_accel(rd, rm);
+        return;
+    }
+#endif
+
     CR_ST_WORD(d, 0) += s0(CR_ST_WORD(d, 1));
     CR_ST_WORD(d, 1) += s0(CR_ST_WORD(d, 2));
     CR_ST_WORD(d, 2) += s0(CR_ST_WORD(d, 3));
@@ -411,6 +734,13 @@ void HELPER(crypto_sha256su1)(void *vd, void *vn, void *vm)
     union CRYPTO_STATE n = { .l = { rn[0], rn[1] } };
     union CRYPTO_STATE m = { .l = { rm[0], rm[1] } };
 
+#ifdef CRYPTO_ACCEL_SHA
+    if (crypto_accel & CRYPTO_ACCEL_SHA) {
+        crypto_sha256su1_accel(rd, rn, rm);
+        return;
+    }
+#endif
+
     CR_ST_WORD(d, 0) += s1(CR_ST_WORD(m, 2)) + CR_ST_WORD(n, 1);
     CR_ST_WORD(d, 1) += s1(CR_ST_WORD(m, 3)) + CR_ST_WORD(n, 2);
     CR_ST_WORD(d, 2) += s1(CR_ST_WORD(d, 0)) + CR_ST_WORD(n, 3);
@@ -506,13 +506,13 @@ static uint64_t do_paired_cmpxchg64_le(CPUARMState *env, uint64_t addr,
     newv = int128_make128(new_lo, new_hi);
 
     if (parallel) {
-#ifndef CONFIG_ATOMIC128
-        cpu_loop_exit_atomic(ENV_GET_CPU(env), ra);
-#else
+#if HAVE_CMPXCHG128
         int mem_idx = cpu_mmu_index(env, false);
         TCGMemOpIdx oi = make_memop_idx(MO_LEQ | MO_ALIGN_16, mem_idx);
         oldv = helper_atomic_cmpxchgo_le_mmu(env, addr, cmpv, newv, oi, ra);
         success = int128_eq(oldv, cmpv);
+#else
+        cpu_loop_exit_atomic(ENV_GET_CPU(env), ra);
 #endif
     } else {
         uint64_t o0, o1;
@@ -578,13 +578,13 @@ static uint64_t do_paired_cmpxchg64_be(CPUARMState *env, uint64_t addr,
     newv = int128_make128(new_hi, new_lo);
 
     if (parallel) {
-#ifndef CONFIG_ATOMIC128
-        cpu_loop_exit_atomic(ENV_GET_CPU(env), ra);
-#else
+#if HAVE_CMPXCHG128
         int mem_idx = cpu_mmu_index(env, false);
         TCGMemOpIdx oi = make_memop_idx(MO_BEQ | MO_ALIGN_16, mem_idx);
         oldv = helper_atomic_cmpxchgo_be_mmu(env, addr, cmpv, newv, oi, ra);
         success = int128_eq(oldv, cmpv);
+#else
+        cpu_loop_exit_atomic(ENV_GET_CPU(env), ra);
 #endif
     } else {
         uint64_t o0, o1;
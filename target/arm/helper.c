@@ -81,7 +81,7 @@ static int vfp_gdb_get_reg(CPUARMState *env, uint8_t *buf, int reg)
     }
     switch (reg - nregs) {
     case 0: stl_p(buf, env->vfp.xregs[ARM_VFP_FPSID]); return 4;
-    case 1: stl_p(buf, env->vfp.xregs[ARM_VFP_FPSCR]); return 4;
+    case 1: stl_p(buf, vfp_get_fpscr(env)); return 4;
     case 2: stl_p(buf, env->vfp.xregs[ARM_VFP_FPEXC]); return 4;
     }
     return 0;
@@ -107,7 +107,7 @@ static int vfp_gdb_set_reg(CPUARMState *env, uint8_t *buf, int reg)
     }
     switch (reg - nregs) {
     case 0: env->vfp.xregs[ARM_VFP_FPSID] = ldl_p(buf); return 4;
-    case 1: env->vfp.xregs[ARM_VFP_FPSCR] = ldl_p(buf); return 4;
+    case 1: vfp_set_fpscr(env, ldl_p(buf)); return 4;
     case 2: env->vfp.xregs[ARM_VFP_FPEXC] = ldl_p(buf) & (1 << 30); return 4;
     }
     return 0;
@@ -510,6 +510,54 @@ static void fcse_write(CPUARMState *env, const ARMCPRegInfo *ri, uint64_t value)
     }
 }
 
+/* MMU indexes whose TLB entries are tagged with the Non-secure EL1&0 ASID */
+#define ARM_NS_EL10_ASID_MMUIDX (ARMMMUIdxBit_S12NSE1 | ARMMMUIdxBit_S12NSE0)
+
+static uint32_t arm_ns_el10_asid_mask(CPUARMState *env)
+{
+    if (arm_el_is_aa64(env, 1) &&
+        extract64(env->cp15.tcr_el[1].raw_tcr, 36, 1)) {
+        /* TCR_EL1.AS selects 16 bit ASIDs */
+        return 0xffff;
+    }
+    return 0xff;
+}
+
+/* Return the ASID in effect for the Non-secure EL1&0 translation regime */
+static uint32_t arm_ns_el10_asid(CPUARMState *env)
+{
+    uint64_t tcr = env->cp15.tcr_el[1].raw_tcr;
+    uint64_t ttbr;
+
+    if (!arm_el_is_aa64(env, 1) &&
+        !(arm_feature(env, ARM_FEATURE_LPAE) && (tcr & TTBCR_EAE))) {
+        /* Short descriptor format: the ASID lives in CONTEXTIDR */
+        return extract64(env->cp15.contextidr_ns, 0, 8);
+    }
+    /* Long descriptor format: TCR.A1 selects which TTBR holds the ASID */
+    ttbr = extract64(tcr, 22, 1) ? env->cp15.ttbr1_ns : env->cp15.ttbr0_ns;
+    return extract64(ttbr, 48, 16) & arm_ns_el10_asid_mask(env);
+}
+
+/* Returns true if @ri is the Non-secure copy of a register holding the
+ * EL1&0 ASID and we are not about to use it in the Secure regime, in which
+ * case an ASID change can be handed to the TLB rather than flushing it.
+ */
+static bool arm_ns_el10_asid_reg(CPUARMState *env, const ARMCPRegInfo *ri)
+{
+    void *ptr = raw_ptr(env, ri);
+
+    return (ptr == &env->cp15.ttbr0_ns || ptr == &env->cp15.ttbr1_ns ||
+            ptr == &env->cp15.contextidr_ns) &&
+           !arm_is_secure_below_el3(env);
+}
+
+static void arm_ns_el10_asid_changed(CPUARMState *env)
+{
+    tlb_set_asid_by_mmuidx(ENV_GET_CPU(env), arm_ns_el10_asid(env),
+                           ARM_NS_EL10_ASID_MMUIDX);
+}
+
 static void contextidr_write(CPUARMState *env, const ARMCPRegInfo *ri,
                              uint64_t value)
 {
@@ -518,9 +566,15 @@ static void contextidr_write(CPUARMState *env, const ARMCPRegInfo *ri,
     if (raw_read(env, ri) != value && !arm_feature(env, ARM_FEATURE_PMSA)
         && !extended_addresses_enabled(env)) {
         /* For VMSA (when not using the LPAE long descriptor page table
-         * format) this register includes the ASID, so do a TLB flush.
+         * format) this register includes the ASID, so the TLB must stop
+         * using entries for the old one.
          * For PMSA it is purely a process ID and no action is needed.
          */
+        if (arm_ns_el10_asid_reg(env, ri)) {
+            raw_write(env, ri, value);
+            arm_ns_el10_asid_changed(env);
+            return;
+        }
         tlb_flush(CPU(cpu));
     }
     raw_write(env, ri, value);
@@ -550,6 +604,11 @@ static void tlbiasid_write(CPUARMState *env, const ARMCPRegInfo *ri,
     /* Invalidate by ASID (TLBIASID) */
     ARMCPU *cpu = arm_env_get_cpu(env);
 
+    if (!arm_is_secure_below_el3(env)) {
+        tlb_flush_asid_by_mmuidx(CPU(cpu), extract64(value, 0, 8),
+                                 ARM_NS_EL10_ASID_MMUIDX);
+        return;
+    }
     tlb_flush(CPU(cpu));
 }
 
@@ -576,6 +635,11 @@ static void tlbiasid_is_write(CPUARMState *env, const ARMCPRegInfo *ri,
 {
     CPUState *cs = ENV_GET_CPU(env);
 
+    if (!arm_is_secure_below_el3(env)) {
+        tlb_flush_asid_by_mmuidx_all_cpus_synced(cs, extract64(value, 0, 8),
+                                                 ARM_NS_EL10_ASID_MMUIDX);
+        return;
+    }
     tlb_flush_all_cpus_synced(cs);
 }
 
@@ -2632,12 +2696,18 @@ static void vmsa_tcr_el1_write(CPUARMState *env, const ARMCPRegInfo *ri,
 static void vmsa_ttbr_write(CPUARMState *env, const ARMCPRegInfo *ri,
                             uint64_t value)
 {
-    /* 64 bit accesses to the TTBRs can change the ASID and so we
-     * must flush the TLB.
+    /* 64 bit accesses to the TTBRs can change the ASID.  For the
+     * Non-secure EL1&0 regime the TLB keeps entries per ASID, otherwise
+     * we must flush the TLB.
      */
     if (cpreg_field_is_64bit(ri)) {
         ARMCPU *cpu = arm_env_get_cpu(env);
 
+        if (arm_ns_el10_asid_reg(env, ri)) {
+            raw_write(env, ri, value);
+            arm_ns_el10_asid_changed(env);
+            return;
+        }
         tlb_flush(CPU(cpu));
     }
     raw_write(env, ri, value);
@@ -3039,6 +3109,36 @@ static void tlbi_aa64_vmalle1is_write(CPUARMState *env, const ARMCPRegInfo *ri,
     }
 }
 
+static void tlbi_aa64_aside1_write(CPUARMState *env, const ARMCPRegInfo *ri,
+                                   uint64_t value)
+{
+    CPUState *cs = ENV_GET_CPU(env);
+
+    if (arm_is_secure_below_el3(env)) {
+        tlbi_aa64_vmalle1_write(env, ri, value);
+        return;
+    }
+    tlb_flush_asid_by_mmuidx(cs,
+                             extract64(value, 48, 16) &
+                             arm_ns_el10_asid_mask(env),
+                             ARM_NS_EL10_ASID_MMUIDX);
+}
+
+static void tlbi_aa64_aside1is_write(CPUARMState *env, const ARMCPRegInfo *ri,
+                                     uint64_t value)
+{
+    CPUState *cs = ENV_GET_CPU(env);
+
+    if (arm_is_secure_below_el3(env)) {
+        tlbi_aa64_vmalle1is_write(env, ri, value);
+        return;
+    }
+    tlb_flush_asid_by_mmuidx_all_cpus_synced(cs,
+                                             extract64(value, 48, 16) &
+                                             arm_ns_el10_asid_mask(env),
+                                             ARM_NS_EL10_ASID_MMUIDX);
+}
+
 static void tlbi_aa64_alle1_write(CPUARMState *env, const ARMCPRegInfo *ri,
                                   uint64_t value)
 {
@@ -3426,7 +3526,7 @@ static const ARMCPRegInfo v8_cp_reginfo[] = {
     { .name = "TLBI_ASIDE1IS", .state = ARM_CP_STATE_AA64,
       .opc0 = 1, .opc1 = 0, .crn = 8, .crm = 3, .opc2 = 2,
       .access = PL1_W, .type = ARM_CP_NO_RAW,
-      .writefn = tlbi_aa64_vmalle1is_write },
+      .writefn = tlbi_aa64_aside1is_write },
     { .name = "TLBI_VAAE1IS", .state = ARM_CP_STATE_AA64,
       .opc0 = 1, .opc1 = 0, .crn = 8, .crm = 3, .opc2 = 3,
       .access = PL1_W, .type = ARM_CP_NO_RAW,
@@ -3450,7 +3550,7 @@ static const ARMCPRegInfo v8_cp_reginfo[] = {
     { .name = "TLBI_ASIDE1", .state = ARM_CP_STATE_AA64,
       .opc0 = 1, .opc1 = 0, .crn = 8, .crm = 7, .opc2 = 2,
       .access = PL1_W, .type = ARM_CP_NO_RAW,
-      .writefn = tlbi_aa64_vmalle1_write },
+      .writefn = tlbi_aa64_aside1_write },
     { .name = "TLBI_VAAE1", .state = ARM_CP_STATE_AA64,
       .opc0 = 1, .opc1 = 0, .crn = 8, .crm = 7, .opc2 = 3,
       .access = PL1_W, .type = ARM_CP_NO_RAW,
@@ -8682,6 +8782,61 @@ static hwaddr S1_ptw_translate(CPUARMState *env, ARMMMUIdx mmu_idx,
     return addr;
 }
 
+/* Return a host pointer for the page table descriptor at physical
+ * address @addr, or NULL if it is not in RAM.  The host address of each
+ * table page is remembered in env->ptw_cache, so that repeated walks
+ * through the same tables don't each pay for a trip through the memory
+ * dispatch.  Since we keep host addresses rather than descriptor values,
+ * guest writes to the tables are seen immediately; the cache only has to
+ * be dropped when the memory map changes, which always flushes the TLB.
+ * Only the vCPU's own thread uses the cache, so it needs no locking.
+ */
+static void *arm_ptw_host_addr(CPUARMState *env, AddressSpace *as,
+                               hwaddr addr, bool is_secure)
+{
+    hwaddr page = addr & TARGET_PAGE_MASK;
+    unsigned idx = (page >> TARGET_PAGE_BITS) & (ARM_PTW_CACHE_SIZE - 1);
+    MemoryRegion *mr;
+    hwaddr xlat, len = TARGET_PAGE_SIZE;
+    void *host = NULL;
+
+    if (!tcg_enabled()) {
+        /* without TCG nothing tells us about memory map changes */
+        return NULL;
+    }
+    if (current_cpu != ENV_GET_CPU(env)) {
+        /* Debug walks from the monitor or gdbstub threads may run while
+         * the vCPU walks under MTTCG; the cache belongs to the vCPU
+         * thread, so they go the slow way.
+         */
+        return NULL;
+    }
+
+    if (env->ptw_cache.tlb_flush_count != env->tlb_flush_count) {
+        memset(env->ptw_cache.entry, 0, sizeof(env->ptw_cache.entry));
+        env->ptw_cache.tlb_flush_count = env->tlb_flush_count;
+    }
+
+    if (env->ptw_cache.entry[idx].host &&
+        env->ptw_cache.entry[idx].page == page &&
+        env->ptw_cache.entry[idx].secure == is_secure) {
+        return env->ptw_cache.entry[idx].host + (addr - page);
+    }
+
+    rcu_read_lock();
+    mr = address_space_translate(as, page, &xlat, &len, false);
+    if (len >= TARGET_PAGE_SIZE && memory_region_is_ram(mr) &&
+        !memory_region_is_ram_device(mr)) {
+        host = memory_region_get_ram_ptr(mr) + xlat;
+        env->ptw_cache.entry[idx].page = page;
+        env->ptw_cache.entry[idx].host = host;
+        env->ptw_cache.entry[idx].secure = is_secure;
+    }
+    rcu_read_unlock();
+
+    return host ? host + (addr - page) : NULL;
+}
+
 /* All loads done in the course of a page table walk go through here.
  * TODO: rather than ignoring errors from physical memory reads (which
  * are external aborts in ARM terminology) we should propagate this
@@ -8698,6 +8853,7 @@ static uint32_t arm_ldl_ptw(CPUState *cs, hwaddr addr, bool is_secure,
     MemTxResult result = MEMTX_OK;
     AddressSpace *as;
     uint32_t data;
+    void *host;
 
     attrs.secure = is_secure;
     as = arm_addressspace(cs, attrs);
@@ -8705,6 +8861,13 @@ static uint32_t arm_ldl_ptw(CPUState *cs, hwaddr addr, bool is_secure,
     if (fi->s1ptw) {
         return 0;
     }
+    host = arm_ptw_host_addr(env, as, addr, is_secure);
+    if (host) {
+        if (regime_translation_big_endian(env, mmu_idx)) {
+            return ldl_be_p(host);
+        }
+        return ldl_le_p(host);
+    }
     if (regime_translation_big_endian(env, mmu_idx)) {
         data = address_space_ldl_be(as, addr, attrs, &result);
     } else {
@@ -8727,6 +8890,7 @@ static uint64_t arm_ldq_ptw(CPUState *cs, hwaddr addr, bool is_secure,
     MemTxResult result = MEMTX_OK;
     AddressSpace *as;
     uint64_t data;
+    void *host;
 
     attrs.secure = is_secure;
     as = arm_addressspace(cs, attrs);
@@ -8734,6 +8898,13 @@ static uint64_t arm_ldq_ptw(CPUState *cs, hwaddr addr, bool is_secure,
     if (fi->s1ptw) {
         return 0;
     }
+    host = arm_ptw_host_addr(env, as, addr, is_secure);
+    if (host) {
+        if (regime_translation_big_endian(env, mmu_idx)) {
+            return ldq_be_p(host);
+        }
+        return ldq_le_p(host);
+    }
     if (regime_translation_big_endian(env, mmu_idx)) {
         data = address_space_ldq_be(as, addr, attrs, &result);
     } else {
@@ -9245,9 +9416,8 @@ static bool get_phys_addr_lpae(CPUARMState *env, target_ulong address,
     /* Note that QEMU ignores shareability and cacheability attributes,
      * so we don't need to do anything with the SH, ORGN, IRGN fields
      * in the TTBCR.  Similarly, TTBCR:A1 selects whether we get the
-     * ASID from TTBR0 or TTBR1, but QEMU's TLB doesn't currently
-     * implement any ASID-like capability so we can ignore it (instead
-     * we will always flush the TLB any time the ASID is changed).
+     * ASID from TTBR0 or TTBR1; the TLB is told about ASID changes
+     * when those registers are written, so the walk can ignore it.
      */
     if (ttbr_select == 0) {
         ttbr = regime_ttbr(env, mmu_idx, 0);
@@ -11124,6 +11294,9 @@ uint32_t HELPER(vfp_get_fpscr)(CPUARMState *env)
     fpscr = (env->vfp.xregs[ARM_VFP_FPSCR] & 0xffc8ffff)
             | (env->vfp.vec_len << 16)
             | (env->vfp.vec_stride << 20);
+    if (env->vfp.qc[0] | env->vfp.qc[1] | env->vfp.qc[2] | env->vfp.qc[3]) {
+        fpscr |= FPSR_QC;
+    }
     i = get_float_exception_flags(&env->vfp.fp_status);
     i |= get_float_exception_flags(&env->vfp.standard_fp_status);
     i |= get_float_exception_flags(&env->vfp.fp_status_f16);
@@ -11162,10 +11335,16 @@ void HELPER(vfp_set_fpscr)(CPUARMState *env, uint32_t val)
     uint32_t changed;
 
     changed = env->vfp.xregs[ARM_VFP_FPSCR];
-    env->vfp.xregs[ARM_VFP_FPSCR] = (val & 0xffc8ffff);
+    env->vfp.xregs[ARM_VFP_FPSCR] = (val & 0xffc8ffff & ~FPSR_QC);
     env->vfp.vec_len = (val >> 16) & 7;
     env->vfp.vec_stride = (val >> 20) & 3;
 
+    /* The saturation flag is tracked separately; see CPUARMState.vfp.qc.  */
+    env->vfp.qc[0] = val & FPSR_QC;
+    env->vfp.qc[1] = 0;
+    env->vfp.qc[2] = 0;
+    env->vfp.qc[3] = 0;
+
     changed ^= val;
     if (changed & (3 << 22)) {
         i = (val >> 22) & 3;
@@ -128,11 +128,15 @@ static int tcg_target_const_match(tcg_target_long val, TCGType type,
 #ifdef TCG_TARGET_NEED_LDST_LABELS
 static bool tcg_out_ldst_finalize(TCGContext *s);
 #endif
+#ifdef TCG_TARGET_NEED_TB_FINALIZE
+static void tcg_out_tb_finalize(TCGContext *s);
+#endif
 
 #define TCG_HIGHWATER 1024
 
 static TCGContext **tcg_ctxs;
 static unsigned int n_tcg_ctxs;
+static unsigned int n_tcg_helper_threads;
 TCGv_env cpu_env = 0;
 
 /*
@@ -396,30 +400,42 @@ static size_t tcg_n_regions(void)
  */
 static size_t tcg_n_regions(void)
 {
+    unsigned int n_threads = max_cpus + n_tcg_helper_threads;
     size_t i;
 
     /* Use a single region if all we have is one vCPU thread */
-    if (max_cpus == 1 || !qemu_tcg_mttcg_enabled()) {
+    if (n_threads == 1 || !qemu_tcg_mttcg_enabled()) {
         return 1;
     }
 
-    /* Try to have more regions than max_cpus, with each region being >= 2 MB */
+    /* Try to have more regions than threads, with each region being >= 2 MB */
     for (i = 8; i > 0; i--) {
         size_t regions_per_thread = i;
         size_t region_size;
 
         region_size = tcg_init_ctx.code_gen_buffer_size;
-        region_size /= max_cpus * regions_per_thread;
+        region_size /= n_threads * regions_per_thread;
 
         if (region_size >= 2 * 1024u * 1024) {
-            return max_cpus * regions_per_thread;
+            return n_threads * regions_per_thread;
         }
     }
-    /* If we can't, then just allocate one region per vCPU thread */
-    return max_cpus;
+    /* If we can't, then just allocate one region per TCG thread */
+    return n_threads;
 }
 #endif
 
+/*
+ * Reserve TCG contexts and regions for @n threads that translate code but
+ * are not vCPUs, such as the TB prefetch threads.  Must be called before
+ * tcg_region_init().  User-mode shares a single context, so this is a no-op
+ * there.
+ */
+void tcg_reserve_helper_threads(unsigned int n)
+{
+    n_tcg_helper_threads = n;
+}
+
 /*
  * Initializes region partitioning.
  *
@@ -430,8 +446,9 @@ static size_t tcg_n_regions(void)
  * and then assigning regions to TCG threads so that the threads can translate
  * code in parallel without synchronization.
  *
- * In softmmu the number of TCG threads is bounded by max_cpus, so we use at
- * least max_cpus regions in MTTCG. In !MTTCG we use a single region.
+ * In softmmu the number of TCG threads is bounded by max_cpus plus the helper
+ * threads reserved with tcg_reserve_helper_threads(), so we use at least that
+ * many regions in MTTCG. In !MTTCG we use a single region.
  * Note that the TCG options from the command-line (i.e. -accel accel=tcg,[...])
  * must have been parsed before calling this function, since it calls
  * qemu_tcg_mttcg_enabled().
@@ -474,6 +491,10 @@ void tcg_region_init(void)
     /* A region must have at least 2 pages; one code, one guard */
     g_assert(region_size >= 2 * page_size);
 
+#ifndef CONFIG_USER_ONLY
+    tcg_ctxs = g_new(TCGContext *, max_cpus + n_tcg_helper_threads);
+#endif
+
     /* init the region struct */
     qemu_mutex_init(&region.lock);
     region.n = n_regions;
@@ -546,7 +567,7 @@ void tcg_register_thread(void)
 
     /* Claim an entry in tcg_ctxs */
     n = atomic_fetch_inc(&n_tcg_ctxs);
-    g_assert(n < max_cpus);
+    g_assert(n < max_cpus + n_tcg_helper_threads);
     atomic_set(&tcg_ctxs[n], s);
 
     tcg_ctx = s;
@@ -736,13 +757,12 @@ void tcg_context_init(TCGContext *s)
      * In user-mode we simply share the init context among threads, since we
      * use a single region. See the documentation tcg_region_init() for the
      * reasoning behind this.
-     * In softmmu we will have at most max_cpus TCG threads.
+     * In softmmu tcg_region_init() sizes tcg_ctxs, once the number of
+     * helper threads is known.
      */
 #ifdef CONFIG_USER_ONLY
     tcg_ctxs = &tcg_ctx;
     n_tcg_ctxs = 1;
-#else
-    tcg_ctxs = g_new(TCGContext *, max_cpus);
 #endif
 
     tcg_debug_assert(!tcg_regset_test_reg(s->reserved_regs, TCG_AREG0));
@@ -1405,6 +1425,16 @@ bool tcg_op_supported(TCGOpcode op)
         return have_vec && TCG_TARGET_HAS_orc_vec;
     case INDEX_op_mul_vec:
         return have_vec && TCG_TARGET_HAS_mul_vec;
+    case INDEX_op_ssadd_vec:
+    case INDEX_op_usadd_vec:
+    case INDEX_op_sssub_vec:
+    case INDEX_op_ussub_vec:
+        return have_vec && TCG_TARGET_HAS_sat_vec;
+    case INDEX_op_smin_vec:
+    case INDEX_op_umin_vec:
+    case INDEX_op_smax_vec:
+    case INDEX_op_umax_vec:
+        return have_vec && TCG_TARGET_HAS_minmax_vec;
     case INDEX_op_shli_vec:
     case INDEX_op_shri_vec:
     case INDEX_op_sari_vec:
@@ -3408,6 +3438,9 @@ int tcg_gen_code(TCGContext *s, TranslationBlock *tb)
         return -1;
     }
 #endif
+#ifdef TCG_TARGET_NEED_TB_FINALIZE
+    tcg_out_tb_finalize(s);
+#endif
 
     /* flush instruction cache */
     flush_icache_range((uintptr_t)s->code_buf, (uintptr_t)s->code_ptr);
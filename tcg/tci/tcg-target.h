@@ -187,6 +187,21 @@ typedef enum {
 
 void tci_disas(uint8_t opc);
 
+/* Superinstructions, numbered after the last TCG opcode.  Each one
+   replaces the opcode byte of the first op of a sequence; the operands
+   of all ops of the sequence are left untouched. */
+typedef enum {
+    TCI_FUSED_ld_add_st_i32,
+    TCI_FUSED_setcond_brcond_i32,
+    TCI_FUSED_ld_add_st_i64,
+    TCI_FUSED_setcond_brcond_i64,
+    TCI_FUSED_NB
+} TCIFusedOp;
+
+#define TCI_OP_FUSED(x)  (NB_OPS + TCI_FUSED_##x)
+
+#define TCG_TARGET_NEED_TB_FINALIZE
+
 #define HAVE_TCG_QEMU_TB_EXEC
 
 static inline void flush_icache_range(uintptr_t start, uintptr_t stop)
@@ -404,7 +404,13 @@ static const char *target_parse_constraint(TCGArgConstraint *ct,
 /* Show current bytecode. Used by tcg interpreter. */
 void tci_disas(uint8_t opc)
 {
-    const TCGOpDef *def = &tcg_op_defs[opc];
+    const TCGOpDef *def;
+
+    if (opc >= tcg_op_defs_max) {
+        fprintf(stderr, "TCG fused %u\n", opc - tcg_op_defs_max);
+        return;
+    }
+    def = &tcg_op_defs[opc];
     fprintf(stderr, "TCG %s %u, %u, %u\n",
             def->name, def->nb_oargs, def->nb_iargs, def->nb_cargs);
 }
@@ -892,3 +898,88 @@ static void tcg_target_init(TCGContext *s)
 static inline void tcg_target_qemu_prologue(TCGContext *s)
 {
 }
+
+/* Combine frequent op sequences of the finished TB into superinstructions.
+   Only the opcode byte of the first op of a sequence is rewritten, so the
+   byte stream keeps its layout and the following ops are simply skipped
+   over by the interpreter.  A sequence is never fused if one of its later
+   ops is the target of a branch.  Build with -DTCI_NO_FUSE to disable. */
+static void tcg_out_tb_finalize(TCGContext *s)
+{
+#ifndef TCI_NO_FUSE
+    uint8_t *start = s->code_buf;
+    uint8_t *end = s->code_ptr;
+    size_t len = end - start;
+    unsigned long *targets;
+    uint8_t *p, *n1, *n2;
+
+    targets = tcg_malloc(BITS_TO_LONGS(len) * sizeof(unsigned long));
+    bitmap_zero(targets, len);
+
+    /* Collect branch targets.  The label is the last operand. */
+    for (p = start; p < end; p += p[1]) {
+        tcg_target_ulong dest;
+
+        tcg_debug_assert(p[1] != 0);
+        switch (p[0]) {
+        case INDEX_op_br:
+        case INDEX_op_brcond_i32:
+#if TCG_TARGET_REG_BITS == 32
+        case INDEX_op_brcond2_i32:
+#else
+        case INDEX_op_brcond_i64:
+#endif
+            memcpy(&dest, p + p[1] - sizeof(dest), sizeof(dest));
+            if (dest - (uintptr_t)start < len) {
+                set_bit(dest - (uintptr_t)start, targets);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    for (p = start; p < end; p = n1) {
+        n1 = p + p[1];
+        if (n1 >= end || test_bit(n1 - start, targets)) {
+            continue;
+        }
+        n2 = n1 + n1[1];
+
+        switch (p[0]) {
+        case INDEX_op_ld_i32:
+            if (n1[0] == INDEX_op_add_i32 && n2 < end
+                && n2[0] == INDEX_op_st_i32
+                && !test_bit(n2 - start, targets)) {
+                p[0] = TCI_OP_FUSED(ld_add_st_i32);
+                n1 = n2 + n2[1];
+            }
+            break;
+        case INDEX_op_setcond_i32:
+            if (n1[0] == INDEX_op_brcond_i32) {
+                p[0] = TCI_OP_FUSED(setcond_brcond_i32);
+                n1 = n2;
+            }
+            break;
+#if TCG_TARGET_REG_BITS == 64
+        case INDEX_op_ld_i64:
+            if (n1[0] == INDEX_op_add_i64 && n2 < end
+                && n2[0] == INDEX_op_st_i64
+                && !test_bit(n2 - start, targets)) {
+                p[0] = TCI_OP_FUSED(ld_add_st_i64);
+                n1 = n2 + n2[1];
+            }
+            break;
+        case INDEX_op_setcond_i64:
+            if (n1[0] == INDEX_op_brcond_i64) {
+                p[0] = TCI_OP_FUSED(setcond_brcond_i64);
+                n1 = n2;
+            }
+            break;
+#endif
+        default:
+            break;
+        }
+    }
+#endif
+}
@@ -0,0 +1,227 @@
+/*
+ * qtest for incremental FlatView updates
+ *
+ * Under qtest, memory.c checks every incrementally updated FlatView
+ * against a full render of the memory topology, and aborts if they
+ * differ.  These tests make the guest add, remove and move regions, switch
+ * aliases, enable and disable regions and overlap them at the same or
+ * different priorities, and check what the guest sees afterwards.
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#include "qemu/osdep.h"
+
+#include "libqtest.h"
+#include "libqos/pci.h"
+#include "libqos/pci-pc.h"
+#include "hw/pci/pci_regs.h"
+
+#define I440FX_PAM      0x59
+#define I440FX_SMRAM    0x72
+
+#define SMRAM_D_OPEN    0x40
+#define SMRAM_G_SMRAME  0x08
+
+/* pci-testdev: writing a test number at offset 0 selects that test, whose
+ * name can then be read at offset 16.  Test 0 is "no-eventfd".
+ */
+#define TESTDEV_NAME    16
+
+typedef struct TestState {
+    QPCIBus *bus;
+    QPCIDevice *host;
+    QPCIDevice *dev[2];
+} TestState;
+
+static void test_start(TestState *s)
+{
+    unsigned i;
+
+    qtest_start("-vga none "
+                "-device pci-testdev,addr=04.0 "
+                "-device pci-testdev,addr=05.0");
+    s->bus = qpci_init_pc(global_qtest, NULL);
+    s->host = qpci_device_find(s->bus, QPCI_DEVFN(0, 0));
+    g_assert(s->host);
+    for (i = 0; i < ARRAY_SIZE(s->dev); i++) {
+        s->dev[i] = qpci_device_find(s->bus, QPCI_DEVFN(4 + i, 0));
+        g_assert(s->dev[i]);
+    }
+}
+
+static void test_end(TestState *s)
+{
+    unsigned i;
+
+    for (i = 0; i < ARRAY_SIZE(s->dev); i++) {
+        g_free(s->dev[i]);
+    }
+    g_free(s->host);
+    qpci_free_pc(s->bus);
+    qtest_end();
+}
+
+static void set_memory_enabled(QPCIDevice *dev, bool enabled)
+{
+    uint16_t cmd = qpci_config_readw(dev, PCI_COMMAND);
+
+    if (enabled) {
+        cmd |= PCI_COMMAND_MEMORY;
+    } else {
+        cmd &= ~PCI_COMMAND_MEMORY;
+    }
+    qpci_config_writew(dev, PCI_COMMAND, cmd);
+}
+
+static void map_bar(QPCIDevice *dev, uint32_t addr)
+{
+    qpci_config_writel(dev, PCI_BASE_ADDRESS_0, addr);
+    g_assert_cmphex(qpci_config_readl(dev, PCI_BASE_ADDRESS_0) &
+                    PCI_BASE_ADDRESS_MEM_MASK, ==, addr);
+}
+
+static void set_pam(QPCIDevice *host, int reg, uint8_t value)
+{
+    qpci_config_writeb(host, I440FX_PAM + reg, value);
+    g_assert_cmphex(qpci_config_readb(host, I440FX_PAM + reg), ==, value);
+}
+
+static bool testdev_visible(uint64_t addr)
+{
+    writeb(addr, 0);
+    return readb(addr + TESTDEV_NAME) == 'n';
+}
+
+static bool ram_visible(uint64_t addr)
+{
+    writeb(addr, 0x5a);
+    writeb(addr + 1, 0xa5);
+    return readb(addr) == 0x5a && readb(addr + 1) == 0xa5;
+}
+
+/* Add, remove and move BARs, on their own and on top of each other.  */
+static void test_flatview_bars(void)
+{
+    TestState s;
+
+    test_start(&s);
+
+    map_bar(s.dev[0], 0xe0000000);
+    map_bar(s.dev[1], 0xe0001000);
+    set_memory_enabled(s.dev[0], true);
+    g_assert(testdev_visible(0xe0000000));
+    set_memory_enabled(s.dev[1], true);
+    g_assert(testdev_visible(0xe0001000));
+
+    /* Overlap them at the same priority, then pull them apart again.  */
+    map_bar(s.dev[1], 0xe0000000);
+    g_assert(testdev_visible(0xe0000000));
+    map_bar(s.dev[0], 0xe0002000);
+    g_assert(testdev_visible(0xe0000000));
+    g_assert(testdev_visible(0xe0002000));
+
+    set_memory_enabled(s.dev[1], false);
+    g_assert(!testdev_visible(0xe0000000));
+    g_assert(testdev_visible(0xe0002000));
+    set_memory_enabled(s.dev[1], true);
+    g_assert(testdev_visible(0xe0000000));
+
+    set_memory_enabled(s.dev[0], false);
+    set_memory_enabled(s.dev[1], false);
+    g_assert(!testdev_visible(0xe0000000));
+    g_assert(!testdev_visible(0xe0002000));
+
+    test_end(&s);
+}
+
+/* Switch the PAM aliases between RAM and the ROMs in the PCI address
+ * space, one region at a time and all of them at once.
+ */
+static void test_flatview_pam(void)
+{
+    const uint64_t addr = 0xd0000;  /* Low half of PAM register 3 */
+    TestState s;
+    uint8_t rom, ram;
+    int reg;
+
+    test_start(&s);
+
+    rom = readb(addr);
+    ram = ~rom;
+
+    set_pam(s.host, 3, 0x03);
+    writeb(addr, ram);
+    g_assert_cmphex(readb(addr), ==, ram);
+    set_pam(s.host, 3, 0x00);
+    g_assert_cmphex(readb(addr), ==, rom);
+
+    /* Read-only RAM ignores writes.  */
+    set_pam(s.host, 3, 0x01);
+    g_assert_cmphex(readb(addr), ==, ram);
+    writeb(addr, rom);
+    g_assert_cmphex(readb(addr), ==, ram);
+
+    /* Go through every mode of every PAM register.  */
+    for (reg = 0; reg < 7; reg++) {
+        set_pam(s.host, reg, 0x11);
+        set_pam(s.host, reg, 0x22);
+        set_pam(s.host, reg, 0x33);
+        set_pam(s.host, reg, 0x12);
+        set_pam(s.host, reg, 0x00);
+    }
+    g_assert_cmphex(readb(addr), ==, rom);
+    set_pam(s.host, 3, 0x30);
+    g_assert_cmphex(readb(addr), ==, rom);
+    g_assert(ram_visible(addr + 0x4000));
+    set_pam(s.host, 3, 0x33);
+    g_assert_cmphex(readb(addr), ==, ram);
+
+    test_end(&s);
+}
+
+/* Open and close SMRAM, which overlays the legacy VGA window at a higher
+ * priority than the PCI address space below it.
+ */
+static void test_flatview_smram(void)
+{
+    TestState s;
+    uint8_t smram;
+
+    test_start(&s);
+
+    map_bar(s.dev[0], 0xa0000);
+    set_memory_enabled(s.dev[0], true);
+    g_assert(testdev_visible(0xa0000));
+
+    smram = qpci_config_readb(s.host, I440FX_SMRAM);
+    qpci_config_writeb(s.host, I440FX_SMRAM, smram | SMRAM_G_SMRAME);
+    qpci_config_writeb(s.host, I440FX_SMRAM,
+                       smram | SMRAM_G_SMRAME | SMRAM_D_OPEN);
+    g_assert(ram_visible(0xa0000));
+    qpci_config_writeb(s.host, I440FX_SMRAM, smram | SMRAM_G_SMRAME);
+    g_assert(testdev_visible(0xa0000));
+
+    /* Remove the BAR while SMRAM is open, and map it back once closed.  */
+    qpci_config_writeb(s.host, I440FX_SMRAM,
+                       smram | SMRAM_G_SMRAME | SMRAM_D_OPEN);
+    set_memory_enabled(s.dev[0], false);
+    g_assert(ram_visible(0xa0000));
+    qpci_config_writeb(s.host, I440FX_SMRAM, smram);
+    set_memory_enabled(s.dev[0], true);
+    g_assert(testdev_visible(0xa0000));
+
+    test_end(&s);
+}
+
+int main(int argc, char **argv)
+{
+    g_test_init(&argc, &argv, NULL);
+
+    qtest_add_func("/flatview/bars", test_flatview_bars);
+    qtest_add_func("/flatview/pam", test_flatview_pam);
+    qtest_add_func("/flatview/smram", test_flatview_smram);
+
+    return g_test_run();
+}
@@ -0,0 +1,112 @@
+/*
+ * AArch64 crypto extension speed test
+ *
+ * Runs the AESE/AESMC and SHA1/SHA256 instructions over a buffer and
+ * prints a checksum of the results, so that the output can be compared
+ * between a native run and a run under qemu-aarch64.
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2 or later.
+ * See the COPYING file in the top-level directory.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <arm_neon.h>
+
+#define BUFSIZE 4096
+#define LOOPS   1000
+
+static uint8_t buf[BUFSIZE];
+
+static uint8x16_t aes_pass(uint8x16_t state, const uint8_t *p, int n)
+{
+    uint8x16_t key = vdupq_n_u8(0x5a);
+    int i;
+
+    for (i = 0; i < n; i += 16) {
+        state = veorq_u8(state, vld1q_u8(p + i));
+        state = vaesmcq_u8(vaeseq_u8(state, key));
+        key = vaddq_u8(key, state);
+    }
+    return state;
+}
+
+static uint32x4_t sha1_pass(uint32x4_t abcd, uint32_t *e,
+                            const uint8_t *p, int n)
+{
+    const uint32x4_t k = vdupq_n_u32(0x5a827999);
+    int i;
+
+    for (i = 0; i < n; i += 64) {
+        uint32x4_t m0 = vreinterpretq_u32_u8(vld1q_u8(p + i));
+        uint32x4_t m1 = vreinterpretq_u32_u8(vld1q_u8(p + i + 16));
+        uint32x4_t m2 = vreinterpretq_u32_u8(vld1q_u8(p + i + 32));
+        uint32x4_t m3 = vreinterpretq_u32_u8(vld1q_u8(p + i + 48));
+        uint32_t e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+
+        abcd = vsha1cq_u32(abcd, *e, vaddq_u32(m0, k));
+        abcd = vsha1pq_u32(abcd, e0, vaddq_u32(m1, k));
+        abcd = vsha1mq_u32(abcd, e0, vaddq_u32(m2, k));
+        m0 = vsha1su1q_u32(vsha1su0q_u32(m0, m1, m2), m3);
+        abcd = vsha1pq_u32(abcd, e0, vaddq_u32(m0, k));
+        *e += e0;
+    }
+    return abcd;
+}
+
+static void sha256_pass(uint32x4_t *abcd, uint32x4_t *efgh,
+                        const uint8_t *p, int n)
+{
+    const uint32x4_t k = vdupq_n_u32(0x428a2f98);
+    int i;
+
+    for (i = 0; i < n; i += 64) {
+        uint32x4_t m0 = vreinterpretq_u32_u8(vld1q_u8(p + i));
+        uint32x4_t m1 = vreinterpretq_u32_u8(vld1q_u8(p + i + 16));
+        uint32x4_t m2 = vreinterpretq_u32_u8(vld1q_u8(p + i + 32));
+        uint32x4_t m3 = vreinterpretq_u32_u8(vld1q_u8(p + i + 48));
+        uint32x4_t a = *abcd, w;
+
+        w = vaddq_u32(m0, k);
+        *abcd = vsha256hq_u32(*abcd, *efgh, w);
+        *efgh = vsha256h2q_u32(*efgh, a, w);
+        m0 = vsha256su1q_u32(vsha256su0q_u32(m0, m1), m2, m3);
+        a = *abcd;
+        w = vaddq_u32(m0, k);
+        *abcd = vsha256hq_u32(*abcd, *efgh, w);
+        *efgh = vsha256h2q_u32(*efgh, a, w);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint8x16_t aes = vdupq_n_u8(0);
+    uint32x4_t sha1 = vdupq_n_u32(0x67452301);
+    uint32x4_t abcd = vdupq_n_u32(0x6a09e667);
+    uint32x4_t efgh = vdupq_n_u32(0x510e527f);
+    uint32_t e = 0xc3d2e1f0;
+    int i;
+
+    for (i = 0; i < BUFSIZE; i++) {
+        buf[i] = i;
+    }
+
+    for (i = 0; i < LOOPS; i++) {
+        aes = aes_pass(aes, buf, BUFSIZE);
+        sha1 = sha1_pass(sha1, &e, buf, BUFSIZE);
+        sha256_pass(&abcd, &efgh, buf, BUFSIZE);
+    }
+
+    printf("AES=%016llx%016llx\n",
+           (unsigned long long)vgetq_lane_u64(vreinterpretq_u64_u8(aes), 1),
+           (unsigned long long)vgetq_lane_u64(vreinterpretq_u64_u8(aes), 0));
+    printf("SHA1=%08x%08x%08x%08x%08x\n",
+           vgetq_lane_u32(sha1, 0), vgetq_lane_u32(sha1, 1),
+           vgetq_lane_u32(sha1, 2), vgetq_lane_u32(sha1, 3), e);
+    printf("SHA256=%08x%08x%08x%08x%08x%08x%08x%08x\n",
+           vgetq_lane_u32(abcd, 0), vgetq_lane_u32(abcd, 1),
+           vgetq_lane_u32(abcd, 2), vgetq_lane_u32(abcd, 3),
+           vgetq_lane_u32(efgh, 0), vgetq_lane_u32(efgh, 1),
+           vgetq_lane_u32(efgh, 2), vgetq_lane_u32(efgh, 3));
+    return 0;
+}
@@ -438,6 +438,11 @@ static QemuOptsList qemu_accel_opts = {
             .type = QEMU_OPT_STRING,
             .help = "Enable/disable multi-threaded TCG",
         },
+        {
+            .name = "prefetch",
+            .type = QEMU_OPT_NUMBER,
+            .help = "Number of threads translating code ahead of the vCPUs",
+        },
         { /* end of list */ }
     },
 };
@@ -5415,6 +5420,10 @@ static int main_impl(int argc, char** argv, void (*on_main_loop_done)(void))
 
     cpu_synchronize_all_post_init();
 
+    if (tcg_enabled()) {
+        qemu_tcg_start_prefetch();
+    }
+
     rom_reset_order_override();
 
     /* Did we create any drives that we failed to create a device for? */